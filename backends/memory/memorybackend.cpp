@@ -0,0 +1,72 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "memorybackend.h"
+#include "memorymodel.h"
+
+#include <QtCore/QtPlugin>
+
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+Q_EXPORT_PLUGIN2(soprano_memorybackend, Soprano::Memory::BackendPlugin)
+#endif
+
+
+Soprano::Memory::BackendPlugin::BackendPlugin()
+    : QObject(),
+      Backend( "memory" )
+{
+}
+
+
+Soprano::StorageModel* Soprano::Memory::BackendPlugin::createModel( const BackendSettings& settings ) const
+{
+    clearError();
+
+    Q_FOREACH( const BackendSetting& s, settings ) {
+        if ( ( s.option() == BackendOptionStorageMemory && !s.value().toBool() ) ||
+             s.option() == BackendOptionStorageDir ) {
+            setError( "The memory backend does not support persistent storage.", Error::ErrorInvalidArgument );
+            return 0;
+        }
+    }
+
+    return new MemoryModel( this );
+}
+
+
+bool Soprano::Memory::BackendPlugin::deleteModelData( const BackendSettings& settings ) const
+{
+    Q_UNUSED( settings );
+    // there is nothing stored outside of the model itself
+    clearError();
+    return true;
+}
+
+
+Soprano::BackendFeatures Soprano::Memory::BackendPlugin::supportedFeatures() const
+{
+    return(  BackendFeatureStorageMemory|
+             BackendFeatureAddStatement|
+             BackendFeatureRemoveStatements|
+             BackendFeatureListStatements|
+             BackendFeatureQuery|
+             BackendFeatureContext );
+}
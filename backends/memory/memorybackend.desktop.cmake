@@ -0,0 +1,13 @@
+[Desktop Entry]
+Encoding=UTF-8
+X-Soprano-Library=soprano_memorybackend
+X-Soprano-Plugin-Name=memory
+X-Soprano-Plugin-Author=Soprano Developers
+X-Soprano-Plugin-Website=http://soprano.sourceforge.net
+X-Soprano-Plugin-License=LGPL
+X-Soprano-Plugin-Version=1.0
+X-Soprano-Version=${SOPRANO_VERSION_STRING}
+Type=Service
+ServiceTypes=Soprano/Backend
+Name=Memory Backend
+Comment=Native Soprano in-memory backend with integer quad indexes
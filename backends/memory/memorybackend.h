@@ -0,0 +1,55 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_MEMORY_BACKEND_H_
+#define _SOPRANO_MEMORY_BACKEND_H_
+
+#include "backend.h"
+
+#include <QtCore/QObject>
+
+namespace Soprano
+{
+    namespace Memory
+    {
+        /**
+         * Backend for a native in-process memory store without any external
+         * dependencies. Only Soprano::BackendOptionStorageMemory is supported,
+         * the data is lost once the model is deleted.
+         */
+        class BackendPlugin : public QObject, public Soprano::Backend
+        {
+            Q_OBJECT
+            Q_INTERFACES(Soprano::Backend)
+
+        public:
+            BackendPlugin();
+
+            StorageModel* createModel( const BackendSettings& settings = BackendSettings() ) const;
+
+            bool deleteModelData( const BackendSettings& settings ) const;
+
+            BackendFeatures supportedFeatures() const;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,713 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "memorymodel.h"
+#include "memorystatementiterator.h"
+#include "quadindex.h"
+
+#include "statementiterator.h"
+#include "nodeiterator.h"
+#include "queryresultiterator.h"
+#include "util/simplenodeiterator.h"
+#include "util/simplestatementiterator.h"
+#include "query/queryevaluator.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QVector>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QReadWriteLock>
+#include <QtCore/QReadLocker>
+#include <QtCore/QWriteLocker>
+#include <QtCore/QUuid>
+
+
+namespace {
+    /// estimates up to this number of statements are counted exactly
+    const quint32 s_exactEstimateLimit = 1000;
+
+    /// the number of paged listings which can be continued without skipping
+    const int s_maxResumePoints = 16;
+}
+
+
+class Soprano::Memory::MemoryModel::Private
+{
+public:
+    Private()
+        : blankNodeCounter( 0 ) {
+        // id 0 is the empty node
+        nodes.append( Node() );
+        refCounts.append( 0 );
+        for ( int i = 0; i < 4; ++i )
+            positionCounts[i].append( 0 );
+
+        blankNodePrefix = QUuid::createUuid().toString();
+        blankNodePrefix = blankNodePrefix.mid( 1, 8 );
+    }
+
+    mutable QReadWriteLock lock;
+
+    /// id -> node, id 0 is the empty node
+    QVector<Node> nodes;
+    QHash<Node, NodeId> ids;
+    /// the number of quad positions an id is used in
+    QVector<quint32> refCounts;
+    /// ids of removed nodes which can be reused
+    QList<NodeId> freeIds;
+    /// the number of statements using an id per Position, maintained for estimateCount()
+    QVector<quint32> positionCounts[4];
+
+    QuadIndex indexes[IndexCount];
+
+    QString blankNodePrefix;
+    quint64 blankNodeCounter;
+
+    mutable QMutex iteratorMutex;
+    mutable QList<StatementIteratorBackend*> iterators;
+
+    /**
+     * Where a page of a paged listing ended. The page starting at \p offset
+     * continues behind the index key \p cursor instead of skipping \p offset
+     * matches again. Keys stay valid while the index changes, thus a resumed
+     * listing behaves like a keyset scan.
+     */
+    struct ResumePoint {
+        /// \p true for listContexts(), the cursor is the last context then
+        bool contexts;
+        IndexType indexType;
+        /// the pattern in index order
+        Quad pattern;
+        int offset;
+        Quad cursor;
+    };
+    mutable QMutex resumeMutex;
+    mutable QList<ResumePoint> resumePoints;
+
+    bool takeResumePoint( bool contexts, IndexType indexType, const Quad& pattern, int offset, Quad* cursor ) const {
+        QMutexLocker lock( &resumeMutex );
+        for ( int i = 0; i < resumePoints.count(); ++i ) {
+            const ResumePoint& rp = resumePoints[i];
+            if ( rp.contexts == contexts && rp.offset == offset &&
+                 rp.indexType == indexType && rp.pattern == pattern ) {
+                *cursor = rp.cursor;
+                resumePoints.removeAt( i );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void storeResumePoint( bool contexts, IndexType indexType, const Quad& pattern, int offset, const Quad& cursor ) const {
+        ResumePoint rp;
+        rp.contexts = contexts;
+        rp.indexType = indexType;
+        rp.pattern = pattern;
+        rp.offset = offset;
+        rp.cursor = cursor;
+
+        QMutexLocker lock( &resumeMutex );
+        resumePoints.append( rp );
+        if ( resumePoints.count() > s_maxResumePoints )
+            resumePoints.removeFirst();
+    }
+
+    /**
+     * \return The id of \p node or 0 if it is not known. Needs at least the read lock.
+     */
+    NodeId lookupId( const Node& node ) const {
+        return node.isEmpty() ? 0 : ids.value( node, 0 );
+    }
+
+    /**
+     * Convert the statement into a pattern quad.
+     * \return \p false if one of the nodes is not known, i.e. nothing can match.
+     */
+    bool lookupPattern( const Statement& statement, Quad* pattern ) const {
+        const Node n[4] = { statement.subject(), statement.predicate(), statement.object(), statement.context() };
+        for ( int i = 0; i < 4; ++i ) {
+            if ( n[i].isEmpty() ) {
+                pattern->ids[i] = 0;
+            }
+            else if ( !( pattern->ids[i] = lookupId( n[i] ) ) ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Intern \p node and increase its ref count. Needs the write lock.
+     */
+    NodeId ref( const Node& node ) {
+        if ( node.isEmpty() )
+            return 0;
+
+        QHash<Node, NodeId>::const_iterator it = ids.constFind( node );
+        if ( it != ids.constEnd() ) {
+            ++refCounts[it.value()];
+            return it.value();
+        }
+
+        NodeId id = 0;
+        if ( !freeIds.isEmpty() ) {
+            id = freeIds.takeLast();
+            nodes[id] = node;
+            refCounts[id] = 1;
+        }
+        else {
+            id = nodes.count();
+            nodes.append( node );
+            refCounts.append( 1 );
+            for ( int i = 0; i < 4; ++i )
+                positionCounts[i].append( 0 );
+        }
+        ids.insert( node, id );
+        return id;
+    }
+
+    /**
+     * Decrease the ref count of \p id and drop the node once it is no longer used.
+     * Needs the write lock.
+     */
+    void deref( NodeId id ) {
+        if ( id && !--refCounts[id] ) {
+            ids.remove( nodes[id] );
+            nodes[id] = Node();
+            freeIds.append( id );
+        }
+    }
+
+    bool containsQuad( const Quad& spoc ) const {
+        return indexes[SpocIndex].contains( spoc );
+    }
+
+    void insertQuad( const Quad& spoc ) {
+        for ( int i = 0; i < IndexCount; ++i )
+            indexes[i].insert( toIndexOrder( spoc, IndexType( i ) ), true );
+        for ( int i = 0; i < 4; ++i )
+            ++positionCounts[i][spoc.ids[i]];
+    }
+
+    void removeQuad( const Quad& spoc ) {
+        for ( int i = 0; i < IndexCount; ++i )
+            indexes[i].remove( toIndexOrder( spoc, IndexType( i ) ) );
+        for ( int i = 0; i < 4; ++i ) {
+            --positionCounts[i][spoc.ids[i]];
+            deref( spoc.ids[i] );
+        }
+    }
+
+    /**
+     * Collect the quads (in SPOC order) matching \p pattern. Needs at least the read lock.
+     *
+     * \param limit The maximum number of quads to collect, -1 for all.
+     */
+    QList<Quad> matchingQuads( const Quad& pattern, int limit = -1 ) const;
+
+    /**
+     * Estimate the number of quads matching \p pattern. Needs at least the read lock.
+     */
+    int estimateQuads( const Quad& pattern ) const;
+
+    /**
+     * The nodes used at \p position with the number of statements using them.
+     * Needs at least the read lock.
+     */
+    QHash<Node, int> positionStatistics( Position position ) const;
+
+    Statement toStatement( const Quad& spoc ) const {
+        return Statement( nodes[spoc.ids[0]], nodes[spoc.ids[1]], nodes[spoc.ids[2]], nodes[spoc.ids[3]] );
+    }
+};
+
+
+QList<Soprano::Memory::Quad> Soprano::Memory::MemoryModel::Private::matchingQuads( const Quad& pattern, int limit ) const
+{
+    QList<Quad> quads;
+
+    int prefixLength = 0;
+    const IndexType indexType = selectIndex( pattern, &prefixLength );
+    const QuadIndex& index = indexes[indexType];
+    const Quad key = toIndexOrder( pattern, indexType );
+
+    for ( QuadIndex::const_iterator it = index.lowerBound( key ); it != index.constEnd(); ++it ) {
+        const Quad& q = it.key();
+        bool inRange = true;
+        for ( int i = 0; i < prefixLength; ++i ) {
+            if ( q.ids[i] != key.ids[i] ) {
+                inRange = false;
+                break;
+            }
+        }
+        if ( !inRange )
+            break;
+
+        bool match = true;
+        for ( int i = prefixLength; i < 4; ++i ) {
+            if ( key.ids[i] && q.ids[i] != key.ids[i] ) {
+                match = false;
+                break;
+            }
+        }
+        if ( match ) {
+            quads.append( fromIndexOrder( q, indexType ) );
+            if ( quads.count() == limit )
+                break;
+        }
+    }
+
+    return quads;
+}
+
+
+int Soprano::Memory::MemoryModel::Private::estimateQuads( const Quad& pattern ) const
+{
+    int boundCount = 0;
+    quint32 smallest = indexes[SpocIndex].count();
+    for ( int i = 0; i < 4; ++i ) {
+        if ( pattern.ids[i] ) {
+            ++boundCount;
+            smallest = qMin( smallest, positionCounts[i][pattern.ids[i]] );
+        }
+    }
+
+    if ( boundCount <= 1 ) {
+        // the position counts are exact
+        return smallest;
+    }
+    else if ( boundCount == 4 ) {
+        return containsQuad( pattern ) ? 1 : 0;
+    }
+
+    // if all bound positions form the prefix of one index the matches are one
+    // contiguous range which cannot be longer than the smallest position count
+    int prefixLength = 0;
+    selectIndex( pattern, &prefixLength );
+    if ( prefixLength == boundCount && smallest <= s_exactEstimateLimit ) {
+        return matchingQuads( pattern ).count();
+    }
+
+    // the smallest position count is an upper bound
+    return smallest;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Memory::MemoryModel::Private::positionStatistics( Position position ) const
+{
+    QHash<Node, int> counts;
+    const QVector<quint32>& positionCount = positionCounts[position];
+    for ( int id = 0; id < positionCount.count(); ++id ) {
+        if ( positionCount[id] )
+            counts.insert( nodes[id], positionCount[id] );
+    }
+    return counts;
+}
+
+
+Soprano::Memory::MemoryModel::MemoryModel( const Backend* backend )
+    : StorageModel( backend ),
+      d( new Private() )
+{
+}
+
+
+Soprano::Memory::MemoryModel::~MemoryModel()
+{
+    d->iteratorMutex.lock();
+    QList<StatementIteratorBackend*> iterators = d->iterators;
+    d->iteratorMutex.unlock();
+
+    // closing removes the iterator from the list
+    Q_FOREACH( StatementIteratorBackend* it, iterators ) {
+        it->close();
+    }
+
+    delete d;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Memory::MemoryModel::addStatement( const Statement& statement )
+{
+    if ( !statement.isValid() ) {
+        setError( "Cannot add invalid statement", Error::ErrorInvalidArgument );
+        return Error::ErrorInvalidArgument;
+    }
+
+    clearError();
+
+    d->lock.lockForWrite();
+
+    Quad spoc;
+    bool added = false;
+    if ( !d->lookupPattern( statement, &spoc ) || !d->containsQuad( spoc ) ) {
+        spoc = Quad( d->ref( statement.subject() ),
+                     d->ref( statement.predicate() ),
+                     d->ref( statement.object() ),
+                     d->ref( statement.context() ) );
+        d->insertQuad( spoc );
+        added = true;
+    }
+
+    d->lock.unlock();
+
+    if ( added ) {
+        emit statementAdded( statement );
+        emit statementsAdded();
+    }
+
+    return Error::ErrorNone;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Memory::MemoryModel::removeStatement( const Statement& statement )
+{
+    if ( !statement.isValid() ) {
+        setError( "Cannot remove invalid statement", Error::ErrorInvalidArgument );
+        return Error::ErrorInvalidArgument;
+    }
+
+    clearError();
+
+    d->lock.lockForWrite();
+
+    // an empty context refers to the default graph
+    Quad spoc;
+    bool removed = false;
+    if ( d->lookupPattern( statement, &spoc ) && d->containsQuad( spoc ) ) {
+        d->removeQuad( spoc );
+        removed = true;
+    }
+
+    d->lock.unlock();
+
+    if ( removed ) {
+        emit statementRemoved( statement );
+        emit statementsRemoved();
+    }
+
+    return Error::ErrorNone;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Memory::MemoryModel::removeAllStatements( const Statement& statement )
+{
+    takeAllStatements( statement );
+    return Error::ErrorNone;
+}
+
+
+QList<Soprano::Statement> Soprano::Memory::MemoryModel::takeAllStatements( const Statement& statement )
+{
+    clearError();
+
+    QList<Statement> removed;
+
+    d->lock.lockForWrite();
+
+    Quad pattern;
+    if ( d->lookupPattern( statement, &pattern ) ) {
+        const QList<Quad> quads = d->matchingQuads( pattern );
+        Q_FOREACH( const Quad& spoc, quads ) {
+            // convert before removing since the nodes might be dropped
+            removed.append( d->toStatement( spoc ) );
+            d->removeQuad( spoc );
+        }
+    }
+
+    d->lock.unlock();
+
+    if ( !removed.isEmpty() ) {
+        Q_FOREACH( const Statement& s, removed ) {
+            emit statementRemoved( s );
+        }
+        emit statementsRemoved();
+    }
+
+    return removed;
+}
+
+
+Soprano::StatementIterator Soprano::Memory::MemoryModel::listStatements( const Statement& partial ) const
+{
+    return listStatements( partial, 0, -1 );
+}
+
+
+Soprano::StatementIterator Soprano::Memory::MemoryModel::listStatements( const Statement& partial, int offset, int limit ) const
+{
+    clearError();
+
+    QReadLocker lock( &d->lock );
+
+    Quad pattern;
+    if ( !d->lookupPattern( partial, &pattern ) ) {
+        // one of the nodes does not exist, thus nothing can match
+        return Util::SimpleStatementIterator();
+    }
+
+    int prefixLength = 0;
+    const IndexType indexType = selectIndex( pattern, &prefixLength );
+
+    // the iterator reads the index through readIndex()
+    StatementIteratorBackend* it = 0;
+    Quad cursor;
+    if ( offset > 0 && d->takeResumePoint( false, indexType, toIndexOrder( pattern, indexType ), offset, &cursor ) )
+        it = new StatementIteratorBackend( this, indexType, pattern, offset, limit, &cursor );
+    else
+        it = new StatementIteratorBackend( this, indexType, pattern, offset, limit );
+
+    QMutexLocker iteratorLock( &d->iteratorMutex );
+    d->iterators.append( it );
+    return StatementIterator( it );
+}
+
+
+Soprano::NodeIterator Soprano::Memory::MemoryModel::listContexts() const
+{
+    return listContexts( 0, -1 );
+}
+
+
+Soprano::NodeIterator Soprano::Memory::MemoryModel::listContexts( int offset, int limit ) const
+{
+    clearError();
+
+    QList<Node> contexts;
+    int skip = qMax( 0, offset );
+
+    QReadLocker lock( &d->lock );
+
+    // the CSPO index is sorted by context, thus we can skip from one context to the next
+    const QuadIndex& index = d->indexes[CspoIndex];
+    QuadIndex::const_iterator it = index.lowerBound( Quad( 1, 0, 0, 0 ) );
+
+    // continue behind the last context of the previous page
+    Quad cursor;
+    if ( skip > 0 && d->takeResumePoint( true, CspoIndex, Quad(), skip, &cursor ) ) {
+        skip = 0;
+        it = ( cursor.ids[0] == NodeId( -1 ) ? index.constEnd() : index.lowerBound( Quad( cursor.ids[0] + 1, 0, 0, 0 ) ) );
+    }
+
+    while ( it != index.constEnd() && ( limit < 0 || contexts.count() < limit ) ) {
+        const NodeId c = it.key().ids[0];
+        cursor = Quad( c, 0, 0, 0 );
+        if ( skip > 0 )
+            --skip;
+        else
+            contexts.append( d->nodes[c] );
+        if ( c == NodeId( -1 ) )
+            break;
+        it = index.lowerBound( Quad( c + 1, 0, 0, 0 ) );
+    }
+
+    if ( limit > 0 && contexts.count() == limit )
+        d->storeResumePoint( true, CspoIndex, Quad(), qMax( 0, offset ) + limit, cursor );
+
+    return Util::SimpleNodeIterator( contexts );
+}
+
+
+Soprano::QueryResultIterator Soprano::Memory::MemoryModel::executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    // the evaluator works through listStatements(), thus we do not lock here
+    Query::Evaluator evaluator( this );
+    QueryResultIterator it = evaluator.executeQuery( query, language, userQueryLanguage );
+    setError( evaluator.lastError() );
+    return it;
+}
+
+
+bool Soprano::Memory::MemoryModel::containsStatement( const Statement& statement ) const
+{
+    if ( !statement.isValid() ) {
+        setError( "Cannot check for invalid statement", Error::ErrorInvalidArgument );
+        return false;
+    }
+
+    clearError();
+
+    QReadLocker lock( &d->lock );
+
+    // an empty context refers to the default graph
+    Quad spoc;
+    return d->lookupPattern( statement, &spoc ) && d->containsQuad( spoc );
+}
+
+
+QBitArray Soprano::Memory::MemoryModel::containsStatements( const QList<Statement>& statements ) const
+{
+    for ( int i = 0; i < statements.count(); ++i ) {
+        if ( !statements[i].isValid() ) {
+            setError( "Cannot check for invalid statement", Error::ErrorInvalidArgument );
+            return QBitArray();
+        }
+    }
+
+    clearError();
+
+    QBitArray result( statements.count() );
+
+    // one lock for all lookups
+    QReadLocker lock( &d->lock );
+    for ( int i = 0; i < statements.count(); ++i ) {
+        Quad spoc;
+        if ( d->lookupPattern( statements[i], &spoc ) && d->containsQuad( spoc ) )
+            result.setBit( i );
+    }
+
+    return result;
+}
+
+
+bool Soprano::Memory::MemoryModel::containsAnyStatement( const Statement& statement ) const
+{
+    clearError();
+
+    QReadLocker lock( &d->lock );
+
+    Quad pattern;
+    if ( !d->lookupPattern( statement, &pattern ) )
+        return false;
+
+    return !d->matchingQuads( pattern, 1 ).isEmpty();
+}
+
+
+bool Soprano::Memory::MemoryModel::isEmpty() const
+{
+    clearError();
+    QReadLocker lock( &d->lock );
+    return d->indexes[SpocIndex].isEmpty();
+}
+
+
+int Soprano::Memory::MemoryModel::statementCount() const
+{
+    clearError();
+    QReadLocker lock( &d->lock );
+    return d->indexes[SpocIndex].count();
+}
+
+
+int Soprano::Memory::MemoryModel::estimateCount( const Statement& pattern ) const
+{
+    clearError();
+
+    QReadLocker lock( &d->lock );
+
+    Quad q;
+    if ( !d->lookupPattern( pattern, &q ) )
+        return 0;
+
+    return d->estimateQuads( q );
+}
+
+
+QHash<Soprano::Node, int> Soprano::Memory::MemoryModel::predicateStatistics() const
+{
+    clearError();
+    QReadLocker lock( &d->lock );
+    return d->positionStatistics( PredicatePosition );
+}
+
+
+QHash<Soprano::Node, int> Soprano::Memory::MemoryModel::contextStatistics() const
+{
+    clearError();
+    QReadLocker lock( &d->lock );
+    // id 0 is the default graph
+    return d->positionStatistics( ContextPosition );
+}
+
+
+Soprano::Node Soprano::Memory::MemoryModel::createBlankNode()
+{
+    clearError();
+    QWriteLocker lock( &d->lock );
+    return Node::createBlankNode( QString( "%1b%2" ).arg( d->blankNodePrefix ).arg( ++d->blankNodeCounter ) );
+}
+
+
+QList<Soprano::Statement> Soprano::Memory::MemoryModel::readIndex( IndexType indexType, const Quad& pattern, int prefixLength,
+                                                                  Quad* cursor, bool first, int* skip, int max, bool* atEnd ) const
+{
+    QList<Statement> statements;
+
+    QReadLocker lock( &d->lock );
+
+    // Keys are unique, thus the upper bound of the last key is where we stopped,
+    // no matter how the index changed in the meantime.
+    const QuadIndex& index = d->indexes[indexType];
+    QuadIndex::const_iterator it = first ? index.lowerBound( pattern ) : index.upperBound( *cursor );
+
+    *atEnd = true;
+    for ( ; it != index.constEnd(); ++it ) {
+        const Quad& key = it.key();
+        bool inRange = true;
+        for ( int i = 0; i < prefixLength; ++i ) {
+            if ( key.ids[i] != pattern.ids[i] ) {
+                inRange = false;
+                break;
+            }
+        }
+        if ( !inRange )
+            break;
+
+        if ( statements.count() == max ) {
+            *atEnd = false;
+            break;
+        }
+
+        *cursor = key;
+
+        bool match = true;
+        for ( int i = prefixLength; i < 4; ++i ) {
+            if ( pattern.ids[i] && key.ids[i] != pattern.ids[i] ) {
+                match = false;
+                break;
+            }
+        }
+        if ( match ) {
+            // skipped matches are never converted into statements
+            if ( *skip > 0 )
+                --*skip;
+            else
+                statements.append( d->toStatement( fromIndexOrder( key, indexType ) ) );
+        }
+    }
+
+    return statements;
+}
+
+
+void Soprano::Memory::MemoryModel::storeResumePoint( IndexType indexType, const Quad& pattern, int offset, const Quad& cursor ) const
+{
+    d->storeResumePoint( false, indexType, pattern, offset, cursor );
+}
+
+
+void Soprano::Memory::MemoryModel::removeIterator( StatementIteratorBackend* it ) const
+{
+    QMutexLocker lock( &d->iteratorMutex );
+    d->iterators.removeAll( it );
+}
@@ -0,0 +1,129 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_MEMORY_MODEL_H_
+#define _SOPRANO_MEMORY_MODEL_H_
+
+#include "storagemodel.h"
+#include "statement.h"
+#include "node.h"
+
+#include "quadindex.h"
+
+#include <QtCore/QList>
+
+namespace Soprano {
+
+    class QueryResultIterator;
+    class StatementIterator;
+
+    namespace Memory {
+
+        class StatementIteratorBackend;
+
+        /**
+         * A pure in-process memory model. Nodes are mapped to integer ids
+         * and the statements are kept in four sorted permutation indexes
+         * (SPOC, POCS, OCSP, CSPO) which allow to answer every statement
+         * pattern with a range scan.
+         *
+         * For each node the model counts the statements using it in each position.
+         * These counts answer estimateCount() and the statistics without a scan.
+         *
+         * Reading is done under a shared lock, thus any number of threads can
+         * read at the same time. Iterators do not keep the model locked. They read
+         * the index in small batches and continue after the last key they have seen,
+         * thus writers never need to copy an index while iterators are open.
+         *
+         * Paged listings remember the last key of each page. A request for the
+         * following page continues behind it instead of skipping the matches of all
+         * previous pages again, thus a complete paged scan stays linear.
+         */
+        class MemoryModel : public Soprano::StorageModel
+        {
+            Q_OBJECT
+
+        public:
+            MemoryModel( const Backend* );
+            ~MemoryModel();
+
+            Error::ErrorCode addStatement( const Statement& statement );
+            Error::ErrorCode removeStatement( const Statement& statement );
+            Error::ErrorCode removeAllStatements( const Statement& statement );
+            QList<Statement> takeAllStatements( const Statement& statement );
+
+            StatementIterator listStatements( const Statement& partial ) const;
+            NodeIterator listContexts() const;
+            StatementIterator listStatements( const Statement& partial, int offset, int limit ) const;
+            NodeIterator listContexts( int offset, int limit ) const;
+
+            QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+
+            bool containsStatement( const Statement& statement ) const;
+            bool containsAnyStatement( const Statement& statement ) const;
+            QBitArray containsStatements( const QList<Statement>& statements ) const;
+
+            bool isEmpty() const;
+            int statementCount() const;
+            int estimateCount( const Statement& pattern ) const;
+            QHash<Node, int> predicateStatistics() const;
+            QHash<Node, int> contextStatistics() const;
+
+            Node createBlankNode();
+
+            using StorageModel::addStatement;
+            using StorageModel::removeStatement;
+            using StorageModel::removeAllStatements;
+            using StorageModel::listStatements;
+            using StorageModel::containsStatement;
+            using StorageModel::containsAnyStatement;
+
+        private:
+            /**
+             * Read the next batch of \p max statements for an iterator. Takes the read lock.
+             *
+             * \param pattern The pattern in the order of \p indexType.
+             * \param prefixLength The number of leading bound positions in \p pattern.
+             * \param cursor The last key read by the iterator. Will be set to the last key of
+             * the batch.
+             * \param first \p true to start at the beginning of the range, \p cursor is ignored then.
+             * \param skip The number of matches to skip, decreased by the skipped matches.
+             * \param atEnd Will be set to \p true if the range has been read completely.
+             */
+            QList<Statement> readIndex( IndexType indexType, const Quad& pattern, int prefixLength,
+                                        Quad* cursor, bool first, int* skip, int max, bool* atEnd ) const;
+            void removeIterator( StatementIteratorBackend* it ) const;
+
+            /**
+             * Remember that the page of \p pattern (in the order of \p indexType) starting at
+             * \p offset continues behind \p cursor.
+             */
+            void storeResumePoint( IndexType indexType, const Quad& pattern, int offset, const Quad& cursor ) const;
+
+            class Private;
+            Private* const d;
+
+            friend class StatementIteratorBackend;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "memorystatementiterator.h"
+#include "memorymodel.h"
+
+
+namespace {
+    /// the number of statements read from the index at once
+    const int s_batchSize = 128;
+}
+
+
+Soprano::Memory::StatementIteratorBackend::StatementIteratorBackend( const MemoryModel* model,
+                                                                     IndexType indexType,
+                                                                     const Quad& pattern,
+                                                                     int offset,
+                                                                     int limit,
+                                                                     const Quad* resumeCursor )
+    : m_model( model ),
+      m_indexType( indexType ),
+      m_pattern( toIndexOrder( pattern, indexType ) ),
+      m_prefixLength( 0 ),
+      m_skip( qMax( 0, offset ) ),
+      m_remaining( limit ),
+      m_offset( qMax( 0, offset ) ),
+      m_limit( limit ),
+      m_batchPos( 0 ),
+      m_first( true ),
+      m_atEnd( false ),
+      m_closed( false )
+{
+    while ( m_prefixLength < 4 && m_pattern.ids[m_prefixLength] != 0 )
+        ++m_prefixLength;
+
+    if ( resumeCursor ) {
+        m_cursor = *resumeCursor;
+        m_first = false;
+        m_skip = 0;
+    }
+}
+
+
+Soprano::Memory::StatementIteratorBackend::~StatementIteratorBackend()
+{
+    close();
+}
+
+
+bool Soprano::Memory::StatementIteratorBackend::next()
+{
+    if ( m_closed )
+        return false;
+
+    if ( m_remaining == 0 ) {
+        close();
+        return false;
+    }
+
+    if ( !m_first )
+        ++m_batchPos;
+
+    if ( m_batchPos >= m_batch.count() ) {
+        if ( m_atEnd ) {
+            close();
+            return false;
+        }
+
+        const int max = ( m_remaining > 0 ? qMin( m_remaining, s_batchSize ) : s_batchSize );
+        m_batch = m_model->readIndex( m_indexType, m_pattern, m_prefixLength, &m_cursor, m_first, &m_skip, max, &m_atEnd );
+        m_batchPos = 0;
+        m_first = false;
+
+        if ( m_batch.isEmpty() ) {
+            close();
+            return false;
+        }
+    }
+
+    if ( m_remaining > 0 && --m_remaining == 0 ) {
+        // the last statement of the range, only keep it for current()
+        m_batch = QList<Statement>() << m_batch[m_batchPos];
+        m_batchPos = 0;
+        m_atEnd = true;
+        if ( m_model ) {
+            // the cursor is the key of the last statement, the next page continues behind it
+            m_model->storeResumePoint( m_indexType, m_pattern, m_offset + m_limit, m_cursor );
+            m_model->removeIterator( this );
+            m_model = 0;
+        }
+    }
+    return true;
+}
+
+
+Soprano::Statement Soprano::Memory::StatementIteratorBackend::current() const
+{
+    if ( m_closed || m_batchPos >= m_batch.count() )
+        return Statement();
+
+    return m_batch[m_batchPos];
+}
+
+
+void Soprano::Memory::StatementIteratorBackend::close()
+{
+    if ( !m_closed ) {
+        m_closed = true;
+        m_batch.clear();
+        if ( m_model ) {
+            m_model->removeIterator( this );
+            m_model = 0;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_MEMORY_STATEMENT_ITERATOR_H_
+#define _SOPRANO_MEMORY_STATEMENT_ITERATOR_H_
+
+#include "iteratorbackend.h"
+#include "statement.h"
+#include "node.h"
+
+#include "quadindex.h"
+
+#include <QtCore/QList>
+
+namespace Soprano {
+    namespace Memory {
+
+        class MemoryModel;
+
+        /**
+         * Scans a range of one of the permutation indexes. The iterator
+         * reads the statements in batches and only locks the model while
+         * reading a batch. Changes behind the last read key are seen by the
+         * following batches.
+         */
+        class StatementIteratorBackend : public Soprano::IteratorBackend<Statement>
+        {
+        public:
+            /**
+             * \param pattern The pattern in SPOC order with 0 as wildcard.
+             * \param offset The number of matches to skip.
+             * \param limit The maximum number of matches to return, -1 for no limit.
+             * \param resumeCursor The last key of the previous page. If set, the iterator continues
+             * behind it instead of skipping \p offset matches.
+             */
+            StatementIteratorBackend( const MemoryModel* model,
+                                      IndexType indexType,
+                                      const Quad& pattern,
+                                      int offset = 0,
+                                      int limit = -1,
+                                      const Quad* resumeCursor = 0 );
+            ~StatementIteratorBackend();
+
+            bool next();
+            Statement current() const;
+            void close();
+
+        private:
+            const MemoryModel* m_model;
+            IndexType m_indexType;
+
+            /// the pattern in index order
+            Quad m_pattern;
+            int m_prefixLength;
+
+            /// matches still to be skipped and returned
+            int m_skip;
+            int m_remaining;
+
+            /// the range requested, used to continue with the next page
+            int m_offset;
+            int m_limit;
+
+            /// the last key read from the index
+            Quad m_cursor;
+            QList<Statement> m_batch;
+            int m_batchPos;
+            bool m_first;
+            bool m_atEnd;
+            bool m_closed;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,153 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_MEMORY_QUAD_INDEX_H_
+#define _SOPRANO_MEMORY_QUAD_INDEX_H_
+
+#include <QtCore/QtGlobal>
+#include <QtCore/QMap>
+
+namespace Soprano {
+    namespace Memory {
+        /**
+         * Nodes are stored as integer ids in the indexes. Id 0 is
+         * reserved for the empty node (wildcard or default graph).
+         */
+        typedef quint32 NodeId;
+
+        enum Position {
+            SubjectPosition = 0,
+            PredicatePosition = 1,
+            ObjectPosition = 2,
+            ContextPosition = 3
+        };
+
+        /**
+         * The permutations we keep a sorted index for. Together they
+         * provide a prefix match for every single bound position and
+         * every combination of three bound positions.
+         */
+        enum IndexType {
+            SpocIndex = 0,
+            PocsIndex = 1,
+            OcspIndex = 2,
+            CspoIndex = 3,
+            IndexCount = 4
+        };
+
+        /**
+         * A quad of node ids. Depending on the context the ids are either
+         * stored in SPOC order or in the order of one of the IndexTypes.
+         */
+        struct Quad {
+            Quad() {
+                ids[0] = ids[1] = ids[2] = ids[3] = 0;
+            }
+            Quad( NodeId s, NodeId p, NodeId o, NodeId c ) {
+                ids[0] = s;
+                ids[1] = p;
+                ids[2] = o;
+                ids[3] = c;
+            }
+
+            NodeId ids[4];
+        };
+
+        inline bool operator<( const Quad& a, const Quad& b ) {
+            for ( int i = 0; i < 4; ++i ) {
+                if ( a.ids[i] != b.ids[i] )
+                    return a.ids[i] < b.ids[i];
+            }
+            return false;
+        }
+
+        inline bool operator==( const Quad& a, const Quad& b ) {
+            return( a.ids[0] == b.ids[0] &&
+                    a.ids[1] == b.ids[1] &&
+                    a.ids[2] == b.ids[2] &&
+                    a.ids[3] == b.ids[3] );
+        }
+
+        /**
+         * A sorted permutation index. Iterators remember the last key they
+         * returned and continue the scan at its upper bound.
+         */
+        typedef QMap<Quad, bool> QuadIndex;
+
+        /**
+         * \return The Position stored at \p i in index \p index.
+         */
+        inline int indexPosition( IndexType index, int i ) {
+            static const int s_permutations[IndexCount][4] = {
+                { SubjectPosition, PredicatePosition, ObjectPosition, ContextPosition },
+                { PredicatePosition, ObjectPosition, ContextPosition, SubjectPosition },
+                { ObjectPosition, ContextPosition, SubjectPosition, PredicatePosition },
+                { ContextPosition, SubjectPosition, PredicatePosition, ObjectPosition }
+            };
+            return s_permutations[index][i];
+        }
+
+        /**
+         * Convert an SPOC quad into the order of \p index.
+         */
+        inline Quad toIndexOrder( const Quad& spoc, IndexType index ) {
+            Quad q;
+            for ( int i = 0; i < 4; ++i )
+                q.ids[i] = spoc.ids[indexPosition( index, i )];
+            return q;
+        }
+
+        /**
+         * Convert a quad in the order of \p index back into SPOC order.
+         */
+        inline Quad fromIndexOrder( const Quad& key, IndexType index ) {
+            Quad q;
+            for ( int i = 0; i < 4; ++i )
+                q.ids[indexPosition( index, i )] = key.ids[i];
+            return q;
+        }
+
+        /**
+         * Select the index which provides the longest prefix match for the bound
+         * positions in \p pattern (an SPOC quad with 0 as wildcard).
+         *
+         * \param prefixLength Will be set to the number of leading bound positions
+         * in the selected index.
+         */
+        inline IndexType selectIndex( const Quad& pattern, int* prefixLength ) {
+            IndexType best = SpocIndex;
+            int bestLength = -1;
+            for ( int index = 0; index < IndexCount; ++index ) {
+                int len = 0;
+                while ( len < 4 && pattern.ids[indexPosition( IndexType( index ), len )] != 0 )
+                    ++len;
+                if ( len > bestLength ) {
+                    best = IndexType( index );
+                    bestLength = len;
+                }
+            }
+            *prefixLength = bestLength;
+            return best;
+        }
+    }
+}
+
+#endif
@@ -31,8 +31,11 @@
 #include "redlandstatementiterator.h"
 #include "redlandnodeiteratorbackend.h"
 #include "multimutex.h"
+#include "requestcontext.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 
 
 namespace {
@@ -44,6 +47,9 @@ namespace {
                  statement.context().isValid() );
     }
 
+    /// the number of streams kept for continuing paged listings
+    const int s_maxParkedStreams = 8;
+
     bool isRedlandStatementEmpty( librdf_statement* statement )
     {
         return ( !statement ||
@@ -73,6 +79,57 @@ public:
     QList<Redland::NodeIteratorBackend*> nodeIterators;
     QList<RedlandQueryResult*> results;
 
+    /**
+     * A stream positioned at the last statement of a page. The following page
+     * continues with it instead of skipping all preceding statements again.
+     * Parked streams do not hold the read lock, thus they are freed on each write.
+     */
+    struct ParkedStream {
+        Statement pattern;
+        int offset;
+        librdf_stream* stream;
+    };
+    QList<ParkedStream> parkedStreams;
+    QMutex parkedStreamsMutex;
+
+    /**
+     * \return The stream parked for the page of \p pattern starting at \p offset
+     * or 0 if there is none. Needs the read lock.
+     */
+    librdf_stream* takeParkedStream( const Statement& pattern, int offset ) {
+        QMutexLocker lock( &parkedStreamsMutex );
+        for ( int i = 0; i < parkedStreams.count(); ++i ) {
+            if ( parkedStreams[i].offset == offset && parkedStreams[i].pattern == pattern )
+                return parkedStreams.takeAt( i ).stream;
+        }
+        return 0;
+    }
+
+    /**
+     * Keep \p stream for the page of \p pattern starting at \p offset. Needs the read lock.
+     */
+    void parkStream( const Statement& pattern, int offset, librdf_stream* stream ) {
+        QMutexLocker lock( &parkedStreamsMutex );
+        ParkedStream parked;
+        parked.pattern = pattern;
+        parked.offset = offset;
+        parked.stream = stream;
+        parkedStreams.append( parked );
+        if ( parkedStreams.count() > s_maxParkedStreams )
+            librdf_free_stream( parkedStreams.takeFirst().stream );
+    }
+
+    /**
+     * Needs the write lock.
+     */
+    void freeParkedStreams() {
+        QMutexLocker lock( &parkedStreamsMutex );
+        Q_FOREACH( const ParkedStream& parked, parkedStreams ) {
+            librdf_free_stream( parked.stream );
+        }
+        parkedStreams.clear();
+    }
+
     /**
      * librdf_model_find_statements_in_context does not support empty contexts. All in all
      * redland is not very flexible. Thus, we have to do it all manually.
@@ -87,6 +144,12 @@ public:
      */
     int redlandContainsStatement( const Soprano::Statement& statement );
     int redlandContainsStatement( librdf_statement* statement, librdf_node* context );
+
+    /**
+     * Read all statements matching \p pattern. Requires the lock to be held.
+     * \return false on error.
+     */
+    bool redlandAllStatements( const Soprano::Statement& pattern, QList<Soprano::Statement>* statements );
 };
 
 
@@ -124,6 +187,33 @@ librdf_stream* Soprano::Redland::RedlandModel::Private::redlandFindStatements( l
 }
 
 
+bool Soprano::Redland::RedlandModel::Private::redlandAllStatements( const Soprano::Statement& pattern, QList<Soprano::Statement>* statements )
+{
+    librdf_stream* stream = redlandFindStatements( pattern );
+    if ( !stream ) {
+        return false;
+    }
+
+    while ( !librdf_stream_end( stream ) ) {
+        librdf_statement* st = librdf_stream_get_object( stream );
+        if ( st ) {
+            Soprano::Statement copy = world->createStatement( st );
+            if ( librdf_node* context = static_cast<librdf_node*>( librdf_stream_get_context( stream ) ) ) {
+                copy.setContext( world->createNode( context ) );
+            }
+            else if ( pattern.context().isValid() ) {
+                copy.setContext( pattern.context() );
+            }
+            statements->append( copy );
+        }
+        librdf_stream_next( stream );
+    }
+
+    librdf_free_stream( stream );
+    return true;
+}
+
+
 int Soprano::Redland::RedlandModel::Private::redlandContainsStatement( const Soprano::Statement& statement )
 {
     librdf_statement* s = world->createStatement( statement );
@@ -184,6 +274,8 @@ Soprano::Redland::RedlandModel::~RedlandModel()
         ( *it )->close();
     }
 
+    d->freeParkedStreams();
+
     librdf_free_model( d->model );
     librdf_free_storage( d->storage );
 
@@ -216,6 +308,7 @@ Soprano::Error::ErrorCode Soprano::Redland::RedlandModel::addStatement( const St
     bool added = true;
 
     d->readWriteLock.lockForWrite();
+    d->freeParkedStreams();
 
     librdf_statement* redlandStatement = d->world->createStatement( statement );
     if ( !redlandStatement ||
@@ -320,6 +413,42 @@ bool Soprano::Redland::RedlandModel::containsStatement( const Statement& stateme
 }
 
 
+QBitArray Soprano::Redland::RedlandModel::containsStatements( const QList<Statement>& statements ) const
+{
+    for ( int i = 0; i < statements.count(); ++i ) {
+        if ( !statements[i].isValid() ) {
+            setError( "Cannot check for invalid statement", Error::ErrorInvalidArgument );
+            return QBitArray();
+        }
+    }
+
+    clearError();
+
+    QBitArray result( statements.count() );
+
+    // keep the read lock for all lookups instead of locking once per statement
+    MultiMutexReadLocker lock( &d->readWriteLock );
+    for ( int i = 0; i < statements.count(); ++i ) {
+        const Statement& statement = statements[i];
+        if ( statement.context().isValid() ) {
+            int c = d->redlandContainsStatement( statement );
+            if ( c < 0 ) {
+                setError( d->world->lastError() );
+                return QBitArray();
+            }
+            result.setBit( i, c > 0 );
+        }
+        else {
+            result.setBit( i, StorageModel::containsStatement( statement ) );
+            if ( lastError() )
+                return QBitArray();
+        }
+    }
+
+    return result;
+}
+
+
 bool Soprano::Redland::RedlandModel::containsAnyStatement( const Statement& statement ) const
 {
     MultiMutexReadLocker lock( &d->readWriteLock );
@@ -350,6 +479,16 @@ Soprano::QueryResultIterator Soprano::Redland::RedlandModel::executeQuery( const
         return QueryResultIterator();
     }
 
+    // librdf cannot abort a running query, thus, we only check before
+    // executing. RedlandQueryResult checks again for each row.
+    const RequestContext context = RequestContext::current();
+    if ( context.isCancelled() ) {
+        librdf_free_query( q );
+        setError( context.cancelError() );
+        d->readWriteLock.unlock();
+        return QueryResultIterator();
+    }
+
     librdf_query_results *res = librdf_model_query_execute( d->model, q );
     if ( !res ) {
         librdf_free_query( q );
@@ -366,19 +505,37 @@ Soprano::QueryResultIterator Soprano::Redland::RedlandModel::executeQuery( const
 
 
 Soprano::StatementIterator Soprano::Redland::RedlandModel::listStatements( const Statement& partial ) const
+{
+    return listStatements( partial, 0, -1 );
+}
+
+
+Soprano::StatementIterator Soprano::Redland::RedlandModel::listStatements( const Statement& partial, int offset, int limit ) const
 {
     d->readWriteLock.lockForRead();
 
     clearError();
 
-    librdf_stream* stream = d->redlandFindStatements( partial );
-    if ( !stream ) {
-        setError( d->world->lastError() );
-        d->readWriteLock.unlock();
-        return StatementIterator();
+    librdf_stream* stream = ( offset > 0 ? d->takeParkedStream( partial, offset ) : 0 );
+    if ( stream ) {
+        // the previous page stopped at its last statement
+        librdf_stream_next( stream );
     }
+    else {
+        stream = d->redlandFindStatements( partial );
+        if ( !stream ) {
+            setError( d->world->lastError() );
+            d->readWriteLock.unlock();
+            return StatementIterator();
+        }
 
-    RedlandStatementIterator* it = new RedlandStatementIterator( this, stream, partial.context() );
+        // position the stream without converting the skipped statements
+        for ( int i = 0; i < offset && !librdf_stream_end( stream ); ++i ) {
+            librdf_stream_next( stream );
+        }
+    }
+
+    RedlandStatementIterator* it = new RedlandStatementIterator( this, stream, partial, offset, limit );
     d->iterators.append( it );
     return StatementIterator( it );
 }
@@ -387,6 +544,7 @@ Soprano::StatementIterator Soprano::Redland::RedlandModel::listStatements( const
 Soprano::Error::ErrorCode Soprano::Redland::RedlandModel::removeStatement( const Statement& statement )
 {
     d->readWriteLock.lockForWrite();
+    d->freeParkedStreams();
     Error::ErrorCode r = removeOneStatement( statement );
 
     // make sure we store everything in case we crash
@@ -447,6 +605,7 @@ Soprano::Error::ErrorCode Soprano::Redland::RedlandModel::removeAllStatements( c
 
     if ( isContextOnlyStatement( statement ) ) {
         d->readWriteLock.lockForWrite();
+        d->freeParkedStreams();
 
         librdf_node *ctx = d->world->createNode( statement.context() );
 
@@ -477,6 +636,7 @@ Soprano::Error::ErrorCode Soprano::Redland::RedlandModel::removeAllStatements( c
         QList<Statement> statementsToRemove = listStatements( statement ).allStatements();
 
         d->readWriteLock.lockForWrite();
+        d->freeParkedStreams();
 
         int cnt = 0;
         for ( QList<Statement>::const_iterator it = statementsToRemove.constBegin();
@@ -506,6 +666,65 @@ Soprano::Error::ErrorCode Soprano::Redland::RedlandModel::removeAllStatements( c
 }
 
 
+QList<Soprano::Statement> Soprano::Redland::RedlandModel::takeAllStatements( const Statement &statement )
+{
+    clearError();
+
+    QList<Statement> removed;
+
+    d->readWriteLock.lockForWrite();
+    d->freeParkedStreams();
+
+    if ( !d->redlandAllStatements( statement, &removed ) ) {
+        setError( d->world->lastError() );
+        d->readWriteLock.unlock();
+        return QList<Statement>();
+    }
+
+    if ( isContextOnlyStatement( statement ) ) {
+        librdf_node *ctx = d->world->createNode( statement.context() );
+        if ( librdf_model_context_remove_statements( d->model, ctx ) ) {
+            d->world->freeNode( ctx );
+            setError( d->world->lastError() );
+            d->readWriteLock.unlock();
+            return QList<Statement>();
+        }
+        d->world->freeNode( ctx );
+
+        librdf_model_sync( d->model );
+        d->readWriteLock.unlock();
+
+        Q_FOREACH( const Statement& s, removed ) {
+            emit statementRemoved( s );
+        }
+    }
+    else {
+        for ( int i = 0; i < removed.count(); ++i ) {
+            // removeOneStatement emits statementRemoved
+            if ( removeOneStatement( removed[i] ) != Error::ErrorNone ) {
+                removed = removed.mid( 0, i );
+                librdf_model_sync( d->model );
+                d->readWriteLock.unlock();
+                Error::Error error = lastError();
+                if ( !removed.isEmpty() ) {
+                    emit statementsRemoved();
+                }
+                setError( error );
+                return removed;
+            }
+        }
+
+        librdf_model_sync( d->model );
+        d->readWriteLock.unlock();
+    }
+
+    if ( !removed.isEmpty() ) {
+        emit statementsRemoved();
+    }
+    return removed;
+}
+
+
 int Soprano::Redland::RedlandModel::statementCount() const
 {
     MultiMutexReadLocker lock( &d->readWriteLock );
@@ -529,6 +748,12 @@ Soprano::Node Soprano::Redland::RedlandModel::createBlankNode()
 }
 
 
+void Soprano::Redland::RedlandModel::parkStream( const Statement& pattern, int offset, librdf_stream* stream ) const
+{
+    d->parkStream( pattern, offset, stream );
+}
+
+
 void Soprano::Redland::RedlandModel::removeIterator( RedlandStatementIterator* it ) const
 {
     d->iterators.removeAll( it );
@@ -62,15 +62,23 @@ namespace Soprano {
 
             bool containsStatement( const Statement &statement ) const;
             bool containsAnyStatement( const Statement &statement ) const;
+            QBitArray containsStatements( const QList<Statement>& statements ) const;
 
             Soprano::QueryResultIterator executeQuery( const QString &query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
 
             Soprano::StatementIterator listStatements( const Statement &partial ) const;
+            Soprano::StatementIterator listStatements( const Statement &partial, int offset, int limit ) const;
 
             Error::ErrorCode removeStatement( const Statement &statement );
 
             Error::ErrorCode removeAllStatements( const Statement &statement );
 
+            /**
+             * Collects the matching statements from the same stream used for removal
+             * under one write lock, thus the result is exactly what has been removed.
+             */
+            QList<Statement> takeAllStatements( const Statement &statement );
+
             int statementCount() const;
 
             Node createBlankNode();
@@ -80,6 +88,12 @@ namespace Soprano {
             Private *d;
 
             void removeIterator( RedlandStatementIterator* it ) const;
+
+            /**
+             * Keep \p stream, which is positioned at the last statement of a page,
+             * to continue with the page of \p pattern starting at \p offset.
+             */
+            void parkStream( const Statement& pattern, int offset, librdf_stream* stream ) const;
             void removeIterator( NodeIteratorBackend* it ) const;
             void removeQueryResult( RedlandQueryResult* r ) const;
 
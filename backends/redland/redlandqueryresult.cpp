@@ -28,6 +28,7 @@
 #include "statementiterator.h"
 #include "redlandstatementiterator.h"
 #include "redlandmodel.h"
+#include "requestcontext.h"
 
 #include <redland.h>
 
@@ -111,9 +112,18 @@ void Soprano::Redland::RedlandQueryResult::close()
 
 bool Soprano::Redland::RedlandQueryResult::next()
 {
+    // The model stays locked while we iterate. Thus, check the running request
+    // for each row and release the lock once it is cancelled or its deadline passed.
+    const RequestContext context = RequestContext::current();
+
     if ( !d->result ) {
         return false;
     }
+    else if ( context.isCancelled() ) {
+        setError( context.cancelError() );
+        close();
+        return false;
+    }
     else if ( isBool() ) {
         return false;
     }
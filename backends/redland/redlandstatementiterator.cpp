@@ -31,11 +31,14 @@
 #include <QtCore/QDebug>
 
 
-Soprano::Redland::RedlandStatementIterator::RedlandStatementIterator( const RedlandModel* model, librdf_stream *s, const Node& forceContext )
+Soprano::Redland::RedlandStatementIterator::RedlandStatementIterator( const RedlandModel* model, librdf_stream *s, const Statement& pattern, int offset, int limit )
     : m_model( model ),
       m_stream( s ),
-      m_forceContext( forceContext ),
-      m_initialized( false )
+      m_pattern( pattern ),
+      m_offset( offset ),
+      m_limit( limit ),
+      m_initialized( false ),
+      m_remaining( limit )
 {
 }
 
@@ -58,14 +61,29 @@ bool Soprano::Redland::RedlandStatementIterator::next()
 
         m_initialized = true;
 
-        if ( librdf_stream_end( m_stream ) ) {
+        if ( m_remaining == 0 || librdf_stream_end( m_stream ) ) {
             close();
             return false;
         }
         else {
+            if ( m_remaining > 0 && --m_remaining == 0 ) {
+                // the last statement of the range, release the model's read lock right away
+                // and keep the stream for the next page
+                m_lastStatement = current();
+                if ( m_model ) {
+                    m_model->parkStream( m_pattern, m_offset + m_limit, m_stream );
+                    m_stream = 0;
+                }
+                close();
+            }
             return true;
         }
     }
+    else if ( m_remaining == 0 ) {
+        // closed after the last statement of the range
+        m_lastStatement = Statement();
+        return false;
+    }
     else {
         setError( "Invalid iterator" );
         return false;
@@ -75,6 +93,11 @@ bool Soprano::Redland::RedlandStatementIterator::next()
 
 Soprano::Statement Soprano::Redland::RedlandStatementIterator::current() const
 {
+    if ( !m_stream && m_lastStatement.isValid() ) {
+        clearError();
+        return m_lastStatement;
+    }
+
     if ( !m_stream || librdf_stream_end( m_stream ) ) {
         setError( "Invalid iterator" );
         return Statement();
@@ -93,8 +116,8 @@ Soprano::Statement Soprano::Redland::RedlandStatementIterator::current() const
     if ( librdf_node* context = static_cast<librdf_node*>( librdf_stream_get_context( m_stream ) ) ) {
         copy.setContext( m_model->world()->createNode( context ) );
     }
-    else if ( m_forceContext.isValid() ) {
-        copy.setContext( m_forceContext );
+    else if ( m_pattern.context().isValid() ) {
+        copy.setContext( m_pattern.context() );
     }
 
     return copy;
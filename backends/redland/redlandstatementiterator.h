@@ -27,6 +27,7 @@
 
 #include "iteratorbackend.h"
 #include "node.h"
+#include "statement.h"
 
 #include <QtCore/QSharedDataPointer>
 
@@ -41,10 +42,14 @@ namespace Soprano
         {
         public:
         /**
-         * param forceContext Since redland does not set a context if we list statements from one specific context
-         * we have to force it this way.
+         * param pattern The listed pattern. Since redland does not set a context if we list statements
+         * from one specific context we have to force the pattern's context.
+         * param offset The number of statements skipped in \p s.
+         * param limit The maximum number of statements to return, -1 for no limit. The iterator
+         * closes once the limit is reached which releases the model's read lock. The stream
+         * is then parked in the model for listing the next page.
          */
-        explicit RedlandStatementIterator( const RedlandModel* model, librdf_stream *s, const Node& forceContext = Node() );
+        RedlandStatementIterator( const RedlandModel* model, librdf_stream *s, const Statement& pattern = Statement(), int offset = 0, int limit = -1 );
 
         ~RedlandStatementIterator();
 
@@ -57,8 +62,14 @@ namespace Soprano
         private:
         const RedlandModel* m_model;
         librdf_stream* m_stream;
-        Node m_forceContext;
+        Statement m_pattern;
+        int m_offset;
+        int m_limit;
         bool m_initialized;
+        int m_remaining;
+
+        /// the last statement of the range, the stream is closed once it is reached
+        Statement m_lastStatement;
         };
 
     }
@@ -28,9 +28,33 @@
 #include <QtCore/QObject>
 #include <QtCore/QStringList>
 #include <QtCore/QDebug>
+#include <QtCore/QElapsedTimer>
 
 Q_GLOBAL_STATIC( Soprano::Redland::World, s_theWorld )
 
+namespace {
+    const int s_defaultNodeCacheSize = 10000;
+}
+
+
+/**
+ * Owns one reference to a librdf_uri, used as value in the node cache.
+ */
+class Soprano::Redland::World::UriRef
+{
+public:
+    UriRef( librdf_uri* uri_ )
+        : uri( uri_ ) {
+    }
+
+    ~UriRef() {
+        librdf_free_uri( uri );
+    }
+
+    librdf_uri* uri;
+};
+
+
 static QString redlandLogFacilityToString( int facility )
 {
     switch( facility ) {
@@ -126,6 +150,8 @@ int REDLAND_CALLBACK_STDCALL redlandLogHandler( void* user, librdf_log_message*
 
 
 Soprano::Redland::World::World()
+    : m_nodeCache( s_defaultNodeCacheSize ),
+      m_uriCache( s_defaultNodeCacheSize )
 {
     m_world = librdf_new_world();
     librdf_world_open( m_world );
@@ -134,6 +160,8 @@ Soprano::Redland::World::World()
 
 Soprano::Redland::World::~World()
 {
+    // the cached uris need to be freed before the world
+    m_uriCache.clear();
     librdf_free_world( m_world );
 }
 
@@ -149,18 +177,28 @@ librdf_node *Soprano::Redland::World::createNode( const Node& node )
     librdf_world *world = worldPtr();
 
     if ( node.isResource() ) {
-        return librdf_new_node_from_uri_string( world, (unsigned char *)node.uri().toEncoded().data() );
+        librdf_uri* uri = createUri( node );
+        if ( !uri ) {
+            return 0;
+        }
+        librdf_node* redlandNode = librdf_new_node_from_uri( world, uri );
+        librdf_free_uri( uri );
+        return redlandNode;
     }
     else if ( node.isBlank() ) {
         return librdf_new_node_from_blank_identifier( world, (unsigned char *) node.identifier().toUtf8().data() );
     }
     else if ( node.isLiteral() ) {
-        return librdf_new_node_from_typed_literal( world,
-                                                   (unsigned char *)node.literal().toString().toUtf8().data(),
-                                                   node.language().toUtf8().data(),
-                                                   !node.literal().isPlain()
-                                                   ? librdf_new_uri( world, (const unsigned char*)node.dataType().toEncoded().data() )
-                                                   : 0 );
+        // librdf_new_node_from_typed_literal copies the datatype uri
+        librdf_uri* datatype = node.literal().isPlain() ? 0 : createUri( Node( node.dataType() ) );
+        librdf_node* redlandNode = librdf_new_node_from_typed_literal( world,
+                                                                       (unsigned char *)node.literal().toString().toUtf8().data(),
+                                                                       node.language().toUtf8().data(),
+                                                                       datatype );
+        if ( datatype ) {
+            librdf_free_uri( datatype );
+        }
+        return redlandNode;
     }
 
     return 0;
@@ -181,11 +219,22 @@ librdf_statement *Soprano::Redland::World::createStatement( const Statement &sta
 
 // Hint: all strings in redland are Utf8, except for the literal language tags.
 
+namespace {
+    quint64 nsecsElapsed( const QElapsedTimer& timer )
+    {
+#if QT_VERSION >= 0x040800
+        return quint64( timer.nsecsElapsed() );
+#else
+        return quint64( timer.elapsed() ) * 1000000;
+#endif
+    }
+}
+
+
 Soprano::Node Soprano::Redland::World::createNode( librdf_node *node )
 {
     if ( librdf_node_is_resource( node ) ) {
-        librdf_uri *uri = librdf_node_get_uri( node );
-        return Soprano::Node( QUrl::fromEncoded( (const char *)librdf_uri_as_string(uri), QUrl::StrictMode ) );
+        return createResourceNode( librdf_node_get_uri( node ) );
     }
     else if ( librdf_node_is_blank( node ) ) {
         return Soprano::Node( QString::fromUtf8( (const char *)librdf_node_get_blank_identifier( node ) ) );
@@ -198,8 +247,7 @@ Soprano::Node Soprano::Redland::World::createNode( librdf_node *node )
         }
         else {
             return Soprano::Node( Soprano::LiteralValue::fromString( QString::fromUtf8( (const char *)librdf_node_get_literal_value( node ) ),
-                                                                     QUrl::fromEncoded( (const char *)librdf_uri_as_string( datatype ),
-                                                                                        QUrl::StrictMode ) ) );
+                                                                     createResourceNode( datatype ).uri() ) );
         }
     }
 
@@ -207,6 +255,62 @@ Soprano::Node Soprano::Redland::World::createNode( librdf_node *node )
 }
 
 
+Soprano::Node Soprano::Redland::World::createResourceNode( librdf_uri* uri )
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    size_t len = 0;
+    const char* str = (const char*)librdf_uri_as_counted_string( uri, &len );
+
+    QMutexLocker lock( &m_cacheMutex );
+
+    // no need to copy the string only for the lookup
+    if ( const Node* cached = m_nodeCache.object( QByteArray::fromRawData( str, int( len ) ) ) ) {
+        ++m_cacheStatistics.hits;
+        m_cacheStatistics.conversionTime += nsecsElapsed( timer );
+        return *cached;
+    }
+    ++m_cacheStatistics.misses;
+
+    // parse without blocking the other threads
+    lock.unlock();
+    const QByteArray encoded( str, int( len ) );
+    const Node resource( QUrl::fromEncoded( encoded, QUrl::StrictMode ) );
+    lock.relock();
+
+    if ( m_nodeCache.maxCost() > 0 ) {
+        m_nodeCache.insert( encoded, new Node( resource ) );
+    }
+    m_cacheStatistics.conversionTime += nsecsElapsed( timer );
+    return resource;
+}
+
+
+librdf_uri* Soprano::Redland::World::createUri( const Node& resource )
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QMutexLocker lock( &m_cacheMutex );
+
+    if ( UriRef* cached = m_uriCache.object( resource ) ) {
+        ++m_cacheStatistics.hits;
+        librdf_uri* uri = librdf_new_uri_from_uri( cached->uri );
+        m_cacheStatistics.conversionTime += nsecsElapsed( timer );
+        return uri;
+    }
+    ++m_cacheStatistics.misses;
+
+    librdf_uri* uri = librdf_new_uri( m_world, (const unsigned char*)resource.uri().toEncoded().data() );
+    if ( uri && m_uriCache.maxCost() > 0 ) {
+        m_uriCache.insert( resource, new UriRef( librdf_new_uri_from_uri( uri ) ) );
+    }
+    m_cacheStatistics.conversionTime += nsecsElapsed( timer );
+    return uri;
+}
+
+
 Soprano::Statement Soprano::Redland::World::createStatement( librdf_statement *st )
 {
     librdf_node *subject = librdf_statement_get_subject( st );
@@ -232,6 +336,35 @@ void Soprano::Redland::World::freeStatement( librdf_statement* statement )
 }
 
 
+void Soprano::Redland::World::setNodeCacheSize( int size )
+{
+    QMutexLocker lock( &m_cacheMutex );
+    m_nodeCache.setMaxCost( qMax( 0, size ) );
+    m_uriCache.setMaxCost( qMax( 0, size ) );
+}
+
+
+int Soprano::Redland::World::nodeCacheSize() const
+{
+    QMutexLocker lock( &m_cacheMutex );
+    return m_nodeCache.maxCost();
+}
+
+
+Soprano::Redland::World::NodeCacheStatistics Soprano::Redland::World::nodeCacheStatistics() const
+{
+    QMutexLocker lock( &m_cacheMutex );
+    return m_cacheStatistics;
+}
+
+
+void Soprano::Redland::World::resetNodeCacheStatistics()
+{
+    QMutexLocker lock( &m_cacheMutex );
+    m_cacheStatistics = NodeCacheStatistics();
+}
+
+
 Soprano::Redland::World* Soprano::Redland::World::theWorld()
 {
     return s_theWorld();
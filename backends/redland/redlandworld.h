@@ -26,13 +26,16 @@
 #include <redland.h>
 
 #include "error.h"
+#include "node.h"
 
 #include <QtCore/QStringList>
+#include <QtCore/QByteArray>
+#include <QtCore/QCache>
+#include <QtCore/QMutex>
 
 
 namespace Soprano {
 
-    class Node;
     class Statement;
 
     namespace Redland {
@@ -80,10 +83,72 @@ namespace Soprano {
              */
             void freeStatement( librdf_statement* statement );
 
+            /**
+             * Usage counters of the node conversion cache.
+             */
+            class NodeCacheStatistics
+            {
+            public:
+                NodeCacheStatistics()
+                    : hits( 0 ),
+                      misses( 0 ),
+                      conversionTime( 0 ) {
+                }
+
+                /// The fraction of conversions served by the cache, between 0 and 1.
+                double hitRate() const {
+                    return hits + misses ? double( hits ) / double( hits + misses ) : 0.0;
+                }
+
+                /// The average time of one resource conversion in nanoseconds.
+                double averageConversionTime() const {
+                    return hits + misses ? double( conversionTime ) / double( hits + misses ) : 0.0;
+                }
+
+                quint64 hits;
+                quint64 misses;
+
+                /// The total time spent converting resources, including cache lookups, in nanoseconds.
+                quint64 conversionTime;
+            };
+
+            /**
+             * Resource URIs are converted through a bounded cache which maps both
+             * the redland URI strings to Soprano nodes and the Soprano nodes to
+             * librdf_uri instances. Typically a few predicates, types, and datatypes
+             * make up most of the converted nodes.
+             *
+             * \param size The maximum number of URIs cached in each direction. 0
+             * disables the cache.
+             */
+            void setNodeCacheSize( int size );
+            int nodeCacheSize() const;
+
+            NodeCacheStatistics nodeCacheStatistics() const;
+            void resetNodeCacheStatistics();
+
             static Soprano::Redland::World* theWorld();
 
         private:
+            /**
+             * \return A resource node for \p uri, converted through the cache.
+             */
+            Soprano::Node createResourceNode( librdf_uri* uri );
+
+            /**
+             * \return A new reference to the librdf_uri for \p resource which has to be
+             * freed via librdf_free_uri, or 0 on error.
+             */
+            librdf_uri* createUri( const Node& resource );
+
+            class UriRef;
+
             librdf_world * m_world;
+
+            mutable QMutex m_cacheMutex;
+            QCache<QByteArray, Soprano::Node> m_nodeCache;
+            QCache<Soprano::Node, UriRef> m_uriCache;
+            NodeCacheStatistics m_cacheStatistics;
         };
     }
 }
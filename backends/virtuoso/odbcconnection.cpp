@@ -31,11 +31,47 @@
 
 #include <QtCore/QDebug>
 #include <QtCore/QThread>
+#include <QtCore/QVector>
+#include <QtCore/QMutexLocker>
+
+
+namespace {
+    /// the maximum number of prepared statements kept per connection
+    const int s_maxPreparedStatements = 32;
+}
+
+
+HSTMT Soprano::ODBC::ConnectionPrivate::takePreparedStatement( const QString& request )
+{
+    return m_preparedStatements.take( request );
+}
+
+
+void Soprano::ODBC::ConnectionPrivate::releasePreparedStatement( const QString& request, HSTMT hstmt )
+{
+    if ( m_preparedStatements.contains( request ) ||
+         m_preparedStatements.count() >= s_maxPreparedStatements ) {
+        SQLFreeHandle( SQL_HANDLE_STMT, hstmt );
+    }
+    else {
+        m_preparedStatements.insert( request, hstmt );
+    }
+}
+
+
+void Soprano::ODBC::ConnectionPrivate::clearPreparedStatements()
+{
+    for ( QHash<QString, HSTMT>::const_iterator it = m_preparedStatements.constBegin();
+          it != m_preparedStatements.constEnd(); ++it ) {
+        SQLFreeHandle( SQL_HANDLE_STMT, it.value() );
+    }
+    m_preparedStatements.clear();
+}
 
 
 Soprano::ODBC::Connection::Connection()
     : QObject(),
-      d( new ConnectionPrivate() )
+      d( new ConnectionPrivate( this ) )
 {
     qDebug() << Q_FUNC_INFO << QThread::currentThread();
 }
@@ -45,11 +81,22 @@ Soprano::ODBC::Connection::~Connection()
 {
     qDebug() << Q_FUNC_INFO << QThread::currentThread();
 
-    d->m_pool->m_connectionMutex.lock();
-    d->m_pool->m_openConnections.remove( d->m_pool->m_openConnections.key( this ) );
-    d->m_pool->m_connectionMutex.unlock();
+    if ( d->m_pool ) {
+        QMutexLocker lock( &d->m_pool->m_connectionMutex );
+        d->m_pool->m_connections.removeAll( this );
+        d->m_pool->m_idleConnections.removeAll( this );
+        if ( d->m_thread ) {
+            d->m_pool->m_usedConnections.remove( d->m_thread );
+        }
+        // the slot of this connection is free again
+        d->m_pool->m_connectionReleased.wakeOne();
+    }
 
-    qDeleteAll( d->m_openResults );
+    // the results remove themselves from the list, thus we cannot iterate it directly
+    d->m_pool = 0;
+    const QList<QueryResult*> results = d->m_openResults;
+    qDeleteAll( results );
+    d->clearPreparedStatements();
 
     if ( d->m_hdbc ) {
         SQLDisconnect( d->m_hdbc );
@@ -61,12 +108,6 @@ Soprano::ODBC::Connection::~Connection()
 }
 
 
-void Soprano::ODBC::Connection::cleanup()
-{
-    delete this;
-}
-
-
 Soprano::Error::ErrorCode Soprano::ODBC::Connection::executeCommand( const QString& command, const QList<Soprano::Node>& params )
 {
 //    qDebug() << Q_FUNC_INFO << command;
@@ -82,6 +123,18 @@ Soprano::Error::ErrorCode Soprano::ODBC::Connection::executeCommand( const QStri
 }
 
 
+Soprano::Error::ErrorCode Soprano::ODBC::Connection::executeCommand( const QString& command, const QByteArray& text )
+{
+    HSTMT hstmt = execute( command, QList<Soprano::Node>(), false, text );
+    if ( hstmt ) {
+        SQLCloseCursor( hstmt );
+        SQLFreeHandle( SQL_HANDLE_STMT, hstmt );
+        return Error::ErrorNone;
+    }
+    return Error::convertErrorCode( lastError().code() );
+}
+
+
 Soprano::ODBC::QueryResult* Soprano::ODBC::Connection::executeQuery( const QString& request )
 {
 //    qDebug() << Q_FUNC_INFO << request;
@@ -91,7 +144,30 @@ Soprano::ODBC::QueryResult* Soprano::ODBC::Connection::executeQuery( const QStri
         QueryResult* result = new QueryResult();
         result->d->m_conn = d;
         result->d->m_hstmt = hstmt;
-        d->m_openResults.append( result );
+        if ( d->m_pool )
+            d->m_pool->addResult( d, result );
+        else
+            d->m_openResults.append( result );
+        return result;
+    }
+    else {
+        return 0;
+    }
+}
+
+
+Soprano::ODBC::QueryResult* Soprano::ODBC::Connection::executePreparedQuery( const QString& request, const QList<Soprano::Node>& params )
+{
+    HSTMT hstmt = execute( request, params, true );
+    if ( hstmt ) {
+        QueryResult* result = new QueryResult();
+        result->d->m_conn = d;
+        result->d->m_hstmt = hstmt;
+        result->d->m_preparedRequest = request;
+        if ( d->m_pool )
+            d->m_pool->addResult( d, result );
+        else
+            d->m_openResults.append( result );
         return result;
     }
     else {
@@ -100,25 +176,37 @@ Soprano::ODBC::QueryResult* Soprano::ODBC::Connection::executeQuery( const QStri
 }
 
 
-HSTMT Soprano::ODBC::Connection::execute( const QString& request, const QList<Soprano::Node>& params )
+HSTMT Soprano::ODBC::Connection::execute( const QString& request, const QList<Soprano::Node>& params, bool prepare,
+                                          const QByteArray& text )
 {
-    HSTMT hstmt;
-    if ( SQLAllocHandle( SQL_HANDLE_STMT, d->m_hdbc, &hstmt ) != SQL_SUCCESS ) {
+    HSTMT hstmt = 0;
+    if ( prepare )
+        hstmt = d->takePreparedStatement( request );
+
+    const bool prepared = ( hstmt != 0 );
+    if ( !prepared && SQLAllocHandle( SQL_HANDLE_STMT, d->m_hdbc, &hstmt ) != SQL_SUCCESS ) {
         setError( Virtuoso::convertSqlError( SQL_HANDLE_DBC, d->m_hdbc ) );
         return 0;
     }
     else {
+        QByteArray utf8Request = request.toUtf8();
+        if ( prepare && !prepared &&
+             !SQL_SUCCEEDED( SQLPrepare( hstmt, ( UCHAR* )utf8Request.data(), utf8Request.length() ) ) ) {
+            setError( Virtuoso::convertSqlError( SQL_HANDLE_STMT, hstmt, QLatin1String( "SQLPrepare failed on query '" ) + request + '\'' ) );
+            SQLFreeHandle( SQL_HANDLE_STMT, hstmt );
+            return 0;
+        }
+
         // counter for the parameter index
         int i = 1;
         // counter for the node index
         int ni = 0;
 
         // each parameter requires its own variable which can be referenced by a pointer
-        // since we never use more than 4 nodes for now (we only use parameters for adding statements)
-        // we can stick to a fixed number of variables
-        SQLSMALLINT mode[4];
-        QVector<QByteArray> values(4);
-        QVector<QByteArray> dtOrLangs(4);
+        // until the statement has been executed
+        QVector<SQLSMALLINT> mode( params.count() );
+        QVector<QByteArray> values( params.count() );
+        QVector<QByteArray> dtOrLangs( params.count() );
 
         // the type vars can be shared as they do not change
         SQLLEN cbInt = 0;
@@ -154,9 +242,38 @@ HSTMT Soprano::ODBC::Connection::execute( const QString& request, const QList<So
 
             ++ni;
         }
-        QByteArray utf8Request = request.toUtf8();
-        if ( !SQL_SUCCEEDED( SQLExecDirect( hstmt, ( UCHAR* )utf8Request.data(), utf8Request.length() ) ) ) {
-            setError( Virtuoso::convertSqlError( SQL_HANDLE_STMT, hstmt, QLatin1String( "SQLExecDirect failed on query '" ) + request + '\'' ) );
+
+        SQLLEN cbText = text.length();
+        if ( !text.isNull() ) {
+            SQLBindParameter( hstmt, i++, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_LONGVARCHAR, text.length(), 0, ( SQLPOINTER )text.constData(), 0, &cbText );
+        }
+
+        // honour the deadline of the running request
+        const RequestContext context = RequestContext::current();
+        if ( context.isCancelled() ) {
+            setError( context.cancelError() );
+            SQLFreeHandle( SQL_HANDLE_STMT, hstmt );
+            return 0;
+        }
+        const int remaining = context.remainingTime();
+        if ( remaining > 0 ) {
+            // the query timeout has a granularity of seconds
+            SQLSetStmtAttr( hstmt, SQL_ATTR_QUERY_TIMEOUT, ( SQLPOINTER )( SQLULEN )( ( remaining + 999 ) / 1000 ), SQL_IS_UINTEGER );
+        }
+
+        SQLRETURN r = 0;
+        {
+            StatementCanceller canceller( context, hstmt );
+            if ( prepare )
+                r = SQLExecute( hstmt );
+            else
+                r = SQLExecDirect( hstmt, ( UCHAR* )utf8Request.data(), utf8Request.length() );
+        }
+        if ( !SQL_SUCCEEDED( r ) ) {
+            if ( context.isCancelled() )
+                setError( context.cancelError() );
+            else
+                setError( Virtuoso::convertSqlError( SQL_HANDLE_STMT, hstmt, QLatin1String( "SQLExecDirect failed on query '" ) + request + '\'' ) );
             SQLFreeHandle( SQL_HANDLE_STMT, hstmt );
             return 0;
         }
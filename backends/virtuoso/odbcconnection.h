@@ -49,15 +49,31 @@ namespace Soprano {
             ~Connection();
 
             Error::ErrorCode executeCommand( const QString& command, const QList<Soprano::Node>& params = QList<Soprano::Node>() );
+
+            /**
+             * Execute \p command with \p text bound to its only parameter as a
+             * character string. This allows to hand large documents to server-side
+             * procedures without escaping them.
+             */
+            Error::ErrorCode executeCommand( const QString& command, const QByteArray& text );
             QueryResult* executeQuery( const QString& request );
 
-        public Q_SLOTS:
-            void cleanup();
+            /**
+             * Execute \p request with the nodes in \p params bound to its parameter
+             * triples. The statement is prepared once per connection and reused for
+             * subsequent calls with the same request.
+             */
+            QueryResult* executePreparedQuery( const QString& request, const QList<Soprano::Node>& params );
 
         private:
             Connection();
 
-            HSTMT execute( const QString& query, const QList<Soprano::Node>& params = QList<Soprano::Node>() );
+            /**
+             * \param text If not null it is bound as a character string after the parameters
+             * created for \p params.
+             */
+            HSTMT execute( const QString& query, const QList<Soprano::Node>& params = QList<Soprano::Node>(), bool prepare = false,
+                           const QByteArray& text = QByteArray() );
 
             ConnectionPrivate* const d;
 
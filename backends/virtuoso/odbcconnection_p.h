@@ -24,27 +24,87 @@
 
 #include <sql.h>
 
+#include "requestcontext.h"
+
 #include <QtCore/QList>
+#include <QtCore/QHash>
 #include <QtCore/QUrl>
 
+class QThread;
+
 namespace Soprano {
     namespace ODBC {
 
+        class Connection;
         class ConnectionPoolPrivate;
         class Environment;
 
         class ConnectionPrivate
         {
         public:
-            ConnectionPrivate()
+            ConnectionPrivate( Connection* conn )
                 : m_env( 0 ),
-                  m_hdbc( SQL_NULL_HANDLE ) {
+                  m_hdbc( SQL_NULL_HANDLE ),
+                  m_pool( 0 ),
+                  m_useCount( 0 ),
+                  m_thread( 0 ),
+                  q( conn ) {
             }
 
+            /**
+             * Take a prepared statement for \p request out of the cache.
+             * \return The statement or 0 if none has been cached.
+             */
+            HSTMT takePreparedStatement( const QString& request );
+
+            /**
+             * Put a prepared statement back into the cache once its result
+             * has been closed. The statement is freed if the cache is full.
+             */
+            void releasePreparedStatement( const QString& request, HSTMT hstmt );
+
+            void clearPreparedStatements();
+
             Environment* m_env;
             HDBC m_hdbc;
             ConnectionPoolPrivate* m_pool;
             QList<QueryResult*> m_openResults;
+
+            /// the number of operations using the connection, protected by the pool mutex
+            int m_useCount;
+
+            /// the thread the connection is bound to while in use, protected by the pool mutex
+            QThread* m_thread;
+
+            Connection* q;
+
+            /// statements prepared via SQLPrepare which are currently not in use
+            QHash<QString, HSTMT> m_preparedStatements;
+        };
+
+        /**
+         * Aborts a statement via SQLCancel once the running request is
+         * cancelled. ODBC allows to call SQLCancel from another thread.
+         */
+        class StatementCanceller : public RequestContext::CancelHandler
+        {
+        public:
+            StatementCanceller( const RequestContext& context, HSTMT hstmt )
+                : m_context( context ),
+                  m_hstmt( hstmt ) {
+                m_context.addCancelHandler( this );
+            }
+            ~StatementCanceller() {
+                m_context.removeCancelHandler( this );
+            }
+
+            void cancel() {
+                SQLCancel( m_hstmt );
+            }
+
+        private:
+            RequestContext m_context;
+            HSTMT m_hstmt;
         };
     }
 }
@@ -30,8 +30,16 @@
 #include <QtCore/QDebug>
 #include <QtCore/QThread>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QTime>
 
 #include <sql.h>
+#include <sqlext.h>
+
+
+namespace {
+    /// the time acquireConnection() waits for a connection to be released
+    const int s_connectionWaitTimeout = 30000;
+}
 
 
 Soprano::ODBC::Connection* Soprano::ODBC::ConnectionPoolPrivate::createConnection()
@@ -80,7 +88,6 @@ Soprano::ODBC::Connection* Soprano::ODBC::ConnectionPoolPrivate::createConnectio
     Connection* conn = new Connection();
     conn->d->m_env = env;
     conn->d->m_hdbc = hdbc;
-    conn->d->m_pool = this;
 
     // run the setup commands
     Q_FOREACH( const QString& command, m_connectionSetupCommands ) {
@@ -91,58 +98,182 @@ Soprano::ODBC::Connection* Soprano::ODBC::ConnectionPoolPrivate::createConnectio
         }
     }
 
+    // only now the connection is known to the pool
+    conn->d->m_pool = this;
+
     return conn;
 }
 
 
+bool Soprano::ODBC::ConnectionPoolPrivate::isAlive( Connection* conn ) const
+{
+    // the driver answers this from its local state, no round trip to the server
+    SQLUINTEGER dead = SQL_CD_FALSE;
+    if ( SQLGetConnectAttr( conn->d->m_hdbc, SQL_ATTR_CONNECTION_DEAD, &dead, 0, 0 ) == SQL_SUCCESS ) {
+        return dead != SQL_CD_TRUE;
+    }
+    return true;
+}
+
+
+void Soprano::ODBC::ConnectionPoolPrivate::addResult( ConnectionPrivate* conn, QueryResult* result )
+{
+    QMutexLocker lock( &m_connectionMutex );
+    conn->m_openResults.append( result );
+}
+
+
+void Soprano::ODBC::ConnectionPoolPrivate::removeResult( ConnectionPrivate* conn, QueryResult* result )
+{
+    QMutexLocker lock( &m_connectionMutex );
+    conn->m_openResults.removeAll( result );
+    checkIn( conn );
+}
+
+
+int Soprano::ODBC::ConnectionPoolPrivate::activeConnectionCount() const
+{
+    int cnt = 0;
+    for ( QHash<QThread*, Connection*>::const_iterator it = m_usedConnections.constBegin();
+          it != m_usedConnections.constEnd(); ++it ) {
+        if ( it.value()->d->m_useCount > 0 )
+            ++cnt;
+    }
+    return cnt;
+}
+
+
+void Soprano::ODBC::ConnectionPoolPrivate::checkIn( ConnectionPrivate* conn )
+{
+    if ( conn->m_useCount == 0 &&
+         conn->m_openResults.isEmpty() &&
+         conn->m_thread ) {
+        m_usedConnections.remove( conn->m_thread );
+        conn->m_thread = 0;
+        m_idleConnections.append( conn->q );
+        m_connectionReleased.wakeOne();
+    }
+}
+
+
 
 Soprano::ODBC::ConnectionPool::ConnectionPool( const QString& odbcConnectString,
                                                const QStringList& connectionSetupCommands,
+                                               int maxConnections,
                                                QObject* parent )
     : QObject( parent ),
       d( new ConnectionPoolPrivate() )
 {
-    qDebug() << Q_FUNC_INFO << odbcConnectString;
+    qDebug() << Q_FUNC_INFO << odbcConnectString << maxConnections;
     d->m_odbcConnectString = odbcConnectString;
     d->m_connectionSetupCommands = connectionSetupCommands;
+    d->m_maxConnections = qMax( 1, maxConnections );
 }
 
 
 Soprano::ODBC::ConnectionPool::~ConnectionPool()
 {
-    // cannot use qDeleteAll since Connection's destructor will change m_openConnections
-    while( !d->m_openConnections.isEmpty() )
-        delete d->m_openConnections.begin().value();
+    // cannot use qDeleteAll since Connection's destructor will change m_connections
+    while( !d->m_connections.isEmpty() )
+        delete d->m_connections.first();
     delete d;
 }
 
 
-Soprano::ODBC::Connection* Soprano::ODBC::ConnectionPool::connection()
+int Soprano::ODBC::ConnectionPool::maxConnections() const
 {
-//    qDebug() << Q_FUNC_INFO << QThread::currentThread();
+    return d->m_maxConnections;
+}
+
+
+Soprano::ODBC::Connection* Soprano::ODBC::ConnectionPool::acquireConnection()
+{
+    QThread* thread = QThread::currentThread();
 
     QMutexLocker lock( &d->m_connectionMutex );
 
-    QHash<QThread*, Connection*>::iterator it = d->m_openConnections.find( QThread::currentThread() );
-    if ( it != d->m_openConnections.end() ) {
-//        qDebug() << Q_FUNC_INFO << "recycling" << *it;
-        return *it;
+    // nested operations and open results of this thread keep their connection
+    QHash<QThread*, Connection*>::const_iterator it = d->m_usedConnections.constFind( thread );
+    if ( it != d->m_usedConnections.constEnd() ) {
+        ++it.value()->d->m_useCount;
+        clearError();
+        return it.value();
     }
 
-    Connection* conn = d->createConnection();
-    if(conn) {
-        d->m_openConnections.insert( QThread::currentThread(), conn );
-        // using the cleanup slot rather than deleteLater to not depend on any event loop
-        connect( QThread::currentThread(), SIGNAL(finished()),
-                 conn, SLOT(cleanup()),
-                 Qt::DirectConnection );
-        connect( QThread::currentThread(), SIGNAL(terminated()),
-                 conn, SLOT(cleanup()),
-                 Qt::DirectConnection );
-        connect( QThread::currentThread(), SIGNAL(destroyed()),
-                 conn, SLOT(cleanup()),
-                 Qt::DirectConnection );
+    QTime waitTime;
+    waitTime.start();
+
+    Q_FOREVER {
+        while ( !d->m_idleConnections.isEmpty() ) {
+            Connection* conn = d->m_idleConnections.takeLast();
+            if ( d->isAlive( conn ) ) {
+                conn->d->m_useCount = 1;
+                conn->d->m_thread = thread;
+                d->m_usedConnections.insert( thread, conn );
+                clearError();
+                return conn;
+            }
+            else {
+                qDebug() << Q_FUNC_INFO << "Dropping dead connection" << conn;
+                lock.unlock();
+                delete conn;
+                lock.relock();
+            }
+        }
+
+        if ( d->activeConnectionCount() + d->m_pendingConnections < d->m_maxConnections ) {
+            // open a new connection without blocking the other threads
+            ++d->m_pendingConnections;
+            lock.unlock();
+            Connection* conn = d->createConnection();
+            const Error::Error error = d->lastError();
+            lock.relock();
+            --d->m_pendingConnections;
+
+            if ( !conn ) {
+                // another thread may be waiting for the slot
+                d->m_connectionReleased.wakeOne();
+                setError( error );
+                return 0;
+            }
+
+            conn->d->m_useCount = 1;
+            conn->d->m_thread = thread;
+            d->m_connections.append( conn );
+            d->m_usedConnections.insert( thread, conn );
+            clearError();
+            return conn;
+        }
+
+        const int remaining = s_connectionWaitTimeout - waitTime.elapsed();
+        if ( remaining <= 0 ||
+             !d->m_connectionReleased.wait( &d->m_connectionMutex, remaining ) ) {
+            setError( QString::fromLatin1( "Timeout while waiting for one of %1 Virtuoso connections to become available." )
+                      .arg( d->m_maxConnections ),
+                      Error::ErrorTimeout );
+            return 0;
+        }
     }
-    return conn;
 }
 
+
+void Soprano::ODBC::ConnectionPool::releaseConnection( Connection* conn )
+{
+    QMutexLocker lock( &d->m_connectionMutex );
+    if ( conn->d->m_useCount > 0 ) {
+        --conn->d->m_useCount;
+        d->checkIn( conn->d );
+        // even if kept by open results the connection does not count against the limit anymore
+        if ( conn->d->m_useCount == 0 )
+            d->m_connectionReleased.wakeOne();
+    }
+
+    // shrink back to the limit once the connections opened beyond it are idle again
+    while ( d->m_connections.count() > d->m_maxConnections &&
+            !d->m_idleConnections.isEmpty() ) {
+        Connection* idle = d->m_idleConnections.takeFirst();
+        lock.unlock();
+        delete idle;
+        lock.relock();
+    }
+}
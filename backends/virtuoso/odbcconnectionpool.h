@@ -34,24 +34,85 @@ namespace Soprano {
         class Connection;
         class ConnectionPoolPrivate;
 
+        /**
+         * A bounded pool of ODBC connections which are shared between threads.
+         *
+         * A connection is checked out for the duration of one operation (see
+         * PooledConnection) and stays in use as long as query results created
+         * through it are open. While in use, the connection is bound to the thread
+         * which checked it out, thus nested operations of the same thread reuse it.
+         * Once released, the connection is available to all threads.
+         *
+         * The connection limit only applies to connections running an operation.
+         * Connections kept by open query results do not count against it, thus
+         * clients keeping many iterators open cannot starve the other threads. The
+         * pool shrinks back to the limit once the additional connections are released.
+         */
         class ConnectionPool : public QObject, public Soprano::Error::ErrorCache
         {
             Q_OBJECT
 
         public:
+            /**
+             * \param maxConnections The maximum number of connections running an operation
+             * at the same time. If all are busy acquireConnection() waits for one to be released.
+             */
             ConnectionPool( const QString& odbcConnectString,
                             const QStringList& connectionSetupCommands,
+                            int maxConnections,
                             QObject* parent = 0 );
             ~ConnectionPool();
 
             /**
-             * Get the connection for the current thread.
+             * Check out a connection for the current thread. Idle connections are
+             * checked for being alive before reuse. If the maximum number of connections
+             * is busy running an operation the method blocks until one is released or a
+             * timeout occurs.
+             *
+             * \return The connection or 0 on error. Each connection returned has to be
+             * given back via releaseConnection().
+             */
+            Connection* acquireConnection();
+
+            /**
+             * Give back a connection acquired via acquireConnection().
              */
-            Connection* connection();
+            void releaseConnection( Connection* conn );
+
+            int maxConnections() const;
 
         private:
             ConnectionPoolPrivate* const d;
         };
+
+        /**
+         * Acquires a connection from the pool for the lifetime of the object.
+         */
+        class PooledConnection
+        {
+        public:
+            PooledConnection( ConnectionPool* pool )
+                : m_pool( pool ),
+                  m_connection( pool->acquireConnection() ) {
+            }
+
+            ~PooledConnection() {
+                if ( m_connection )
+                    m_pool->releaseConnection( m_connection );
+            }
+
+            /**
+             * \return The connection or 0 if none could be acquired. Check the
+             * pool's lastError() for details.
+             */
+            Connection* connection() const { return m_connection; }
+
+        private:
+            ConnectionPool* m_pool;
+            Connection* m_connection;
+
+            Q_DISABLE_COPY( PooledConnection )
+        };
     }
 }
 
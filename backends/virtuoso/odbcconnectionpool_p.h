@@ -25,7 +25,9 @@
 #include "error.h"
 
 #include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
 #include <QtCore/QStringList>
 
 class QThread;
@@ -34,19 +36,63 @@ namespace Soprano {
     namespace ODBC {
 
         class Connection;
+        class ConnectionPrivate;
         class EnvironmentPrivate;
+        class QueryResult;
 
         class ConnectionPoolPrivate : public Error::ErrorCache
         {
         public:
+            ConnectionPoolPrivate()
+                : m_maxConnections( 1 ),
+                  m_pendingConnections( 0 ) {
+            }
+
             QString m_odbcConnectString;
             QStringList m_connectionSetupCommands;
+            int m_maxConnections;
+
+            /// all open connections, idle or in use
+            QList<Connection*> m_connections;
+
+            /// the connections not in use, the most recently used last
+            QList<Connection*> m_idleConnections;
+
+            /// the connections in use, by the thread which acquired them
+            QHash<QThread*, Connection*> m_usedConnections;
 
-            QHash<QThread*, Connection*> m_openConnections;
+            /// the number of connections currently being opened
+            int m_pendingConnections;
 
             Connection* createConnection();
 
+            /**
+             * Check if the idle connection \p conn is still usable.
+             */
+            bool isAlive( Connection* conn ) const;
+
+            /**
+             * Called by Connection and QueryResult to track the results which
+             * keep a connection in use.
+             */
+            void addResult( ConnectionPrivate* conn, QueryResult* result );
+            void removeResult( ConnectionPrivate* conn, QueryResult* result );
+
+            /**
+             * The number of connections currently running an operation. Connections
+             * which are only kept by open query results are not counted.
+             * Has to be called with m_connectionMutex locked.
+             */
+            int activeConnectionCount() const;
+
+            /**
+             * Makes \p conn available to all threads if it is not used anymore.
+             * Has to be called with m_connectionMutex locked.
+             */
+            void checkIn( ConnectionPrivate* conn );
+
             QMutex m_connectionMutex;
+            QWaitCondition m_connectionReleased;
 
             friend class Connection;
         };
@@ -22,6 +22,7 @@
 #include "odbcqueryresult.h"
 #include "odbcqueryresult_p.h"
 #include "odbcconnection_p.h"
+#include "odbcconnectionpool_p.h"
 #include "virtuosoodbcext.h"
 #include "virtuosotools.h"
 
@@ -45,9 +46,20 @@ Soprano::ODBC::QueryResult::QueryResult()
 
 Soprano::ODBC::QueryResult::~QueryResult()
 {
-    d->m_conn->m_openResults.removeAll( this );
     SQLCloseCursor( d->m_hstmt );
-    SQLFreeHandle( SQL_HANDLE_STMT, d->m_hstmt );
+    if ( d->m_preparedRequest.isEmpty() ) {
+        SQLFreeHandle( SQL_HANDLE_STMT, d->m_hstmt );
+    }
+    else {
+        SQLFreeStmt( d->m_hstmt, SQL_RESET_PARAMS );
+        d->m_conn->releasePreparedStatement( d->m_preparedRequest, d->m_hstmt );
+    }
+
+    // this may make the connection available to other threads
+    if ( d->m_conn->m_pool )
+        d->m_conn->m_pool->removeResult( d->m_conn, this );
+    else
+        d->m_conn->m_openResults.removeAll( this );
     delete d;
 }
 
@@ -93,13 +105,26 @@ QStringList Soprano::ODBC::QueryResult::resultColumns()
 
 bool Soprano::ODBC::QueryResult::fetchRow()
 {
-    int sts = SQLFetch( d->m_hstmt );
+    const RequestContext context = RequestContext::current();
+    if ( context.isCancelled() ) {
+        setError( context.cancelError() );
+        return false;
+    }
+
+    int sts = 0;
+    {
+        StatementCanceller canceller( context, d->m_hstmt );
+        sts = SQLFetch( d->m_hstmt );
+    }
     if ( sts == SQL_NO_DATA_FOUND ) {
         clearError();
         return false;
     }
     else if( sts != SQL_SUCCESS ) {
-        setError( Virtuoso::convertSqlError( SQL_HANDLE_STMT, d->m_hstmt, QLatin1String( "SQLFetch failed" ) ) );
+        if ( context.isCancelled() )
+            setError( context.cancelError() );
+        else
+            setError( Virtuoso::convertSqlError( SQL_HANDLE_STMT, d->m_hstmt, QLatin1String( "SQLFetch failed" ) ) );
         return false;
     }
     else {
@@ -44,6 +44,9 @@ namespace Soprano {
             HSTMT m_hstmt;
             ConnectionPrivate* m_conn;
 
+            /// the request of a prepared statement which is returned to the connection
+            QString m_preparedRequest;
+
             QStringList m_columns;
             QList<SQLSMALLINT> m_columTypes;
         };
@@ -85,6 +85,10 @@ Soprano::StorageModel* Soprano::Virtuoso::BackendPlugin::createModel( const Back
     bool disableStatementSignals = valueInSettings( settings, QLatin1String( "noStatementSignals" ), false ).toBool();
     bool enableFakeBookleans = valueInSettings( settings, QLatin1String( "fakeBooleans" ), true ).toBool();
     bool enableEmptyGraphs = valueInSettings( settings, QLatin1String( "emptyGraphs" ), true ).toBool();
+    int maxConnections = valueInSettings( settings, QLatin1String( "maxConnections" ), 10 ).toInt();
+    int bulkLoadConnections = valueInSettings( settings, QLatin1String( "bulkLoadConnections" ), 4 ).toInt();
+    bool deferFulltextIndex = valueInSettings( settings, QLatin1String( "deferFulltextIndex" ), false ).toBool();
+    bool syncFulltextIndex = valueInSettings( settings, QLatin1String( "fulltextindex" ) ).toString().toLower() == QLatin1String( "sync" );
 
     VirtuosoController* controller = 0;
     QString virtuosoVersion = QLatin1String("1.0.0"); // a default low version in case we connect to a running server
@@ -140,16 +144,21 @@ Soprano::StorageModel* Soprano::Virtuoso::BackendPlugin::createModel( const Back
         connectionSetupCommands << QString::fromLatin1( "set result_timeout=%1" ).arg( queryTimeout );
     }
 
-    ODBC::ConnectionPool* connectionPool = new ODBC::ConnectionPool( connectString, connectionSetupCommands );
+    ODBC::ConnectionPool* connectionPool = new ODBC::ConnectionPool( connectString, connectionSetupCommands, maxConnections );
 
     // FIXME: should configuration only be allowed on spawned servers?
-    if ( ODBC::Connection* conn = connectionPool->connection() ) {
-        DatabaseConfigurator configurator( conn );
-        configurator.configureServer( settings );
-        delete conn;
+    bool connected = false;
+    {
+        ODBC::PooledConnection pooledConnection( connectionPool );
+        if ( ODBC::Connection* conn = pooledConnection.connection() ) {
+            DatabaseConfigurator configurator( conn );
+            configurator.configureServer( settings );
+            connected = true;
+        }
     }
-    else {
+    if ( !connected ) {
         qDebug() << Q_FUNC_INFO << "Failed to connect to" << connectString;
+        setError( connectionPool->lastError() );
         delete connectionPool;
         return 0;
     }
@@ -157,6 +166,9 @@ Soprano::StorageModel* Soprano::Virtuoso::BackendPlugin::createModel( const Back
     VirtuosoModel* model = new VirtuosoModel( virtuosoVersion, connectionPool,
                                               enableFakeBookleans, enableEmptyGraphs, this );
     model->d->m_noStatementSignals = disableStatementSignals;
+    model->d->m_bulkLoadConnections = bulkLoadConnections;
+    model->d->m_deferFulltextIndex = deferFulltextIndex;
+    model->d->m_syncFulltextIndex = syncFulltextIndex;
     // mem mangement the ugly way
     // FIXME: improve
     if ( controller ) {
@@ -23,6 +23,7 @@
 #include "virtuosomodel_p.h"
 #include "virtuosoqueryresultiteratorbackend.h"
 #include "virtuosoqueryresultiteratorbackend_p.h"
+#include "virtuosopreparedquerybackend.h"
 #include "virtuosobackend.h"
 #include "soprano.h"
 #include "odbcenvironment.h"
@@ -32,6 +33,11 @@
 
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/QStringList>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
 
 #include <stdlib.h>
 
@@ -47,6 +53,122 @@ namespace {
         }
     }
 
+    /**
+     * The solution modifiers used for the paged listStatements() and listContexts().
+     * Without an explicit order Virtuoso does not guarantee the same order for
+     * consecutive queries, thus pages are sorted by \p orderBy.
+     */
+    QString pagingModifier( int offset, int limit, const QString& orderBy ) {
+        QString modifier;
+        if ( ( limit >= 0 || offset > 0 ) && !orderBy.isEmpty() )
+            modifier += QLatin1String( " ORDER BY " ) + orderBy;
+        if ( limit >= 0 )
+            modifier += QString::fromLatin1( " LIMIT %1" ).arg( limit );
+        if ( offset > 0 )
+            modifier += QString::fromLatin1( " OFFSET %1" ).arg( offset );
+        return modifier;
+    }
+
+    /// the maximum number of matches estimateCount() counts
+    const int s_estimateLimit = 1000;
+
+    /// the number of statements checked with one query in containsStatements()
+    const int s_containsChunkSize = 100;
+
+    /// lists with fewer statements are added one by one
+    const int s_bulkLoadThreshold = 100;
+
+    /// the number of statements handed to one DB.DBA.TTLP_MT call
+    const int s_bulkLoadChunkSize = 10000;
+
+    /// TTLP flag for N-Quads input
+    const int s_ttlpNQuads = 512;
+
+    /**
+     * The state shared between the jobs of one bulk load.
+     */
+    class BulkLoadState
+    {
+    public:
+        enum ChunkState {
+            ChunkSkipped,
+            ChunkLoaded,
+            /// TTLP_MT commits row by row, a failed chunk may have been loaded partially
+            ChunkFailed
+        };
+
+        BulkLoadState( int maxPendingChunks, int chunkCount )
+            : pendingChunks( maxPendingChunks ),
+              chunks( chunkCount, ChunkSkipped ) {
+        }
+
+        void setError( int chunk, const Soprano::Error::Error& e ) {
+            QMutexLocker lock( &mutex );
+            chunks[chunk] = ChunkFailed;
+            if ( !error )
+                error = e;
+        }
+
+        void setLoaded( int chunk ) {
+            QMutexLocker lock( &mutex );
+            chunks[chunk] = ChunkLoaded;
+        }
+
+        bool failed() {
+            QMutexLocker lock( &mutex );
+            return error.code() != Soprano::Error::ErrorNone;
+        }
+
+        /// limits the number of serialized chunks kept in memory
+        QSemaphore pendingChunks;
+
+        QMutex mutex;
+        Soprano::Error::Error error;
+        QVector<ChunkState> chunks;
+    };
+
+    /**
+     * Loads one chunk of N-Quads through its own connection.
+     */
+    class BulkLoadJob : public QRunnable
+    {
+    public:
+        BulkLoadJob( Soprano::ODBC::ConnectionPool* pool, int chunk, const QByteArray& nquads, BulkLoadState* state )
+            : m_pool( pool ),
+              m_chunk( chunk ),
+              m_nquads( nquads ),
+              m_state( state ) {
+        }
+
+        void run() {
+            if ( !m_state->failed() ) {
+                Soprano::ODBC::PooledConnection pooledConnection( m_pool );
+                if ( Soprano::ODBC::Connection* conn = pooledConnection.connection() ) {
+                    // log_mode 3: row-by-row autocommit with transaction logging
+                    const QString command = QString::fromLatin1( "DB.DBA.TTLP_MT (?, '', '%1', %2, 3)" )
+                                            .arg( QLatin1String( Soprano::Virtuoso::defaultGraphString() ) )
+                                            .arg( s_ttlpNQuads );
+                    if ( conn->executeCommand( command, m_nquads ) != Soprano::Error::ErrorNone ) {
+                        m_state->setError( m_chunk, conn->lastError() );
+                    }
+                    else {
+                        m_state->setLoaded( m_chunk );
+                    }
+                }
+                else {
+                    m_state->setError( m_chunk, m_pool->lastError() );
+                }
+            }
+            m_state->pendingChunks.release();
+        }
+
+    private:
+        Soprano::ODBC::ConnectionPool* m_pool;
+        int m_chunk;
+        QByteArray m_nquads;
+        BulkLoadState* m_state;
+    };
+
     // there is still a bug in Virtuoso which makes the define prefix unusable: if a query defines the
     // graph the result will be empty if the exclude graph is specified.
     const char* s_queryPrefix =
@@ -55,6 +177,19 @@ namespace {
 //         "define input:named-graph-exclude <http://www.openlinksw.com/schemas/virtrdf#>";
 }
 
+QString Soprano::VirtuosoModelPrivate::objectToN3( const Soprano::Node& object ) const
+{
+    if ( m_fakeBooleans && object.literal().isBool() )
+        return Soprano::Node( Soprano::LiteralValue::fromString( object.literal().toBool() ? QString( QLatin1String( "true" ) ) : QLatin1String("false"),
+                                                                 Soprano::Virtuoso::fakeBooleanType() ) ).toN3();
+    else if ( object.literal().isByteArray() )
+        return Soprano::Node( Soprano::LiteralValue::fromString( object.literal().toString(),
+                                                                 Soprano::Virtuoso::fakeBase64BinaryType() ) ).toN3();
+    else
+        return nodeToN3( object );
+}
+
+
 QString Soprano::VirtuosoModelPrivate::statementToConstructGraphPattern( const Soprano::Statement& s,
                                                                          bool withContext,
                                                                          bool parameterized) const
@@ -100,14 +235,7 @@ QString Soprano::VirtuosoModelPrivate::statementToConstructGraphPattern( const S
             query += QLatin1String("`bif:__rdf_long_from_batch_params(\?\?,\?\?,\?\?)`");
         }
         else {
-            if ( m_fakeBooleans && s.object().literal().isBool() )
-                query += Soprano::Node( Soprano::LiteralValue::fromString( s.object().literal().toBool() ? QString( QLatin1String( "true" ) ) : QLatin1String("false"),
-                                                                            Soprano::Virtuoso::fakeBooleanType() ) ).toN3();
-            else if ( s.object().literal().isByteArray() )
-                query += Soprano::Node( Soprano::LiteralValue::fromString( s.object().literal().toString(),
-                                                                            Soprano::Virtuoso::fakeBase64BinaryType() ) ).toN3();
-            else
-                query += nodeToN3( s.object() );
+            query += objectToN3( s.object() );
         }
     }
     else {
@@ -124,7 +252,8 @@ QString Soprano::VirtuosoModelPrivate::statementToConstructGraphPattern( const S
 
 Soprano::QueryResultIterator Soprano::VirtuosoModelPrivate::sqlQuery( const QString& query )
 {
-    if ( ODBC::Connection* conn = connectionPool->connection() ) {
+    ODBC::PooledConnection pooledConnection( connectionPool );
+    if ( ODBC::Connection* conn = pooledConnection.connection() ) {
         ODBC::QueryResult* result = conn->executeQuery( query );
         if ( result ) {
             q->clearError();
@@ -149,6 +278,29 @@ Soprano::QueryResultIterator Soprano::VirtuosoModelPrivate::sparqlQuery( const Q
 }
 
 
+Soprano::QueryResultIterator Soprano::VirtuosoModelPrivate::preparedSparqlQuery( const QString& query, const QList<Node>& params )
+{
+    const QString request = QLatin1String( s_queryPrefix ) + query;
+    ODBC::PooledConnection pooledConnection( connectionPool );
+    if ( ODBC::Connection* conn = pooledConnection.connection() ) {
+        ODBC::QueryResult* result = conn->executePreparedQuery( request, params );
+        if ( result ) {
+            q->clearError();
+            return new Virtuoso::QueryResultIteratorBackend( this, result );
+        }
+        else {
+            qDebug() << "Query failed:" << request;
+            q->setError( conn->lastError() );
+            return 0;
+        }
+    }
+    else {
+        q->setError( connectionPool->lastError() );
+        return 0;
+    }
+}
+
+
 QString Soprano::VirtuosoModelPrivate::replaceFakeTypesInQuery( const QString& query )
 {
     if( !m_fakeBooleans )
@@ -159,6 +311,91 @@ QString Soprano::VirtuosoModelPrivate::replaceFakeTypesInQuery( const QString& q
 }
 
 
+QByteArray Soprano::VirtuosoModelPrivate::statementToNQuad( const Soprano::Statement& s ) const
+{
+    QString object;
+    if ( m_fakeBooleans && s.object().literal().isBool() )
+        object = Soprano::Node( Soprano::LiteralValue::fromString( s.object().literal().toBool() ? QString( QLatin1String( "true" ) ) : QLatin1String("false"),
+                                                                   Soprano::Virtuoso::fakeBooleanType() ) ).toN3();
+    else if ( s.object().literal().isByteArray() )
+        object = Soprano::Node( Soprano::LiteralValue::fromString( s.object().literal().toString(),
+                                                                   Soprano::Virtuoso::fakeBase64BinaryType() ) ).toN3();
+    else
+        object = s.object().toN3();
+
+    QByteArray quad = s.subject().toN3().toUtf8();
+    quad += ' ';
+    quad += s.predicate().toN3().toUtf8();
+    quad += ' ';
+    quad += object.toUtf8();
+    quad += ' ';
+    quad += s.context().toN3().toUtf8();
+    quad += " .\n";
+    return quad;
+}
+
+
+Soprano::Error::Error Soprano::VirtuosoModelPrivate::bulkLoad( const QList<Statement>& statements, QBitArray* loaded )
+{
+    const int connections = qBound( 1, m_bulkLoadConnections, connectionPool->maxConnections() );
+
+    // with synchronous updating the full text index would be updated for each literal
+    const bool deferIndex = m_syncFulltextIndex && m_deferFulltextIndex;
+    if ( deferIndex ) {
+        ODBC::PooledConnection pooledConnection( connectionPool );
+        if ( ODBC::Connection* conn = pooledConnection.connection() ) {
+            conn->executeCommand( QLatin1String( "DB.DBA.VT_BATCH_UPDATE ('DB.DBA.RDF_OBJ', 'ON', null)" ) );
+        }
+    }
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount( connections );
+    BulkLoadState state( connections * 2, ( statements.count() + s_bulkLoadChunkSize - 1 ) / s_bulkLoadChunkSize );
+
+    QList<Statement>::const_iterator it = statements.constBegin();
+    for ( int chunkIndex = 0; it != statements.constEnd() && !state.failed(); ++chunkIndex ) {
+        QByteArray chunk;
+        for ( int i = 0; i < s_bulkLoadChunkSize && it != statements.constEnd(); ++i, ++it ) {
+            chunk += statementToNQuad( *it );
+        }
+        state.pendingChunks.acquire();
+        threadPool.start( new BulkLoadJob( connectionPool, chunkIndex, chunk, &state ) );
+    }
+    threadPool.waitForDone();
+
+    if ( deferIndex ) {
+        ODBC::PooledConnection pooledConnection( connectionPool );
+        if ( ODBC::Connection* conn = pooledConnection.connection() ) {
+            conn->executeCommand( QLatin1String( "DB.DBA.VT_INC_INDEX_DB_DBA_RDF_OBJ ()" ) );
+            conn->executeCommand( QLatin1String( "DB.DBA.VT_BATCH_UPDATE ('DB.DBA.RDF_OBJ', 'OFF', null)" ) );
+        }
+    }
+
+    // There are no transactions across connections. Thus, we cannot roll back the chunks
+    // loaded before a failure but we report them.
+    loaded->fill( false, statements.count() );
+    for ( int chunkIndex = 0; chunkIndex < state.chunks.count(); ++chunkIndex ) {
+        const int start = chunkIndex * s_bulkLoadChunkSize;
+        const int end = qMin( start + s_bulkLoadChunkSize, statements.count() );
+
+        if ( state.chunks[chunkIndex] == BulkLoadState::ChunkLoaded ) {
+            loaded->fill( true, start, end );
+        }
+        else if ( state.chunks[chunkIndex] == BulkLoadState::ChunkFailed ) {
+            // look up the rows committed before the chunk failed
+            const QBitArray contained = q->containsStatements( statements.mid( start, end - start ) );
+            for ( int i = start; i < end; ++i ) {
+                // the statement which broke the chunk may break the batched check, too
+                if ( contained.isEmpty() ? q->containsStatement( statements[i] ) : contained.testBit( i - start ) )
+                    loaded->setBit( i );
+            }
+        }
+    }
+
+    return state.error;
+}
+
+
 Soprano::VirtuosoModel::VirtuosoModel( const QString &virtuosoVersion, ODBC::ConnectionPool* connectionPool,
                                        bool supportFakeBooleans, bool emptyGraphs, const Backend* b )
     : StorageModel(b),
@@ -216,7 +453,8 @@ Soprano::Error::ErrorCode Soprano::VirtuosoModel::addStatement( const Statement&
     if(statement.object().isValid() && !statement.object().isBlank())
         paramNodes << statement.object();
 
-    if ( ODBC::Connection* conn = d->connectionPool->connection() ) {
+    ODBC::PooledConnection pooledConnection( d->connectionPool );
+    if ( ODBC::Connection* conn = pooledConnection.connection() ) {
 
         if ( conn->executeCommand( insert, paramNodes ) == Error::ErrorNone ) {
             clearError();
@@ -239,8 +477,75 @@ Soprano::Error::ErrorCode Soprano::VirtuosoModel::addStatement( const Statement&
 }
 
 
+Soprano::Error::ErrorCode Soprano::VirtuosoModel::addStatements( const QList<Statement>& statements )
+{
+    if ( statements.count() < s_bulkLoadThreshold ) {
+        return StorageModel::addStatements( statements );
+    }
+
+    // Validate everything before loading anything. Blank nodes need the special
+    // syntax used in addStatement(), thus those statements are not bulk loaded.
+    QList<Statement> bulkStatements;
+    QList<Statement> bulkSignalStatements;
+    QList<Statement> blankNodeStatements;
+    bulkStatements.reserve( statements.count() );
+    bulkSignalStatements.reserve( statements.count() );
+    Q_FOREACH( const Statement& statement, statements ) {
+        if( !statement.isValid() ) {
+            qDebug() << Q_FUNC_INFO << "Cannot add invalid statement:" << statement;
+            setError( "Cannot add invalid statement.", Error::ErrorInvalidArgument );
+            return Error::ErrorInvalidArgument;
+        }
+
+        Statement s( statement );
+        if( !s.context().isValid() ) {
+            if ( d->m_supportEmptyGraphs ) {
+                s.setContext( Virtuoso::defaultGraph() );
+            }
+            else {
+                qDebug() << Q_FUNC_INFO << "Cannot add invalid statement:" << statement;
+                setError( "Cannot add statement with invalid context", Error::ErrorInvalidArgument );
+                return Error::ErrorInvalidArgument;
+            }
+        }
+
+        if ( s.subject().isBlank() || s.object().isBlank() || s.context().isBlank() )
+            blankNodeStatements << statement;
+        else {
+            bulkStatements << s;
+            bulkSignalStatements << statement;
+        }
+    }
+
+    QBitArray loaded;
+    const Error::Error error = d->bulkLoad( bulkStatements, &loaded );
+
+    // signal the statements which made it into the store, even if the load failed
+    if ( !d->m_noStatementSignals && loaded.count( true ) > 0 ) {
+        for ( int i = 0; i < bulkSignalStatements.count(); ++i ) {
+            if ( loaded.testBit( i ) )
+                emit statementAdded( bulkSignalStatements[i] );
+        }
+        emit statementsAdded();
+    }
+
+    if ( error ) {
+        setError( error );
+        return Error::convertErrorCode( error.code() );
+    }
+
+    return StorageModel::addStatements( blankNodeStatements );
+}
+
+
 // TODO: use "select GRAPH_IRI from DB.DBA.SPARQL_SELECT_KNOWN_GRAPHS_T"
 Soprano::NodeIterator Soprano::VirtuosoModel::listContexts() const
+{
+    return listContexts( 0, -1 );
+}
+
+
+Soprano::NodeIterator Soprano::VirtuosoModel::listContexts( int offset, int limit ) const
 {
 //    qDebug() << Q_FUNC_INFO;
 
@@ -248,7 +553,8 @@ Soprano::NodeIterator Soprano::VirtuosoModel::listContexts() const
                                                 "graph ?g { ?s ?p ?o . } . "
                                                 "FILTER(?g != <%1> && ?g != <%2>) . }" )
                            .arg( QLatin1String( Virtuoso::defaultGraphString() ),
-                                 QLatin1String( Virtuoso::openlinkVirtualGraphString() ) ) )
+                                 QLatin1String( Virtuoso::openlinkVirtualGraphString() ) )
+                           + pagingModifier( offset, limit, QLatin1String( "?g" ) ) )
         .iterateBindings( 0 );
 }
 
@@ -297,7 +603,79 @@ bool Soprano::VirtuosoModel::containsAnyStatement( const Statement& statement )
 }
 
 
+QBitArray Soprano::VirtuosoModel::containsStatements( const QList<Statement>& statements ) const
+{
+    // VALUES is only supported as of Virtuoso 7
+    if ( d->m_virtuosoVersion < QLatin1String( "7" ) )
+        return Model::containsStatements( statements );
+
+    // the statements with the default graph set, see containsStatement()
+    QList<Statement> quads;
+    for ( int i = 0; i < statements.count(); ++i ) {
+        Statement s( statements[i] );
+        if ( !s.isValid() ) {
+            setError( "Cannot call containsStatements on invalid statements", Error::ErrorInvalidArgument );
+            return QBitArray();
+        }
+        if ( !s.context().isValid() ) {
+            if ( d->m_supportEmptyGraphs ) {
+                s.setContext( Virtuoso::defaultGraph() );
+            }
+            else {
+                setError( "Found invalid context", Error::ErrorInvalidArgument );
+                return QBitArray();
+            }
+        }
+        quads.append( s );
+    }
+
+    clearError();
+
+    QBitArray result( quads.count() );
+    for ( int start = 0; start < quads.count(); start += s_containsChunkSize ) {
+        const int end = qMin( start + s_containsChunkSize, quads.count() );
+
+        // the index is passed through the query to map the matches back to the statements
+        QString values;
+        for ( int i = start; i < end; ++i ) {
+            const Statement& s = quads[i];
+            values += QString::fromLatin1( "(%1 %2 %3 %4 %5) " )
+                      .arg( i )
+                      .arg( nodeToN3( s.subject() ),
+                            nodeToN3( s.predicate() ),
+                            d->objectToN3( s.object() ),
+                            nodeToN3( s.context() ) );
+        }
+
+        QueryResultIterator it = d->sparqlQuery( QString::fromLatin1( "select distinct ?i where { "
+                                                                      "VALUES (?i ?s ?p ?o ?g) { %1} "
+                                                                      "graph ?g { ?s ?p ?o . } . }" )
+                                                 .arg( values ) );
+        if ( !it.isValid() )
+            return QBitArray();
+
+        while ( it.next() ) {
+            const int i = it.binding( 0 ).literal().toInt();
+            if ( i >= start && i < end )
+                result.setBit( i );
+        }
+        if ( it.lastError() ) {
+            setError( it.lastError() );
+            return QBitArray();
+        }
+    }
+
+    return result;
+}
+
+
 Soprano::StatementIterator Soprano::VirtuosoModel::listStatements( const Statement& partial ) const
+{
+    return listStatements( partial, 0, -1 );
+}
+
+
+Soprano::StatementIterator Soprano::VirtuosoModel::listStatements( const Statement& partial, int offset, int limit ) const
 {
 //    qDebug() << Q_FUNC_INFO << partial;
 
@@ -310,6 +688,17 @@ Soprano::StatementIterator Soprano::VirtuosoModel::listStatements( const Stateme
         query = QString::fromLatin1( "select * where { %1 . FILTER(?g != <%2>) . }" )
                 .arg( d->statementToConstructGraphPattern( partial, true ),
                       QLatin1String( Virtuoso::openlinkVirtualGraphString() ) );
+    // sort by the variables, thus consecutive pages do not overlap as long as the store is not modified
+    QStringList orderBy;
+    if ( !partial.subject().isValid() )
+        orderBy << QLatin1String( "?s" );
+    if ( !partial.predicate().isValid() )
+        orderBy << QLatin1String( "?p" );
+    if ( !partial.object().isValid() )
+        orderBy << QLatin1String( "?o" );
+    if ( !partial.context().isValid() )
+        orderBy << QLatin1String( "?g" );
+    query += pagingModifier( offset, limit, orderBy.join( QLatin1String( " " ) ) );
 //    qDebug() << "List Statements Query" << query;
     return d->sparqlQuery( query )
         .iterateStatementsFromBindings( partial.subject().isValid() ? QString() : QString( 's' ),
@@ -347,7 +736,8 @@ Soprano::Error::ErrorCode Soprano::VirtuosoModel::removeStatement( const Stateme
     QString query = QString::fromLatin1( "delete from %1" )
                     .arg( d->statementToConstructGraphPattern( s, true ) );
 //    qDebug() << "removeStatement query:" << query;
-    if ( ODBC::Connection* conn = d->connectionPool->connection() ) {
+    ODBC::PooledConnection pooledConnection( d->connectionPool );
+    if ( ODBC::Connection* conn = pooledConnection.connection() ) {
         if ( conn->executeCommand( QLatin1String( "sparql " ) + query ) == Error::ErrorNone ) {
             if(!d->m_noStatementSignals) {
                 // FIXME: can this be done with SQL/RDF views?
@@ -425,7 +815,8 @@ Soprano::Error::ErrorCode Soprano::VirtuosoModel::removeAllStatements( const Sta
         }
     }
 
-    if ( ODBC::Connection* conn = d->connectionPool->connection() ) {
+    ODBC::PooledConnection pooledConnection( d->connectionPool );
+    if ( ODBC::Connection* conn = pooledConnection.connection() ) {
         if ( conn->executeCommand( "sparql " + query ) == Error::ErrorNone ) {
             if(!d->m_noStatementSignals) {
                 // FIXME: can this be done with SQL/RDF views?
@@ -453,6 +844,62 @@ Soprano::Error::ErrorCode Soprano::VirtuosoModel::removeAllStatements( const Sta
 }
 
 
+QList<Soprano::Statement> Soprano::VirtuosoModel::takeAllStatements( const Statement& statement )
+{
+    if ( statement.context().isValid() &&
+         statement.context().uri() == Virtuoso::openlinkVirtualGraph() ) {
+        setError( "Cannot remove statements from the virtual openlink graph. Virtuoso would not like that.", Error::ErrorInvalidArgument );
+        return QList<Statement>();
+    }
+
+    // without SPARQL 1.1 delete we would need a query per graph anyway
+    if ( !statement.context().isValid() &&
+         d->m_virtuosoVersion < QLatin1String( "6.1.5" ) ) {
+        return Model::takeAllStatements( statement );
+    }
+
+    QList<Statement> removed = listStatements( statement ).allStatements();
+    if ( lastError() ) {
+        return QList<Statement>();
+    }
+    if ( removed.isEmpty() ) {
+        clearError();
+        return removed;
+    }
+
+    QString query;
+    if ( statement.context().isValid() ) {
+        query = QString::fromLatin1( "delete from %1 { %2 } where { %3 }" )
+                .arg( statement.context().toN3(),
+                      d->statementToConstructGraphPattern( statement, false ),
+                      d->statementToConstructGraphPattern( statement, true ) );
+    }
+    else {
+        query = QString::fromLatin1( "delete { %1 } where { %1 }" ).arg( d->statementToConstructGraphPattern( statement, true ) );
+    }
+
+    ODBC::PooledConnection pooledConnection( d->connectionPool );
+    ODBC::Connection* conn = pooledConnection.connection();
+    if ( !conn ) {
+        setError( d->connectionPool->lastError() );
+        return QList<Statement>();
+    }
+    if ( conn->executeCommand( "sparql " + query ) != Error::ErrorNone ) {
+        setError( conn->lastError() );
+        return QList<Statement>();
+    }
+
+    clearError();
+    if ( !d->m_noStatementSignals ) {
+        Q_FOREACH( const Statement& s, removed ) {
+            emit statementRemoved( s );
+        }
+        emit statementsRemoved();
+    }
+    return removed;
+}
+
+
 int Soprano::VirtuosoModel::statementCount() const
 {
 //    qDebug() << Q_FUNC_INFO;
@@ -470,6 +917,67 @@ int Soprano::VirtuosoModel::statementCount() const
 }
 
 
+int Soprano::VirtuosoModel::estimateCount( const Statement& pattern ) const
+{
+    // an exact count has to visit all matches, thus we only probe up to s_estimateLimit of them
+    QString query = QString::fromLatin1( "select count(*) where { { select * where { %1 . " )
+                    .arg( d->statementToConstructGraphPattern( pattern, true ) );
+    if ( !pattern.context().isValid() )
+        query += QString::fromLatin1( "FILTER(?g != <%1>) . " )
+                 .arg( QLatin1String( Virtuoso::openlinkVirtualGraphString() ) );
+    query += QString::fromLatin1( "} LIMIT %1 } }" ).arg( s_estimateLimit );
+
+    QueryResultIterator it = d->sparqlQuery( query );
+    if ( !it.isValid() )
+        return -1;
+
+    if ( !it.next() ) {
+        if ( it.lastError() )
+            setError( it.lastError() );
+        else
+            setError( "Failed to estimate the statement count" );
+        return -1;
+    }
+    const int cnt = it.binding( 0 ).literal().toInt();
+    it.close();
+    clearError();
+    return cnt;
+}
+
+
+QHash<Soprano::Node, int> Soprano::VirtuosoModel::predicateStatistics() const
+{
+    QHash<Node, int> counts;
+    QueryResultIterator it = d->sparqlQuery( QString::fromLatin1( "select ?p count(*) where { "
+                                                                  "graph ?g { ?s ?p ?o . } . "
+                                                                  "FILTER(?g != <%1>) . } group by ?p" )
+                                             .arg( QLatin1String( Virtuoso::openlinkVirtualGraphString() ) ) );
+    while ( it.next() ) {
+        counts.insert( it.binding( 0 ), it.binding( 1 ).literal().toInt() );
+    }
+    if ( it.isValid() )
+        setError( it.lastError() );
+    return counts;
+}
+
+
+QHash<Soprano::Node, int> Soprano::VirtuosoModel::contextStatistics() const
+{
+    // the default graph is converted to the empty node by the result iterator
+    QHash<Node, int> counts;
+    QueryResultIterator it = d->sparqlQuery( QString::fromLatin1( "select ?g count(*) where { "
+                                                                  "graph ?g { ?s ?p ?o . } . "
+                                                                  "FILTER(?g != <%1>) . } group by ?g" )
+                                             .arg( QLatin1String( Virtuoso::openlinkVirtualGraphString() ) ) );
+    while ( it.next() ) {
+        counts.insert( it.binding( 0 ), it.binding( 1 ).literal().toInt() );
+    }
+    if ( it.isValid() )
+        setError( it.lastError() );
+    return counts;
+}
+
+
 Soprano::Node Soprano::VirtuosoModel::createBlankNode()
 {
     setError( "createBlankNode not supported by the Virtuoso backend", Error::ErrorNotSupported );
@@ -498,6 +1006,20 @@ Soprano::QueryResultIterator Soprano::VirtuosoModel::executeQuery( const QString
 }
 
 
+Soprano::PreparedQuery Soprano::VirtuosoModel::prepareQuery( const QString& query,
+                                                             Query::QueryLanguage language,
+                                                             const QString& userQueryLanguage ) const
+{
+    if ( language == Soprano::Query::QueryLanguageSparql ) {
+        clearError();
+        return new Virtuoso::PreparedQueryBackend( const_cast<VirtuosoModel*>( this ), d, query );
+    }
+    else {
+        return StorageModel::prepareQuery( query, language, userQueryLanguage );
+    }
+}
+
+
 void Soprano::VirtuosoModel::slotVirtuosoStopped(VirtuosoController::ExitStatus status)
 {
     // inform clients about a non-scheduled exit of the server so they can act accordingly
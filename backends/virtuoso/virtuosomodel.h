@@ -48,17 +48,48 @@ namespace Soprano {
         ~VirtuosoModel();
 
         Error::ErrorCode addStatement( const Statement &statement );
+
+        /**
+         * Statement lists of at least 100 statements are loaded through
+         * DB.DBA.TTLP_MT using several connections in parallel. Statements
+         * with blank nodes are added one by one afterwards.
+         *
+         * The list is not added atomically. If loading fails the statements
+         * already in the store are kept and reported through statementAdded().
+         */
+        Error::ErrorCode addStatements( const QList<Statement> &statements );
         NodeIterator listContexts() const;
+        NodeIterator listContexts( int offset, int limit ) const;
         bool containsStatement( const Statement& statement ) const;
         bool containsAnyStatement( const Statement &statement ) const;
+
+        /**
+         * Checks up to 100 statements with one query which joins
+         * the quad table against a VALUES block.
+         */
+        QBitArray containsStatements( const QList<Statement>& statements ) const;
         Soprano::StatementIterator listStatements( const Statement &partial ) const;
+        Soprano::StatementIterator listStatements( const Statement &partial, int offset, int limit ) const;
         Error::ErrorCode removeStatement( const Statement &statement );
         Error::ErrorCode removeAllStatements( const Statement &statement );
+
+        /**
+         * Lists the matching statements and removes them with a single
+         * delete query. Falls back to the default implementation for
+         * Virtuoso versions before 6.1.5 if no context is given.
+         */
+        QList<Statement> takeAllStatements( const Statement &statement );
         int statementCount() const;
+        int estimateCount( const Statement& pattern ) const;
+        QHash<Node, int> predicateStatistics() const;
+        QHash<Node, int> contextStatistics() const;
         Node createBlankNode();
         Soprano::QueryResultIterator executeQuery( const QString &query,
                                                    Query::QueryLanguage language = Query::QueryLanguageSparql,
                                                    const QString& userQueryLanguage = QString() ) const;
+        Soprano::PreparedQuery prepareQuery( const QString &query,
+                                             Query::QueryLanguage language = Query::QueryLanguageSparql,
+                                             const QString& userQueryLanguage = QString() ) const;
 
     public Q_SLOTS:
         /// a public slot since it is connected from the backend on creation time
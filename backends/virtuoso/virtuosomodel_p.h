@@ -22,6 +22,7 @@
 #ifndef _SOPRANO_IODBC_MODEL_P_H_
 #define _SOPRANO_IODBC_MODEL_P_H_
 
+#include <QtCore/QBitArray>
 #include <QtCore/QMutex>
 #include <QtCore/QRegExp>
 
@@ -41,6 +42,9 @@ namespace Soprano {
         VirtuosoModelPrivate()
             : connectionPool( 0 ),
               m_noStatementSignals( false ),
+              m_syncFulltextIndex( false ),
+              m_deferFulltextIndex( false ),
+              m_bulkLoadConnections( 1 ),
               m_fakeBooleanRegExp( QLatin1String("([\"'])(true|false)\\1\\^\\^(<http\\://www\\.w3\\.org/2001/XMLSchema#boolean>|\\w+\\:boolean)"),
                                    Qt::CaseInsensitive,
                                    QRegExp::RegExp2 ),
@@ -66,13 +70,42 @@ namespace Soprano {
             m_openIteratorMutex.unlock();
         }
 
+        /**
+         * Convert an object node to N3, mapping booleans and byte arrays to
+         * the fake types used to store them.
+         */
+        QString objectToN3( const Soprano::Node& object ) const;
+
         QString statementToConstructGraphPattern( const Soprano::Statement& s, bool withContext = false, bool parameterized = false ) const;
 
         QueryResultIterator sqlQuery( const QString& query );
         QueryResultIterator sparqlQuery( const QString& query );
 
+        /**
+         * Execute a SPARQL query with parameter triples through a prepared statement.
+         */
+        QueryResultIterator preparedSparqlQuery( const QString& query, const QList<Node>& params );
+
         QString replaceFakeTypesInQuery( const QString& query );
 
+        /**
+         * The N-Quads representation of \p s as understood by DB.DBA.TTLP_MT
+         * including the fake types. \p s must not contain blank nodes.
+         */
+        QByteArray statementToNQuad( const Soprano::Statement& s ) const;
+
+        /**
+         * Load \p statements through the Virtuoso bulk loader using up to
+         * m_bulkLoadConnections connections in parallel. The load stops at
+         * the first failing chunk. The chunks loaded so far stay in the store.
+         *
+         * \param loaded Set to the statements which are in the store afterwards.
+         *
+         * \return The error of the first failing chunk. The error is not set on
+         * the model to allow emitting the signals for \p loaded first.
+         */
+        Error::Error bulkLoad( const QList<Statement>& statements, QBitArray* loaded );
+
         ODBC::ConnectionPool* connectionPool;
         QList<Virtuoso::QueryResultIteratorBackend*> m_openIterators;
 
@@ -82,6 +115,15 @@ namespace Soprano {
         bool m_fakeBooleans;
         bool m_supportEmptyGraphs;
 
+        /// \p true if the full text index is updated synchronously
+        bool m_syncFulltextIndex;
+
+        /// \p true if synchronous full text index updates should be deferred until a bulk load is done
+        bool m_deferFulltextIndex;
+
+        /// the number of connections used in parallel by bulkLoad()
+        int m_bulkLoadConnections;
+
         VirtuosoModel* q;
 
     private:
@@ -0,0 +1,95 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "virtuosopreparedquerybackend.h"
+#include "virtuosomodel.h"
+#include "virtuosomodel_p.h"
+#include "virtuosotools.h"
+
+#include "queryresultiterator.h"
+#include "bindingset.h"
+#include "literalvalue.h"
+#include "node.h"
+
+
+Soprano::Virtuoso::PreparedQueryBackend::PreparedQueryBackend( VirtuosoModel* model, VirtuosoModelPrivate* d, const QString& query )
+    : m_model( model ),
+      m_modelPrivate( d ),
+      m_query( query )
+{
+}
+
+
+Soprano::Virtuoso::PreparedQueryBackend::~PreparedQueryBackend()
+{
+}
+
+
+QStringList Soprano::Virtuoso::PreparedQueryBackend::parameterNames() const
+{
+    return m_query.parameterNames();
+}
+
+
+Soprano::QueryResultIterator Soprano::Virtuoso::PreparedQueryBackend::executeQuery( const BindingSet& bindings )
+{
+    if ( !m_model ) {
+        setError( "The model of the prepared query has been deleted." );
+        return QueryResultIterator();
+    }
+
+    QStringList replacements;
+    QList<Node> params;
+    for ( int i = 0; i < m_query.placeholderCount(); ++i ) {
+        const QString name = m_query.placeholderName( i );
+        const Node value = bindings[name];
+        if ( !value.isValid() ) {
+            setError( QString::fromLatin1( "No value bound to parameter %1" ).arg( name ), Error::ErrorInvalidArgument );
+            return QueryResultIterator();
+        }
+
+        // We do *not* parameterize blank nodes, see ODBC::Connection::execute()
+        if ( value.isBlank() ) {
+            replacements.append( '<' + value.toN3() + '>' );
+        }
+        else if ( value.isLiteral() && value.literal().isBool() && m_modelPrivate->m_fakeBooleans ) {
+            // replaced with the fake boolean type below
+            replacements.append( value.toN3() );
+        }
+        else if ( value.isLiteral() && value.literal().isByteArray() ) {
+            replacements.append( Node( LiteralValue::fromString( value.literal().toString(),
+                                                                 fakeBase64BinaryType() ) ).toN3() );
+        }
+        else if ( m_query.isExpressionPlaceholder( i ) ) {
+            replacements.append( QLatin1String( "bif:__rdf_long_from_batch_params(\?\?,\?\?,\?\?)" ) );
+            params.append( value );
+        }
+        else {
+            replacements.append( QLatin1String( "`bif:__rdf_long_from_batch_params(\?\?,\?\?,\?\?)`" ) );
+            params.append( value );
+        }
+    }
+
+    const QString query = m_modelPrivate->replaceFakeTypesInQuery( m_query.buildQuery( replacements ) );
+    QueryResultIterator it = m_modelPrivate->preparedSparqlQuery( query, params );
+    setError( m_model->lastError() );
+    return it;
+}
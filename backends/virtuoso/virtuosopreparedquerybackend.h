@@ -0,0 +1,61 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_VIRTUOSO_PREPARED_QUERY_BACKEND_H_
+#define _SOPRANO_VIRTUOSO_PREPARED_QUERY_BACKEND_H_
+
+#include "preparedquerybackend.h"
+#include "parameterizedquery.h"
+
+#include <QtCore/QPointer>
+
+namespace Soprano {
+
+    class VirtuosoModel;
+    class VirtuosoModelPrivate;
+
+    namespace Virtuoso {
+        /**
+         * Binds the values of a SPARQL query as ODBC parameters. Each parameter
+         * is replaced by a batch parameter triple which Virtuoso turns into a node,
+         * the resulting statement is prepared once per connection.
+         *
+         * Blank nodes and values which need to be converted to the fake types
+         * cannot be sent as parameters. These are written into the query instead.
+         */
+        class PreparedQueryBackend : public Soprano::PreparedQueryBackend
+        {
+        public:
+            PreparedQueryBackend( VirtuosoModel* model, VirtuosoModelPrivate* d, const QString& query );
+            ~PreparedQueryBackend();
+
+            QStringList parameterNames() const;
+            QueryResultIterator executeQuery( const BindingSet& bindings );
+
+        private:
+            QPointer<VirtuosoModel> m_model;
+            VirtuosoModelPrivate* m_modelPrivate;
+            Query::ParameterizedQuery m_query;
+        };
+    }
+}
+
+#endif
@@ -36,12 +36,18 @@
 #include <QtCore/QMutexLocker>
 #include <QtCore/QTime>
 #include <QtCore/QHash>
+#include <QtCore/QSocketNotifier>
+#include <QtCore/QDebug>
 
 
 using namespace Soprano::Server;
 
 namespace {
     const int s_defaultTimeout = 600000;
+
+    // the time we give the server to report a request deadline before we give up
+    const int s_timeoutGrace = 5000;
+
 }
 
 
@@ -49,12 +55,13 @@ Soprano::Client::ClientConnection::ClientConnection( QObject* parent )
     : QObject( parent ),
       d( new ClientConnectionPrivate() )
 {
-    d->socket = 0;
 }
 
 
 Soprano::Client::ClientConnection::~ClientConnection()
 {
+    delete d->subscriptionNotifier;
+    delete d->subscriptionSocket;
     delete d->socket;
     delete d;
 }
@@ -76,14 +83,14 @@ int Soprano::Client::ClientConnection::createModel( const QString& name, const Q
         return 0;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16(COMMAND_CREATE_MODEL) ||
+    if (!writeCommand( stream, COMMAND_CREATE_MODEL ) ||
         !stream.writeString(name)) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return 0;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -111,14 +118,14 @@ void Soprano::Client::ClientConnection::removeModel( const QString& name )
         return;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16(COMMAND_REMOVE_MODEL) ||
+    if (!writeCommand( stream, COMMAND_REMOVE_MODEL ) ||
         !stream.writeString(name)) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -143,13 +150,13 @@ Soprano::BackendFeatures Soprano::Client::ClientConnection::supportedFeatures()
         return BackendFeatureNone;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16(COMMAND_SUPPORTED_FEATURES)) {
+    if (!writeCommand( stream, COMMAND_SUPPORTED_FEATURES )) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return 0;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -177,7 +184,7 @@ Soprano::Error::ErrorCode Soprano::Client::ClientConnection::addStatement( int m
         return Error::convertErrorCode( lastError().code() );
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_ADD_STATEMENT ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_ADD_STATEMENT ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
         !stream.writeStatement(statement)) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
@@ -185,7 +192,7 @@ Soprano::Error::ErrorCode Soprano::Client::ClientConnection::addStatement( int m
         return Error::ErrorUnknown;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -212,14 +219,14 @@ int Soprano::Client::ClientConnection::listContexts( int modelId )
         return 0;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_LIST_CONTEXTS ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_LIST_CONTEXTS ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return 0;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -231,12 +238,47 @@ int Soprano::Client::ClientConnection::listContexts( int modelId )
     stream.readUnsignedInt32( itId );
     stream.readError( error );
 
+    pinIterator( itId, socket );
     setError( error );
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::listContexts) end";
     return itId;
 }
 
 
+int Soprano::Client::ClientConnection::listContexts( int modelId, int offset, int limit )
+{
+    Socket* socket = getSocket();
+    if ( !socket )
+        return 0;
+    SocketStream stream( socket );
+
+    if (!writeCommand( stream, COMMAND_MODEL_LIST_CONTEXTS_PAGE ) ||
+        !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
+        !stream.writeInt32( ( qint32 )offset ) ||
+        !stream.writeInt32( ( qint32 )limit ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return 0;
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return 0;
+    }
+
+    quint32 itId;
+    Error::Error error;
+    stream.readUnsignedInt32( itId );
+    stream.readError( error );
+
+    pinIterator( itId, socket );
+    setError( error );
+    return itId;
+}
+
+
 int Soprano::Client::ClientConnection::executeQuery( int modelId, const QString &query, Query::QueryLanguage type, const QString& userQueryLanguage )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::executeQuery)";
@@ -246,7 +288,7 @@ int Soprano::Client::ClientConnection::executeQuery( int modelId, const QString
         return 0;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_QUERY ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_QUERY ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
         !stream.writeString( query ) ||
         !stream.writeUnsignedInt16( ( quint16 )type ) ||
@@ -256,7 +298,7 @@ int Soprano::Client::ClientConnection::executeQuery( int modelId, const QString
         return 0;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -268,12 +310,48 @@ int Soprano::Client::ClientConnection::executeQuery( int modelId, const QString
     stream.readUnsignedInt32( itId );
     stream.readError( error );
 
+    pinIterator( itId, socket );
     setError( error );
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::executeQuery) end";
     return itId;
 }
 
 
+int Soprano::Client::ClientConnection::prepareQuery( int modelId, const QString &query, Query::QueryLanguage type, const QString& userQueryLanguage )
+{
+    Socket* socket = getSocket();
+    if ( !socket )
+        return 0;
+    SocketStream stream( socket );
+
+    if (!writeCommand( stream, COMMAND_MODEL_PREPARE_QUERY ) ||
+        !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
+        !stream.writeString( query ) ||
+        !stream.writeUnsignedInt16( ( quint16 )type ) ||
+        !stream.writeString( userQueryLanguage ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return 0;
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return 0;
+    }
+
+    quint32 queryId;
+    Error::Error error;
+    stream.readUnsignedInt32( queryId );
+    stream.readError( error );
+
+    pinIterator( queryId, socket );
+    setError( error );
+    return queryId;
+}
+
+
 int Soprano::Client::ClientConnection::listStatements( int modelId, const Statement &partial )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::listStatements)";
@@ -283,7 +361,7 @@ int Soprano::Client::ClientConnection::listStatements( int modelId, const Statem
         return 0;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_LIST_STATEMENTS ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_LIST_STATEMENTS ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
         !stream.writeStatement( partial ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
@@ -291,7 +369,7 @@ int Soprano::Client::ClientConnection::listStatements( int modelId, const Statem
         return 0;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -303,12 +381,48 @@ int Soprano::Client::ClientConnection::listStatements( int modelId, const Statem
     stream.readUnsignedInt32( itId );
     stream.readError( error );
 
+    pinIterator( itId, socket );
     setError( error );
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::listStatements) end";
     return itId;
 }
 
 
+int Soprano::Client::ClientConnection::listStatements( int modelId, const Statement &partial, int offset, int limit )
+{
+    Socket* socket = getSocket();
+    if ( !socket )
+        return 0;
+    SocketStream stream( socket );
+
+    if (!writeCommand( stream, COMMAND_MODEL_LIST_STATEMENTS_PAGE ) ||
+        !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
+        !stream.writeStatement( partial ) ||
+        !stream.writeInt32( ( qint32 )offset ) ||
+        !stream.writeInt32( ( qint32 )limit ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return 0;
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return 0;
+    }
+
+    quint32 itId;
+    Error::Error error;
+    stream.readUnsignedInt32( itId );
+    stream.readError( error );
+
+    pinIterator( itId, socket );
+    setError( error );
+    return itId;
+}
+
+
 Soprano::Error::ErrorCode Soprano::Client::ClientConnection::removeAllStatements( int modelId, const Statement &statement )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::removeAllStatements)";
@@ -318,7 +432,7 @@ Soprano::Error::ErrorCode Soprano::Client::ClientConnection::removeAllStatements
         return Error::convertErrorCode( lastError().code() );
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_REMOVE_ALL_STATEMENTS ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_REMOVE_ALL_STATEMENTS ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
         !stream.writeStatement( statement ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
@@ -326,7 +440,7 @@ Soprano::Error::ErrorCode Soprano::Client::ClientConnection::removeAllStatements
         return Error::ErrorUnknown;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -353,7 +467,7 @@ Soprano::Error::ErrorCode Soprano::Client::ClientConnection::removeStatement( in
         return Error::convertErrorCode( lastError().code() );
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_REMOVE_STATEMENT ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_REMOVE_STATEMENT ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
         !stream.writeStatement( statement ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
@@ -361,7 +475,7 @@ Soprano::Error::ErrorCode Soprano::Client::ClientConnection::removeStatement( in
         return Error::ErrorUnknown;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -388,14 +502,14 @@ int Soprano::Client::ClientConnection::statementCount( int modelId )
         return -1;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_STATEMENT_COUNT ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_STATEMENT_COUNT ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return -1;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -413,6 +527,99 @@ int Soprano::Client::ClientConnection::statementCount( int modelId )
 }
 
 
+int Soprano::Client::ClientConnection::estimateCount( int modelId, const Statement& pattern )
+{
+    Socket* socket = getSocket();
+    if ( !socket )
+        return -1;
+    SocketStream stream( socket );
+
+    if (!writeCommand( stream, COMMAND_MODEL_ESTIMATE_COUNT ) ||
+        !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
+        !stream.writeStatement( pattern ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return -1;
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return -1;
+    }
+
+    qint32 count;
+    Error::Error error;
+    stream.readInt32( count );
+    stream.readError( error );
+
+    setError( error );
+    return count;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Client::ClientConnection::predicateStatistics( int modelId )
+{
+    return statistics( COMMAND_MODEL_PREDICATE_STATISTICS, modelId );
+}
+
+
+QHash<Soprano::Node, int> Soprano::Client::ClientConnection::contextStatistics( int modelId )
+{
+    return statistics( COMMAND_MODEL_CONTEXT_STATISTICS, modelId );
+}
+
+
+QHash<Soprano::Node, int> Soprano::Client::ClientConnection::statistics( quint16 command, int modelId )
+{
+    Socket* socket = getSocket();
+    if ( !socket )
+        return QHash<Node, int>();
+    SocketStream stream( socket );
+
+    if (!writeCommand( stream, command ) ||
+        !stream.writeUnsignedInt32( ( quint32 )modelId ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return QHash<Node, int>();
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return QHash<Node, int>();
+    }
+
+    QHash<Node, int> counts;
+    quint32 n = 0;
+    if ( !stream.readUnsignedInt32( n ) ) {
+        setError( "Read error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return QHash<Node, int>();
+    }
+    counts.reserve( n );
+    for ( quint32 i = 0; i < n; ++i ) {
+        Node node;
+        qint32 count = 0;
+        if ( !stream.readNode( node ) ||
+             !stream.readInt32( count ) ) {
+            setError( "Read error", Soprano::Error::ErrorTimeout );
+            socket->close();
+            return QHash<Node, int>();
+        }
+        counts.insert( node, count );
+    }
+
+    Error::Error error;
+    stream.readError( error );
+
+    setError( error );
+    return counts;
+}
+
+
 bool Soprano::Client::ClientConnection::containsStatement( int modelId, const Statement &statement )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::containsStatement)";
@@ -422,7 +629,7 @@ bool Soprano::Client::ClientConnection::containsStatement( int modelId, const St
         return false;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_CONTAINS_STATEMENT ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_CONTAINS_STATEMENT ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
         !stream.writeStatement( statement ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
@@ -430,7 +637,7 @@ bool Soprano::Client::ClientConnection::containsStatement( int modelId, const St
         return false;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -457,7 +664,7 @@ bool Soprano::Client::ClientConnection::containsAnyStatement( int modelId, const
         return false;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_CONTAINS_ANY_STATEMENT ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_CONTAINS_ANY_STATEMENT ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ||
         !stream.writeStatement( statement ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
@@ -465,7 +672,7 @@ bool Soprano::Client::ClientConnection::containsAnyStatement( int modelId, const
         return false;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -483,6 +690,49 @@ bool Soprano::Client::ClientConnection::containsAnyStatement( int modelId, const
 }
 
 
+QBitArray Soprano::Client::ClientConnection::containsStatements( int modelId, const QList<Statement>& statements )
+{
+    Socket* socket = getSocket();
+    if ( !socket )
+        return QBitArray();
+    SocketStream stream( socket );
+
+    bool written = writeCommand( stream, COMMAND_MODEL_CONTAINS_STATEMENTS ) &&
+                   stream.writeUnsignedInt32( ( quint32 )modelId ) &&
+                   stream.writeUnsignedInt32( ( quint32 )statements.count() );
+    for ( int i = 0; written && i < statements.count(); ++i ) {
+        written = stream.writeStatement( statements[i] );
+    }
+    if ( !written ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return QBitArray();
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return QBitArray();
+    }
+
+    quint32 count = 0;
+    QByteArray packed;
+    Error::Error error;
+    stream.readUnsignedInt32( count );
+    stream.readByteArray( packed );
+    stream.readError( error );
+
+    QBitArray bits( qMin( int( count ), packed.size() * 8 ) );
+    for ( int i = 0; i < bits.size(); ++i ) {
+        bits.setBit( i, packed[i / 8] & ( 1 << ( i % 8 ) ) );
+    }
+
+    setError( error );
+    return bits;
+}
+
+
 bool Soprano::Client::ClientConnection::isEmpty( int modelId )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::isEmpty)";
@@ -492,14 +742,14 @@ bool Soprano::Client::ClientConnection::isEmpty( int modelId )
         return false;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_IS_EMPTY ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_IS_EMPTY ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId )) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return false;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -526,14 +776,14 @@ Soprano::Node Soprano::Client::ClientConnection::createBlankNode( int modelId )
         return Node();
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_MODEL_CREATE_BLANK_NODE ) ||
+    if (!writeCommand( stream, COMMAND_MODEL_CREATE_BLANK_NODE ) ||
         !stream.writeUnsignedInt32( ( quint32 )modelId ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return Node();
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -555,19 +805,19 @@ bool Soprano::Client::ClientConnection::iteratorNext( int id )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::iteratorNext)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return false;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_NEXT ) ||
+    if (!writeCommand( stream, COMMAND_ITERATOR_NEXT ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return false;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -589,19 +839,19 @@ Soprano::Node Soprano::Client::ClientConnection::nodeIteratorCurrent( int id )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::nodeIteratorCurrent)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return Node();
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_CURRENT_NODE ) ||
+    if (!writeCommand( stream, COMMAND_ITERATOR_CURRENT_NODE ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return Node();
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -623,19 +873,19 @@ Soprano::Statement Soprano::Client::ClientConnection::statementIteratorCurrent(
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::statementIteratorCurrent)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return Statement();
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_CURRENT_STATEMENT ) ||
+    if (!writeCommand( stream, COMMAND_ITERATOR_CURRENT_STATEMENT ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return Statement();
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -657,28 +907,42 @@ Soprano::BindingSet Soprano::Client::ClientConnection::queryIteratorCurrent( int
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::queryIteratorCurrent)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return BindingSet();
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_CURRENT_BINDINGSET ) ||
+    if (!writeCommand( stream, COMMAND_ITERATOR_CURRENT_BINDING_VALUES ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return BindingSet();
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
         return BindingSet();
     }
 
+    // the server only sends the variable names with the first row
+    bool schemaFollows = false;
+    BindingSchema schema;
+    stream.readBool( schemaFollows );
+    if ( schemaFollows ) {
+        stream.readBindingSchema( schema );
+        QMutexLocker lock( &d->iteratorMutex );
+        d->iteratorSchemas.insert( id, schema );
+    }
+    else {
+        QMutexLocker lock( &d->iteratorMutex );
+        schema = d->iteratorSchemas.value( id );
+    }
+
     BindingSet set;
     Error::Error error;
-    stream.readBindingSet( set );
+    stream.readBindingValues( schema, set );
     stream.readError( error );
 
     setError( error );
@@ -691,19 +955,19 @@ Soprano::Statement Soprano::Client::ClientConnection::queryIteratorCurrentStatem
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::queryIteratorCurrentStatement)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return Statement();
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_CURRENT_STATEMENT ) ||
+    if (!writeCommand( stream, COMMAND_ITERATOR_CURRENT_STATEMENT ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return Statement();
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -724,19 +988,19 @@ int Soprano::Client::ClientConnection::queryIteratorType( int id )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::queryIteratorType)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return 0;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_QUERY_TYPE ) ||
+    if (!writeCommand( stream, COMMAND_ITERATOR_QUERY_TYPE ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return 0;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -758,19 +1022,19 @@ bool Soprano::Client::ClientConnection::queryIteratorBoolValue( int id )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::queryIteratorBoolValue)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return false;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_QUERY_BOOL_VALUE ) ||
+    if (!writeCommand( stream, COMMAND_ITERATOR_QUERY_BOOL_VALUE ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return false;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -791,19 +1055,26 @@ void Soprano::Client::ClientConnection::iteratorClose( int id )
 {
     //qDebug() << this << QTime::currentTime().toString( "hh:mm:ss.zzz" ) << QThread::currentThreadId() << "(ClientConnection::iteratorClose)";
 
-    Socket* socket = getSocket();
+    Socket* socket = iteratorSocket( id );
     if ( !socket )
         return;
     SocketStream stream( socket );
 
-    if (!stream.writeUnsignedInt16( COMMAND_ITERATOR_CLOSE ) ||
+    {
+        // the stream keeps the socket locked, thus it cannot be reaped before we are done
+        QMutexLocker lock( &d->iteratorMutex );
+        d->iteratorSockets.remove( id );
+        d->iteratorSchemas.remove( id );
+    }
+
+    if (!writeCommand( stream, COMMAND_ITERATOR_CLOSE ) ||
         !stream.writeUnsignedInt32( ( quint32 )id ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
         socket->close();
         return;
     }
 
-    if ( !socket->waitForReadyRead(s_defaultTimeout) ) {
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
         setError( "Command timed out.", Soprano::Error::ErrorTimeout );
         // We cannot recover from a timeout, thus we force a reconnect
         socket->close();
@@ -818,6 +1089,115 @@ void Soprano::Client::ClientConnection::iteratorClose( int id )
 }
 
 
+int Soprano::Client::ClientConnection::iteratorProject( int id, int column, const QString& bindingName, bool distinct )
+{
+    // the node iterator lives on the same server connection as the projected one
+    Socket* socket = iteratorSocket( id );
+    if ( !socket )
+        return 0;
+    SocketStream stream( socket );
+
+    if (!writeCommand( stream, COMMAND_ITERATOR_PROJECT ) ||
+        !stream.writeUnsignedInt32( ( quint32 )id ) ||
+        !stream.writeInt32( ( qint32 )column ) ||
+        !stream.writeString( bindingName ) ||
+        !stream.writeBool( distinct ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return 0;
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return 0;
+    }
+
+    quint32 itId;
+    Error::Error error;
+    stream.readUnsignedInt32( itId );
+    stream.readError( error );
+
+    if ( itId != 0 ) {
+        QMutexLocker lock( &d->iteratorMutex );
+        d->iteratorSockets.remove( id );
+        d->iteratorSchemas.remove( id );
+    }
+    pinIterator( itId, socket );
+    setError( error );
+    return itId;
+}
+
+
+int Soprano::Client::ClientConnection::preparedQueryExecute( int id, const BindingSet& bindings )
+{
+    // the resulting iterator lives on the same server connection as the prepared query
+    Socket* socket = iteratorSocket( id );
+    if ( !socket )
+        return 0;
+    SocketStream stream( socket );
+
+    if (!writeCommand( stream, COMMAND_PREPARED_QUERY_EXECUTE ) ||
+        !stream.writeUnsignedInt32( ( quint32 )id ) ||
+        !stream.writeBindingSet( bindings ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return 0;
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return 0;
+    }
+
+    quint32 itId;
+    Error::Error error;
+    stream.readUnsignedInt32( itId );
+    stream.readError( error );
+
+    pinIterator( itId, socket );
+    setError( error );
+    return itId;
+}
+
+
+void Soprano::Client::ClientConnection::preparedQueryClose( int id )
+{
+    Socket* socket = iteratorSocket( id );
+    if ( !socket )
+        return;
+    SocketStream stream( socket );
+
+    {
+        // the stream keeps the socket locked, thus it cannot be reaped before we are done
+        QMutexLocker lock( &d->iteratorMutex );
+        d->iteratorSockets.remove( id );
+    }
+
+    if (!writeCommand( stream, COMMAND_PREPARED_QUERY_CLOSE ) ||
+        !stream.writeUnsignedInt32( ( quint32 )id ) ) {
+        setError( "Write error", Soprano::Error::ErrorTimeout );
+        socket->close();
+        return;
+    }
+
+    if ( !socket->waitForReadyRead( replyTimeout() ) ) {
+        setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        // We cannot recover from a timeout, thus we force a reconnect
+        socket->close();
+        return;
+    }
+
+    Error::Error error;
+    stream.readError( error );
+
+    setError( error );
+}
+
+
 bool Soprano::Client::ClientConnection::checkProtocolVersion()
 {
     Socket* socket = getSocket();
@@ -825,6 +1205,7 @@ bool Soprano::Client::ClientConnection::checkProtocolVersion()
         return false;
     SocketStream stream( socket );
 
+    // no request options here: we do not know yet if the server supports them
     if (!stream.writeUnsignedInt16( COMMAND_SUPPORTS_PROTOCOL_VERSION ) ||
         !stream.writeUnsignedInt32( ( quint32 )PROTOCOL_VERSION ) ) {
         setError( "Write error", Soprano::Error::ErrorTimeout );
@@ -852,3 +1233,367 @@ bool Soprano::Client::ClientConnection::checkProtocolVersion()
     return reply;
 }
 
+
+void Soprano::Client::ClientConnection::setRequestTimeout( int msecs )
+{
+    d->requestTimeout = qMax( 0, msecs );
+}
+
+
+int Soprano::Client::ClientConnection::requestTimeout() const
+{
+    return d->requestTimeout;
+}
+
+
+bool Soprano::Client::ClientConnection::cancelRunningRequest()
+{
+    quint32 id = 0;
+    {
+        QMutexLocker lock( &d->requestMutex );
+        id = d->runningRequestId;
+    }
+    if ( id == 0 ) {
+        setError( "No running request" );
+        return false;
+    }
+
+    Socket* socket = openCancelSocket();
+    if ( !socket ) {
+        setError( "Cancelling requests is not supported by this connection", Error::ErrorNotSupported );
+        return false;
+    }
+
+    bool cancelled = false;
+    {
+        SocketStream stream( socket );
+
+        if ( !stream.writeUnsignedInt16( COMMAND_CANCEL_REQUEST ) ||
+             !stream.writeUnsignedInt32( id ) ) {
+            setError( "Write error", Soprano::Error::ErrorTimeout );
+        }
+        else if ( !socket->waitForReadyRead( s_defaultTimeout ) ) {
+            setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+        }
+        else {
+            Error::Error error;
+            stream.readBool( cancelled );
+            stream.readError( error );
+            setError( error );
+        }
+    }
+
+    delete socket;
+    return cancelled;
+}
+
+
+Soprano::Socket* Soprano::Client::ClientConnection::openCancelSocket()
+{
+    return 0;
+}
+
+
+Soprano::Socket* Soprano::Client::ClientConnection::openSubscriptionSocket()
+{
+    return 0;
+}
+
+
+int Soprano::Client::ClientConnection::subscribe( int modelId, const QList<Statement>& patterns )
+{
+    if ( QThread::currentThread() != thread() ) {
+        setError( "Subscriptions can only be managed from the thread the connection lives in." );
+        return 0;
+    }
+
+    Socket* socket = subscriptionSocket();
+    if ( !socket )
+        return 0;
+
+    quint32 id = 0;
+    Error::Error error;
+    {
+        SocketStream stream( socket );
+
+        bool written = stream.writeUnsignedInt16( COMMAND_MODEL_SUBSCRIBE ) &&
+                       stream.writeUnsignedInt32( ( quint32 )modelId ) &&
+                       stream.writeUnsignedInt32( ( quint32 )patterns.count() );
+        for ( int i = 0; written && i < patterns.count(); ++i ) {
+            written = stream.writeStatement( patterns[i] );
+        }
+        if ( !written ) {
+            setError( "Write error", Soprano::Error::ErrorTimeout );
+            closeSubscriptionSocket();
+            return 0;
+        }
+
+        if ( !readSubscriptionReply( stream, id, error ) ) {
+            closeSubscriptionSocket();
+            return 0;
+        }
+    }
+
+    setError( error );
+    return id;
+}
+
+
+void Soprano::Client::ClientConnection::unsubscribe( int subscriptionId )
+{
+    if ( QThread::currentThread() != thread() ) {
+        setError( "Subscriptions can only be managed from the thread the connection lives in." );
+        return;
+    }
+
+    Socket* socket = d->subscriptionSocket;
+    if ( !socket || !socket->isConnected() ) {
+        setError( "Invalid subscription id" );
+        return;
+    }
+
+    quint32 id = 0;
+    Error::Error error;
+    {
+        SocketStream stream( socket );
+
+        if ( !stream.writeUnsignedInt16( COMMAND_MODEL_UNSUBSCRIBE ) ||
+             !stream.writeUnsignedInt32( ( quint32 )subscriptionId ) ) {
+            setError( "Write error", Soprano::Error::ErrorTimeout );
+            closeSubscriptionSocket();
+            return;
+        }
+
+        if ( !readSubscriptionReply( stream, id, error ) ) {
+            closeSubscriptionSocket();
+            return;
+        }
+    }
+
+    // drop changes which have been read but not delivered yet
+    for ( int i = d->queuedChanges.count() - 1; i >= 0; --i ) {
+        if ( d->queuedChanges[i].subscriptionId == subscriptionId )
+            d->queuedChanges.removeAt( i );
+    }
+
+    setError( error );
+}
+
+
+Soprano::Socket* Soprano::Client::ClientConnection::subscriptionSocket()
+{
+    if ( d->subscriptionSocket && d->subscriptionSocket->isConnected() )
+        return d->subscriptionSocket;
+
+    closeSubscriptionSocket();
+    delete d->subscriptionSocket;
+    d->subscriptionSocket = openSubscriptionSocket();
+    if ( !d->subscriptionSocket ) {
+        setError( "Subscriptions are not supported by this connection", Error::ErrorNotSupported );
+        return 0;
+    }
+
+    d->subscriptionNotifier = new QSocketNotifier( d->subscriptionSocket->handle(), QSocketNotifier::Read, this );
+    QObject::connect( d->subscriptionNotifier, SIGNAL(activated(int)),
+                      this, SLOT(readSubscriptionSocket()) );
+    return d->subscriptionSocket;
+}
+
+
+void Soprano::Client::ClientConnection::closeSubscriptionSocket()
+{
+    if ( d->subscriptionNotifier ) {
+        // we might be called from within the notifier's activated() signal
+        d->subscriptionNotifier->deleteLater();
+        d->subscriptionNotifier = 0;
+    }
+    if ( d->subscriptionSocket ) {
+        d->subscriptionSocket->lock();
+        d->subscriptionSocket->close();
+        d->subscriptionSocket->unlock();
+    }
+    d->queuedChanges.clear();
+}
+
+
+bool Soprano::Client::ClientConnection::readSubscriptionReply( SocketStream& stream, quint32& id, Error::Error& error )
+{
+    // changes of other subscriptions might arrive before the reply
+    Q_FOREVER {
+        if ( !d->subscriptionSocket->waitForReadyRead( s_defaultTimeout ) ) {
+            setError( "Command timed out.", Soprano::Error::ErrorTimeout );
+            return false;
+        }
+
+        quint16 type = 0;
+        if ( !stream.readUnsignedInt16( type ) ) {
+            setError( stream.lastError() );
+            return false;
+        }
+
+        if ( type == SUBSCRIPTION_REPLY ) {
+            return stream.readUnsignedInt32( id ) && stream.readError( error );
+        }
+        else if ( type == SUBSCRIPTION_CHANGES ) {
+            SubscriptionChanges changes;
+            if ( !readSubscriptionChanges( stream, changes ) ) {
+                setError( stream.lastError() );
+                return false;
+            }
+            if ( d->queuedChanges.isEmpty() )
+                QMetaObject::invokeMethod( this, "deliverQueuedChanges", Qt::QueuedConnection );
+            d->queuedChanges.append( changes );
+        }
+        else {
+            setError( QString( "Unexpected subscription message %1" ).arg( type ) );
+            return false;
+        }
+    }
+}
+
+
+bool Soprano::Client::ClientConnection::readSubscriptionChanges( SocketStream& stream, SubscriptionChanges& changes )
+{
+    quint32 id = 0;
+    quint32 count = 0;
+    if ( !stream.readUnsignedInt32( id ) || !stream.readUnsignedInt32( count ) )
+        return false;
+    changes.subscriptionId = id;
+
+    for ( quint32 i = 0; i < count; ++i ) {
+        Statement s;
+        if ( !stream.readStatement( s ) )
+            return false;
+        changes.added.append( s );
+    }
+
+    if ( !stream.readUnsignedInt32( count ) )
+        return false;
+    for ( quint32 i = 0; i < count; ++i ) {
+        Statement s;
+        if ( !stream.readStatement( s ) )
+            return false;
+        changes.removed.append( s );
+    }
+
+    return true;
+}
+
+
+void Soprano::Client::ClientConnection::readSubscriptionSocket()
+{
+    Socket* socket = d->subscriptionSocket;
+    if ( !socket || !socket->isConnected() )
+        return;
+
+    QList<SubscriptionChanges> received;
+    bool failed = false;
+    {
+        SocketStream stream( socket );
+
+        // the server writes each message in one go, thus, we only need to wait for its beginning
+        while ( socket->waitForReadyRead( 0 ) ) {
+            quint16 type = 0;
+            SubscriptionChanges changes;
+            if ( !stream.readUnsignedInt16( type ) ||
+                 type != SUBSCRIPTION_CHANGES ||
+                 !readSubscriptionChanges( stream, changes ) ) {
+                // the server closed the connection
+                failed = true;
+                break;
+            }
+            received.append( changes );
+        }
+    }
+
+    if ( failed ) {
+        qDebug() << "(ClientConnection) subscription connection lost";
+        closeSubscriptionSocket();
+    }
+
+    Q_FOREACH( const SubscriptionChanges& changes, received ) {
+        emit changesReceived( changes.subscriptionId, changes.added, changes.removed );
+    }
+}
+
+
+void Soprano::Client::ClientConnection::deliverQueuedChanges()
+{
+    const QList<SubscriptionChanges> changes = d->queuedChanges;
+    d->queuedChanges.clear();
+    Q_FOREACH( const SubscriptionChanges& c, changes ) {
+        emit changesReceived( c.subscriptionId, c.added, c.removed );
+    }
+}
+
+
+Soprano::Socket* Soprano::Client::ClientConnection::iteratorSocket( int id )
+{
+    {
+        QMutexLocker lock( &d->iteratorMutex );
+        QHash<int, Socket*>::const_iterator it = d->iteratorSockets.constFind( id );
+        if ( it != d->iteratorSockets.constEnd() )
+            return it.value();
+    }
+    return getSocket();
+}
+
+
+void Soprano::Client::ClientConnection::pinIterator( int id, Socket* socket )
+{
+    if ( id != 0 ) {
+        QMutexLocker lock( &d->iteratorMutex );
+        d->iteratorSockets.insert( id, socket );
+    }
+}
+
+
+bool Soprano::Client::ClientConnection::hasOpenIterators( Socket* socket ) const
+{
+    QMutexLocker lock( &d->iteratorMutex );
+    for ( QHash<int, Socket*>::const_iterator it = d->iteratorSockets.constBegin();
+          it != d->iteratorSockets.constEnd(); ++it ) {
+        if ( it.value() == socket )
+            return true;
+    }
+    return false;
+}
+
+
+void Soprano::Client::ClientConnection::clearOpenIterators()
+{
+    QMutexLocker lock( &d->iteratorMutex );
+    d->iteratorSockets.clear();
+    d->iteratorSchemas.clear();
+}
+
+
+bool Soprano::Client::ClientConnection::writeCommand( SocketStream& stream, quint16 command )
+{
+    // queries are always sent with a request id to be able to cancel them
+    if ( d->requestTimeout > 0 || command == COMMAND_MODEL_QUERY ) {
+        // the server assigns the request id, we need it before the command blocks the connection
+        quint32 id = 0;
+        if ( !stream.writeUnsignedInt16( COMMAND_REQUEST_OPTIONS ) ||
+             !stream.writeUnsignedInt32( quint32( d->requestTimeout ) ) ||
+             !stream.socket()->waitForReadyRead( s_defaultTimeout ) ||
+             !stream.readUnsignedInt32( id ) ) {
+            return false;
+        }
+
+        QMutexLocker lock( &d->requestMutex );
+        d->runningRequestId = id;
+        stream.setRunningRequest( id, &d->runningRequestId, &d->requestMutex );
+    }
+
+    return stream.writeUnsignedInt16( command );
+}
+
+
+int Soprano::Client::ClientConnection::replyTimeout() const
+{
+    if ( d->requestTimeout > 0 )
+        return qMin( s_defaultTimeout, d->requestTimeout + s_timeoutGrace );
+    else
+        return s_defaultTimeout;
+}
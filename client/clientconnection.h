@@ -25,9 +25,12 @@
 #include "error.h"
 #include "sopranotypes.h"
 #include "socket.h"
+#include "statement.h"
 
 #include <QtCore/QObject>
 #include <QtCore/QList>
+#include <QtCore/QHash>
+#include <QtCore/QBitArray>
 
 
 class QIODevice;
@@ -35,13 +38,14 @@ class QIODevice;
 namespace Soprano {
 
     class Node;
-    class Statement;
     class BindingSet;
     class BackendSetting;
+    class SocketStream;
 
     namespace Client {
 
         class ClientConnectionPrivate;
+        struct SubscriptionChanges;
 
         /**
          * A ClientConnection is just a wrapper class over a socket, which can be used to send
@@ -67,14 +71,21 @@ namespace Soprano {
             // Model methods
             Error::ErrorCode addStatement( int modelId, const Statement &statement );
             int listContexts( int modelId );
+            int listContexts( int modelId, int offset, int limit );
             int executeQuery( int modelId, const QString &query, Query::QueryLanguage type, const QString& userQueryLanguage );
+            int prepareQuery( int modelId, const QString &query, Query::QueryLanguage type, const QString& userQueryLanguage );
             int listStatements( int modelId, const Statement &partial );
+            int listStatements( int modelId, const Statement &partial, int offset, int limit );
             Error::ErrorCode removeStatement( int modelId, const Statement &statement );
             Error::ErrorCode removeAllStatements( int modelId, const Statement &statement );
             int statementCount( int modelId );
+            int estimateCount( int modelId, const Statement& pattern );
+            QHash<Node, int> predicateStatistics( int modelId );
+            QHash<Node, int> contextStatistics( int modelId );
             bool isEmpty( int modelId );
             bool containsStatement( int modelId, const Statement &statement );
             bool containsAnyStatement( int modelId, const Statement &statement );
+            QBitArray containsStatements( int modelId, const QList<Statement>& statements );
             Node createBlankNode( int modelId );
 
             // Iterator methods
@@ -88,21 +99,119 @@ namespace Soprano {
 
             void iteratorClose( int id );
 
+            /**
+             * Moves the iterator \p id into a node iterator over one of its columns.
+             * \return The id of the node iterator which replaces \p id or 0 on error.
+             */
+            int iteratorProject( int id, int column, const QString& bindingName, bool distinct );
+
+            // Prepared query methods, prepared queries are pinned to their socket like iterators
+            int preparedQueryExecute( int id, const BindingSet& bindings );
+            void preparedQueryClose( int id );
+
             bool checkProtocolVersion();
 
+            /**
+             * Attach a deadline of \p msecs milliseconds to all following requests.
+             * The server aborts requests which exceed their deadline if the backend
+             * supports it. A value of 0 disables the deadline.
+             */
+            void setRequestTimeout( int msecs );
+            int requestTimeout() const;
+
+            /**
+             * Cancel the request currently running through this connection.
+             * Since the connection is blocked by the running request the cancel
+             * command is sent through a new temporary connection (see openCancelSocket()).
+             * This method is meant to be called from another thread.
+             *
+             * \return \p true if the server cancelled a request.
+             */
+            bool cancelRunningRequest();
+
+            /**
+             * Subscribe to the changes of the statements in model \p modelId which match
+             * one of \p patterns. The changes are read from a separate socket (see
+             * openSubscriptionSocket()) and reported through changesReceived() by the
+             * event loop of the thread this connection lives in. Subscriptions can only
+             * be managed from that thread.
+             *
+             * \return The id of the new subscription or 0 on error.
+             */
+            int subscribe( int modelId, const QList<Statement>& patterns );
+            void unsubscribe( int subscriptionId );
+
             virtual bool connect() = 0;
             virtual bool disconnect() = 0;
             virtual bool isConnected() = 0;
 
+        Q_SIGNALS:
+            /**
+             * Emitted with the batched changes of the subscription \p subscriptionId.
+             * \p removed may contain statements with empty nodes if the server model
+             * removed statements by pattern.
+             */
+            void changesReceived( int subscriptionId, const QList<Soprano::Statement>& added, const QList<Soprano::Statement>& removed );
+
         protected:
             /**
              * Returns the underlying socket that is used for communication.
+             * Implementations may return different sockets depending on the
+             * calling thread. Iterators are always pinned to the socket which
+             * created them.
              *
              * This should never return 0.
              */
             virtual Socket* getSocket() = 0;
 
+            /**
+             * \return \p true if iterators or prepared queries created through \p socket are still open.
+             * Such a socket may not be closed without invalidating the iterators.
+             */
+            bool hasOpenIterators( Socket* socket ) const;
+
+            /**
+             * Forget about all open iterators, to be called once all sockets are closed.
+             */
+            void clearOpenIterators();
+
+            /**
+             * Open a new socket to the server which is used to send the
+             * cancel command in cancelRunningRequest(). Ownership is
+             * transferred to the caller.
+             *
+             * The default implementation returns 0, i.e. cancelling is not supported.
+             */
+            virtual Socket* openCancelSocket();
+
+            /**
+             * Open a new socket to the server which is used for subscriptions
+             * since the server pushes changes on it at any time. Ownership is
+             * transferred to the connection.
+             *
+             * The default implementation returns 0, i.e. subscriptions are not supported.
+             */
+            virtual Socket* openSubscriptionSocket();
+
+            /**
+             * Close the subscription socket which ends all subscriptions.
+             */
+            void closeSubscriptionSocket();
+
+        private Q_SLOTS:
+            void readSubscriptionSocket();
+            void deliverQueuedChanges();
+
         private:
+            Socket* subscriptionSocket();
+            bool readSubscriptionReply( SocketStream& stream, quint32& id, Error::Error& error );
+            bool readSubscriptionChanges( SocketStream& stream, SubscriptionChanges& changes );
+            Socket* iteratorSocket( int id );
+            void pinIterator( int id, Socket* socket );
+            bool writeCommand( SocketStream& stream, quint16 command );
+            int replyTimeout() const;
+            QHash<Node, int> statistics( quint16 command, int modelId );
+
             ClientConnectionPrivate* const d;
         };
     }
@@ -23,13 +23,59 @@
 #define _SOPRANO_SERVER_CLIENT_CONNECTION_P_H_
 
 #include "socket.h"
+#include "bindingschema.h"
+#include "statement.h"
+
+#include <QtCore/QMutex>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+
+class QSocketNotifier;
 
 namespace Soprano {
     namespace Client {
+        /// one SUBSCRIPTION_CHANGES message
+        struct SubscriptionChanges {
+            int subscriptionId;
+            QList<Statement> added;
+            QList<Statement> removed;
+        };
+
         class ClientConnectionPrivate
         {
         public:
+            ClientConnectionPrivate()
+                : socket( 0 ),
+                  requestTimeout( 0 ),
+                  runningRequestId( 0 ),
+                  subscriptionSocket( 0 ),
+                  subscriptionNotifier( 0 ) {
+            }
+
             Socket* socket;
+
+            int requestTimeout;
+
+            /// the id of the last request which has been sent with request options, 0 once it has been answered
+            quint32 runningRequestId;
+            QMutex requestMutex;
+
+            /**
+             * iterator and prepared query ids are only valid on the server connection which created them.
+             * The server generates them unique across all its connections, thus the id is a sufficient key.
+             */
+            QHash<int, Socket*> iteratorSockets;
+
+            /// the binding schema of each query iterator, sent by the server with the first row
+            QHash<int, BindingSchema> iteratorSchemas;
+            QMutex iteratorMutex;
+
+            /// the server pushes changes on this socket, it is only used for subscriptions
+            Socket* subscriptionSocket;
+            QSocketNotifier* subscriptionNotifier;
+
+            /// changes read while waiting for a subscription reply, delivered through the event loop
+            QList<SubscriptionChanges> queuedChanges;
         };
     }
 }
@@ -30,10 +30,53 @@
 #include "nodeiterator.h"
 #include "statementiterator.h"
 #include "queryresultiterator.h"
+#include "preparedquery.h"
+#include "preparedquerybackend.h"
+#include "bindingset.h"
+#include "query/parameterizedquery.h"
 
 #include <QtCore/QMutexLocker>
 
 
+namespace {
+    class ClientPreparedQueryBackend : public Soprano::PreparedQueryBackend
+    {
+    public:
+        ClientPreparedQueryBackend( int id, const QString& query, Soprano::Client::ClientModel* model )
+            : m_id( id ),
+              m_parameterNames( Soprano::Query::ParameterizedQuery( query ).parameterNames() ),
+              m_model( model ) {
+        }
+
+        ~ClientPreparedQueryBackend() {
+            if ( m_model )
+                m_model->closePreparedQuery( m_id );
+        }
+
+        QStringList parameterNames() const {
+            return m_parameterNames;
+        }
+
+        Soprano::QueryResultIterator executeQuery( const Soprano::BindingSet& bindings ) {
+            if ( m_model ) {
+                Soprano::QueryResultIterator it = m_model->executePreparedQuery( m_id, bindings );
+                setError( m_model->lastError() );
+                return it;
+            }
+            else {
+                setError( "The model of the prepared query has been deleted." );
+                return Soprano::QueryResultIterator();
+            }
+        }
+
+    private:
+        int m_id;
+        QStringList m_parameterNames;
+        QPointer<Soprano::Client::ClientModel> m_model;
+    };
+}
+
+
 Soprano::Client::ClientModel::ClientModel( const Backend* backend, int modelId, ClientConnection* client )
     : StorageModel( backend ),
       m_modelId( modelId ),
@@ -54,6 +97,9 @@ Soprano::Client::ClientModel::~ClientModel()
         for ( int i = 0; i < m_openIterators.count(); ++i ) {
             m_client->iteratorClose( m_openIterators[i] );
         }
+        for ( int i = 0; i < m_openPreparedQueries.count(); ++i ) {
+            m_client->preparedQueryClose( m_openPreparedQueries[i] );
+        }
     }
 }
 
@@ -118,6 +164,75 @@ Soprano::QueryResultIterator Soprano::Client::ClientModel::executeQuery( const Q
 }
 
 
+Soprano::PreparedQuery Soprano::Client::ClientModel::prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    if ( m_client ) {
+        int queryId = m_client->prepareQuery( m_modelId, query, language, userQueryLanguage );
+        if ( queryId > 0 ) {
+            QMutexLocker locker( &m_openIteratorsMutex );
+            m_openPreparedQueries.append( queryId );
+        }
+        setError( m_client->lastError() );
+        if ( lastError() ) {
+            return PreparedQuery();
+        }
+        else {
+            return new ClientPreparedQueryBackend( queryId, query, const_cast<ClientModel*>( this ) );
+        }
+    }
+    else {
+        setError( "Not connected to server." );
+        return PreparedQuery();
+    }
+}
+
+
+Soprano::QueryResultIterator Soprano::Client::ClientModel::executePreparedQuery( int id, const BindingSet& bindings ) const
+{
+    if ( m_client ) {
+        int itId = m_client->preparedQueryExecute( id, bindings );
+        if ( itId > 0 ) {
+            QMutexLocker locker( &m_openIteratorsMutex );
+            m_openIterators.append( itId );
+        }
+        setError( m_client->lastError() );
+        if ( lastError() ) {
+            return QueryResultIterator();
+        }
+        else {
+            return new ClientQueryResultIteratorBackend( itId, const_cast<ClientModel*>( this ) );
+        }
+    }
+    else {
+        setError( "Not connected to server." );
+        return QueryResultIterator();
+    }
+}
+
+
+Soprano::NodeIterator Soprano::Client::ClientModel::listContexts( int offset, int limit ) const
+{
+    if ( m_client ) {
+        int itId = m_client->listContexts( m_modelId, offset, limit );
+        if ( itId > 0 ) {
+            QMutexLocker locker( &m_openIteratorsMutex );
+            m_openIterators.append( itId );
+        }
+        setError( m_client->lastError() );
+        if ( lastError() ) {
+            return NodeIterator();
+        }
+        else {
+            return new ClientNodeIteratorBackend( itId, const_cast<ClientModel*>( this ) );
+        }
+    }
+    else {
+        setError( "Not connected to server." );
+        return NodeIterator();
+    }
+}
+
+
 Soprano::StatementIterator Soprano::Client::ClientModel::listStatements( const Statement &partial ) const
 {
     if ( m_client ) {
@@ -141,6 +256,29 @@ Soprano::StatementIterator Soprano::Client::ClientModel::listStatements( const S
 }
 
 
+Soprano::StatementIterator Soprano::Client::ClientModel::listStatements( const Statement &partial, int offset, int limit ) const
+{
+    if ( m_client ) {
+        int itId = m_client->listStatements( m_modelId, partial, offset, limit );
+        if ( itId > 0 ) {
+            QMutexLocker locker( &m_openIteratorsMutex );
+            m_openIterators.append( itId );
+        }
+        setError( m_client->lastError() );
+        if ( lastError() ) {
+            return StatementIterator();
+        }
+        else {
+            return new ClientStatementIteratorBackend( itId, const_cast<ClientModel*>( this ) );
+        }
+    }
+    else {
+        setError( "Not connected to server." );
+        return StatementIterator();
+    }
+}
+
+
 Soprano::Error::ErrorCode Soprano::Client::ClientModel::removeStatement( const Statement &statement )
 {
     if ( m_client ) {
@@ -183,6 +321,48 @@ int Soprano::Client::ClientModel::statementCount() const
 }
 
 
+int Soprano::Client::ClientModel::estimateCount( const Statement& pattern ) const
+{
+    if ( m_client ) {
+        int cnt = m_client->estimateCount( m_modelId, pattern );
+        setError( m_client->lastError() );
+        return cnt;
+    }
+    else {
+        setError( "Not connected to server." );
+        return -1;
+    }
+}
+
+
+QHash<Soprano::Node, int> Soprano::Client::ClientModel::predicateStatistics() const
+{
+    if ( m_client ) {
+        QHash<Node, int> counts = m_client->predicateStatistics( m_modelId );
+        setError( m_client->lastError() );
+        return counts;
+    }
+    else {
+        setError( "Not connected to server." );
+        return QHash<Node, int>();
+    }
+}
+
+
+QHash<Soprano::Node, int> Soprano::Client::ClientModel::contextStatistics() const
+{
+    if ( m_client ) {
+        QHash<Node, int> counts = m_client->contextStatistics( m_modelId );
+        setError( m_client->lastError() );
+        return counts;
+    }
+    else {
+        setError( "Not connected to server." );
+        return QHash<Node, int>();
+    }
+}
+
+
 bool Soprano::Client::ClientModel::containsStatement( const Statement &statement ) const
 {
     if ( m_client ) {
@@ -211,6 +391,20 @@ bool Soprano::Client::ClientModel::containsAnyStatement( const Statement &statem
 }
 
 
+QBitArray Soprano::Client::ClientModel::containsStatements( const QList<Statement>& statements ) const
+{
+    if ( m_client ) {
+        QBitArray bits = m_client->containsStatements( m_modelId, statements );
+        setError( m_client->lastError() );
+        return bits;
+    }
+    else {
+        setError( "Not connected to server." );
+        return QBitArray();
+    }
+}
+
+
 Soprano::Node Soprano::Client::ClientModel::createBlankNode()
 {
     if ( m_client ) {
@@ -241,3 +435,43 @@ void Soprano::Client::ClientModel::closeIterator( int id ) const
     }
 }
 
+
+Soprano::IteratorBackend<Soprano::Node>* Soprano::Client::ClientModel::projectIterator( int id, int column, const QString& bindingName, bool distinct ) const
+{
+    if ( m_client ) {
+        clearError();
+        QMutexLocker locker( &m_openIteratorsMutex );
+        if ( m_openIterators.contains( id ) ) {
+            int itId = m_client->iteratorProject( id, column, bindingName, distinct );
+            setError( m_client->lastError() );
+            if ( itId > 0 ) {
+                // the server moved the iterator into the new one
+                m_openIterators.removeAll( id );
+                m_openIterators.append( itId );
+                return new ClientNodeIteratorBackend( itId, const_cast<ClientModel*>( this ) );
+            }
+        }
+    }
+    else {
+        setError( "Not connected to server." );
+    }
+    return 0;
+}
+
+
+void Soprano::Client::ClientModel::closePreparedQuery( int id ) const
+{
+    if ( m_client ) {
+        clearError();
+        QMutexLocker locker( &m_openIteratorsMutex );
+        if ( m_openPreparedQueries.contains( id ) ) {
+            m_client->preparedQueryClose( id );
+            m_openPreparedQueries.removeAll( id );
+            setError( m_client->lastError() );
+        }
+    }
+    else {
+        setError( "Not connected to server." );
+    }
+}
+
@@ -23,6 +23,7 @@
 #define _SOPRANO_SERVER_CLIENT_MODEL_H_
 
 #include "storagemodel.h"
+#include "iteratorbackend.h"
 
 #include <QtCore/QList>
 #include <QtCore/QMutex>
@@ -43,22 +44,35 @@ namespace Soprano {
 
             Error::ErrorCode addStatement( const Statement &statement );
             NodeIterator listContexts() const;
+            NodeIterator listContexts( int offset, int limit ) const;
             QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const;
+            PreparedQuery prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const;
             StatementIterator listStatements( const Statement &partial ) const;
+            StatementIterator listStatements( const Statement &partial, int offset, int limit ) const;
             Error::ErrorCode removeStatement( const Statement &statement );
             Error::ErrorCode removeAllStatements( const Statement &statement );
             int statementCount() const;
+            int estimateCount( const Statement& pattern ) const;
+            QHash<Node, int> predicateStatistics() const;
+            QHash<Node, int> contextStatistics() const;
             bool containsStatement( const Statement &statement ) const;
             bool containsAnyStatement( const Statement &statement ) const;
+            QBitArray containsStatements( const QList<Statement>& statements ) const;
             Node createBlankNode();
 
             void closeIterator( int id ) const;
+            IteratorBackend<Node>* projectIterator( int id, int column, const QString& bindingName, bool distinct ) const;
+
+            QueryResultIterator executePreparedQuery( int id, const BindingSet& bindings ) const;
+            void closePreparedQuery( int id ) const;
 
             ClientConnection* client() const { return m_client; }
+            int modelId() const { return m_modelId; }
 
         private:
             int m_modelId;
             mutable QList<int> m_openIterators;
+            mutable QList<int> m_openPreparedQueries;
             mutable QMutex m_openIteratorsMutex;
             QPointer<ClientConnection> m_client;
         };
@@ -73,6 +73,23 @@ Soprano::BindingSet Soprano::Client::ClientQueryResultIteratorBackend::current()
 }
 
 
+Soprano::IteratorBackend<Soprano::Node>* Soprano::Client::ClientQueryResultIteratorBackend::projectColumn( int column, const QString& bindingName, bool distinct )
+{
+    if ( m_model ) {
+        IteratorBackend<Node>* nodes = m_model->projectIterator( m_iteratorId, column, bindingName, distinct );
+        if ( nodes ) {
+            // the server iterator now belongs to the node iterator
+            m_iteratorId = 0;
+            m_currentBinding = BindingSet();
+        }
+        return nodes;
+    }
+    else {
+        return 0;
+    }
+}
+
+
 void Soprano::Client::ClientQueryResultIteratorBackend::close()
 {
     if ( m_model ) {
@@ -52,6 +52,7 @@ namespace Soprano
             bool isBinding() const;
             bool isBool() const;
             bool boolValue() const;
+            IteratorBackend<Node>* projectColumn( int column, const QString& bindingName, bool distinct );
 
         private:
             int m_iteratorId;
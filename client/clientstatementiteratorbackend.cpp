@@ -67,6 +67,22 @@ Soprano::Statement Soprano::Client::ClientStatementIteratorBackend::current() co
 }
 
 
+Soprano::IteratorBackend<Soprano::Node>* Soprano::Client::ClientStatementIteratorBackend::projectColumn( int column, const QString& bindingName, bool distinct )
+{
+    if ( m_model ) {
+        IteratorBackend<Node>* nodes = m_model->projectIterator( m_iteratorId, column, bindingName, distinct );
+        if ( nodes ) {
+            // the server iterator now belongs to the node iterator
+            m_iteratorId = 0;
+        }
+        return nodes;
+    }
+    else {
+        return 0;
+    }
+}
+
+
 void Soprano::Client::ClientStatementIteratorBackend::close()
 {
     if ( m_model ) {
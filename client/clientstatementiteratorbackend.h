@@ -43,6 +43,7 @@ namespace Soprano
             bool next();
             Soprano::Statement current() const;
             void close();
+            IteratorBackend<Node>* projectColumn( int column, const QString& bindingName, bool distinct );
 
         private:
             int m_iteratorId;
@@ -27,11 +27,31 @@
 
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
 #include <QtCore/QThread>
+#include <QtCore/QTime>
 #include <QtNetwork/QLocalSocket>
 
+namespace {
+    /// connections which have not been used for this long are closed
+    const int s_idleConnectionTimeout = 60000;
+
+    /// how often we check for idle connections
+    const int s_reapInterval = 10000;
+
+    /// the number of thread to socket assignments we remember
+    const int s_maxThreadSlots = 256;
+}
+
 namespace Soprano {
     namespace Client {
+        /**
+         * A ClientConnection which distributes the requests of different threads over
+         * a pool of sockets. Each thread sticks to one socket while iterators are pinned
+         * to the socket which created them. The first socket is opened in connect(), the
+         * others are opened on demand and closed again once they have been idle for a while.
+         */
         class LocalSocketClientConnection : public ClientConnection
         {
         public:
@@ -42,34 +62,79 @@ namespace Soprano {
                 m_socketPath = path;
             }
 
+            void setMaxConnectionCount( int count );
+            int maxConnectionCount() const;
+
             virtual bool connect();
             virtual bool disconnect();
 
             virtual bool isConnected() {
-                return m_localSocket.isConnected();
+                QMutexLocker lock( &m_poolMutex );
+                return m_sockets.first()->isConnected();
             }
         protected:
-            virtual Socket* getSocket() {
-                return &m_localSocket;
-            }
+            virtual Socket* getSocket();
+            virtual Socket* openCancelSocket();
+            virtual Socket* openSubscriptionSocket();
 
         private:
+            /// called with m_poolMutex locked
+            void reapIdleSockets();
+
             QString m_socketPath;
-            LocalSocket m_localSocket;
+
+            /// m_sockets[0] is the primary socket opened in connect()
+            QList<LocalSocket*> m_sockets;
+            QList<QTime> m_lastUsed;
+            QHash<QThread*, int> m_threadSlots;
+            int m_maxConnectionCount;
+            int m_nextSlot;
+            QTime m_lastReap;
+            mutable QMutex m_poolMutex;
         };
 
         LocalSocketClientConnection::LocalSocketClientConnection( QObject* parent )
-            : ClientConnection( parent )
+            : ClientConnection( parent ),
+              m_maxConnectionCount( 1 ),
+              m_nextSlot( 0 )
         {
+            m_sockets.append( new LocalSocket() );
+            m_lastUsed.append( QTime() );
+            m_lastReap.start();
         }
 
         LocalSocketClientConnection::~LocalSocketClientConnection()
         {
+            qDeleteAll( m_sockets );
+        }
+
+        void LocalSocketClientConnection::setMaxConnectionCount( int count )
+        {
+            QMutexLocker lock( &m_poolMutex );
+            m_maxConnectionCount = qMax( 1, count );
+
+            // threads bound to a slot which does not exist anymore get a new one on their next request
+            QHash<QThread*, int>::iterator it = m_threadSlots.begin();
+            while ( it != m_threadSlots.end() ) {
+                if ( it.value() >= m_maxConnectionCount )
+                    it = m_threadSlots.erase( it );
+                else
+                    ++it;
+            }
+        }
+
+        int LocalSocketClientConnection::maxConnectionCount() const
+        {
+            QMutexLocker lock( &m_poolMutex );
+            return m_maxConnectionCount;
         }
 
         bool LocalSocketClientConnection::connect()
         {
-            if( m_localSocket.isConnected() ) {
+            QMutexLocker lock( &m_poolMutex );
+
+            LocalSocket* socket = m_sockets.first();
+            if( socket->isConnected() ) {
                 setError( "Already connected" );
                 return false;
             }
@@ -78,21 +143,132 @@ namespace Soprano {
                 m_socketPath = QDir::homePath() + QLatin1String( "/.soprano/socket" );
             }
 
-            if ( !m_localSocket.open( m_socketPath ) ) {
-                setError( m_localSocket.lastError() );
+            if ( !socket->open( m_socketPath ) ) {
+                setError( socket->lastError() );
                 return false;
             }
+            m_lastUsed[0].start();
 
             return true;
         }
 
+        Socket* LocalSocketClientConnection::getSocket()
+        {
+            QMutexLocker lock( &m_poolMutex );
+
+            if ( m_lastReap.elapsed() > s_reapInterval ) {
+                reapIdleSockets();
+                m_lastReap.start();
+            }
+
+            LocalSocket* primary = m_sockets.first();
+            if ( m_maxConnectionCount == 1 || !primary->isConnected() ) {
+                // without a primary connection we are disconnected and there is no point in opening others
+                m_lastUsed[0].start();
+                return primary;
+            }
+
+            QThread* thread = QThread::currentThread();
+            QHash<QThread*, int>::const_iterator it = m_threadSlots.constFind( thread );
+            int slot = 0;
+            if ( it != m_threadSlots.constEnd() ) {
+                slot = it.value();
+            }
+            else {
+                // we never learn about finished threads, thus forget them from time to time
+                if ( m_threadSlots.count() > s_maxThreadSlots )
+                    m_threadSlots.clear();
+                slot = m_nextSlot;
+                m_nextSlot = ( m_nextSlot + 1 ) % m_maxConnectionCount;
+                m_threadSlots.insert( thread, slot );
+            }
+
+            while ( m_sockets.count() <= slot ) {
+                m_sockets.append( new LocalSocket() );
+                m_lastUsed.append( QTime() );
+            }
+
+            LocalSocket* socket = m_sockets[slot];
+            if ( !socket->isConnected() && !socket->open( m_socketPath ) ) {
+                // the server might have reached its connection limit, fall back to the primary socket
+                qDebug() << "(LocalSocketClientConnection) failed to open pooled connection:" << socket->lastError().message();
+                m_threadSlots.insert( thread, 0 );
+                m_lastUsed[0].start();
+                return primary;
+            }
+
+            m_lastUsed[slot].start();
+            return socket;
+        }
+
+        void LocalSocketClientConnection::reapIdleSockets()
+        {
+            // never close the primary socket, it defines the connection state
+            for ( int i = 1; i < m_sockets.count(); ++i ) {
+                LocalSocket* socket = m_sockets[i];
+                if ( !socket->isConnected() ||
+                     ( i < m_maxConnectionCount && m_lastUsed[i].elapsed() <= s_idleConnectionTimeout ) ) {
+                    continue;
+                }
+
+                // A locked socket is running a command. We never block here since that
+                // would block the getSocket() calls of all threads.
+                if ( !socket->tryLock() )
+                    continue;
+
+                // the iterators are pinned while the socket is locked, thus the check is only reliable now
+                const qint64 idle = socket->idleTime();
+                const bool reap = ( i >= m_maxConnectionCount || idle < 0 || idle > s_idleConnectionTimeout ) &&
+                                  !hasOpenIterators( socket );
+                if ( reap )
+                    socket->close();
+                socket->unlock();
+
+                if ( reap ) {
+                    // the threads using the socket are distributed anew
+                    QHash<QThread*, int>::iterator it = m_threadSlots.begin();
+                    while ( it != m_threadSlots.end() ) {
+                        if ( it.value() == i )
+                            it = m_threadSlots.erase( it );
+                        else
+                            ++it;
+                    }
+                }
+            }
+        }
+
+        Socket* LocalSocketClientConnection::openCancelSocket()
+        {
+            LocalSocket* socket = new LocalSocket();
+            if ( !socket->open( m_socketPath ) ) {
+                setError( socket->lastError() );
+                delete socket;
+                return 0;
+            }
+            return socket;
+        }
+
+        Socket* LocalSocketClientConnection::openSubscriptionSocket()
+        {
+            // the same as the cancel socket: a plain connection which is not part of the pool
+            return openCancelSocket();
+        }
+
         bool LocalSocketClientConnection::disconnect()
         {
-            if( m_localSocket.isConnected() ) {
-                m_localSocket.close();
-                return true;
+            closeSubscriptionSocket();
+
+            QMutexLocker lock( &m_poolMutex );
+
+            bool wasConnected = m_sockets.first()->isConnected();
+            Q_FOREACH( LocalSocket* socket, m_sockets ) {
+                socket->lock();
+                socket->close();
+                socket->unlock();
             }
-            return false;
+            m_threadSlots.clear();
+            clearOpenIterators();
+            return wasConnected;
         }
     }
 }
@@ -112,6 +288,8 @@ Soprano::Client::LocalSocketClient::LocalSocketClient( QObject* parent )
     : QObject( parent ),
       d( new Private() )
 {
+    QObject::connect( &d->connection, SIGNAL(changesReceived(int,QList<Soprano::Statement>,QList<Soprano::Statement>)),
+                      this, SIGNAL(statementsChanged(int,QList<Soprano::Statement>,QList<Soprano::Statement>)) );
 }
 
 
@@ -172,6 +350,44 @@ Soprano::Model* Soprano::Client::LocalSocketClient::createModel( const QString&
 }
 
 
+void Soprano::Client::LocalSocketClient::setRequestTimeout( int msecs )
+{
+    d->connection.setRequestTimeout( msecs );
+}
+
+
+int Soprano::Client::LocalSocketClient::requestTimeout() const
+{
+    return d->connection.requestTimeout();
+}
+
+
+void Soprano::Client::LocalSocketClient::setMaxConnectionCount( int count )
+{
+    d->connection.setMaxConnectionCount( count );
+}
+
+
+int Soprano::Client::LocalSocketClient::maxConnectionCount() const
+{
+    return d->connection.maxConnectionCount();
+}
+
+
+bool Soprano::Client::LocalSocketClient::cancelRunningRequest()
+{
+    if ( d->connection.isConnected() ) {
+        bool cancelled = d->connection.cancelRunningRequest();
+        setError( d->connection.lastError() );
+        return cancelled;
+    }
+    else {
+        setError( "Not connected" );
+        return false;
+    }
+}
+
+
 void Soprano::Client::LocalSocketClient::removeModel( const QString& name )
 {
     if ( d->connection.isConnected() ) {
@@ -183,3 +399,30 @@ void Soprano::Client::LocalSocketClient::removeModel( const QString& name )
     }
 }
 
+
+
+int Soprano::Client::LocalSocketClient::subscribe( Model* model, const QList<Statement>& patterns )
+{
+    ClientModel* clientModel = qobject_cast<ClientModel*>( model );
+    if ( !clientModel || clientModel->client() != &d->connection ) {
+        setError( "The model has not been created by this client", Error::ErrorInvalidArgument );
+        return 0;
+    }
+
+    if ( d->connection.isConnected() ) {
+        int id = d->connection.subscribe( clientModel->modelId(), patterns );
+        setError( d->connection.lastError() );
+        return id;
+    }
+    else {
+        setError( "Not connected" );
+        return 0;
+    }
+}
+
+
+void Soprano::Client::LocalSocketClient::unsubscribe( int subscriptionId )
+{
+    d->connection.unsubscribe( subscriptionId );
+    setError( d->connection.lastError() );
+}
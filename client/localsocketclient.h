@@ -27,6 +27,7 @@
 
 #include "error.h"
 #include "backend.h"
+#include "statement.h"
 #include "soprano_export.h"
 
 // FIXME: add signals for conection and disconnection, maybe even make it async as Qt's network stuff itself
@@ -47,8 +48,8 @@ namespace Soprano {
          * Models creates by this client are thread-safe and provide faster access to the server
          * than D-Bus communication.
          *
-         * \warning The LocalSocketClient does not support signals. Thus, the models created
-         * by it will not emit signals such as Model::statementAdded.
+         * \warning The models created by the LocalSocketClient do not emit signals such as
+         * Model::statementAdded. Changes can be tracked through subscribe() instead.
          *
          * \author Sebastian Trueg <trueg@kde.org>
          *
@@ -102,6 +103,99 @@ namespace Soprano {
              */
             void removeModel( const QString& name );
 
+            /**
+             * Attach a deadline to all requests sent by the models created by this
+             * client. The server will abort requests which exceed the deadline
+             * and report an Error::ErrorTimeout if the backend supports it.
+             *
+             * \param msecs The deadline in milliseconds. 0 disables the deadline,
+             * which is the default.
+             *
+             * \since 2.10
+             */
+            void setRequestTimeout( int msecs );
+
+            /**
+             * \return The deadline set via setRequestTimeout().
+             *
+             * \since 2.10
+             */
+            int requestTimeout() const;
+
+            /**
+             * Set the maximum number of connections this client opens to the server.
+             * By default all models created by this client share one connection which
+             * serializes the requests of all threads. With a bigger pool each thread
+             * is bound to one of the connections and iterators stay on the connection
+             * that created them. Additional connections are opened on demand and closed
+             * again after one minute without use.
+             *
+             * \param count The maximum number of connections, at least 1, which is the default.
+             *
+             * \since 2.10
+             */
+            void setMaxConnectionCount( int count );
+
+            /**
+             * \return The maximum number of connections set via setMaxConnectionCount().
+             *
+             * \since 2.10
+             */
+            int maxConnectionCount() const;
+
+            /**
+             * Cancel the query currently running on the server on behalf of this client.
+             * Since the connection is blocked by the running query this method is meant
+             * to be called from another thread. The cancel command itself is sent through
+             * a separate connection.
+             *
+             * \return \p true if a request has been cancelled, \p false if no request was
+             * running or the backend does not support cancellation.
+             *
+             * \since 2.10
+             */
+            bool cancelRunningRequest();
+
+            /**
+             * Subscribe to the changes of the statements in \p model which match one of
+             * \p patterns. Empty nodes in the patterns act as wildcards. The server matches
+             * the changes against the patterns and sends them in batches which are reported
+             * through statementsChanged(). A statement which is added and removed again
+             * within one batch is not reported at all.
+             *
+             * The changes are received through a separate connection to the server and
+             * delivered by the event loop of the thread the client lives in. Subscriptions
+             * can only be managed from that thread.
+             *
+             * \param model A model created by this client.
+             * \param patterns The statement patterns to match.
+             *
+             * \return The id of the new subscription or 0 on error.
+             *
+             * \since 2.10
+             */
+            int subscribe( Model* model, const QList<Statement>& patterns );
+
+            /**
+             * End the subscription \p subscriptionId created via subscribe().
+             *
+             * \since 2.10
+             */
+            void unsubscribe( int subscriptionId );
+
+        Q_SIGNALS:
+            /**
+             * Emitted with the batched changes of the subscription \p subscriptionId.
+             *
+             * \param subscriptionId The id returned by subscribe().
+             * \param added The added statements matching the subscription.
+             * \param removed The removed statements matching the subscription. Some backends
+             * report removals by pattern, thus, the statements may contain empty nodes.
+             *
+             * \since 2.10
+             */
+            void statementsChanged( int subscriptionId, const QList<Soprano::Statement>& added, const QList<Soprano::Statement>& removed );
+
         public Q_SLOTS:
             /**
              * Tries to connect to the %Soprano server.
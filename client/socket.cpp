@@ -167,6 +167,13 @@ qint64 Soprano::Socket::write( const char* buffer, qint64 size )
 void Soprano::Socket::lock()
 {
     m_mutex.lock();
+    m_lastUse.start();
+}
+
+
+bool Soprano::Socket::tryLock()
+{
+    return m_mutex.tryLock();
 }
 
 
@@ -176,6 +183,12 @@ void Soprano::Socket::unlock()
 }
 
 
+qint64 Soprano::Socket::idleTime() const
+{
+    return m_lastUse.isValid() ? m_lastUse.elapsed() : -1;
+}
+
+
 
 Soprano::LocalSocket::LocalSocket()
 {
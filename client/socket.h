@@ -25,6 +25,7 @@
 #include "error.h"
 
 #include <QtCore/QMutex>
+#include <QtCore/QElapsedTimer>
 
 typedef int SOCKET_HANDLE;
 
@@ -63,9 +64,22 @@ namespace Soprano {
         /// lock the socket (no other thread can use it)
         void lock();
 
+        /**
+         * lock the socket if no other thread is using it. In contrast to lock()
+         * this does not count as using the socket, see idleTime().
+         */
+        bool tryLock();
+
         /// unlock the socket
         void unlock();
 
+        /**
+         * The time in milliseconds since the socket has last been locked via lock()
+         * or -1 if it has never been used. Only meaningful while the socket is
+         * locked by the caller.
+         */
+        qint64 idleTime() const;
+
     protected:
         /**
          * Open the socket with the last config. Used
@@ -79,6 +93,7 @@ namespace Soprano {
 
     private:
         QMutex m_mutex;
+        QElapsedTimer m_lastUse;
     };
 
     class LocalSocket : public Socket
@@ -30,8 +30,13 @@
 #include "languagetag.h"
 #include <qdebug.h>
 
+#include <QtCore/QMutexLocker>
+
 Soprano::SocketStream::SocketStream( Soprano::Socket* dev )
-    : m_device( dev )
+    : m_device( dev ),
+      m_runningRequestId( 0 ),
+      m_requestId( 0 ),
+      m_requestMutex( 0 )
 {
     m_device->lock();
 }
@@ -39,10 +44,23 @@ Soprano::SocketStream::SocketStream( Soprano::Socket* dev )
 
 Soprano::SocketStream::~SocketStream()
 {
+    if ( m_runningRequestId ) {
+        QMutexLocker lock( m_requestMutex );
+        if ( *m_runningRequestId == m_requestId )
+            *m_runningRequestId = 0;
+    }
     m_device->unlock();
 }
 
 
+void Soprano::SocketStream::setRunningRequest( quint32 id, quint32* runningRequestId, QMutex* mutex )
+{
+    m_requestId = id;
+    m_runningRequestId = runningRequestId;
+    m_requestMutex = mutex;
+}
+
+
 bool Soprano::SocketStream::read( char* data, qint64 size )
 {
     if( size <= 0 )
@@ -43,12 +43,25 @@ namespace Soprano {
         SocketStream( Socket* dev );
         ~SocketStream();
 
+        Socket* socket() const { return m_device; }
+
+        /**
+         * Reset \p runningRequestId to 0 once the stream is destroyed, ie. the command
+         * has been answered, unless it does not contain \p id anymore. \p mutex
+         * protects \p runningRequestId.
+         */
+        void setRunningRequest( quint32 id, quint32* runningRequestId, QMutex* mutex );
+
     protected:
         virtual bool read( char* data, qint64 size );
         virtual bool write( const char* data, qint64 size );
 
     private:
         Socket* m_device;
+
+        quint32* m_runningRequestId;
+        quint32 m_requestId;
+        QMutex* m_requestMutex;
     };
 }
 
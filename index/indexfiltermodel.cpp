@@ -24,6 +24,7 @@
 #include "cluceneindex.h"
 #include "queryhitwrapperresultiteratorbackend.h"
 #include "queryresultiterator.h"
+#include "preparedquery.h"
 #include "statementiterator.h"
 #include "qurlhash.h"
 
@@ -165,29 +166,40 @@ Soprano::Error::ErrorCode Soprano::Index::IndexFilterModel::removeStatement( con
 
 
 Soprano::Error::ErrorCode Soprano::Index::IndexFilterModel::removeAllStatements( const Soprano::Statement& statement )
+{
+    takeAllStatements( statement );
+    return Error::convertErrorCode( lastError().code() );
+}
+
+
+QList<Soprano::Statement> Soprano::Index::IndexFilterModel::takeAllStatements( const Soprano::Statement& statement )
 {
     // here we simply ignore the indexOnlyPredicates
 
     // since we use backends that directly implement this method we don't know which
     // statements are actually removed (there is no signal for that)
-    // so we have to check that up front
+    // so we let the parent model report them
     // FIXME: can we handle this is the CLuceneIndex?
-    Soprano::StatementIterator it = parentModel()->listStatements( statement );
-    while ( it.next() ) {
-        Statement s = *it;
+    const QList<Statement> removedStatements = parentModel()->takeAllStatements( statement );
+    if ( parentModel()->lastError() ) {
+        setError( parentModel()->lastError() );
+        return QList<Statement>();
+    }
+
+    Q_FOREACH( const Statement& s, removedStatements ) {
         if ( d->indexStatement( s ) ) {
             d->startTransaction();
-            Error::ErrorCode c = d->index->removeStatement( *it );
+            Error::ErrorCode c = d->index->removeStatement( s );
             d->closeTransaction();
             if ( c != Error::ErrorNone ) {
                 setError( d->index->lastError() );
-                return c;
+                return removedStatements;
             }
         }
     }
-    it.close();
 
-    return FilterModel::removeAllStatements( statement );
+    clearError();
+    return removedStatements;
 }
 
 
@@ -215,6 +227,18 @@ Soprano::QueryResultIterator Soprano::Index::IndexFilterModel::executeQuery( con
 }
 
 
+Soprano::PreparedQuery Soprano::Index::IndexFilterModel::prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    if ( language == Query::QueryLanguageUser && userQueryLanguage.toLower() == "lucene" ) {
+        // the parent does not know about lucene, thus, we go through our own executeQuery
+        return Model::prepareQuery( query, language, userQueryLanguage );
+    }
+    else {
+        return FilterModel::prepareQuery( query, language, userQueryLanguage );
+    }
+}
+
+
 void Soprano::Index::IndexFilterModel::setTransactionCacheSize( int size )
 {
     d->transactionCacheSize = qMax( 1, size );
@@ -115,6 +115,13 @@ namespace Soprano {
              */
             Soprano::Error::ErrorCode removeAllStatements( const Soprano::Statement &statement );
 
+            /**
+             * Removes statements and returns them.
+             *
+             * This will remove the statements from the index and then forward the call to the parent model.
+             */
+            QList<Soprano::Statement> takeAllStatements( const Soprano::Statement &statement );
+
             /**
              * The IndexFilterModel is currently based on CLucene. While the index itself is available
              * via index() and allows querying via CLucene queries it is not available over the 
@@ -141,6 +148,14 @@ namespace Soprano {
              */
             QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
 
+            /**
+             * CLucene queries are prepared by substituting the bound values into the
+             * query string, all other queries are prepared by the parent model.
+             *
+             * \since 2.10
+             */
+            PreparedQuery prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+
             /*
              * Extract full text matching parts of a %query and replace them with
              * results from an index %query.
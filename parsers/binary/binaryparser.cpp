@@ -0,0 +1,405 @@
+/*
+ * This file is part of Soprano Project
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "binaryparser.h"
+#include "binaryrdfformat.h"
+
+#include "node.h"
+#include "statement.h"
+#include "statementiterator.h"
+#include "iteratorbackend.h"
+#include "literalvalue.h"
+#include "sopranotypes.h"
+
+#include <QtCore/QtPlugin>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+#include <QtCore/QVector>
+#include <QtCore/QDateTime>
+#include <QtCore/QtEndian>
+
+#include <string.h>
+#include <limits>
+
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+Q_EXPORT_PLUGIN2(soprano_binaryparser, Soprano::BinaryParser)
+#endif
+
+using namespace Soprano::BinaryRdf;
+
+namespace {
+    /**
+     * Bounds-checked little endian reader over the raw data.
+     */
+    class Reader
+    {
+    public:
+        Reader( const uchar* data, const uchar* end )
+            : m_pos( data ),
+              m_end( end ),
+              m_ok( true ) {
+        }
+
+        bool ok() const { return m_ok; }
+
+        quint32 readUInt32() {
+            if ( m_end - m_pos < 4 ) {
+                m_ok = false;
+                return 0;
+            }
+            const quint32 v = qFromLittleEndian<quint32>( m_pos );
+            m_pos += 4;
+            return v;
+        }
+
+        quint64 readUInt64() {
+            if ( m_end - m_pos < 8 ) {
+                m_ok = false;
+                return 0;
+            }
+            const quint64 v = qFromLittleEndian<quint64>( m_pos );
+            m_pos += 8;
+            return v;
+        }
+
+        /// \return a pointer into the data, not a copy
+        const char* readBytes( int* len ) {
+            const quint32 size = readUInt32();
+            // check in 64 bit before padding, paddedSize() would overflow for sizes close to INT_MAX
+            if ( !m_ok || quint64( size ) + 3 > quint64( m_end - m_pos ) ) {
+                m_ok = false;
+                *len = 0;
+                return 0;
+            }
+            const char* p = reinterpret_cast<const char*>( m_pos );
+            *len = int( size );
+            m_pos += paddedSize( *len );
+            return p;
+        }
+
+    private:
+        const uchar* m_pos;
+        const uchar* m_end;
+        bool m_ok;
+    };
+
+
+    Soprano::LiteralValue decodeTypedValue( ValueEncoding encoding, quint64 raw, const QUrl& dataType )
+    {
+        QVariant v;
+        switch( encoding ) {
+        case Int32Value:
+            v = int( quint32( raw ) );
+            break;
+        case UInt32Value:
+            v = uint( raw );
+            break;
+        case Int64Value:
+            v = qlonglong( raw );
+            break;
+        case UInt64Value:
+            v = qulonglong( raw );
+            break;
+        case BoolValue:
+            v = bool( raw != 0 );
+            break;
+        case DoubleValue: {
+            double d;
+            memcpy( &d, &raw, sizeof( d ) );
+            v = d;
+            break;
+        }
+        case DateTimeValue:
+            v = QDateTime::fromMSecsSinceEpoch( qint64( raw ) ).toUTC();
+            break;
+        default:
+            return Soprano::LiteralValue();
+        }
+        return Soprano::LiteralValue::fromVariant( v, dataType );
+    }
+
+
+    class BinaryStatementIteratorBackend : public Soprano::IteratorBackend<Soprano::Statement>
+    {
+    public:
+        BinaryStatementIteratorBackend( QFile* file, const QByteArray& buffer,
+                                        const QVector<Soprano::Node>& nodes,
+                                        const uchar* columns, quint32 count )
+            : m_file( file ),
+              m_buffer( buffer ),
+              m_nodes( nodes ),
+              m_columns( columns ),
+              m_count( count ),
+              m_pos( -1 ) {
+        }
+
+        ~BinaryStatementIteratorBackend() {
+            close();
+        }
+
+        bool next() {
+            clearError();
+            if ( m_columns && m_pos + 1 < qint64( m_count ) ) {
+                ++m_pos;
+                return true;
+            }
+            else {
+                close();
+                return false;
+            }
+        }
+
+        Soprano::Statement current() const {
+            if ( m_columns && m_pos >= 0 ) {
+                return Soprano::Statement( m_nodes[column( 0 )],
+                                           m_nodes[column( 1 )],
+                                           m_nodes[column( 2 )],
+                                           m_nodes[column( 3 )] );
+            }
+            else {
+                return Soprano::Statement();
+            }
+        }
+
+        void close() {
+            clearError();
+            m_columns = 0;
+            m_nodes.clear();
+            m_buffer.clear();
+            delete m_file;
+            m_file = 0;
+        }
+
+    private:
+        quint32 column( int c ) const {
+            return qFromLittleEndian<quint32>( m_columns + ( qint64( c ) * m_count + m_pos ) * 4 );
+        }
+
+        QFile* m_file;
+        QByteArray m_buffer;
+        QVector<Soprano::Node> m_nodes;
+        const uchar* m_columns;
+        quint32 m_count;
+        qint64 m_pos;
+    };
+}
+
+
+Soprano::BinaryParser::BinaryParser()
+    : QObject(),
+      Parser( "binary" )
+{
+}
+
+
+Soprano::BinaryParser::~BinaryParser()
+{
+}
+
+
+Soprano::RdfSerializations Soprano::BinaryParser::supportedSerializations() const
+{
+    return SerializationUser;
+}
+
+
+QStringList Soprano::BinaryParser::supportedUserSerializations() const
+{
+    return QStringList() << BinaryRdf::mimeType();
+}
+
+
+Soprano::StatementIterator Soprano::BinaryParser::parseFile( const QString& filename,
+                                                             const QUrl& baseUri,
+                                                             RdfSerialization serialization,
+                                                             const QString& userSerialization ) const
+{
+    Q_UNUSED( baseUri );
+
+    clearError();
+
+    if ( !supportsSerialization( serialization, userSerialization ) ) {
+        setError( "Unsupported serialization " + serializationMimeType( serialization, userSerialization ),
+                  Error::ErrorInvalidArgument );
+        return 0;
+    }
+
+    QFile* file = new QFile( filename );
+    if ( !file->open( QIODevice::ReadOnly ) ) {
+        setError( QString( "Could not open file %1: %2" ).arg( filename, file->errorString() ),
+                  Error::ErrorInvalidArgument );
+        delete file;
+        return 0;
+    }
+
+    if ( uchar* data = file->map( 0, file->size() ) ) {
+        return parseData( data, file->size(), file, QByteArray() );
+    }
+    else {
+        // mapping is not supported for all files, fall back to reading
+        const QByteArray buffer = file->readAll();
+        delete file;
+        return parseData( reinterpret_cast<const uchar*>( buffer.constData() ), buffer.size(), 0, buffer );
+    }
+}
+
+
+Soprano::StatementIterator Soprano::BinaryParser::parseStream( QTextStream& stream,
+                                                               const QUrl& baseUri,
+                                                               RdfSerialization serialization,
+                                                               const QString& userSerialization ) const
+{
+    Q_UNUSED( baseUri );
+
+    clearError();
+
+    if ( !supportsSerialization( serialization, userSerialization ) ) {
+        setError( "Unsupported serialization " + serializationMimeType( serialization, userSerialization ),
+                  Error::ErrorInvalidArgument );
+        return 0;
+    }
+
+    if ( !stream.device() ) {
+        setError( "Binary RDF data can only be read from a stream operating on a QIODevice", Error::ErrorInvalidArgument );
+        return 0;
+    }
+
+    const QByteArray buffer = stream.device()->readAll();
+    return parseData( reinterpret_cast<const uchar*>( buffer.constData() ), buffer.size(), 0, buffer );
+}
+
+
+Soprano::StatementIterator Soprano::BinaryParser::parseData( const uchar* data, qint64 size, QFile* file, const QByteArray& buffer ) const
+{
+    const uchar* end = data + size;
+
+    //
+    // Read and verify the header
+    //
+    if ( size < s_headerSize || memcmp( data, s_magic, sizeof( s_magic ) ) != 0 ) {
+        setError( "Not a binary RDF file", Error::ErrorParsingFailed );
+        delete file;
+        return 0;
+    }
+
+    Reader headerReader( data + sizeof( s_magic ), end );
+    Header header;
+    header.version = headerReader.readUInt32();
+    headerReader.readUInt32(); // reserved flags
+    header.nodeCount = headerReader.readUInt32();
+    header.statementCount = headerReader.readUInt32();
+    header.nodeTableOffset = headerReader.readUInt64();
+    header.quadTableOffset = headerReader.readUInt64();
+
+    if ( header.version != s_formatVersion ) {
+        setError( QString( "Unsupported binary RDF format version %1" ).arg( header.version ), Error::ErrorParsingFailed );
+        delete file;
+        return 0;
+    }
+    if ( header.nodeTableOffset > quint64( size ) ||
+         header.quadTableOffset > quint64( size ) ||
+         header.nodeTableOffset > header.quadTableOffset ||
+         quint64( size ) - header.quadTableOffset < quint64( header.statementCount ) * 16 ) {
+        setError( "Truncated binary RDF data", Error::ErrorParsingFailed );
+        delete file;
+        return 0;
+    }
+
+    // each node record takes at least 8 bytes, check the count before allocating the table
+    if ( quint64( header.nodeCount ) > ( header.quadTableOffset - header.nodeTableOffset ) / 8 ||
+         header.nodeCount >= quint32( std::numeric_limits<int>::max() ) ) {
+        setError( "Invalid node count in binary RDF data", Error::ErrorParsingFailed );
+        delete file;
+        return 0;
+    }
+
+    //
+    // Decode the node table. This is the only place where strings are converted.
+    //
+    QVector<Node> nodes( header.nodeCount + 1 );
+    Reader reader( data + header.nodeTableOffset, data + header.quadTableOffset );
+    for ( quint32 id = 1; id <= header.nodeCount && reader.ok(); ++id ) {
+        const quint32 tag = reader.readUInt32();
+        int len = 0;
+        switch( tag & 0xFF ) {
+        case Node::ResourceNode: {
+            const char* p = reader.readBytes( &len );
+            nodes[id] = Node( QUrl::fromEncoded( QByteArray::fromRawData( p, len ), QUrl::StrictMode ) );
+            break;
+        }
+        case Node::BlankNode: {
+            const char* p = reader.readBytes( &len );
+            nodes[id] = Node( QString::fromUtf8( p, len ) );
+            break;
+        }
+        case Node::LiteralNode: {
+            const quint32 dataTypeId = reader.readUInt32();
+            const char* lang = reader.readBytes( &len );
+            const QString language = QString::fromUtf8( lang, len );
+            if ( dataTypeId >= id ) {
+                setError( QString( "Invalid forward datatype reference in node %1" ).arg( id ), Error::ErrorParsingFailed );
+                delete file;
+                return 0;
+            }
+
+            const ValueEncoding encoding = ValueEncoding( ( tag >> 8 ) & 0xFF );
+            if ( encoding == LexicalValue ) {
+                const char* p = reader.readBytes( &len );
+                const QString value = QString::fromUtf8( p, len );
+                if ( dataTypeId == 0 ) {
+                    nodes[id] = Node( LiteralValue::createPlainLiteral( value, language ) );
+                }
+                else {
+                    nodes[id] = Node( LiteralValue::fromString( value, nodes[dataTypeId].uri() ) );
+                }
+            }
+            else {
+                nodes[id] = Node( decodeTypedValue( encoding, reader.readUInt64(), nodes[dataTypeId].uri() ) );
+            }
+            break;
+        }
+        default:
+            setError( QString( "Invalid node type in node %1" ).arg( id ), Error::ErrorParsingFailed );
+            delete file;
+            return 0;
+        }
+    }
+    if ( !reader.ok() ) {
+        setError( "Truncated binary RDF node table", Error::ErrorParsingFailed );
+        delete file;
+        return 0;
+    }
+
+    //
+    // Verify the quad columns once so the iterator does not need to
+    //
+    const uchar* columns = data + header.quadTableOffset;
+    const quint64 idCount = quint64( header.statementCount ) * 4;
+    for ( quint64 i = 0; i < idCount; ++i ) {
+        if ( qFromLittleEndian<quint32>( columns + i * 4 ) > header.nodeCount ) {
+            setError( "Invalid node reference in binary RDF quad table", Error::ErrorParsingFailed );
+            delete file;
+            return 0;
+        }
+    }
+
+    return new BinaryStatementIteratorBackend( file, buffer, nodes, columns, header.statementCount );
+}
@@ -0,0 +1,12 @@
+[Desktop Entry]
+Encoding=UTF-8
+X-Soprano-Library=soprano_binaryparser
+X-Soprano-Plugin-Author=Soprano Developers
+X-Soprano-Plugin-Website=http://soprano.sourceforge.net
+X-Soprano-Plugin-License=GPL
+X-Soprano-Plugin-Version=1.0
+X-Soprano-Version=${SOPRANO_VERSION_STRING}
+Type=Service
+ServiceTypes=Soprano/Parser
+Name=Binary RDF Parser
+Comment=Soprano parser plugin that memory maps binary RDF snapshots as created by the binary serializer plugin
@@ -0,0 +1,74 @@
+/*
+ * This file is part of Soprano Project
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_BINARY_PARSER_H_
+#define _SOPRANO_BINARY_PARSER_H_
+
+#include <QtCore/QUrl>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+#include "parser.h"
+
+class QFile;
+
+namespace Soprano {
+    /**
+     * Parser for the compact binary snapshot format described in
+     * binaryrdfformat.h.
+     *
+     * parseFile() memory maps the file and decodes each distinct node
+     * exactly once. The resulting iterator then only resolves integer
+     * ids from the mapped quad columns.
+     */
+    class BinaryParser : public QObject, public Soprano::Parser
+    {
+        Q_OBJECT
+        Q_INTERFACES(Soprano::Parser)
+
+    public:
+        BinaryParser();
+        ~BinaryParser();
+
+        RdfSerializations supportedSerializations() const;
+        QStringList supportedUserSerializations() const;
+
+        StatementIterator parseFile( const QString& filename,
+                                     const QUrl& baseUri,
+                                     RdfSerialization serialization,
+                                     const QString& userSerialization = QString() ) const;
+
+        StatementIterator parseStream( QTextStream&,
+                                       const QUrl& baseUri,
+                                       RdfSerialization serialization,
+                                       const QString& userSerialization = QString() ) const;
+
+    private:
+        /**
+         * Decode the data in \p data. Ownership of \p file (which may be 0) is
+         * transferred to the returned iterator. \p buffer is kept alive for
+         * the lifetime of the iterator.
+         */
+        StatementIterator parseData( const uchar* data, qint64 size, QFile* file, const QByteArray& buffer ) const;
+    };
+}
+
+#endif
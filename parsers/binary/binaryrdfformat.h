@@ -0,0 +1,95 @@
+/*
+ * This file is part of Soprano Project
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_BINARY_RDF_FORMAT_H_
+#define _SOPRANO_BINARY_RDF_FORMAT_H_
+
+#include <QtCore/QtGlobal>
+#include <QtCore/QString>
+
+/*
+ * Layout of the binary RDF snapshot format shared by the binary parser
+ * and serializer plugins. All integers are stored little endian.
+ *
+ * \code
+ * Header            8 byte magic, quint32 version, quint32 reserved flags,
+ *                   quint32 nodeCount, quint32 statementCount,
+ *                   quint64 nodeTableOffset, quint64 quadTableOffset
+ * Node table        nodeCount records, each 4 byte aligned
+ * Quad columns      4 x statementCount quint32 node ids in the order
+ *                   subject, predicate, object, context
+ * \endcode
+ *
+ * Node id 0 always refers to the empty node and is not stored in the
+ * node table, thus the first record has id 1. Records reference each other
+ * only backwards (a literal's datatype always has a smaller id) which allows
+ * decoding the table in a single pass.
+ *
+ * Node records:
+ * \code
+ * Resource:  quint32 tag, quint32 length, encoded URI bytes
+ * Blank:     quint32 tag, quint32 length, UTF-8 identifier bytes
+ * Literal:   quint32 tag, quint32 datatype id (0 for plain literals),
+ *            quint32 length, language bytes,
+ *            value (quint32 length + UTF-8 bytes for LexicalValue, 8 bytes otherwise)
+ * \endcode
+ *
+ * The low byte of the tag is the Soprano::Node::Type, the second byte one of
+ * ValueEncoding. Byte arrays are padded to a multiple of 4.
+ *
+ * The quads are sorted by context, subject, predicate, and object ids.
+ */
+namespace Soprano {
+    namespace BinaryRdf {
+        const char s_magic[8] = { 'S', 'O', 'P', 'R', 'B', 'R', 'D', 'F' };
+        const quint32 s_formatVersion = 1;
+        const int s_headerSize = 40;
+
+        enum ValueEncoding {
+            LexicalValue = 0,
+            Int32Value = 1,
+            UInt32Value = 2,
+            Int64Value = 3,
+            UInt64Value = 4,
+            BoolValue = 5,
+            DoubleValue = 6,
+            DateTimeValue = 7 /**< msecs since epoch (UTC) */
+        };
+
+        struct Header {
+            quint32 version;
+            quint32 nodeCount;
+            quint32 statementCount;
+            quint64 nodeTableOffset;
+            quint64 quadTableOffset;
+        };
+
+        inline QString mimeType() {
+            return QString::fromLatin1( "application/x-soprano-binary-rdf" );
+        }
+
+        inline int paddedSize( int size ) {
+            return ( size + 3 ) & ~3;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,301 @@
+/*
+ * This file is part of Soprano Project
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "binaryserializer.h"
+#include "binaryrdfformat.h"
+
+#include "node.h"
+#include "statement.h"
+#include "statementiterator.h"
+#include "literalvalue.h"
+#include "sopranotypes.h"
+
+#include <QtCore/QtPlugin>
+#include <QtCore/QTextStream>
+#include <QtCore/QIODevice>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+#include <QtCore/QDateTime>
+#include <QtCore/QtEndian>
+#include <QtCore/QtAlgorithms>
+
+#include <algorithm>
+#include <string.h>
+
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+Q_EXPORT_PLUGIN2(soprano_binaryserializer, Soprano::BinarySerializer)
+#endif
+
+using namespace Soprano::BinaryRdf;
+
+namespace {
+    struct Quad {
+        quint32 s;
+        quint32 p;
+        quint32 o;
+        quint32 c;
+
+        bool operator<( const Quad& other ) const {
+            if ( c != other.c ) return c < other.c;
+            if ( s != other.s ) return s < other.s;
+            if ( p != other.p ) return p < other.p;
+            return o < other.o;
+        }
+
+        bool operator==( const Quad& other ) const {
+            return s == other.s && p == other.p && o == other.o && c == other.c;
+        }
+    };
+
+    void appendUInt32( QByteArray& a, quint32 v )
+    {
+        uchar buf[4];
+        qToLittleEndian( v, buf );
+        a.append( reinterpret_cast<const char*>( buf ), 4 );
+    }
+
+    void appendUInt64( QByteArray& a, quint64 v )
+    {
+        uchar buf[8];
+        qToLittleEndian( v, buf );
+        a.append( reinterpret_cast<const char*>( buf ), 8 );
+    }
+
+    void appendBytes( QByteArray& a, const QByteArray& data )
+    {
+        appendUInt32( a, data.size() );
+        a.append( data );
+        a.append( QByteArray( paddedSize( data.size() ) - data.size(), '\0' ) );
+    }
+
+    /**
+     * Builds the node dictionary and the encoded node table in one go.
+     */
+    class NodeTable
+    {
+    public:
+        NodeTable()
+            : m_nextId( 1 ) {
+        }
+
+        quint32 id( const Soprano::Node& node );
+
+        quint32 count() const { return m_nextId - 1; }
+        const QByteArray& data() const { return m_data; }
+
+    private:
+        void encodeLiteral( const Soprano::LiteralValue& value );
+
+        QHash<Soprano::Node, quint32> m_ids;
+        QByteArray m_data;
+        quint32 m_nextId;
+    };
+
+    quint32 NodeTable::id( const Soprano::Node& node )
+    {
+        if ( node.isEmpty() ) {
+            return 0;
+        }
+
+        QHash<Soprano::Node, quint32>::const_iterator it = m_ids.constFind( node );
+        if ( it != m_ids.constEnd() ) {
+            return it.value();
+        }
+
+        switch( node.type() ) {
+        case Soprano::Node::ResourceNode:
+            appendUInt32( m_data, Soprano::Node::ResourceNode );
+            appendBytes( m_data, node.uri().toEncoded() );
+            break;
+        case Soprano::Node::BlankNode:
+            appendUInt32( m_data, Soprano::Node::BlankNode );
+            appendBytes( m_data, node.identifier().toUtf8() );
+            break;
+        case Soprano::Node::LiteralNode:
+            // encodeLiteral might add the datatype to the table first which is
+            // what guarantees backwards-only references
+            encodeLiteral( node.literal() );
+            break;
+        default:
+            return 0;
+        }
+
+        const quint32 newId = m_nextId++;
+        m_ids.insert( node, newId );
+        return newId;
+    }
+
+    void NodeTable::encodeLiteral( const Soprano::LiteralValue& value )
+    {
+        if ( value.isPlain() ) {
+            appendUInt32( m_data, Soprano::Node::LiteralNode | ( LexicalValue << 8 ) );
+            appendUInt32( m_data, 0 );
+            appendBytes( m_data, value.language().toString().toUtf8() );
+            appendBytes( m_data, value.toString().toUtf8() );
+            return;
+        }
+
+        const quint32 dataTypeId = id( Soprano::Node( value.dataTypeUri() ) );
+
+        ValueEncoding encoding = LexicalValue;
+        quint64 raw = 0;
+        switch( value.type() ) {
+        case QVariant::Int:
+            encoding = Int32Value;
+            raw = quint32( value.toInt() );
+            break;
+        case QVariant::UInt:
+            encoding = UInt32Value;
+            raw = value.toUnsignedInt();
+            break;
+        case QVariant::LongLong:
+            encoding = Int64Value;
+            raw = quint64( value.toInt64() );
+            break;
+        case QVariant::ULongLong:
+            encoding = UInt64Value;
+            raw = value.toUnsignedInt64();
+            break;
+        case QVariant::Bool:
+            encoding = BoolValue;
+            raw = value.toBool() ? 1 : 0;
+            break;
+        case QVariant::Double: {
+            encoding = DoubleValue;
+            const double d = value.toDouble();
+            memcpy( &raw, &d, sizeof( raw ) );
+            break;
+        }
+        case QVariant::DateTime:
+            encoding = DateTimeValue;
+            raw = quint64( value.toDateTime().toMSecsSinceEpoch() );
+            break;
+        default:
+            break;
+        }
+
+        appendUInt32( m_data, Soprano::Node::LiteralNode | ( encoding << 8 ) );
+        appendUInt32( m_data, dataTypeId );
+        appendBytes( m_data, QByteArray() );
+        if ( encoding == LexicalValue ) {
+            appendBytes( m_data, value.toString().toUtf8() );
+        }
+        else {
+            appendUInt64( m_data, raw );
+        }
+    }
+}
+
+
+Soprano::BinarySerializer::BinarySerializer()
+    : QObject(),
+      Serializer( "binary" )
+{
+}
+
+
+Soprano::BinarySerializer::~BinarySerializer()
+{
+}
+
+
+Soprano::RdfSerializations Soprano::BinarySerializer::supportedSerializations() const
+{
+    return SerializationUser;
+}
+
+
+QStringList Soprano::BinarySerializer::supportedUserSerializations() const
+{
+    return QStringList() << BinaryRdf::mimeType();
+}
+
+
+bool Soprano::BinarySerializer::serialize( StatementIterator it,
+                                           QTextStream& stream,
+                                           RdfSerialization serialization,
+                                           const QString& userSerialization ) const
+{
+    clearError();
+
+    if ( !supportsSerialization( serialization, userSerialization ) ) {
+        setError( "Unsupported serialization " + serializationMimeType( serialization, userSerialization ),
+                  Error::ErrorInvalidArgument );
+        return false;
+    }
+
+    QIODevice* device = stream.device();
+    if ( !device ) {
+        setError( "Binary serialization requires a stream operating on a QIODevice", Error::ErrorInvalidArgument );
+        return false;
+    }
+
+    NodeTable nodes;
+    QVector<Quad> quads;
+    while ( it.next() ) {
+        const Statement s = *it;
+        Quad q;
+        q.s = nodes.id( s.subject() );
+        q.p = nodes.id( s.predicate() );
+        q.o = nodes.id( s.object() );
+        q.c = nodes.id( s.context() );
+        quads.append( q );
+    }
+    if ( it.lastError() ) {
+        setError( it.lastError() );
+        return false;
+    }
+
+    qSort( quads.begin(), quads.end() );
+    quads.erase( std::unique( quads.begin(), quads.end() ), quads.end() );
+
+    QByteArray header( s_magic, sizeof( s_magic ) );
+    appendUInt32( header, s_formatVersion );
+    appendUInt32( header, 0 );
+    appendUInt32( header, nodes.count() );
+    appendUInt32( header, quads.count() );
+    appendUInt64( header, s_headerSize );
+    appendUInt64( header, s_headerSize + nodes.data().size() );
+    Q_ASSERT( header.size() == s_headerSize );
+
+    QByteArray columns;
+    columns.reserve( quads.count() * 16 );
+    for ( int i = 0; i < quads.count(); ++i )
+        appendUInt32( columns, quads[i].s );
+    for ( int i = 0; i < quads.count(); ++i )
+        appendUInt32( columns, quads[i].p );
+    for ( int i = 0; i < quads.count(); ++i )
+        appendUInt32( columns, quads[i].o );
+    for ( int i = 0; i < quads.count(); ++i )
+        appendUInt32( columns, quads[i].c );
+
+    // make sure nothing written through the text stream ends up in between
+    stream.flush();
+
+    if ( device->write( header ) != header.size() ||
+         device->write( nodes.data() ) != nodes.data().size() ||
+         device->write( columns ) != columns.size() ) {
+        setError( "Failed to write binary RDF data: " + device->errorString(), Error::ErrorUnknown );
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,12 @@
+[Desktop Entry]
+Encoding=UTF-8
+X-Soprano-Library=soprano_binaryserializer
+X-Soprano-Plugin-Author=Soprano Developers
+X-Soprano-Plugin-Website=http://soprano.sourceforge.net
+X-Soprano-Plugin-License=GPL
+X-Soprano-Plugin-Version=1.0
+X-Soprano-Version=${SOPRANO_VERSION_STRING}
+Type=Service
+ServiceTypes=Soprano/Serializer
+Name=Binary RDF Serializer
+Comment=Soprano serializer plugin that writes compact dictionary encoded binary RDF snapshots
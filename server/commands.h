@@ -35,7 +35,38 @@
 // Protocol version 5:
 //     Soprano 2.9
 //     Literal values are now sent in their native types
-#define PROTOCOL_VERSION 5
+// Protocol version 6:
+//     Soprano 2.10
+//     New commands COMMAND_REQUEST_OPTIONS and COMMAND_CANCEL_REQUEST,
+//     version 5 clients are still supported
+// Protocol version 7:
+//     Soprano 2.10
+//     New commands COMMAND_MODEL_PREPARE_QUERY, COMMAND_PREPARED_QUERY_EXECUTE,
+//     and COMMAND_PREPARED_QUERY_CLOSE, version 5 and 6 clients are still supported
+// Protocol version 8:
+//     Soprano 2.10
+//     New command COMMAND_ITERATOR_CURRENT_BINDING_VALUES which sends the binding
+//     names only once per iterator, older clients are still supported
+// Protocol version 9:
+//     Soprano 2.10
+//     New commands COMMAND_MODEL_SUBSCRIBE and COMMAND_MODEL_UNSUBSCRIBE. The
+//     server pushes SUBSCRIPTION_CHANGES messages on connections with subscriptions,
+//     older clients are still supported
+// Protocol version 10:
+//     Soprano 2.10
+//     New commands COMMAND_MODEL_ESTIMATE_COUNT, COMMAND_MODEL_PREDICATE_STATISTICS,
+//     and COMMAND_MODEL_CONTEXT_STATISTICS, older clients are still supported
+// Protocol version 11:
+//     Soprano 2.10
+//     New commands COMMAND_MODEL_LIST_STATEMENTS_PAGE and COMMAND_MODEL_LIST_CONTEXTS_PAGE,
+//     older clients are still supported
+// Protocol version 12:
+//     Soprano 2.10
+//     New command COMMAND_ITERATOR_PROJECT, older clients are still supported
+// Protocol version 13:
+//     Soprano 2.10
+//     New command COMMAND_MODEL_CONTAINS_STATEMENTS, older clients are still supported
+#define PROTOCOL_VERSION 13
 
 namespace Soprano {
     namespace Server {
@@ -61,6 +92,26 @@ namespace Soprano {
         const quint16 COMMAND_SUPPORTS_PROTOCOL_VERSION = 0x20;
         const quint16 COMMAND_MODEL_CREATE_BLANK_NODE = 0x21;
         const quint16 COMMAND_REMOVE_MODEL = 0x22;
+        const quint16 COMMAND_REQUEST_OPTIONS = 0x23; /**< Sets the deadline for the following command, replies with the request id assigned by the server. */
+        const quint16 COMMAND_CANCEL_REQUEST = 0x24;
+        const quint16 COMMAND_MODEL_PREPARE_QUERY = 0x25;
+        const quint16 COMMAND_PREPARED_QUERY_EXECUTE = 0x26; /**< Replies with a query iterator id. */
+        const quint16 COMMAND_PREPARED_QUERY_CLOSE = 0x27;
+        const quint16 COMMAND_ITERATOR_CURRENT_BINDING_VALUES = 0x28; /**< The binding schema is only sent if it changed. */
+        const quint16 COMMAND_MODEL_SUBSCRIBE = 0x29; /**< Replies with a SUBSCRIPTION_REPLY message. */
+        const quint16 COMMAND_MODEL_UNSUBSCRIBE = 0x2A; /**< Replies with a SUBSCRIPTION_REPLY message. */
+        const quint16 COMMAND_MODEL_ESTIMATE_COUNT = 0x2B;
+        const quint16 COMMAND_MODEL_PREDICATE_STATISTICS = 0x2C; /**< Replies with the number of entries followed by node and count pairs. */
+        const quint16 COMMAND_MODEL_CONTEXT_STATISTICS = 0x2D; /**< Same reply as COMMAND_MODEL_PREDICATE_STATISTICS. */
+        const quint16 COMMAND_MODEL_LIST_STATEMENTS_PAGE = 0x2E; /**< The pattern followed by offset and limit, replies with an iterator id. */
+        const quint16 COMMAND_MODEL_LIST_CONTEXTS_PAGE = 0x2F; /**< Offset and limit, replies with an iterator id. */
+        const quint16 COMMAND_ITERATOR_PROJECT = 0x30; /**< Moves a statement or query iterator into a node iterator over one column, replies with its id. */
+        const quint16 COMMAND_MODEL_CONTAINS_STATEMENTS = 0x31; /**< Replies with the number of bits followed by the bits packed into a byte array. */
+
+        // Messages sent by the server on connections with subscriptions. They can arrive
+        // at any time, thus, such connections should not be used for other commands.
+        const quint16 SUBSCRIPTION_REPLY = 0x1; /**< The subscription id and an error. */
+        const quint16 SUBSCRIPTION_CHANGES = 0x2; /**< The subscription id followed by the lists of added and removed statements. */
     }
 }
 
@@ -21,13 +21,101 @@
 
 #include "modelpool.h"
 #include "servercore.h"
+#include "serverconnection.h"
 #include "randomgenerator.h"
+#include "subscriptionindex.h"
 
 #include "model.h"
+#include "statement.h"
+#include "requestcontext.h"
 
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
 #include <QtCore/QHash>
 #include <QtCore/QMutex>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QThreadStorage>
+
+
+namespace {
+    /// the pattern passed to Model::removeAllStatements() by ModelPool::removeAllStatements() in this thread
+    typedef QThreadStorage<Soprano::Statement*> RemovalPatternStorage;
+    Q_GLOBAL_STATIC( RemovalPatternStorage, s_removalPattern )
+
+    /**
+     * Backends may report a removal by pattern instead of the removed statements. A statement
+     * without subject, predicate, or object is always such a pattern. A complete statement with an
+     * empty context is a statement in the default graph unless it is the pattern currently removed.
+     */
+    bool isRemovalPattern( const Soprano::Statement& statement ) {
+        if ( !statement.isValid() )
+            return true;
+        if ( statement.context().isValid() )
+            return false;
+        const Soprano::Statement* pattern = s_removalPattern()->localData();
+        return pattern && *pattern == statement;
+    }
+}
+
+
+namespace Soprano {
+    namespace Server {
+        /**
+         * Forwards the changes of one model to the matching subscriptions.
+         * The slots are called directly in the thread which changed the model.
+         */
+        class ChangeDispatcher : public QObject
+        {
+            Q_OBJECT
+
+        public:
+            ChangeDispatcher( Model* model )
+                : m_model( model ) {
+                connect( model, SIGNAL(statementAdded(Soprano::Statement)),
+                         this, SLOT(slotStatementAdded(Soprano::Statement)),
+                         Qt::DirectConnection );
+                connect( model, SIGNAL(statementRemoved(Soprano::Statement)),
+                         this, SLOT(slotStatementRemoved(Soprano::Statement)),
+                         Qt::DirectConnection );
+            }
+
+            /**
+             * Disconnect from the model and wait for a running dispatch to finish
+             * before the dispatcher is deleted.
+             */
+            void detach() {
+                if ( m_model )
+                    m_model->disconnect( this );
+                QMutexLocker lock( &mutex );
+            }
+
+            SubscriptionIndex index;
+            QHash<quint32, ServerConnection*> connections;
+            QMutex mutex;
+
+        private Q_SLOTS:
+            void slotStatementAdded( const Soprano::Statement& statement ) {
+                dispatch( statement, true );
+            }
+
+            void slotStatementRemoved( const Soprano::Statement& statement ) {
+                dispatch( statement, false );
+            }
+
+        private:
+            void dispatch( const Statement& statement, bool added ) {
+                QMutexLocker lock( &mutex );
+                if ( index.isEmpty() )
+                    return;
+                Q_FOREACH( quint32 id, index.matchingSubscriptions( statement, !added && isRemovalPattern( statement ) ) ) {
+                    connections[id]->queueChange( id, statement, added );
+                }
+            }
+
+            QPointer<Model> m_model;
+        };
+    }
+}
 
 
 class Soprano::Server::ModelPool::Private
@@ -40,6 +128,38 @@ public:
 
     QMutex mutex;
 
+    QHash<quint32, RequestContext> requests;
+    QMutex requestMutex;
+
+    /// one dispatcher per model id, created with the first subscription
+    QHash<quint32, ChangeDispatcher*> dispatchers;
+    QHash<quint32, ChangeDispatcher*> subscriptions;
+    QMutex subscriptionMutex;
+
+    quint32 generateUniqueSubscriptionId() {
+        quint32 id = 0;
+        do {
+            id = RandomGenerator::instance()->randomInt();
+        } while ( id == 0 || subscriptions.contains( id ) );
+        return id;
+    }
+
+    /// called with subscriptionMutex locked
+    void removeDispatcher( quint32 modelId ) {
+        ChangeDispatcher* dispatcher = dispatchers.take( modelId );
+        if ( dispatcher ) {
+            dispatcher->detach();
+            QHash<quint32, ChangeDispatcher*>::iterator it = subscriptions.begin();
+            while ( it != subscriptions.end() ) {
+                if ( it.value() == dispatcher )
+                    it = subscriptions.erase( it );
+                else
+                    ++it;
+            }
+            delete dispatcher;
+        }
+    }
+
     quint32 generateUniqueId() {
         quint32 id = 0;
         do {
@@ -59,6 +179,10 @@ Soprano::Server::ModelPool::ModelPool( ServerCore* core )
 
 Soprano::Server::ModelPool::~ModelPool()
 {
+    Q_FOREACH( ChangeDispatcher* dispatcher, d->dispatchers ) {
+        dispatcher->detach();
+        delete dispatcher;
+    }
     delete d;
 }
 
@@ -104,7 +228,128 @@ quint32 Soprano::Server::ModelPool::idForModelName( const QString& name )
 
 void Soprano::Server::ModelPool::removeModel( const QString& name )
 {
-    QMutexLocker locker( &d->mutex );
-    d->modelIdMap.remove( d->modelNameMap[name] );
-    d->modelNameMap.remove( name );
+    quint32 id = 0;
+    {
+        QMutexLocker locker( &d->mutex );
+        id = d->modelNameMap.value( name );
+        d->modelIdMap.remove( id );
+        d->modelNameMap.remove( name );
+    }
+
+    // the subscriptions of the model simply do not receive any more changes
+    QMutexLocker locker( &d->subscriptionMutex );
+    d->removeDispatcher( id );
+}
+
+
+quint32 Soprano::Server::ModelPool::registerRequest( const RequestContext& context )
+{
+    QMutexLocker locker( &d->requestMutex );
+    quint32 id = 0;
+    do {
+        id = RandomGenerator::instance()->randomInt();
+    } while ( id == 0 || d->requests.contains( id ) );
+    d->requests.insert( id, context );
+    return id;
+}
+
+
+void Soprano::Server::ModelPool::unregisterRequest( quint32 id )
+{
+    QMutexLocker locker( &d->requestMutex );
+    d->requests.remove( id );
 }
+
+
+bool Soprano::Server::ModelPool::cancelRequest( quint32 id )
+{
+    // do not call cancel() with the lock held, the cancel handlers might block
+    RequestContext context;
+    {
+        QMutexLocker locker( &d->requestMutex );
+        context = d->requests.value( id );
+    }
+
+    if ( context.isValid() ) {
+        context.cancel();
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+
+Soprano::Error::ErrorCode Soprano::Server::ModelPool::removeAllStatements( Model* model, const Statement& pattern )
+{
+    s_removalPattern()->setLocalData( new Statement( pattern ) );
+    const Error::ErrorCode result = model->removeAllStatements( pattern );
+    s_removalPattern()->setLocalData( 0 );
+    return result;
+}
+
+
+quint32 Soprano::Server::ModelPool::subscribe( quint32 modelId, const QList<Statement>& patterns, ServerConnection* connection )
+{
+    Model* model = modelById( modelId );
+    if ( !model )
+        return 0;
+
+    QMutexLocker locker( &d->subscriptionMutex );
+
+    ChangeDispatcher* dispatcher = d->dispatchers.value( modelId );
+    if ( !dispatcher ) {
+        dispatcher = new ChangeDispatcher( model );
+        d->dispatchers.insert( modelId, dispatcher );
+    }
+
+    const quint32 id = d->generateUniqueSubscriptionId();
+    d->subscriptions.insert( id, dispatcher );
+
+    QMutexLocker dispatcherLocker( &dispatcher->mutex );
+    dispatcher->index.addSubscription( id, patterns );
+    dispatcher->connections.insert( id, connection );
+
+    return id;
+}
+
+
+bool Soprano::Server::ModelPool::unsubscribe( quint32 id, ServerConnection* connection )
+{
+    QMutexLocker locker( &d->subscriptionMutex );
+
+    ChangeDispatcher* dispatcher = d->subscriptions.value( id );
+    if ( !dispatcher )
+        return false;
+
+    QMutexLocker dispatcherLocker( &dispatcher->mutex );
+    if ( dispatcher->connections.value( id ) != connection )
+        return false;
+
+    dispatcher->index.removeSubscription( id );
+    dispatcher->connections.remove( id );
+    d->subscriptions.remove( id );
+    return true;
+}
+
+
+void Soprano::Server::ModelPool::unsubscribeAll( ServerConnection* connection )
+{
+    QMutexLocker locker( &d->subscriptionMutex );
+
+    QHash<quint32, ChangeDispatcher*>::iterator it = d->subscriptions.begin();
+    while ( it != d->subscriptions.end() ) {
+        ChangeDispatcher* dispatcher = it.value();
+        QMutexLocker dispatcherLocker( &dispatcher->mutex );
+        if ( dispatcher->connections.value( it.key() ) == connection ) {
+            dispatcher->index.removeSubscription( it.key() );
+            dispatcher->connections.remove( it.key() );
+            it = d->subscriptions.erase( it );
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+#include "modelpool.moc"
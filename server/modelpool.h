@@ -22,15 +22,20 @@
 #ifndef _SOPRANO_MODEL_POOL_H_
 #define _SOPRANO_MODEL_POOL_H_
 
-#include <qglobal.h>
+#include <QtCore/QList>
+
+#include "error.h"
 
 namespace Soprano {
 
     class Model;
+    class RequestContext;
+    class Statement;
 
     namespace Server {
 
         class ServerCore;
+        class ServerConnection;
 
         /**
          * The ModelPool serves as a bridge between the ServerCore
@@ -42,6 +47,15 @@ namespace Soprano {
          * in a multi-threaded environment and model ids, thus, need to be
          * unique.
          *
+         * For the same reason the pool also keeps track of the requests in
+         * flight: a request blocks its own connection, thus, it can only be
+         * cancelled through another one.
+         *
+         * Finally, the pool dispatches the changes of its models to the
+         * subscriptions of all connections. Each model has one SubscriptionIndex
+         * which is consulted for each added or removed statement in the
+         * thread that changed the model.
+         *
          * \author Sebastian Trueg <trueg@kde.org>
          */
         class ModelPool
@@ -68,6 +82,52 @@ namespace Soprano {
              */
             void removeModel( const QString& name );
 
+            /**
+             * Make the request \p context known to all connections.
+             *
+             * \return The id of the request which is unique among all requests
+             * in flight and hard to guess for other clients.
+             */
+            quint32 registerRequest( const RequestContext& context );
+            void unregisterRequest( quint32 id );
+
+            /**
+             * Cancel the request \p id.
+             *
+             * \return \p true if the request was in flight.
+             */
+            bool cancelRequest( quint32 id );
+
+            /**
+             * Remove all statements matching \p pattern from \p model. Backends may
+             * report such a removal by the pattern instead of the removed statements.
+             * Removing through the pool allows the change dispatch to tell a reported
+             * pattern with an empty context from a removed statement in the default graph.
+             */
+            Error::ErrorCode removeAllStatements( Model* model, const Statement& pattern );
+
+            /**
+             * Subscribe \p connection to the changes of the statements matching
+             * \p patterns in the model \p modelId. Matching changes are handed to
+             * ServerConnection::queueChange() from the thread which changed the model.
+             *
+             * \return The id of the new subscription or 0 if the model does not exist.
+             */
+            quint32 subscribe( quint32 modelId, const QList<Statement>& patterns, ServerConnection* connection );
+
+            /**
+             * Remove the subscription \p id if it belongs to \p connection.
+             *
+             * \return \p true if the subscription existed.
+             */
+            bool unsubscribe( quint32 id, ServerConnection* connection );
+
+            /**
+             * Remove all subscriptions of \p connection. Once this method returns
+             * no more changes are queued in \p connection.
+             */
+            void unsubscribeAll( ServerConnection* connection );
+
         private:
             class Private;
             Private* const d;
@@ -23,10 +23,10 @@
 #include "serverdatastream.h"
 #include "servercore.h"
 #include "commands.h"
-#include "randomgenerator.h"
 #include "modelpool.h"
 
 #include "queryresultiterator.h"
+#include "preparedquery.h"
 #include "node.h"
 #include "nodeiterator.h"
 #include "literalvalue.h"
@@ -36,11 +36,19 @@
 #include "backend.h"
 #include "error.h"
 #include "bindingset.h"
+#include "bindingschema.h"
+#include "requestcontext.h"
 
 #include <QtCore/QHash>
+#include <QtCore/QAtomicInt>
 #include <QtCore/QDebug>
 #include <QtCore/QThread>
 #include <QtCore/QTime>
+#include <QtCore/QTimer>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+
+#include <limits>
 
 Q_DECLARE_METATYPE(Soprano::Error::ErrorCode)
 Q_DECLARE_METATYPE(Soprano::Node)
@@ -48,6 +56,17 @@ Q_DECLARE_METATYPE(Soprano::StatementIterator)
 Q_DECLARE_METATYPE(Soprano::NodeIterator)
 Q_DECLARE_METATYPE(Soprano::QueryResultIterator)
 
+namespace {
+    /// the time changes are collected before they are sent to the subscribers
+    const int s_changeBatchInterval = 100;
+
+    /**
+     * Iterator and prepared query ids are unique across all connections. A client
+     * with several pooled connections can thus identify them by id alone.
+     */
+    QAtomicInt s_nextId( 1 );
+}
+
 
 class Soprano::Server::ServerConnection::Private
 {
@@ -58,19 +77,40 @@ public:
 
     quint16 currentCommand;
 
+    // set via COMMAND_REQUEST_OPTIONS for the following command
+    quint32 pendingRequestId;
+    RequestContext pendingContext;
+
     QHash<quint32, StatementIterator> openStatementIterators;
     QHash<quint32, NodeIterator> openNodeIterators;
     QHash<quint32, QueryResultIterator> openQueryIterators;
+    QHash<quint32, PreparedQuery> openPreparedQueries;
+
+    /// the context of the request which created an iterator, it also applies to the commands on the iterator
+    QHash<quint32, RequestContext> iteratorContexts;
+
+    /// the binding schema last sent to the client for a query iterator
+    QHash<quint32, BindingSchema> sentBindingSchemas;
+
+    /// changes queued for the subscriptions of this connection, true for added statements
+    QHash<quint32, QHash<Statement, bool> > pendingChanges;
+    bool changeFlushScheduled;
+    QMutex changeMutex;
+    QTimer* changeTimer;
 
     void _s_readNextCommand();
+    void _s_flushChanges();
 
     quint32 generateUniqueId();
     Soprano::Model* getModel();
     quint32 mapIterator( const StatementIterator& it );
     quint32 mapIterator( const NodeIterator& it );
     quint32 mapIterator( const QueryResultIterator& it );
+    RequestContext iteratorContext( quint32 id ) const;
 
     void supportsProtocolVersion();
+    void readRequestOptions();
+    void cancelRequest();
 
     void createModel();
     void removeModel();
@@ -79,19 +119,31 @@ public:
     void removeStatement();
     void removeAllStatements();
     void listStatements();
+    void listStatementsPage();
     void containsStatement();
     void containsAnyStatement();
+    void containsStatements();
     void listContexts();
+    void listContextsPage();
     void statementCount();
+    void estimateCount();
+    void statistics( quint16 command );
     void isEmpty();
     void query();
+    void prepareQuery();
+    void preparedQueryExecute();
+    void preparedQueryClose();
     void createBlankNode();
+    void subscribe();
+    void unsubscribe();
 
     void iteratorNext();
     void statementIteratorCurrent();
     void nodeIteratorCurrent();
     void queryIteratorCurrent();
+    void queryIteratorCurrentValues();
     void iteratorClose();
+    void iteratorProject();
     void queryIteratorCurrentStatement();
     void queryIteratorType();
     void queryIteratorBoolValue();
@@ -112,6 +164,19 @@ Soprano::Server::ServerConnection::ServerConnection( ModelPool* pool, ServerCore
     d->modelPool = pool;
     d->socket = 0;
     d->currentCommand = 0;
+    d->pendingRequestId = 0;
+    d->changeFlushScheduled = false;
+
+    // Changes are queued from the threads changing the models as soon as the
+    // connection subscribed. Thus, the timer has to exist for the whole lifetime
+    // of the connection. It lives in the connection thread.
+    d->changeTimer = new QTimer();
+    d->changeTimer->setSingleShot( true );
+    d->changeTimer->setInterval( s_changeBatchInterval );
+    d->changeTimer->moveToThread( this );
+    connect( d->changeTimer, SIGNAL(timeout()),
+             this, SLOT(_s_flushChanges()),
+             Qt::DirectConnection );
 }
 
 
@@ -123,6 +188,8 @@ Soprano::Server::ServerConnection::~ServerConnection()
     quit();
     wait();
 
+    // the thread is done, thus nobody uses the timer anymore
+    delete d->changeTimer;
     delete d;
 }
 
@@ -134,6 +201,26 @@ void Soprano::Server::ServerConnection::close()
 }
 
 
+void Soprano::Server::ServerConnection::queueChange( quint32 subscriptionId, const Statement& statement, bool added )
+{
+    QMutexLocker lock( &d->changeMutex );
+
+    // a statement which is added and removed again within one batch is not reported at all
+    QHash<Statement, bool>& changes = d->pendingChanges[subscriptionId];
+    QHash<Statement, bool>::iterator it = changes.find( statement );
+    if ( it != changes.end() && it.value() != added )
+        changes.erase( it );
+    else
+        changes.insert( statement, added );
+
+    if ( !d->changeFlushScheduled ) {
+        d->changeFlushScheduled = true;
+        // the timer lives in the connection thread
+        QMetaObject::invokeMethod( d->changeTimer, "start", Qt::QueuedConnection );
+    }
+}
+
+
 void Soprano::Server::ServerConnection::run()
 {
     // we are in the new thread
@@ -154,10 +241,26 @@ void Soprano::Server::ServerConnection::run()
 
     qDebug() << Q_FUNC_INFO << "thread done.";
 
+    // no changes can be queued after this
+    d->modelPool->unsubscribeAll( this );
+    d->changeTimer->stop();
+    d->changeMutex.lock();
+    d->pendingChanges.clear();
+    d->changeMutex.unlock();
+
     // cleanup open iterators
     d->openStatementIterators.clear();
     d->openNodeIterators.clear();
     d->openQueryIterators.clear();
+    d->openPreparedQueries.clear();
+    d->iteratorContexts.clear();
+    d->sentBindingSchemas.clear();
+
+    // options sent right before the client disconnected
+    if ( d->pendingRequestId ) {
+        d->modelPool->unregisterRequest( d->pendingRequestId );
+        d->pendingRequestId = 0;
+    }
 
     delete d->socket;
     d->socket = 0;
@@ -172,7 +275,25 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
     DataStream stream( socket );
     quint16 command = 0;
     stream.readUnsignedInt16( command );
+
+    if ( command == COMMAND_REQUEST_OPTIONS ) {
+        readRequestOptions();
+
+        // the actual command is typically sent right along with the options
+        if ( socket->bytesAvailable() <= 0 )
+            return;
+        stream.readUnsignedInt16( command );
+    }
+
     currentCommand = command;
+
+    // The request context is installed for the backends and can be cancelled through
+    // other connections. Requests without options do not need one.
+    const quint32 requestId = pendingRequestId;
+    RequestScope scope( pendingContext );
+    pendingRequestId = 0;
+    pendingContext = RequestContext();
+
     switch( command ) {
     case COMMAND_ITERATOR_NEXT:
         iteratorNext();
@@ -182,6 +303,10 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
         queryIteratorCurrent();
         break;
 
+    case COMMAND_ITERATOR_CURRENT_BINDING_VALUES:
+        queryIteratorCurrentValues();
+        break;
+
     case COMMAND_SUPPORTS_PROTOCOL_VERSION:
         supportsProtocolVersion();
         break;
@@ -214,6 +339,10 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
         listStatements();
         break;
 
+    case COMMAND_MODEL_LIST_STATEMENTS_PAGE:
+        listStatementsPage();
+        break;
+
     case COMMAND_MODEL_CONTAINS_STATEMENT:
         containsStatement();
         break;
@@ -222,14 +351,31 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
         containsAnyStatement();
         break;
 
+    case COMMAND_MODEL_CONTAINS_STATEMENTS:
+        containsStatements();
+        break;
+
     case COMMAND_MODEL_LIST_CONTEXTS:
         listContexts();
         break;
 
+    case COMMAND_MODEL_LIST_CONTEXTS_PAGE:
+        listContextsPage();
+        break;
+
     case COMMAND_MODEL_STATEMENT_COUNT:
         statementCount();
         break;
 
+    case COMMAND_MODEL_ESTIMATE_COUNT:
+        estimateCount();
+        break;
+
+    case COMMAND_MODEL_PREDICATE_STATISTICS:
+    case COMMAND_MODEL_CONTEXT_STATISTICS:
+        statistics( command );
+        break;
+
     case COMMAND_MODEL_IS_EMPTY:
         isEmpty();
         break;
@@ -238,6 +384,18 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
         query();
         break;
 
+    case COMMAND_MODEL_PREPARE_QUERY:
+        prepareQuery();
+        break;
+
+    case COMMAND_PREPARED_QUERY_EXECUTE:
+        preparedQueryExecute();
+        break;
+
+    case COMMAND_PREPARED_QUERY_CLOSE:
+        preparedQueryClose();
+        break;
+
     case COMMAND_ITERATOR_CURRENT_STATEMENT:
         statementIteratorCurrent();
         break;
@@ -250,6 +408,10 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
         iteratorClose();
         break;
 
+    case COMMAND_ITERATOR_PROJECT:
+        iteratorProject();
+        break;
+
     case COMMAND_ITERATOR_QUERY_TYPE:
         queryIteratorType();
         break;
@@ -262,6 +424,18 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
         createBlankNode();
         break;
 
+    case COMMAND_CANCEL_REQUEST:
+        cancelRequest();
+        break;
+
+    case COMMAND_MODEL_SUBSCRIBE:
+        subscribe();
+        break;
+
+    case COMMAND_MODEL_UNSUBSCRIBE:
+        unsubscribe();
+        break;
+
     default:
         // FIXME: handle an error
         // for now we just close the connection on error.
@@ -270,6 +444,9 @@ void Soprano::Server::ServerConnection::Private::_s_readNextCommand()
         break;
     }
 
+    if ( requestId )
+        modelPool->unregisterRequest( requestId );
+
     currentCommand = 0;
 }
 
@@ -290,10 +467,13 @@ quint32 Soprano::Server::ServerConnection::Private::generateUniqueId()
 {
     quint32 id = 0;
     do {
-        id = RandomGenerator::instance()->randomInt();
-    } while ( openStatementIterators.contains( id ) ||
+        // clients use signed ids and 0 to signal an error
+        id = quint32( s_nextId.fetchAndAddRelaxed( 1 ) ) & 0x7FFFFFFF;
+    } while ( id == 0 ||
+              openStatementIterators.contains( id ) ||
               openNodeIterators.contains( id ) ||
-              openQueryIterators.contains( id ) );
+              openQueryIterators.contains( id ) ||
+              openPreparedQueries.contains( id ) );
     return id;
 }
 
@@ -302,6 +482,9 @@ quint32 Soprano::Server::ServerConnection::Private::mapIterator( const Statement
 {
     quint32 id = generateUniqueId();
     openStatementIterators.insert( id, it );
+    const RequestContext context = RequestContext::current();
+    if ( context.isValid() )
+        iteratorContexts.insert( id, context );
     return id;
 }
 
@@ -310,6 +493,9 @@ quint32 Soprano::Server::ServerConnection::Private::mapIterator( const NodeItera
 {
     quint32 id = generateUniqueId();
     openNodeIterators.insert( id, it );
+    const RequestContext context = RequestContext::current();
+    if ( context.isValid() )
+        iteratorContexts.insert( id, context );
     return id;
 }
 
@@ -318,10 +504,24 @@ quint32 Soprano::Server::ServerConnection::Private::mapIterator( const QueryResu
 {
     quint32 id = generateUniqueId();
     openQueryIterators.insert( id, it );
+    const RequestContext context = RequestContext::current();
+    if ( context.isValid() )
+        iteratorContexts.insert( id, context );
     return id;
 }
 
 
+Soprano::RequestContext Soprano::Server::ServerConnection::Private::iteratorContext( quint32 id ) const
+{
+    // options sent along with the command take precedence
+    const RequestContext context = RequestContext::current();
+    if ( context.isValid() )
+        return context;
+    else
+        return iteratorContexts.value( id );
+}
+
+
 void Soprano::Server::ServerConnection::Private::createModel()
 {
     //qDebug() << "(ServerConnection::createModel)";
@@ -433,7 +633,7 @@ void Soprano::Server::ServerConnection::Private::removeAllStatements()
         Statement s;
         stream.readStatement( s );
 
-        stream.writeErrorCode( model->removeAllStatements( s ) );
+        stream.writeErrorCode( modelPool->removeAllStatements( model, s ) );
         stream.writeError( model->lastError() );
     }
     else {
@@ -466,6 +666,30 @@ void Soprano::Server::ServerConnection::Private::listStatements()
 }
 
 
+void Soprano::Server::ServerConnection::Private::listStatementsPage()
+{
+    DataStream stream( socket );
+
+    Model* model = getModel();
+    Statement s;
+    qint32 offset = 0;
+    qint32 limit = -1;
+    stream.readStatement( s );
+    stream.readInt32( offset );
+    stream.readInt32( limit );
+
+    if ( model ) {
+        StatementIterator it = model->listStatements( s, offset, limit );
+        stream.writeUnsignedInt32( it.isValid() ? mapIterator( it ) : quint32(0) );
+        stream.writeError( model->lastError() );
+    }
+    else {
+        stream.writeUnsignedInt32( 0 );
+        stream.writeError( Error::Error( "Invalid model id" ) );
+    }
+}
+
+
 void Soprano::Server::ServerConnection::Private::containsStatement()
 {
     //qDebug() << "(ServerConnection::containsStatement)";
@@ -508,6 +732,42 @@ void Soprano::Server::ServerConnection::Private::containsAnyStatement()
 }
 
 
+void Soprano::Server::ServerConnection::Private::containsStatements()
+{
+    DataStream stream( socket );
+
+    Model* model = getModel();
+    quint32 count = 0;
+    stream.readUnsignedInt32( count );
+
+    QList<Statement> statements;
+    for ( quint32 i = 0; i < count; ++i ) {
+        Statement s;
+        if ( !stream.readStatement( s ) )
+            break;
+        statements.append( s );
+    }
+
+    if ( model ) {
+        const QBitArray bits = model->containsStatements( statements );
+
+        QByteArray packed( ( bits.size() + 7 ) / 8, 0 );
+        for ( int i = 0; i < bits.size(); ++i ) {
+            if ( bits.testBit( i ) )
+                packed[i / 8] = packed[i / 8] | ( 1 << ( i % 8 ) );
+        }
+        stream.writeUnsignedInt32( bits.size() );
+        stream.writeByteArray( packed );
+        stream.writeError( model->lastError() );
+    }
+    else {
+        stream.writeUnsignedInt32( 0 );
+        stream.writeByteArray( QByteArray() );
+        stream.writeError( Error::Error( "Invalid model id" ) );
+    }
+}
+
+
 void Soprano::Server::ServerConnection::Private::listContexts()
 {
     DataStream stream( socket );
@@ -525,6 +785,28 @@ void Soprano::Server::ServerConnection::Private::listContexts()
 }
 
 
+void Soprano::Server::ServerConnection::Private::listContextsPage()
+{
+    DataStream stream( socket );
+
+    Model* model = getModel();
+    qint32 offset = 0;
+    qint32 limit = -1;
+    stream.readInt32( offset );
+    stream.readInt32( limit );
+
+    if ( model ) {
+        NodeIterator it = model->listContexts( offset, limit );
+        stream.writeUnsignedInt32( it.isValid() ? mapIterator( it ) : quint32(0) );
+        stream.writeError( model->lastError() );
+    }
+    else {
+        stream.writeUnsignedInt32( 0 );
+        stream.writeError( Error::Error( "Invalid model id" ) );
+    }
+}
+
+
 void Soprano::Server::ServerConnection::Private::query()
 {
     DataStream stream( socket );
@@ -549,6 +831,71 @@ void Soprano::Server::ServerConnection::Private::query()
 }
 
 
+void Soprano::Server::ServerConnection::Private::prepareQuery()
+{
+    DataStream stream( socket );
+
+    Model* model = getModel();
+    if ( model ) {
+        QString queryString;
+        quint16 queryLang;
+        QString userLang;
+        stream.readString( queryString );
+        stream.readUnsignedInt16( queryLang );
+        stream.readString( userLang );
+
+        PreparedQuery pq = model->prepareQuery( queryString, ( Query::QueryLanguage )queryLang, userLang );
+        quint32 id = 0;
+        if ( pq.isValid() ) {
+            id = generateUniqueId();
+            openPreparedQueries.insert( id, pq );
+        }
+        stream.writeUnsignedInt32( id );
+        stream.writeError( model->lastError() );
+    }
+    else {
+        stream.writeUnsignedInt32( 0 );
+        stream.writeError( Error::Error( "Invalid model id" ) );
+    }
+}
+
+
+void Soprano::Server::ServerConnection::Private::preparedQueryExecute()
+{
+    DataStream stream( socket );
+
+    quint32 id = 0;
+    BindingSet bindings;
+    stream.readUnsignedInt32( id );
+    stream.readBindingSet( bindings );
+
+    QHash<quint32, PreparedQuery>::iterator pqIt = openPreparedQueries.find( id );
+    if ( pqIt != openPreparedQueries.end() ) {
+        QueryResultIterator it = pqIt.value().executeQuery( bindings );
+        stream.writeUnsignedInt32( it.isValid() ? mapIterator( it ) : quint32(0) );
+        stream.writeError( pqIt.value().lastError() );
+    }
+    else {
+        stream.writeUnsignedInt32( 0 );
+        stream.writeError( Error::Error( "Invalid prepared query ID." ) );
+    }
+}
+
+
+void Soprano::Server::ServerConnection::Private::preparedQueryClose()
+{
+    DataStream stream( socket );
+
+    quint32 id = 0;
+    stream.readUnsignedInt32( id );
+
+    if ( openPreparedQueries.remove( id ) )
+        stream.writeError( Error::Error() );
+    else
+        stream.writeError( Error::Error( "Invalid prepared query ID." ) );
+}
+
+
 void Soprano::Server::ServerConnection::Private::statementCount()
 {
     DataStream stream( socket );
@@ -566,6 +913,50 @@ void Soprano::Server::ServerConnection::Private::statementCount()
 }
 
 
+void Soprano::Server::ServerConnection::Private::estimateCount()
+{
+    DataStream stream( socket );
+
+    Model* model = getModel();
+    Statement pattern;
+    stream.readStatement( pattern );
+
+    if ( model ) {
+        qint32 count = model->estimateCount( pattern );
+        stream.writeInt32( count );
+        stream.writeError( model->lastError() );
+    }
+    else {
+        stream.writeInt32( -1 );
+        stream.writeError( Error::Error( "Invalid model id" ) );
+    }
+}
+
+
+void Soprano::Server::ServerConnection::Private::statistics( quint16 command )
+{
+    DataStream stream( socket );
+
+    Model* model = getModel();
+    if ( model ) {
+        const QHash<Node, int> counts = ( command == COMMAND_MODEL_PREDICATE_STATISTICS
+                                          ? model->predicateStatistics()
+                                          : model->contextStatistics() );
+        const Error::Error error = model->lastError();
+        stream.writeUnsignedInt32( counts.count() );
+        for ( QHash<Node, int>::const_iterator it = counts.constBegin(); it != counts.constEnd(); ++it ) {
+            stream.writeNode( it.key() );
+            stream.writeInt32( it.value() );
+        }
+        stream.writeError( error );
+    }
+    else {
+        stream.writeUnsignedInt32( 0 );
+        stream.writeError( Error::Error( "Invalid model id" ) );
+    }
+}
+
+
 void Soprano::Server::ServerConnection::Private::isEmpty()
 {
     DataStream stream( socket );
@@ -606,6 +997,15 @@ void Soprano::Server::ServerConnection::Private::iteratorNext()
     quint32 id = 0;
     stream.readUnsignedInt32( id );
 
+    // the deadline of the query also covers the iteration of its results
+    const RequestContext context = iteratorContext( id );
+    if ( context.isCancelled() ) {
+        stream.writeBool( false );
+        stream.writeError( context.cancelError() );
+        return;
+    }
+    RequestScope scope( context );
+
     QHash<quint32, StatementIterator>::iterator it1 = openStatementIterators.find( id );
     if ( it1 != openStatementIterators.end() ) {
         stream.writeBool( it1.value().next() );
@@ -704,6 +1104,38 @@ void Soprano::Server::ServerConnection::Private::queryIteratorCurrent()
 }
 
 
+void Soprano::Server::ServerConnection::Private::queryIteratorCurrentValues()
+{
+    DataStream stream( socket );
+
+    quint32 id = 0;
+    stream.readUnsignedInt32( id );
+
+    QHash<quint32, QueryResultIterator>::iterator it = openQueryIterators.find( id );
+    if ( it != openQueryIterators.end() ) {
+        const BindingSet set = it.value().current();
+
+        // the schema is typically the same for all rows of a result
+        const BindingSchema schema = set.schema();
+        QHash<quint32, BindingSchema>::iterator schemaIt = sentBindingSchemas.find( id );
+        const bool sendSchema = ( schemaIt == sentBindingSchemas.end() || schemaIt.value() != schema );
+        stream.writeBool( sendSchema );
+        if ( sendSchema ) {
+            stream.writeBindingSchema( schema );
+            sentBindingSchemas.insert( id, schema );
+        }
+        stream.writeBindingValues( set );
+        stream.writeError( it.value().lastError() );
+    }
+    else {
+        stream.writeBool( true );
+        stream.writeBindingSchema( BindingSchema() );
+        stream.writeBindingValues( BindingSet() );
+        stream.writeError( Error::Error( "Invalid iterator ID." ) );
+    }
+}
+
+
 void Soprano::Server::ServerConnection::Private::iteratorClose()
 {
     DataStream stream( socket );
@@ -712,6 +1144,8 @@ void Soprano::Server::ServerConnection::Private::iteratorClose()
     quint32 id = 0;
     stream.readUnsignedInt32( id );
 
+    iteratorContexts.remove( id );
+
     QHash<quint32, StatementIterator>::iterator it1 = openStatementIterators.find( id );
     if ( it1 != openStatementIterators.end() ) {
         it1.value().close();
@@ -733,6 +1167,7 @@ void Soprano::Server::ServerConnection::Private::iteratorClose()
         it3.value().close();
         stream.writeError( it3.value().lastError() );
         openQueryIterators.erase( it3 );
+        sentBindingSchemas.remove( id );
         return;
     }
 
@@ -741,6 +1176,75 @@ void Soprano::Server::ServerConnection::Private::iteratorClose()
 }
 
 
+void Soprano::Server::ServerConnection::Private::iteratorProject()
+{
+    DataStream stream( socket );
+
+    quint32 id = 0;
+    qint32 column = 0;
+    QString bindingName;
+    bool distinct = false;
+    stream.readUnsignedInt32( id );
+    stream.readInt32( column );
+    stream.readString( bindingName );
+    stream.readBool( distinct );
+
+    // the node iterator is mapped with the context of the iterator it replaces
+    RequestScope scope( iteratorContext( id ) );
+
+    // the node iterator takes over the iterator, thus the client forgets the old id
+    QHash<quint32, StatementIterator>::iterator it1 = openStatementIterators.find( id );
+    if ( it1 != openStatementIterators.end() ) {
+        NodeIterator nodes;
+        switch( column ) {
+        case 0:
+            nodes = it1.value().iterateSubjects( distinct );
+            break;
+        case 1:
+            nodes = it1.value().iteratePredicates( distinct );
+            break;
+        case 2:
+            nodes = it1.value().iterateObjects( distinct );
+            break;
+        case 3:
+            nodes = it1.value().iterateContexts( distinct );
+            break;
+        default:
+            stream.writeUnsignedInt32( 0 );
+            stream.writeError( Error::Error( "Invalid statement column.", Error::ErrorInvalidArgument ) );
+            return;
+        }
+        openStatementIterators.erase( it1 );
+        iteratorContexts.remove( id );
+        stream.writeUnsignedInt32( mapIterator( nodes ) );
+        stream.writeError( Error::Error() );
+        return;
+    }
+
+    QHash<quint32, QueryResultIterator>::iterator it2 = openQueryIterators.find( id );
+    if ( it2 != openQueryIterators.end() ) {
+        NodeIterator nodes = bindingName.isEmpty()
+                             ? it2.value().iterateBindings( column, distinct )
+                             : it2.value().iterateBindings( bindingName, distinct );
+        if ( nodes.isValid() ) {
+            openQueryIterators.erase( it2 );
+            sentBindingSchemas.remove( id );
+            iteratorContexts.remove( id );
+            stream.writeUnsignedInt32( mapIterator( nodes ) );
+            stream.writeError( Error::Error() );
+        }
+        else {
+            stream.writeUnsignedInt32( 0 );
+            stream.writeError( it2.value().lastError() );
+        }
+        return;
+    }
+
+    stream.writeUnsignedInt32( 0 );
+    stream.writeError( Error::Error( "Invalid iterator ID." ) );
+}
+
+
 void Soprano::Server::ServerConnection::Private::queryIteratorType()
 {
     DataStream stream( socket );
@@ -802,8 +1306,134 @@ void Soprano::Server::ServerConnection::Private::supportsProtocolVersion()
     stream.readUnsignedInt32( requestedVersion );
 
     // Since version 3 we are not backwards compatible anymore!
-    stream.writeBool( ( requestedVersion == PROTOCOL_VERSION ? true : false ) );
+    // Versions 6 to 13 only added commands, thus, we still support version 5 clients.
+    stream.writeBool( ( requestedVersion >= 5 && requestedVersion <= PROTOCOL_VERSION ) );
     //qDebug() << "(ServerConnection::supportsProtocolVersion) done";
 }
 
+
+void Soprano::Server::ServerConnection::Private::readRequestOptions()
+{
+    DataStream stream( socket );
+
+    quint32 timeout = 0;
+    stream.readUnsignedInt32( timeout );
+
+    // options without a command in between would leave a request behind
+    if ( pendingRequestId )
+        modelPool->unregisterRequest( pendingRequestId );
+
+    // The id is assigned by us to prevent clients from using (and thus cancelling)
+    // the ids of other clients. It is sent back right away to allow cancelling
+    // the request while it is running.
+    // the timeout is unsigned on the wire, anything above INT_MAX is no deadline in practice
+    pendingContext = RequestContext::create( int( qMin( timeout, quint32( std::numeric_limits<int>::max() ) ) ) );
+    pendingRequestId = modelPool->registerRequest( pendingContext );
+    stream.writeUnsignedInt32( pendingRequestId );
+}
+
+
+void Soprano::Server::ServerConnection::Private::cancelRequest()
+{
+    DataStream stream( socket );
+
+    // the request to cancel is running in another connection
+    quint32 id = 0;
+    stream.readUnsignedInt32( id );
+
+    stream.writeBool( modelPool->cancelRequest( id ) );
+    stream.writeError( Error::Error() );
+}
+
+void Soprano::Server::ServerConnection::Private::subscribe()
+{
+    DataStream stream( socket );
+
+    quint32 modelId = 0;
+    quint32 count = 0;
+    stream.readUnsignedInt32( modelId );
+    stream.readUnsignedInt32( count );
+
+    QList<Statement> patterns;
+    for ( quint32 i = 0; i < count; ++i ) {
+        Statement pattern;
+        if ( !stream.readStatement( pattern ) )
+            break;
+        patterns.append( pattern );
+    }
+
+    const quint32 id = modelPool->subscribe( modelId, patterns, q );
+
+    // the connection might already carry changes for other subscriptions, thus, the reply is tagged
+    stream.writeUnsignedInt16( SUBSCRIPTION_REPLY );
+    stream.writeUnsignedInt32( id );
+    stream.writeError( id ? Error::Error() : Error::Error( "Invalid model id" ) );
+}
+
+
+void Soprano::Server::ServerConnection::Private::unsubscribe()
+{
+    DataStream stream( socket );
+
+    quint32 id = 0;
+    stream.readUnsignedInt32( id );
+
+    const bool unsubscribed = modelPool->unsubscribe( id, q );
+    if ( unsubscribed ) {
+        QMutexLocker lock( &changeMutex );
+        pendingChanges.remove( id );
+    }
+
+    stream.writeUnsignedInt16( SUBSCRIPTION_REPLY );
+    stream.writeUnsignedInt32( id );
+    stream.writeError( unsubscribed ? Error::Error() : Error::Error( "Invalid subscription id" ) );
+}
+
+
+void Soprano::Server::ServerConnection::Private::_s_flushChanges()
+{
+    // never interleave the changes with the reply of a running command
+    if ( currentCommand != 0 ) {
+        changeTimer->start();
+        return;
+    }
+
+    QHash<quint32, QHash<Statement, bool> > changes;
+    {
+        QMutexLocker lock( &changeMutex );
+        changes = pendingChanges;
+        pendingChanges.clear();
+        changeFlushScheduled = false;
+    }
+
+    DataStream stream( socket );
+
+    for ( QHash<quint32, QHash<Statement, bool> >::const_iterator it = changes.constBegin();
+          it != changes.constEnd(); ++it ) {
+        if ( it.value().isEmpty() )
+            continue;
+
+        QList<Statement> added;
+        QList<Statement> removed;
+        for ( QHash<Statement, bool>::const_iterator changeIt = it.value().constBegin();
+              changeIt != it.value().constEnd(); ++changeIt ) {
+            if ( changeIt.value() )
+                added.append( changeIt.key() );
+            else
+                removed.append( changeIt.key() );
+        }
+
+        stream.writeUnsignedInt16( SUBSCRIPTION_CHANGES );
+        stream.writeUnsignedInt32( it.key() );
+        stream.writeUnsignedInt32( added.count() );
+        Q_FOREACH( const Statement& s, added ) {
+            stream.writeStatement( s );
+        }
+        stream.writeUnsignedInt32( removed.count() );
+        Q_FOREACH( const Statement& s, removed ) {
+            stream.writeStatement( s );
+        }
+    }
+}
+
 #include "moc_serverconnection.cpp"
@@ -30,6 +30,7 @@ class QIODevice;
 namespace Soprano {
 
     class Backend;
+    class Statement;
     namespace Util {
         class AsyncResult;
     }
@@ -55,6 +56,15 @@ namespace Soprano {
 
             void close();
 
+            /**
+             * Queue a change for the subscription \p subscriptionId. Queued changes
+             * are coalesced and sent to the client in one batch after a short delay.
+             *
+             * This method is thread-safe. It is called by the ModelPool in the thread
+             * which changed the model.
+             */
+            void queueChange( quint32 subscriptionId, const Statement& statement, bool added );
+
         protected:
             void run();
 
@@ -65,6 +75,7 @@ namespace Soprano {
             Private* const d;
 
             Q_PRIVATE_SLOT( d, void _s_readNextCommand() )
+            Q_PRIVATE_SLOT( d, void _s_flushChanges() )
         };
     }
 }
@@ -0,0 +1,176 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "subscriptionindex.h"
+
+#include <QtCore/QSet>
+
+
+namespace {
+    /// the statement positions in the order they are used as index keys
+    const int s_keyOrder[4] = { 0, 2, 3, 1 };
+
+    Soprano::Node nodeAt( const Soprano::Statement& statement, int pos )
+    {
+        switch( pos ) {
+        case 0:
+            return statement.subject();
+        case 1:
+            return statement.predicate();
+        case 2:
+            return statement.object();
+        default:
+            return statement.context();
+        }
+    }
+
+    /// \return the position under which \p pattern is indexed or -1 if it has no bound node
+    int keyPosition( const Soprano::Statement& pattern )
+    {
+        for ( int i = 0; i < 4; ++i ) {
+            if ( nodeAt( pattern, s_keyOrder[i] ).isValid() )
+                return s_keyOrder[i];
+        }
+        return -1;
+    }
+
+    /// empty nodes on either side are wildcards
+    bool overlaps( const Soprano::Statement& pattern, const Soprano::Statement& statement )
+    {
+        for ( int pos = 0; pos < 4; ++pos ) {
+            const Soprano::Node n1 = nodeAt( pattern, pos );
+            const Soprano::Node n2 = nodeAt( statement, pos );
+            if ( n1.isValid() && n2.isValid() && n1 != n2 )
+                return false;
+        }
+        return true;
+    }
+}
+
+
+Soprano::Server::SubscriptionIndex::SubscriptionIndex()
+{
+}
+
+
+Soprano::Server::SubscriptionIndex::~SubscriptionIndex()
+{
+}
+
+
+void Soprano::Server::SubscriptionIndex::addSubscription( quint32 id, const QList<Statement>& patterns )
+{
+    removeSubscription( id );
+
+    m_subscriptions.insert( id, patterns );
+    Q_FOREACH( const Statement& pattern, patterns ) {
+        Entry entry;
+        entry.id = id;
+        entry.pattern = pattern;
+
+        const int pos = keyPosition( pattern );
+        if ( pos < 0 )
+            m_unboundPatterns.append( entry );
+        else
+            m_index[pos][nodeAt( pattern, pos )].append( entry );
+    }
+}
+
+
+void Soprano::Server::SubscriptionIndex::removeSubscription( quint32 id )
+{
+    QHash<quint32, QList<Statement> >::iterator subIt = m_subscriptions.find( id );
+    if ( subIt == m_subscriptions.end() )
+        return;
+
+    Q_FOREACH( const Statement& pattern, subIt.value() ) {
+        const int pos = keyPosition( pattern );
+        QList<Entry>* entries = 0;
+        QHash<Node, QList<Entry> >::iterator indexIt;
+        if ( pos < 0 ) {
+            entries = &m_unboundPatterns;
+        }
+        else {
+            indexIt = m_index[pos].find( nodeAt( pattern, pos ) );
+            if ( indexIt == m_index[pos].end() )
+                continue;
+            entries = &indexIt.value();
+        }
+
+        for ( int i = entries->count() - 1; i >= 0; --i ) {
+            if ( entries->at( i ).id == id )
+                entries->removeAt( i );
+        }
+
+        if ( pos >= 0 && entries->isEmpty() )
+            m_index[pos].erase( indexIt );
+    }
+
+    m_subscriptions.erase( subIt );
+}
+
+
+bool Soprano::Server::SubscriptionIndex::contains( quint32 id ) const
+{
+    return m_subscriptions.contains( id );
+}
+
+
+bool Soprano::Server::SubscriptionIndex::isEmpty() const
+{
+    return m_subscriptions.isEmpty();
+}
+
+
+QList<quint32> Soprano::Server::SubscriptionIndex::matchingSubscriptions( const Statement& statement, bool wildcards ) const
+{
+    QSet<quint32> ids;
+
+    for ( int pos = 0; pos < 4; ++pos ) {
+        const Node node = nodeAt( statement, pos );
+        if ( node.isValid() ) {
+            QHash<Node, QList<Entry> >::const_iterator it = m_index[pos].constFind( node );
+            if ( it != m_index[pos].constEnd() ) {
+                Q_FOREACH( const Entry& entry, it.value() ) {
+                    if ( !ids.contains( entry.id ) &&
+                         ( wildcards ? overlaps( entry.pattern, statement ) : statement.matches( entry.pattern ) ) )
+                        ids.insert( entry.id );
+                }
+            }
+        }
+        else if ( wildcards ) {
+            // a removal by pattern: all patterns filed under this position are candidates
+            for ( QHash<Node, QList<Entry> >::const_iterator it = m_index[pos].constBegin();
+                  it != m_index[pos].constEnd(); ++it ) {
+                Q_FOREACH( const Entry& entry, it.value() ) {
+                    if ( !ids.contains( entry.id ) && overlaps( entry.pattern, statement ) )
+                        ids.insert( entry.id );
+                }
+            }
+        }
+    }
+
+    Q_FOREACH( const Entry& entry, m_unboundPatterns ) {
+        ids.insert( entry.id );
+    }
+
+    return ids.toList();
+}
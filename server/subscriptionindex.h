@@ -0,0 +1,90 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_SERVER_SUBSCRIPTION_INDEX_H_
+#define _SOPRANO_SERVER_SUBSCRIPTION_INDEX_H_
+
+#include "statement.h"
+#include "node.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+
+namespace Soprano {
+    namespace Server {
+        /**
+         * Maps statement patterns to the ids of the subscriptions which registered them.
+         *
+         * Each pattern is filed under exactly one of its bound nodes, preferably the
+         * subject, then the object, the context, and the predicate. Matching a statement
+         * thus only needs one hash lookup per statement position and only compares the
+         * statement against patterns which share at least that node with it. The cost of
+         * a write does not grow with the number of subscriptions as long as the patterns
+         * are spread over different nodes. Patterns without any bound node match everything
+         * and are checked on each write.
+         *
+         * The index is not thread-safe.
+         */
+        class SubscriptionIndex
+        {
+        public:
+            SubscriptionIndex();
+            ~SubscriptionIndex();
+
+            /**
+             * Register \p patterns under \p id. Empty nodes in the patterns act as wildcards.
+             * A subscription which already exists is replaced.
+             */
+            void addSubscription( quint32 id, const QList<Statement>& patterns );
+            void removeSubscription( quint32 id );
+
+            bool contains( quint32 id ) const;
+            bool isEmpty() const;
+
+            /**
+             * \return The ids of all subscriptions with a pattern matching \p statement, each
+             * id only once.
+             *
+             * \param wildcards Backends may report removals by pattern. If \p true empty nodes
+             * in \p statement are treated as wildcards and each subscription with a pattern
+             * that could match any of the removed statements is returned. Otherwise an empty
+             * node only matches wildcards in the patterns, like the empty context of a statement
+             * in the default graph. Only set it for reported patterns, not for removed statements.
+             */
+            QList<quint32> matchingSubscriptions( const Statement& statement, bool wildcards = false ) const;
+
+        private:
+            struct Entry {
+                quint32 id;
+                Statement pattern;
+            };
+
+            QHash<Node, QList<Entry> > m_index[4];
+
+            /// patterns without bound nodes
+            QList<Entry> m_unboundPatterns;
+
+            QHash<quint32, QList<Statement> > m_subscriptions;
+        };
+    }
+}
+
+#endif
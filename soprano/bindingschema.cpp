@@ -0,0 +1,109 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "bindingschema.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QSharedData>
+
+
+class Soprano::BindingSchema::Private : public QSharedData
+{
+public:
+    QStringList names;
+    QHash<QString, int> bindingMap;
+};
+
+
+Soprano::BindingSchema::BindingSchema()
+    : d( new Private() )
+{
+}
+
+
+Soprano::BindingSchema::BindingSchema( const QStringList& names )
+    : d( new Private() )
+{
+    d->names = names;
+    for ( int i = 0; i < names.count(); ++i )
+        d->bindingMap.insert( names[i], i );
+}
+
+
+Soprano::BindingSchema::BindingSchema( const BindingSchema& other )
+    : d( other.d )
+{
+}
+
+
+Soprano::BindingSchema::~BindingSchema()
+{
+}
+
+
+Soprano::BindingSchema& Soprano::BindingSchema::operator=( const BindingSchema& other )
+{
+    d = other.d;
+    return *this;
+}
+
+
+QStringList Soprano::BindingSchema::names() const
+{
+    return d->names;
+}
+
+
+int Soprano::BindingSchema::count() const
+{
+    return d->names.count();
+}
+
+
+int Soprano::BindingSchema::indexOf( const QString& name ) const
+{
+    return d->bindingMap.value( name, -1 );
+}
+
+
+bool Soprano::BindingSchema::contains( const QString& name ) const
+{
+    return d->bindingMap.contains( name );
+}
+
+
+void Soprano::BindingSchema::append( const QString& name )
+{
+    d->bindingMap.insert( name, d->names.count() );
+    d->names.append( name );
+}
+
+
+bool Soprano::BindingSchema::operator==( const BindingSchema& other ) const
+{
+    return d == other.d || d->names == other.d->names;
+}
+
+
+bool Soprano::BindingSchema::operator!=( const BindingSchema& other ) const
+{
+    return !operator==( other );
+}
@@ -0,0 +1,102 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_BINDING_SCHEMA_H_
+#define _SOPRANO_BINDING_SCHEMA_H_
+
+#include "soprano_export.h"
+
+#include <QtCore/QSharedDataPointer>
+#include <QtCore/QStringList>
+
+
+namespace Soprano {
+    /**
+     * \class BindingSchema bindingschema.h Soprano/BindingSchema
+     *
+     * \brief The variable names of a query result and their positions.
+     *
+     * All BindingSet instances of one result set share the same schema, thus the names
+     * and the name lookup table are stored only once. BindingSchema is implicitly shared
+     * and cheap to copy.
+     *
+     * \sa BindingSet::schema(), QueryResultIterator
+     *
+     * \since 2.10
+     */
+    class SOPRANO_EXPORT BindingSchema
+    {
+    public:
+        /**
+         * Create an empty schema.
+         */
+        BindingSchema();
+
+        /**
+         * Create a schema with the variables \p names.
+         */
+        BindingSchema( const QStringList& names );
+
+        BindingSchema( const BindingSchema& other );
+        ~BindingSchema();
+
+        BindingSchema& operator=( const BindingSchema& other );
+
+        /**
+         * \return The variable names in result order.
+         */
+        QStringList names() const;
+
+        /**
+         * \return The number of variables.
+         */
+        int count() const;
+
+        /**
+         * \return The position of the variable \p name or -1 if the
+         * schema does not contain it.
+         */
+        int indexOf( const QString& name ) const;
+
+        /**
+         * \return \p true if the schema contains the variable \p name.
+         */
+        bool contains( const QString& name ) const;
+
+        /**
+         * Append a variable to the schema. This detaches the schema from
+         * all copies.
+         */
+        void append( const QString& name );
+
+        /**
+         * Two schemas are equal if they contain the same names in the same order.
+         */
+        bool operator==( const BindingSchema& other ) const;
+        bool operator!=( const BindingSchema& other ) const;
+
+    private:
+        class Private;
+        QSharedDataPointer<Private> d;
+    };
+}
+
+#endif
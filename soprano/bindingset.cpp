@@ -20,9 +20,9 @@
  */
 
 #include "bindingset.h"
+#include "bindingschema.h"
 #include "node.h"
 
-#include <QtCore/QHash>
 #include <QtCore/QStringList>
 #include <QtCore/QVector>
 #include <QtCore/QSharedData>
@@ -33,8 +33,7 @@
 class Soprano::BindingSet::Private : public QSharedData
 {
 public:
-    QHash<QString, int> bindingMap;
-    QStringList names;
+    BindingSchema schema;
     QVector<Soprano::Node> values;
 };
 
@@ -45,6 +44,15 @@ Soprano::BindingSet::BindingSet()
 }
 
 
+Soprano::BindingSet::BindingSet( const BindingSchema& schema, const QVector<Node>& values )
+    : d( new Private() )
+{
+    Q_ASSERT( schema.count() == values.count() );
+    d->schema = schema;
+    d->values = values;
+}
+
+
 Soprano::BindingSet::BindingSet( const BindingSet& other )
 {
     d = other.d;
@@ -65,7 +73,13 @@ Soprano::BindingSet& Soprano::BindingSet::operator=( const BindingSet& other )
 
 QStringList Soprano::BindingSet::bindingNames() const
 {
-    return d->names;
+    return d->schema.names();
+}
+
+
+Soprano::BindingSchema Soprano::BindingSet::schema() const
+{
+    return d->schema;
 }
 
 
@@ -92,9 +106,9 @@ Soprano::Node Soprano::BindingSet::value( int offset ) const
 
 Soprano::Node Soprano::BindingSet::value( const QString& name ) const
 {
-    QHash<QString, int>::const_iterator it = d->bindingMap.find( name );
-    if ( it != d->bindingMap.constEnd() ) {
-        return d->values[*it];
+    const int i = d->schema.indexOf( name );
+    if ( i >= 0 ) {
+        return d->values[i];
     }
     else {
         return Node();
@@ -104,20 +118,19 @@ Soprano::Node Soprano::BindingSet::value( const QString& name ) const
 
 bool Soprano::BindingSet::contains( const QString& name ) const
 {
-    return d->bindingMap.contains( name );
+    return d->schema.contains( name );
 }
 
 
 int Soprano::BindingSet::count() const
 {
-    return d->bindingMap.size();
+    return d->values.size();
 }
 
 
 void Soprano::BindingSet::insert( const QString& name, const Node& value )
 {
-    d->names.append( name );
-    d->bindingMap.insert( name, d->values.size() );
+    d->schema.append( name );
     d->values.append( value );
 }
 
@@ -131,17 +144,16 @@ void Soprano::BindingSet::replace( int offset, const Node& value )
 
 void Soprano::BindingSet::replace( const QString& name, const Node& value )
 {
-    QHash<QString, int>::const_iterator it( d->bindingMap.constFind(name) );
-    Q_ASSERT( it != d->bindingMap.constEnd() );
-    if ( it != d->bindingMap.constEnd() ) {
-        replace( *it, value );
+    const int i = d->schema.indexOf( name );
+    Q_ASSERT( i >= 0 );
+    if ( i >= 0 ) {
+        replace( i, value );
     }
 }
 
 bool Soprano::BindingSet::operator==( const BindingSet& other ) const
 {
-    return ( d->bindingMap == other.d->bindingMap &&
-             d->names == other.d->names &&
+    return ( d->schema == other.d->schema &&
              d->values == other.d->values );
 }
 
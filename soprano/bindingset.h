@@ -25,6 +25,7 @@
 #include "soprano_export.h"
 
 #include <QtCore/QSharedDataPointer>
+#include <QtCore/QVector>
 
 
 class QStringList;
@@ -32,6 +33,7 @@ class QStringList;
 namespace Soprano {
 
     class Node;
+    class BindingSchema;
 
     /**
      * \class BindingSet bindingset.h Soprano/BindingSet
@@ -58,6 +60,16 @@ namespace Soprano {
          */
         BindingSet( const BindingSet& other );
 
+        /**
+         * Create a set with the values \p values for the variables in \p schema.
+         * This is the preferred way for iterator implementations to create result
+         * rows since all rows share the variable names and the lookup table
+         * of the schema.
+         *
+         * \since 2.10
+         */
+        BindingSet( const BindingSchema& schema, const QVector<Node>& values );
+
         /**
          * Destructor.
          */
@@ -70,6 +82,14 @@ namespace Soprano {
          */
         QStringList bindingNames() const;
 
+        /**
+         * \return The schema of this set which contains the names of the
+         * bound variables.
+         *
+         * \since 2.10
+         */
+        BindingSchema schema() const;
+
         /**
          * Get the binding for a variable by index.
          *
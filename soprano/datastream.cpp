@@ -24,6 +24,7 @@
 #include "node.h"
 #include "statement.h"
 #include "bindingset.h"
+#include "bindingschema.h"
 #include "backend.h"
 #include "literalvalue.h"
 #include "locator.h"
@@ -31,6 +32,7 @@
 
 #include <QtCore/QIODevice>
 #include <QtCore/QDateTime>
+#include <QtCore/QVector>
 
 
 Soprano::DataStream::DataStream()
@@ -254,6 +256,35 @@ bool Soprano::DataStream::writeBindingSet( const BindingSet& set )
 }
 
 
+bool Soprano::DataStream::writeBindingSchema( const BindingSchema& schema )
+{
+    const QStringList names = schema.names();
+    if ( !writeUnsignedInt32( ( quint32 )names.count() ) ) {
+        return false;
+    }
+    for ( int i = 0; i < names.count(); ++i ) {
+        if ( !writeString( names[i] ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+bool Soprano::DataStream::writeBindingValues( const BindingSet& set )
+{
+    if ( !writeUnsignedInt32( ( quint32 )set.count() ) ) {
+        return false;
+    }
+    for ( int i = 0; i < set.count(); ++i ) {
+        if ( !writeNode( set[i] ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
 bool Soprano::DataStream::readByteArray( QByteArray& a )
 {
     quint32 len;
@@ -583,3 +614,43 @@ bool Soprano::DataStream::readBindingSet( BindingSet& set )
     }
     return true;
 }
+
+
+bool Soprano::DataStream::readBindingSchema( BindingSchema& schema )
+{
+    quint32 nb;
+    if ( !readUnsignedInt32( nb ) ) {
+        return false;
+    }
+    QStringList names;
+    for ( quint32 i = 0; i < nb; ++i ) {
+        QString name;
+        if ( !readString( name ) ) {
+            return false;
+        }
+        names.append( name );
+    }
+    schema = BindingSchema( names );
+    return true;
+}
+
+
+bool Soprano::DataStream::readBindingValues( const BindingSchema& schema, BindingSet& set )
+{
+    quint32 nb;
+    if ( !readUnsignedInt32( nb ) ) {
+        return false;
+    }
+    QVector<Node> values( nb );
+    for ( quint32 i = 0; i < nb; ++i ) {
+        if ( !readNode( values[i] ) ) {
+            return false;
+        }
+    }
+    if ( ( int )nb != schema.count() ) {
+        setError( "Binding values do not match the binding schema." );
+        return false;
+    }
+    set = BindingSet( schema, values );
+    return true;
+}
@@ -32,6 +32,7 @@ namespace Soprano {
 
     class LiteralValue;
     class BindingSet;
+    class BindingSchema;
     class BackendSetting;
     class Node;
     class Statement;
@@ -77,6 +78,23 @@ namespace Soprano {
         bool writeStatement( const Statement& );
         bool writeBindingSet( const BindingSet& );
 
+        /**
+         * Write the variable names of \p schema. Combined with writeBindingValues()
+         * this allows to send the names only once per result set.
+         *
+         * \since 2.10
+         */
+        bool writeBindingSchema( const BindingSchema& schema );
+
+        /**
+         * Write the values of \p set without the variable names.
+         *
+         * \sa readBindingValues()
+         *
+         * \since 2.10
+         */
+        bool writeBindingValues( const BindingSet& set );
+
         bool readByteArray( QByteArray& );
         bool readString( QString& );
         bool readUrl( QUrl& );
@@ -96,6 +114,19 @@ namespace Soprano {
         bool readStatement( Statement& );
         bool readBindingSet( BindingSet& );
 
+        /**
+         * \since 2.10
+         */
+        bool readBindingSchema( BindingSchema& schema );
+
+        /**
+         * Read values written by writeBindingValues() into a set which
+         * shares \p schema.
+         *
+         * \since 2.10
+         */
+        bool readBindingValues( const BindingSchema& schema, BindingSet& set );
+
     protected:
         /**
          * Read from the device including waiting for data
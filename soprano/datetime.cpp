@@ -52,130 +52,182 @@
 #endif
 
 
-QTime Soprano::DateTime::fromTimeString( const QString& s )
-{
-    // ensure the format
-    if( s.length() < 8 ||
-        s[2] != ':' ||
-        s[5] != ':' ) {
-        qDebug() << Q_FUNC_INFO << " invalid formatted time string (too short): " << s << endl;
-        return QTime();
+namespace {
+    /**
+     * Parse \p len decimal digits of \p s starting at \p pos. The digits are
+     * read directly from the string data, thus no temporary strings are created.
+     */
+    bool parseDigits( const QString& s, int pos, int len, int* value )
+    {
+        if ( pos < 0 || len <= 0 || pos + len > s.length() )
+            return false;
+
+        const QChar* c = s.constData() + pos;
+        int v = 0;
+        for ( int i = 0; i < len; ++i ) {
+            const ushort u = c[i].unicode();
+            if ( u < '0' || u > '9' )
+                return false;
+            v = v*10 + ( u - '0' );
+        }
+        *value = v;
+        return true;
     }
 
-    bool ok = true;
 
-    int hh = s.mid( 0, 2 ).toInt( &ok );
-    if( !ok ) {
-        qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse hours): " << s << endl;
-        return QTime();
-    }
+    QTime parseTime( const QString& s, int start )
+    {
+        // ensure the format
+        if( s.length() - start < 8 ||
+            s[start+2] != ':' ||
+            s[start+5] != ':' ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted time string (too short): " << s << endl;
+            return QTime();
+        }
 
-    int mm = s.mid( 3, 2 ).toInt( &ok );
-    if( !ok ) {
-        qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse minutes): " << s << endl;
-        return QTime();
-    }
+        int hh = 0;
+        if( !parseDigits( s, start, 2, &hh ) ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse hours): " << s << endl;
+            return QTime();
+        }
 
-    int ss = s.mid( 6, 2 ).toInt( &ok );
-    if( !ok ) {
-        qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse seconds): " << s << endl;
-        return QTime();
-    }
+        int mm = 0;
+        if( !parseDigits( s, start+3, 2, &mm ) ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse minutes): " << s << endl;
+            return QTime();
+        }
 
-    int pos = 8;
+        int ss = 0;
+        if( !parseDigits( s, start+6, 2, &ss ) ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse seconds): " << s << endl;
+            return QTime();
+        }
 
-    // parse the fraction of seconds
-    int z = 0;
-    if( s.length() > 8 ) {
-        if ( s[8] == '.' || s[8] == ',' ) {
-            ++pos;
-            while( s.length() > pos && s[pos].isDigit() )
+        int pos = start+8;
+
+        // parse the fraction of seconds. Only milliseconds are supported by QTime,
+        // any further digits are ignored.
+        int z = 0;
+        if( s.length() > pos ) {
+            if ( s[pos] == '.' || s[pos] == ',' ) {
                 ++pos;
-            z = s.mid(9, pos-9).leftJustified( 3, '0' ).toInt(&ok);
-            if( !ok ) {
-                qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse fractions): " << s << endl;
-                return QTime();
+                int digits = 0;
+                while( s.length() > pos && s[pos].isDigit() ) {
+                    if ( digits < 3 ) {
+                        z = z*10 + s[pos].digitValue();
+                        ++digits;
+                    }
+                    ++pos;
+                }
+                if( digits == 0 ) {
+                    qDebug() << Q_FUNC_INFO << " invalid formatted time string (failed to parse fractions): " << s << endl;
+                    return QTime();
+                }
+                for( ; digits < 3; ++digits )
+                    z *= 10;
             }
         }
-    }
 
-    // finally create the time object
-    QTime t( hh, mm, ss, z );
+        // finally create the time object
+        QTime t( hh, mm, ss, z );
 
-    // parse the timezone
-    if( pos == s.length() || s[pos] == 'Z' ) {
-        return t;
-    }
-    else {
-        if( s.length() != pos+6 ) {
-            qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
-            return QTime();
+        // parse the timezone
+        if( pos == s.length() || s[pos] == 'Z' ) {
+            return t;
         }
-
-        bool add = true;
-        if( s[pos] == '+' )
-            add = true;
-        else if( s[pos] == '-' )
-            add = false;
         else {
-            qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
-            return QTime();
+            if( s.length() != pos+6 ) {
+                qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
+                return QTime();
+            }
+
+            bool add = true;
+            if( s[pos] == '+' )
+                add = true;
+            else if( s[pos] == '-' )
+                add = false;
+            else {
+                qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
+                return QTime();
+            }
+
+            ++pos;
+
+            if( !parseDigits( s, pos, 2, &hh ) ) {
+                qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
+                return QTime();
+            }
+
+            pos += 3;
+
+            if( !parseDigits( s, pos, 2, &mm ) ) {
+                qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
+                return QTime();
+            }
+
+            int secs = 60*( 60*hh + mm );
+            if( add )
+                return t.addSecs( -1*secs );
+            else
+                return t.addSecs( secs );
         }
+    }
 
-        ++pos;
 
-        hh = s.mid(pos, 2).toInt( &ok );
-        if( !ok ) {
-            qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
-            return QTime();
+    /**
+     * Parse the date in \p s between \p start and \p end (exclusive).
+     */
+    QDate parseDate( const QString& s, int start, int end )
+    {
+        int pos = start;
+        bool negative = false;
+        if( pos < end && s[pos] == '-' ) {
+            negative = true;
+            ++pos;
         }
 
-        pos += 3;
+        int yLen = s.indexOf( '-', pos+1 );
+        if( yLen < 0 || yLen >= end ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted date string: " << s << endl;
+            return QDate();
+        }
+        yLen -= pos;
 
-        mm = s.mid(pos, 2).toInt( &ok );
-        if( !ok ) {
-            qDebug() << Q_FUNC_INFO << " invalid formatted timezone string: " << s << endl;
-            return QTime();
+        int y = 0;
+        if( !parseDigits( s, pos, yLen, &y ) ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted date string: " << s << endl;
+            return QDate();
+        }
+        if( negative )
+            y = -y;
+        pos += yLen+1;
+
+        int m = 0;
+        if( !parseDigits( s, pos, qMin( 2, end-pos ), &m ) ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted date string: " << s << endl;
+            return QDate();
+        }
+        pos += 3;
+        int d = 0;
+        if( !parseDigits( s, pos, qMin( 2, end-pos ), &d ) ) {
+            qDebug() << Q_FUNC_INFO << " invalid formatted date string: " << s << endl;
+            return QDate();
         }
 
-        int secs = 60*( 60*hh + mm );
-        if( add )
-            return t.addSecs( -1*secs );
-        else
-            return t.addSecs( secs );
+        return QDate( y, m, d );
     }
-
-    return t;
 }
 
 
-QDate Soprano::DateTime::fromDateString( const QString& s )
+QTime Soprano::DateTime::fromTimeString( const QString& s )
 {
-    bool ok = true;
-
-    int pos = 0;
+    return parseTime( s, 0 );
+}
 
-    int yLen = s.indexOf( '-', 1 );
-    int y = s.mid(0, yLen).toInt( &ok );
-    if( !ok ) {
-        qDebug() << Q_FUNC_INFO << " invalid formatted date string: " << s << endl;
-        return QDate();
-    }
-    pos += yLen+1;
 
-    int m = s.mid(pos,2).toInt( &ok );
-    if( !ok ) {
-        qDebug() << Q_FUNC_INFO << " invalid formatted date string: " << s << endl;
-        return QDate();
-    }
-    pos += 3;
-    int d = s.mid(pos,2).toInt( &ok );
-    if( !ok ) {
-        qDebug() << Q_FUNC_INFO << " invalid formatted date string: " << s << endl;
-        return QDate();
-    }
-
-    return QDate( y, m, d );
+QDate Soprano::DateTime::fromDateString( const QString& s )
+{
+    return parseDate( s, 0, s.length() );
 }
 
 
@@ -188,7 +240,7 @@ QDateTime Soprano::DateTime::fromDateTimeString( const QString& s )
         pos = s.indexOf(' ');
     }
 
-    QDate date = fromDateString( s.mid( 0, pos ) );
+    QDate date = parseDate( s, 0, pos < 0 ? s.length() : pos );
     if( !date.isValid() ) {
         qDebug() << Q_FUNC_INFO << " invalid formatted datetime string: " << s << endl;
         return QDateTime();
@@ -196,7 +248,7 @@ QDateTime Soprano::DateTime::fromDateTimeString( const QString& s )
 
     QTime time;
     if( pos > 0 ) {
-        time = fromTimeString( s.mid( pos+1 ) );
+        time = parseTime( s, pos+1 );
         if( !time.isValid() ) {
             qDebug() << Q_FUNC_INFO << " invalid formatted datetime string: " << s << endl;
             return QDateTime();
@@ -24,6 +24,7 @@
 #include "queryresultiterator.h"
 #include "statementiterator.h"
 #include "nodeiterator.h"
+#include "preparedquery.h"
 #include "query/query.h"
 
 #include <QtCore/QList>
@@ -126,6 +127,15 @@ Soprano::NodeIterator Soprano::FilterModel::listContexts() const
 }
 
 
+Soprano::NodeIterator Soprano::FilterModel::listContexts( int offset, int limit ) const
+{
+    Q_ASSERT( d->parent );
+    NodeIterator it = d->parent->listContexts( offset, limit );
+    setError( d->parent->lastError() );
+    return it;
+}
+
+
 bool Soprano::FilterModel::containsStatement( const Statement &statement ) const
 {
     Q_ASSERT( d->parent );
@@ -141,6 +151,15 @@ bool Soprano::FilterModel::containsStatement( const Node& subject, const Node& p
 }
 
 
+QBitArray Soprano::FilterModel::containsStatements( const QList<Statement>& statements ) const
+{
+    Q_ASSERT( d->parent );
+    QBitArray result = d->parent->containsStatements( statements );
+    setError( d->parent->lastError() );
+    return result;
+}
+
+
 bool Soprano::FilterModel::containsAnyStatement( const Statement &statement ) const
 {
     Q_ASSERT( d->parent );
@@ -174,6 +193,15 @@ Soprano::QueryResultIterator Soprano::FilterModel::executeQuery( const QString&
 }
 
 
+Soprano::PreparedQuery Soprano::FilterModel::prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    Q_ASSERT( d->parent );
+    PreparedQuery pq = d->parent->prepareQuery( query, language, userQueryLanguage );
+    setError( d->parent->lastError() );
+    return pq;
+}
+
+
 Soprano::StatementIterator Soprano::FilterModel::listStatements( const Statement &partial ) const
 {
     Q_ASSERT( d->parent );
@@ -183,6 +211,15 @@ Soprano::StatementIterator Soprano::FilterModel::listStatements( const Statement
 }
 
 
+Soprano::StatementIterator Soprano::FilterModel::listStatements( const Statement& partial, int offset, int limit ) const
+{
+    Q_ASSERT( d->parent );
+    StatementIterator it = d->parent->listStatements( partial, offset, limit );
+    setError( d->parent->lastError() );
+    return it;
+}
+
+
 Soprano::StatementIterator Soprano::FilterModel::listStatements( const Node& subject, const Node& predicate, const Node& object, const Node& context ) const
 {
     return Model::listStatements( subject, predicate, object, context );
@@ -219,6 +256,15 @@ Soprano::Error::ErrorCode Soprano::FilterModel::removeAllStatements( const Node&
 }
 
 
+QList<Soprano::Statement> Soprano::FilterModel::takeAllStatements( const Statement &statement )
+{
+    Q_ASSERT( d->parent );
+    QList<Statement> removed = d->parent->takeAllStatements( statement );
+    setError( d->parent->lastError() );
+    return removed;
+}
+
+
 int Soprano::FilterModel::statementCount() const
 {
     Q_ASSERT( d->parent );
@@ -228,6 +274,33 @@ int Soprano::FilterModel::statementCount() const
 }
 
 
+int Soprano::FilterModel::estimateCount( const Statement& pattern ) const
+{
+    Q_ASSERT( d->parent );
+    int cnt = d->parent->estimateCount( pattern );
+    setError( d->parent->lastError() );
+    return cnt;
+}
+
+
+QHash<Soprano::Node, int> Soprano::FilterModel::predicateStatistics() const
+{
+    Q_ASSERT( d->parent );
+    QHash<Node, int> counts = d->parent->predicateStatistics();
+    setError( d->parent->lastError() );
+    return counts;
+}
+
+
+QHash<Soprano::Node, int> Soprano::FilterModel::contextStatistics() const
+{
+    Q_ASSERT( d->parent );
+    QHash<Node, int> counts = d->parent->contextStatistics();
+    setError( d->parent->lastError() );
+    return counts;
+}
+
+
 Soprano::Node Soprano::FilterModel::createBlankNode()
 {
     Q_ASSERT( d->parent );
@@ -101,6 +101,15 @@ namespace Soprano {
          * Reimplemented for convenience. Calls Model::removeAllStatements(const Node&,const Node&,const Node&,const Node&)
          */
         Error::ErrorCode removeAllStatements( const Node& subject, const Node& predicate, const Node& object, const Node& context = Node() );
+
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         * Subclasses which reimplement removeAllStatements() have to reimplement this
+         * method, too.
+         *
+         * \since 2.10
+         */
+        virtual QList<Statement> takeAllStatements( const Statement &statement );
         //@}
 
         //@{
@@ -114,11 +123,28 @@ namespace Soprano {
          */
         StatementIterator listStatements( const Node& subject, const Node& predicate, const Node& object, const Node& context = Node() ) const;
 
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         * Subclasses which reimplement listStatements(const Statement&) to change the
+         * listed statements need to reimplement this method, too.
+         *
+         * \since 2.10
+         */
+        virtual StatementIterator listStatements( const Statement& partial, int offset, int limit ) const;
+
         /**
          * Default implementation simply pipes the call through to the parent model.
          */
         virtual NodeIterator listContexts() const;
 
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         * Subclasses which reimplement listContexts() need to reimplement this method, too.
+         *
+         * \since 2.10
+         */
+        virtual NodeIterator listContexts( int offset, int limit ) const;
+
         /**
          * Default implementation simply pipes the call through to the parent model.
          */
@@ -128,6 +154,15 @@ namespace Soprano {
          * Default implementation simply pipes the call through to the parent model.
          */
         virtual QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         * Filter models which change the behaviour of executeQuery() need to
+         * reimplement this method accordingly.
+         *
+         * \since 2.10
+         */
+        virtual PreparedQuery prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
         //@}
 
         //@{
@@ -141,6 +176,13 @@ namespace Soprano {
          */
         bool containsStatement( const Node& subject, const Node& predicate, const Node& object, const Node& context = Node() ) const;
 
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         *
+         * \since 2.10
+         */
+        virtual QBitArray containsStatements( const QList<Statement>& statements ) const;
+
         /**
          * Default implementation simply pipes the call through to the parent model.
          */
@@ -162,6 +204,27 @@ namespace Soprano {
          * Default implementation simply pipes the call through to the parent model.
          */
         virtual int statementCount() const;
+
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         *
+         * \since 2.10
+         */
+        virtual int estimateCount( const Statement& pattern ) const;
+
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         *
+         * \since 2.10
+         */
+        virtual QHash<Node, int> predicateStatistics() const;
+
+        /**
+         * Default implementation simply pipes the call through to the parent model.
+         *
+         * \since 2.10
+         */
+        virtual QHash<Node, int> contextStatistics() const;
         //@}
 
         //@{
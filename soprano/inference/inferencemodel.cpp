@@ -130,24 +130,43 @@ Soprano::Error::ErrorCode Soprano::Inference::InferenceModel::addStatement( cons
 
 
 Soprano::Error::ErrorCode Soprano::Inference::InferenceModel::removeAllStatements( const Statement& statement )
+{
+    // are there any rules that handle objects? Probably not.
+    if ( statement.object().isLiteral() ) {
+        return FilterModel::removeAllStatements( statement );
+    }
+
+    takeAllStatements( statement );
+    return Error::convertErrorCode( lastError().code() );
+}
+
+
+QList<Soprano::Statement> Soprano::Inference::InferenceModel::takeAllStatements( const Statement& statement )
 {
     // FIXME: should we check if the statement could match some rule at all and if not do nothing?
 
     // are there any rules that handle objects? Probably not.
-    if ( !statement.object().isLiteral() ) {
-        // we need to list statements first and then iterate over all that will be removed
-        // since we change the model we also have to cache the statements
-        QList<Statement> removedStatements = parentModel()->listStatements( statement ).allStatements();
-        for ( QList<Statement>::const_iterator it2 = removedStatements.constBegin();
-              it2 != removedStatements.constEnd(); ++it2 ) {
-            Error::ErrorCode c = removeStatement( *it2 );
-            if ( c != Error::ErrorNone ) {
-                return c;
-            }
+    if ( statement.object().isLiteral() ) {
+        return FilterModel::takeAllStatements( statement );
+    }
+
+    // remove all statements at once and only then clean up the graphs infered from them
+    const QList<Statement> removedStatements = parentModel()->takeAllStatements( statement );
+    if ( parentModel()->lastError() ) {
+        setError( parentModel()->lastError() );
+        return QList<Statement>();
+    }
+
+    for ( QList<Statement>::const_iterator it = removedStatements.constBegin();
+          it != removedStatements.constEnd(); ++it ) {
+        Error::ErrorCode c = removeInferedGraphsForStatement( *it );
+        if ( c != Error::ErrorNone ) {
+            return removedStatements;
         }
     }
 
-    return Error::ErrorNone;
+    clearError();
+    return removedStatements;
 }
 
 
@@ -158,6 +177,13 @@ Soprano::Error::ErrorCode Soprano::Inference::InferenceModel::removeStatement( c
         return c;
     }
 
+    return removeInferedGraphsForStatement( statement );
+}
+
+
+Soprano::Error::ErrorCode Soprano::Inference::InferenceModel::removeInferedGraphsForStatement( const Statement& statement )
+{
+    Error::ErrorCode c = Error::ErrorNone;
     QList<Node> graphs = inferedGraphsForStatement( statement );
     for ( QList<Node>::const_iterator it = graphs.constBegin(); it != graphs.constEnd(); ++it ) {
         Node graph = *it;
@@ -92,6 +92,11 @@ namespace Soprano {
              */
             Error::ErrorCode removeAllStatements( const Statement& );
 
+            /**
+             * Remove statements from the model and return them.
+             */
+            QList<Statement> takeAllStatements( const Statement& );
+
             /**
              * Add an inference rule to the set of rules.
              * This method will not trigger any inference action. If inference
@@ -186,6 +191,12 @@ namespace Soprano {
              */
             QList<Node> inferedGraphsForStatement( const Statement& statement ) const;
 
+            /**
+             * Remove the inference graphs which have the already removed \p statement
+             * as a source.
+             */
+            Error::ErrorCode removeInferedGraphsForStatement( const Statement& statement );
+
             /**
              * Create the statements to store an uncompressed source statement and add them to the parent model.
              * \return The URI of the uncompressed source statement resource.
@@ -26,8 +26,12 @@
 #include "soprano_export.h"
 #include "error.h"
 
+#include <QtCore/QString>
+
 namespace Soprano {
 
+    class Node;
+
     /**
      * \class IteratorBackend iteratorbackend.h Soprano/IteratorBackend
      *
@@ -75,6 +79,33 @@ namespace Soprano {
          */
         virtual void close() = 0;
 
+        /**
+         * Create a backend which iterates over one column of the remaining elements.
+         * StatementIterator::iterateSubjects() and friends as well as
+         * QueryResultIterator::iterateBindings() use it to let backends which transfer
+         * their elements, like the ones of the %Soprano client, transfer only the
+         * requested column. This backend is consumed by the new one and should not be
+         * used anymore.
+         *
+         * The default implementation returns 0 which makes the callers project the
+         * elements themselves.
+         *
+         * \param column The position in the statement, 0 for the subject up to 3 for
+         * the context, or the offset of the binding.
+         * \param bindingName The name of the binding, used instead of \p column if not empty.
+         * \param distinct If \p true duplicate nodes are skipped.
+         *
+         * \return A new backend or 0 if the projection is not supported.
+         *
+         * \since 2.10
+         */
+        virtual IteratorBackend<Node>* projectColumn( int column, const QString& bindingName, bool distinct ) {
+            Q_UNUSED( column );
+            Q_UNUSED( bindingName );
+            Q_UNUSED( distinct );
+            return 0;
+        }
+
     protected:
         IteratorBackend() {}
     };
@@ -31,84 +31,250 @@
 #include <QtCore/QHash>
 #include <QtCore/QDebug>
 #include <QtCore/QSharedData>
-#include <QtCore/QMutex>
-#include <QtCore/QMutexLocker>
+
+#include <limits>
 
 
 namespace {
 /**
- * Helper class for thread-safe conversion between QUrl and QVariant::Type.
+ * The datatypes which are stored as a small tag in TypedData instead of a full QUrl.
+ * Recognizing them does not require any hashing of the URI string.
+ */
+enum XsdType {
+    XsdUnknown = 0,
+    XsdInt,
+    XsdInteger,
+    XsdNegativeInteger,
+    XsdNonNegativeInteger,
+    XsdDecimal,
+    XsdShort,
+    XsdLong,
+    XsdUnsignedInt,
+    XsdUnsignedShort,
+    XsdUnsignedLong,
+    XsdBoolean,
+    XsdDouble,
+    XsdFloat,
+    XsdString,
+    XsdDate,
+    XsdTime,
+    XsdDateTime,
+    XsdBase64Binary,
+    RdfXmlLiteral,
+    XsdTypeCount
+};
+
+struct XsdTypeInfo {
+    QVariant::Type type;
+};
+
+// indexed by XsdType
+const XsdTypeInfo s_xsdTypeInfo[XsdTypeCount] = {
+    { QVariant::Invalid }, // unknown
+    { QVariant::Int }, // int
+    { QVariant::Int }, // integer
+    { QVariant::Int }, // negativeInteger
+    { QVariant::UInt }, // nonNegativeInteger
+    { QVariant::Int }, // decimal
+    { QVariant::Int }, // short
+    { QVariant::LongLong }, // long
+    { QVariant::UInt }, // unsignedInt
+    { QVariant::UInt }, // unsignedShort
+    { QVariant::ULongLong }, // unsignedLong
+    { QVariant::Bool }, // boolean
+    { QVariant::Double }, // double
+    { QVariant::Double }, // float
+    { QVariant::String }, // string
+    { QVariant::Date }, // date
+    { QVariant::Time }, // time
+    { QVariant::DateTime }, // dateTime
+    { QVariant::ByteArray }, // base64Binary
+    { QVariant::String } // XMLLiteral
+};
+
+/**
+ * \return The datatype used for values of \p type if no explicit datatype is given.
+ */
+XsdType defaultXsdType( QVariant::Type type )
+{
+    switch( type ) {
+    case QVariant::Int:
+        return XsdInt;
+    case QVariant::LongLong:
+        return XsdLong;
+    case QVariant::UInt:
+        return XsdUnsignedInt;
+    case QVariant::ULongLong:
+        return XsdUnsignedLong;
+    case QVariant::Bool:
+        return XsdBoolean;
+    case QVariant::Double:
+        return XsdDouble;
+    case QVariant::String:
+        return XsdString;
+    case QVariant::Date:
+        return XsdDate;
+    case QVariant::Time:
+        return XsdTime;
+    case QVariant::DateTime:
+        return XsdDateTime;
+    case QVariant::ByteArray:
+        return XsdBase64Binary;
+    default:
+        return XsdUnknown;
+    }
+}
+
+/**
+ * Holds the URIs of the known datatypes. The pool is never changed
+ * after construction, thus it can be read without locking.
  */
 class XsdTypePool
 {
 public:
     XsdTypePool();
 
-    QVariant::Type typeFromDataTypeUri( const QUrl& dataTypeUri ) const;
-    QUrl dataTypeUriFromType( QVariant::Type type ) const;
+    XsdType xsdTypeFromUri( const QUrl& dataTypeUri ) const;
+    QUrl uri( XsdType type ) const { return m_uris[type]; }
 
 private:
-    mutable QMutex m_xsdMutex;
-    mutable QMutex m_variantMutex;
-    QHash<QUrl, QVariant::Type> m_xsdHash;
-    QHash<int, QUrl> m_variantHash;
+    QUrl m_uris[XsdTypeCount];
 };
 
 XsdTypePool::XsdTypePool()
 {
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::xsdInt(), QVariant::Int );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::integer(), QVariant::Int );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::negativeInteger(), QVariant::Int );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::nonNegativeInteger(), QVariant::UInt );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::decimal(), QVariant::Int );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::xsdShort(), QVariant::Int );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::xsdLong(), QVariant::LongLong );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::unsignedInt(), QVariant::UInt );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::unsignedShort(), QVariant::UInt );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::unsignedLong(), QVariant::ULongLong );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::boolean(), QVariant::Bool );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::xsdDouble(), QVariant::Double );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::xsdFloat(), QVariant::Double );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::string(), QVariant::String );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::date(), QVariant::Date );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::time(), QVariant::Time );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::dateTime(), QVariant::DateTime );
-    m_xsdHash.insert( Soprano::Vocabulary::XMLSchema::base64Binary(), QVariant::ByteArray );
-    m_xsdHash.insert( Soprano::Vocabulary::RDF::XMLLiteral(), QVariant::String );
-
-    m_variantHash.insert( QVariant::Int, Soprano::Vocabulary::XMLSchema::xsdInt() );
-    m_variantHash.insert( QVariant::LongLong, Soprano::Vocabulary::XMLSchema::xsdLong() );
-    m_variantHash.insert( QVariant::UInt, Soprano::Vocabulary::XMLSchema::unsignedInt() );
-    m_variantHash.insert( QVariant::ULongLong, Soprano::Vocabulary::XMLSchema::unsignedLong() );
-    m_variantHash.insert( QVariant::Bool, Soprano::Vocabulary::XMLSchema::boolean() );
-    m_variantHash.insert( QVariant::Double, Soprano::Vocabulary::XMLSchema::xsdDouble() );
-    m_variantHash.insert( QVariant::String, Soprano::Vocabulary::XMLSchema::string() );
-    m_variantHash.insert( QVariant::Date, Soprano::Vocabulary::XMLSchema::date() );
-    m_variantHash.insert( QVariant::Time, Soprano::Vocabulary::XMLSchema::time() );
-    m_variantHash.insert( QVariant::DateTime, Soprano::Vocabulary::XMLSchema::dateTime() );
-    m_variantHash.insert( QVariant::ByteArray, Soprano::Vocabulary::XMLSchema::base64Binary() );
-}
-
-QVariant::Type XsdTypePool::typeFromDataTypeUri( const QUrl& dataTypeUri ) const
-{
-    QMutexLocker lock( &m_xsdMutex );
-    QHash<QUrl, QVariant::Type>::const_iterator it = m_xsdHash.constFind( dataTypeUri );
-    if ( it != m_xsdHash.constEnd() ) {
-        return it.value();
+    m_uris[XsdInt] = Soprano::Vocabulary::XMLSchema::xsdInt();
+    m_uris[XsdInteger] = Soprano::Vocabulary::XMLSchema::integer();
+    m_uris[XsdNegativeInteger] = Soprano::Vocabulary::XMLSchema::negativeInteger();
+    m_uris[XsdNonNegativeInteger] = Soprano::Vocabulary::XMLSchema::nonNegativeInteger();
+    m_uris[XsdDecimal] = Soprano::Vocabulary::XMLSchema::decimal();
+    m_uris[XsdShort] = Soprano::Vocabulary::XMLSchema::xsdShort();
+    m_uris[XsdLong] = Soprano::Vocabulary::XMLSchema::xsdLong();
+    m_uris[XsdUnsignedInt] = Soprano::Vocabulary::XMLSchema::unsignedInt();
+    m_uris[XsdUnsignedShort] = Soprano::Vocabulary::XMLSchema::unsignedShort();
+    m_uris[XsdUnsignedLong] = Soprano::Vocabulary::XMLSchema::unsignedLong();
+    m_uris[XsdBoolean] = Soprano::Vocabulary::XMLSchema::boolean();
+    m_uris[XsdDouble] = Soprano::Vocabulary::XMLSchema::xsdDouble();
+    m_uris[XsdFloat] = Soprano::Vocabulary::XMLSchema::xsdFloat();
+    m_uris[XsdString] = Soprano::Vocabulary::XMLSchema::string();
+    m_uris[XsdDate] = Soprano::Vocabulary::XMLSchema::date();
+    m_uris[XsdTime] = Soprano::Vocabulary::XMLSchema::time();
+    m_uris[XsdDateTime] = Soprano::Vocabulary::XMLSchema::dateTime();
+    m_uris[XsdBase64Binary] = Soprano::Vocabulary::XMLSchema::base64Binary();
+    m_uris[RdfXmlLiteral] = Soprano::Vocabulary::RDF::XMLLiteral();
+}
+
+XsdType XsdTypePool::xsdTypeFromUri( const QUrl& dataTypeUri ) const
+{
+    // Comparing the URIs directly does not allocate anything, in contrast to
+    // extracting a part of the URI. Qt caches the normalized form of a QUrl,
+    // thus each URI is only normalized once.
+    if ( dataTypeUri.isEmpty() )
+        return XsdUnknown;
+
+    for ( int i = XsdInt; i < XsdTypeCount; ++i ) {
+        if ( m_uris[i] == dataTypeUri )
+            return XsdType( i );
+    }
+
+//    qDebug() << "(Soprano::LiteralValue) unknown literal type uri:" << dataTypeUri;
+    return XsdUnknown;
+}
+
+Q_GLOBAL_STATIC( XsdTypePool, s_xsdTypePool )
+
+
+/**
+ * The lexical space of the XSD numeric types allows surrounding whitespace.
+ */
+bool trimmedRange( const QString& s, const QChar** begin, const QChar** end )
+{
+    const QChar* b = s.constData();
+    const QChar* e = b + s.length();
+    while ( b < e && b->isSpace() )
+        ++b;
+    while ( e > b && ( e-1 )->isSpace() )
+        --e;
+    *begin = b;
+    *end = e;
+    return b < e;
+}
+
+/**
+ * Parse an unsigned decimal number without creating any temporary strings.
+ * \p allowMinus allows a leading minus sign which is reported via \p negative.
+ */
+bool parseDecimal( const QString& s, bool allowMinus, qulonglong max, qulonglong* value, bool* negative )
+{
+    const QChar* c = 0;
+    const QChar* end = 0;
+    if ( !trimmedRange( s, &c, &end ) )
+        return false;
+
+    *negative = false;
+    if ( *c == QLatin1Char( '+' ) ) {
+        ++c;
+    }
+    else if ( *c == QLatin1Char( '-' ) ) {
+        if ( !allowMinus )
+            return false;
+        *negative = true;
+        ++c;
+    }
+    if ( c == end )
+        return false;
+
+    qulonglong v = 0;
+    for ( ; c < end; ++c ) {
+        const ushort u = c->unicode();
+        if ( u < '0' || u > '9' )
+            return false;
+        const uint digit = u - '0';
+        if ( v > ( max - digit ) / 10 )
+            return false;
+        v = v*10 + digit;
+    }
+    *value = v;
+    return true;
+}
+
+/**
+ * Parse a signed decimal number in the range [-max-1, max].
+ */
+bool parseSigned( const QString& s, qlonglong max, qlonglong* value )
+{
+    qulonglong v = 0;
+    bool negative = false;
+    if ( !parseDecimal( s, true, qulonglong( max ) + 1, &v, &negative ) )
+        return false;
+    if ( negative ) {
+        *value = qlonglong( 0 - v );
     }
     else {
-//        qDebug() << "(Soprano::LiteralValue) unknown literal type uri:" << dataTypeUri;
-        return QVariant::Invalid;
+        if ( v > qulonglong( max ) )
+            return false;
+        *value = qlonglong( v );
     }
+    return true;
 }
 
-QUrl XsdTypePool::dataTypeUriFromType( QVariant::Type type ) const
+bool parseUnsigned( const QString& s, qulonglong max, qulonglong* value )
 {
-    QMutexLocker lock( &m_variantMutex );
-    return m_variantHash[type];
+    bool negative = false;
+    return parseDecimal( s, false, max, value, &negative );
 }
 
-Q_GLOBAL_STATIC( XsdTypePool, s_xsdTypePool )
+bool equalsIgnoreCase( const QString& s, const char* latin1, int len )
+{
+    if ( s.length() != len )
+        return false;
+    const QChar* c = s.constData();
+    for ( int i = 0; i < len; ++i ) {
+        if ( c[i].toLower().unicode() != ushort( latin1[i] ) )
+            return false;
+    }
+    return true;
+}
 }
 
 
@@ -153,16 +319,47 @@ public:
     LanguageTag lang;
 };
 
+/**
+ * Known datatypes are only stored as an XsdType tag. The full
+ * dtUri is only kept for datatypes we do not know.
+ */
 class Soprano::LiteralValue::TypedData : public Soprano::LiteralValue::LiteralValueData
 {
 public:
     TypedData( const QVariant & value )
-        : LiteralValueData(value) {
+        : LiteralValueData( value ),
+          xsdType( defaultXsdType( value.type() ) ) {
+    }
+
+    TypedData( const QVariant & value, XsdType type )
+        : LiteralValueData( value ),
+          xsdType( type ) {
     }
 
     virtual bool isPlain() const { return false; }
-    virtual QUrl dataTypeUri() const { return dtUri; }
+    virtual QUrl dataTypeUri() const {
+        return xsdType != XsdUnknown ? s_xsdTypePool()->uri( xsdType ) : dtUri;
+    }
+
+    void setDataType( XsdType type, const QUrl& uri ) const {
+        if ( type != XsdUnknown ) {
+            xsdType = type;
+            dtUri = QUrl();
+        }
+        else if ( !uri.isEmpty() ) {
+            xsdType = XsdUnknown;
+            dtUri = uri;
+        }
+    }
 
+    bool sameDataType( const TypedData* other ) const {
+        if ( xsdType != XsdUnknown || other->xsdType != XsdUnknown )
+            return xsdType == other->xsdType;
+        else
+            return dtUri == other->dtUri;
+    }
+
+    mutable XsdType xsdType;
     mutable QUrl dtUri;
 };
 
@@ -186,12 +383,9 @@ Soprano::LiteralValue::LiteralValue( const LiteralValue& other )
 Soprano::LiteralValue::LiteralValue( const QVariant& other )
     : d( 0 )
 {
-    QUrl type = dataTypeUriFromType( other.type() );
-    if ( !type.isEmpty() ) {
-        TypedData* td = new TypedData(other);
-        td->value = other;
-        td->dtUri = type;
-        d = td;
+    const XsdType type = defaultXsdType( other.type() );
+    if ( type != XsdUnknown ) {
+        d = new TypedData( other, type );
     }
 }
 
@@ -294,10 +488,13 @@ Soprano::LiteralValue& Soprano::LiteralValue::operator=( const LiteralValue& v )
 
 Soprano::LiteralValue& Soprano::LiteralValue::operator=( int i )
 {
-    QUrl dtUri( dataTypeUri() );
+    // keep the datatype of the other types mapped to Int
     TypedData* td = new TypedData(i);
-    if ( typeFromDataTypeUri( dtUri ) == QVariant::Int ) {
-        td->dtUri = dtUri;
+    if ( d && !d.constData()->isPlain() ) {
+        const XsdType type = static_cast<const TypedData*>(d.constData())->xsdType;
+        if ( s_xsdTypeInfo[type].type == QVariant::Int ) {
+            td->xsdType = type;
+        }
     }
     d = td;
     return *this;
@@ -313,10 +510,13 @@ Soprano::LiteralValue& Soprano::LiteralValue::operator=( qlonglong i )
 
 Soprano::LiteralValue& Soprano::LiteralValue::operator=( uint i )
 {
-    QUrl dtUri( dataTypeUri() );
+    // keep the datatype of the other types mapped to UInt
     TypedData* td = new TypedData(i);
-    if ( typeFromDataTypeUri( dtUri ) == QVariant::UInt ) {
-        td->dtUri = dtUri;
+    if ( d && !d.constData()->isPlain() ) {
+        const XsdType type = static_cast<const TypedData*>(d.constData())->xsdType;
+        if ( s_xsdTypeInfo[type].type == QVariant::UInt ) {
+            td->xsdType = type;
+        }
     }
     d = td;
     return *this;
@@ -588,9 +788,6 @@ QVariant Soprano::LiteralValue::variant() const
 QUrl Soprano::LiteralValue::dataTypeUri() const
 {
     if ( d ) {
-        if ( !d->isPlain() && d->dataTypeUri().isEmpty() ) {
-            static_cast<const TypedData*>(d.constData())->dtUri = LiteralValue::dataTypeUriFromType( type() );
-        }
         return d->dataTypeUri();
     }
     else {
@@ -613,6 +810,9 @@ bool Soprano::LiteralValue::operator==( const LiteralValue& other ) const
     if ( isPlain() ) {
         return language() == other.language();
     }
+    else if ( d && other.d ) {
+        return static_cast<const TypedData*>(d.constData())->sameDataType( static_cast<const TypedData*>(other.d.constData()) );
+    }
     else {
         return dataTypeUri() == other.dataTypeUri();
     }
@@ -621,21 +821,14 @@ bool Soprano::LiteralValue::operator==( const LiteralValue& other ) const
 
 bool Soprano::LiteralValue::operator!=( const LiteralValue& other ) const
 {
-    if ( variant() != other.variant() ||
-         isPlain() != other.isPlain() )
-        return true;
-
-    if ( isPlain() ) {
-        return language() != other.language();
-    }
-    else {
-        return dataTypeUri() != other.dataTypeUri();
-    }
+    return !operator==( other );
 }
 
 
 Soprano::LiteralValue Soprano::LiteralValue::fromString( const QString& value, QVariant::Type type )
 {
+    // numbers and booleans are parsed directly from the string data
+    // to avoid the temporary byte arrays created by QString::toInt and friends.
     switch( type ) {
     case QVariant::String:
         return LiteralValue( value );
@@ -647,33 +840,29 @@ Soprano::LiteralValue Soprano::LiteralValue::fromString( const QString& value, Q
             return LiteralValue();
     }
     case QVariant::Int: {
-        bool ok = false;
-        int val = value.toInt(&ok);
-        if(ok)
-            return LiteralValue( val );
+        qlonglong val = 0;
+        if( parseSigned( value, std::numeric_limits<int>::max(), &val ) )
+            return LiteralValue( int( val ) );
         else
             return LiteralValue();
     }
     case QVariant::LongLong: {
-        bool ok = false;
-        qlonglong val = value.toLongLong(&ok);
-        if(ok)
+        qlonglong val = 0;
+        if( parseSigned( value, std::numeric_limits<qlonglong>::max(), &val ) )
             return LiteralValue( val );
         else
             return LiteralValue();
     }
     case QVariant::UInt: {
-        bool ok = false;
-        uint val = value.toUInt(&ok);
-        if(ok)
-            return LiteralValue( val );
+        qulonglong val = 0;
+        if( parseUnsigned( value, std::numeric_limits<uint>::max(), &val ) )
+            return LiteralValue( uint( val ) );
         else
             return LiteralValue();
     }
     case QVariant::ULongLong: {
-        bool ok = false;
-        qulonglong val = value.toULongLong(&ok);
-        if(ok)
+        qulonglong val = 0;
+        if( parseUnsigned( value, std::numeric_limits<qulonglong>::max(), &val ) )
             return LiteralValue( val );
         else
             return LiteralValue();
@@ -701,13 +890,12 @@ Soprano::LiteralValue Soprano::LiteralValue::fromString( const QString& value, Q
             return LiteralValue();
     }
     case QVariant::Bool: {
-        bool ok = false;
-        int v = value.toInt(&ok);
-        if(ok)
-            return LiteralValue(v != 0);
-        else if( value.toLower() == "true" || value.toLower() == "yes" )
+        qlonglong v = 0;
+        if( parseSigned( value, std::numeric_limits<int>::max(), &v ) )
+            return LiteralValue( v != 0 );
+        else if( equalsIgnoreCase( value, "true", 4 ) || equalsIgnoreCase( value, "yes", 3 ) )
             return LiteralValue( true );
-        else if( value.toLower() == "false" || value.toLower() == "no" )
+        else if( equalsIgnoreCase( value, "false", 5 ) || equalsIgnoreCase( value, "no", 2 ) )
             return LiteralValue( false );
         else
             return LiteralValue();
@@ -727,10 +915,11 @@ Soprano::LiteralValue Soprano::LiteralValue::fromString( const QString& value, c
         return LiteralValue();
     }
     else {
-        LiteralValue v = LiteralValue::fromString( value, typeFromDataTypeUri( type ) );
+        const XsdType xsdType = s_xsdTypePool()->xsdTypeFromUri( type );
+        LiteralValue v = LiteralValue::fromString( value, s_xsdTypeInfo[xsdType].type );
         Q_ASSERT(!v.isPlain());
         if( v.isValid() ) {
-            static_cast<const TypedData*>(v.d.constData())->dtUri = type;
+            static_cast<const TypedData*>(v.d.constData())->setDataType( xsdType, type );
         }
         return v;
     }
@@ -739,10 +928,12 @@ Soprano::LiteralValue Soprano::LiteralValue::fromString( const QString& value, c
 
 Soprano::LiteralValue Soprano::LiteralValue::fromVariant( const QVariant& value, const QUrl& dataType )
 {
+    const XsdType xsdType = s_xsdTypePool()->xsdTypeFromUri( dataType );
+
     //
     // Special case: time_t -> datetime
     //
-    if( dataType == Vocabulary::XMLSchema::dateTime() &&
+    if( xsdType == XsdDateTime &&
         value.canConvert(QVariant::Int) ) {
         bool ok = false;
         int time = value.toInt(&ok);
@@ -751,7 +942,7 @@ Soprano::LiteralValue Soprano::LiteralValue::fromVariant( const QVariant& value,
         }
     }
 
-    const QVariant::Type literalType = typeFromDataTypeUri( dataType );
+    const QVariant::Type literalType = s_xsdTypeInfo[xsdType].type;
     if( value.canConvert(literalType) ) {
         LiteralValue v;
         bool ok = false;
@@ -789,7 +980,7 @@ Soprano::LiteralValue Soprano::LiteralValue::fromVariant( const QVariant& value,
 
         if( v.isValid() && ok ) {
             // fixup the datatype
-            static_cast<const TypedData*>(v.d.constData())->dtUri = dataType;
+            static_cast<const TypedData*>(v.d.constData())->setDataType( xsdType, dataType );
             return v;
         }
     }
@@ -809,13 +1000,14 @@ Soprano::LiteralValue Soprano::LiteralValue::createPlainLiteral( const QString&
 
 QVariant::Type Soprano::LiteralValue::typeFromDataTypeUri( const QUrl& dataTypeUri )
 {
-    return s_xsdTypePool()->typeFromDataTypeUri(dataTypeUri);
+    return s_xsdTypeInfo[s_xsdTypePool()->xsdTypeFromUri(dataTypeUri)].type;
 }
 
 
 QUrl Soprano::LiteralValue::dataTypeUriFromType( QVariant::Type type )
 {
-    return s_xsdTypePool()->dataTypeUriFromType(type);
+    const XsdType xsdType = defaultXsdType( type );
+    return xsdType != XsdUnknown ? s_xsdTypePool()->uri( xsdType ) : QUrl();
 }
 
 
@@ -25,10 +25,20 @@
 #include "node.h"
 #include "statement.h"
 #include "statementiterator.h"
+#include "nodeiterator.h"
+#include "util/pagediteratorbackend.h"
+#include "preparedquery.h"
+#include "query/parameterizedquery.h"
 
 #include <QtCore/QList>
 
 
+namespace {
+    /// the maximum number of statements counted by the default estimateCount()
+    const int s_estimateLimit = 1000;
+}
+
+
 class Soprano::Model::Private
 {
 public:
@@ -86,6 +96,24 @@ Soprano::StatementIterator Soprano::Model::listStatementsInContext( const Node &
 }
 
 
+Soprano::StatementIterator Soprano::Model::listStatements( const Statement& partial, int offset, int limit ) const
+{
+    StatementIterator it = listStatements( partial );
+    if ( !it.isValid() )
+        return it;
+    return new Util::PagedIteratorBackend<Statement>( it, qMax( 0, offset ), limit );
+}
+
+
+Soprano::NodeIterator Soprano::Model::listContexts( int offset, int limit ) const
+{
+    NodeIterator it = listContexts();
+    if ( !it.isValid() )
+        return it;
+    return new Util::PagedIteratorBackend<Node>( it, qMax( 0, offset ), limit );
+}
+
+
 Soprano::Error::ErrorCode Soprano::Model::removeStatement( const Node& subject, const Node& predicate, const Node& object, const Node& context )
 {
     return removeStatement( Statement( subject, predicate, object, context ) );
@@ -130,6 +158,21 @@ Soprano::Error::ErrorCode Soprano::Model::removeAllStatements()
 }
 
 
+QList<Soprano::Statement> Soprano::Model::takeAllStatements( const Statement& statement )
+{
+    QList<Statement> statements = listStatements( statement ).allStatements();
+    if ( lastError() ) {
+        return QList<Statement>();
+    }
+
+    if ( removeAllStatements( statement ) != Error::ErrorNone ) {
+        return QList<Statement>();
+    }
+
+    return statements;
+}
+
+
 Soprano::Error::ErrorCode Soprano::Model::addStatement( const Node& subject, const Node& predicate, const Node& object, const Node& context )
 {
     return addStatement( Statement( subject, predicate, object, context ) );
@@ -161,6 +204,81 @@ bool Soprano::Model::containsAnyStatement( const Node& subject, const Node& pred
 }
 
 
+QBitArray Soprano::Model::containsStatements( const QList<Statement>& statements ) const
+{
+    QBitArray result( statements.count() );
+    for ( int i = 0; i < statements.count(); ++i ) {
+        const bool contained = containsStatement( statements[i] );
+        if ( lastError() )
+            return QBitArray();
+        result.setBit( i, contained );
+    }
+    clearError();
+    return result;
+}
+
+
+Soprano::PreparedQuery Soprano::Model::prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    clearError();
+    return new Query::SubstitutingPreparedQueryBackend( this, query, language, userQueryLanguage );
+}
+
+
+int Soprano::Model::estimateCount( const Statement& pattern ) const
+{
+    if ( !pattern.subject().isValid() &&
+         !pattern.predicate().isValid() &&
+         !pattern.object().isValid() &&
+         !pattern.context().isValid() ) {
+        return statementCount();
+    }
+
+    StatementIterator it = listStatements( pattern );
+    if ( !it.isValid() )
+        return -1;
+
+    int cnt = 0;
+    while ( cnt < s_estimateLimit && it.next() )
+        ++cnt;
+    it.close();
+    if ( it.lastError() ) {
+        setError( it.lastError() );
+        return -1;
+    }
+    clearError();
+    return cnt;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Model::predicateStatistics() const
+{
+    QHash<Node, int> counts;
+    StatementIterator it = listStatements();
+    if ( !it.isValid() )
+        return counts;
+
+    while ( it.next() )
+        ++counts[it.current().predicate()];
+    setError( it.lastError() );
+    return counts;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Model::contextStatistics() const
+{
+    QHash<Node, int> counts;
+    StatementIterator it = listStatements();
+    if ( !it.isValid() )
+        return counts;
+
+    while ( it.next() )
+        ++counts[it.current().context()];
+    setError( it.lastError() );
+    return counts;
+}
+
+
 Soprano::Error::ErrorCode Soprano::Model::write( QTextStream &os ) const
 {
     StatementIterator it = listStatements();
@@ -25,6 +25,8 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QList>
+#include <QtCore/QHash>
+#include <QtCore/QBitArray>
 
 #include "soprano_export.h"
 #include "error.h"
@@ -37,6 +39,7 @@ namespace Soprano
 {
     class QueryLegacy;
     class QueryResultIterator;
+    class PreparedQuery;
     class Statement;
     class StatementIterator;
     class NodeIterator;
@@ -112,9 +115,20 @@ namespace Soprano
         Error::ErrorCode addStatement( const Node& subject, const Node& predicate, const Node& object, const Node& context = Node() );
 
         /**
-         * \overload
+         * Add a list of statements to the Model.
+         *
+         * The default implementation calls addStatement() for each statement and stops
+         * at the first error. Backends which provide a faster way of loading many
+         * statements at once reimplement this method.
+         *
+         * \param statements The statements to add.
+         *
+         * \return Error::ErrorNone on success or the error code of the first statement
+         * that could not be added.
+         *
+         * The method is virtual since %Soprano 2.10.
          */
-        Error::ErrorCode addStatements( const QList<Statement> &statements );
+        virtual Error::ErrorCode addStatements( const QList<Statement> &statements );
         //@}
 
         //@{
@@ -166,6 +180,24 @@ namespace Soprano
          * Convenience method that clear the Model of all statements
          */
         Error::ErrorCode removeAllStatements();
+
+        /**
+         * Remove all statements that match the partial statement and return them.
+         * Use this method instead of listing the matching statements and removing them
+         * one by one. If the removed statements are not needed removeAllStatements()
+         * is faster.
+         *
+         * The default implementation lists the matching statements and then removes them
+         * with one call to removeAllStatements().
+         *
+         * \param statement A possible partially defined statement that serves as
+         * a filter for all statements that should be removed.
+         *
+         * \return The removed statements. Check lastError() for errors.
+         *
+         * \since 2.10
+         */
+        virtual QList<Statement> takeAllStatements( const Statement &statement );
         //@}
 
 
@@ -206,6 +238,28 @@ namespace Soprano
          */
         StatementIterator listStatementsInContext( const Node &context ) const;
 
+        /**
+         * List one page of the statements matching \p partial. Long listings can be split
+         * into short requests this way, none of which keeps the model locked for long.
+         *
+         * The order of the statements is defined by the backend but does not change as long
+         * as the model is not modified. Thus, consecutive pages are fetched by increasing the
+         * offset. If the model is modified in between, statements may be skipped or returned twice.
+         *
+         * The default implementation skips the first \p offset statements of
+         * listStatements(const Statement&). Backends reimplement it to position
+         * their iterators natively.
+         *
+         * \param partial The partial Statement to match.
+         * \param offset The number of matching statements to skip.
+         * \param limit The maximum number of statements to return, -1 for no limit.
+         *
+         * \return An iterator for the matched Statements, on error an invalid iterator is returned.
+         *
+         * \since 2.10
+         */
+        virtual StatementIterator listStatements( const Statement& partial, int offset, int limit ) const;
+
         /**
          * List all contexts in the model, i.e. all named graphs.
          *
@@ -213,6 +267,21 @@ namespace Soprano
          */
         virtual NodeIterator listContexts() const = 0;
 
+        /**
+         * List one page of the contexts in the model. Pages are defined as for
+         * listStatements(const Statement&, int, int).
+         *
+         * The default implementation skips the first \p offset contexts of listContexts().
+         *
+         * \param offset The number of contexts to skip.
+         * \param limit The maximum number of contexts to return, -1 for no limit.
+         *
+         * \return An iterator over context Nodes, on error an invalid iterator is returned.
+         *
+         * \since 2.10
+         */
+        virtual NodeIterator listContexts( int offset, int limit ) const;
+
         /** \cond query_api_disabled */
 
         /**
@@ -246,6 +315,27 @@ namespace Soprano
          * on error an invalid iterator is returned.
          */
         virtual QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const = 0;
+
+        /**
+         * Prepare a query which contains parameters for repeated execution. Parameters
+         * are written as \p %name and bound through PreparedQuery::bindValue().
+         *
+         * Models which are able to reuse a parsed query should reimplement this method.
+         * The default implementation replaces the parameters with the N3 representation
+         * of the bound values and runs the resulting query through executeQuery().
+         *
+         * \param query The query containing parameters.
+         * \param language The %query language used to encode \p query.
+         * \param userQueryLanguage If \p language equals Query::QueryLanguageUser
+         * userQueryLanguage defines the language to use.
+         *
+         * \return The prepared query, on error an invalid query is returned.
+         *
+         * \sa PreparedQuery
+         *
+         * \since 2.10
+         */
+        virtual PreparedQuery prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
         //@}
 
 
@@ -288,6 +378,25 @@ namespace Soprano
          */
         bool containsStatement( const Node& subject, const Node& predicate, const Node& object, const Node& context = Node() ) const;
 
+        /**
+         * Check which of \p statements the model contains. Use this method instead of
+         * calling containsStatement() for each statement, for example to skip the existing
+         * statements of an import.
+         *
+         * The default implementation calls containsStatement() for each statement.
+         * Backends reimplement it to check all statements in one request.
+         *
+         * \param statements The statements in question. All of them have to be valid. Empty
+         * contexts refer to the default graph.
+         *
+         * \return A bit array with one bit per statement which is set if the Model contains
+         * the statement. On error or if one of the statements is invalid an empty bit array
+         * is returned.
+         *
+         * \since 2.10
+         */
+        virtual QBitArray containsStatements( const QList<Statement>& statements ) const;
+
         /**
          * Convenience method which is based on containsAnyStatement
          */
@@ -303,6 +412,50 @@ namespace Soprano
          * \return The size of the Model, or -1 on error.
          */
         virtual int statementCount() const = 0;
+
+        /**
+         * Estimate the number of statements matching \p pattern without listing them.
+         * The estimate is meant for cheap cost decisions like the ordering of joins.
+         * It is not guaranteed to be exact, but 0 is only returned if no statement matches.
+         *
+         * The default implementation returns statementCount() for an empty pattern.
+         * Otherwise it counts the matching statements, but at most 1000 of them, which
+         * is then reported for all bigger results. Backends which keep statistics
+         * reimplement this method.
+         *
+         * \param pattern A possibly partially defined statement. Empty nodes act as wildcards.
+         *
+         * \return The estimated number of matching statements or -1 on error.
+         *
+         * \since 2.10
+         */
+        virtual int estimateCount( const Statement& pattern ) const;
+
+        /**
+         * The number of statements per predicate.
+         *
+         * The default implementation lists all statements once. Backends which keep
+         * statistics reimplement this method. The counts are allowed to be estimates.
+         *
+         * \return A hash mapping each predicate to the number of statements using it.
+         * Check lastError() for errors.
+         *
+         * \since 2.10
+         */
+        virtual QHash<Node, int> predicateStatistics() const;
+
+        /**
+         * The number of statements per context.
+         *
+         * The default implementation lists all statements once. Backends which keep
+         * statistics reimplement this method. The counts are allowed to be estimates.
+         *
+         * \return A hash mapping each context to the number of statements in it. The
+         * default graph is represented by an empty node. Check lastError() for errors.
+         *
+         * \since 2.10
+         */
+        virtual QHash<Node, int> contextStatistics() const;
         //@}
 
 
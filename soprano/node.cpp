@@ -27,83 +27,68 @@
 #include <QtCore/QString>
 #include <QtCore/QUrl>
 #include <QtCore/QDebug>
+#include <QtCore/QAtomicInt>
 #include <QMutex>
 
 
-
-class Soprano::Node::NodeData : public QSharedData
-{
-public:
-    NodeData() {}
-    virtual ~NodeData() {}
-
-    virtual Type type() const = 0;
-    virtual QString toString() const = 0;
-    virtual QString toN3() const = 0;
-};
-
-class Soprano::Node::ResourceNodeData : public NodeData
-{
-public:
-    ResourceNodeData( const QUrl& uri_ = QUrl() )
-        : NodeData(),
-          uri( uri_ ){
+namespace {
+    // The cached hash is written from const methods, possibly by several threads
+    // at once. They all compute the same value, thus relaxed ordering suffices.
+    inline uint loadHash( const QAtomicInt& hash ) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+        return uint( int( hash ) );
+#else
+        return uint( hash.load() );
+#endif
     }
 
-    QUrl uri;
-
-    Type type() const { return ResourceNode; }
-
-    QString toString() const {
-        return uri.toString();
+    inline void storeHash( QAtomicInt& hash, uint value ) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+        hash = int( value );
+#else
+        hash.store( int( value ) );
+#endif
     }
+}
+
 
-    QString toN3() const {
-        return Node::resourceToN3( uri );
-    }
-};
 
-class Soprano::Node::BNodeData : public NodeData
+/*
+ * One data class for all node types. The type is stored as a tag instead of
+ * using virtual methods, thus type checks do not need an indirect call. The
+ * unused members are null and do not allocate anything.
+ */
+class Soprano::Node::NodeData : public QSharedData
 {
 public:
-    BNodeData( const QString& id = QString() )
-        : NodeData(),
-          identifier( id ) {
+    NodeData( const QUrl& uri_ )
+        : type( ResourceNode ),
+          uri( uri_ ),
+          hash( 0 ) {
     }
 
-    QString identifier;
-
-    Type type() const { return BlankNode; }
-
-    QString toString() const {
-        return identifier;
+    NodeData( const QString& id )
+        : type( BlankNode ),
+          identifier( id ),
+          hash( 0 ) {
     }
 
-    QString toN3() const {
-        return Node::blankToN3( identifier );
+    NodeData( const LiteralValue& val )
+        : type( LiteralNode ),
+          value( val ),
+          hash( 0 ) {
     }
-};
 
-class Soprano::Node::LiteralNodeData : public NodeData
-{
-public:
-    LiteralNodeData( const LiteralValue& val = LiteralValue() )
-        : NodeData(),
-          value( val )
-    {
-    }
+    // The type is stored as a tag instead of using virtual methods. The
+    // members not used by the type are null and do not allocate anything.
+    Type type;
 
+    QUrl uri;
+    QString identifier;
     LiteralValue value;
 
-    Type type() const { return LiteralNode; }
-
-    QString toString() const {
-        return value.toString();
-    }
-
-    QString toN3() const {
-        return Node::literalToN3( value );
-    }
+    // the cached result of qHash(), 0 if not calculated yet
+    mutable QAtomicInt hash;
 };
 
 
@@ -120,7 +105,7 @@ Soprano::Node::Node( const Node &other )
 Soprano::Node::Node( const QUrl &uri )
 {
     if( !uri.isEmpty() ) {
-        d = new ResourceNodeData( uri );
+        d = new NodeData( uri );
     }
     else {
         d = 0;
@@ -130,7 +115,7 @@ Soprano::Node::Node( const QUrl &uri )
 Soprano::Node::Node( const QString &id )
 {
     if( !id.isEmpty() ) {
-        d = new BNodeData( id );
+        d = new NodeData( id );
     }
     else {
         d = 0;
@@ -140,7 +125,7 @@ Soprano::Node::Node( const QString &id )
 Soprano::Node::Node( const LiteralValue& value )
 {
     if ( value.isValid() ) {
-        d = new LiteralNodeData( value );
+        d = new NodeData( value );
     }
     else {
         d = 0;
@@ -156,7 +141,7 @@ Soprano::Node::Node( const LiteralValue& value, const QString& lang )
         } else {
             lit = LiteralValue::createPlainLiteral( value.toString(), lang );
         }
-        d = new LiteralNodeData( lit );
+        d = new NodeData( lit );
     }
     else {
         d = 0;
@@ -169,7 +154,7 @@ Soprano::Node::~Node()
 
 bool Soprano::Node::isEmpty() const
 {
-    return ( !d || d->type() == Soprano::Node::EmptyNode );
+    return !d;
 }
 
 bool Soprano::Node::isValid() const
@@ -179,28 +164,28 @@ bool Soprano::Node::isValid() const
 
 bool Soprano::Node::isLiteral() const
 {
-    return ( d && d->type() == Soprano::Node::LiteralNode );
+    return ( d && d->type == Soprano::Node::LiteralNode );
 }
 
 bool Soprano::Node::isResource() const
 {
-    return ( d && d->type() == Soprano::Node::ResourceNode );
+    return ( d && d->type == Soprano::Node::ResourceNode );
 }
 
 bool Soprano::Node::isBlank() const
 {
-    return ( d && d->type() == Soprano::Node::BlankNode );
+    return ( d && d->type == Soprano::Node::BlankNode );
 }
 
 Soprano::Node::Type Soprano::Node::type() const
 {
-    return d ? d->type() : EmptyNode;
+    return d ? d->type : EmptyNode;
 }
 
 QUrl Soprano::Node::uri() const
 {
     if ( isResource() ) {
-        return static_cast<const ResourceNodeData*>( d.constData() )->uri;
+        return d->uri;
     }
     else {
         return QUrl();
@@ -211,7 +196,7 @@ QUrl Soprano::Node::uri() const
 QString Soprano::Node::identifier() const
 {
     if ( isBlank() ) {
-        return static_cast<const BNodeData*>( d.constData() )->identifier;
+        return d->identifier;
     }
     else {
         return QString();
@@ -222,7 +207,7 @@ QString Soprano::Node::identifier() const
 Soprano::LiteralValue Soprano::Node::literal() const
 {
     if ( isLiteral() ) {
-        return static_cast<const LiteralNodeData*>( d.constData() )->value;
+        return d->value;
     }
     else {
         return LiteralValue();
@@ -232,7 +217,7 @@ Soprano::LiteralValue Soprano::Node::literal() const
 QUrl Soprano::Node::dataType() const
 {
     if ( isLiteral() ) {
-        return static_cast<const LiteralNodeData*>( d.constData() )->value.dataTypeUri();
+        return d->value.dataTypeUri();
     }
     else {
         return QUrl();
@@ -246,12 +231,30 @@ QString Soprano::Node::language() const
 
 QString Soprano::Node::toString() const
 {
-    return d ? d->toString() : QString();
+    switch ( type() ) {
+    case ResourceNode:
+        return d->uri.toString();
+    case BlankNode:
+        return d->identifier;
+    case LiteralNode:
+        return d->value.toString();
+    default:
+        return QString();
+    }
 }
 
 QString Soprano::Node::toN3() const
 {
-    return d ? d->toN3() : QString();
+    switch ( type() ) {
+    case ResourceNode:
+        return resourceToN3( d->uri );
+    case BlankNode:
+        return blankToN3( d->identifier );
+    case LiteralNode:
+        return literalToN3( d->value );
+    default:
+        return QString();
+    }
 }
 
 Soprano::Node& Soprano::Node::operator=( const Node& other )
@@ -263,7 +266,7 @@ Soprano::Node& Soprano::Node::operator=( const Node& other )
 Soprano::Node& Soprano::Node::operator=( const QUrl& resource )
 {
     if ( !resource.isEmpty() ) {
-        d = new ResourceNodeData( resource );
+        d = new NodeData( resource );
     }
     else {
         d = 0;
@@ -274,7 +277,7 @@ Soprano::Node& Soprano::Node::operator=( const QUrl& resource )
 Soprano::Node& Soprano::Node::operator=( const LiteralValue& literal )
 {
     if ( literal.isValid() ) {
-        d = new LiteralNodeData( literal );
+        d = new NodeData( literal );
     }
     else {
         d = 0;
@@ -288,17 +291,17 @@ bool Soprano::Node::operator==( const Node& other ) const
         return false;
     }
     else if ( type() != EmptyNode ) {
-        if ( d->type() == ResourceNode ) {
-            return(  static_cast<const ResourceNodeData*>( d.constData() )->uri ==
-                     static_cast<const ResourceNodeData*>( other.d.constData() )->uri );
+        if ( d->type == ResourceNode ) {
+            return(  d->uri ==
+                     other.d->uri );
         }
-        else if ( d->type() == BlankNode ) {
-            return( static_cast<const BNodeData*>( d.constData() )->identifier ==
-                    static_cast<const BNodeData*>( other.d.constData() )->identifier );
+        else if ( d->type == BlankNode ) {
+            return( d->identifier ==
+                    other.d->identifier );
         }
-        else if ( d->type() == LiteralNode ) {
-            return ( static_cast<const LiteralNodeData*>( d.constData() )->value ==
-                     static_cast<const LiteralNodeData*>( other.d.constData() )->value );
+        else if ( d->type == LiteralNode ) {
+            return ( d->value ==
+                     other.d->value );
         }
     }
 
@@ -313,16 +316,16 @@ bool Soprano::Node::operator!=( const Node& other ) const
     }
 
     else if ( type() == ResourceNode ) {
-        return(  static_cast<const ResourceNodeData*>( d.constData() )->uri
-                 != static_cast<const ResourceNodeData*>( other.d.constData() )->uri );
+        return(  d->uri
+                 != other.d->uri );
     }
     else if ( type() == BlankNode ) {
-        return( static_cast<const BNodeData*>( d.constData() )->identifier !=
-                static_cast<const BNodeData*>( other.d.constData() )->identifier );
+        return( d->identifier !=
+                other.d->identifier );
     }
     else if ( type() == LiteralNode ) {
-        return ( static_cast<const LiteralNodeData*>( d.constData() )->value !=
-                 static_cast<const LiteralNodeData*>( other.d.constData() )->value );
+        return ( d->value !=
+                 other.d->value );
     }
     else {
         // empty nodes are always equal
@@ -528,19 +531,23 @@ QTextStream& operator>>( QTextStream& s, Soprano::Node& n )
 
 uint Soprano::qHash( const Soprano::Node& node )
 {
-    uint hashVal;
-    switch ( node.type() ) {
-    case Soprano::Node::EmptyNode:
-        hashVal = 0;
-        break;
+    if ( !node.d )
+        return 0;
+
+    // nodes are immutable, thus the hash can be cached in the shared data
+    uint hashVal = loadHash( node.d->hash );
+    if ( hashVal )
+        return hashVal;
+
+    switch ( node.d->type ) {
     case Soprano::Node::ResourceNode:
-        hashVal = qHash( node.uri() );
+        hashVal = qHash( node.d->uri );
         break;
     case Soprano::Node::LiteralNode:
-        hashVal = qHash( node.literal() );
+        hashVal = qHash( node.d->value );
         break;
     case Soprano::Node::BlankNode:
-        hashVal = qHash( node.identifier() );
+        hashVal = qHash( node.d->identifier );
         break;
     default:
         // Should never get here
@@ -550,9 +557,12 @@ uint Soprano::qHash( const Soprano::Node& node )
 
     // Rotate bits so as to further distinguish node types with the
     // same string
-    uint typeInt( ((uint)node.type()) & 0x1F );
+    uint typeInt( ((uint)node.d->type) & 0x1F );
     hashVal = (hashVal << typeInt) | (hashVal >> (0x20 - typeInt));
 
+    // a hash value of 0 is simply calculated again the next time
+    storeHash( node.d->hash, hashVal );
+
     return hashVal;
 }
 
@@ -34,6 +34,9 @@
 
 namespace Soprano
 {
+    class Node;
+    SOPRANO_EXPORT uint qHash( const Node& node );
+
     /**
      * \class Node node.h Soprano/Node
      *
@@ -125,6 +128,15 @@ namespace Soprano
          */
         Node( const Node &other );
 
+#if defined(Q_COMPILER_RVALUE_REFS) && QT_VERSION >= 0x040800
+        /**
+         * Move constructor. \p other is left as an empty node.
+         *
+         * \since 2.10
+         */
+        inline Node( Node&& other ) { d.swap( other.d ); }
+#endif
+
         ~Node();
         //@}
 
@@ -134,6 +146,15 @@ namespace Soprano
         //@{
         Node& operator=( const Node& other );
 
+#if defined(Q_COMPILER_RVALUE_REFS) && QT_VERSION >= 0x040800
+        /**
+         * Move assignment. \p other takes over the previous value of this node.
+         *
+         * \since 2.10
+         */
+        inline Node& operator=( Node&& other ) { d.swap( other.d ); return *this; }
+#endif
+
         /**
          * Assigns \p resource to this node and makes it a ResourceNode.
          */
@@ -499,10 +520,9 @@ namespace Soprano
 
     private:
         class NodeData;
-        class ResourceNodeData;
-        class BNodeData;
-        class LiteralNodeData;
         QSharedDataPointer<NodeData> d;
+
+        friend uint qHash( const Node& node );
     };
 
     /**
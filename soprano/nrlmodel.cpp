@@ -29,6 +29,8 @@
 #include "vocabulary/rdfs.h"
 #include "vocabulary/xsd.h"
 #include "queryresultiterator.h"
+#include "preparedquery.h"
+#include "bindingset.h"
 #include "statementiterator.h"
 #include "nodeiterator.h"
 #include "node.h"
@@ -38,6 +40,8 @@
 #include <QtCore/QDateTime>
 #include <QtCore/QMutex>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QHash>
+#include <QtCore/QSet>
 #include <QtCore/QDebug>
 
 
@@ -55,7 +59,9 @@ public:
     Private()
         : ignoreContext( true ),
           m_expandQueryPrefixes( false ),
-          m_prefixMapMutex( QMutex::Recursive ) {
+          m_prefixMapMutex( QMutex::Recursive ),
+          m_cardinalityQueryModel( 0 ),
+          m_cardinalitiesLoaded( false ) {
     }
 
     /**
@@ -91,6 +97,239 @@ public:
         }
     }
 
+    /**
+     * Add the declarations of the known prefixes used in a SPARQL query
+     */
+    QString expandPrefixes( const QString& query, Query::QueryLanguage language ) {
+        QString expandedQuery( query );
+
+        if ( language == Query::QueryLanguageSparql &&
+             m_expandQueryPrefixes ) {
+            m_prefixMapMutex.lock();
+            QHash<QString, QUrl> prefixes = m_prefixes;
+            m_prefixMapMutex.unlock();
+
+            // find position in the query to add the prefixes to: directly before the actual query start
+            // certain backends like the virtuoso one support SPARQL extensions which need to be before the
+            // prefixes
+            const int pos = expandedQuery.indexOf(QRegExp(QLatin1String("select|describe|construct|ask"), Qt::CaseInsensitive));
+            if(pos >= 0) {
+                for ( QHash<QString, QUrl>::const_iterator it = prefixes.constBegin();
+                      it != prefixes.constEnd(); ++it ) {
+                    QString prefix = it.key();
+                    QUrl ns = it.value();
+
+                    // very stupid check for the prefix usage
+                    if ( expandedQuery.contains( prefix + ':' ) ) {
+                        // if the prefix is not defined add it
+                        if ( !expandedQuery.contains( QRegExp( QString::fromLatin1( "[pP][rR][eE][fF][iI][xX]\\s*%1\\s*:\\s*<%2>" )
+                                                               .arg( prefix )
+                                                               .arg( QRegExp::escape( ns.toString() ) ) ) ) ) {
+                            expandedQuery.insert( pos, QString( "prefix %1: <%2> " ).arg( prefix ).arg( ns.toString() ) );
+                        }
+                    }
+                }
+            }
+        }
+
+        return expandedQuery;
+    }
+
+    /**
+     * The query for the cardinality restrictions of a property %p, prepared
+     * once per parent model. Used to refresh single predicates in the
+     * cardinality table.
+     */
+    PreparedQuery cardinalityQuery() {
+        QMutexLocker lock( &m_cardinalityQueryMutex );
+        if ( !m_cardinalityQuery.isValid() || m_cardinalityQueryModel != q->parentModel() ) {
+            m_cardinalityQueryModel = q->parentModel();
+            m_cardinalityQuery = q->FilterModel::prepareQuery( QString( "select ?min ?max ?c where { { %p <%1> ?min } UNION { %p <%2> ?max } UNION { %p <%3> ?c } }" )
+                                                               .arg( Vocabulary::NRL::minCardinality().toString() )
+                                                               .arg( Vocabulary::NRL::maxCardinality().toString() )
+                                                               .arg( Vocabulary::NRL::cardinality().toString() ),
+                                                               Query::QueryLanguageSparql );
+        }
+        return m_cardinalityQuery;
+    }
+
+    /**
+     * The cardinality restrictions of one predicate, -1 if not defined.
+     */
+    struct Cardinality {
+        Cardinality()
+            : min( -1 ),
+              max( -1 ),
+              cardinality( -1 ) {
+        }
+
+        bool isRestricted() const {
+            return min >= 0 || max >= 0 || cardinality >= 0;
+        }
+
+        /// merge one cardinality statement
+        bool set( const QUrl& property, const Node& value ) {
+            if ( !value.isLiteral() )
+                return false;
+            if ( property == Vocabulary::NRL::minCardinality() )
+                min = value.literal().toInt();
+            else if ( property == Vocabulary::NRL::maxCardinality() )
+                max = value.literal().toInt();
+            else if ( property == Vocabulary::NRL::cardinality() )
+                cardinality = value.literal().toInt();
+            else
+                return false;
+            return true;
+        }
+
+        int min;
+        int max;
+        int cardinality;
+    };
+
+    static bool isCardinalityProperty( const Node& property ) {
+        return ( property == Vocabulary::NRL::Nodes::minCardinality() ||
+                 property == Vocabulary::NRL::Nodes::maxCardinality() ||
+                 property == Vocabulary::NRL::Nodes::cardinality() );
+    }
+
+    /**
+     * Read all cardinality restrictions of the parent model in one go.
+     * Called with m_cardinalityMutex locked.
+     */
+    bool loadCardinalities() {
+        m_cardinalities.clear();
+        m_dirtyPredicates.clear();
+
+        QueryResultIterator it = q->FilterModel::executeQuery( QString( "select ?p ?min ?max ?c where { { ?p <%1> ?min } UNION { ?p <%2> ?max } UNION { ?p <%3> ?c } }" )
+                                                               .arg( Vocabulary::NRL::minCardinality().toString() )
+                                                               .arg( Vocabulary::NRL::maxCardinality().toString() )
+                                                               .arg( Vocabulary::NRL::cardinality().toString() ),
+                                                               Query::QueryLanguageSparql );
+        if ( !it.isValid() ) {
+            q->setError( QString( "Query failed: '%1'" ).arg( q->lastError().message() ) );
+            return false;
+        }
+
+        while ( it.next() ) {
+            const Node p = it.binding( "p" );
+            if ( !p.isResource() )
+                continue;
+            Cardinality& c = m_cardinalities[p.uri()];
+            c.set( Vocabulary::NRL::minCardinality(), it.binding( "min" ) );
+            c.set( Vocabulary::NRL::maxCardinality(), it.binding( "max" ) );
+            c.set( Vocabulary::NRL::cardinality(), it.binding( "c" ) );
+        }
+
+        m_cardinalitiesLoaded = true;
+        return true;
+    }
+
+    /**
+     * Re-read the restrictions of one predicate through the prepared query.
+     * Called with m_cardinalityMutex locked.
+     */
+    bool reloadCardinality( const QUrl& predicate ) {
+        PreparedQuery query = cardinalityQuery();
+        BindingSet bindings;
+        bindings.insert( QLatin1String( "p" ), Node( predicate ) );
+
+        QueryResultIterator it = query.executeQuery( bindings );
+        if ( !it.isValid() ) {
+            q->setError( QString( "Query failed: '%1'" ).arg( query.lastError().message() ) );
+            return false;
+        }
+
+        Cardinality c;
+        while ( it.next() ) {
+            c.set( Vocabulary::NRL::minCardinality(), it.binding( "min" ) );
+            c.set( Vocabulary::NRL::maxCardinality(), it.binding( "max" ) );
+            c.set( Vocabulary::NRL::cardinality(), it.binding( "c" ) );
+        }
+
+        if ( c.isRestricted() )
+            m_cardinalities.insert( predicate, c );
+        else
+            m_cardinalities.remove( predicate );
+        m_dirtyPredicates.remove( predicate );
+        return true;
+    }
+
+    /**
+     * The restrictions of \p predicate from the cardinality table which
+     * is loaded on first use.
+     */
+    bool cardinality( const QUrl& predicate, Cardinality& c ) {
+        QMutexLocker lock( &m_cardinalityMutex );
+        if ( !m_cardinalitiesLoaded && !loadCardinalities() )
+            return false;
+        if ( m_dirtyPredicates.contains( predicate ) && !reloadCardinality( predicate ) )
+            return false;
+        c = m_cardinalities.value( predicate );
+        return true;
+    }
+
+    /**
+     * Keep the cardinality table in sync with the changes of the parent model.
+     * The statement signals are emitted while the backends might still hold locks, thus,
+     * we never query here but only mark predicates as dirty.
+     */
+    void updateCardinalities( const Statement& s, bool added ) {
+        if ( s.predicate().isValid() && !isCardinalityProperty( s.predicate() ) )
+            return;
+
+        QMutexLocker lock( &m_cardinalityMutex );
+        if ( !m_cardinalitiesLoaded )
+            return;
+
+        if ( !s.subject().isResource() || !s.predicate().isValid() ) {
+            // a removal by pattern, we do not know which predicates are affected
+            m_cardinalitiesLoaded = false;
+        }
+        else if ( added && !m_dirtyPredicates.contains( s.subject().uri() ) ) {
+            m_cardinalities[s.subject().uri()].set( s.predicate().uri(), s.object() );
+        }
+        else if ( !added ) {
+            // another graph might define the same restriction
+            m_cardinalities.remove( s.subject().uri() );
+            m_dirtyPredicates.insert( s.subject().uri() );
+        }
+    }
+
+    void invalidateCardinalities() {
+        QMutexLocker lock( &m_cardinalityMutex );
+        m_cardinalitiesLoaded = false;
+    }
+
+    /**
+     * Make room for a new value of a property with a maximum cardinality bigger than 1.
+     */
+    Error::ErrorCode enforceMaxCardinality( const Statement& statement, int max ) {
+        StatementIterator sit;
+        if ( q->ignoreContext() ) {
+            sit = q->FilterModel::listStatements( Statement( statement.subject(), statement.predicate(), Node() ) );
+        }
+        else {
+            sit = q->FilterModel::listStatements( Statement( statement.subject(), statement.predicate(), Node(), statement.context() ) );
+        }
+
+        // we only need to know if the maximum has been reached
+        int count = 0;
+        while ( count < max && sit.next() ) {
+            ++count;
+        }
+        sit.close();
+
+        if ( count >= max ) {
+            qDebug() << "Found " << count << " statements that define " << statement.predicate() << " for " << statement.subject();
+            qDebug() << "FIXME: which statements to remove? Random? Best would be to remove the oldest...";
+            q->setError( "Max cardinality for predicate reached" );
+            return Error::ErrorUnknown;
+        }
+
+        return Error::ErrorNone;
+    }
+
     bool ignoreContext;
     bool m_expandQueryPrefixes;
 
@@ -100,6 +339,16 @@ public:
     NRLModel* q;
 
     QMutex m_prefixMapMutex;
+
+    PreparedQuery m_cardinalityQuery;
+    Model* m_cardinalityQueryModel;
+    QMutex m_cardinalityQueryMutex;
+
+    // predicate -> cardinality restrictions, loaded on first use
+    QHash<QUrl, Cardinality> m_cardinalities;
+    QSet<QUrl> m_dirtyPredicates;
+    bool m_cardinalitiesLoaded;
+    QMutex m_cardinalityMutex;
 };
 
 Soprano::NRLModel::NRLModel()
@@ -124,6 +373,13 @@ Soprano::NRLModel::~NRLModel()
 }
 
 
+void Soprano::NRLModel::setParentModel( Model* model )
+{
+    FilterModel::setParentModel( model );
+    d->invalidateCardinalities();
+}
+
+
 void Soprano::NRLModel::setIgnoreContext( bool b )
 {
     d->ignoreContext = b;
@@ -166,37 +422,15 @@ Soprano::Error::ErrorCode Soprano::NRLModel::addNrlStatement( const Statement& s
     // 2. if so -> enforce
     // 3. if not -> check if some for superproperties are defined (optional advanced feature)
 
-    QString query = QString( "select ?min ?max ?c where { { <%1> <%2> ?min } UNION { <%1> <%3> ?max } UNION { <%1> <%4> ?c } }" )
-                    .arg( statement.predicate().toString() )
-                    .arg( Vocabulary::NRL::minCardinality().toString() )
-                    .arg( Vocabulary::NRL::maxCardinality().toString() )
-                    .arg( Vocabulary::NRL::cardinality().toString() );
-
-    QueryResultIterator it = FilterModel::executeQuery( query, Query::QueryLanguageSparql );
-    if ( !it.isValid() ) {
-        setError( QString( "Query failed: '%1'" ).arg( query ) );
+    Private::Cardinality cardinality;
+    if ( !d->cardinality( statement.predicate().uri(), cardinality ) ) {
         return Error::ErrorUnknown;
     }
 
-    int min = -1;
-    int max = -1;
-    int c = -1;
-
-    while ( it.next() ) {
-        if ( it.binding( "min" ).isLiteral() ) {
-            min = it.binding( "min" ).literal().toInt();
-        }
-        else if ( it.binding( "max" ).isLiteral() ) {
-            max = it.binding( "max" ).literal().toInt();
-        }
-        if ( it.binding( "c" ).isLiteral() ) {
-            c = it.binding( "c" ).literal().toInt();
-        }
-    }
-
-    if ( min >= 0 || max >= 0 || c >= 0 ) {
-        qDebug() << "Predicate " << statement.predicate() << " has cardinalities: " << min << "; " << max << "; " << c;
+    int max = cardinality.max;
+    const int c = cardinality.cardinality;
 
+    if ( cardinality.isRestricted() ) {
         // the simple case (and also the most frequently used I suppose)
         if ( c == 1 || max == 1 ) {
             if ( ignoreContext() ) {
@@ -213,35 +447,9 @@ Soprano::Error::ErrorCode Soprano::NRLModel::addNrlStatement( const Statement& s
             if ( c > 1 )
                 max = c;
 
-            StatementIterator sit;
-            if ( ignoreContext() ) {
-                sit = FilterModel::listStatements( Statement( statement.subject(), statement.predicate(), Node() ) );
-            }
-            else {
-                sit = FilterModel::listStatements( Statement( statement.subject(), statement.predicate(), statement.context() ) );
-            }
-
-            QList<Statement> matchingStatements;
-            while ( sit.next() ) {
-                Statement s = *sit;
-                if ( ignoreContext() || s.context() == statement.context() ) {
-                    matchingStatements.append( s );
-                }
-            }
-
-            if ( matchingStatements.count() >= max ) {
-                qDebug() << "Found " << matchingStatements.count() << " statements that define " << statement.predicate() << " for " << statement.subject() << endl
-                         << "  -> need to remove " << ( matchingStatements.count()-max+1 ) << " before adding the new statement.";
-                if ( matchingStatements.count() == 1 ) {
-                    qDebug() << "Removing one statement is easy...";
-                    FilterModel::removeStatement( matchingStatements[0] );
-                }
-                else {
-                    qDebug() << "FIXME: which statements to remove? Random? Best would be to remove the oldest...";
-                    setError( "Max cardinality for predicate reached" );
-                    return Error::ErrorUnknown;
-                }
-            }
+            Error::ErrorCode error = d->enforceMaxCardinality( statement, max );
+            if ( error != Error::ErrorNone )
+                return error;
 
             return FilterModel::addStatement( statement );
         }
@@ -251,11 +459,77 @@ Soprano::Error::ErrorCode Soprano::NRLModel::addNrlStatement( const Statement& s
         }
     }
     else {
-        qDebug() << "Predicate " << statement.predicate() << " has no cardinality restrictions";
         return FilterModel::addStatement( statement );
     }
+}
+
+
+Soprano::Error::ErrorCode Soprano::NRLModel::addNrlStatements( const QList<Statement>& statements )
+{
+    QList<Statement> plainStatements;
+    QList<Statement> multiValueStatements;
+
+    // the statements of single value properties by subject, predicate, and context, the last one wins
+    QList<Statement> singleValueStatements;
+    QHash<Statement, int> singleValueIndex;
+
+    // classify all statements with one lookup in the cardinality table each
+    Q_FOREACH( const Statement& statement, statements ) {
+        if ( !statement.isValid() ) {
+            setError( "Cannot add invalid statement.", Error::ErrorInvalidArgument );
+            return Error::ErrorInvalidArgument;
+        }
+
+        Private::Cardinality cardinality;
+        if ( !d->cardinality( statement.predicate().uri(), cardinality ) ) {
+            return Error::ErrorUnknown;
+        }
 
-    // make gcc shut up
+        if ( cardinality.cardinality == 1 || cardinality.max == 1 ) {
+            const Statement key( statement.subject(), statement.predicate(), Node(),
+                                 ignoreContext() ? Node() : statement.context() );
+            QHash<Statement, int>::const_iterator it = singleValueIndex.constFind( key );
+            if ( it != singleValueIndex.constEnd() ) {
+                singleValueStatements[it.value()] = statement;
+            }
+            else {
+                singleValueIndex.insert( key, singleValueStatements.count() );
+                singleValueStatements.append( statement );
+            }
+        }
+        else if ( cardinality.max > 1 || cardinality.cardinality > 1 ) {
+            multiValueStatements.append( statement );
+        }
+        else {
+            plainStatements.append( statement );
+        }
+    }
+
+    // replace the old values of the single value properties
+    for ( QHash<Statement, int>::const_iterator it = singleValueIndex.constBegin();
+          it != singleValueIndex.constEnd(); ++it ) {
+        Error::ErrorCode error = FilterModel::removeAllStatements( it.key() );
+        if ( error != Error::ErrorNone )
+            return error;
+    }
+
+    // add everything which does not need a look at the existing values in one go
+    plainStatements += singleValueStatements;
+    if ( !plainStatements.isEmpty() ) {
+        Error::ErrorCode error = parentModel()->addStatements( plainStatements );
+        setError( parentModel()->lastError() );
+        if ( error != Error::ErrorNone )
+            return error;
+    }
+
+    // the remaining statements depend on the values added before them
+    Q_FOREACH( const Statement& statement, multiValueStatements ) {
+        Error::ErrorCode error = addNrlStatement( statement );
+        if ( error != Error::ErrorNone )
+            return error;
+    }
+
+    clearError();
     return Error::ErrorNone;
 }
 
@@ -265,9 +539,9 @@ QUrl Soprano::NRLModel::createGraph( const QUrl& type, QUrl* metadataGraph )
     QUrl graph = createGraphUri();
     QUrl metadatagraph = createGraphUri();
 
-    FilterModel::addStatement( metadatagraph, Soprano::Vocabulary::NRL::coreGraphMetadataFor(), graph, metadatagraph );
-    FilterModel::addStatement( metadatagraph, Soprano::Vocabulary::RDF::type(), Soprano::Vocabulary::NRL::GraphMetadata(), metadatagraph );
-    FilterModel::addStatement( graph, Soprano::Vocabulary::RDF::type(), type, metadatagraph );
+    FilterModel::addStatement( metadatagraph, Soprano::Vocabulary::NRL::Nodes::coreGraphMetadataFor(), graph, metadatagraph );
+    FilterModel::addStatement( metadatagraph, Soprano::Vocabulary::RDF::Nodes::type(), Soprano::Vocabulary::NRL::Nodes::GraphMetadata(), metadatagraph );
+    FilterModel::addStatement( graph, Soprano::Vocabulary::RDF::Nodes::type(), type, metadatagraph );
     FilterModel::addStatement( graph, Soprano::Vocabulary::NAO::created(), Soprano::LiteralValue( QDateTime::currentDateTime() ), metadatagraph );
 
     if ( metadataGraph )
@@ -295,38 +569,13 @@ Soprano::Error::ErrorCode Soprano::NRLModel::removeGraph( const QUrl& graph )
 
 Soprano::QueryResultIterator Soprano::NRLModel::executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
 {
-    QString expandedQuery( query );
-
-    if ( language == Query::QueryLanguageSparql &&
-         d->m_expandQueryPrefixes ) {
-        d->m_prefixMapMutex.lock();
-        QHash<QString, QUrl> prefixes = d->m_prefixes;
-        d->m_prefixMapMutex.unlock();
-
-        // find position in the query to add the prefixes to: directly before the actual query start
-        // certain backends like the virtuoso one support SPARQL extensions which need to be before the
-        // prefixes
-        const int pos = expandedQuery.indexOf(QRegExp(QLatin1String("select|describe|construct|ask"), Qt::CaseInsensitive));
-        if(pos >= 0) {
-            for ( QHash<QString, QUrl>::const_iterator it = prefixes.constBegin();
-                  it != prefixes.constEnd(); ++it ) {
-                QString prefix = it.key();
-                QUrl ns = it.value();
-
-                // very stupid check for the prefix usage
-                if ( expandedQuery.contains( prefix + ':' ) ) {
-                    // if the prefix is not defined add it
-                    if ( !expandedQuery.contains( QRegExp( QString::fromLatin1( "[pP][rR][eE][fF][iI][xX]\\s*%1\\s*:\\s*<%2>" )
-                                                           .arg( prefix )
-                                                           .arg( QRegExp::escape( ns.toString() ) ) ) ) ) {
-                        expandedQuery.insert( pos, QString( "prefix %1: <%2> " ).arg( prefix ).arg( ns.toString() ) );
-                    }
-                }
-            }
-        }
-    }
+    return FilterModel::executeQuery( d->expandPrefixes( query, language ), language, userQueryLanguage );
+}
+
 
-    return FilterModel::executeQuery( expandedQuery, language, userQueryLanguage );
+Soprano::PreparedQuery Soprano::NRLModel::prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    return FilterModel::prepareQuery( d->expandPrefixes( query, language ), language, userQueryLanguage );
 }
 
 
@@ -343,4 +592,32 @@ Soprano::Error::ErrorCode Soprano::NRLModel::removeAllStatements( const Statemen
     }
 }
 
+
+QList<Soprano::Statement> Soprano::NRLModel::takeAllStatements( const Statement& statement )
+{
+    if( statement.context().isValid() &&
+        !statement.subject().isValid() &&
+        !statement.predicate().isValid() &&
+        !statement.object().isValid() ) {
+        // list the graph and remove it through removeAllStatements()
+        return Model::takeAllStatements( statement );
+    }
+    else {
+        return FilterModel::takeAllStatements( statement );
+    }
+}
+
+void Soprano::NRLModel::parentStatementAdded( const Statement& statement )
+{
+    d->updateCardinalities( statement, true );
+    FilterModel::parentStatementAdded( statement );
+}
+
+
+void Soprano::NRLModel::parentStatementRemoved( const Statement& statement )
+{
+    d->updateCardinalities( statement, false );
+    FilterModel::parentStatementRemoved( statement );
+}
+
 #include "moc_nrlmodel.cpp"
@@ -44,6 +44,10 @@ namespace Soprano {
      * Thus, at the moment NRLModel is mostly usable for handling properties with a maximum
      * cardinality of 1.
      *
+     * The cardinality restrictions are read from the parent model in one go on first use
+     * and kept up to date through the statementAdded() and statementRemoved() signals of
+     * the parent model.
+     *
      * NRLModel also provides automatic query prefix expansion and named graph creation and
      * removal with automatic metadata graph handling.
      *
@@ -128,6 +132,23 @@ namespace Soprano {
          */
         Error::ErrorCode addNrlStatement( const Statement& s );
 
+        /**
+         * Add a list of statements enforcing the NRL cardinality rules
+         * like addNrlStatement().
+         *
+         * The restrictions of all predicates are looked up in one pass.
+         * Statements of properties with a maximum cardinality of 1 replace
+         * the existing values and the earlier values in \p statements.
+         * Together with the unrestricted statements they are added to the
+         * parent model through a single Model::addStatements() call.
+         *
+         * \return Error::ErrorNone on success. On error the statements
+         * before the failing one might already have been added.
+         *
+         * \since 2.10
+         */
+        Error::ErrorCode addNrlStatements( const QList<Statement>& statements );
+
         /**
          * Create a new graph of type \p type.
          *
@@ -158,6 +179,14 @@ namespace Soprano {
          */
         virtual QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
 
+        /**
+         * Query prefixes are expanded like in executeQuery() before the query is
+         * prepared by the underlying model.
+         *
+         * \since 2.10
+         */
+        virtual PreparedQuery prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+
         /**
          * If the only node defined in \p statement is the context the graph including its
          * metadata is removed.
@@ -168,6 +197,28 @@ namespace Soprano {
          */
         virtual Error::ErrorCode removeAllStatements( const Statement& statement );
 
+        /**
+         * Reimplemented to remove the metadata graphs along with a removed graph
+         * like removeAllStatements().
+         *
+         * \since 2.10
+         */
+        virtual QList<Statement> takeAllStatements( const Statement& statement );
+
+        /**
+         * Reimplemented to reload the cardinality restrictions from the new model.
+         *
+         * \since 2.10
+         */
+        virtual void setParentModel( Model* model );
+
+    protected:
+        /**
+         * Keeps the cached cardinality restrictions up to date.
+         */
+        virtual void parentStatementAdded( const Statement& statement );
+        virtual void parentStatementRemoved( const Statement& statement );
+
     private:
         class Private;
         Private* const d;
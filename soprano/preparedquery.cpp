@@ -0,0 +1,153 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "preparedquery.h"
+#include "preparedquerybackend.h"
+#include "bindingset.h"
+#include "node.h"
+#include "queryresultiterator.h"
+
+#include <QtCore/QHash>
+
+
+Soprano::PreparedQueryBackend::PreparedQueryBackend()
+{
+}
+
+
+Soprano::PreparedQueryBackend::~PreparedQueryBackend()
+{
+}
+
+
+class Soprano::PreparedQuery::Private : public QSharedData
+{
+public:
+    Private()
+        : backend( 0 ) {
+    }
+    ~Private() {
+        delete backend;
+    }
+
+    PreparedQueryBackend* backend;
+    QHash<QString, Node> values;
+};
+
+
+Soprano::PreparedQuery::PreparedQuery()
+    : Error::ErrorCache(),
+      d( new Private() )
+{
+}
+
+
+Soprano::PreparedQuery::PreparedQuery( PreparedQueryBackend* backend )
+    : Error::ErrorCache(),
+      d( new Private() )
+{
+    d->backend = backend;
+}
+
+
+Soprano::PreparedQuery::PreparedQuery( const PreparedQuery& other )
+    : Error::ErrorCache(),
+      d( other.d )
+{
+}
+
+
+Soprano::PreparedQuery::~PreparedQuery()
+{
+}
+
+
+Soprano::PreparedQuery& Soprano::PreparedQuery::operator=( const PreparedQuery& other )
+{
+    d = other.d;
+    return *this;
+}
+
+
+bool Soprano::PreparedQuery::isValid() const
+{
+    return d->backend != 0;
+}
+
+
+QStringList Soprano::PreparedQuery::parameterNames() const
+{
+    if ( d->backend )
+        return d->backend->parameterNames();
+    else
+        return QStringList();
+}
+
+
+void Soprano::PreparedQuery::bindValue( const QString& name, const Node& value )
+{
+    if ( value.isValid() )
+        d->values.insert( name, value );
+    else
+        d->values.remove( name );
+}
+
+
+Soprano::Node Soprano::PreparedQuery::boundValue( const QString& name ) const
+{
+    return d->values.value( name );
+}
+
+
+Soprano::BindingSet Soprano::PreparedQuery::boundValues() const
+{
+    BindingSet bindings;
+    for ( QHash<QString, Node>::const_iterator it = d->values.constBegin();
+          it != d->values.constEnd(); ++it ) {
+        bindings.insert( it.key(), it.value() );
+    }
+    return bindings;
+}
+
+
+void Soprano::PreparedQuery::clearBoundValues()
+{
+    d->values.clear();
+}
+
+
+Soprano::QueryResultIterator Soprano::PreparedQuery::executeQuery()
+{
+    return executeQuery( boundValues() );
+}
+
+
+Soprano::QueryResultIterator Soprano::PreparedQuery::executeQuery( const BindingSet& bindings )
+{
+    if ( !d->backend ) {
+        setError( "Invalid prepared query." );
+        return QueryResultIterator();
+    }
+
+    QueryResultIterator it = d->backend->executeQuery( bindings );
+    setError( d->backend->lastError() );
+    return it;
+}
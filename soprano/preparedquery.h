@@ -0,0 +1,143 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_PREPARED_QUERY_H_
+#define _SOPRANO_PREPARED_QUERY_H_
+
+#include "soprano_export.h"
+#include "error.h"
+
+#include <QtCore/QSharedDataPointer>
+#include <QtCore/QStringList>
+
+namespace Soprano {
+
+    class BindingSet;
+    class Node;
+    class PreparedQueryBackend;
+    class QueryResultIterator;
+
+    /**
+     * \class PreparedQuery preparedquery.h Soprano/PreparedQuery
+     *
+     * \brief A query which is prepared once and executed many times with
+     * different parameter values.
+     *
+     * Parameters are written as \p %name in the query string, \p name consisting
+     * of letters, digits and underscores. Each parameter is bound to a Node which
+     * takes the place of the parameter in the query:
+     *
+     * \code
+     * PreparedQuery query = model->prepareQuery( "select ?l where { %r rdfs:label ?l . }",
+     *                                             Query::QueryLanguageSparql );
+     * foreach( const QUrl& res, resources ) {
+     *     query.bindValue( "r", res );
+     *     QueryResultIterator it = query.executeQuery();
+     *     ...
+     * }
+     * \endcode
+     *
+     * Backends which support it parse and plan the query only once. All other
+     * models replace the parameters with the N3 representation of their values
+     * and execute the resulting query string.
+     *
+     * PreparedQuery instances are explicitly shared: copies share the backend
+     * and the bound values. A PreparedQuery may not outlive the Model that
+     * created it.
+     *
+     * \sa Model::prepareQuery()
+     *
+     * \since 2.10
+     */
+    class SOPRANO_EXPORT PreparedQuery : public Error::ErrorCache
+    {
+    public:
+        /**
+         * Creates an invalid prepared query.
+         */
+        PreparedQuery();
+
+        /**
+         * Create a new prepared query which uses \p backend to execute
+         * the query. PreparedQuery takes ownership of the backend.
+         */
+        PreparedQuery( PreparedQueryBackend* backend );
+
+        PreparedQuery( const PreparedQuery& other );
+        virtual ~PreparedQuery();
+
+        PreparedQuery& operator=( const PreparedQuery& other );
+
+        /**
+         * \return \p true if the query has successfully been prepared.
+         */
+        bool isValid() const;
+
+        /**
+         * \return The names of all parameters used in the query.
+         */
+        QStringList parameterNames() const;
+
+        /**
+         * Bind the parameter \p name to \p value. Binding an empty node
+         * removes the binding.
+         */
+        void bindValue( const QString& name, const Node& value );
+
+        /**
+         * \return The value bound to the parameter \p name or an empty node
+         * if the parameter is not bound.
+         */
+        Node boundValue( const QString& name ) const;
+
+        /**
+         * \return All values bound through bindValue().
+         */
+        BindingSet boundValues() const;
+
+        /**
+         * Remove all bound values.
+         */
+        void clearBoundValues();
+
+        /**
+         * Execute the query with the values bound through bindValue().
+         * All parameters need to be bound.
+         *
+         * \return An iterator over the results or an invalid iterator on error.
+         */
+        QueryResultIterator executeQuery();
+
+        /**
+         * \overload
+         *
+         * Execute the query with the values in \p bindings. The values bound
+         * through bindValue() are ignored.
+         */
+        QueryResultIterator executeQuery( const BindingSet& bindings );
+
+    private:
+        class Private;
+        QExplicitlySharedDataPointer<Private> d;
+    };
+}
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_PREPARED_QUERY_BACKEND_H_
+#define _SOPRANO_PREPARED_QUERY_BACKEND_H_
+
+#include "soprano_export.h"
+#include "error.h"
+
+#include <QtCore/QStringList>
+
+namespace Soprano {
+
+    class BindingSet;
+    class QueryResultIterator;
+
+    /**
+     * \class PreparedQueryBackend preparedquerybackend.h Soprano/PreparedQueryBackend
+     *
+     * \brief The actual work in a PreparedQuery is done by a PreparedQueryBackend.
+     *
+     * Model implementations which are able to reuse a parsed or planned query
+     * provide their own backend through Model::prepareQuery().
+     *
+     * \since 2.10
+     */
+    class SOPRANO_EXPORT PreparedQueryBackend : public Error::ErrorCache
+    {
+    public:
+        virtual ~PreparedQueryBackend();
+
+        /**
+         * \return The names of all parameters used in the query.
+         *
+         * \sa PreparedQuery::parameterNames()
+         */
+        virtual QStringList parameterNames() const = 0;
+
+        /**
+         * Execute the query with the parameters replaced by the values
+         * in \p bindings.
+         *
+         * Implementations of this method should reset the error by either calling
+         * clearError() or setError().
+         *
+         * \sa PreparedQuery::executeQuery()
+         */
+        virtual QueryResultIterator executeQuery( const BindingSet& bindings ) = 0;
+
+    protected:
+        PreparedQueryBackend();
+    };
+}
+
+#endif
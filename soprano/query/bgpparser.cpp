@@ -0,0 +1,946 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "bgpparser.h"
+#include "../node.h"
+#include "../literalvalue.h"
+#include "../locator.h"
+#include "../vocabulary/rdf.h"
+#include "../vocabulary/xsd.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QUrl>
+
+
+/**
+ * The state of one parse() run.
+ */
+class Soprano::Query::BgpParser::Private
+{
+public:
+    Private( const QString& query )
+        : m_query( query ),
+          m_pos( 0 ),
+          m_anonCounter( 0 ),
+          m_failed( false ) {
+    }
+
+    bool parse( ParsedQuery* result );
+
+    Error::Error error() const { return m_error; }
+
+private:
+    // Lexing helpers
+    void skipWhitespace();
+    bool atEnd();
+    QChar peek();
+    /// case-insensitive keyword check which does not consume anything
+    bool peekKeyword( const char* keyword );
+    bool acceptKeyword( const char* keyword );
+    /// accept a multi-character operator like "&&"
+    bool acceptOperator( const char* op );
+    bool accept( QChar c );
+    bool expect( QChar c );
+    QString readName();
+    bool readInteger( int* value );
+
+    // Grammar
+    bool parsePrologue( ParsedQuery* result );
+    bool parseWhereClause( LogicAnd* group );
+    bool parseGroup( LogicAnd* group, const RTerm* context );
+    bool parseUnion( LogicAnd* group, const RTerm* context );
+    bool parseTriples( QList<TriplePattern>* patterns, const RTerm* context, QChar terminator );
+    bool parseModifiers( ParsedQuery* result );
+
+    // Filters
+    BooleanExpression* parseConstraint();
+    BooleanExpression* parseOrExpression();
+    BooleanExpression* parseAndExpression();
+    BooleanExpression* parseUnaryExpression();
+    BooleanExpression* parsePrimaryExpression();
+    BooleanExpression* parseBuiltInCall();
+
+    RTerm* parseTerm( bool allowLiteral );
+    RTerm* parseVerb();
+    bool parseIri( QUrl* url );
+    bool parsePrefixedName( QUrl* url );
+    RTerm* parseLiteral();
+    RTerm* parseNumber();
+
+    void setError( const QString& message, int code = Error::ErrorParsingFailed );
+
+    QString m_query;
+    int m_pos;
+
+    QHash<QString, QUrl> m_prefixes;
+    QUrl m_base;
+    int m_anonCounter;
+
+    bool m_failed;
+    Error::Error m_error;
+};
+
+
+void Soprano::Query::BgpParser::Private::setError( const QString& message, int code )
+{
+    if ( m_failed )
+        return;
+
+    m_failed = true;
+
+    int line = 1;
+    int column = 1;
+    for ( int i = 0; i < m_pos && i < m_query.length(); ++i ) {
+        if ( m_query[i] == QLatin1Char( '\n' ) ) {
+            ++line;
+            column = 1;
+        }
+        else {
+            ++column;
+        }
+    }
+
+    m_error = Error::ParserError( Error::Locator( line, column, m_pos ), message, code );
+}
+
+
+void Soprano::Query::BgpParser::Private::skipWhitespace()
+{
+    while ( m_pos < m_query.length() ) {
+        const QChar c = m_query[m_pos];
+        if ( c.isSpace() ) {
+            ++m_pos;
+        }
+        else if ( c == QLatin1Char( '#' ) ) {
+            while ( m_pos < m_query.length() && m_query[m_pos] != QLatin1Char( '\n' ) )
+                ++m_pos;
+        }
+        else {
+            break;
+        }
+    }
+}
+
+
+bool Soprano::Query::BgpParser::Private::atEnd()
+{
+    skipWhitespace();
+    return m_pos >= m_query.length();
+}
+
+
+QChar Soprano::Query::BgpParser::Private::peek()
+{
+    skipWhitespace();
+    return m_pos < m_query.length() ? m_query[m_pos] : QChar();
+}
+
+
+bool Soprano::Query::BgpParser::Private::peekKeyword( const char* keyword )
+{
+    skipWhitespace();
+    const QString kw = QLatin1String( keyword );
+    if ( m_query.mid( m_pos, kw.length() ).compare( kw, Qt::CaseInsensitive ) != 0 )
+        return false;
+
+    // the keyword must not be the prefix of a longer name
+    const int end = m_pos + kw.length();
+    if ( end < m_query.length() ) {
+        const QChar c = m_query[end];
+        if ( c.isLetterOrNumber() || c == QLatin1Char( '_' ) || c == QLatin1Char( ':' ) || c == QLatin1Char( '-' ) )
+            return false;
+    }
+    return true;
+}
+
+
+bool Soprano::Query::BgpParser::Private::acceptKeyword( const char* keyword )
+{
+    if ( peekKeyword( keyword ) ) {
+        m_pos += qstrlen( keyword );
+        return true;
+    }
+    return false;
+}
+
+
+bool Soprano::Query::BgpParser::Private::acceptOperator( const char* op )
+{
+    skipWhitespace();
+    const QString s = QLatin1String( op );
+    if ( m_query.mid( m_pos, s.length() ) == s ) {
+        m_pos += s.length();
+        return true;
+    }
+    return false;
+}
+
+
+bool Soprano::Query::BgpParser::Private::accept( QChar c )
+{
+    if ( peek() == c ) {
+        ++m_pos;
+        return true;
+    }
+    return false;
+}
+
+
+bool Soprano::Query::BgpParser::Private::expect( QChar c )
+{
+    if ( accept( c ) )
+        return true;
+    setError( QString( "Expected '%1'" ).arg( c ) );
+    return false;
+}
+
+
+QString Soprano::Query::BgpParser::Private::readName()
+{
+    const int start = m_pos;
+    while ( m_pos < m_query.length() ) {
+        const QChar c = m_query[m_pos];
+        if ( c.isLetterOrNumber() || c == QLatin1Char( '_' ) || c == QLatin1Char( '-' ) ||
+             ( c == QLatin1Char( '.' ) && m_pos + 1 < m_query.length() &&
+               ( m_query[m_pos+1].isLetterOrNumber() || m_query[m_pos+1] == QLatin1Char( '_' ) ) ) ) {
+            ++m_pos;
+        }
+        else {
+            break;
+        }
+    }
+    return m_query.mid( start, m_pos - start );
+}
+
+
+bool Soprano::Query::BgpParser::Private::readInteger( int* value )
+{
+    skipWhitespace();
+    const int start = m_pos;
+    while ( m_pos < m_query.length() && m_query[m_pos].isDigit() )
+        ++m_pos;
+    bool ok = false;
+    *value = m_query.mid( start, m_pos - start ).toInt( &ok );
+    if ( !ok )
+        setError( "Expected an integer" );
+    return ok;
+}
+
+
+bool Soprano::Query::BgpParser::Private::parse( ParsedQuery* result )
+{
+    if ( !parsePrologue( result ) )
+        return false;
+
+    if ( acceptKeyword( "SELECT" ) ) {
+        result->query.setQueryType( Query::SELECT_QUERY );
+        if ( acceptKeyword( "DISTINCT" ) ) {
+            result->distinct = true;
+        }
+        else {
+            // REDUCED allows but does not require removing duplicates
+            acceptKeyword( "REDUCED" );
+        }
+
+        QueryTerms terms;
+        if ( !accept( QLatin1Char( '*' ) ) ) {
+            while ( peek() == QLatin1Char( '?' ) || peek() == QLatin1Char( '$' ) ) {
+                ++m_pos;
+                const QString name = readName();
+                if ( name.isEmpty() ) {
+                    setError( "Invalid variable name" );
+                    return false;
+                }
+                terms.addVariable( new Variable( name ) );
+            }
+            if ( terms.variables().isEmpty() ) {
+                setError( "Expected a variable or '*'" );
+                return false;
+            }
+        }
+        result->query.setQueryTerms( terms );
+    }
+    else if ( acceptKeyword( "ASK" ) ) {
+        result->query.setQueryType( Query::BOOLEAN_QUERY );
+    }
+    else if ( acceptKeyword( "CONSTRUCT" ) ) {
+        result->query.setQueryType( Query::GRAPH_QUERY );
+        if ( !expect( QLatin1Char( '{' ) ) ||
+             !parseTriples( &result->constructTemplate, 0, QLatin1Char( '}' ) ) ||
+             !expect( QLatin1Char( '}' ) ) )
+            return false;
+    }
+    else if ( peekKeyword( "DESCRIBE" ) ) {
+        setError( "DESCRIBE queries are not supported", Error::ErrorNotSupported );
+        return false;
+    }
+    else {
+        setError( "Expected SELECT, ASK, or CONSTRUCT" );
+        return false;
+    }
+
+    if ( peekKeyword( "FROM" ) ) {
+        setError( "Dataset clauses are not supported", Error::ErrorNotSupported );
+        return false;
+    }
+
+    LogicAnd* where = new LogicAnd();
+    if ( !parseWhereClause( where ) ) {
+        delete where;
+        return false;
+    }
+
+    if ( where->count() == 1 ) {
+        result->query.setCondition( where->condition( 0 )->clone() );
+        delete where;
+    }
+    else if ( where->count() > 1 ) {
+        result->query.setCondition( where );
+    }
+    else {
+        delete where;
+    }
+
+    if ( !parseModifiers( result ) )
+        return false;
+
+    if ( !atEnd() ) {
+        setError( "Unexpected trailing characters" );
+        return false;
+    }
+
+    return true;
+}
+
+
+bool Soprano::Query::BgpParser::Private::parsePrologue( ParsedQuery* result )
+{
+    while ( true ) {
+        if ( acceptKeyword( "BASE" ) ) {
+            if ( !parseIri( &m_base ) )
+                return false;
+        }
+        else if ( acceptKeyword( "PREFIX" ) ) {
+            skipWhitespace();
+            const QString prefix = readName();
+            if ( !expect( QLatin1Char( ':' ) ) )
+                return false;
+            QUrl uri;
+            if ( !parseIri( &uri ) )
+                return false;
+            m_prefixes.insert( prefix, uri );
+            result->query.addPrefix( Prefix( prefix, uri ) );
+        }
+        else {
+            return true;
+        }
+    }
+}
+
+
+bool Soprano::Query::BgpParser::Private::parseWhereClause( LogicAnd* group )
+{
+    acceptKeyword( "WHERE" );
+    if ( !expect( QLatin1Char( '{' ) ) ||
+         !parseGroup( group, 0 ) ||
+         !expect( QLatin1Char( '}' ) ) )
+        return false;
+    return true;
+}
+
+
+bool Soprano::Query::BgpParser::Private::parseGroup( LogicAnd* group, const RTerm* context )
+{
+    while ( !atEnd() && peek() != QLatin1Char( '}' ) ) {
+        if ( accept( QLatin1Char( '.' ) ) ) {
+            continue;
+        }
+        else if ( acceptKeyword( "GRAPH" ) ) {
+            RTerm* graph = parseTerm( false );
+            if ( !graph )
+                return false;
+            // the block is joined with the rest of the group anyway
+            const bool ok = ( expect( QLatin1Char( '{' ) ) &&
+                              parseGroup( group, graph ) &&
+                              expect( QLatin1Char( '}' ) ) );
+            delete graph;
+            if ( !ok )
+                return false;
+        }
+        else if ( peek() == QLatin1Char( '{' ) ) {
+            if ( !parseUnion( group, context ) )
+                return false;
+        }
+        else if ( acceptKeyword( "FILTER" ) ) {
+            BooleanExpression* filter = parseConstraint();
+            if ( !filter )
+                return false;
+            group->addConditon( filter );
+        }
+        else if ( peekKeyword( "OPTIONAL" ) || peekKeyword( "UNION" ) ||
+                  peekKeyword( "MINUS" ) || peekKeyword( "BIND" ) ||
+                  peekKeyword( "VALUES" ) || peekKeyword( "SERVICE" ) ) {
+            setError( "Only basic graph patterns, UNION, and FILTER are supported", Error::ErrorNotSupported );
+            return false;
+        }
+        else {
+            QList<TriplePattern> patterns;
+            if ( !parseTriples( &patterns, context, QLatin1Char( '}' ) ) )
+                return false;
+            Q_FOREACH( const TriplePattern& tp, patterns ) {
+                group->addConditon( tp.clone() );
+            }
+        }
+    }
+    return !m_failed;
+}
+
+
+bool Soprano::Query::BgpParser::Private::parseUnion( LogicAnd* group, const RTerm* context )
+{
+    QList<LogicAnd*> alternatives;
+    do {
+        LogicAnd* alternative = new LogicAnd();
+        alternatives.append( alternative );
+        if ( !expect( QLatin1Char( '{' ) ) ||
+             !parseGroup( alternative, context ) ||
+             !expect( QLatin1Char( '}' ) ) ) {
+            qDeleteAll( alternatives );
+            return false;
+        }
+    } while ( acceptKeyword( "UNION" ) );
+
+    if ( alternatives.count() == 1 ) {
+        // a plain nested group
+        group->addConditon( alternatives.first() );
+    }
+    else {
+        LogicOr* u = new LogicOr();
+        Q_FOREACH( LogicAnd* alternative, alternatives ) {
+            u->addConditon( alternative );
+        }
+        group->addConditon( u );
+    }
+    return true;
+}
+
+
+Soprano::Query::BooleanExpression* Soprano::Query::BgpParser::Private::parseConstraint()
+{
+    if ( peek() == QLatin1Char( '(' ) )
+        return parsePrimaryExpression();
+    else
+        return parseBuiltInCall();
+}
+
+
+Soprano::Query::BooleanExpression* Soprano::Query::BgpParser::Private::parseOrExpression()
+{
+    BooleanExpression* first = parseAndExpression();
+    if ( !first || !acceptOperator( "||" ) )
+        return first;
+
+    LogicOr* disjunction = new LogicOr();
+    disjunction->addConditon( first );
+    do {
+        BooleanExpression* e = parseAndExpression();
+        if ( !e ) {
+            delete disjunction;
+            return 0;
+        }
+        disjunction->addConditon( e );
+    } while ( acceptOperator( "||" ) );
+    return disjunction;
+}
+
+
+Soprano::Query::BooleanExpression* Soprano::Query::BgpParser::Private::parseAndExpression()
+{
+    BooleanExpression* first = parseUnaryExpression();
+    if ( !first || !acceptOperator( "&&" ) )
+        return first;
+
+    LogicAnd* conjunction = new LogicAnd();
+    conjunction->addConditon( first );
+    do {
+        BooleanExpression* e = parseUnaryExpression();
+        if ( !e ) {
+            delete conjunction;
+            return 0;
+        }
+        conjunction->addConditon( e );
+    } while ( acceptOperator( "&&" ) );
+    return conjunction;
+}
+
+
+Soprano::Query::BooleanExpression* Soprano::Query::BgpParser::Private::parseUnaryExpression()
+{
+    if ( accept( QLatin1Char( '!' ) ) ) {
+        BooleanExpression* e = parseUnaryExpression();
+        return e ? new Not( e ) : 0;
+    }
+    return parsePrimaryExpression();
+}
+
+
+Soprano::Query::BooleanExpression* Soprano::Query::BgpParser::Private::parsePrimaryExpression()
+{
+    if ( accept( QLatin1Char( '(' ) ) ) {
+        BooleanExpression* e = parseOrExpression();
+        if ( e && !expect( QLatin1Char( ')' ) ) ) {
+            delete e;
+            return 0;
+        }
+        return e;
+    }
+
+    if ( peekKeyword( "BOUND" ) || peekKeyword( "isIRI" ) || peekKeyword( "isURI" ) ||
+         peekKeyword( "isBlank" ) || peekKeyword( "isLiteral" ) || peekKeyword( "sameTerm" ) ) {
+        return parseBuiltInCall();
+    }
+
+    RTerm* first = parseTerm( true );
+    if ( !first )
+        return 0;
+
+    const bool notEqual = acceptOperator( "!=" );
+    if ( !notEqual && !acceptOperator( "=" ) ) {
+        delete first;
+        setError( "Only comparisons with '=' and '!=' are supported in filters", Error::ErrorNotSupported );
+        return 0;
+    }
+
+    RTerm* second = parseTerm( true );
+    if ( !second ) {
+        delete first;
+        return 0;
+    }
+
+    if ( notEqual )
+        return new RTermNotEqual( first, second );
+    else
+        return new RTermEqual( first, second );
+}
+
+
+Soprano::Query::BooleanExpression* Soprano::Query::BgpParser::Private::parseBuiltInCall()
+{
+    if ( acceptKeyword( "BOUND" ) ) {
+        if ( !expect( QLatin1Char( '(' ) ) )
+            return 0;
+        const QChar c = peek();
+        if ( c != QLatin1Char( '?' ) && c != QLatin1Char( '$' ) ) {
+            setError( "Expected a variable" );
+            return 0;
+        }
+        RTerm* term = parseTerm( false );
+        if ( !term )
+            return 0;
+        if ( !expect( QLatin1Char( ')' ) ) ) {
+            delete term;
+            return 0;
+        }
+        return new IsBound( static_cast<Variable*>( term ) );
+    }
+
+    if ( acceptKeyword( "sameTerm" ) ) {
+        if ( !expect( QLatin1Char( '(' ) ) )
+            return 0;
+        RTerm* first = parseTerm( true );
+        if ( !first )
+            return 0;
+        RTerm* second = 0;
+        if ( !expect( QLatin1Char( ',' ) ) ||
+             !( second = parseTerm( true ) ) ||
+             !expect( QLatin1Char( ')' ) ) ) {
+            delete first;
+            delete second;
+            return 0;
+        }
+        return new RTermEqual( first, second );
+    }
+
+    enum { IRI, Blank, Literal } test;
+    if ( acceptKeyword( "isIRI" ) || acceptKeyword( "isURI" ) ) {
+        test = IRI;
+    }
+    else if ( acceptKeyword( "isBlank" ) ) {
+        test = Blank;
+    }
+    else if ( acceptKeyword( "isLiteral" ) ) {
+        test = Literal;
+    }
+    else {
+        setError( "Unsupported filter expression", Error::ErrorNotSupported );
+        return 0;
+    }
+
+    if ( !expect( QLatin1Char( '(' ) ) )
+        return 0;
+    RTerm* term = parseTerm( true );
+    if ( !term )
+        return 0;
+    if ( !expect( QLatin1Char( ')' ) ) ) {
+        delete term;
+        return 0;
+    }
+
+    switch( test ) {
+    case IRI:
+        return new IsIRI( term );
+    case Blank:
+        return new IsBlank( term );
+    default:
+        return new IsLiteral( term );
+    }
+}
+
+
+bool Soprano::Query::BgpParser::Private::parseTriples( QList<TriplePattern>* patterns, const RTerm* context, QChar terminator )
+{
+    while ( !atEnd() && peek() != terminator ) {
+        if ( peek() == QLatin1Char( '{' ) ||
+             peekKeyword( "GRAPH" ) || peekKeyword( "FILTER" ) || peekKeyword( "OPTIONAL" ) ||
+             peekKeyword( "UNION" ) || peekKeyword( "MINUS" ) || peekKeyword( "BIND" ) ||
+             peekKeyword( "VALUES" ) || peekKeyword( "SERVICE" ) )
+            return !m_failed;
+
+        RTerm* subject = parseTerm( false );
+        if ( !subject )
+            return false;
+
+        // the predicate-object list
+        while ( true ) {
+            RTerm* predicate = parseVerb();
+            if ( !predicate ) {
+                delete subject;
+                return false;
+            }
+
+            // the object list
+            while ( true ) {
+                RTerm* object = parseTerm( true );
+                if ( !object ) {
+                    delete predicate;
+                    delete subject;
+                    return false;
+                }
+                TriplePattern tp( subject->clone(), predicate->clone(), object );
+                if ( context ) {
+                    tp.setContext( context->clone() );
+                }
+                patterns->append( tp );
+
+                if ( !accept( QLatin1Char( ',' ) ) )
+                    break;
+            }
+            delete predicate;
+
+            if ( !accept( QLatin1Char( ';' ) ) )
+                break;
+            // a trailing ';' is allowed
+            const QChar c = peek();
+            if ( c == QLatin1Char( '.' ) || c == terminator )
+                break;
+        }
+        delete subject;
+
+        if ( !accept( QLatin1Char( '.' ) ) )
+            break;
+    }
+    return !m_failed;
+}
+
+
+bool Soprano::Query::BgpParser::Private::parseModifiers( ParsedQuery* result )
+{
+    while ( true ) {
+        if ( acceptKeyword( "LIMIT" ) ) {
+            if ( !readInteger( &result->limit ) )
+                return false;
+        }
+        else if ( acceptKeyword( "OFFSET" ) ) {
+            if ( !readInteger( &result->offset ) )
+                return false;
+        }
+        else if ( peekKeyword( "ORDER" ) || peekKeyword( "GROUP" ) || peekKeyword( "HAVING" ) ) {
+            setError( "Solution ordering and grouping is not supported", Error::ErrorNotSupported );
+            return false;
+        }
+        else {
+            return true;
+        }
+    }
+}
+
+
+Soprano::Query::RTerm* Soprano::Query::BgpParser::Private::parseVerb()
+{
+    skipWhitespace();
+    if ( m_pos < m_query.length() && m_query[m_pos] == QLatin1Char( 'a' ) &&
+         ( m_pos + 1 >= m_query.length() || m_query[m_pos+1].isSpace() ||
+           m_query[m_pos+1] == QLatin1Char( '<' ) || m_query[m_pos+1] == QLatin1Char( '?' ) ) ) {
+        ++m_pos;
+        return new Node( Vocabulary::RDF::Nodes::type() );
+    }
+    return parseTerm( false );
+}
+
+
+Soprano::Query::RTerm* Soprano::Query::BgpParser::Private::parseTerm( bool allowLiteral )
+{
+    const QChar c = peek();
+
+    if ( c == QLatin1Char( '?' ) || c == QLatin1Char( '$' ) ) {
+        ++m_pos;
+        const QString name = readName();
+        if ( name.isEmpty() ) {
+            setError( "Invalid variable name" );
+            return 0;
+        }
+        return new Variable( name );
+    }
+    else if ( c == QLatin1Char( '<' ) ) {
+        QUrl url;
+        if ( !parseIri( &url ) )
+            return 0;
+        return new Node( Soprano::Node( url ) );
+    }
+    else if ( c == QLatin1Char( '_' ) && m_pos + 1 < m_query.length() && m_query[m_pos+1] == QLatin1Char( ':' ) ) {
+        m_pos += 2;
+        const QString label = readName();
+        if ( label.isEmpty() ) {
+            setError( "Invalid blank node label" );
+            return 0;
+        }
+        return new Variable( QLatin1String( "_:" ) + label );
+    }
+    else if ( c == QLatin1Char( '[' ) ) {
+        ++m_pos;
+        if ( !expect( QLatin1Char( ']' ) ) )
+            return 0;
+        return new Variable( QString( "_:anon%1" ).arg( ++m_anonCounter ) );
+    }
+    else if ( allowLiteral && ( c == QLatin1Char( '"' ) || c == QLatin1Char( '\'' ) ) ) {
+        return parseLiteral();
+    }
+    else if ( allowLiteral && ( c.isDigit() || c == QLatin1Char( '+' ) || c == QLatin1Char( '-' ) || c == QLatin1Char( '.' ) ) ) {
+        return parseNumber();
+    }
+    else if ( allowLiteral && acceptKeyword( "true" ) ) {
+        return new Node( Soprano::Node( LiteralValue( true ) ) );
+    }
+    else if ( allowLiteral && acceptKeyword( "false" ) ) {
+        return new Node( Soprano::Node( LiteralValue( false ) ) );
+    }
+    else if ( c.isLetter() || c == QLatin1Char( ':' ) ) {
+        QUrl url;
+        if ( !parsePrefixedName( &url ) )
+            return 0;
+        return new Node( Soprano::Node( url ) );
+    }
+    else {
+        setError( atEnd() ? QString( "Unexpected end of query" ) : QString( "Unexpected character '%1'" ).arg( c ) );
+        return 0;
+    }
+}
+
+
+bool Soprano::Query::BgpParser::Private::parseIri( QUrl* url )
+{
+    if ( !expect( QLatin1Char( '<' ) ) )
+        return false;
+    const int end = m_query.indexOf( QLatin1Char( '>' ), m_pos );
+    if ( end < 0 ) {
+        setError( "Unterminated IRI" );
+        return false;
+    }
+    const QUrl iri( m_query.mid( m_pos, end - m_pos ) );
+    m_pos = end + 1;
+    *url = ( iri.isRelative() && !m_base.isEmpty() ) ? m_base.resolved( iri ) : iri;
+    return true;
+}
+
+
+bool Soprano::Query::BgpParser::Private::parsePrefixedName( QUrl* url )
+{
+    skipWhitespace();
+    const QString prefix = readName();
+    if ( !expect( QLatin1Char( ':' ) ) )
+        return false;
+    if ( !m_prefixes.contains( prefix ) ) {
+        setError( QString( "Undefined prefix '%1'" ).arg( prefix ) );
+        return false;
+    }
+    const QString local = readName();
+    *url = QUrl( m_prefixes[prefix].toString() + local );
+    return true;
+}
+
+
+Soprano::Query::RTerm* Soprano::Query::BgpParser::Private::parseLiteral()
+{
+    const QChar quote = m_query[m_pos];
+    const bool longString = ( m_query.mid( m_pos, 3 ) == QString( 3, quote ) );
+    m_pos += longString ? 3 : 1;
+
+    QString value;
+    while ( true ) {
+        if ( m_pos >= m_query.length() ) {
+            setError( "Unterminated string literal" );
+            return 0;
+        }
+        const QChar c = m_query[m_pos];
+        if ( c == QLatin1Char( '\\' ) && m_pos + 1 < m_query.length() ) {
+            const QChar e = m_query[m_pos+1];
+            m_pos += 2;
+            switch( e.toLatin1() ) {
+            case 't': value += QLatin1Char( '\t' ); break;
+            case 'n': value += QLatin1Char( '\n' ); break;
+            case 'r': value += QLatin1Char( '\r' ); break;
+            case 'b': value += QLatin1Char( '\b' ); break;
+            case 'f': value += QLatin1Char( '\f' ); break;
+            case 'u':
+            case 'U': {
+                const int len = ( e == QLatin1Char( 'u' ) ? 4 : 8 );
+                bool ok = false;
+                const uint code = m_query.mid( m_pos, len ).toUInt( &ok, 16 );
+                if ( !ok ) {
+                    setError( "Invalid unicode escape sequence" );
+                    return 0;
+                }
+                m_pos += len;
+                if ( code > 0xFFFF ) {
+                    value += QChar( QChar::highSurrogate( code ) );
+                    value += QChar( QChar::lowSurrogate( code ) );
+                }
+                else {
+                    value += QChar( code );
+                }
+                break;
+            }
+            default:
+                value += e;
+            }
+        }
+        else if ( c == quote &&
+                  ( !longString || m_query.mid( m_pos, 3 ) == QString( 3, quote ) ) ) {
+            m_pos += longString ? 3 : 1;
+            break;
+        }
+        else {
+            value += c;
+            ++m_pos;
+        }
+    }
+
+    if ( m_pos < m_query.length() && m_query[m_pos] == QLatin1Char( '@' ) ) {
+        ++m_pos;
+        const QString lang = readName();
+        return new Node( Soprano::Node( LiteralValue::createPlainLiteral( value, lang ) ) );
+    }
+    else if ( m_query.mid( m_pos, 2 ) == QLatin1String( "^^" ) ) {
+        m_pos += 2;
+        QUrl dataType;
+        if ( peek() == QLatin1Char( '<' ) ) {
+            if ( !parseIri( &dataType ) )
+                return 0;
+        }
+        else if ( !parsePrefixedName( &dataType ) ) {
+            return 0;
+        }
+        return new Node( Soprano::Node( LiteralValue::fromString( value, dataType ) ) );
+    }
+    else {
+        return new Node( Soprano::Node( LiteralValue::createPlainLiteral( value ) ) );
+    }
+}
+
+
+Soprano::Query::RTerm* Soprano::Query::BgpParser::Private::parseNumber()
+{
+    skipWhitespace();
+    const int start = m_pos;
+    if ( m_query[m_pos] == QLatin1Char( '+' ) || m_query[m_pos] == QLatin1Char( '-' ) )
+        ++m_pos;
+
+    bool isDecimal = false;
+    bool isDouble = false;
+    while ( m_pos < m_query.length() ) {
+        const QChar c = m_query[m_pos];
+        if ( c.isDigit() ) {
+            ++m_pos;
+        }
+        else if ( c == QLatin1Char( '.' ) && !isDecimal && !isDouble &&
+                  m_pos + 1 < m_query.length() && m_query[m_pos+1].isDigit() ) {
+            isDecimal = true;
+            ++m_pos;
+        }
+        else if ( ( c == QLatin1Char( 'e' ) || c == QLatin1Char( 'E' ) ) && !isDouble ) {
+            isDouble = true;
+            ++m_pos;
+            if ( m_pos < m_query.length() && ( m_query[m_pos] == QLatin1Char( '+' ) || m_query[m_pos] == QLatin1Char( '-' ) ) )
+                ++m_pos;
+        }
+        else {
+            break;
+        }
+    }
+
+    const QString number = m_query.mid( start, m_pos - start );
+    QUrl dataType = Vocabulary::XMLSchema::integer();
+    if ( isDouble )
+        dataType = Vocabulary::XMLSchema::xsdDouble();
+    else if ( isDecimal )
+        dataType = Vocabulary::XMLSchema::decimal();
+
+    const LiteralValue value = LiteralValue::fromString( number, dataType );
+    if ( !value.isValid() ) {
+        setError( QString( "Invalid numeric literal '%1'" ).arg( number ) );
+        return 0;
+    }
+    return new Node( Soprano::Node( value ) );
+}
+
+
+Soprano::Query::BgpParser::BgpParser()
+{
+}
+
+
+Soprano::Query::BgpParser::~BgpParser()
+{
+}
+
+
+bool Soprano::Query::BgpParser::parse( const QString& query, ParsedQuery* result ) const
+{
+    Private p( query );
+    if ( p.parse( result ) ) {
+        clearError();
+        return true;
+    }
+    else {
+        setError( p.error() );
+        return false;
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef SOPRANO_QUERY_BGP_PARSER_H
+#define SOPRANO_QUERY_BGP_PARSER_H
+
+#include "query.h"
+#include "error.h"
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+namespace Soprano {
+    namespace Query {
+        /**
+         * The result of BgpParser::parse(). Query::Query has no notion of
+         * solution modifiers or CONSTRUCT templates, thus they are kept
+         * separately.
+         */
+        struct ParsedQuery {
+            ParsedQuery()
+                : query( Query::INVALID_QUERY ),
+                  distinct( false ),
+                  limit( -1 ),
+                  offset( 0 ) {
+            }
+
+            Query query;
+
+            /// The template of a CONSTRUCT query
+            QList<TriplePattern> constructTemplate;
+
+            bool distinct;
+            int limit;
+            int offset;
+        };
+
+        /**
+         * A small built-in parser for the subset of SPARQL which consists of
+         * basic graph patterns: SELECT, ASK, and CONSTRUCT queries with PREFIX
+         * and BASE declarations, triple patterns (including the ';' and ','
+         * abbreviations), GRAPH blocks, nested groups, UNION, DISTINCT, LIMIT,
+         * and OFFSET.
+         *
+         * FILTER supports the logical operators, comparisons of terms with '='
+         * and '!=', and the BOUND, isIRI, isURI, isBlank, isLiteral, and sameTerm
+         * functions.
+         *
+         * The condition of the resulting query is a LogicAnd for each group.
+         * Its conditions are the triple patterns, a LogicOr of the alternatives
+         * for each UNION, and the filter expressions.
+         *
+         * Blank nodes in the WHERE clause are converted into variables whose
+         * name starts with "_:" and which are never part of the result.
+         *
+         * Anything else (OPTIONAL, ORDER BY, other filter expressions, ...)
+         * results in an Error::ErrorNotSupported error.
+         */
+        class BgpParser : public Error::ErrorCache
+        {
+        public:
+            BgpParser();
+            ~BgpParser();
+
+            /**
+             * Parse \p query into \p result.
+             *
+             * \return \p true on success. On error lastError() contains the details.
+             */
+            bool parse( const QString& query, ParsedQuery* result ) const;
+
+        private:
+            class Private;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,207 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "parameterizedquery.h"
+#include "bindingset.h"
+#include "model.h"
+#include "node.h"
+#include "queryresultiterator.h"
+
+#include <QtCore/QSet>
+
+
+namespace {
+    bool isParameterChar( const QChar& c ) {
+        return c.isLetterOrNumber() || c == QLatin1Char( '_' );
+    }
+
+    /// parameters need to start a new token, otherwise we would catch percent-encoded names
+    bool canPrecedeParameter( const QChar& c ) {
+        return c.isSpace() || QString::fromLatin1( "({[,;=!<>+*/|&" ).contains( c );
+    }
+
+    /// \return The position after the string literal starting at \p pos
+    int skipString( const QString& s, int pos ) {
+        const QChar quote = s[pos];
+        const bool longString = ( pos + 2 < s.length() && s[pos+1] == quote && s[pos+2] == quote );
+        int i = pos + ( longString ? 3 : 1 );
+        while ( i < s.length() ) {
+            if ( s[i] == QLatin1Char( '\\' ) ) {
+                i += 2;
+            }
+            else if ( s[i] == quote ) {
+                if ( !longString )
+                    return i + 1;
+                else if ( i + 2 < s.length() && s[i+1] == quote && s[i+2] == quote )
+                    return i + 3;
+                else
+                    ++i;
+            }
+            else {
+                ++i;
+            }
+        }
+        return s.length();
+    }
+}
+
+
+Soprano::Query::ParameterizedQuery::ParameterizedQuery( const QString& query )
+    : m_query( query )
+{
+    // tracks if we are in parentheses (expressions) or braces (patterns)
+    QList<QChar> nesting;
+
+    int fragmentStart = 0;
+    int i = 0;
+    const int len = query.length();
+    while ( i < len ) {
+        const QChar c = query[i];
+        if ( c == QLatin1Char( '"' ) || c == QLatin1Char( '\'' ) ) {
+            i = skipString( query, i );
+        }
+        else if ( c == QLatin1Char( '#' ) ) {
+            while ( i < len && query[i] != QLatin1Char( '\n' ) )
+                ++i;
+        }
+        else if ( c == QLatin1Char( '<' ) ) {
+            // an IRI or a less-than operator
+            int j = i + 1;
+            while ( j < len && query[j] != QLatin1Char( '>' ) && query[j] != QLatin1Char( '<' ) && !query[j].isSpace() )
+                ++j;
+            i = ( j < len && query[j] == QLatin1Char( '>' ) ) ? j + 1 : i + 1;
+        }
+        else if ( c == QLatin1Char( '(' ) ) {
+            nesting.append( c );
+            ++i;
+        }
+        else if ( c == QLatin1Char( '{' ) || c == QLatin1Char( '[' ) ) {
+            nesting.append( QLatin1Char( '{' ) );
+            ++i;
+        }
+        else if ( c == QLatin1Char( ')' ) || c == QLatin1Char( '}' ) || c == QLatin1Char( ']' ) ) {
+            if ( !nesting.isEmpty() )
+                nesting.removeLast();
+            ++i;
+        }
+        else if ( c == QLatin1Char( '%' ) &&
+                  i + 1 < len && isParameterChar( query[i+1] ) &&
+                  ( i == 0 || canPrecedeParameter( query[i-1] ) ) ) {
+            int j = i + 1;
+            while ( j < len && isParameterChar( query[j] ) )
+                ++j;
+            m_fragments.append( query.mid( fragmentStart, i - fragmentStart ) );
+            m_names.append( query.mid( i + 1, j - i - 1 ) );
+            m_inExpression.append( !nesting.isEmpty() && nesting.last() == QLatin1Char( '(' ) );
+            fragmentStart = i = j;
+        }
+        else {
+            ++i;
+        }
+    }
+    m_fragments.append( query.mid( fragmentStart ) );
+}
+
+
+QStringList Soprano::Query::ParameterizedQuery::parameterNames() const
+{
+    QStringList names;
+    QSet<QString> seen;
+    Q_FOREACH( const QString& name, m_names ) {
+        if ( !seen.contains( name ) ) {
+            seen.insert( name );
+            names.append( name );
+        }
+    }
+    return names;
+}
+
+
+QString Soprano::Query::ParameterizedQuery::buildQuery( const QStringList& replacements ) const
+{
+    Q_ASSERT( replacements.count() == m_names.count() );
+
+    QString query = m_fragments.first();
+    for ( int i = 0; i < m_names.count(); ++i ) {
+        query += replacements[i];
+        query += m_fragments[i+1];
+    }
+    return query;
+}
+
+
+QString Soprano::Query::ParameterizedQuery::substitute( const BindingSet& bindings, QString* unboundParameter ) const
+{
+    QStringList values;
+    Q_FOREACH( const QString& name, m_names ) {
+        const Node value = bindings[name];
+        if ( !value.isValid() ) {
+            if ( unboundParameter )
+                *unboundParameter = name;
+            return QString();
+        }
+        values.append( value.toN3() );
+    }
+    return buildQuery( values );
+}
+
+
+Soprano::Query::SubstitutingPreparedQueryBackend::SubstitutingPreparedQueryBackend( const Model* model,
+                                                                                     const QString& query,
+                                                                                     QueryLanguage language,
+                                                                                     const QString& userQueryLanguage )
+    : m_model( const_cast<Model*>( model ) ),
+      m_query( query ),
+      m_language( language ),
+      m_userQueryLanguage( userQueryLanguage )
+{
+}
+
+
+Soprano::Query::SubstitutingPreparedQueryBackend::~SubstitutingPreparedQueryBackend()
+{
+}
+
+
+QStringList Soprano::Query::SubstitutingPreparedQueryBackend::parameterNames() const
+{
+    return m_query.parameterNames();
+}
+
+
+Soprano::QueryResultIterator Soprano::Query::SubstitutingPreparedQueryBackend::executeQuery( const BindingSet& bindings )
+{
+    if ( !m_model ) {
+        setError( "The model of the prepared query has been deleted." );
+        return QueryResultIterator();
+    }
+
+    QString unbound;
+    const QString query = m_query.substitute( bindings, &unbound );
+    if ( query.isNull() ) {
+        setError( QString::fromLatin1( "No value bound to parameter %1" ).arg( unbound ), Error::ErrorInvalidArgument );
+        return QueryResultIterator();
+    }
+
+    QueryResultIterator it = m_model->executeQuery( query, m_language, m_userQueryLanguage );
+    setError( m_model->lastError() );
+    return it;
+}
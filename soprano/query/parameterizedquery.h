@@ -0,0 +1,134 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef SOPRANO_QUERY_PARAMETERIZED_QUERY_H
+#define SOPRANO_QUERY_PARAMETERIZED_QUERY_H
+
+#include "preparedquerybackend.h"
+#include "sopranotypes.h"
+#include "soprano_export.h"
+
+#include <QtCore/QList>
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+namespace Soprano {
+
+    class BindingSet;
+    class Model;
+
+    namespace Query {
+        /**
+         * \class ParameterizedQuery parameterizedquery.h
+         *
+         * \brief Splits a query string at its %name parameters.
+         *
+         * Parameters are only recognized outside of IRIs, string literals, and
+         * comments and need to be preceded by whitespace or an opening bracket,
+         * an operator, or a separator. Thus, percent-encoded characters in IRIs
+         * and prefixed names are left alone.
+         *
+         * Used by PreparedQuery backends to rebuild the query with the bound values
+         * or backend specific parameter markers.
+         */
+        class SOPRANO_EXPORT ParameterizedQuery
+        {
+        public:
+            ParameterizedQuery( const QString& query = QString() );
+
+            QString query() const { return m_query; }
+
+            /**
+             * The names of all parameters, each name only once.
+             */
+            QStringList parameterNames() const;
+
+            /**
+             * The number of parameter occurrences in the query.
+             */
+            int placeholderCount() const { return m_names.count(); }
+
+            /**
+             * The name of the parameter at occurrence \p i.
+             */
+            QString placeholderName( int i ) const { return m_names[i]; }
+
+            /**
+             * \return \p true if occurrence \p i is part of an expression, i.e. it is
+             * enclosed in parentheses like in a FILTER, rather than being a term
+             * in a triple pattern.
+             */
+            bool isExpressionPlaceholder( int i ) const { return m_inExpression[i]; }
+
+            /**
+             * Rebuild the query with occurrence \p i replaced by \p replacements[i].
+             */
+            QString buildQuery( const QStringList& replacements ) const;
+
+            /**
+             * Rebuild the query with each parameter replaced by the N3 representation
+             * of its value in \p bindings.
+             *
+             * \param unboundParameter Set to the name of the first parameter without a
+             * value in which case a null string is returned.
+             */
+            QString substitute( const BindingSet& bindings, QString* unboundParameter = 0 ) const;
+
+        private:
+            QString m_query;
+
+            /// the query split at the placeholders, one more than placeholders
+            QStringList m_fragments;
+            QStringList m_names;
+            QList<bool> m_inExpression;
+        };
+
+        /**
+         * \class SubstitutingPreparedQueryBackend parameterizedquery.h
+         *
+         * \brief The fallback PreparedQueryBackend which substitutes the bound values
+         * into the query string and executes it through Model::executeQuery().
+         */
+        class SOPRANO_EXPORT SubstitutingPreparedQueryBackend : public PreparedQueryBackend
+        {
+        public:
+            SubstitutingPreparedQueryBackend( const Model* model,
+                                              const QString& query,
+                                              QueryLanguage language,
+                                              const QString& userQueryLanguage = QString() );
+            ~SubstitutingPreparedQueryBackend();
+
+            QStringList parameterNames() const;
+            QueryResultIterator executeQuery( const BindingSet& bindings );
+
+            const ParameterizedQuery& query() const { return m_query; }
+
+        private:
+            QPointer<Model> m_model;
+            ParameterizedQuery m_query;
+            QueryLanguage m_language;
+            QString m_userQueryLanguage;
+        };
+    }
+}
+
+#endif
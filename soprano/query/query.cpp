@@ -1754,7 +1754,8 @@ Soprano::Query::TriplePattern::Private::Private()
   : QSharedData(),
     subject( 0 ),
     predicate( 0 ),
-    object( 0 )
+    object( 0 ),
+    context( 0 )
 {
 }
 
@@ -1762,7 +1763,8 @@ Soprano::Query::TriplePattern::Private::Private( const Private& other )
   : QSharedData(),
     subject( 0 ),
     predicate( 0 ),
-    object( 0 )
+    object( 0 ),
+    context( 0 )
 {
     if ( other.subject ) {
         subject = other.subject->clone();
@@ -1773,6 +1775,9 @@ Soprano::Query::TriplePattern::Private::Private( const Private& other )
     if ( other.object ) {
         object = other.object->clone();
     }
+    if ( other.context ) {
+        context = other.context->clone();
+    }
 }
 
 Soprano::Query::TriplePattern::Private::~Private()
@@ -1780,6 +1785,7 @@ Soprano::Query::TriplePattern::Private::~Private()
     delete subject;
     delete predicate;
     delete object;
+    delete context;
 }
 
 Soprano::Query::TriplePattern::TriplePattern()
@@ -1846,6 +1852,17 @@ const Soprano::Query::RTerm *Soprano::Query::TriplePattern::object() const
    return d->object;
 }
 
+void Soprano::Query::TriplePattern::setContext( RTerm *context )
+{
+   delete d->context;
+   d->context = context;
+}
+
+const Soprano::Query::RTerm *Soprano::Query::TriplePattern::context() const
+{
+   return d->context;
+}
+
 Soprano::Query::TriplePattern* Soprano::Query::TriplePattern::clone() const
 {
     return new TriplePattern( *this );
@@ -272,17 +272,17 @@ namespace Soprano
             QSharedDataPointer<Private> d;
         };
 
-        class SOPRANO_EXPORT UnaryRTermBooleanExpression: public BooleanExpression, UnaryRTermExpressionBase {
+        class SOPRANO_EXPORT UnaryRTermBooleanExpression: public BooleanExpression, public UnaryRTermExpressionBase {
         public:
             UnaryRTermBooleanExpression( RTerm *rterm );
         };
 
-        class SOPRANO_EXPORT UnaryRTermStringExpression: public StringExpression, UnaryRTermExpressionBase {
+        class SOPRANO_EXPORT UnaryRTermStringExpression: public StringExpression, public UnaryRTermExpressionBase {
         public:
             UnaryRTermStringExpression( RTerm *rterm );
         };
 
-        class SOPRANO_EXPORT UnaryRTermNumericalExpression: public NumericalExpression, UnaryRTermExpressionBase {
+        class SOPRANO_EXPORT UnaryRTermNumericalExpression: public NumericalExpression, public UnaryRTermExpressionBase {
         public:
             UnaryRTermNumericalExpression( RTerm *rterm );
         };
@@ -925,6 +925,7 @@ namespace Soprano
                 RTerm *subject;
                 RTerm *predicate;
                 RTerm *object;
+                RTerm *context;
             };
             QSharedDataPointer<Private> d;
         };
@@ -0,0 +1,1102 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "queryevaluator.h"
+#include "bgpparser.h"
+#include "query.h"
+
+#include "../model.h"
+#include "../node.h"
+#include "../statement.h"
+#include "../statementiterator.h"
+#include "../queryresultiterator.h"
+#include "../queryresultiteratorbackend.h"
+#include "../requestcontext.h"
+#include "../literalvalue.h"
+#include "../vocabulary/xsd.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtCore/QVector>
+#include <QtCore/QStringList>
+#include <QtCore/QRegExp>
+#include <QtCore/QUuid>
+
+#include <limits>
+
+
+namespace {
+    /**
+     * Patterns with more estimated matches than this are always joined through
+     * index lookups instead of loading them into a hash table.
+     */
+    const int s_estimateLimit = 1000;
+
+    /// The number of scanned statements after which we check if the request has been cancelled
+    const int s_cancelCheckInterval = 1024;
+
+    /// One solution, indexed by variable slot
+    typedef QVector<Soprano::Node> Row;
+
+    /**
+     * A hashable set of values of the join variables.
+     */
+    struct JoinKey {
+        QVector<Soprano::Node> values;
+    };
+
+    bool operator==( const JoinKey& a, const JoinKey& b ) {
+        return a.values == b.values;
+    }
+
+    uint qHash( const JoinKey& key ) {
+        uint h = 0;
+        for ( int i = 0; i < key.values.count(); ++i )
+            h = 31 * h + Soprano::qHash( key.values[i] );
+        return h;
+    }
+
+    JoinKey joinKey( const Row& row, const QList<int>& slots ) {
+        JoinKey key;
+        key.values.reserve( slots.count() );
+        Q_FOREACH( int slot, slots )
+            key.values.append( row[slot] );
+        return key;
+    }
+
+
+    struct Term {
+        Term()
+            : slot( -1 ) {
+        }
+
+        /// -1 for constants
+        int slot;
+        /// the constant, empty for the unrestricted context
+        Soprano::Node node;
+    };
+
+    /// A triple pattern with its terms in SPOC order
+    struct Pattern {
+        Pattern()
+            : estimate( 0 ) {
+        }
+
+        Term terms[4];
+        int estimate;
+
+        /// the other form of a constant string object, see alternativeStringForm()
+        Soprano::Node alternativeObject;
+    };
+
+
+    /**
+     * RDF 1.1 treats simple literals and xsd:string literals with the same value as
+     * the same term while Soprano::LiteralValue does not. The data added through the
+     * API mostly uses xsd:string, parsed data and queries mostly use simple literals.
+     *
+     * \return The other form of \p node or an empty node if there is none.
+     */
+    Soprano::Node alternativeStringForm( const Soprano::Node& node )
+    {
+        if ( node.isLiteral() ) {
+            const Soprano::LiteralValue value = node.literal();
+            if ( value.isPlain() ) {
+                if ( value.language().isEmpty() )
+                    return Soprano::Node( Soprano::LiteralValue( value.toString() ) );
+            }
+            else if ( value.dataTypeUri() == Soprano::Vocabulary::XMLSchema::string() ) {
+                return Soprano::Node( Soprano::LiteralValue::createPlainLiteral( value.toString() ) );
+            }
+        }
+        return Soprano::Node();
+    }
+
+
+    bool sameTerm( const Soprano::Node& a, const Soprano::Node& b )
+    {
+        return a == b || ( b.isLiteral() && alternativeStringForm( a ) == b );
+    }
+
+
+    /**
+     * A group graph pattern: the basic graph pattern, the UNIONs joined with it,
+     * and the filters applied to the result.
+     */
+    struct GroupPattern {
+        QList<Pattern> patterns;
+        /// the alternatives of each UNION as indexes of groups
+        QList<QList<int> > unions;
+        QList<const Soprano::Query::BooleanExpression*> filters;
+    };
+
+
+    /// The result of a filter, FilterError being the SPARQL type error
+    enum Truth {
+        FilterFalse,
+        FilterTrue,
+        FilterError
+    };
+
+
+    /**
+     * The evaluation of the condition of one query.
+     */
+    class QueryEvaluation
+    {
+    public:
+        QueryEvaluation( const Soprano::Model* model )
+            : m_model( model ),
+              m_context( Soprano::RequestContext::current() ),
+              m_cancelled( false ) {
+        }
+
+        /**
+         * Convert \p condition into groups. The expressions have to stay valid
+         * until run() returns.
+         *
+         * \return \p false if the condition contains unsupported expressions,
+         * buildError() contains the details.
+         */
+        bool setCondition( const Soprano::Query::BooleanExpression* condition );
+        Soprano::Error::Error buildError() const { return m_buildError; }
+
+        /**
+         * \return The slot of the variable \p name, creating it if necessary.
+         */
+        int slot( const QString& name );
+
+        QStringList variableNames() const { return m_variableNames; }
+
+        /**
+         * \return The variables used in triple patterns in the order they appear.
+         */
+        QStringList patternVariableNames() const;
+
+        /**
+         * Evaluate the condition.
+         *
+         * \param maxRows Stop after this many solutions, -1 for all.
+         */
+        QList<Row> run( int maxRows );
+
+        /**
+         * \return \p true if run() has been aborted since the running request
+         * was cancelled.
+         */
+        bool wasCancelled() const { return m_cancelled; }
+        Soprano::Error::Error cancelError() const { return m_context.cancelError(); }
+
+    private:
+        int addGroup( const Soprano::Query::BooleanExpression* expression );
+        bool addToGroup( int group, const Soprano::Query::BooleanExpression* expression );
+        bool addFilter( const Soprano::Query::BooleanExpression* expression );
+        bool addPattern( int group, const Soprano::Query::TriplePattern* tp );
+
+        QList<Row> evaluateGroup( int group, const QList<Row>& rows, int maxRows );
+        QList<Row> evaluatePatterns( QList<Pattern> patterns, const QList<Row>& rows, int maxRows );
+        Truth evaluateFilter( const Soprano::Query::BooleanExpression* expression, const Row& row ) const;
+        Soprano::Node value( const Soprano::Query::RTerm* term, const Row& row ) const;
+
+        bool checkCancelled() const;
+        bool convertTerm( const Soprano::Query::RTerm* rterm, Term* term );
+        Soprano::Statement bind( const Pattern& p, const Row& row ) const;
+        bool match( const Pattern& p, const Soprano::Statement& s, Row* row ) const;
+        int estimate( const Pattern& p ) const;
+        QList<int> order( const QList<Pattern>& patterns, QVector<bool> bound ) const;
+        QList<Soprano::Statement> lookups( const Pattern& p, const Row& row ) const;
+        QList<Row> bindJoin( const Pattern& p, const QList<Row>& rows, int maxRows ) const;
+        QList<Row> hashJoin( const Pattern& p, const QList<Row>& rows, const QList<int>& shared, int maxRows ) const;
+
+        const Soprano::Model* m_model;
+        Soprano::RequestContext m_context;
+        mutable bool m_cancelled;
+        QList<GroupPattern> m_groups;
+        QHash<QString, int> m_slots;
+        QStringList m_variableNames;
+        QSet<int> m_patternSlots;
+        Soprano::Error::Error m_buildError;
+    };
+
+
+    bool containsPattern( const Soprano::Query::BooleanExpression* expression )
+    {
+        if ( dynamic_cast<const Soprano::Query::TriplePattern*>( expression ) ) {
+            return true;
+        }
+        else if ( const Soprano::Query::BooleanSetExpression* set = dynamic_cast<const Soprano::Query::BooleanSetExpression*>( expression ) ) {
+            for ( int i = 0; i < set->count(); ++i ) {
+                if ( containsPattern( set->condition( i ) ) )
+                    return true;
+            }
+        }
+        return false;
+    }
+
+
+    int QueryEvaluation::slot( const QString& name )
+    {
+        QHash<QString, int>::const_iterator it = m_slots.constFind( name );
+        if ( it != m_slots.constEnd() )
+            return it.value();
+        const int s = m_variableNames.count();
+        m_slots.insert( name, s );
+        m_variableNames.append( name );
+        return s;
+    }
+
+
+    QStringList QueryEvaluation::patternVariableNames() const
+    {
+        QStringList names;
+        for ( int i = 0; i < m_variableNames.count(); ++i ) {
+            if ( m_patternSlots.contains( i ) )
+                names.append( m_variableNames[i] );
+        }
+        return names;
+    }
+
+
+    bool QueryEvaluation::setCondition( const Soprano::Query::BooleanExpression* condition )
+    {
+        m_groups.clear();
+        return addGroup( condition ) == 0;
+    }
+
+
+    int QueryEvaluation::addGroup( const Soprano::Query::BooleanExpression* expression )
+    {
+        const int group = m_groups.count();
+        m_groups.append( GroupPattern() );
+        if ( expression && !addToGroup( group, expression ) )
+            return -1;
+        return group;
+    }
+
+
+    bool QueryEvaluation::addToGroup( int group, const Soprano::Query::BooleanExpression* expression )
+    {
+        if ( const Soprano::Query::TriplePattern* tp = dynamic_cast<const Soprano::Query::TriplePattern*>( expression ) ) {
+            if ( !addPattern( group, tp ) ) {
+                m_buildError = Soprano::Error::Error( "Invalid triple pattern", Soprano::Error::ErrorInvalidArgument );
+                return false;
+            }
+            return true;
+        }
+        else if ( const Soprano::Query::LogicAnd* conjunction = dynamic_cast<const Soprano::Query::LogicAnd*>( expression ) ) {
+            // nested groups and filter conjunctions can simply be merged
+            for ( int i = 0; i < conjunction->count(); ++i ) {
+                if ( !addToGroup( group, conjunction->condition( i ) ) )
+                    return false;
+            }
+            return true;
+        }
+        else if ( dynamic_cast<const Soprano::Query::LogicOr*>( expression ) && containsPattern( expression ) ) {
+            const Soprano::Query::LogicOr* disjunction = static_cast<const Soprano::Query::LogicOr*>( expression );
+            QList<int> alternatives;
+            for ( int i = 0; i < disjunction->count(); ++i ) {
+                const int alternative = addGroup( disjunction->condition( i ) );
+                if ( alternative < 0 )
+                    return false;
+                alternatives.append( alternative );
+            }
+            m_groups[group].unions.append( alternatives );
+            return true;
+        }
+        else if ( addFilter( expression ) ) {
+            m_groups[group].filters.append( expression );
+            return true;
+        }
+        else {
+            m_buildError = Soprano::Error::Error( "Unsupported filter expression", Soprano::Error::ErrorNotSupported );
+            return false;
+        }
+    }
+
+
+    bool QueryEvaluation::addFilter( const Soprano::Query::BooleanExpression* expression )
+    {
+        using namespace Soprano::Query;
+
+        const RTerm* terms[2] = { 0, 0 };
+        if ( const BooleanSetExpression* set = dynamic_cast<const BooleanSetExpression*>( expression ) ) {
+            if ( !dynamic_cast<const LogicAnd*>( set ) && !dynamic_cast<const LogicOr*>( set ) )
+                return false;
+            for ( int i = 0; i < set->count(); ++i ) {
+                if ( !addFilter( set->condition( i ) ) )
+                    return false;
+            }
+            return true;
+        }
+        else if ( const Not* negation = dynamic_cast<const Not*>( expression ) ) {
+            return addFilter( negation->expression() );
+        }
+        else if ( const IsBound* isBound = dynamic_cast<const IsBound*>( expression ) ) {
+            terms[0] = isBound->variable();
+        }
+        else if ( dynamic_cast<const IsIRI*>( expression ) ||
+                  dynamic_cast<const IsBlank*>( expression ) ||
+                  dynamic_cast<const IsLiteral*>( expression ) ) {
+            terms[0] = static_cast<const UnaryRTermBooleanExpression*>( expression )->rterm();
+        }
+        else if ( dynamic_cast<const RTermEqual*>( expression ) ||
+                  dynamic_cast<const RTermNotEqual*>( expression ) ) {
+            const BinaryRTermBooleanExpression* comparison = static_cast<const BinaryRTermBooleanExpression*>( expression );
+            terms[0] = comparison->first();
+            terms[1] = comparison->second();
+            if ( !terms[1] )
+                return false;
+        }
+        else {
+            return false;
+        }
+
+        if ( !terms[0] )
+            return false;
+
+        // make sure all variables have a slot before the rows are created
+        for ( int i = 0; i < 2; ++i ) {
+            if ( const Variable* v = dynamic_cast<const Variable*>( terms[i] ) )
+                slot( v->name() );
+        }
+        return true;
+    }
+
+
+    bool QueryEvaluation::convertTerm( const Soprano::Query::RTerm* rterm, Term* term )
+    {
+        if ( !rterm ) {
+            return true;
+        }
+        else if ( const Soprano::Query::Variable* v = dynamic_cast<const Soprano::Query::Variable*>( rterm ) ) {
+            term->slot = slot( v->name() );
+            m_patternSlots.insert( term->slot );
+            return true;
+        }
+        else if ( const Soprano::Query::Node* n = dynamic_cast<const Soprano::Query::Node*>( rterm ) ) {
+            term->node = n->node();
+            return true;
+        }
+        return false;
+    }
+
+
+    bool QueryEvaluation::addPattern( int group, const Soprano::Query::TriplePattern* tp )
+    {
+        if ( !tp->subject() || !tp->predicate() || !tp->object() )
+            return false;
+
+        Pattern p;
+        if ( !convertTerm( tp->subject(), &p.terms[0] ) ||
+             !convertTerm( tp->predicate(), &p.terms[1] ) ||
+             !convertTerm( tp->object(), &p.terms[2] ) ||
+             !convertTerm( tp->context(), &p.terms[3] ) )
+            return false;
+
+        if ( p.terms[2].slot < 0 )
+            p.alternativeObject = alternativeStringForm( p.terms[2].node );
+
+        m_groups[group].patterns.append( p );
+        return true;
+    }
+
+
+    Soprano::Statement QueryEvaluation::bind( const Pattern& p, const Row& row ) const
+    {
+        Soprano::Node nodes[4];
+        for ( int i = 0; i < 4; ++i ) {
+            const Term& t = p.terms[i];
+            nodes[i] = ( t.slot >= 0 ? row[t.slot] : t.node );
+        }
+        return Soprano::Statement( nodes[0], nodes[1], nodes[2], nodes[3] );
+    }
+
+
+    bool QueryEvaluation::match( const Pattern& p, const Soprano::Statement& s, Row* row ) const
+    {
+        const Soprano::Node nodes[4] = { s.subject(), s.predicate(), s.object(), s.context() };
+        for ( int i = 0; i < 4; ++i ) {
+            const int slot = p.terms[i].slot;
+            if ( slot < 0 )
+                continue;
+
+            Soprano::Node& value = ( *row )[slot];
+            if ( value.isEmpty() ) {
+                // a graph variable never matches the default graph
+                if ( nodes[i].isEmpty() )
+                    return false;
+                value = nodes[i];
+            }
+            else if ( value != nodes[i] ) {
+                // the same variable used twice in one pattern
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    QList<Soprano::Statement> QueryEvaluation::lookups( const Pattern& p, const Row& row ) const
+    {
+        QList<Soprano::Statement> result;
+        result.append( bind( p, row ) );
+        if ( p.alternativeObject.isValid() ) {
+            Soprano::Statement s( result.first() );
+            s.setObject( p.alternativeObject );
+            result.append( s );
+        }
+        return result;
+    }
+
+
+    int QueryEvaluation::estimate( const Pattern& p ) const
+    {
+        int total = 0;
+        Q_FOREACH( const Soprano::Statement& s, lookups( p, Row( m_variableNames.count() ) ) ) {
+            const int cnt = m_model->estimateCount( s );
+            // treat failed estimates as expensive
+            if ( cnt < 0 || cnt > std::numeric_limits<int>::max() - total )
+                return std::numeric_limits<int>::max();
+            total += cnt;
+        }
+        return total;
+    }
+
+
+    QList<int> QueryEvaluation::order( const QList<Pattern>& patterns, QVector<bool> bound ) const
+    {
+        QList<int> result;
+        QList<int> remaining;
+        for ( int i = 0; i < patterns.count(); ++i )
+            remaining.append( i );
+
+        while ( !remaining.isEmpty() ) {
+            int best = -1;
+            bool bestConnected = false;
+            for ( int r = 0; r < remaining.count(); ++r ) {
+                const Pattern& p = patterns[remaining[r]];
+                bool connected = false;
+                for ( int i = 0; i < 4; ++i ) {
+                    if ( p.terms[i].slot >= 0 && bound[p.terms[i].slot] )
+                        connected = true;
+                }
+
+                // avoid cartesian products whenever possible
+                if ( best < 0 ||
+                     ( connected && !bestConnected ) ||
+                     ( connected == bestConnected && p.estimate < patterns[remaining[best]].estimate ) ) {
+                    best = r;
+                    bestConnected = connected;
+                }
+            }
+
+            const int index = remaining.takeAt( best );
+            result.append( index );
+            for ( int i = 0; i < 4; ++i ) {
+                if ( patterns[index].terms[i].slot >= 0 )
+                    bound[patterns[index].terms[i].slot] = true;
+            }
+        }
+
+        return result;
+    }
+
+
+    bool QueryEvaluation::checkCancelled() const
+    {
+        if ( !m_cancelled && m_context.isCancelled() )
+            m_cancelled = true;
+        return m_cancelled;
+    }
+
+
+    QList<Row> QueryEvaluation::bindJoin( const Pattern& p, const QList<Row>& rows, int maxRows ) const
+    {
+        QList<Row> result;
+        Q_FOREACH( const Row& row, rows ) {
+            if ( checkCancelled() )
+                return QList<Row>();
+            Q_FOREACH( const Soprano::Statement& lookup, lookups( p, row ) ) {
+                Soprano::StatementIterator it = m_model->listStatements( lookup );
+                while ( it.next() ) {
+                    Row r( row );
+                    if ( match( p, *it, &r ) ) {
+                        result.append( r );
+                        if ( result.count() == maxRows ) {
+                            it.close();
+                            return result;
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+
+    QList<Row> QueryEvaluation::hashJoin( const Pattern& p, const QList<Row>& rows, const QList<int>& shared, int maxRows ) const
+    {
+        // build the hash table from the statements matching the pattern on its own
+        const Row emptyRow( m_variableNames.count() );
+        QHash<JoinKey, Row> table;
+        int cnt = 0;
+        Q_FOREACH( const Soprano::Statement& lookup, lookups( p, emptyRow ) ) {
+            Soprano::StatementIterator it = m_model->listStatements( lookup );
+            while ( it.next() ) {
+                if ( ++cnt % s_cancelCheckInterval == 0 && checkCancelled() )
+                    return QList<Row>();
+                Row r( emptyRow );
+                if ( match( p, *it, &r ) )
+                    table.insertMulti( joinKey( r, shared ), r );
+            }
+        }
+
+        QList<int> unbound;
+        if ( !rows.isEmpty() ) {
+            for ( int i = 0; i < 4; ++i ) {
+                const int slot = p.terms[i].slot;
+                if ( slot >= 0 && !shared.contains( slot ) && !unbound.contains( slot ) )
+                    unbound.append( slot );
+            }
+        }
+
+        // and probe it with the intermediate solutions
+        QList<Row> result;
+        Q_FOREACH( const Row& row, rows ) {
+            const JoinKey key = joinKey( row, shared );
+            QHash<JoinKey, Row>::const_iterator entry = table.constFind( key );
+            for ( ; entry != table.constEnd() && entry.key() == key; ++entry ) {
+                // after a UNION a variable may be bound in some of the solutions only
+                Row r( row );
+                bool compatible = true;
+                Q_FOREACH( int slot, unbound ) {
+                    if ( r[slot].isEmpty() )
+                        r[slot] = entry.value()[slot];
+                    else if ( r[slot] != entry.value()[slot] )
+                        compatible = false;
+                }
+                if ( !compatible )
+                    continue;
+                result.append( r );
+                if ( result.count() == maxRows )
+                    return result;
+            }
+        }
+        return result;
+    }
+
+
+    QList<Row> QueryEvaluation::evaluatePatterns( QList<Pattern> patterns, const QList<Row>& input, int maxRows )
+    {
+        if ( patterns.isEmpty() || input.isEmpty() ) {
+            return ( maxRows >= 0 && input.count() > maxRows ) ? input.mid( 0, maxRows ) : input;
+        }
+
+        const int slotCount = m_variableNames.count();
+
+        for ( int i = 0; i < patterns.count(); ++i ) {
+            patterns[i].estimate = estimate( patterns[i] );
+            if ( patterns[i].estimate == 0 ) {
+                // nothing can match
+                return QList<Row>();
+            }
+        }
+
+        // only variables bound in all solutions can be used as join keys
+        QVector<bool> bound( slotCount, true );
+        Q_FOREACH( const Row& row, input ) {
+            for ( int i = 0; i < slotCount; ++i ) {
+                if ( row[i].isEmpty() )
+                    bound[i] = false;
+            }
+        }
+
+        QList<Row> rows = input;
+        const QList<int> patternOrder = order( patterns, bound );
+        for ( int step = 0; step < patternOrder.count() && !rows.isEmpty(); ++step ) {
+            if ( checkCancelled() )
+                return QList<Row>();
+
+            const Pattern& p = patterns[patternOrder[step]];
+            const bool last = ( step == patternOrder.count() - 1 );
+
+            QList<int> shared;
+            for ( int i = 0; i < 4; ++i ) {
+                const int slot = p.terms[i].slot;
+                if ( slot >= 0 && bound[slot] && !shared.contains( slot ) )
+                    shared.append( slot );
+            }
+
+            // a bind join costs one index lookup per solution, a hash join one scan of the pattern
+            if ( shared.isEmpty() ||
+                 ( p.estimate < s_estimateLimit && p.estimate < rows.count() ) ) {
+                rows = hashJoin( p, rows, shared, last ? maxRows : -1 );
+            }
+            else {
+                rows = bindJoin( p, rows, last ? maxRows : -1 );
+            }
+
+            for ( int i = 0; i < 4; ++i ) {
+                if ( p.terms[i].slot >= 0 )
+                    bound[p.terms[i].slot] = true;
+            }
+        }
+
+        if ( maxRows >= 0 && rows.count() > maxRows )
+            rows = rows.mid( 0, maxRows );
+
+        return rows;
+    }
+
+
+    QList<Row> QueryEvaluation::evaluateGroup( int group, const QList<Row>& input, int maxRows )
+    {
+        const GroupPattern& g = m_groups[group];
+
+        // we can only stop early in the last step and if no solutions are filtered afterwards
+        QList<Row> rows = evaluatePatterns( g.patterns,
+                                            input,
+                                            g.unions.isEmpty() && g.filters.isEmpty() ? maxRows : -1 );
+
+        // the join distributes over the union, thus each alternative is evaluated
+        // on the solutions of the group so far
+        for ( int u = 0; u < g.unions.count() && !rows.isEmpty(); ++u ) {
+            const bool last = ( u == g.unions.count() - 1 && g.filters.isEmpty() );
+            QList<Row> result;
+            Q_FOREACH( int alternative, g.unions[u] ) {
+                result += evaluateGroup( alternative, rows, last && maxRows >= 0 ? maxRows - result.count() : -1 );
+                if ( m_cancelled )
+                    return QList<Row>();
+                if ( last && maxRows >= 0 && result.count() >= maxRows )
+                    break;
+            }
+            rows = result;
+        }
+
+        if ( !g.filters.isEmpty() ) {
+            QList<Row> result;
+            Q_FOREACH( const Row& row, rows ) {
+                bool accepted = true;
+                Q_FOREACH( const Soprano::Query::BooleanExpression* filter, g.filters ) {
+                    if ( evaluateFilter( filter, row ) != FilterTrue ) {
+                        accepted = false;
+                        break;
+                    }
+                }
+                if ( accepted ) {
+                    result.append( row );
+                    if ( result.count() == maxRows )
+                        break;
+                }
+            }
+            rows = result;
+        }
+
+        return rows;
+    }
+
+
+    Soprano::Node QueryEvaluation::value( const Soprano::Query::RTerm* term, const Row& row ) const
+    {
+        if ( const Soprano::Query::Variable* v = dynamic_cast<const Soprano::Query::Variable*>( term ) )
+            return row.value( m_slots.value( v->name(), -1 ) );
+        else if ( const Soprano::Query::Node* n = dynamic_cast<const Soprano::Query::Node*>( term ) )
+            return n->node();
+        else
+            return Soprano::Node();
+    }
+
+
+    Truth QueryEvaluation::evaluateFilter( const Soprano::Query::BooleanExpression* expression, const Row& row ) const
+    {
+        using namespace Soprano::Query;
+
+        if ( const LogicAnd* conjunction = dynamic_cast<const LogicAnd*>( expression ) ) {
+            // an error only matters if no operand is false
+            Truth result = FilterTrue;
+            for ( int i = 0; i < conjunction->count(); ++i ) {
+                const Truth t = evaluateFilter( conjunction->condition( i ), row );
+                if ( t == FilterFalse )
+                    return FilterFalse;
+                else if ( t == FilterError )
+                    result = FilterError;
+            }
+            return result;
+        }
+        else if ( const LogicOr* disjunction = dynamic_cast<const LogicOr*>( expression ) ) {
+            Truth result = FilterFalse;
+            for ( int i = 0; i < disjunction->count(); ++i ) {
+                const Truth t = evaluateFilter( disjunction->condition( i ), row );
+                if ( t == FilterTrue )
+                    return FilterTrue;
+                else if ( t == FilterError )
+                    result = FilterError;
+            }
+            return result;
+        }
+        else if ( const Not* negation = dynamic_cast<const Not*>( expression ) ) {
+            const Truth t = evaluateFilter( negation->expression(), row );
+            return t == FilterError ? FilterError : ( t == FilterTrue ? FilterFalse : FilterTrue );
+        }
+        else if ( const IsBound* isBound = dynamic_cast<const IsBound*>( expression ) ) {
+            return value( isBound->variable(), row ).isValid() ? FilterTrue : FilterFalse;
+        }
+        else if ( const UnaryRTermBooleanExpression* test = dynamic_cast<const UnaryRTermBooleanExpression*>( expression ) ) {
+            const Soprano::Node node = value( test->rterm(), row );
+            if ( !node.isValid() )
+                return FilterError;
+            else if ( dynamic_cast<const IsIRI*>( expression ) )
+                return node.isResource() ? FilterTrue : FilterFalse;
+            else if ( dynamic_cast<const IsBlank*>( expression ) )
+                return node.isBlank() ? FilterTrue : FilterFalse;
+            else
+                return node.isLiteral() ? FilterTrue : FilterFalse;
+        }
+        else if ( const BinaryRTermBooleanExpression* comparison = dynamic_cast<const BinaryRTermBooleanExpression*>( expression ) ) {
+            // terms are compared as in sameTerm(), i.e. literals of different types never match
+            const Soprano::Node first = value( comparison->first(), row );
+            const Soprano::Node second = value( comparison->second(), row );
+            if ( !first.isValid() || !second.isValid() )
+                return FilterError;
+            const bool equal = sameTerm( first, second );
+            if ( dynamic_cast<const RTermEqual*>( expression ) )
+                return equal ? FilterTrue : FilterFalse;
+            else
+                return equal ? FilterFalse : FilterTrue;
+        }
+        return FilterError;
+    }
+
+
+    QList<Row> QueryEvaluation::run( int maxRows )
+    {
+        QList<Row> rows;
+        rows.append( Row( m_variableNames.count() ) );
+        return evaluateGroup( 0, rows, maxRows );
+    }
+
+
+    void collectPatterns( const Soprano::Query::BooleanExpression* expression, QList<const Soprano::Query::TriplePattern*>* patterns )
+    {
+        if ( const Soprano::Query::TriplePattern* tp = dynamic_cast<const Soprano::Query::TriplePattern*>( expression ) ) {
+            patterns->append( tp );
+        }
+        else if ( const Soprano::Query::BooleanSetExpression* set = dynamic_cast<const Soprano::Query::BooleanSetExpression*>( expression ) ) {
+            for ( int i = 0; i < set->count(); ++i )
+                collectPatterns( set->condition( i ), patterns );
+        }
+    }
+
+
+    bool isBlankVariable( const QString& name ) {
+        return name.startsWith( QLatin1String( "_:" ) );
+    }
+
+
+    /**
+     * Iterates over the precomputed result of a query.
+     */
+    class EvaluatorQueryResultIteratorBackend : public Soprano::QueryResultIteratorBackend
+    {
+    public:
+        EvaluatorQueryResultIteratorBackend( const QStringList& names, const QList<Row>& rows )
+            : m_type( Soprano::Query::Query::SELECT_QUERY ),
+              m_names( names ),
+              m_rows( rows ),
+              m_boolValue( false ),
+              m_pos( -1 ) {
+        }
+
+        EvaluatorQueryResultIteratorBackend( const QList<Soprano::Statement>& statements )
+            : m_type( Soprano::Query::Query::GRAPH_QUERY ),
+              m_statements( statements ),
+              m_boolValue( false ),
+              m_pos( -1 ) {
+        }
+
+        EvaluatorQueryResultIteratorBackend( bool value )
+            : m_type( Soprano::Query::Query::BOOLEAN_QUERY ),
+              m_boolValue( value ),
+              m_pos( -1 ) {
+        }
+
+        bool next() {
+            if ( isBool() )
+                return false;
+
+            const int count = isGraph() ? m_statements.count() : m_rows.count();
+            if ( m_pos + 1 < count ) {
+                ++m_pos;
+                return true;
+            }
+            else {
+                close();
+                return false;
+            }
+        }
+
+        Soprano::Statement currentStatement() const {
+            if ( isGraph() && m_pos >= 0 && m_pos < m_statements.count() )
+                return m_statements[m_pos];
+            else
+                return Soprano::Statement();
+        }
+
+        Soprano::Node binding( const QString& name ) const {
+            return binding( m_names.indexOf( name ) );
+        }
+
+        Soprano::Node binding( int offset ) const {
+            if ( isBinding() && m_pos >= 0 && m_pos < m_rows.count() )
+                return m_rows[m_pos].value( offset );
+            else
+                return Soprano::Node();
+        }
+
+        int bindingCount() const {
+            return m_names.count();
+        }
+
+        QStringList bindingNames() const {
+            return m_names;
+        }
+
+        bool isGraph() const {
+            return m_type == Soprano::Query::Query::GRAPH_QUERY;
+        }
+
+        bool isBinding() const {
+            return m_type == Soprano::Query::Query::SELECT_QUERY;
+        }
+
+        bool isBool() const {
+            return m_type == Soprano::Query::Query::BOOLEAN_QUERY;
+        }
+
+        bool boolValue() const {
+            return m_boolValue;
+        }
+
+        void close() {
+            m_rows.clear();
+            m_statements.clear();
+            m_pos = -1;
+        }
+
+    private:
+        Soprano::Query::Query::QueryType m_type;
+        QStringList m_names;
+        QList<Row> m_rows;
+        QList<Soprano::Statement> m_statements;
+        bool m_boolValue;
+        int m_pos;
+    };
+}
+
+
+class Soprano::Query::Evaluator::Private
+{
+public:
+    const Model* model;
+
+    QueryResultIterator evaluate( const ParsedQuery& query, const Evaluator* q ) const;
+};
+
+
+Soprano::QueryResultIterator Soprano::Query::Evaluator::Private::evaluate( const ParsedQuery& parsedQuery, const Evaluator* q ) const
+{
+    const Query& query = parsedQuery.query;
+    const Query::QueryType type = query.type();
+    if ( type != Query::SELECT_QUERY &&
+         type != Query::BOOLEAN_QUERY &&
+         type != Query::GRAPH_QUERY ) {
+        q->setError( "Invalid query type", Error::ErrorInvalidArgument );
+        return QueryResultIterator();
+    }
+
+    QueryEvaluation evaluation( model );
+    if ( !evaluation.setCondition( query.condition() ) ) {
+        q->setError( evaluation.buildError() );
+        return QueryResultIterator();
+    }
+
+    // the result names, the slots are created here for unknown projection variables
+    QStringList names;
+    QList<int> projection;
+    if ( type == Query::SELECT_QUERY ) {
+        const QueryTerms terms = query.queryTerms();
+        if ( terms.selectAll() ) {
+            Q_FOREACH( const QString& name, evaluation.patternVariableNames() ) {
+                if ( !isBlankVariable( name ) )
+                    names.append( name );
+            }
+        }
+        else {
+            Q_FOREACH( const Variable* v, terms.variables() )
+                names.append( v->name() );
+        }
+        Q_FOREACH( const QString& name, names )
+            projection.append( evaluation.slot( name ) );
+    }
+
+    // we can stop early as long as no solutions have to be removed later on
+    int maxRows = -1;
+    if ( type == Query::BOOLEAN_QUERY )
+        maxRows = 1;
+    else if ( !parsedQuery.distinct && parsedQuery.limit >= 0 )
+        maxRows = parsedQuery.offset + parsedQuery.limit;
+
+    QList<Row> rows = evaluation.run( maxRows );
+    if ( evaluation.wasCancelled() ) {
+        q->setError( evaluation.cancelError() );
+        return QueryResultIterator();
+    }
+    else if ( model->lastError() ) {
+        q->setError( model->lastError() );
+        return QueryResultIterator();
+    }
+
+    q->clearError();
+
+    if ( type == Query::BOOLEAN_QUERY ) {
+        return new EvaluatorQueryResultIteratorBackend( !rows.isEmpty() );
+    }
+
+    if ( type == Query::SELECT_QUERY ) {
+        QList<Row> projected;
+        QSet<JoinKey> seen;
+        Q_FOREACH( const Row& row, rows ) {
+            Row r( projection.count() );
+            for ( int i = 0; i < projection.count(); ++i )
+                r[i] = row[projection[i]];
+            if ( parsedQuery.distinct ) {
+                JoinKey key;
+                key.values = r;
+                if ( seen.contains( key ) )
+                    continue;
+                seen.insert( key );
+            }
+            projected.append( r );
+        }
+        rows = projected;
+    }
+
+    if ( parsedQuery.offset > 0 || parsedQuery.limit >= 0 )
+        rows = rows.mid( parsedQuery.offset, parsedQuery.limit );
+
+    if ( type == Query::SELECT_QUERY ) {
+        return new EvaluatorQueryResultIteratorBackend( names, rows );
+    }
+
+    //
+    // Graph query: instantiate the template once for each solution
+    //
+    QList<TriplePattern> constructTemplate = parsedQuery.constructTemplate;
+    if ( constructTemplate.isEmpty() ) {
+        QList<const TriplePattern*> patterns;
+        collectPatterns( query.condition(), &patterns );
+        Q_FOREACH( const TriplePattern* tp, patterns )
+            constructTemplate.append( *tp );
+    }
+
+    // Blank nodes in the template are new for each solution. The labels use a
+    // random prefix which cannot clash with the labels used in the model.
+    const QString blankPrefix = QLatin1String( "genid" ) + QUuid::createUuid().toString().remove( QRegExp( "[^0-9a-fA-F]" ) );
+    int blankCounter = 0;
+
+    QList<Statement> statements;
+    QSet<Statement> seen;
+    for ( int r = 0; r < rows.count(); ++r ) {
+        const Row& row = rows[r];
+        QHash<QString, Soprano::Node> blankNodes;
+        Q_FOREACH( const TriplePattern& tp, constructTemplate ) {
+            const RTerm* terms[3] = { tp.subject(), tp.predicate(), tp.object() };
+            Soprano::Node nodes[3];
+            for ( int i = 0; i < 3; ++i ) {
+                if ( const Variable* v = dynamic_cast<const Variable*>( terms[i] ) ) {
+                    if ( isBlankVariable( v->name() ) ) {
+                        Soprano::Node& blank = blankNodes[v->name()];
+                        if ( !blank.isValid() )
+                            blank = Soprano::Node::createBlankNode( blankPrefix + QLatin1Char( 'b' ) + QString::number( ++blankCounter ) );
+                        nodes[i] = blank;
+                    }
+                    else {
+                        nodes[i] = row.value( evaluation.slot( v->name() ) );
+                    }
+                }
+                else if ( const Node* n = dynamic_cast<const Node*>( terms[i] ) ) {
+                    nodes[i] = n->node();
+                }
+            }
+
+            // unbound variables or literal subjects are skipped silently as defined by SPARQL
+            const Statement s( nodes[0], nodes[1], nodes[2] );
+            if ( s.isValid() && !seen.contains( s ) ) {
+                seen.insert( s );
+                statements.append( s );
+            }
+        }
+    }
+
+    return new EvaluatorQueryResultIteratorBackend( statements );
+}
+
+
+Soprano::Query::Evaluator::Evaluator( const Model* model )
+    : d( new Private() )
+{
+    d->model = model;
+}
+
+
+Soprano::Query::Evaluator::~Evaluator()
+{
+    delete d;
+}
+
+
+Soprano::QueryResultIterator Soprano::Query::Evaluator::executeQuery( const Query& query ) const
+{
+    ParsedQuery parsedQuery;
+    parsedQuery.query = query;
+    return d->evaluate( parsedQuery, this );
+}
+
+
+Soprano::QueryResultIterator Soprano::Query::Evaluator::executeQuery( const QString& query, QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    if ( language != QueryLanguageSparql &&
+         language != QueryLanguageSparqlNoInference &&
+         !( language == QueryLanguageUser && userQueryLanguage.toLower() == QLatin1String( "sparql" ) ) ) {
+        setError( QString( "Unsupported query language %1" ).arg( queryLanguageToString( language, userQueryLanguage ) ),
+                  Error::ErrorNotSupported );
+        return QueryResultIterator();
+    }
+
+    BgpParser parser;
+    ParsedQuery parsedQuery;
+    if ( !parser.parse( query, &parsedQuery ) ) {
+        setError( parser.lastError() );
+        return QueryResultIterator();
+    }
+
+    return d->evaluate( parsedQuery, this );
+}
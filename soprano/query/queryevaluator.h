@@ -0,0 +1,96 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef SOPRANO_QUERY_EVALUATOR_H
+#define SOPRANO_QUERY_EVALUATOR_H
+
+#include "error.h"
+#include "sopranotypes.h"
+#include "soprano_export.h"
+
+#include <QtCore/QString>
+
+namespace Soprano {
+
+    class Model;
+    class QueryResultIterator;
+
+    namespace Query {
+
+        class Query;
+
+        /**
+         * \class Evaluator queryevaluator.h
+         *
+         * \brief Evaluates simple SPARQL queries on any Model.
+         *
+         * The Evaluator answers SELECT, ASK, and CONSTRUCT queries using nothing
+         * but Model::listStatements(). This allows models without a native query
+         * engine to serve the SPARQL queries built by the filter models.
+         *
+         * The WHERE clause may consist of triple patterns, GRAPH blocks, nested
+         * groups, UNION, and FILTERs which combine comparisons of terms with '='
+         * and '!=' and the BOUND, isIRI, isBlank, isLiteral, and sameTerm tests.
+         * Terms are always compared like sameTerm() does, i.e. "1"^^xsd:int does
+         * not equal "01"^^xsd:int. As in RDF 1.1 simple literals and xsd:string
+         * literals with the same value are the same term. OPTIONAL, ORDER BY, and any other filter
+         * expression result in an Error::ErrorNotSupported error.
+         *
+         * The triple patterns are ordered by their estimated cardinality, always
+         * preferring patterns which share a variable with the already evaluated ones.
+         * Each pattern is then either joined by binding the known variables and
+         * calling listStatements() for each intermediate solution or, if there are
+         * more intermediate solutions than statements matching the pattern, with a
+         * hash join on the shared variables. Each alternative of a UNION is evaluated
+         * on the solutions of the enclosing group, filters are applied at the end of
+         * their group.
+         *
+         * \warning The results are computed when the query is executed, i.e. the
+         * returned iterator does not keep any iterators of the model open.
+         */
+        class SOPRANO_EXPORT Evaluator : public Error::ErrorCache
+        {
+        public:
+            /**
+             * Create an evaluator working on \p model.
+             */
+            Evaluator( const Model* model );
+            ~Evaluator();
+
+            /**
+             * Evaluate a parsed query. Graph queries use the triple patterns of the
+             * condition as template.
+             */
+            QueryResultIterator executeQuery( const Query& query ) const;
+
+            /**
+             * Parse and evaluate a query string. Only Query::QueryLanguageSparql is supported.
+             */
+            QueryResultIterator executeQuery( const QString& query, QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+
+        private:
+            class Private;
+            Private* const d;
+        };
+    }
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "iteratorbackend.h"
 #include "bindingset.h"
 #include "nodeiterator.h"
+#include "util/distinctnodeiteratorbackend.h"
 
 
 Soprano::QueryResultIterator::QueryResultIterator()
@@ -226,19 +227,46 @@ namespace {
 
 Soprano::NodeIterator Soprano::QueryResultIterator::iterateBindings( const QString& variableName ) const
 {
-    if ( isValid() )
-        return new BindingNodeIteratorBackend( *this, variableName );
-    else
-        return NodeIterator();
+    return iterateBindings( variableName, false );
 }
 
 
 Soprano::NodeIterator Soprano::QueryResultIterator::iterateBindings( int offset ) const
 {
-    if ( isValid() )
-        return new BindingNodeIteratorBackend( *this, offset );
+    return iterateBindings( offset, false );
+}
+
+
+Soprano::NodeIterator Soprano::QueryResultIterator::iterateBindings( const QString& variableName, bool distinct ) const
+{
+    if ( !isValid() )
+        return NodeIterator();
+
+    // let the backend transfer only the requested column
+    if ( IteratorBackend<Node>* projected = backend()->projectColumn( -1, variableName, distinct ) )
+        return projected;
+
+    NodeIterator nodes = new BindingNodeIteratorBackend( *this, variableName );
+    if ( distinct )
+        return new Util::DistinctNodeIteratorBackend( nodes );
     else
+        return nodes;
+}
+
+
+Soprano::NodeIterator Soprano::QueryResultIterator::iterateBindings( int offset, bool distinct ) const
+{
+    if ( !isValid() )
         return NodeIterator();
+
+    if ( IteratorBackend<Node>* projected = backend()->projectColumn( offset, QString(), distinct ) )
+        return projected;
+
+    NodeIterator nodes = new BindingNodeIteratorBackend( *this, offset );
+    if ( distinct )
+        return new Util::DistinctNodeIteratorBackend( nodes );
+    else
+        return nodes;
 }
 
 
@@ -303,6 +303,31 @@ namespace Soprano {
          */
         NodeIterator iterateBindings( int offset ) const;
 
+        /**
+         * Convenience method that creates an iterator over one column of bindings in this query result,
+         * optionally without duplicates.
+         *
+         * Backends which transfer the bindings, like the ones of the %Soprano client, only transfer
+         * the requested column and remove the duplicates on their side. In that case this iterator
+         * is consumed by the new one and should not be used anymore.
+         *
+         * \param variableName The name of the requested variable.
+         * \param distinct If \p true each node is only returned once.
+         *
+         * \since 2.10
+         */
+        NodeIterator iterateBindings( const QString& variableName, bool distinct ) const;
+
+        /**
+         * \overload
+         *
+         * \param offset The index of the requested variable.
+         * \param distinct If \p true each node is only returned once.
+         *
+         * \since 2.10
+         */
+        NodeIterator iterateBindings( int offset, bool distinct ) const;
+
         /**
          * Convenience method that creates an iterator over statements constructed from the values of the 
          * provided bindings.
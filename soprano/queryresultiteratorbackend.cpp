@@ -21,24 +21,46 @@
 
 #include "queryresultiteratorbackend.h"
 #include "bindingset.h"
+#include "bindingschema.h"
 #include "node.h"
 
 #include <QStringList>
+#include <QVector>
+
+
+class Soprano::QueryResultIteratorBackend::Private
+{
+public:
+    Private()
+        : schemaInitialized( false ) {
+    }
+
+    // the names of a result set do not change, thus, we only create the schema once
+    BindingSchema schema;
+    bool schemaInitialized;
+};
+
 
 Soprano::QueryResultIteratorBackend::QueryResultIteratorBackend()
+    : d( new Private() )
 {
 }
 
 Soprano::QueryResultIteratorBackend::~QueryResultIteratorBackend()
 {
+    delete d;
 }
 
 Soprano::BindingSet Soprano::QueryResultIteratorBackend::current() const
 {
-    BindingSet bindings;
-    QStringList names = bindingNames();
-    for ( int i = 0; i < bindingCount(); ++i ) {
-        bindings.insert( names[i], binding( i ) );
+    if ( !d->schemaInitialized ) {
+        d->schema = BindingSchema( bindingNames() );
+        d->schemaInitialized = true;
+    }
+
+    QVector<Node> values( d->schema.count() );
+    for ( int i = 0; i < values.count(); ++i ) {
+        values[i] = binding( i );
     }
-    return bindings;
+    return BindingSet( d->schema, values );
 }
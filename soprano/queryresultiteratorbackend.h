@@ -58,7 +58,9 @@ namespace Soprano {
 
         /**
          * The default implementation constructs the
-         * BindingSet using binding() and bindingNames()
+         * BindingSet using binding() and bindingNames().
+         * The names are only requested once, all sets created
+         * by one backend share one BindingSchema.
          *
          * \sa QueryResultIterator::current
          */
@@ -111,6 +113,10 @@ namespace Soprano {
 
     protected:
         QueryResultIteratorBackend();
+
+    private:
+        class Private;
+        Private* const d;
     };
 }
 
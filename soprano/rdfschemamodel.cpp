@@ -22,14 +22,353 @@
 #include "rdfschemamodel.h"
 #include "model.h"
 #include "statementiterator.h"
+#include "iteratorbackend.h"
+#include "simplestatementiterator.h"
 #include "rdf.h"
 #include "rdfs.h"
 #include "statement.h"
 
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtCore/QVector>
+#include <QtCore/QBitArray>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+
+
+namespace {
+    /**
+     * The transitive closure of one hierarchy relation like rdfs:subClassOf.
+     * Each node gets a dense id and two bitsets with the ids of all its
+     * ancestors and descendants. Thus, checking a relation is a single bit
+     * test and listing the related nodes is linear in the number of nodes.
+     *
+     * All members are implicitly shared which makes copies cheap snapshots.
+     */
+    class Hierarchy
+    {
+    public:
+        int id( const Soprano::Node& node ) const {
+            return m_ids.value( node, -1 );
+        }
+
+        /**
+         * Add the edge \p sub -> \p super and update the closure. Cycles
+         * are handled naturally: the nodes in a cycle become ancestors of
+         * themselves.
+         */
+        void addEdge( const Soprano::Node& sub, const Soprano::Node& super ) {
+            const int subId = insert( sub );
+            const int superId = insert( super );
+
+            QBitArray up = m_ancestors[superId];
+            setBit( up, superId );
+            QBitArray down = m_descendants[subId];
+            setBit( down, subId );
+
+            for ( int i = 0; i < down.size(); ++i ) {
+                if ( down.testBit( i ) )
+                    m_ancestors[i] |= up;
+            }
+            for ( int i = 0; i < up.size(); ++i ) {
+                if ( up.testBit( i ) )
+                    m_descendants[i] |= down;
+            }
+        }
+
+        /**
+         * A node is only related to itself through a cycle or an explicit
+         * statement like A rdfs:subClassOf A, the closure is not reflexive.
+         */
+        bool contains( const Soprano::Node& sub, const Soprano::Node& super ) const {
+            const int subId = id( sub );
+            const int superId = id( super );
+            return subId >= 0 && superId >= 0 && testBit( m_ancestors[subId], superId );
+        }
+
+        QList<Soprano::Node> ancestors( const Soprano::Node& node ) const {
+            const int nodeId = id( node );
+            return nodeId >= 0 ? nodes( m_ancestors[nodeId] ) : QList<Soprano::Node>();
+        }
+
+        QList<Soprano::Node> descendants( const Soprano::Node& node ) const {
+            const int nodeId = id( node );
+            return nodeId >= 0 ? nodes( m_descendants[nodeId] ) : QList<Soprano::Node>();
+        }
+
+        /// \return all pairs (sub, super) of the closure as statements with \p predicate
+        QList<Soprano::Statement> allStatements( const Soprano::Node& predicate ) const {
+            QList<Soprano::Statement> statements;
+            for ( int i = 0; i < m_nodes.count(); ++i ) {
+                Q_FOREACH( const Soprano::Node& super, nodes( m_ancestors[i] ) ) {
+                    statements.append( Soprano::Statement( m_nodes[i], predicate, super ) );
+                }
+            }
+            return statements;
+        }
+
+        void clear() {
+            m_ids.clear();
+            m_nodes.clear();
+            m_ancestors.clear();
+            m_descendants.clear();
+        }
+
+    private:
+        int insert( const Soprano::Node& node ) {
+            QHash<Soprano::Node, int>::const_iterator it = m_ids.constFind( node );
+            if ( it != m_ids.constEnd() )
+                return it.value();
+
+            const int newId = m_nodes.count();
+            m_ids.insert( node, newId );
+            m_nodes.append( node );
+            m_ancestors.append( QBitArray() );
+            m_descendants.append( QBitArray() );
+            return newId;
+        }
+
+        /// the bitsets only grow when needed
+        static void setBit( QBitArray& bits, int i ) {
+            if ( bits.size() <= i )
+                bits.resize( i + 1 );
+            bits.setBit( i );
+        }
+
+        static bool testBit( const QBitArray& bits, int i ) {
+            return i < bits.size() && bits.testBit( i );
+        }
+
+        QList<Soprano::Node> nodes( const QBitArray& bits ) const {
+            QList<Soprano::Node> result;
+            for ( int i = 0; i < bits.size(); ++i ) {
+                if ( bits.testBit( i ) )
+                    result.append( m_nodes[i] );
+            }
+            return result;
+        }
+
+        QHash<Soprano::Node, int> m_ids;
+        QVector<Soprano::Node> m_nodes;
+        QVector<QBitArray> m_ancestors;
+        QVector<QBitArray> m_descendants;
+    };
+
+
+    /**
+     * Lists the rdf:type statements including the ones inferred through the class
+     * hierarchy while reading the direct type statements from the model.
+     *
+     * With a \p type only the instances of the type and its subclasses are read
+     * and each instance is reported once. Otherwise all type statements are read
+     * and completed with the superclasses of their types.
+     */
+    class InferredTypeIteratorBackend : public Soprano::IteratorBackend<Soprano::Statement>
+    {
+    public:
+        InferredTypeIteratorBackend( const Soprano::Model* model, const Hierarchy& classes, const Soprano::Node& type )
+            : m_model( model ),
+              m_classes( classes ),
+              m_type( type ) {
+            if ( m_type.isValid() ) {
+                m_typesToRead.append( m_type );
+                m_typesToRead += m_classes.descendants( m_type );
+            }
+            else {
+                m_typesToRead.append( Soprano::Node() );
+            }
+        }
+
+        bool next() {
+            Q_FOREVER {
+                if ( !m_pending.isEmpty() ) {
+                    m_current = m_pending.takeFirst();
+                    return true;
+                }
+
+                if ( !m_it.next() ) {
+                    if ( m_typesToRead.isEmpty() ) {
+                        close();
+                        return false;
+                    }
+                    m_it = m_model->listStatements( Soprano::Statement( Soprano::Node(), Soprano::Vocabulary::RDF::Nodes::type(), m_typesToRead.takeFirst() ) );
+                    if ( !m_it.isValid() ) {
+                        setError( m_model->lastError() );
+                        close();
+                        return false;
+                    }
+                    continue;
+                }
+
+                const Soprano::Statement s = *m_it;
+                if ( m_type.isValid() ) {
+                    if ( !m_seenSubjects.contains( s.subject() ) ) {
+                        m_seenSubjects.insert( s.subject() );
+                        m_pending.append( Soprano::Statement( s.subject(), s.predicate(), m_type ) );
+                    }
+                }
+                else {
+                    QList<Soprano::Node> types = m_classes.ancestors( s.object() );
+                    types.prepend( s.object() );
+                    Q_FOREACH( const Soprano::Node& type, types ) {
+                        const Soprano::Statement inferred( s.subject(), s.predicate(), type );
+                        if ( !m_seenStatements.contains( inferred ) ) {
+                            m_seenStatements.insert( inferred );
+                            m_pending.append( inferred );
+                        }
+                    }
+                }
+            }
+        }
+
+        Soprano::Statement current() const {
+            return m_current;
+        }
+
+        void close() {
+            m_it.close();
+            m_typesToRead.clear();
+            m_pending.clear();
+            m_seenSubjects.clear();
+            m_seenStatements.clear();
+        }
+
+    private:
+        const Soprano::Model* m_model;
+        Hierarchy m_classes;
+        Soprano::Node m_type;
+
+        QList<Soprano::Node> m_typesToRead;
+        Soprano::StatementIterator m_it;
+        QList<Soprano::Statement> m_pending;
+        QSet<Soprano::Node> m_seenSubjects;
+        QSet<Soprano::Statement> m_seenStatements;
+        Soprano::Statement m_current;
+    };
+}
+
 
 class Soprano::RdfSchemaModel::Private
 {
 public:
+    struct CachedHierarchy {
+        CachedHierarchy()
+            : valid( false ),
+              generation( 0 ) {
+        }
+
+        Hierarchy hierarchy;
+        bool valid;
+
+        /// increased with each change to detect changes during a rebuild
+        int generation;
+    };
+
+    CachedHierarchy& cache( const Node& predicate ) {
+        return predicate == Vocabulary::RDFS::Nodes::subClassOf() ? classes : properties;
+    }
+
+    /**
+     * \return A snapshot of the class or property hierarchy which is
+     * built in one pass over the parent model on first use. If reading
+     * the relations fails an empty hierarchy is returned and the error
+     * is set on the model.
+     */
+    Hierarchy hierarchy( const Node& predicate ) {
+        CachedHierarchy& c = cache( predicate );
+        int generation = 0;
+        {
+            QMutexLocker lock( &mutex );
+            if ( c.valid ) {
+                q->clearError();
+                return c.hierarchy;
+            }
+            generation = c.generation;
+        }
+
+        // do not block the change notifications which might be emitted with backend locks held
+        Hierarchy h;
+        StatementIterator it = q->parentModel()->listStatements( Statement( Node(), predicate, Node() ) );
+        while ( it.next() ) {
+            h.addEdge( it.current().subject(), it.current().object() );
+        }
+
+        // never cache a partial closure
+        const Error::Error error = it.isValid() ? it.lastError() : q->parentModel()->lastError();
+        if ( error ) {
+            q->setError( error );
+            return Hierarchy();
+        }
+        q->clearError();
+
+        QMutexLocker lock( &mutex );
+        if ( c.generation == generation ) {
+            c.hierarchy = h;
+            c.valid = true;
+        }
+        return h;
+    }
+
+    void updateHierarchy( const Statement& s, bool added ) {
+        const Node predicate = s.predicate();
+        if ( !predicate.isValid() ) {
+            // a removal by pattern might affect both hierarchies
+            invalidate();
+        }
+        else if ( predicate == Vocabulary::RDFS::Nodes::subClassOf() ||
+                  predicate == Vocabulary::RDFS::Nodes::subPropertyOf() ) {
+            QMutexLocker lock( &mutex );
+            CachedHierarchy& c = cache( predicate );
+            ++c.generation;
+            if ( c.valid ) {
+                if ( added && s.subject().isValid() && s.object().isValid() )
+                    c.hierarchy.addEdge( s.subject(), s.object() );
+                else
+                    // removing edges from a closure is not incremental, the hierarchy is rebuilt on next use
+                    c.valid = false;
+            }
+        }
+    }
+
+    void invalidate() {
+        QMutexLocker lock( &mutex );
+        classes.valid = false;
+        ++classes.generation;
+        properties.valid = false;
+        ++properties.generation;
+    }
+
+    StatementIterator closure( const Node& predicate, const Node& sub, const Node& super ) {
+        const Hierarchy h = hierarchy( predicate );
+        if ( q->lastError() )
+            return StatementIterator();
+
+        QList<Statement> statements;
+        if ( sub.isValid() && super.isValid() ) {
+            if ( h.contains( sub, super ) )
+                statements.append( Statement( sub, predicate, super ) );
+        }
+        else if ( sub.isValid() ) {
+            Q_FOREACH( const Node& node, h.ancestors( sub ) ) {
+                statements.append( Statement( sub, predicate, node ) );
+            }
+        }
+        else if ( super.isValid() ) {
+            Q_FOREACH( const Node& node, h.descendants( super ) ) {
+                statements.append( Statement( node, predicate, super ) );
+            }
+        }
+        else {
+            statements = h.allStatements( predicate );
+        }
+        return Util::SimpleStatementIterator( statements );
+    }
+
+    CachedHierarchy classes;
+    CachedHierarchy properties;
+    QMutex mutex;
+
+    RdfSchemaModel* q;
 };
 
 
@@ -37,6 +376,7 @@ Soprano::RdfSchemaModel::RdfSchemaModel( Model* model )
     : FilterModel( model ),
       d( new Private() )
 {
+    d->q = this;
 }
 
 
@@ -46,89 +386,140 @@ Soprano::RdfSchemaModel::~RdfSchemaModel()
 }
 
 
+void Soprano::RdfSchemaModel::setParentModel( Model* model )
+{
+    FilterModel::setParentModel( model );
+    d->invalidate();
+}
+
+
+void Soprano::RdfSchemaModel::parentStatementAdded( const Statement& statement )
+{
+    d->updateHierarchy( statement, true );
+    FilterModel::parentStatementAdded( statement );
+}
+
+
+void Soprano::RdfSchemaModel::parentStatementRemoved( const Statement& statement )
+{
+    d->updateHierarchy( statement, false );
+    FilterModel::parentStatementRemoved( statement );
+}
+
+
 Soprano::StatementIterator Soprano::RdfSchemaModel::classes() const
 {
-    return parentModel()->listStatements( Statement( Node(), Vocabulary::RDF::type(), Vocabulary::RDFS::Class() ) );
+    return parentModel()->listStatements( Statement( Node(), Vocabulary::RDF::Nodes::type(), Vocabulary::RDFS::Nodes::Class() ) );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::directSubClassOf( const Node& subClass, const Node& superClass ) const
 {
-    return parentModel()->listStatements( Statement( subClass, Vocabulary::RDFS::subClassOf(), superClass ) );
+    return parentModel()->listStatements( Statement( subClass, Vocabulary::RDFS::Nodes::subClassOf(), superClass ) );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::directSubPropertyOf( const Node& subProperty, const Node& superProperty ) const
 {
-    return parentModel()->listStatements( Statement( subProperty, Vocabulary::RDFS::subPropertyOf(), superProperty ) );
+    return parentModel()->listStatements( Statement( subProperty, Vocabulary::RDFS::Nodes::subPropertyOf(), superProperty ) );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::directType( const Node& someClass, const Node& someType ) const
 {
-    return parentModel()->listStatements( Statement( someClass, Vocabulary::RDF::type(), someType ) );
+    return parentModel()->listStatements( Statement( someClass, Vocabulary::RDF::Nodes::type(), someType ) );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::domain( const Node& prop, const Node& domain ) const
 {
-    return parentModel()->listStatements( Statement( prop, Vocabulary::RDFS::domain(), domain ) );
+    return parentModel()->listStatements( Statement( prop, Vocabulary::RDFS::Nodes::domain(), domain ) );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::properties() const
 {
-    return parentModel()->listStatements( Statement( Node(), Vocabulary::RDF::type(), Vocabulary::RDF::Property() ) );
+    return parentModel()->listStatements( Statement( Node(), Vocabulary::RDF::Nodes::type(), Vocabulary::RDF::Nodes::Property() ) );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::range( const Node& prop, const Node& range ) const
 {
-    return parentModel()->listStatements( Statement( prop, Vocabulary::RDFS::range(), range ) );
+    return parentModel()->listStatements( Statement( prop, Vocabulary::RDFS::Nodes::range(), range ) );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::subClassOf( const Node& subClass, const Node& superClass ) const
 {
-    // FIXME: do a recursive search for all subclasses. Problem: We cannot wrap multiple results in one iterator yet
-    return directSubClassOf( subClass, superClass );
+    return d->closure( Vocabulary::RDFS::Nodes::subClassOf(), subClass, superClass );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::subPropertyOf( const Node& subProperty, const Node& superProperty ) const
 {
-    // FIXME: do a recursive search for all subproperties. Problem: We cannot wrap multiple results in one iterator yet
-    return directSubPropertyOf( subProperty, superProperty );
+    return d->closure( Vocabulary::RDFS::Nodes::subPropertyOf(), subProperty, superProperty );
 }
 
 
 Soprano::StatementIterator Soprano::RdfSchemaModel::type( const Node& someClass, const Node& someType ) const
 {
-    // FIXME: do a recursive search for all subtypes. Problem: We cannot wrap multiple results in one iterator yet
-    return directType( someClass, someType );
+    if ( someClass.isValid() ) {
+        // the types of one resource: its direct types and all their superclasses
+        const Hierarchy classes = d->hierarchy( Vocabulary::RDFS::Nodes::subClassOf() );
+        if ( lastError() )
+            return StatementIterator();
+
+        QSet<Node> types;
+        StatementIterator it = directType( someClass, Node() );
+        while ( it.next() ) {
+            const Node directType = it.current().object();
+            types.insert( directType );
+            Q_FOREACH( const Node& superClass, classes.ancestors( directType ) ) {
+                types.insert( superClass );
+            }
+        }
+
+        QList<Statement> statements;
+        if ( someType.isValid() ) {
+            if ( types.contains( someType ) )
+                statements.append( Statement( someClass, Vocabulary::RDF::Nodes::type(), someType ) );
+        }
+        else {
+            Q_FOREACH( const Node& type, types ) {
+                statements.append( Statement( someClass, Vocabulary::RDF::Nodes::type(), type ) );
+            }
+        }
+        return Util::SimpleStatementIterator( statements );
+    }
+    else {
+        const Hierarchy classes = d->hierarchy( Vocabulary::RDFS::Nodes::subClassOf() );
+        if ( lastError() )
+            return StatementIterator();
+        return new InferredTypeIteratorBackend( parentModel(), classes, someType );
+    }
 }
 
 
 bool Soprano::RdfSchemaModel::isClass( const Node& resource ) const
 {
     return parentModel()->containsAnyStatement( Statement( resource,
-                                                      Vocabulary::RDF::type(),
-                                                      Vocabulary::RDFS::Class() ) );
+                                                      Vocabulary::RDF::Nodes::type(),
+                                                      Vocabulary::RDFS::Nodes::Class() ) );
 }
 
 
 bool Soprano::RdfSchemaModel::isProperty( const Node& resource ) const
 {
     return parentModel()->containsAnyStatement( Statement( resource,
-                                                      Vocabulary::RDF::type(),
-                                                      Vocabulary::RDF::Property() ) );
+                                                      Vocabulary::RDF::Nodes::type(),
+                                                      Vocabulary::RDF::Nodes::Property() ) );
 }
 
 
 bool Soprano::RdfSchemaModel::isDirectSubClassOf( const Node& subClass, const Node& superClass ) const
 {
     return parentModel()->containsAnyStatement( Statement( subClass,
-                                                      Vocabulary::RDFS::subClassOf(),
+                                                      Vocabulary::RDFS::Nodes::subClassOf(),
                                                       superClass ) );
 }
 
@@ -136,7 +527,7 @@ bool Soprano::RdfSchemaModel::isDirectSubClassOf( const Node& subClass, const No
 bool Soprano::RdfSchemaModel::isDirectSubPropertyOf( const Node& subProperty, const Node& superProperty ) const
 {
     return parentModel()->containsAnyStatement( Statement( subProperty,
-                                                      Vocabulary::RDFS::subPropertyOf(),
+                                                      Vocabulary::RDFS::Nodes::subPropertyOf(),
                                                       superProperty ) );
 }
 
@@ -144,24 +535,43 @@ bool Soprano::RdfSchemaModel::isDirectSubPropertyOf( const Node& subProperty, co
 bool Soprano::RdfSchemaModel::isDirectType( const Node& someClass, const Node& someType ) const
 {
     return parentModel()->containsAnyStatement( Statement( someClass,
-                                                      Vocabulary::RDF::type(),
+                                                      Vocabulary::RDF::Nodes::type(),
                                                     someType ) );
 }
 
 
 bool Soprano::RdfSchemaModel::isSubClassOf( const Node& subClass, const Node& superClass ) const
 {
-    return subClassOf( subClass, superClass ).next();
+    if ( !subClass.isValid() || !superClass.isValid() )
+        return subClassOf( subClass, superClass ).next();
+    return d->hierarchy( Vocabulary::RDFS::Nodes::subClassOf() ).contains( subClass, superClass );
 }
 
 
 bool Soprano::RdfSchemaModel::isSubPropertyOf( const Node& subProperty, const Node& superProperty ) const
 {
-    return subPropertyOf( subProperty, superProperty ).next();
+    if ( !subProperty.isValid() || !superProperty.isValid() )
+        return subPropertyOf( subProperty, superProperty ).next();
+    return d->hierarchy( Vocabulary::RDFS::Nodes::subPropertyOf() ).contains( subProperty, superProperty );
 }
 
 
 bool Soprano::RdfSchemaModel::isType( const Node& someClass, const Node& someType ) const
 {
-    return type( someClass, someType ).next();
+    if ( isDirectType( someClass, someType ) )
+        return true;
+    if ( !someClass.isValid() || !someType.isValid() )
+        return type( someClass, someType ).next();
+
+    const Hierarchy classes = d->hierarchy( Vocabulary::RDFS::Nodes::subClassOf() );
+    if ( lastError() )
+        return false;
+    StatementIterator it = directType( someClass, Node() );
+    while ( it.next() ) {
+        if ( classes.contains( it.current().object(), someType ) ) {
+            it.close();
+            return true;
+        }
+    }
+    return false;
 }
@@ -38,8 +38,11 @@ namespace Soprano {
      *
      * Interface based on Sesame's RdfSchemaSource. (Copyright (C) 2002-2006 Aduna BV, GNU LGPL License applies.)
      *
-     * \warning Backward inferencing has not been implemented yet. Thus, methods like subClassOf() return the same
-     * as directSubClassOf().
+     * The recursive methods like subClassOf() and isSubClassOf() are answered from an in-memory
+     * transitive closure of the rdfs:subClassOf and rdfs:subPropertyOf hierarchies. The closure is
+     * built in one pass over the parent model on first use. Added relations are merged into it
+     * immediately while removed ones trigger a rebuild on next use. Both are tracked through
+     * the statement signals of the parent model.
      *
      * \author Sebastian Trueg <trueg@kde.org>
      */
@@ -146,8 +149,11 @@ namespace Soprano {
          * Note that the subClassOf relation is reflexive: a class is implicitly
          * always a subclass of itself.
          *
+         * The implicit reflexive relations are not part of the result. Inferred
+         * relations do not have a context.
+         *
          * Do not use this method if the Soprano backend supports inferencing.
-         * Use directSubClassOf instead which is much faster.
+         * Use directSubClassOf instead.
          *
          * \param subClass The subclass of the relations that should be returned,
          * or an empty node if relations with any subclass should be returned.
@@ -165,8 +171,11 @@ namespace Soprano {
          * Note that the subPropertyOf relation is reflexive: a property is implicitly
          * always a subproperty of itself.
          *
+         * The implicit reflexive relations are not part of the result. Inferred
+         * relations do not have a context.
+         *
          * Do not use this method if the Soprano backend supports inferencing.
-         * Use directSubPropertyOf instead which is much faster.
+         * Use directSubPropertyOf instead.
          *
          * \param subProperty The subproperty of the relations that should be returned,
          * or an empty node if relations with any subproperty should be returned.
@@ -182,6 +191,9 @@ namespace Soprano {
         /**
          * Gets all type relations with a specific instance and/or class.
          *
+         * If \p someClass is empty the direct type statements are read from the
+         * parent model while iterating. Inferred relations do not have a context.
+         *
          * Do not use this method if the Soprano backend supports inferencing.
          * Use directType instead which is much faster.
          *
@@ -283,6 +295,20 @@ namespace Soprano {
          */
         bool isType( const Node& someClass, const Node& someType ) const;
 
+        /**
+         * Reimplemented to rebuild the hierarchies from the new model.
+         *
+         * \since 2.10
+         */
+        virtual void setParentModel( Model* model );
+
+    protected:
+        /**
+         * Keeps the class and property hierarchies up to date.
+         */
+        virtual void parentStatementAdded( const Statement& statement );
+        virtual void parentStatementRemoved( const Statement& statement );
+
     private:
         class Private;
         Private* const d;
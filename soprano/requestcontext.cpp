@@ -0,0 +1,196 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "requestcontext.h"
+
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QList>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QThreadStorage>
+
+
+class Soprano::RequestContext::Private : public QSharedData
+{
+public:
+    Private()
+        : timeout( 0 ),
+          cancelled( false ) {
+    }
+
+    QElapsedTimer timer;
+    int timeout;
+
+    mutable QMutex mutex;
+    bool cancelled;
+    QList<CancelHandler*> handlers;
+};
+
+
+namespace {
+    class CurrentContext
+    {
+    public:
+        Soprano::RequestContext context;
+    };
+
+    QThreadStorage<CurrentContext*> s_currentContext;
+}
+
+
+Soprano::RequestContext::CancelHandler::~CancelHandler()
+{
+}
+
+
+Soprano::RequestContext::RequestContext()
+{
+}
+
+
+Soprano::RequestContext::RequestContext( const RequestContext& other )
+    : d( other.d )
+{
+}
+
+
+Soprano::RequestContext::~RequestContext()
+{
+}
+
+
+Soprano::RequestContext& Soprano::RequestContext::operator=( const RequestContext& other )
+{
+    d = other.d;
+    return *this;
+}
+
+
+Soprano::RequestContext Soprano::RequestContext::create( int timeout )
+{
+    RequestContext context;
+    context.d = new Private();
+    if ( timeout > 0 ) {
+        context.d->timeout = timeout;
+        context.d->timer.start();
+    }
+    return context;
+}
+
+
+Soprano::RequestContext Soprano::RequestContext::current()
+{
+    if ( s_currentContext.hasLocalData() )
+        return s_currentContext.localData()->context;
+    else
+        return RequestContext();
+}
+
+
+bool Soprano::RequestContext::isValid() const
+{
+    return d.constData() != 0;
+}
+
+
+bool Soprano::RequestContext::isCancelled() const
+{
+    if ( !d )
+        return false;
+
+    QMutexLocker lock( &d->mutex );
+    return d->cancelled || hasExpired();
+}
+
+
+bool Soprano::RequestContext::hasExpired() const
+{
+    return remainingTime() == 0;
+}
+
+
+int Soprano::RequestContext::remainingTime() const
+{
+    if ( !d || d->timeout <= 0 )
+        return -1;
+    else
+        return int( qMax( qint64( 0 ), d->timeout - d->timer.elapsed() ) );
+}
+
+
+Soprano::Error::Error Soprano::RequestContext::cancelError() const
+{
+    if ( hasExpired() )
+        return Error::Error( QLatin1String( "Request deadline exceeded" ), Error::ErrorTimeout );
+    else
+        return Error::Error( QLatin1String( "Request cancelled" ), Error::ErrorTimeout );
+}
+
+
+void Soprano::RequestContext::cancel()
+{
+    if ( d ) {
+        QMutexLocker lock( &d->mutex );
+        if ( !d->cancelled ) {
+            d->cancelled = true;
+            Q_FOREACH( CancelHandler* handler, d->handlers ) {
+                handler->cancel();
+            }
+        }
+    }
+}
+
+
+void Soprano::RequestContext::addCancelHandler( CancelHandler* handler )
+{
+    if ( d ) {
+        QMutexLocker lock( &d->mutex );
+        d->handlers.append( handler );
+        if ( d->cancelled ) {
+            handler->cancel();
+        }
+    }
+}
+
+
+void Soprano::RequestContext::removeCancelHandler( CancelHandler* handler )
+{
+    if ( d ) {
+        QMutexLocker lock( &d->mutex );
+        d->handlers.removeAll( handler );
+    }
+}
+
+
+Soprano::RequestScope::RequestScope( const RequestContext& context )
+{
+    if ( !s_currentContext.hasLocalData() )
+        s_currentContext.setLocalData( new CurrentContext() );
+    m_previous = s_currentContext.localData()->context;
+    s_currentContext.localData()->context = context;
+}
+
+
+Soprano::RequestScope::~RequestScope()
+{
+    s_currentContext.localData()->context = m_previous;
+}
@@ -0,0 +1,146 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef _SOPRANO_REQUEST_CONTEXT_H_
+#define _SOPRANO_REQUEST_CONTEXT_H_
+
+#include "soprano_export.h"
+#include "error.h"
+
+#include <QtCore/QSharedDataPointer>
+
+namespace Soprano {
+    /**
+     * \class RequestContext requestcontext.h
+     *
+     * \brief A deadline and a cancellation flag for a single request.
+     *
+     * The context active in the current thread is installed via RequestScope and can be
+     * retrieved by backends through current(). Backends which are able to abort long running
+     * operations (like a query in a database server) should check isCancelled() or register
+     * a CancelHandler while blocking.
+     *
+     * RequestContext is implicitly shared and thread-safe. All copies refer to the same
+     * request, thus, a request can be cancelled from another thread via a copy.
+     *
+     * This is not part of the public API.
+     */
+    class SOPRANO_EXPORT RequestContext
+    {
+    public:
+        /**
+         * Is called when the request is cancelled. The handler is called from
+         * the thread calling cancel(), not the thread executing the request.
+         */
+        class SOPRANO_EXPORT CancelHandler
+        {
+        public:
+            virtual ~CancelHandler();
+            virtual void cancel() = 0;
+        };
+
+        /**
+         * Create an invalid context which is never cancelled.
+         */
+        RequestContext();
+        RequestContext( const RequestContext& other );
+        ~RequestContext();
+
+        RequestContext& operator=( const RequestContext& other );
+
+        /**
+         * Create a new request context.
+         *
+         * \param timeout The deadline in milliseconds relative to now. A value of 0
+         * means no deadline.
+         */
+        static RequestContext create( int timeout = 0 );
+
+        /**
+         * \return The context installed for the current thread or an invalid
+         * context if there is none.
+         */
+        static RequestContext current();
+
+        bool isValid() const;
+
+        /**
+         * \return \p true if cancel() has been called or the deadline has passed.
+         */
+        bool isCancelled() const;
+
+        /**
+         * \return \p true if the deadline has passed.
+         */
+        bool hasExpired() const;
+
+        /**
+         * \return The time left until the deadline in milliseconds, 0 if it already
+         * passed, or -1 if there is no deadline.
+         */
+        int remainingTime() const;
+
+        /**
+         * \return An Error::ErrorTimeout error describing why the request has been
+         * aborted, to be reported by backends once they notice isCancelled().
+         */
+        Error::Error cancelError() const;
+
+        /**
+         * Cancel the request and call all registered cancel handlers.
+         */
+        void cancel();
+
+        /**
+         * Register a handler which is called on cancel(). If the request already
+         * has been cancelled the handler is called immediately.
+         */
+        void addCancelHandler( CancelHandler* handler );
+        void removeCancelHandler( CancelHandler* handler );
+
+    private:
+        class Private;
+        QExplicitlySharedDataPointer<Private> d;
+    };
+
+
+    /**
+     * \class RequestScope requestcontext.h
+     *
+     * \brief Installs a RequestContext as the current one for the lifetime of the scope.
+     *
+     * The previous context is restored on destruction.
+     */
+    class SOPRANO_EXPORT RequestScope
+    {
+    public:
+        explicit RequestScope( const RequestContext& context );
+        ~RequestScope();
+
+    private:
+        RequestContext m_previous;
+
+        Q_DISABLE_COPY( RequestScope )
+    };
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include "global.h"
 //#include "query.h"
 #include "queryresultiterator.h"
+#include "preparedquery.h"
 #include "node.h"
 #include "nodeiterator.h"
 #include "literalvalue.h"
@@ -40,6 +41,7 @@
 #include "error.h"
 #include "locator.h"
 #include "bindingset.h"
+#include "bindingschema.h"
 #include "version.h"
 #include "sopranotypes.h"
 #include "vocabulary.h"
@@ -24,15 +24,43 @@
 #include "node.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QAtomicInt>
+
+
+namespace {
+    // relaxed access to the cached hash, see qHash( const Node& )
+    inline uint loadHash( const QAtomicInt& hash ) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+        return uint( int( hash ) );
+#else
+        return uint( hash.load() );
+#endif
+    }
+
+    inline void storeHash( QAtomicInt& hash, uint value ) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+        hash = int( value );
+#else
+        hash.store( int( value ) );
+#endif
+    }
+}
 
 
 class Soprano::Statement::Private : public QSharedData
 {
 public:
+    Private()
+        : hash( 0 ) {
+    }
+
     Node subject;
     Node predicate;
     Node object;
     Node context;
+
+    // the cached result of qHash(), 0 if not calculated yet
+    mutable QAtomicInt hash;
 };
 
 Soprano::Statement::Statement()
@@ -92,6 +120,7 @@ void Soprano::Statement::setSubject( const Node &subject )
 {
     // d->detach() is called automatically
     d->subject = subject;
+    storeHash( d->hash, 0 );
 }
 
 Soprano::Node Soprano::Statement::subject() const
@@ -103,6 +132,7 @@ void Soprano::Statement::setPredicate( const Node &predicate )
 {
     // d->detach() is called automatically
     d->predicate = predicate;
+    storeHash( d->hash, 0 );
 }
 
 Soprano::Node Soprano::Statement::predicate() const
@@ -114,6 +144,7 @@ void Soprano::Statement::setObject( const Node &object )
 {
     // d->detach() is called automatically
     d->object = object;
+    storeHash( d->hash, 0 );
 }
 
 Soprano::Node Soprano::Statement::object() const
@@ -125,6 +156,7 @@ void Soprano::Statement::setContext( const Node &context )
 {
     // d->detach() is called automatically
     d->context = context;
+    storeHash( d->hash, 0 );
 }
 
 Soprano::Node Soprano::Statement::context() const
@@ -160,5 +192,10 @@ QTextStream& operator<<( QTextStream& s, const Soprano::Statement& sm )
 }
 
 uint Soprano::qHash( const Soprano::Statement& s ) {
-    return qHash( s.subject() ) ^ qHash( s.predicate() ) ^ qHash( s.object() ) ^ qHash( s.context() );
+    uint hash = loadHash( s.d->hash );
+    if ( !hash ) {
+        hash = qHash( s.d->subject ) ^ qHash( s.d->predicate ) ^ qHash( s.d->object ) ^ qHash( s.d->context );
+        storeHash( s.d->hash, hash );
     }
+    return hash;
+}
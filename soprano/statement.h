@@ -27,6 +27,9 @@
 
 namespace Soprano
 {
+    class Statement;
+    SOPRANO_EXPORT uint qHash( const Statement& s );
+
     /**
      * \class Statement statement.h Soprano/Statement
      *
@@ -162,6 +165,8 @@ namespace Soprano
     private:
         class Private;
         QSharedDataPointer<Private> d;
+
+        friend uint qHash( const Statement& s );
     };
 
     /**
@@ -25,6 +25,7 @@
 #include "node.h"
 #include "iteratorbackend.h"
 #include "nodeiterator.h"
+#include "util/distinctnodeiteratorbackend.h"
 
 
 Soprano::StatementIterator::StatementIterator()
@@ -102,20 +103,55 @@ private:
 
 Soprano::NodeIterator Soprano::StatementIterator::iterateSubjects() const
 {
-    return new StatementNodeIteratorBackend( *this, StatementNodeIteratorBackend::SUBJECT );
+    return iterateColumn( StatementNodeIteratorBackend::SUBJECT, false );
 }
 
 Soprano::NodeIterator Soprano::StatementIterator::iteratePredicates() const
 {
-    return new StatementNodeIteratorBackend( *this, StatementNodeIteratorBackend::PREDICATE );
+    return iterateColumn( StatementNodeIteratorBackend::PREDICATE, false );
 }
 
 Soprano::NodeIterator Soprano::StatementIterator::iterateObjects() const
 {
-    return new StatementNodeIteratorBackend( *this, StatementNodeIteratorBackend::OBJECT );
+    return iterateColumn( StatementNodeIteratorBackend::OBJECT, false );
 }
 
 Soprano::NodeIterator Soprano::StatementIterator::iterateContexts() const
 {
-    return new StatementNodeIteratorBackend( *this, StatementNodeIteratorBackend::CONTEXT );
+    return iterateColumn( StatementNodeIteratorBackend::CONTEXT, false );
+}
+
+Soprano::NodeIterator Soprano::StatementIterator::iterateSubjects( bool distinct ) const
+{
+    return iterateColumn( StatementNodeIteratorBackend::SUBJECT, distinct );
+}
+
+Soprano::NodeIterator Soprano::StatementIterator::iteratePredicates( bool distinct ) const
+{
+    return iterateColumn( StatementNodeIteratorBackend::PREDICATE, distinct );
+}
+
+Soprano::NodeIterator Soprano::StatementIterator::iterateObjects( bool distinct ) const
+{
+    return iterateColumn( StatementNodeIteratorBackend::OBJECT, distinct );
+}
+
+Soprano::NodeIterator Soprano::StatementIterator::iterateContexts( bool distinct ) const
+{
+    return iterateColumn( StatementNodeIteratorBackend::CONTEXT, distinct );
+}
+
+Soprano::NodeIterator Soprano::StatementIterator::iterateColumn( int column, bool distinct ) const
+{
+    // let the backend transfer only the requested column
+    if ( IteratorBackend<Statement>* b = backend() ) {
+        if ( IteratorBackend<Node>* projected = b->projectColumn( column, QString(), distinct ) )
+            return projected;
+    }
+
+    NodeIterator nodes = new StatementNodeIteratorBackend( *this, StatementNodeIteratorBackend::Which( column ) );
+    if ( distinct )
+        return new Util::DistinctNodeIteratorBackend( nodes );
+    else
+        return nodes;
 }
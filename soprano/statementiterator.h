@@ -146,6 +146,49 @@ namespace Soprano {
          * \return A wrapper iterator over the context nodes.
          */
         NodeIterator iterateContexts() const;
+
+        /**
+         * Convenience method that creates an iterator over the subject nodes of the statements
+         * in this iterator, optionally without duplicates.
+         *
+         * Backends which transfer the statements, like the ones of the %Soprano client, only
+         * transfer the subjects and remove the duplicates on their side. In that case this
+         * iterator is consumed by the new one and should not be used anymore.
+         *
+         * \param distinct If \p true each subject is only returned once.
+         *
+         * \return An iterator over the subject nodes.
+         *
+         * \since 2.10
+         */
+        NodeIterator iterateSubjects( bool distinct ) const;
+
+        /**
+         * Convenience method that creates an iterator over the predicate nodes of the statements
+         * in this iterator, optionally without duplicates. See iterateSubjects( bool ) for details.
+         *
+         * \since 2.10
+         */
+        NodeIterator iteratePredicates( bool distinct ) const;
+
+        /**
+         * Convenience method that creates an iterator over the object nodes of the statements
+         * in this iterator, optionally without duplicates. See iterateSubjects( bool ) for details.
+         *
+         * \since 2.10
+         */
+        NodeIterator iterateObjects( bool distinct ) const;
+
+        /**
+         * Convenience method that creates an iterator over the context nodes of the statements
+         * in this iterator, optionally without duplicates. See iterateSubjects( bool ) for details.
+         *
+         * \since 2.10
+         */
+        NodeIterator iterateContexts( bool distinct ) const;
+
+    private:
+        NodeIterator iterateColumn( int column, bool distinct ) const;
     };
 }
 
@@ -30,14 +30,50 @@
 #include "node.h"
 #include "nodeiterator.h"
 #include "queryresultiterator.h"
+#include "preparedquery.h"
+#include "preparedquerybackend.h"
+#include "bindingset.h"
 
 #include <QtCore/QTimer>
 #include <QtCore/QThreadPool>
+#include <QtCore/QPointer>
 
 
 Q_DECLARE_METATYPE( Soprano::Statement )
 
 
+namespace {
+    class AsyncPreparedQueryBackend : public Soprano::PreparedQueryBackend
+    {
+    public:
+        AsyncPreparedQueryBackend( const Soprano::PreparedQuery& query, Soprano::Util::AsyncModel* model, Soprano::Util::AsyncModelPrivate* d )
+            : m_query( query ),
+              m_model( model ),
+              m_d( d ) {
+        }
+
+        QStringList parameterNames() const {
+            return m_query.parameterNames();
+        }
+
+        Soprano::QueryResultIterator executeQuery( const Soprano::BindingSet& bindings ) {
+            if ( !m_model ) {
+                setError( "The model of the prepared query has been deleted." );
+                return Soprano::QueryResultIterator();
+            }
+            Soprano::QueryResultIterator it = m_query.executeQuery( bindings );
+            setError( m_query.lastError() );
+            return new Soprano::Util::SyncQueryResultIteratorBackend( m_d, it );
+        }
+
+    private:
+        Soprano::PreparedQuery m_query;
+        QPointer<Soprano::Util::AsyncModel> m_model;
+        Soprano::Util::AsyncModelPrivate* m_d;
+    };
+}
+
+
 Soprano::Util::AsyncModelPrivate::AsyncModelPrivate( AsyncModel* parent )
     : mode( AsyncModel::SingleThreaded ),
       m_model( parent )
@@ -285,16 +321,38 @@ Soprano::StatementIterator Soprano::Util::AsyncModel::listStatements( const Stat
 }
 
 
+Soprano::StatementIterator Soprano::Util::AsyncModel::listStatements( const Statement& partial, int offset, int limit ) const
+{
+    return new SyncIteratorBackend<Statement>( d, FilterModel::listStatements( partial, offset, limit ) );
+}
+
+
 Soprano::NodeIterator Soprano::Util::AsyncModel::listContexts() const
 {
     return new SyncIteratorBackend<Node>( d, FilterModel::listContexts() );
 }
 
 
+Soprano::NodeIterator Soprano::Util::AsyncModel::listContexts( int offset, int limit ) const
+{
+    return new SyncIteratorBackend<Node>( d, FilterModel::listContexts( offset, limit ) );
+}
+
+
 Soprano::QueryResultIterator Soprano::Util::AsyncModel::executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
 {
     return new SyncQueryResultIteratorBackend( d, FilterModel::executeQuery( query, language, userQueryLanguage ) );
 }
 
+
+Soprano::PreparedQuery Soprano::Util::AsyncModel::prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    PreparedQuery pq = FilterModel::prepareQuery( query, language, userQueryLanguage );
+    if ( pq.isValid() )
+        return new AsyncPreparedQueryBackend( pq, const_cast<AsyncModel*>( this ), d );
+    else
+        return pq;
+}
+
 #include "moc_asyncmodel.cpp"
 
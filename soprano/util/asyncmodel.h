@@ -338,6 +338,16 @@ namespace Soprano {
              */
             StatementIterator listStatements( const Statement& partial ) const;
 
+            /**
+             * \reimplemented
+             *
+             * The call is directly delivered to the parent model. However, the iterator is counted so that interweaving
+             * asyncroneous and non-asyncroneous calls does not result in unwanted behaviour.
+             *
+             * \since 2.10
+             */
+            StatementIterator listStatements( const Statement& partial, int offset, int limit ) const;
+
             /**
              * \reimplemented
              *
@@ -348,6 +358,16 @@ namespace Soprano {
              */
             NodeIterator listContexts() const;
 
+            /**
+             * \reimplemented
+             *
+             * The call is directly delivered to the parent model. However, the iterator is counted so that interweaving
+             * asyncroneous and non-asyncroneous calls does not result in unwanted behaviour.
+             *
+             * \since 2.10
+             */
+            NodeIterator listContexts( int offset, int limit ) const;
+
             /**
              * \reimplemented
              *
@@ -358,6 +378,16 @@ namespace Soprano {
              */
             QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
 
+            /**
+             * \reimplemented
+             *
+             * The query is prepared by the parent model. The iterators returned by the
+             * prepared query are counted like the ones returned by executeQuery().
+             *
+             * \since 2.10
+             */
+            PreparedQuery prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+
             using FilterModel::addStatement;
             using FilterModel::removeStatement;
             using FilterModel::removeAllStatements;
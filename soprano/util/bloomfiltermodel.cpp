@@ -0,0 +1,576 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "bloomfiltermodel.h"
+#include "statementiterator.h"
+#include "statement.h"
+#include "node.h"
+
+#include <QtCore/QVector>
+#include <QtCore/QMutex>
+#include <QtCore/QReadWriteLock>
+
+#include <math.h>
+
+
+namespace {
+    enum KeyType {
+        StatementKey,
+        TripleKey,
+        PairKey
+    };
+
+    /// the finalizer of MurmurHash3 to spread the bits of the node hashes
+    inline quint64 mix( quint64 h ) {
+        h ^= h >> 33;
+        h *= Q_UINT64_C( 0xff51afd7ed558ccd );
+        h ^= h >> 33;
+        h *= Q_UINT64_C( 0xc4ceb9fe1a85ec53 );
+        h ^= h >> 33;
+        return h;
+    }
+
+    quint64 keyHash( KeyType type, const Soprano::Statement& s ) {
+        quint64 h = mix( quint64( type ) + 1 );
+        h = mix( h ^ Soprano::qHash( s.subject() ) );
+        h = mix( h ^ Soprano::qHash( s.predicate() ) );
+        if ( type != PairKey )
+            h = mix( h ^ Soprano::qHash( s.object() ) );
+        if ( type == StatementKey )
+            h = mix( h ^ Soprano::qHash( s.context() ) );
+        return h;
+    }
+
+    /// counters which reach the maximum stay there to never produce false negatives
+    const quint8 s_maxCounterValue = 255;
+
+    const double s_ln2 = 0.69314718055994530942;
+}
+
+
+class Soprano::Util::BloomFilterModel::Private
+{
+public:
+    Private()
+        : expectedCount( 100000 ),
+          falsePositiveRate( 0.01 ),
+          maximumMemory( 16*1024*1024 ),
+          valid( false ),
+          failed( false ),
+          hashCount( 0 ),
+          capacity( 0 ),
+          count( 0 ) {
+    }
+
+    int expectedCount;
+    double falsePositiveRate;
+    int maximumMemory;
+
+    /// false if the filter needs to be rebuilt before it can be used
+    bool valid;
+
+    /// true if the last rebuild failed, lookups are forwarded until the next rebuild()
+    bool failed;
+
+    QVector<quint8> counters;
+    int hashCount;
+
+    /// the number of statements the counters have been sized for
+    int capacity;
+
+    /// the number of statements in the filter
+    int count;
+
+    /// protects all of the above
+    mutable QReadWriteLock filterLock;
+
+    /// serializes the write methods and rebuild() to keep the counters exact
+    QMutex writeMutex;
+
+    /// Calculates the number of counters and hash functions for \p statements
+    static void filterSize( int statements, double rate, int memory, int* counterCount, int* hashes );
+
+    // the following methods require the filterLock
+    bool mayContain( quint64 hash ) const;
+    void remove( quint64 hash );
+    void removeStatementKeys( const Statement& s );
+
+    static void insert( quint64 hash, QVector<quint8>& target, int hashes );
+    static void addStatementKeys( const Statement& s, QVector<quint8>& target, int hashes );
+
+    /// Builds the filter from the statements of \p parent, requires the writeMutex
+    Error::Error rebuild( Model* parent );
+
+    /// \return true if the filter is usable, builds it if necessary
+    bool ensureFilter( Model* parent );
+
+    void invalidate() {
+        QWriteLocker lock( &filterLock );
+        valid = false;
+        failed = false;
+    }
+
+    /// \return true if the filter is valid and might contain \p hash
+    bool filterMayContain( quint64 hash ) const {
+        QReadLocker lock( &filterLock );
+        return valid && mayContain( hash );
+    }
+
+    /// \return true if the filter is valid and does not contain \p hash
+    bool filterExcludes( quint64 hash ) const {
+        QReadLocker lock( &filterLock );
+        return valid && !mayContain( hash );
+    }
+
+    void statementAdded( const Statement& s ) {
+        QWriteLocker lock( &filterLock );
+        if ( valid ) {
+            addStatementKeys( s, counters, hashCount );
+            ++count;
+            // grow the filter on the next lookup if it is overfull
+            if ( count > 2*capacity ) {
+                int counterCount = 0;
+                filterSize( count, falsePositiveRate, maximumMemory, &counterCount, 0 );
+                if ( counterCount > counters.size() )
+                    valid = false;
+            }
+        }
+    }
+
+    void statementRemoved( const Statement& s ) {
+        QWriteLocker lock( &filterLock );
+        if ( valid ) {
+            removeStatementKeys( s );
+            --count;
+        }
+    }
+};
+
+
+void Soprano::Util::BloomFilterModel::Private::filterSize( int statements, double rate, int memory, int* counterCount, int* hashes )
+{
+    // three keys per statement
+    const double entries = 3.0 * qMax( 1, statements );
+    rate = qBound( 0.000001, rate, 0.5 );
+
+    double size = -entries * log( rate ) / ( s_ln2 * s_ln2 );
+    size = qBound( 64.0, size, double( qMax( 64, memory ) ) );
+
+    *counterCount = int( size );
+    if ( hashes )
+        *hashes = qBound( 1, int( size / entries * s_ln2 + 0.5 ), 16 );
+}
+
+
+bool Soprano::Util::BloomFilterModel::Private::mayContain( quint64 hash ) const
+{
+    const uint size = counters.size();
+    const uint h1 = uint( hash );
+    const uint h2 = uint( hash >> 32 ) | 1;
+    for ( int i = 0; i < hashCount; ++i ) {
+        if ( counters[( h1 + i*h2 ) % size] == 0 )
+            return false;
+    }
+    return true;
+}
+
+
+void Soprano::Util::BloomFilterModel::Private::insert( quint64 hash, QVector<quint8>& target, int hashes )
+{
+    const uint size = target.size();
+    const uint h1 = uint( hash );
+    const uint h2 = uint( hash >> 32 ) | 1;
+    quint8* data = target.data();
+    for ( int i = 0; i < hashes; ++i ) {
+        quint8& counter = data[( h1 + i*h2 ) % size];
+        if ( counter < s_maxCounterValue )
+            ++counter;
+    }
+}
+
+
+void Soprano::Util::BloomFilterModel::Private::remove( quint64 hash )
+{
+    const uint size = counters.size();
+    const uint h1 = uint( hash );
+    const uint h2 = uint( hash >> 32 ) | 1;
+    quint8* data = counters.data();
+    for ( int i = 0; i < hashCount; ++i ) {
+        quint8& counter = data[( h1 + i*h2 ) % size];
+        if ( counter > 0 && counter < s_maxCounterValue )
+            --counter;
+    }
+}
+
+
+void Soprano::Util::BloomFilterModel::Private::addStatementKeys( const Statement& s, QVector<quint8>& target, int hashes )
+{
+    insert( keyHash( StatementKey, s ), target, hashes );
+    insert( keyHash( TripleKey, s ), target, hashes );
+    insert( keyHash( PairKey, s ), target, hashes );
+}
+
+
+void Soprano::Util::BloomFilterModel::Private::removeStatementKeys( const Statement& s )
+{
+    remove( keyHash( StatementKey, s ) );
+    remove( keyHash( TripleKey, s ) );
+    remove( keyHash( PairKey, s ) );
+}
+
+
+Soprano::Error::Error Soprano::Util::BloomFilterModel::Private::rebuild( Model* parent )
+{
+    int statements = 0;
+    double rate = 0.0;
+    int memory = 0;
+    {
+        QReadLocker lock( &filterLock );
+        statements = qMax( expectedCount, count );
+        rate = falsePositiveRate;
+        memory = maximumMemory;
+    }
+
+    Error::Error error;
+    if ( !parent ) {
+        error = Error::Error( QLatin1String( "No parent model." ), Error::ErrorInvalidArgument );
+    }
+
+    // the write mutex keeps the other methods from changing the counters,
+    // thus, the new filter is built without blocking lookups
+    while ( !error ) {
+        int counterCount = 0;
+        int hashes = 0;
+        filterSize( statements, rate, memory, &counterCount, &hashes );
+
+        QVector<quint8> newCounters( counterCount, 0 );
+        int newCount = 0;
+
+        StatementIterator it = parent->listStatements();
+        if ( !it.isValid() ) {
+            error = parent->lastError();
+            break;
+        }
+        while ( it.next() ) {
+            addStatementKeys( *it, newCounters, hashes );
+            ++newCount;
+        }
+        if ( it.lastError() ) {
+            error = it.lastError();
+            break;
+        }
+
+        // many more statements than expected: build it again with a proper size
+        if ( newCount > 2*statements ) {
+            int neededCounters = 0;
+            filterSize( newCount, rate, memory, &neededCounters, 0 );
+            if ( neededCounters > counterCount ) {
+                statements = newCount;
+                continue;
+            }
+        }
+
+        QWriteLocker lock( &filterLock );
+        counters = newCounters;
+        hashCount = hashes;
+        capacity = statements;
+        count = newCount;
+        valid = true;
+        failed = false;
+        return Error::Error();
+    }
+
+    QWriteLocker lock( &filterLock );
+    counters.clear();
+    count = 0;
+    valid = false;
+    failed = true;
+    return error;
+}
+
+
+bool Soprano::Util::BloomFilterModel::Private::ensureFilter( Model* parent )
+{
+    {
+        QReadLocker lock( &filterLock );
+        if ( valid || failed )
+            return valid;
+    }
+
+    // do not wait for a running write or rebuild, the lookup is simply
+    // forwarded meanwhile. This also prevents a deadlock if the lookup
+    // is done from a slot connected to the parent model.
+    if ( !writeMutex.tryLock() )
+        return false;
+
+    {
+        QReadLocker lock( &filterLock );
+        if ( valid || failed ) {
+            writeMutex.unlock();
+            return valid;
+        }
+    }
+
+    rebuild( parent );
+    writeMutex.unlock();
+
+    QReadLocker lock( &filterLock );
+    return valid;
+}
+
+
+
+Soprano::Util::BloomFilterModel::BloomFilterModel( Model* parent )
+    : FilterModel( parent ),
+      d( new Private() )
+{
+}
+
+
+Soprano::Util::BloomFilterModel::~BloomFilterModel()
+{
+    delete d;
+}
+
+
+void Soprano::Util::BloomFilterModel::setParentModel( Model* model )
+{
+    QMutexLocker lock( &d->writeMutex );
+    FilterModel::setParentModel( model );
+    d->invalidate();
+}
+
+
+void Soprano::Util::BloomFilterModel::setExpectedStatementCount( int count )
+{
+    QWriteLocker lock( &d->filterLock );
+    d->expectedCount = qMax( 1, count );
+    d->failed = false;
+    d->valid = false;
+}
+
+
+int Soprano::Util::BloomFilterModel::expectedStatementCount() const
+{
+    QReadLocker lock( &d->filterLock );
+    return d->expectedCount;
+}
+
+
+void Soprano::Util::BloomFilterModel::setFalsePositiveRate( double rate )
+{
+    QWriteLocker lock( &d->filterLock );
+    d->falsePositiveRate = rate;
+    d->failed = false;
+    d->valid = false;
+}
+
+
+double Soprano::Util::BloomFilterModel::falsePositiveRate() const
+{
+    QReadLocker lock( &d->filterLock );
+    return d->falsePositiveRate;
+}
+
+
+void Soprano::Util::BloomFilterModel::setMaximumMemory( int bytes )
+{
+    QWriteLocker lock( &d->filterLock );
+    d->maximumMemory = bytes;
+    d->failed = false;
+    d->valid = false;
+}
+
+
+int Soprano::Util::BloomFilterModel::maximumMemory() const
+{
+    QReadLocker lock( &d->filterLock );
+    return d->maximumMemory;
+}
+
+
+void Soprano::Util::BloomFilterModel::rebuild()
+{
+    QMutexLocker lock( &d->writeMutex );
+    Error::Error error = d->rebuild( parentModel() );
+    if ( error )
+        setError( error );
+    else
+        clearError();
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::BloomFilterModel::addStatement( const Statement& statement )
+{
+    QMutexLocker lock( &d->writeMutex );
+
+    // avoid counting a statement twice
+    bool known = false;
+    if ( statement.isValid() && d->filterMayContain( keyHash( StatementKey, statement ) ) )
+        known = FilterModel::containsStatement( statement );
+
+    Error::ErrorCode c = FilterModel::addStatement( statement );
+    if ( c == Error::ErrorNone && !known )
+        d->statementAdded( statement );
+    return c;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::BloomFilterModel::removeStatement( const Statement& statement )
+{
+    QMutexLocker lock( &d->writeMutex );
+
+    // only statements which exist may be removed from the filter
+    bool known = false;
+    if ( statement.isValid() && d->filterMayContain( keyHash( StatementKey, statement ) ) )
+        known = FilterModel::containsStatement( statement );
+
+    Error::ErrorCode c = FilterModel::removeStatement( statement );
+    if ( c == Error::ErrorNone && known )
+        d->statementRemoved( statement );
+    return c;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::BloomFilterModel::removeAllStatements( const Statement& statement )
+{
+    QMutexLocker lock( &d->writeMutex );
+
+    bool valid = false;
+    {
+        QReadLocker filterLock( &d->filterLock );
+        valid = d->valid;
+    }
+    if ( !valid ) {
+        return FilterModel::removeAllStatements( statement );
+    }
+
+    QList<Statement> removed;
+    if ( parentModel() ) {
+        StatementIterator it = parentModel()->listStatements( statement );
+        if ( it.isValid() )
+            removed = it.allStatements();
+        if ( !it.isValid() || it.lastError() ) {
+            // we cannot tell which statements are removed
+            d->invalidate();
+            return FilterModel::removeAllStatements( statement );
+        }
+    }
+
+    Error::ErrorCode c = FilterModel::removeAllStatements( statement );
+    if ( c == Error::ErrorNone ) {
+        Q_FOREACH( const Statement& s, removed ) {
+            d->statementRemoved( s );
+        }
+    }
+    else {
+        d->invalidate();
+    }
+    return c;
+}
+
+
+QList<Soprano::Statement> Soprano::Util::BloomFilterModel::takeAllStatements( const Statement& statement )
+{
+    QMutexLocker lock( &d->writeMutex );
+
+    // the parent reports the removed statements, no need to list them first
+    QList<Statement> removed = FilterModel::takeAllStatements( statement );
+    if ( lastError() ) {
+        d->invalidate();
+    }
+    else {
+        Q_FOREACH( const Statement& s, removed ) {
+            d->statementRemoved( s );
+        }
+    }
+    return removed;
+}
+
+
+bool Soprano::Util::BloomFilterModel::containsStatement( const Statement& statement ) const
+{
+    if ( statement.isValid() &&
+         d->ensureFilter( parentModel() ) &&
+         d->filterExcludes( keyHash( StatementKey, statement ) ) ) {
+        clearError();
+        return false;
+    }
+    return FilterModel::containsStatement( statement );
+}
+
+
+QBitArray Soprano::Util::BloomFilterModel::containsStatements( const QList<Statement>& statements ) const
+{
+    if ( !d->ensureFilter( parentModel() ) )
+        return FilterModel::containsStatements( statements );
+
+    // only the statements the filter cannot exclude are sent to the parent model
+    QList<Statement> candidates;
+    QList<int> candidatePositions;
+    for ( int i = 0; i < statements.count(); ++i ) {
+        const Statement& s = statements[i];
+        if ( !s.isValid() || !d->filterExcludes( keyHash( StatementKey, s ) ) ) {
+            candidates.append( s );
+            candidatePositions.append( i );
+        }
+    }
+
+    QBitArray result( statements.count() );
+    if ( !candidates.isEmpty() ) {
+        const QBitArray found = FilterModel::containsStatements( candidates );
+        if ( lastError() )
+            return QBitArray();
+        for ( int i = 0; i < found.size(); ++i ) {
+            if ( found.testBit( i ) )
+                result.setBit( candidatePositions[i] );
+        }
+    }
+    else {
+        clearError();
+    }
+    return result;
+}
+
+
+bool Soprano::Util::BloomFilterModel::containsAnyStatement( const Statement& statement ) const
+{
+    const bool spo = statement.subject().isValid() && statement.predicate().isValid() && statement.object().isValid();
+    const bool sp = statement.subject().isValid() && statement.predicate().isValid() &&
+                    !statement.object().isValid() && !statement.context().isValid();
+
+    if ( ( spo || sp ) &&
+         d->ensureFilter( parentModel() ) ) {
+        quint64 hash = 0;
+        if ( sp )
+            hash = keyHash( PairKey, statement );
+        else if ( statement.context().isValid() )
+            hash = keyHash( StatementKey, statement );
+        else
+            hash = keyHash( TripleKey, statement );
+
+        if ( d->filterExcludes( hash ) ) {
+            clearError();
+            return false;
+        }
+    }
+    return FilterModel::containsAnyStatement( statement );
+}
@@ -0,0 +1,156 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_BLOOMFILTER_MODEL_H_
+#define _SOPRANO_BLOOMFILTER_MODEL_H_
+
+#include "filtermodel.h"
+#include "soprano_export.h"
+
+namespace Soprano {
+    namespace Util {
+        /**
+         * \class BloomFilterModel bloomfiltermodel.h Soprano/Util/BloomFilterModel
+         *
+         * \brief Answers negative containsStatement() lookups without querying the parent model.
+         *
+         * The BloomFilterModel keeps a counting Bloom filter over the statements of
+         * its parent model. Three keys are stored per statement: the full statement,
+         * the statement without context, and the subject and predicate pair. A lookup
+         * which the filter rules out is answered locally. All other lookups are
+         * forwarded to the parent model. This is useful when the parent model is
+         * expensive to query, for example a remote model, and most lookups are misses,
+         * as in the typical "check before add" pattern of data import. Used as the
+         * parent of an Index::IndexFilterModel it also speeds up the duplicate check
+         * the index does for each added statement.
+         *
+         * The following lookups can be answered by the filter:
+         * \li containsStatement() with any valid statement.
+         * \li containsAnyStatement() with subject, predicate, and object set, and an
+         * optional context.
+         * \li containsAnyStatement() with only subject and predicate set.
+         *
+         * The filter is built from Model::listStatements() on the first lookup and
+         * updated incrementally by the write methods of this model.
+         *
+         * \warning The filter only knows about changes made through this model.
+         * Adding statements directly to the parent model makes lookups miss them
+         * until rebuild() is called.
+         *
+         * \since 2.10
+         */
+        class SOPRANO_EXPORT BloomFilterModel : public FilterModel
+        {
+            Q_OBJECT
+
+        public:
+            /**
+             * Create a new BloomFilterModel.
+             *
+             * \param parent The parent Model to forward
+             *        the actual calls to.
+             */
+            BloomFilterModel( Model* parent = 0 );
+
+            /**
+             * Destructor.
+             */
+            ~BloomFilterModel();
+
+            /**
+             * Reimplemented to rebuild the filter for the new parent model.
+             */
+            void setParentModel( Model* model );
+
+            /**
+             * Set the number of statements the filter should be sized for. The filter
+             * grows automatically once the model holds twice as many statements, as
+             * long as the memory limit allows it.
+             *
+             * Changing the value rebuilds the filter on the next lookup.
+             *
+             * \param count The expected number of statements. The default is 100000.
+             */
+            void setExpectedStatementCount( int count );
+
+            /**
+             * \return The expected number of statements set via setExpectedStatementCount().
+             */
+            int expectedStatementCount() const;
+
+            /**
+             * Set the targeted rate of false positives, i.e. the fraction of lookups for
+             * statements which do not exist that are still forwarded to the parent model.
+             * A smaller rate requires more memory.
+             *
+             * Changing the value rebuilds the filter on the next lookup.
+             *
+             * \param rate The false positive rate between 0 and 1. The default is 0.01.
+             */
+            void setFalsePositiveRate( double rate );
+
+            /**
+             * \return The false positive rate set via setFalsePositiveRate().
+             */
+            double falsePositiveRate() const;
+
+            /**
+             * Limit the memory used by the filter. If the size calculated from
+             * expectedStatementCount() and falsePositiveRate() exceeds the limit,
+             * the filter is made smaller and the actual false positive rate increases.
+             *
+             * \param bytes The maximum size of the filter in bytes. The default is 16 MB.
+             */
+            void setMaximumMemory( int bytes );
+
+            /**
+             * \return The memory limit set via setMaximumMemory().
+             */
+            int maximumMemory() const;
+
+            /**
+             * Rebuild the filter from the statements of the parent model. This is
+             * only necessary after the parent model has been changed directly.
+             */
+            void rebuild();
+
+            Error::ErrorCode addStatement( const Statement& statement );
+            Error::ErrorCode removeStatement( const Statement& statement );
+            Error::ErrorCode removeAllStatements( const Statement& statement );
+            QList<Statement> takeAllStatements( const Statement& statement );
+            bool containsStatement( const Statement& statement ) const;
+            bool containsAnyStatement( const Statement& statement ) const;
+            QBitArray containsStatements( const QList<Statement>& statements ) const;
+
+            using FilterModel::addStatement;
+            using FilterModel::removeStatement;
+            using FilterModel::removeAllStatements;
+            using FilterModel::containsStatement;
+            using FilterModel::containsAnyStatement;
+
+        private:
+            class Private;
+            Private* const d;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_DISTINCT_NODE_ITERATOR_BACKEND_H_
+#define _SOPRANO_DISTINCT_NODE_ITERATOR_BACKEND_H_
+
+#include "iteratorbackend.h"
+#include "nodeiterator.h"
+#include "node.h"
+
+#include <QtCore/QSet>
+
+
+namespace Soprano {
+    namespace Util {
+        /**
+         * Skips the nodes of another iterator which have been returned before.
+         * Used by the projections of StatementIterator and QueryResultIterator
+         * if the backend cannot remove the duplicates itself.
+         */
+        class DistinctNodeIteratorBackend : public IteratorBackend<Node>
+        {
+        public:
+            DistinctNodeIteratorBackend( const NodeIterator& it )
+                : m_it( it ) {
+            }
+
+            ~DistinctNodeIteratorBackend() {
+                close();
+            }
+
+            bool next() {
+                while ( m_it.next() ) {
+                    const Node node = m_it.current();
+                    if ( !m_seen.contains( node ) ) {
+                        m_seen.insert( node );
+                        m_current = node;
+                        return true;
+                    }
+                }
+                m_seen.clear();
+                return false;
+            }
+
+            Node current() const {
+                return m_current;
+            }
+
+            void close() {
+                m_it.close();
+                m_seen.clear();
+            }
+
+            Error::Error lastError() const {
+                return m_it.lastError();
+            }
+
+        private:
+            NodeIterator m_it;
+            QSet<Node> m_seen;
+            Node m_current;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,810 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_MODEL_FANOUT_H_
+#define _SOPRANO_MODEL_FANOUT_H_
+
+#include "error.h"
+#include "model.h"
+#include "node.h"
+#include "statement.h"
+#include "statementiterator.h"
+#include "nodeiterator.h"
+#include "iteratorbackend.h"
+
+#include <QtCore/QRunnable>
+#include <QtCore/QThreadPool>
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+#include <QtCore/QQueue>
+#include <QtCore/QList>
+#include <QtCore/QVector>
+#include <QtCore/QSet>
+#include <QtCore/QHash>
+#include <QtCore/QTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QWeakPointer>
+
+
+namespace Soprano {
+    namespace Util {
+        /**
+         * The result of one FanOutCall.
+         */
+        struct FanOutResult {
+            FanOutResult()
+                : finished( false ),
+                  boolValue( false ),
+                  intValue( 0 ) {
+            }
+
+            bool finished;
+            bool boolValue;
+            int intValue;
+            QList<Node> nodes;
+            QHash<Node, int> counts;
+            Error::Error error;
+        };
+
+        /**
+         * Collects the results of a group of FanOutCalls which are sent to
+         * several models in parallel. Calls which have not finished when the
+         * caller stops waiting simply report into the group later, thus, a
+         * slow model does not block the caller.
+         */
+        class FanOutCallGroup
+        {
+        public:
+            FanOutCallGroup( int count )
+                : m_results( count ),
+                  m_pending( count ) {
+            }
+
+            void finish( int index, const FanOutResult& result ) {
+                QMutexLocker lock( &m_mutex );
+                m_results[index] = result;
+                m_results[index].finished = true;
+                --m_pending;
+                m_changed.wakeAll();
+            }
+
+            /**
+             * Waits until all calls finished.
+             *
+             * \param timeout The maximum time to wait in milliseconds, 0 to wait forever.
+             * \param stopOnTrue Stop waiting as soon as one call reports a \p true boolValue.
+             *
+             * \return The results. Calls which did not finish in time are not marked finished.
+             */
+            QVector<FanOutResult> wait( int timeout = 0, bool stopOnTrue = false ) {
+                QTime time;
+                time.start();
+                QMutexLocker lock( &m_mutex );
+                while ( m_pending > 0 && !( stopOnTrue && hasTrueResult() ) ) {
+                    if ( timeout > 0 ) {
+                        const int remaining = timeout - time.elapsed();
+                        if ( remaining <= 0 )
+                            break;
+                        m_changed.wait( &m_mutex, remaining );
+                    }
+                    else {
+                        m_changed.wait( &m_mutex );
+                    }
+                }
+                return m_results;
+            }
+
+        private:
+            bool hasTrueResult() const {
+                for ( int i = 0; i < m_results.count(); ++i ) {
+                    if ( m_results[i].finished && m_results[i].boolValue )
+                        return true;
+                }
+                return false;
+            }
+
+            QMutex m_mutex;
+            QWaitCondition m_changed;
+            QVector<FanOutResult> m_results;
+            int m_pending;
+        };
+
+        typedef QSharedPointer<FanOutCallGroup> FanOutCallGroupPointer;
+
+        /**
+         * One call to one model of a group.
+         */
+        class FanOutCall : public QRunnable
+        {
+        public:
+            FanOutCall( const FanOutCallGroupPointer& group, int index, Model* model )
+                : m_group( group ),
+                  m_index( index ),
+                  m_model( model ) {
+            }
+
+            void run() {
+                FanOutResult result;
+                execute( m_model, result );
+                // the error cache of the model is per thread
+                if ( !result.error )
+                    result.error = m_model->lastError();
+                m_group->finish( m_index, result );
+            }
+
+            /**
+             * Starts \p calls in \p pool. Calls for which no thread is available
+             * are executed in the current thread.
+             */
+            static void start( QThreadPool* pool, const QList<FanOutCall*>& calls ) {
+                Q_FOREACH( FanOutCall* call, calls ) {
+                    if ( !pool->tryStart( call ) ) {
+                        call->run();
+                        delete call;
+                    }
+                }
+            }
+
+        protected:
+            virtual void execute( Model* model, FanOutResult& result ) = 0;
+
+        private:
+            FanOutCallGroupPointer m_group;
+            int m_index;
+            Model* m_model;
+        };
+
+        /// \return The first error in \p results
+        inline Error::Error firstError( const QVector<FanOutResult>& results ) {
+            for ( int i = 0; i < results.count(); ++i ) {
+                if ( results[i].error )
+                    return results[i].error;
+            }
+            return Error::Error();
+        }
+
+        class StatementCountCall : public FanOutCall
+        {
+        public:
+            StatementCountCall( const FanOutCallGroupPointer& group, int index, Model* model )
+                : FanOutCall( group, index, model ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                result.intValue = model->statementCount();
+            }
+        };
+
+        class EstimateCountCall : public FanOutCall
+        {
+        public:
+            EstimateCountCall( const FanOutCallGroupPointer& group, int index, Model* model, const Statement& pattern )
+                : FanOutCall( group, index, model ),
+                  m_pattern( pattern ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                result.intValue = model->estimateCount( m_pattern );
+            }
+
+        private:
+            Statement m_pattern;
+        };
+
+        class PredicateStatisticsCall : public FanOutCall
+        {
+        public:
+            PredicateStatisticsCall( const FanOutCallGroupPointer& group, int index, Model* model )
+                : FanOutCall( group, index, model ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                result.counts = model->predicateStatistics();
+            }
+        };
+
+        class ContextStatisticsCall : public FanOutCall
+        {
+        public:
+            ContextStatisticsCall( const FanOutCallGroupPointer& group, int index, Model* model )
+                : FanOutCall( group, index, model ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                result.counts = model->contextStatistics();
+            }
+        };
+
+        /// \return The sum of the counts in \p results
+        inline QHash<Node, int> mergeCounts( const QVector<FanOutResult>& results ) {
+            QHash<Node, int> counts;
+            for ( int i = 0; i < results.count(); ++i ) {
+                for ( QHash<Node, int>::const_iterator it = results[i].counts.constBegin();
+                      it != results[i].counts.constEnd(); ++it ) {
+                    counts[it.key()] += it.value();
+                }
+            }
+            return counts;
+        }
+
+        class IsEmptyCall : public FanOutCall
+        {
+        public:
+            IsEmptyCall( const FanOutCallGroupPointer& group, int index, Model* model )
+                : FanOutCall( group, index, model ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                result.boolValue = model->isEmpty();
+            }
+        };
+
+        class ContainsAnyStatementCall : public FanOutCall
+        {
+        public:
+            ContainsAnyStatementCall( const FanOutCallGroupPointer& group, int index, Model* model, const Statement& pattern )
+                : FanOutCall( group, index, model ),
+                  m_pattern( pattern ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                result.boolValue = model->containsAnyStatement( m_pattern );
+            }
+
+        private:
+            Statement m_pattern;
+        };
+
+        class ContainsStatementCall : public FanOutCall
+        {
+        public:
+            ContainsStatementCall( const FanOutCallGroupPointer& group, int index, Model* model, const Statement& statement )
+                : FanOutCall( group, index, model ),
+                  m_statement( statement ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                result.boolValue = model->containsStatement( m_statement );
+            }
+
+        private:
+            Statement m_statement;
+        };
+
+        class ListContextsCall : public FanOutCall
+        {
+        public:
+            ListContextsCall( const FanOutCallGroupPointer& group, int index, Model* model )
+                : FanOutCall( group, index, model ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& result ) {
+                NodeIterator it = model->listContexts();
+                if ( it.isValid() ) {
+                    result.nodes = it.allNodes();
+                    result.error = it.lastError();
+                }
+            }
+        };
+
+        class RemoveAllStatementsCall : public FanOutCall
+        {
+        public:
+            RemoveAllStatementsCall( const FanOutCallGroupPointer& group, int index, Model* model, const Statement& pattern )
+                : FanOutCall( group, index, model ),
+                  m_pattern( pattern ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& ) {
+                model->removeAllStatements( m_pattern );
+            }
+
+        private:
+            Statement m_pattern;
+        };
+
+        class AddStatementsCall : public FanOutCall
+        {
+        public:
+            AddStatementsCall( const FanOutCallGroupPointer& group, int index, Model* model, const QList<Statement>& statements )
+                : FanOutCall( group, index, model ),
+                  m_statements( statements ) {
+            }
+
+        protected:
+            void execute( Model* model, FanOutResult& ) {
+                model->addStatements( m_statements );
+            }
+
+        private:
+            QList<Statement> m_statements;
+        };
+
+
+        /**
+         * A source of items for a ParallelScan, for example the statements
+         * of one model. All methods are called from the same thread.
+         */
+        template<class T> class ScanSource
+        {
+        public:
+            virtual ~ScanSource() {}
+
+            virtual bool open() = 0;
+            virtual bool next() = 0;
+            virtual T current() const = 0;
+            virtual Error::Error lastError() const = 0;
+            virtual void close() = 0;
+        };
+
+        /**
+         * Lists the statements of a model.
+         */
+        class StatementScanSource : public ScanSource<Statement>
+        {
+        public:
+            StatementScanSource( Model* model, const Statement& partial )
+                : m_model( model ),
+                  m_partial( partial ) {
+            }
+
+            bool open() {
+                m_it = m_model->listStatements( m_partial );
+                m_error = m_model->lastError();
+                return m_it.isValid();
+            }
+
+            bool next() {
+                if ( m_it.next() )
+                    return true;
+                m_error = m_it.lastError();
+                return false;
+            }
+
+            Statement current() const {
+                return m_it.current();
+            }
+
+            Error::Error lastError() const {
+                return m_error;
+            }
+
+            void close() {
+                m_it.close();
+            }
+
+        private:
+            Model* m_model;
+            Statement m_partial;
+            StatementIterator m_it;
+            Error::Error m_error;
+        };
+
+
+        /**
+         * The part of ParallelScan which does not depend on the item type.
+         */
+        class ParallelScanBase
+        {
+        public:
+            virtual ~ParallelScanBase() {}
+            virtual void cancel() = 0;
+        };
+
+        /**
+         * Keeps track of the open scans of a model to cancel them when
+         * the model is deleted.
+         */
+        class ParallelScanRegistry
+        {
+        public:
+            void add( const QSharedPointer<ParallelScanBase>& scan ) {
+                QMutexLocker lock( &m_mutex );
+                for ( int i = m_scans.count() - 1; i >= 0; --i ) {
+                    if ( m_scans[i].isNull() )
+                        m_scans.removeAt( i );
+                }
+                m_scans.append( scan.toWeakRef() );
+            }
+
+            void cancelAll() {
+                QMutexLocker lock( &m_mutex );
+                Q_FOREACH( const QWeakPointer<ParallelScanBase>& scan, m_scans ) {
+                    if ( QSharedPointer<ParallelScanBase> s = scan.toStrongRef() )
+                        s->cancel();
+                }
+                m_scans.clear();
+            }
+
+        private:
+            QMutex m_mutex;
+            QList<QWeakPointer<ParallelScanBase> > m_scans;
+        };
+
+
+        /**
+         * Reads several ScanSources in parallel and hands over their items in
+         * batches in the order in which they arrive.
+         *
+         * Each source is read in a thread of the pool. Sources for which no
+         * thread is available are read by the consumer while it waits for the
+         * others. This prevents nested scans from starving each other.
+         *
+         * With a timeout, a source which does not deliver its next batch in time
+         * is abandoned. Its thread stops at the next batch and the scan continues
+         * with the other sources. It ends with an Error::ErrorTimeout. The timeout
+         * only runs while a source is working, not while it waits for the consumer
+         * to take its batches. Sources read by the consumer are abandoned once a
+         * single call takes longer than the timeout.
+         */
+        template<class T> class ParallelScan : public ParallelScanBase
+        {
+        public:
+            /**
+             * \param sources The sources to read, the scan takes ownership.
+             * \param timeout The time in milliseconds a source may take for one batch
+             * before it is abandoned, 0 for no timeout.
+             */
+            ParallelScan( const QList<ScanSource<T>*>& sources, int timeout = 0 )
+                : m_sources( sources ),
+                  m_states( sources.count(), Pending ),
+                  m_progress( sources.count() ),
+                  m_waitingForSpace( sources.count(), false ),
+                  m_running( 0 ),
+                  m_cancelled( false ),
+                  m_timeout( timeout ),
+                  m_batchPos( 0 ),
+                  m_localSource( 0 ),
+                  m_closed( false ) {
+            }
+
+            ~ParallelScan() {
+                qDeleteAll( m_sources );
+            }
+
+            /**
+             * Starts reading the sources of \p scan in \p pool.
+             */
+            static void start( const QSharedPointer<ParallelScan<T> >& scan, QThreadPool* pool ) {
+                for ( int i = 0; i < scan->m_sources.count(); ++i ) {
+                    {
+                        QMutexLocker lock( &scan->m_mutex );
+                        scan->m_states[i] = Running;
+                        scan->m_progress[i].start();
+                        ++scan->m_running;
+                    }
+                    Producer* producer = new Producer( scan, i );
+                    if ( !pool->tryStart( producer ) ) {
+                        delete producer;
+                        QMutexLocker lock( &scan->m_mutex );
+                        scan->m_states[i] = Local;
+                        --scan->m_running;
+                        scan->m_localSources.append( i );
+                    }
+                }
+            }
+
+            /**
+             * Fetches the next item. Only to be called from one thread.
+             */
+            bool next( T& item ) {
+                while ( !m_closed ) {
+                    if ( m_batchPos < m_batch.count() ) {
+                        item = m_batch[m_batchPos++];
+                        return true;
+                    }
+
+                    QMutexLocker lock( &m_mutex );
+                    if ( m_cancelled )
+                        return false;
+
+                    if ( !m_batches.isEmpty() ) {
+                        m_batch = m_batches.dequeue();
+                        m_batchPos = 0;
+                        m_spaceAvailable.wakeAll();
+                        continue;
+                    }
+
+                    if ( m_localSource || !m_localSources.isEmpty() ) {
+                        lock.unlock();
+                        if ( nextLocal( item ) )
+                            return true;
+                        continue;
+                    }
+
+                    if ( m_running == 0 )
+                        return false;
+
+                    if ( m_timeout > 0 ) {
+                        // each source has the timeout for its next batch
+                        qint64 wait = m_timeout;
+                        bool abandoned = false;
+                        for ( int i = 0; i < m_states.count(); ++i ) {
+                            if ( m_states[i] != Running || m_waitingForSpace[i] )
+                                continue;
+                            const qint64 remaining = m_timeout - m_progress[i].elapsed();
+                            if ( remaining <= 0 ) {
+                                abandonSource( i );
+                                abandoned = true;
+                            }
+                            else {
+                                wait = qMin( wait, remaining );
+                            }
+                        }
+                        if ( !abandoned )
+                            m_batchAvailable.wait( &m_mutex, ulong( wait ) );
+                    }
+                    else {
+                        m_batchAvailable.wait( &m_mutex );
+                    }
+                }
+                return false;
+            }
+
+            /**
+             * The first error reported by one of the sources.
+             */
+            Error::Error lastError() const {
+                QMutexLocker lock( &m_mutex );
+                return m_error;
+            }
+
+            /**
+             * Stops the scan and waits for the sources which have not been
+             * abandoned to be closed.
+             */
+            void close() {
+                if ( m_closed )
+                    return;
+                m_closed = true;
+                cancel();
+
+                QMutexLocker lock( &m_mutex );
+                while ( m_running > 0 ) {
+                    m_batchAvailable.wait( &m_mutex );
+                }
+                lock.unlock();
+
+                if ( m_localSource ) {
+                    m_localSource->close();
+                    m_localSource = 0;
+                }
+                m_localSources.clear();
+                m_batch.clear();
+            }
+
+            void cancel() {
+                QMutexLocker lock( &m_mutex );
+                m_cancelled = true;
+                m_batches.clear();
+                m_batchAvailable.wakeAll();
+                m_spaceAvailable.wakeAll();
+            }
+
+        private:
+            enum SourceState {
+                Pending,
+                Running,
+                Local,
+                Finished,
+                Abandoned
+            };
+
+            class Producer : public QRunnable
+            {
+            public:
+                Producer( const QSharedPointer<ParallelScan<T> >& scan, int index )
+                    : m_scan( scan ),
+                      m_index( index ) {
+                }
+
+                void run() {
+                    m_scan->produce( m_index );
+                }
+
+            private:
+                QSharedPointer<ParallelScan<T> > m_scan;
+                int m_index;
+            };
+
+            /// the number of items a producer hands over at once
+            static int batchSize() { return 256; }
+
+            /// the number of batches a producer may read ahead
+            static int maxQueuedBatches() { return 8; }
+
+            void produce( int index ) {
+                ScanSource<T>* source = m_sources[index];
+                if ( source->open() ) {
+                    QList<T> batch;
+                    bool more = true;
+                    while ( more ) {
+                        more = source->next();
+                        if ( more )
+                            batch.append( source->current() );
+                        if ( batch.count() >= batchSize() || ( !more && !batch.isEmpty() ) ) {
+                            if ( !enqueue( index, batch ) )
+                                break;
+                            batch.clear();
+                        }
+                    }
+                }
+                source->close();
+
+                QMutexLocker lock( &m_mutex );
+                if ( m_states[index] == Running ) {
+                    m_states[index] = Finished;
+                    --m_running;
+                    if ( source->lastError() && !m_error )
+                        m_error = source->lastError();
+                }
+                m_batchAvailable.wakeAll();
+            }
+
+            bool enqueue( int index, const QList<T>& batch ) {
+                QMutexLocker lock( &m_mutex );
+                // the time spent waiting for the consumer does not count towards the timeout
+                while ( !m_cancelled && m_states[index] == Running && m_batches.count() >= maxQueuedBatches() ) {
+                    m_waitingForSpace[index] = true;
+                    m_spaceAvailable.wait( &m_mutex );
+                    m_waitingForSpace[index] = false;
+                }
+                if ( m_cancelled || m_states[index] != Running )
+                    return false;
+                m_batches.enqueue( batch );
+                m_progress[index].start();
+                m_batchAvailable.wakeAll();
+                return true;
+            }
+
+            bool nextLocal( T& item ) {
+                // we cannot interrupt the source, but we stop reading it once a call took too long
+                QElapsedTimer time;
+                time.start();
+
+                if ( !m_localSource ) {
+                    m_localSource = m_sources[m_localSources.takeFirst()];
+                    if ( !m_localSource->open() ) {
+                        finishLocal( false );
+                        return false;
+                    }
+                }
+
+                const bool more = m_localSource->next();
+                if ( more )
+                    item = m_localSource->current();
+
+                if ( m_timeout > 0 && time.elapsed() > m_timeout )
+                    finishLocal( true );
+                else if ( !more )
+                    finishLocal( false );
+                return more;
+            }
+
+            void finishLocal( bool timedOut ) {
+                m_localSource->close();
+                QMutexLocker lock( &m_mutex );
+                if ( !m_error ) {
+                    if ( timedOut )
+                        m_error = timeoutError();
+                    else if ( m_localSource->lastError() )
+                        m_error = m_localSource->lastError();
+                }
+                m_localSource = 0;
+            }
+
+            /// requires the mutex
+            void abandonSource( int index ) {
+                m_states[index] = Abandoned;
+                --m_running;
+                if ( !m_error )
+                    m_error = timeoutError();
+                m_spaceAvailable.wakeAll();
+            }
+
+            static Error::Error timeoutError() {
+                return Error::Error( QLatin1String( "Timeout while waiting for the results of a model." ), Error::ErrorTimeout );
+            }
+
+            QList<ScanSource<T>*> m_sources;
+
+            // the following members are protected by the mutex
+            mutable QMutex m_mutex;
+            QWaitCondition m_batchAvailable;
+            QWaitCondition m_spaceAvailable;
+            QQueue<QList<T> > m_batches;
+            QVector<SourceState> m_states;
+            /// restarted whenever a source delivers a batch
+            QVector<QElapsedTimer> m_progress;
+            QVector<bool> m_waitingForSpace;
+            int m_running;
+            bool m_cancelled;
+            Error::Error m_error;
+
+            const int m_timeout;
+
+            // the following members are only used by the consumer
+            QList<T> m_batch;
+            int m_batchPos;
+            QList<int> m_localSources;
+            ScanSource<T>* m_localSource;
+            bool m_closed;
+        };
+
+
+        /**
+         * Iterates the statements of a ParallelScan, optionally without
+         * duplicates.
+         */
+        class ParallelStatementIteratorBackend : public IteratorBackend<Statement>
+        {
+        public:
+            ParallelStatementIteratorBackend( const QSharedPointer<ParallelScan<Statement> >& scan, bool distinct = false )
+                : m_scan( scan ),
+                  m_distinct( distinct ) {
+            }
+
+            ~ParallelStatementIteratorBackend() {
+                close();
+            }
+
+            bool next() {
+                while ( m_scan->next( m_current ) ) {
+                    if ( !m_distinct || !m_seen.contains( m_current ) ) {
+                        if ( m_distinct )
+                            m_seen.insert( m_current );
+                        return true;
+                    }
+                }
+                setError( m_scan->lastError() );
+                close();
+                return false;
+            }
+
+            Statement current() const {
+                return m_current;
+            }
+
+            void close() {
+                m_scan->close();
+                m_seen.clear();
+            }
+
+        private:
+            QSharedPointer<ParallelScan<Statement> > m_scan;
+            bool m_distinct;
+            QSet<Statement> m_seen;
+            Statement m_current;
+        };
+    }
+}
+
+#endif
@@ -22,6 +22,7 @@
 #include "mutexmodel.h"
 #include "mutexiteratorbase.h"
 #include "extreadwritelock.h"
+#include "scalablereadwritelock.h"
 #include "mutexstatementiteratorbackend.h"
 #include "mutexnodeiteratorbackend.h"
 #include "mutexqueryresultiteratorbackend.h"
@@ -29,8 +30,48 @@
 #include "statementiterator.h"
 #include "nodeiterator.h"
 #include "queryresultiterator.h"
+#include "preparedquery.h"
+#include "preparedquerybackend.h"
+#include "bindingset.h"
 
 #include <QtCore/QMutex>
+#include <QtCore/QPointer>
+
+
+namespace Soprano {
+    namespace Util {
+        /**
+         * Executes the prepared query of the parent model under the read lock
+         * of the MutexModel.
+         */
+        class MutexPreparedQueryBackend : public PreparedQueryBackend
+        {
+        public:
+            MutexPreparedQueryBackend( const PreparedQuery& query, MutexModel* model )
+                : m_query( query ),
+                  m_model( model ) {
+            }
+
+            QStringList parameterNames() const {
+                return m_query.parameterNames();
+            }
+
+            QueryResultIterator executeQuery( const BindingSet& bindings ) {
+                if ( !m_model ) {
+                    setError( "The model of the prepared query has been deleted." );
+                    return QueryResultIterator();
+                }
+                QueryResultIterator it = m_model->executePreparedQuery( m_query, bindings );
+                setError( m_query.lastError() );
+                return it;
+            }
+
+        private:
+            PreparedQuery m_query;
+            QPointer<MutexModel> m_model;
+        };
+    }
+}
 
 
 class Soprano::Util::MutexModel::Private
@@ -42,6 +83,18 @@ public:
 
     QList<MutexIteratorBase*> openIterators;
 
+    // iterators are opened under a read lock, thus, concurrently
+    void addIterator( MutexIteratorBase* it ) {
+        QMutexLocker lock( &m_iteratorMutex );
+        openIterators.append( it );
+    }
+
+    void removeIterator( MutexIteratorBase* it ) {
+        QMutexLocker lock( &m_iteratorMutex );
+        Q_ASSERT( openIterators.contains( it ) );
+        openIterators.removeAll( it );
+    }
+
     void lockForWrite() {
         switch( m_protectionMode ) {
         case PlainMultiThreading:
@@ -50,6 +103,9 @@ public:
         case ReadWriteMultiThreading:
             m_msLock.lockForWrite();
             break;
+        case ScalableReadWriteMultiThreading:
+            m_scalableLock.lockForWrite();
+            break;
         case ReadWriteSingleThreading:
             break;
         }
@@ -64,6 +120,9 @@ public:
         case ReadWriteMultiThreading:
             m_msLock.lockForRead();
             break;
+        case ScalableReadWriteMultiThreading:
+            m_scalableLock.lockForRead();
+            break;
         case ReadWriteSingleThreading:
             break;
         }
@@ -77,6 +136,9 @@ public:
         case ReadWriteMultiThreading:
             m_msLock.unlock();
             break;
+        case ScalableReadWriteMultiThreading:
+            m_scalableLock.unlock();
+            break;
         case ReadWriteSingleThreading:
             break;
         }
@@ -84,7 +146,9 @@ public:
 
 private:
     ExtReadWriteLock m_msLock;
+    ScalableReadWriteLock m_scalableLock;
     QMutex m_mutex;
+    QMutex m_iteratorMutex;
 
     ProtectionMode m_protectionMode;
 };
@@ -135,13 +199,38 @@ Soprano::Error::ErrorCode Soprano::Util::MutexModel::removeAllStatements( const
 }
 
 
+QList<Soprano::Statement> Soprano::Util::MutexModel::takeAllStatements( const Statement &statement )
+{
+    d->lockForWrite();
+    QList<Statement> removed = FilterModel::takeAllStatements( statement );
+    d->unlock();
+    return removed;
+}
+
+
 Soprano::StatementIterator Soprano::Util::MutexModel::listStatements( const Statement &partial ) const
 {
     d->lockForRead();
     StatementIterator it = FilterModel::listStatements( partial );
     if ( it.isValid() ) {
         MutexStatementIteratorBackend* b = new MutexStatementIteratorBackend( it, const_cast<MutexModel*>( this ) );
-        d->openIterators.append( b );
+        d->addIterator( b );
+        return b;
+    }
+    else {
+        d->unlock();
+        return it;
+    }
+}
+
+
+Soprano::StatementIterator Soprano::Util::MutexModel::listStatements( const Statement& partial, int offset, int limit ) const
+{
+    d->lockForRead();
+    StatementIterator it = FilterModel::listStatements( partial, offset, limit );
+    if ( it.isValid() ) {
+        MutexStatementIteratorBackend* b = new MutexStatementIteratorBackend( it, const_cast<MutexModel*>( this ) );
+        d->addIterator( b );
         return b;
     }
     else {
@@ -157,7 +246,23 @@ Soprano::NodeIterator Soprano::Util::MutexModel::listContexts() const
     NodeIterator it = FilterModel::listContexts();
     if ( it.isValid() ) {
         MutexNodeIteratorBackend* b = new MutexNodeIteratorBackend( it, const_cast<MutexModel*>( this ) );
-        d->openIterators.append( b );
+        d->addIterator( b );
+        return b;
+    }
+    else {
+        d->unlock();
+        return it;
+    }
+}
+
+
+Soprano::NodeIterator Soprano::Util::MutexModel::listContexts( int offset, int limit ) const
+{
+    d->lockForRead();
+    NodeIterator it = FilterModel::listContexts( offset, limit );
+    if ( it.isValid() ) {
+        MutexNodeIteratorBackend* b = new MutexNodeIteratorBackend( it, const_cast<MutexModel*>( this ) );
+        d->addIterator( b );
         return b;
     }
     else {
@@ -175,7 +280,37 @@ Soprano::QueryResultIterator Soprano::Util::MutexModel::executeQuery( const QStr
     QueryResultIterator it = FilterModel::executeQuery( query, language, userQueryLanguage );
     if ( it.isValid() ) {
         MutexQueryResultIteratorBackend* b = new MutexQueryResultIteratorBackend( it, const_cast<MutexModel*>( this ) );
-        d->openIterators.append( b );
+        d->addIterator( b );
+        return b;
+    }
+    else {
+        d->unlock();
+        return it;
+    }
+}
+
+
+Soprano::PreparedQuery Soprano::Util::MutexModel::prepareQuery( const QString& query,
+                                                                Query::QueryLanguage language,
+                                                                const QString& userQueryLanguage ) const
+{
+    d->lockForRead();
+    PreparedQuery pq = FilterModel::prepareQuery( query, language, userQueryLanguage );
+    d->unlock();
+    if ( pq.isValid() )
+        return new MutexPreparedQueryBackend( pq, const_cast<MutexModel*>( this ) );
+    else
+        return pq;
+}
+
+
+Soprano::QueryResultIterator Soprano::Util::MutexModel::executePreparedQuery( PreparedQuery& query, const BindingSet& bindings ) const
+{
+    d->lockForRead();
+    QueryResultIterator it = query.executeQuery( bindings );
+    if ( it.isValid() ) {
+        MutexQueryResultIteratorBackend* b = new MutexQueryResultIteratorBackend( it, const_cast<MutexModel*>( this ) );
+        d->addIterator( b );
         return b;
     }
     else {
@@ -203,6 +338,15 @@ bool Soprano::Util::MutexModel::containsAnyStatement( const Statement &statement
 }
 
 
+QBitArray Soprano::Util::MutexModel::containsStatements( const QList<Statement>& statements ) const
+{
+    d->lockForRead();
+    QBitArray result = FilterModel::containsStatements( statements );
+    d->unlock();
+    return result;
+}
+
+
 bool Soprano::Util::MutexModel::isEmpty() const
 {
     d->lockForRead();
@@ -221,10 +365,36 @@ int Soprano::Util::MutexModel::statementCount() const
 }
 
 
+int Soprano::Util::MutexModel::estimateCount( const Statement& pattern ) const
+{
+    d->lockForRead();
+    int cnt = FilterModel::estimateCount( pattern );
+    d->unlock();
+    return cnt;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::MutexModel::predicateStatistics() const
+{
+    d->lockForRead();
+    QHash<Node, int> counts = FilterModel::predicateStatistics();
+    d->unlock();
+    return counts;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::MutexModel::contextStatistics() const
+{
+    d->lockForRead();
+    QHash<Node, int> counts = FilterModel::contextStatistics();
+    d->unlock();
+    return counts;
+}
+
+
 void Soprano::Util::MutexModel::removeIterator( MutexIteratorBase* it ) const
 {
-    Q_ASSERT( d->openIterators.contains( it ) );
-    d->openIterators.removeAll( it );
+    d->removeIterator( it );
     d->unlock();
 }
 
@@ -28,6 +28,7 @@
 namespace Soprano {
     namespace Util {
         class MutexIteratorBase;
+        class MutexPreparedQueryBackend;
 
         /**
          * \class MutexModel mutexmodel.h Soprano/Util/MutexModel
@@ -70,7 +71,19 @@ namespace Soprano {
                  * \deprecated This was a buggy mode which was impossible to fix.
                  * Use Soprano::Util::AsyncModel instead.
                  */
-                ReadWriteSingleThreading
+                ReadWriteSingleThreading,
+
+                /**
+                 * ScalableReadWriteMultiThreading mode has the same semantics as
+                 * ReadWriteMultiThreading but does not serialize the readers on
+                 * one mutex. Read locks are counted per thread which makes
+                 * concurrent reads scale with the number of threads at the cost
+                 * of more expensive write locks. Use it for models which are
+                 * mostly read from many threads.
+                 *
+                 * \since 2.10
+                 */
+                ScalableReadWriteMultiThreading
             };
 
             /**
@@ -90,15 +103,25 @@ namespace Soprano {
             Error::ErrorCode addStatement( const Statement &statement );
             Error::ErrorCode removeStatement( const Statement &statement );
             Error::ErrorCode removeAllStatements( const Statement &statement );
+            QList<Statement> takeAllStatements( const Statement &statement );
             StatementIterator listStatements( const Statement &partial ) const;
+            StatementIterator listStatements( const Statement& partial, int offset, int limit ) const;
             NodeIterator listContexts() const;
+            NodeIterator listContexts( int offset, int limit ) const;
             QueryResultIterator executeQuery( const QString& query, 
                                               Query::QueryLanguage language,
                                               const QString& userQueryLanguage = QString() ) const;
+            PreparedQuery prepareQuery( const QString& query,
+                                        Query::QueryLanguage language,
+                                        const QString& userQueryLanguage = QString() ) const;
             bool containsStatement( const Statement &statement ) const;
             bool containsAnyStatement( const Statement &statement ) const;
+            QBitArray containsStatements( const QList<Statement>& statements ) const;
             bool isEmpty() const;
             int statementCount() const;
+            int estimateCount( const Statement& pattern ) const;
+            QHash<Node, int> predicateStatistics() const;
+            QHash<Node, int> contextStatistics() const;
 
             using FilterModel::addStatement;
             using FilterModel::removeStatement;
@@ -109,11 +132,13 @@ namespace Soprano {
 
         private:
             void removeIterator( MutexIteratorBase* it ) const;
+            QueryResultIterator executePreparedQuery( PreparedQuery& query, const BindingSet& bindings ) const;
 
             class Private;
             Private* const d;
 
             friend class MutexIteratorBase;
+            friend class MutexPreparedQueryBackend;
         };
     }
 }
@@ -0,0 +1,104 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_PAGED_ITERATOR_BACKEND_H_
+#define _SOPRANO_PAGED_ITERATOR_BACKEND_H_
+
+#include "iteratorbackend.h"
+#include "iterator.h"
+
+
+namespace Soprano {
+    namespace Util {
+        /**
+         * Returns a range of the elements of another iterator. Used as the
+         * fallback for models which cannot position their iterators natively.
+         *
+         * The wrapped iterator is closed as soon as the last element of the range
+         * has been returned, thus, the locks of the model are released without
+         * waiting for the caller to close the iterator.
+         */
+        template<typename T> class PagedIteratorBackend : public IteratorBackend<T>
+        {
+        public:
+            /**
+             * \param it The iterator to wrap.
+             * \param offset The number of elements to skip.
+             * \param limit The maximum number of elements to return, -1 for no limit.
+             */
+            PagedIteratorBackend( const Iterator<T>& it, int offset, int limit )
+                : m_it( it ),
+                  m_offset( offset ),
+                  m_remaining( limit ) {
+            }
+
+            ~PagedIteratorBackend() {
+                close();
+            }
+
+            bool next() {
+                while ( m_offset > 0 ) {
+                    --m_offset;
+                    if ( !m_it.next() ) {
+                        finish();
+                        return false;
+                    }
+                }
+
+                if ( m_remaining == 0 || !m_it.next() ) {
+                    finish();
+                    return false;
+                }
+
+                m_current = m_it.current();
+                this->setError( m_it.lastError() );
+                if ( m_remaining > 0 && --m_remaining == 0 ) {
+                    // the last element of the range
+                    m_it.close();
+                }
+                return true;
+            }
+
+            T current() const {
+                return m_current;
+            }
+
+            void close() {
+                m_it.close();
+            }
+
+        private:
+            void finish() {
+                m_it.close();
+                this->setError( m_it.lastError() );
+                m_remaining = 0;
+                m_offset = 0;
+            }
+
+            Iterator<T> m_it;
+            int m_offset;
+            int m_remaining;
+            T m_current;
+        };
+    }
+}
+
+#endif
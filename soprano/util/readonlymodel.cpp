@@ -22,6 +22,7 @@
 #include "readonlymodel.h"
 #include "statement.h"
 #include "queryresultiterator.h"
+#include "preparedquery.h"
 #include "statementiterator.h"
 #include "nodeiterator.h"
 #include "query/query.h"
@@ -112,6 +113,15 @@ Soprano::NodeIterator Soprano::Util::ReadOnlyModel::listContexts() const
 }
 
 
+Soprano::NodeIterator Soprano::Util::ReadOnlyModel::listContexts( int offset, int limit ) const
+{
+    Q_ASSERT( d->parent );
+    NodeIterator it = d->parent->listContexts( offset, limit );
+    setError( d->parent->lastError() );
+    return it;
+}
+
+
 bool Soprano::Util::ReadOnlyModel::containsStatement( const Statement &statement ) const
 {
     Q_ASSERT( d->parent );
@@ -121,6 +131,15 @@ bool Soprano::Util::ReadOnlyModel::containsStatement( const Statement &statement
 }
 
 
+QBitArray Soprano::Util::ReadOnlyModel::containsStatements( const QList<Statement>& statements ) const
+{
+    Q_ASSERT( d->parent );
+    QBitArray result = d->parent->containsStatements( statements );
+    setError( d->parent->lastError() );
+    return result;
+}
+
+
 bool Soprano::Util::ReadOnlyModel::containsAnyStatement( const Statement &statement ) const
 {
     Q_ASSERT( d->parent );
@@ -139,6 +158,15 @@ Soprano::QueryResultIterator Soprano::Util::ReadOnlyModel::executeQuery( const Q
 }
 
 
+Soprano::PreparedQuery Soprano::Util::ReadOnlyModel::prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage ) const
+{
+    Q_ASSERT( d->parent );
+    PreparedQuery pq = d->parent->prepareQuery( query, language, userQueryLanguage );
+    setError( d->parent->lastError() );
+    return pq;
+}
+
+
 Soprano::StatementIterator Soprano::Util::ReadOnlyModel::listStatements( const Statement &partial ) const
 {
     Q_ASSERT( d->parent );
@@ -148,6 +176,15 @@ Soprano::StatementIterator Soprano::Util::ReadOnlyModel::listStatements( const S
 }
 
 
+Soprano::StatementIterator Soprano::Util::ReadOnlyModel::listStatements( const Statement& partial, int offset, int limit ) const
+{
+    Q_ASSERT( d->parent );
+    StatementIterator it = d->parent->listStatements( partial, offset, limit );
+    setError( d->parent->lastError() );
+    return it;
+}
+
+
 int Soprano::Util::ReadOnlyModel::statementCount() const
 {
     Q_ASSERT( d->parent );
@@ -157,6 +194,33 @@ int Soprano::Util::ReadOnlyModel::statementCount() const
 }
 
 
+int Soprano::Util::ReadOnlyModel::estimateCount( const Statement& pattern ) const
+{
+    Q_ASSERT( d->parent );
+    int cnt = d->parent->estimateCount( pattern );
+    setError( d->parent->lastError() );
+    return cnt;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::ReadOnlyModel::predicateStatistics() const
+{
+    Q_ASSERT( d->parent );
+    QHash<Node, int> counts = d->parent->predicateStatistics();
+    setError( d->parent->lastError() );
+    return counts;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::ReadOnlyModel::contextStatistics() const
+{
+    Q_ASSERT( d->parent );
+    QHash<Node, int> counts = d->parent->contextStatistics();
+    setError( d->parent->lastError() );
+    return counts;
+}
+
+
 bool Soprano::Util::ReadOnlyModel::isEmpty() const
 {
     Q_ASSERT( d->parent );
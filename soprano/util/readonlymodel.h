@@ -67,16 +67,37 @@ namespace Soprano {
              */
             StatementIterator listStatements( const Statement &partial ) const;
 
+            /**
+             * Simply pipes the call through to the parent model.
+             *
+             * \since 2.10
+             */
+            StatementIterator listStatements( const Statement& partial, int offset, int limit ) const;
+
             /**
              * Simply pipes the call through to the parent model.
              */
             NodeIterator listContexts() const;
 
+            /**
+             * Simply pipes the call through to the parent model.
+             *
+             * \since 2.10
+             */
+            NodeIterator listContexts( int offset, int limit ) const;
+
             /**
              * Simply pipes the call through to the parent model.
              */
             QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
 
+            /**
+             * Simply pipes the call through to the parent model.
+             *
+             * \since 2.10
+             */
+            PreparedQuery prepareQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+
             /**
              * Simply pipes the call through to the parent model.
              */
@@ -87,6 +108,13 @@ namespace Soprano {
              */
             bool containsAnyStatement( const Statement &statement ) const;
 
+            /**
+             * Simply pipes the call through to the parent model.
+             *
+             * \since 2.10
+             */
+            QBitArray containsStatements( const QList<Statement>& statements ) const;
+
             /**
              * Simply pipes the call through to the parent model.
              */
@@ -97,6 +125,27 @@ namespace Soprano {
              */
             int statementCount() const;
 
+            /**
+             * Simply pipes the call through to the parent model.
+             *
+             * \since 2.10
+             */
+            int estimateCount( const Statement& pattern ) const;
+
+            /**
+             * Simply pipes the call through to the parent model.
+             *
+             * \since 2.10
+             */
+            QHash<Node, int> predicateStatistics() const;
+
+            /**
+             * Simply pipes the call through to the parent model.
+             *
+             * \since 2.10
+             */
+            QHash<Node, int> contextStatistics() const;
+
             /**
              * Will do nothing but set an Error::ErrorPermissionDenied error.
              */
@@ -0,0 +1,213 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "scalablereadwritelock.h"
+
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QThread>
+#include <QtCore/QThreadStorage>
+#include <QtCore/QHash>
+
+
+namespace {
+    /// the number of reader counters per lock, threads beyond that share counters
+    const int s_slotCount = 64;
+
+    /// a reader counter which occupies a cache line of its own
+    struct ReaderSlot {
+        QAtomicInt count;
+        char padding[64 - sizeof( QAtomicInt )];
+    };
+
+    /// the per-thread state shared by all locks
+    struct ThreadState {
+        ThreadState();
+
+        int slot;
+
+        /// the read lock nesting depth of this thread for each lock
+        QHash<const ScalableReadWriteLock*, int> depths;
+    };
+
+    QAtomicInt s_nextSlot;
+
+    ThreadState::ThreadState()
+        : slot( int( uint( s_nextSlot.fetchAndAddRelaxed( 1 ) ) % s_slotCount ) )
+    {
+    }
+
+    typedef QThreadStorage<ThreadState*> ThreadStateStorage;
+    Q_GLOBAL_STATIC( ThreadStateStorage, s_threadState )
+
+    ThreadState* threadState() {
+        ThreadStateStorage* storage = s_threadState();
+        if ( !storage->hasLocalData() )
+            storage->setLocalData( new ThreadState() );
+        return storage->localData();
+    }
+
+    inline int atomicLoad( const QAtomicInt& value ) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
+        return value;
+#else
+        return value.loadAcquire();
+#endif
+    }
+}
+
+
+class ScalableReadWriteLock::Private
+{
+public:
+    Private()
+        : writerActive( false ),
+          writerThread( 0 ) {
+    }
+
+    /**
+     * A read lock may be released by another thread than the one which acquired it,
+     * for example by closing an iterator. Then the counters of both threads are off
+     * but their sum is still correct.
+     */
+    bool readersActive() const {
+        int count = 0;
+        for ( int i = 0; i < s_slotCount; ++i ) {
+            count += atomicLoad( slots[i].count );
+        }
+        return count != 0;
+    }
+
+    /// Decrements a reader counter and wakes up the waiting writer
+    void releaseSlot( int slot ) {
+        slots[slot].count.fetchAndAddOrdered( -1 );
+        if ( atomicLoad( writers ) != 0 ) {
+            QMutexLocker lock( &mutex );
+            writerWait.wakeAll();
+        }
+    }
+
+    ReaderSlot slots[s_slotCount];
+
+    /// the number of writers holding or waiting for the lock, blocks new readers
+    QAtomicInt writers;
+
+    // the following members are protected by the mutex
+    QMutex mutex;
+    QWaitCondition readerWait;
+    QWaitCondition writerWait;
+    bool writerActive;
+    Qt::HANDLE writerThread;
+};
+
+
+ScalableReadWriteLock::ScalableReadWriteLock()
+    : d( new Private() )
+{
+}
+
+
+ScalableReadWriteLock::~ScalableReadWriteLock()
+{
+    delete d;
+}
+
+
+void ScalableReadWriteLock::lockForWrite()
+{
+    // block new readers before waiting for the current ones
+    d->writers.fetchAndAddOrdered( 1 );
+
+    QMutexLocker lock( &d->mutex );
+
+    while ( d->writerActive ) {
+        d->writerWait.wait( &d->mutex );
+    }
+    d->writerActive = true;
+    d->writerThread = QThread::currentThreadId();
+
+    while ( d->readersActive() ) {
+        d->writerWait.wait( &d->mutex );
+    }
+}
+
+
+void ScalableReadWriteLock::lockForRead()
+{
+    ThreadState* state = threadState();
+
+    // nested read locks are counted as well but never wait for a writer
+    QHash<const ScalableReadWriteLock*, int>::iterator it = state->depths.find( this );
+    if ( it != state->depths.end() ) {
+        d->slots[state->slot].count.fetchAndAddOrdered( 1 );
+        ++it.value();
+        return;
+    }
+
+    Q_FOREVER {
+        d->slots[state->slot].count.fetchAndAddOrdered( 1 );
+        if ( atomicLoad( d->writers ) == 0 )
+            break;
+
+        // a writer is active or waiting: back off and wait for it to finish
+        d->releaseSlot( state->slot );
+
+        QMutexLocker lock( &d->mutex );
+        while ( atomicLoad( d->writers ) != 0 ) {
+            d->readerWait.wait( &d->mutex );
+        }
+    }
+
+    state->depths.insert( this, 1 );
+}
+
+
+void ScalableReadWriteLock::unlock()
+{
+    ThreadState* state = threadState();
+
+    QHash<const ScalableReadWriteLock*, int>::iterator it = state->depths.find( this );
+    if ( it != state->depths.end() ) {
+        // releasing a read lock
+        if ( --it.value() <= 0 )
+            state->depths.erase( it );
+        d->releaseSlot( state->slot );
+        return;
+    }
+
+    QMutexLocker lock( &d->mutex );
+    if ( d->writerActive && d->writerThread == QThread::currentThreadId() ) {
+        // releasing the write lock
+        d->writerActive = false;
+        d->writerThread = 0;
+        if ( d->writers.fetchAndAddOrdered( -1 ) > 1 ) {
+            d->writerWait.wakeAll();
+        } else {
+            d->readerWait.wakeAll();
+        }
+    }
+    else {
+        // releasing a read lock acquired by another thread
+        lock.unlock();
+        d->releaseSlot( state->slot );
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SCALABLE_READWRITE_LOCK_H_
+#define _SCALABLE_READWRITE_LOCK_H_
+
+/**
+ * A read-write lock with the same semantics as ExtReadWriteLock which does not
+ * serialize the readers on one mutex.
+ *
+ * Read locks are counted in a set of counters which are spread over separate
+ * cache lines. Each thread is assigned one of them, thus, readers only touch
+ * shared state when a writer is active or waiting. Nested read locks are tracked
+ * in thread-local storage and always succeed, even if a writer is waiting.
+ *
+ * Writers take precedence over readers. Acquiring a write lock is more expensive
+ * than with ExtReadWriteLock since all reader counters need to be checked.
+ */
+class ScalableReadWriteLock
+{
+public:
+    ScalableReadWriteLock();
+    ~ScalableReadWriteLock();
+
+    void lockForWrite();
+    void lockForRead();
+
+    void unlock();
+
+private:
+    class Private;
+    Private* const d;
+};
+
+#endif
@@ -0,0 +1,425 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "shardedmodel.h"
+#include "modelfanout.h"
+#include "simplenodeiterator.h"
+#include "queryresultiterator.h"
+#include "unionmodel.h"
+
+#include <QtCore/QThread>
+
+
+namespace {
+    /**
+     * The shard of a statement is part of the stored data, thus we cannot use
+     * qHash() which may change between Qt versions. Instead we hash the N3
+     * encoding of the key node with 32 bit FNV-1a.
+     */
+    quint32 persistentHash( const Soprano::Node& node )
+    {
+        const QByteArray data = node.toN3().toUtf8();
+        quint32 hash = 2166136261u;
+        for ( int i = 0; i < data.size(); ++i ) {
+            hash ^= quint8( data[i] );
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+}
+
+
+class Soprano::Util::ShardedModel::Private
+{
+public:
+    Private()
+        : queryModel( 0 ) {
+    }
+
+    QList<Model*> shards;
+    ShardingMode mode;
+
+    /// runs the queries on all shards if there is more than one
+    UnionModel* queryModel;
+
+    mutable QThreadPool threadPool;
+
+    /// the scans of the open iterators, cancelled when the model is deleted
+    mutable ParallelScanRegistry scans;
+
+    /// the node used for partitioning
+    Node shardKey( const Statement& s ) const {
+        return mode == ShardByContext ? s.context() : s.subject();
+    }
+
+    int shardIndex( const Statement& s ) const {
+        return persistentHash( shardKey( s ) ) % quint32( shards.count() );
+    }
+
+    /// \return the only shard which may contain statements matching \p partial or -1
+    int shardForPattern( const Statement& partial ) const {
+        if ( shards.count() == 1 )
+            return 0;
+        // an empty context is a wildcard in patterns
+        if ( shardKey( partial ).isValid() )
+            return shardIndex( partial );
+        return -1;
+    }
+
+    /// Sends \p calls to the shards in parallel and waits for all of them
+    QVector<FanOutResult> runCalls( const FanOutCallGroupPointer& group, const QList<FanOutCall*>& calls ) const {
+        FanOutCall::start( &threadPool, calls );
+        return group->wait();
+    }
+};
+
+
+Soprano::Util::ShardedModel::ShardedModel( const QList<Model*>& shards, ShardingMode mode )
+    : Model(),
+      d( new Private() )
+{
+    Q_ASSERT( !shards.isEmpty() );
+
+    d->shards = shards;
+    d->mode = mode;
+    d->threadPool.setMaxThreadCount( qMax( QThread::idealThreadCount(), 2*shards.count() ) );
+    if ( shards.count() > 1 )
+        d->queryModel = new UnionModel( shards );
+
+    Q_FOREACH( Model* shard, shards ) {
+        // re-emit in the thread of the change, like the backends do
+        connect( shard, SIGNAL(statementsAdded()), this, SIGNAL(statementsAdded()), Qt::DirectConnection );
+        connect( shard, SIGNAL(statementsRemoved()), this, SIGNAL(statementsRemoved()), Qt::DirectConnection );
+        connect( shard, SIGNAL(statementAdded(Soprano::Statement)),
+                 this, SIGNAL(statementAdded(Soprano::Statement)), Qt::DirectConnection );
+        connect( shard, SIGNAL(statementRemoved(Soprano::Statement)),
+                 this, SIGNAL(statementRemoved(Soprano::Statement)), Qt::DirectConnection );
+    }
+}
+
+
+Soprano::Util::ShardedModel::~ShardedModel()
+{
+    d->scans.cancelAll();
+    d->threadPool.waitForDone();
+    delete d->queryModel;
+    delete d;
+}
+
+
+QList<Soprano::Model*> Soprano::Util::ShardedModel::shards() const
+{
+    return d->shards;
+}
+
+
+Soprano::Util::ShardedModel::ShardingMode Soprano::Util::ShardedModel::shardingMode() const
+{
+    return d->mode;
+}
+
+
+int Soprano::Util::ShardedModel::shardIndex( const Statement& statement ) const
+{
+    return d->shardIndex( statement );
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::ShardedModel::addStatement( const Statement& statement )
+{
+    Model* shard = d->shards[d->shardIndex( statement )];
+    Error::ErrorCode c = shard->addStatement( statement );
+    setError( shard->lastError() );
+    return c;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::ShardedModel::addStatements( const QList<Statement>& statements )
+{
+    QVector<QList<Statement> > partitions( d->shards.count() );
+    Q_FOREACH( const Statement& s, statements ) {
+        partitions[d->shardIndex( s )].append( s );
+    }
+
+    QList<int> used;
+    for ( int i = 0; i < partitions.count(); ++i ) {
+        if ( !partitions[i].isEmpty() )
+            used.append( i );
+    }
+
+    FanOutCallGroupPointer group( new FanOutCallGroup( used.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < used.count(); ++i ) {
+        calls.append( new AddStatementsCall( group, i, d->shards[used[i]], partitions[used[i]] ) );
+    }
+
+    Error::Error error = firstError( d->runCalls( group, calls ) );
+    setError( error );
+    return Error::convertErrorCode( error.code() );
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::ShardedModel::removeStatement( const Statement& statement )
+{
+    Model* shard = d->shards[d->shardIndex( statement )];
+    Error::ErrorCode c = shard->removeStatement( statement );
+    setError( shard->lastError() );
+    return c;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::ShardedModel::removeAllStatements( const Statement& statement )
+{
+    const int index = d->shardForPattern( statement );
+    if ( index >= 0 ) {
+        Model* shard = d->shards[index];
+        Error::ErrorCode c = shard->removeAllStatements( statement );
+        setError( shard->lastError() );
+        return c;
+    }
+
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new RemoveAllStatementsCall( group, i, d->shards[i], statement ) );
+    }
+
+    Error::Error error = firstError( d->runCalls( group, calls ) );
+    setError( error );
+    return Error::convertErrorCode( error.code() );
+}
+
+
+Soprano::StatementIterator Soprano::Util::ShardedModel::listStatements( const Statement& partial ) const
+{
+    const int index = d->shardForPattern( partial );
+    if ( index >= 0 ) {
+        Model* shard = d->shards[index];
+        StatementIterator it = shard->listStatements( partial );
+        setError( shard->lastError() );
+        return it;
+    }
+
+    QList<ScanSource<Statement>*> sources;
+    Q_FOREACH( Model* shard, d->shards ) {
+        sources.append( new StatementScanSource( shard, partial ) );
+    }
+    QSharedPointer<ParallelScan<Statement> > scan( new ParallelScan<Statement>( sources ) );
+    d->scans.add( scan );
+    ParallelScan<Statement>::start( scan, &d->threadPool );
+
+    clearError();
+    return new ParallelStatementIteratorBackend( scan );
+}
+
+
+Soprano::NodeIterator Soprano::Util::ShardedModel::listContexts() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new ListContextsCall( group, i, d->shards[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    Error::Error error = firstError( results );
+    setError( error );
+    if ( error )
+        return NodeIterator();
+
+    QList<Node> contexts;
+    if ( d->mode == ShardByContext ) {
+        // the contexts of the shards are disjoint
+        Q_FOREACH( const FanOutResult& result, results ) {
+            contexts += result.nodes;
+        }
+    }
+    else {
+        QSet<Node> merged;
+        Q_FOREACH( const FanOutResult& result, results ) {
+            Q_FOREACH( const Node& context, result.nodes ) {
+                if ( !merged.contains( context ) ) {
+                    merged.insert( context );
+                    contexts.append( context );
+                }
+            }
+        }
+    }
+    return SimpleNodeIterator( contexts );
+}
+
+
+Soprano::QueryResultIterator Soprano::Util::ShardedModel::executeQuery( const QString& query,
+                                                                         Query::QueryLanguage language,
+                                                                         const QString& userQueryLanguage ) const
+{
+    if ( d->shards.count() == 1 ) {
+        Model* shard = d->shards.first();
+        QueryResultIterator it = shard->executeQuery( query, language, userQueryLanguage );
+        setError( shard->lastError() );
+        return it;
+    }
+
+    // each shard evaluates the query on its own statements
+    QueryResultIterator it = d->queryModel->executeQuery( query, language, userQueryLanguage );
+    setError( d->queryModel->lastError() );
+    return it;
+}
+
+
+bool Soprano::Util::ShardedModel::containsStatement( const Statement& statement ) const
+{
+    Model* shard = d->shards[d->shardIndex( statement )];
+    bool b = shard->containsStatement( statement );
+    setError( shard->lastError() );
+    return b;
+}
+
+
+bool Soprano::Util::ShardedModel::containsAnyStatement( const Statement& statement ) const
+{
+    const int index = d->shardForPattern( statement );
+    if ( index >= 0 ) {
+        Model* shard = d->shards[index];
+        bool b = shard->containsAnyStatement( statement );
+        setError( shard->lastError() );
+        return b;
+    }
+
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new ContainsAnyStatementCall( group, i, d->shards[i], statement ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    bool b = false;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        b = b || result.boolValue;
+    }
+    setError( firstError( results ) );
+    return b;
+}
+
+
+bool Soprano::Util::ShardedModel::isEmpty() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new IsEmptyCall( group, i, d->shards[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    bool empty = true;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        empty = empty && result.boolValue;
+    }
+    setError( firstError( results ) );
+    return empty;
+}
+
+
+int Soprano::Util::ShardedModel::statementCount() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new StatementCountCall( group, i, d->shards[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    int count = 0;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        if ( result.intValue < 0 )
+            count = -1;
+        else if ( count >= 0 )
+            count += result.intValue;
+    }
+    setError( firstError( results ) );
+    return count;
+}
+
+
+int Soprano::Util::ShardedModel::estimateCount( const Statement& pattern ) const
+{
+    const int index = d->shardForPattern( pattern );
+    if ( index >= 0 ) {
+        Model* shard = d->shards[index];
+        int cnt = shard->estimateCount( pattern );
+        setError( shard->lastError() );
+        return cnt;
+    }
+
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new EstimateCountCall( group, i, d->shards[i], pattern ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    int count = 0;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        if ( result.intValue < 0 )
+            count = -1;
+        else if ( count >= 0 )
+            count += result.intValue;
+    }
+    setError( firstError( results ) );
+    return count;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::ShardedModel::predicateStatistics() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new PredicateStatisticsCall( group, i, d->shards[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    setError( firstError( results ) );
+    return mergeCounts( results );
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::ShardedModel::contextStatistics() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->shards.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->shards.count(); ++i ) {
+        calls.append( new ContextStatisticsCall( group, i, d->shards[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    setError( firstError( results ) );
+    return mergeCounts( results );
+}
+
+
+Soprano::Node Soprano::Util::ShardedModel::createBlankNode()
+{
+    Model* shard = d->shards.first();
+    Node node = shard->createBlankNode();
+    setError( shard->lastError() );
+    return node;
+}
@@ -0,0 +1,155 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_SHARDED_MODEL_H_
+#define _SOPRANO_SHARDED_MODEL_H_
+
+#include "model.h"
+#include "soprano_export.h"
+
+#include <QtCore/QList>
+
+namespace Soprano {
+    namespace Util {
+        /**
+         * \class ShardedModel shardedmodel.h Soprano/Util/ShardedModel
+         *
+         * \brief Spreads the statements of one logical model over several models.
+         *
+         * The ShardedModel partitions its statements over a list of shard models, for
+         * example several storages on different disks or several %Soprano servers. Each
+         * statement is stored in the shard selected by the hash of its context or its
+         * subject, depending on the ShardingMode. The hash is the 32 bit FNV-1a hash of
+         * the UTF-8 encoded Node::toN3() of the node modulo the number of shards. It is
+         * part of the storage format and will not change.
+         *
+         * Calls which only concern one shard, like adding a statement or listing the
+         * statements of one context in ShardByContext mode, are forwarded to that shard
+         * in the calling thread. The ShardedModel itself does not lock, thus, writes to
+         * different shards run concurrently. All other calls are sent to all shards in
+         * parallel through an internal thread pool. Statement iterators spanning several
+         * shards read the shards in parallel and return the statements in the order
+         * in which they arrive.
+         *
+         * Queries are forwarded if there is only one shard. Otherwise they are evaluated
+         * on each shard separately, like UnionModel does, and the results are returned
+         * in the order in which they arrive. Thus, solutions which join statements of
+         * different shards are not found, and DISTINCT, LIMIT, and ORDER BY only apply
+         * per shard. In ShardByContext mode queries which stay within one graph are not
+         * affected. The result of a boolean query is \p true if it is \p true for any
+         * shard.
+         *
+         * The signals of the shards are forwarded. Be aware that they may be emitted
+         * from the threads of the internal pool.
+         *
+         * \warning The shards are not owned by the ShardedModel and have to be empty or
+         * already partitioned with the same number of shards and the same mode. Each
+         * blank node is only valid within the shard it was created in. Blank nodes are
+         * created by the first shard.
+         *
+         * \since 2.10
+         */
+        class SOPRANO_EXPORT ShardedModel : public Model
+        {
+            Q_OBJECT
+
+        public:
+            enum ShardingMode {
+                /**
+                 * Statements are partitioned by context. All statements of one graph end
+                 * up in the same shard. Statements without context are stored in one
+                 * shard.
+                 */
+                ShardByContext,
+
+                /**
+                 * Statements are partitioned by subject. All statements describing one
+                 * resource end up in the same shard. Contexts may span several shards.
+                 */
+                ShardBySubject
+            };
+
+            /**
+             * Create a new ShardedModel.
+             *
+             * \param shards The models to distribute the statements over. At least one
+             * model is required.
+             * \param mode The partitioning of the statements.
+             */
+            ShardedModel( const QList<Model*>& shards, ShardingMode mode = ShardByContext );
+
+            /**
+             * Destructor. Closes all open iterators.
+             */
+            ~ShardedModel();
+
+            /**
+             * \return The shard models set in the constructor.
+             */
+            QList<Model*> shards() const;
+
+            /**
+             * \return The partitioning set in the constructor.
+             */
+            ShardingMode shardingMode() const;
+
+            /**
+             * \return The index of the shard \p statement is stored in.
+             */
+            int shardIndex( const Statement& statement ) const;
+
+            Error::ErrorCode addStatement( const Statement& statement );
+
+            /**
+             * Reimplemented to add the statements of all shards in parallel
+             * with one call per shard.
+             */
+            Error::ErrorCode addStatements( const QList<Statement>& statements );
+
+            Error::ErrorCode removeStatement( const Statement& statement );
+            Error::ErrorCode removeAllStatements( const Statement& statement );
+            StatementIterator listStatements( const Statement& partial ) const;
+            NodeIterator listContexts() const;
+            QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+            bool containsStatement( const Statement& statement ) const;
+            bool containsAnyStatement( const Statement& statement ) const;
+            bool isEmpty() const;
+            int statementCount() const;
+            int estimateCount( const Statement& pattern ) const;
+            QHash<Node, int> predicateStatistics() const;
+            QHash<Node, int> contextStatistics() const;
+            Node createBlankNode();
+
+            using Model::addStatement;
+            using Model::removeStatement;
+            using Model::removeAllStatements;
+            using Model::listStatements;
+            using Model::containsStatement;
+            using Model::containsAnyStatement;
+
+        private:
+            class Private;
+            Private* const d;
+        };
+    }
+}
+
+#endif
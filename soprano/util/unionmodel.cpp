@@ -0,0 +1,649 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "unionmodel.h"
+#include "modelfanout.h"
+#include "simplenodeiterator.h"
+#include "queryresultiterator.h"
+#include "queryresultiteratorbackend.h"
+#include "bindingset.h"
+
+#include <QtCore/QThread>
+#include <QtCore/QStringList>
+
+
+namespace {
+    Soprano::Error::Error createPermissionDeniedError() {
+        return Soprano::Error::Error( "Soprano::Util::UnionModel - no write support", Soprano::Error::ErrorPermissionDenied );
+    }
+
+    Soprano::Error::Error createTimeoutError() {
+        return Soprano::Error::Error( "Soprano::Util::UnionModel - timeout while waiting for a member model", Soprano::Error::ErrorTimeout );
+    }
+
+    /// \return the timeout error if one of the calls did not finish, otherwise the first error
+    Soprano::Error::Error resultError( const QVector<Soprano::Util::FanOutResult>& results ) {
+        for ( int i = 0; i < results.count(); ++i ) {
+            if ( !results[i].finished )
+                return createTimeoutError();
+        }
+        return Soprano::Util::firstError( results );
+    }
+
+    /**
+     * One item of a query result. Each member first sends a header describing
+     * its result, followed by the bindings or statements.
+     */
+    class QueryItem
+    {
+    public:
+        enum Kind {
+            Header,
+            Bindings,
+            Graph
+        };
+
+        QueryItem()
+            : kind( Header ),
+              isGraph( false ),
+              isBool( false ),
+              boolValue( false ) {
+        }
+
+        Kind kind;
+
+        // header
+        bool isGraph;
+        bool isBool;
+        bool boolValue;
+        QStringList bindingNames;
+
+        // data
+        Soprano::BindingSet bindings;
+        Soprano::Statement statement;
+    };
+
+    class QueryScanSource : public Soprano::Util::ScanSource<QueryItem>
+    {
+    public:
+        QueryScanSource( Soprano::Model* model, const QString& query, Soprano::Query::QueryLanguage language, const QString& userQueryLanguage )
+            : m_model( model ),
+              m_query( query ),
+              m_language( language ),
+              m_userQueryLanguage( userQueryLanguage ),
+              m_headerPending( false ) {
+        }
+
+        bool open() {
+            m_it = m_model->executeQuery( m_query, m_language, m_userQueryLanguage );
+            m_error = m_model->lastError();
+            m_headerPending = m_it.isValid();
+            return m_it.isValid();
+        }
+
+        bool next() {
+            if ( m_headerPending ) {
+                m_current = QueryItem();
+                m_current.isGraph = m_it.isGraph();
+                m_current.isBool = m_it.isBool();
+                if ( m_current.isBool )
+                    m_current.boolValue = m_it.boolValue();
+                else if ( !m_current.isGraph )
+                    m_current.bindingNames = m_it.bindingNames();
+                m_headerPending = false;
+                return true;
+            }
+
+            if ( !m_current.isBool && m_it.next() ) {
+                if ( m_current.isGraph ) {
+                    m_current.kind = QueryItem::Graph;
+                    m_current.statement = m_it.currentStatement();
+                }
+                else {
+                    m_current.kind = QueryItem::Bindings;
+                    m_current.bindings = m_it.current();
+                }
+                return true;
+            }
+
+            m_error = m_it.lastError();
+            return false;
+        }
+
+        QueryItem current() const {
+            return m_current;
+        }
+
+        Soprano::Error::Error lastError() const {
+            return m_error;
+        }
+
+        void close() {
+            m_it.close();
+        }
+
+    private:
+        Soprano::Model* m_model;
+        QString m_query;
+        Soprano::Query::QueryLanguage m_language;
+        QString m_userQueryLanguage;
+
+        Soprano::QueryResultIterator m_it;
+        Soprano::Error::Error m_error;
+        QueryItem m_current;
+        bool m_headerPending;
+    };
+
+    /// the values of a binding set in a fixed variable order
+    class BindingKey
+    {
+    public:
+        BindingKey( const Soprano::BindingSet& set, const QStringList& names )
+            : m_values( names.count() ) {
+            for ( int i = 0; i < names.count(); ++i )
+                m_values[i] = set.value( names[i] );
+        }
+
+        bool operator==( const BindingKey& other ) const {
+            return m_values == other.m_values;
+        }
+
+        uint hash() const {
+            uint h = 0;
+            for ( int i = 0; i < m_values.count(); ++i )
+                h = 31*h + qHash( m_values[i] );
+            return h;
+        }
+
+    private:
+        QVector<Soprano::Node> m_values;
+    };
+
+    uint qHash( const BindingKey& key ) {
+        return key.hash();
+    }
+
+    /**
+     * Merges the query results of the members. The type of the result and the
+     * binding names are taken from the first header which arrives.
+     */
+    class UnionQueryResultIteratorBackend : public Soprano::QueryResultIteratorBackend
+    {
+    public:
+        UnionQueryResultIteratorBackend( const QSharedPointer<Soprano::Util::ParallelScan<QueryItem> >& scan, bool distinct )
+            : m_scan( scan ),
+              m_distinct( distinct ),
+              m_haveHeader( false ),
+              m_finished( false ) {
+        }
+
+        ~UnionQueryResultIteratorBackend() {
+            close();
+        }
+
+        bool next() {
+            QueryItem item;
+            while ( fetch( item ) ) {
+                if ( item.kind == QueryItem::Graph ) {
+                    if ( !m_distinct || !m_seenStatements.contains( item.statement ) ) {
+                        if ( m_distinct )
+                            m_seenStatements.insert( item.statement );
+                        m_current = item;
+                        return true;
+                    }
+                }
+                else if ( item.kind == QueryItem::Bindings ) {
+                    if ( !m_distinct ) {
+                        m_current = item;
+                        return true;
+                    }
+                    BindingKey key( item.bindings, m_header.bindingNames );
+                    if ( !m_seenBindings.contains( key ) ) {
+                        m_seenBindings.insert( key );
+                        m_current = item;
+                        return true;
+                    }
+                }
+            }
+            close();
+            return false;
+        }
+
+        Soprano::Statement currentStatement() const {
+            return m_current.statement;
+        }
+
+        Soprano::Node binding( const QString& name ) const {
+            // the members may order the variables differently
+            return m_current.bindings.value( name );
+        }
+
+        Soprano::Node binding( int offset ) const {
+            if ( offset >= 0 && offset < m_header.bindingNames.count() )
+                return binding( m_header.bindingNames[offset] );
+            return Soprano::Node();
+        }
+
+        int bindingCount() const {
+            return bindingNames().count();
+        }
+
+        QStringList bindingNames() const {
+            ensureHeader();
+            return m_header.bindingNames;
+        }
+
+        bool isGraph() const {
+            ensureHeader();
+            return m_haveHeader && m_header.isGraph;
+        }
+
+        bool isBinding() const {
+            ensureHeader();
+            return m_haveHeader && !m_header.isGraph && !m_header.isBool;
+        }
+
+        bool isBool() const {
+            ensureHeader();
+            return m_haveHeader && m_header.isBool;
+        }
+
+        bool boolValue() const {
+            // true if any member answered true
+            QueryItem item;
+            while ( !m_header.boolValue && fetch( item ) ) {
+            }
+            return m_header.boolValue;
+        }
+
+        void close() {
+            if ( !m_finished ) {
+                m_finished = true;
+                m_scan->close();
+                setError( m_scan->lastError() );
+            }
+            m_buffer.clear();
+            m_seenStatements.clear();
+            m_seenBindings.clear();
+        }
+
+    private:
+        /// pulls items until the first header arrived
+        void ensureHeader() const {
+            QueryItem item;
+            while ( !m_haveHeader && pull( item ) ) {
+                if ( item.kind != QueryItem::Header )
+                    m_buffer.append( item );
+            }
+        }
+
+        /// \return the next data item
+        bool fetch( QueryItem& item ) const {
+            if ( !m_buffer.isEmpty() ) {
+                item = m_buffer.takeFirst();
+                return true;
+            }
+            while ( pull( item ) ) {
+                if ( item.kind != QueryItem::Header )
+                    return true;
+            }
+            return false;
+        }
+
+        /// reads the next item from the scan and remembers the headers
+        bool pull( QueryItem& item ) const {
+            if ( m_finished || !m_scan->next( item ) )
+                return false;
+            if ( item.kind == QueryItem::Header ) {
+                if ( !m_haveHeader ) {
+                    m_header = item;
+                    m_haveHeader = true;
+                }
+                else if ( item.isBool && item.boolValue ) {
+                    m_header.boolValue = true;
+                }
+            }
+            return true;
+        }
+
+        QSharedPointer<Soprano::Util::ParallelScan<QueryItem> > m_scan;
+        bool m_distinct;
+
+        mutable QueryItem m_header;
+        mutable bool m_haveHeader;
+        mutable QList<QueryItem> m_buffer;
+        bool m_finished;
+
+        QueryItem m_current;
+        QSet<Soprano::Statement> m_seenStatements;
+        QSet<BindingKey> m_seenBindings;
+    };
+}
+
+
+class Soprano::Util::UnionModel::Private
+{
+public:
+    Private()
+        : removeDuplicates( false ),
+          memberTimeout( 0 ) {
+    }
+
+    QList<Model*> members;
+    bool removeDuplicates;
+    int memberTimeout;
+
+    mutable QThreadPool threadPool;
+
+    /// the scans of the open iterators, cancelled when the model is deleted
+    mutable ParallelScanRegistry scans;
+
+    /// Sends \p calls to the members in parallel and waits for them within the member timeout
+    QVector<FanOutResult> runCalls( const FanOutCallGroupPointer& group, const QList<FanOutCall*>& calls, bool stopOnTrue = false ) const {
+        FanOutCall::start( &threadPool, calls );
+        return group->wait( memberTimeout, stopOnTrue );
+    }
+};
+
+
+Soprano::Util::UnionModel::UnionModel( const QList<Model*>& members )
+    : Model(),
+      d( new Private() )
+{
+    d->members = members;
+
+    // calls to slow members may still be running when the next call starts
+    d->threadPool.setMaxThreadCount( qMax( QThread::idealThreadCount(), 4*members.count() ) );
+
+    Q_FOREACH( Model* member, members ) {
+        connect( member, SIGNAL(statementsAdded()), this, SIGNAL(statementsAdded()), Qt::DirectConnection );
+        connect( member, SIGNAL(statementsRemoved()), this, SIGNAL(statementsRemoved()), Qt::DirectConnection );
+        connect( member, SIGNAL(statementAdded(Soprano::Statement)),
+                 this, SIGNAL(statementAdded(Soprano::Statement)), Qt::DirectConnection );
+        connect( member, SIGNAL(statementRemoved(Soprano::Statement)),
+                 this, SIGNAL(statementRemoved(Soprano::Statement)), Qt::DirectConnection );
+    }
+}
+
+
+Soprano::Util::UnionModel::~UnionModel()
+{
+    d->scans.cancelAll();
+    d->threadPool.waitForDone();
+    delete d;
+}
+
+
+QList<Soprano::Model*> Soprano::Util::UnionModel::members() const
+{
+    return d->members;
+}
+
+
+void Soprano::Util::UnionModel::setRemoveDuplicates( bool remove )
+{
+    d->removeDuplicates = remove;
+}
+
+
+bool Soprano::Util::UnionModel::removeDuplicates() const
+{
+    return d->removeDuplicates;
+}
+
+
+void Soprano::Util::UnionModel::setMemberTimeout( int msecs )
+{
+    d->memberTimeout = qMax( 0, msecs );
+}
+
+
+int Soprano::Util::UnionModel::memberTimeout() const
+{
+    return d->memberTimeout;
+}
+
+
+Soprano::StatementIterator Soprano::Util::UnionModel::listStatements( const Statement& partial ) const
+{
+    QList<ScanSource<Statement>*> sources;
+    Q_FOREACH( Model* member, d->members ) {
+        sources.append( new StatementScanSource( member, partial ) );
+    }
+    QSharedPointer<ParallelScan<Statement> > scan( new ParallelScan<Statement>( sources, d->memberTimeout ) );
+    d->scans.add( scan );
+    ParallelScan<Statement>::start( scan, &d->threadPool );
+
+    clearError();
+    return new ParallelStatementIteratorBackend( scan, d->removeDuplicates );
+}
+
+
+Soprano::NodeIterator Soprano::Util::UnionModel::listContexts() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new ListContextsCall( group, i, d->members[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+
+    // the contexts of the members which answered in time
+    QList<Node> contexts;
+    QSet<Node> merged;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        Q_FOREACH( const Node& context, result.nodes ) {
+            if ( !merged.contains( context ) ) {
+                merged.insert( context );
+                contexts.append( context );
+            }
+        }
+    }
+
+    setError( resultError( results ) );
+    return SimpleNodeIterator( contexts );
+}
+
+
+Soprano::QueryResultIterator Soprano::Util::UnionModel::executeQuery( const QString& query,
+                                                                       Query::QueryLanguage language,
+                                                                       const QString& userQueryLanguage ) const
+{
+    QList<ScanSource<QueryItem>*> sources;
+    Q_FOREACH( Model* member, d->members ) {
+        sources.append( new QueryScanSource( member, query, language, userQueryLanguage ) );
+    }
+    QSharedPointer<ParallelScan<QueryItem> > scan( new ParallelScan<QueryItem>( sources, d->memberTimeout ) );
+    d->scans.add( scan );
+    ParallelScan<QueryItem>::start( scan, &d->threadPool );
+
+    clearError();
+    return new UnionQueryResultIteratorBackend( scan, d->removeDuplicates );
+}
+
+
+bool Soprano::Util::UnionModel::containsStatement( const Statement& statement ) const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new ContainsStatementCall( group, i, d->members[i], statement ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls, true );
+    Q_FOREACH( const FanOutResult& result, results ) {
+        if ( result.finished && result.boolValue ) {
+            clearError();
+            return true;
+        }
+    }
+    setError( resultError( results ) );
+    return false;
+}
+
+
+bool Soprano::Util::UnionModel::containsAnyStatement( const Statement& statement ) const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new ContainsAnyStatementCall( group, i, d->members[i], statement ) );
+    }
+
+    // the first member finding a match answers the call
+    const QVector<FanOutResult> results = d->runCalls( group, calls, true );
+    Q_FOREACH( const FanOutResult& result, results ) {
+        if ( result.finished && result.boolValue ) {
+            clearError();
+            return true;
+        }
+    }
+    setError( resultError( results ) );
+    return false;
+}
+
+
+bool Soprano::Util::UnionModel::isEmpty() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new IsEmptyCall( group, i, d->members[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    bool empty = true;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        empty = empty && result.boolValue;
+    }
+    setError( resultError( results ) );
+    return empty;
+}
+
+
+int Soprano::Util::UnionModel::statementCount() const
+{
+    if ( d->removeDuplicates ) {
+        StatementIterator it = listStatements();
+        int count = 0;
+        while ( it.next() )
+            ++count;
+        setError( it.lastError() );
+        return lastError() ? -1 : count;
+    }
+
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new StatementCountCall( group, i, d->members[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    int count = 0;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        if ( !result.finished || result.intValue < 0 )
+            count = -1;
+        else if ( count >= 0 )
+            count += result.intValue;
+    }
+    setError( resultError( results ) );
+    return count;
+}
+
+
+int Soprano::Util::UnionModel::estimateCount( const Statement& pattern ) const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new EstimateCountCall( group, i, d->members[i], pattern ) );
+    }
+
+    // a partial sum could report 0 for a pattern which has matches
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    int count = 0;
+    Q_FOREACH( const FanOutResult& result, results ) {
+        if ( !result.finished || result.intValue < 0 )
+            count = -1;
+        else if ( count >= 0 )
+            count += result.intValue;
+    }
+    setError( resultError( results ) );
+    return count;
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::UnionModel::predicateStatistics() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new PredicateStatisticsCall( group, i, d->members[i] ) );
+    }
+
+    // the statistics of the members which answered in time
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    setError( resultError( results ) );
+    return mergeCounts( results );
+}
+
+
+QHash<Soprano::Node, int> Soprano::Util::UnionModel::contextStatistics() const
+{
+    FanOutCallGroupPointer group( new FanOutCallGroup( d->members.count() ) );
+    QList<FanOutCall*> calls;
+    for ( int i = 0; i < d->members.count(); ++i ) {
+        calls.append( new ContextStatisticsCall( group, i, d->members[i] ) );
+    }
+
+    const QVector<FanOutResult> results = d->runCalls( group, calls );
+    setError( resultError( results ) );
+    return mergeCounts( results );
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::UnionModel::addStatement( const Statement& )
+{
+    setError( createPermissionDeniedError() );
+    return Error::ErrorPermissionDenied;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::UnionModel::removeStatement( const Statement& )
+{
+    setError( createPermissionDeniedError() );
+    return Error::ErrorPermissionDenied;
+}
+
+
+Soprano::Error::ErrorCode Soprano::Util::UnionModel::removeAllStatements( const Statement& )
+{
+    setError( createPermissionDeniedError() );
+    return Error::ErrorPermissionDenied;
+}
+
+
+Soprano::Node Soprano::Util::UnionModel::createBlankNode()
+{
+    setError( createPermissionDeniedError() );
+    return Node();
+}
@@ -0,0 +1,175 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_UNION_MODEL_H_
+#define _SOPRANO_UNION_MODEL_H_
+
+#include "model.h"
+#include "soprano_export.h"
+
+#include <QtCore/QList>
+
+namespace Soprano {
+    namespace Util {
+        /**
+         * \class UnionModel unionmodel.h Soprano/Util/UnionModel
+         *
+         * \brief Presents several independent models as one read-only model.
+         *
+         * The UnionModel sends all read calls to all of its member models in parallel,
+         * for example a local storage, a model of another %Soprano server, and a remote
+         * SPARQL endpoint. The members are called from the threads of an internal pool,
+         * thus, a slow member does not delay the results of the fast ones.
+         *
+         * Statement iterators and query results return the results of the members in
+         * the order in which they arrive. A query is evaluated on each member separately,
+         * i.e. solutions which combine statements of several members are not found. The
+         * result of a boolean query is \p true if it is \p true for any member.
+         *
+         * Duplicates, i.e. statements or query solutions returned by more than one member,
+         * are kept unless setRemoveDuplicates() is enabled. Then each iterator remembers
+         * the results it returned in a hash set.
+         *
+         * With setMemberTimeout() the members which did not answer in time are skipped.
+         * Calls and iterators then return the results available so far and report an
+         * Error::ErrorTimeout.
+         *
+         * All write calls fail with Error::ErrorPermissionDenied. The signals of the
+         * members are forwarded.
+         *
+         * \warning The member models are not owned by the UnionModel.
+         *
+         * \since 2.10
+         */
+        class SOPRANO_EXPORT UnionModel : public Model
+        {
+            Q_OBJECT
+
+        public:
+            /**
+             * Create a new UnionModel.
+             *
+             * \param members The models to combine.
+             */
+            UnionModel( const QList<Model*>& members );
+
+            /**
+             * Destructor. Closes all open iterators.
+             */
+            ~UnionModel();
+
+            /**
+             * \return The member models set in the constructor.
+             */
+            QList<Model*> members() const;
+
+            /**
+             * Remove statements and query solutions which are returned by more than
+             * one member. The setting applies to iterators created afterwards.
+             *
+             * \param remove If \p true duplicates are removed. The default is \p false.
+             */
+            void setRemoveDuplicates( bool remove );
+
+            /**
+             * \return \p true if duplicates are removed.
+             * \sa setRemoveDuplicates()
+             */
+            bool removeDuplicates() const;
+
+            /**
+             * Set the time the members have to answer a call or to deliver the next
+             * results of an iterator. Members which do not answer in time are skipped.
+             * The time an iterator is not read by its user is not counted.
+             *
+             * \param msecs The timeout in milliseconds. 0 disables the timeout, which is
+             * the default.
+             */
+            void setMemberTimeout( int msecs );
+
+            /**
+             * \return The timeout set via setMemberTimeout().
+             */
+            int memberTimeout() const;
+
+            StatementIterator listStatements( const Statement& partial ) const;
+            NodeIterator listContexts() const;
+            QueryResultIterator executeQuery( const QString& query, Query::QueryLanguage language, const QString& userQueryLanguage = QString() ) const;
+            bool containsStatement( const Statement& statement ) const;
+            bool containsAnyStatement( const Statement& statement ) const;
+            bool isEmpty() const;
+
+            /**
+             * The sum of the statement counts of the members. If duplicates are removed
+             * all statements are listed to count them.
+             */
+            int statementCount() const;
+
+            /**
+             * The sum of the estimates of the members.
+             */
+            int estimateCount( const Statement& pattern ) const;
+
+            /**
+             * The sums of the statistics of the members.
+             */
+            QHash<Node, int> predicateStatistics() const;
+
+            /**
+             * The sums of the statistics of the members.
+             */
+            QHash<Node, int> contextStatistics() const;
+
+            /**
+             * Will do nothing but set an Error::ErrorPermissionDenied error.
+             */
+            Error::ErrorCode addStatement( const Statement& statement );
+
+            /**
+             * Will do nothing but set an Error::ErrorPermissionDenied error.
+             */
+            Error::ErrorCode removeStatement( const Statement& statement );
+
+            /**
+             * Will do nothing but set an Error::ErrorPermissionDenied error.
+             */
+            Error::ErrorCode removeAllStatements( const Statement& statement );
+
+            /**
+             * Will do nothing but set an Error::ErrorPermissionDenied error.
+             */
+            Node createBlankNode();
+
+            using Model::addStatement;
+            using Model::removeStatement;
+            using Model::removeAllStatements;
+            using Model::listStatements;
+            using Model::containsStatement;
+            using Model::containsAnyStatement;
+
+        private:
+            class Private;
+            Private* const d;
+        };
+    }
+}
+
+#endif
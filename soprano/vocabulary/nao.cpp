@@ -19,320 +19,535 @@
  */
 
 #include "nao.h"
-#include <QThreadStorage>
+#include "node.h"
+
+namespace {
+    Soprano::Node createNode( const char* uri )
+    {
+        const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );
+#if QT_VERSION < 0x050000
+        // QUrl parses and normalizes on demand which is not thread-safe in Qt4.
+        // Trigger it now, before the constants are shared between threads.
+        url.isValid();
+        url.host();
+        (void)( url == QUrl( url ) );
+#endif
+        return Soprano::Node( url );
+    }
+}
 
 class NaoPrivate
 {
 public:
     NaoPrivate()
-        : nao_namespace( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#", QUrl::StrictMode ) ),
-          nao_FreeDesktopIcon( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#FreeDesktopIcon", QUrl::StrictMode ) ),
-          nao_Party( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Party", QUrl::StrictMode ) ),
-          nao_Symbol( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Symbol", QUrl::StrictMode ) ),
-          nao_Tag( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Tag", QUrl::StrictMode ) ),
-          nao_altLabel( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#altLabel", QUrl::StrictMode ) ),
-          nao_altSymbol( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#altSymbol", QUrl::StrictMode ) ),
-          nao_annotation( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#annotation", QUrl::StrictMode ) ),
-          nao_contributor( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#contributor", QUrl::StrictMode ) ),
-          nao_created( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#created", QUrl::StrictMode ) ),
-          nao_creator( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#creator", QUrl::StrictMode ) ),
-          nao_deprecated( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#deprecated", QUrl::StrictMode ) ),
-          nao_description( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#description", QUrl::StrictMode ) ),
-          nao_engineeringTool( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#engineeringTool", QUrl::StrictMode ) ),
-          nao_hasDefaultNamespace( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasDefaultNamespace", QUrl::StrictMode ) ),
-          nao_hasDefaultNamespaceAbbreviation( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasDefaultNamespaceAbbreviation", QUrl::StrictMode ) ),
-          nao_hasSubResource( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasSubResource", QUrl::StrictMode ) ),
-          nao_hasSuperResource( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasSuperResource", QUrl::StrictMode ) ),
-          nao_hasSymbol( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasSymbol", QUrl::StrictMode ) ),
-          nao_hasTag( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasTag", QUrl::StrictMode ) ),
-          nao_hasTopic( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasTopic", QUrl::StrictMode ) ),
-          nao_iconName( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#iconName", QUrl::StrictMode ) ),
-          nao_identifier( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#identifier", QUrl::StrictMode ) ),
-          nao_isDataGraphFor( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isDataGraphFor", QUrl::StrictMode ) ),
-          nao_isRelated( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isRelated", QUrl::StrictMode ) ),
-          nao_isTagFor( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isTagFor", QUrl::StrictMode ) ),
-          nao_isTopicOf( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isTopicOf", QUrl::StrictMode ) ),
-          nao_lastModified( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#lastModified", QUrl::StrictMode ) ),
-          nao_modified( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#modified", QUrl::StrictMode ) ),
-          nao_numericRating( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#numericRating", QUrl::StrictMode ) ),
-          nao_personalIdentifier( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#personalIdentifier", QUrl::StrictMode ) ),
-          nao_pluralPrefLabel( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#pluralPrefLabel", QUrl::StrictMode ) ),
-          nao_prefLabel( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#prefLabel", QUrl::StrictMode ) ),
-          nao_prefSymbol( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#prefSymbol", QUrl::StrictMode ) ),
-          nao_rating( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#rating", QUrl::StrictMode ) ),
-          nao_score( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#score", QUrl::StrictMode ) ),
-          nao_scoreParameter( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#scoreParameter", QUrl::StrictMode ) ),
-          nao_serializationLanguage( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#serializationLanguage", QUrl::StrictMode ) ),
-          nao_status( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#status", QUrl::StrictMode ) ),
-          nao_userVisible( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#userVisible", QUrl::StrictMode ) ),
-          nao_version( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#version", QUrl::StrictMode ) ),
-          nao_Agent( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Agent", QUrl::StrictMode ) ),
-          nao_maintainedBy( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#maintainedBy", QUrl::StrictMode ) ) {
+        : nao_namespace( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#" ) ),
+          nao_FreeDesktopIcon( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#FreeDesktopIcon" ) ),
+          nao_Party( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Party" ) ),
+          nao_Symbol( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Symbol" ) ),
+          nao_Tag( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Tag" ) ),
+          nao_altLabel( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#altLabel" ) ),
+          nao_altSymbol( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#altSymbol" ) ),
+          nao_annotation( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#annotation" ) ),
+          nao_contributor( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#contributor" ) ),
+          nao_created( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#created" ) ),
+          nao_creator( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#creator" ) ),
+          nao_deprecated( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#deprecated" ) ),
+          nao_description( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#description" ) ),
+          nao_engineeringTool( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#engineeringTool" ) ),
+          nao_hasDefaultNamespace( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasDefaultNamespace" ) ),
+          nao_hasDefaultNamespaceAbbreviation( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasDefaultNamespaceAbbreviation" ) ),
+          nao_hasSubResource( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasSubResource" ) ),
+          nao_hasSuperResource( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasSuperResource" ) ),
+          nao_hasSymbol( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasSymbol" ) ),
+          nao_hasTag( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasTag" ) ),
+          nao_hasTopic( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#hasTopic" ) ),
+          nao_iconName( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#iconName" ) ),
+          nao_identifier( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#identifier" ) ),
+          nao_isDataGraphFor( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isDataGraphFor" ) ),
+          nao_isRelated( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isRelated" ) ),
+          nao_isTagFor( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isTagFor" ) ),
+          nao_isTopicOf( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#isTopicOf" ) ),
+          nao_lastModified( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#lastModified" ) ),
+          nao_modified( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#modified" ) ),
+          nao_numericRating( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#numericRating" ) ),
+          nao_personalIdentifier( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#personalIdentifier" ) ),
+          nao_pluralPrefLabel( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#pluralPrefLabel" ) ),
+          nao_prefLabel( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#prefLabel" ) ),
+          nao_prefSymbol( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#prefSymbol" ) ),
+          nao_rating( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#rating" ) ),
+          nao_score( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#score" ) ),
+          nao_scoreParameter( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#scoreParameter" ) ),
+          nao_serializationLanguage( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#serializationLanguage" ) ),
+          nao_status( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#status" ) ),
+          nao_userVisible( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#userVisible" ) ),
+          nao_version( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#version" ) ),
+          nao_Agent( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#Agent" ) ),
+          nao_maintainedBy( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#maintainedBy" ) ) {
     }
 
-    QUrl nao_namespace;
-    QUrl nao_FreeDesktopIcon;
-    QUrl nao_Party;
-    QUrl nao_Symbol;
-    QUrl nao_Tag;
-    QUrl nao_altLabel;
-    QUrl nao_altSymbol;
-    QUrl nao_annotation;
-    QUrl nao_contributor;
-    QUrl nao_created;
-    QUrl nao_creator;
-    QUrl nao_deprecated;
-    QUrl nao_description;
-    QUrl nao_engineeringTool;
-    QUrl nao_hasDefaultNamespace;
-    QUrl nao_hasDefaultNamespaceAbbreviation;
-    QUrl nao_hasSubResource;
-    QUrl nao_hasSuperResource;
-    QUrl nao_hasSymbol;
-    QUrl nao_hasTag;
-    QUrl nao_hasTopic;
-    QUrl nao_iconName;
-    QUrl nao_identifier;
-    QUrl nao_isDataGraphFor;
-    QUrl nao_isRelated;
-    QUrl nao_isTagFor;
-    QUrl nao_isTopicOf;
-    QUrl nao_lastModified;
-    QUrl nao_modified;
-    QUrl nao_numericRating;
-    QUrl nao_personalIdentifier;
-    QUrl nao_pluralPrefLabel;
-    QUrl nao_prefLabel;
-    QUrl nao_prefSymbol;
-    QUrl nao_rating;
-    QUrl nao_score;
-    QUrl nao_scoreParameter;
-    QUrl nao_serializationLanguage;
-    QUrl nao_status;
-    QUrl nao_userVisible;
-    QUrl nao_version;
-    QUrl nao_Agent;
-    QUrl nao_maintainedBy;
+    Soprano::Node nao_namespace;
+    Soprano::Node nao_FreeDesktopIcon;
+    Soprano::Node nao_Party;
+    Soprano::Node nao_Symbol;
+    Soprano::Node nao_Tag;
+    Soprano::Node nao_altLabel;
+    Soprano::Node nao_altSymbol;
+    Soprano::Node nao_annotation;
+    Soprano::Node nao_contributor;
+    Soprano::Node nao_created;
+    Soprano::Node nao_creator;
+    Soprano::Node nao_deprecated;
+    Soprano::Node nao_description;
+    Soprano::Node nao_engineeringTool;
+    Soprano::Node nao_hasDefaultNamespace;
+    Soprano::Node nao_hasDefaultNamespaceAbbreviation;
+    Soprano::Node nao_hasSubResource;
+    Soprano::Node nao_hasSuperResource;
+    Soprano::Node nao_hasSymbol;
+    Soprano::Node nao_hasTag;
+    Soprano::Node nao_hasTopic;
+    Soprano::Node nao_iconName;
+    Soprano::Node nao_identifier;
+    Soprano::Node nao_isDataGraphFor;
+    Soprano::Node nao_isRelated;
+    Soprano::Node nao_isTagFor;
+    Soprano::Node nao_isTopicOf;
+    Soprano::Node nao_lastModified;
+    Soprano::Node nao_modified;
+    Soprano::Node nao_numericRating;
+    Soprano::Node nao_personalIdentifier;
+    Soprano::Node nao_pluralPrefLabel;
+    Soprano::Node nao_prefLabel;
+    Soprano::Node nao_prefSymbol;
+    Soprano::Node nao_rating;
+    Soprano::Node nao_score;
+    Soprano::Node nao_scoreParameter;
+    Soprano::Node nao_serializationLanguage;
+    Soprano::Node nao_status;
+    Soprano::Node nao_userVisible;
+    Soprano::Node nao_version;
+    Soprano::Node nao_Agent;
+    Soprano::Node nao_maintainedBy;
 };
 
-QThreadStorage<NaoPrivate*> qts_nao;
-NaoPrivate* s_nao() {
-    if( !qts_nao.hasLocalData() )
-        qts_nao.setLocalData( new NaoPrivate );
-    return qts_nao.localData();
-}
+Q_GLOBAL_STATIC( NaoPrivate, s_nao )
 
 QUrl Soprano::Vocabulary::NAO::naoNamespace()
 {
-    return s_nao()->nao_namespace;
+    return s_nao()->nao_namespace.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::FreeDesktopIcon()
 {
-    return s_nao()->nao_FreeDesktopIcon;
+    return s_nao()->nao_FreeDesktopIcon.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::Party()
 {
-    return s_nao()->nao_Party;
+    return s_nao()->nao_Party.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::Symbol()
 {
-    return s_nao()->nao_Symbol;
+    return s_nao()->nao_Symbol.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::Tag()
 {
-    return s_nao()->nao_Tag;
+    return s_nao()->nao_Tag.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::altLabel()
 {
-    return s_nao()->nao_altLabel;
+    return s_nao()->nao_altLabel.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::altSymbol()
 {
-    return s_nao()->nao_altSymbol;
+    return s_nao()->nao_altSymbol.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::annotation()
 {
-    return s_nao()->nao_annotation;
+    return s_nao()->nao_annotation.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::contributor()
 {
-    return s_nao()->nao_contributor;
+    return s_nao()->nao_contributor.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::created()
 {
-    return s_nao()->nao_created;
+    return s_nao()->nao_created.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::creator()
 {
-    return s_nao()->nao_creator;
+    return s_nao()->nao_creator.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::deprecated()
 {
-    return s_nao()->nao_deprecated;
+    return s_nao()->nao_deprecated.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::description()
 {
-    return s_nao()->nao_description;
+    return s_nao()->nao_description.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::engineeringTool()
 {
-    return s_nao()->nao_engineeringTool;
+    return s_nao()->nao_engineeringTool.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::hasDefaultNamespace()
 {
-    return s_nao()->nao_hasDefaultNamespace;
+    return s_nao()->nao_hasDefaultNamespace.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::hasDefaultNamespaceAbbreviation()
 {
-    return s_nao()->nao_hasDefaultNamespaceAbbreviation;
+    return s_nao()->nao_hasDefaultNamespaceAbbreviation.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::hasSubResource()
 {
-    return s_nao()->nao_hasSubResource;
+    return s_nao()->nao_hasSubResource.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::hasSuperResource()
 {
-    return s_nao()->nao_hasSuperResource;
+    return s_nao()->nao_hasSuperResource.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::hasSymbol()
 {
-    return s_nao()->nao_hasSymbol;
+    return s_nao()->nao_hasSymbol.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::hasTag()
 {
-    return s_nao()->nao_hasTag;
+    return s_nao()->nao_hasTag.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::hasTopic()
 {
-    return s_nao()->nao_hasTopic;
+    return s_nao()->nao_hasTopic.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::iconName()
 {
-    return s_nao()->nao_iconName;
+    return s_nao()->nao_iconName.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::identifier()
 {
-    return s_nao()->nao_identifier;
+    return s_nao()->nao_identifier.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::isDataGraphFor()
 {
-    return s_nao()->nao_isDataGraphFor;
+    return s_nao()->nao_isDataGraphFor.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::isRelated()
 {
-    return s_nao()->nao_isRelated;
+    return s_nao()->nao_isRelated.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::isTagFor()
 {
-    return s_nao()->nao_isTagFor;
+    return s_nao()->nao_isTagFor.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::isTopicOf()
 {
-    return s_nao()->nao_isTopicOf;
+    return s_nao()->nao_isTopicOf.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::lastModified()
 {
-    return s_nao()->nao_lastModified;
+    return s_nao()->nao_lastModified.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::modified()
 {
-    return s_nao()->nao_modified;
+    return s_nao()->nao_modified.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::numericRating()
 {
-    return s_nao()->nao_numericRating;
+    return s_nao()->nao_numericRating.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::personalIdentifier()
 {
-    return s_nao()->nao_personalIdentifier;
+    return s_nao()->nao_personalIdentifier.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::pluralPrefLabel()
 {
-    return s_nao()->nao_pluralPrefLabel;
+    return s_nao()->nao_pluralPrefLabel.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::prefLabel()
 {
-    return s_nao()->nao_prefLabel;
+    return s_nao()->nao_prefLabel.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::prefSymbol()
 {
-    return s_nao()->nao_prefSymbol;
+    return s_nao()->nao_prefSymbol.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::rating()
 {
-    return s_nao()->nao_rating;
+    return s_nao()->nao_rating.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::score()
 {
-    return s_nao()->nao_score;
+    return s_nao()->nao_score.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::scoreParameter()
 {
-    return s_nao()->nao_scoreParameter;
+    return s_nao()->nao_scoreParameter.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::serializationLanguage()
 {
-    return s_nao()->nao_serializationLanguage;
+    return s_nao()->nao_serializationLanguage.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::status()
 {
-    return s_nao()->nao_status;
+    return s_nao()->nao_status.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::userVisible()
 {
-    return s_nao()->nao_userVisible;
+    return s_nao()->nao_userVisible.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::version()
 {
-    return s_nao()->nao_version;
+    return s_nao()->nao_version.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::Agent()
 {
-    return s_nao()->nao_Agent;
+    return s_nao()->nao_Agent.uri();
 }
 
 QUrl Soprano::Vocabulary::NAO::maintainedBy()
+{
+    return s_nao()->nao_maintainedBy.uri();
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::FreeDesktopIcon()
+{
+    return s_nao()->nao_FreeDesktopIcon;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::Party()
+{
+    return s_nao()->nao_Party;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::Symbol()
+{
+    return s_nao()->nao_Symbol;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::Tag()
+{
+    return s_nao()->nao_Tag;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::altLabel()
+{
+    return s_nao()->nao_altLabel;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::altSymbol()
+{
+    return s_nao()->nao_altSymbol;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::annotation()
+{
+    return s_nao()->nao_annotation;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::contributor()
+{
+    return s_nao()->nao_contributor;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::created()
+{
+    return s_nao()->nao_created;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::creator()
+{
+    return s_nao()->nao_creator;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::deprecated()
+{
+    return s_nao()->nao_deprecated;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::description()
+{
+    return s_nao()->nao_description;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::engineeringTool()
+{
+    return s_nao()->nao_engineeringTool;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::hasDefaultNamespaceAbbreviation()
+{
+    return s_nao()->nao_hasDefaultNamespaceAbbreviation;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::hasSubResource()
+{
+    return s_nao()->nao_hasSubResource;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::hasSuperResource()
+{
+    return s_nao()->nao_hasSuperResource;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::hasSymbol()
+{
+    return s_nao()->nao_hasSymbol;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::hasTag()
+{
+    return s_nao()->nao_hasTag;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::hasTopic()
+{
+    return s_nao()->nao_hasTopic;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::iconName()
+{
+    return s_nao()->nao_iconName;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::identifier()
+{
+    return s_nao()->nao_identifier;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::isDataGraphFor()
+{
+    return s_nao()->nao_isDataGraphFor;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::isRelated()
+{
+    return s_nao()->nao_isRelated;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::isTagFor()
+{
+    return s_nao()->nao_isTagFor;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::isTopicOf()
+{
+    return s_nao()->nao_isTopicOf;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::lastModified()
+{
+    return s_nao()->nao_lastModified;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::modified()
+{
+    return s_nao()->nao_modified;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::numericRating()
+{
+    return s_nao()->nao_numericRating;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::personalIdentifier()
+{
+    return s_nao()->nao_personalIdentifier;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::pluralPrefLabel()
+{
+    return s_nao()->nao_pluralPrefLabel;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::prefLabel()
+{
+    return s_nao()->nao_prefLabel;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::prefSymbol()
+{
+    return s_nao()->nao_prefSymbol;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::rating()
+{
+    return s_nao()->nao_rating;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::score()
+{
+    return s_nao()->nao_score;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::scoreParameter()
+{
+    return s_nao()->nao_scoreParameter;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::serializationLanguage()
+{
+    return s_nao()->nao_serializationLanguage;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::status()
+{
+    return s_nao()->nao_status;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::userVisible()
+{
+    return s_nao()->nao_userVisible;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::version()
+{
+    return s_nao()->nao_version;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::Agent()
+{
+    return s_nao()->nao_Agent;
+}
+
+Soprano::Node Soprano::Vocabulary::NAO::Nodes::maintainedBy()
 {
     return s_nao()->nao_maintainedBy;
 }
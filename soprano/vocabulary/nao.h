@@ -25,6 +25,8 @@
 #include "soprano_export.h"
 
 namespace Soprano {
+    class Node;
+
     namespace Vocabulary {
         namespace NAO {
             /**
@@ -347,6 +349,57 @@ namespace Soprano {
              * The agent that maintains this resource, ie. created it and knows what to do with it.
              */
             SOPRANO_EXPORT QUrl maintainedBy();
+
+            /**
+             * The terms of this vocabulary as pre-built nodes. They are created once per
+             * process and can be used in place of Soprano::Node( QUrl ) to avoid
+             * constructing a new node on every use.
+             *
+             * \since 2.10
+             */
+            namespace Nodes {
+                SOPRANO_EXPORT Soprano::Node FreeDesktopIcon();
+                SOPRANO_EXPORT Soprano::Node Party();
+                SOPRANO_EXPORT Soprano::Node Symbol();
+                SOPRANO_EXPORT Soprano::Node Tag();
+                SOPRANO_EXPORT Soprano::Node altLabel();
+                SOPRANO_EXPORT Soprano::Node altSymbol();
+                SOPRANO_EXPORT Soprano::Node annotation();
+                SOPRANO_EXPORT Soprano::Node contributor();
+                SOPRANO_EXPORT Soprano::Node created();
+                SOPRANO_EXPORT Soprano::Node creator();
+                SOPRANO_EXPORT Soprano::Node deprecated();
+                SOPRANO_EXPORT Soprano::Node description();
+                SOPRANO_EXPORT Soprano::Node engineeringTool();
+                SOPRANO_EXPORT Soprano::Node hasDefaultNamespaceAbbreviation();
+                SOPRANO_EXPORT Soprano::Node hasSubResource();
+                SOPRANO_EXPORT Soprano::Node hasSuperResource();
+                SOPRANO_EXPORT Soprano::Node hasSymbol();
+                SOPRANO_EXPORT Soprano::Node hasTag();
+                SOPRANO_EXPORT Soprano::Node hasTopic();
+                SOPRANO_EXPORT Soprano::Node iconName();
+                SOPRANO_EXPORT Soprano::Node identifier();
+                SOPRANO_EXPORT Soprano::Node isDataGraphFor();
+                SOPRANO_EXPORT Soprano::Node isRelated();
+                SOPRANO_EXPORT Soprano::Node isTagFor();
+                SOPRANO_EXPORT Soprano::Node isTopicOf();
+                SOPRANO_EXPORT Soprano::Node lastModified();
+                SOPRANO_EXPORT Soprano::Node modified();
+                SOPRANO_EXPORT Soprano::Node numericRating();
+                SOPRANO_EXPORT Soprano::Node personalIdentifier();
+                SOPRANO_EXPORT Soprano::Node pluralPrefLabel();
+                SOPRANO_EXPORT Soprano::Node prefLabel();
+                SOPRANO_EXPORT Soprano::Node prefSymbol();
+                SOPRANO_EXPORT Soprano::Node rating();
+                SOPRANO_EXPORT Soprano::Node score();
+                SOPRANO_EXPORT Soprano::Node scoreParameter();
+                SOPRANO_EXPORT Soprano::Node serializationLanguage();
+                SOPRANO_EXPORT Soprano::Node status();
+                SOPRANO_EXPORT Soprano::Node userVisible();
+                SOPRANO_EXPORT Soprano::Node version();
+                SOPRANO_EXPORT Soprano::Node Agent();
+                SOPRANO_EXPORT Soprano::Node maintainedBy();
+            }
         }
     }
 }
@@ -19,327 +19,552 @@
  */
 
 #include "nrl.h"
-#include <QThreadStorage>
+#include "node.h"
+
+namespace {
+    Soprano::Node createNode( const char* uri )
+    {
+        const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );
+#if QT_VERSION < 0x050000
+        // QUrl parses and normalizes on demand which is not thread-safe in Qt4.
+        // Trigger it now, before the constants are shared between threads.
+        url.isValid();
+        url.host();
+        (void)( url == QUrl( url ) );
+#endif
+        return Soprano::Node( url );
+    }
+}
 
 class NrlPrivate
 {
 public:
     NrlPrivate()
-        : nrl_namespace( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#", QUrl::StrictMode ) ),
-          nrl_AsymmetricProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#AsymmetricProperty", QUrl::StrictMode ) ),
-          nrl_Configuration( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Configuration", QUrl::StrictMode ) ),
-          nrl_Data( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Data", QUrl::StrictMode ) ),
-          nrl_DefaultGraph( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DefaultGraph", QUrl::StrictMode ) ),
-          nrl_DefiningProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DefiningProperty", QUrl::StrictMode ) ),
-          nrl_DiscardableInstanceBase( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DiscardableInstanceBase", QUrl::StrictMode ) ),
-          nrl_DocumentGraph( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DocumentGraph", QUrl::StrictMode ) ),
-          nrl_ExternalViewSpecification( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ExternalViewSpecification", QUrl::StrictMode ) ),
-          nrl_FunctionalProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#FunctionalProperty", QUrl::StrictMode ) ),
-          nrl_Graph( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Graph", QUrl::StrictMode ) ),
-          nrl_GraphMetadata( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#GraphMetadata", QUrl::StrictMode ) ),
-          nrl_GraphView( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#GraphView", QUrl::StrictMode ) ),
-          nrl_InstanceBase( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#InstanceBase", QUrl::StrictMode ) ),
-          nrl_InverseFunctionalProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#InverseFunctionalProperty", QUrl::StrictMode ) ),
-          nrl_KnowledgeBase( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#KnowledgeBase", QUrl::StrictMode ) ),
-          nrl_NonDefiningProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#NonDefiningProperty", QUrl::StrictMode ) ),
-          nrl_Ontology( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Ontology", QUrl::StrictMode ) ),
-          nrl_ReflexiveProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ReflexiveProperty", QUrl::StrictMode ) ),
-          nrl_RuleViewSpecification( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#RuleViewSpecification", QUrl::StrictMode ) ),
-          nrl_Schema( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Schema", QUrl::StrictMode ) ),
-          nrl_Semantics( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Semantics", QUrl::StrictMode ) ),
-          nrl_SymmetricProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#SymmetricProperty", QUrl::StrictMode ) ),
-          nrl_TransitiveProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#TransitiveProperty", QUrl::StrictMode ) ),
-          nrl_ViewSpecification( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ViewSpecification", QUrl::StrictMode ) ),
-          nrl_cardinality( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#cardinality", QUrl::StrictMode ) ),
-          nrl_coreGraphMetadataFor( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#coreGraphMetadataFor", QUrl::StrictMode ) ),
-          nrl_equivalentGraph( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#equivalentGraph", QUrl::StrictMode ) ),
-          nrl_externalRealizer( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#externalRealizer", QUrl::StrictMode ) ),
-          nrl_graphMetadataFor( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#graphMetadataFor", QUrl::StrictMode ) ),
-          nrl_hasSemantics( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#hasSemantics", QUrl::StrictMode ) ),
-          nrl_hasSpecification( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#hasSpecification", QUrl::StrictMode ) ),
-          nrl_imports( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#imports", QUrl::StrictMode ) ),
-          nrl_inverseProperty( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#inverseProperty", QUrl::StrictMode ) ),
-          nrl_maxCardinality( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#maxCardinality", QUrl::StrictMode ) ),
-          nrl_minCardinality( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#minCardinality", QUrl::StrictMode ) ),
-          nrl_realizes( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#realizes", QUrl::StrictMode ) ),
-          nrl_rule( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#rule", QUrl::StrictMode ) ),
-          nrl_ruleLanguage( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ruleLanguage", QUrl::StrictMode ) ),
-          nrl_semanticsDefinedBy( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#semanticsDefinedBy", QUrl::StrictMode ) ),
-          nrl_subGraphOf( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#subGraphOf", QUrl::StrictMode ) ),
-          nrl_superGraphOf( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#superGraphOf", QUrl::StrictMode ) ),
-          nrl_updatable( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#updatable", QUrl::StrictMode ) ),
-          nrl_viewOn( QUrl::fromEncoded( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#viewOn", QUrl::StrictMode ) ) {
+        : nrl_namespace( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#" ) ),
+          nrl_AsymmetricProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#AsymmetricProperty" ) ),
+          nrl_Configuration( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Configuration" ) ),
+          nrl_Data( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Data" ) ),
+          nrl_DefaultGraph( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DefaultGraph" ) ),
+          nrl_DefiningProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DefiningProperty" ) ),
+          nrl_DiscardableInstanceBase( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DiscardableInstanceBase" ) ),
+          nrl_DocumentGraph( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#DocumentGraph" ) ),
+          nrl_ExternalViewSpecification( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ExternalViewSpecification" ) ),
+          nrl_FunctionalProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#FunctionalProperty" ) ),
+          nrl_Graph( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Graph" ) ),
+          nrl_GraphMetadata( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#GraphMetadata" ) ),
+          nrl_GraphView( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#GraphView" ) ),
+          nrl_InstanceBase( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#InstanceBase" ) ),
+          nrl_InverseFunctionalProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#InverseFunctionalProperty" ) ),
+          nrl_KnowledgeBase( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#KnowledgeBase" ) ),
+          nrl_NonDefiningProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#NonDefiningProperty" ) ),
+          nrl_Ontology( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Ontology" ) ),
+          nrl_ReflexiveProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ReflexiveProperty" ) ),
+          nrl_RuleViewSpecification( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#RuleViewSpecification" ) ),
+          nrl_Schema( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Schema" ) ),
+          nrl_Semantics( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#Semantics" ) ),
+          nrl_SymmetricProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#SymmetricProperty" ) ),
+          nrl_TransitiveProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#TransitiveProperty" ) ),
+          nrl_ViewSpecification( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ViewSpecification" ) ),
+          nrl_cardinality( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#cardinality" ) ),
+          nrl_coreGraphMetadataFor( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#coreGraphMetadataFor" ) ),
+          nrl_equivalentGraph( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#equivalentGraph" ) ),
+          nrl_externalRealizer( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#externalRealizer" ) ),
+          nrl_graphMetadataFor( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#graphMetadataFor" ) ),
+          nrl_hasSemantics( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#hasSemantics" ) ),
+          nrl_hasSpecification( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#hasSpecification" ) ),
+          nrl_imports( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#imports" ) ),
+          nrl_inverseProperty( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#inverseProperty" ) ),
+          nrl_maxCardinality( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#maxCardinality" ) ),
+          nrl_minCardinality( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#minCardinality" ) ),
+          nrl_realizes( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#realizes" ) ),
+          nrl_rule( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#rule" ) ),
+          nrl_ruleLanguage( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#ruleLanguage" ) ),
+          nrl_semanticsDefinedBy( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#semanticsDefinedBy" ) ),
+          nrl_subGraphOf( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#subGraphOf" ) ),
+          nrl_superGraphOf( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#superGraphOf" ) ),
+          nrl_updatable( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#updatable" ) ),
+          nrl_viewOn( createNode( "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#viewOn" ) ) {
     }
 
-    QUrl nrl_namespace;
-    QUrl nrl_AsymmetricProperty;
-    QUrl nrl_Configuration;
-    QUrl nrl_Data;
-    QUrl nrl_DefaultGraph;
-    QUrl nrl_DefiningProperty;
-    QUrl nrl_DiscardableInstanceBase;
-    QUrl nrl_DocumentGraph;
-    QUrl nrl_ExternalViewSpecification;
-    QUrl nrl_FunctionalProperty;
-    QUrl nrl_Graph;
-    QUrl nrl_GraphMetadata;
-    QUrl nrl_GraphView;
-    QUrl nrl_InstanceBase;
-    QUrl nrl_InverseFunctionalProperty;
-    QUrl nrl_KnowledgeBase;
-    QUrl nrl_NonDefiningProperty;
-    QUrl nrl_Ontology;
-    QUrl nrl_ReflexiveProperty;
-    QUrl nrl_RuleViewSpecification;
-    QUrl nrl_Schema;
-    QUrl nrl_Semantics;
-    QUrl nrl_SymmetricProperty;
-    QUrl nrl_TransitiveProperty;
-    QUrl nrl_ViewSpecification;
-    QUrl nrl_cardinality;
-    QUrl nrl_coreGraphMetadataFor;
-    QUrl nrl_equivalentGraph;
-    QUrl nrl_externalRealizer;
-    QUrl nrl_graphMetadataFor;
-    QUrl nrl_hasSemantics;
-    QUrl nrl_hasSpecification;
-    QUrl nrl_imports;
-    QUrl nrl_inverseProperty;
-    QUrl nrl_maxCardinality;
-    QUrl nrl_minCardinality;
-    QUrl nrl_realizes;
-    QUrl nrl_rule;
-    QUrl nrl_ruleLanguage;
-    QUrl nrl_semanticsDefinedBy;
-    QUrl nrl_subGraphOf;
-    QUrl nrl_superGraphOf;
-    QUrl nrl_updatable;
-    QUrl nrl_viewOn;
+    Soprano::Node nrl_namespace;
+    Soprano::Node nrl_AsymmetricProperty;
+    Soprano::Node nrl_Configuration;
+    Soprano::Node nrl_Data;
+    Soprano::Node nrl_DefaultGraph;
+    Soprano::Node nrl_DefiningProperty;
+    Soprano::Node nrl_DiscardableInstanceBase;
+    Soprano::Node nrl_DocumentGraph;
+    Soprano::Node nrl_ExternalViewSpecification;
+    Soprano::Node nrl_FunctionalProperty;
+    Soprano::Node nrl_Graph;
+    Soprano::Node nrl_GraphMetadata;
+    Soprano::Node nrl_GraphView;
+    Soprano::Node nrl_InstanceBase;
+    Soprano::Node nrl_InverseFunctionalProperty;
+    Soprano::Node nrl_KnowledgeBase;
+    Soprano::Node nrl_NonDefiningProperty;
+    Soprano::Node nrl_Ontology;
+    Soprano::Node nrl_ReflexiveProperty;
+    Soprano::Node nrl_RuleViewSpecification;
+    Soprano::Node nrl_Schema;
+    Soprano::Node nrl_Semantics;
+    Soprano::Node nrl_SymmetricProperty;
+    Soprano::Node nrl_TransitiveProperty;
+    Soprano::Node nrl_ViewSpecification;
+    Soprano::Node nrl_cardinality;
+    Soprano::Node nrl_coreGraphMetadataFor;
+    Soprano::Node nrl_equivalentGraph;
+    Soprano::Node nrl_externalRealizer;
+    Soprano::Node nrl_graphMetadataFor;
+    Soprano::Node nrl_hasSemantics;
+    Soprano::Node nrl_hasSpecification;
+    Soprano::Node nrl_imports;
+    Soprano::Node nrl_inverseProperty;
+    Soprano::Node nrl_maxCardinality;
+    Soprano::Node nrl_minCardinality;
+    Soprano::Node nrl_realizes;
+    Soprano::Node nrl_rule;
+    Soprano::Node nrl_ruleLanguage;
+    Soprano::Node nrl_semanticsDefinedBy;
+    Soprano::Node nrl_subGraphOf;
+    Soprano::Node nrl_superGraphOf;
+    Soprano::Node nrl_updatable;
+    Soprano::Node nrl_viewOn;
 };
 
-QThreadStorage<NrlPrivate*> qts_nrl;
-NrlPrivate* s_nrl() {
-    if( !qts_nrl.hasLocalData() )
-        qts_nrl.setLocalData( new NrlPrivate );
-    return qts_nrl.localData();
-}
+Q_GLOBAL_STATIC( NrlPrivate, s_nrl )
 
 QUrl Soprano::Vocabulary::NRL::nrlNamespace()
 {
-    return s_nrl()->nrl_namespace;
+    return s_nrl()->nrl_namespace.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::AsymmetricProperty()
 {
-    return s_nrl()->nrl_AsymmetricProperty;
+    return s_nrl()->nrl_AsymmetricProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::Configuration()
 {
-    return s_nrl()->nrl_Configuration;
+    return s_nrl()->nrl_Configuration.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::Data()
 {
-    return s_nrl()->nrl_Data;
+    return s_nrl()->nrl_Data.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::DefaultGraph()
 {
-    return s_nrl()->nrl_DefaultGraph;
+    return s_nrl()->nrl_DefaultGraph.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::DefiningProperty()
 {
-    return s_nrl()->nrl_DefiningProperty;
+    return s_nrl()->nrl_DefiningProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::DiscardableInstanceBase()
 {
-    return s_nrl()->nrl_DiscardableInstanceBase;
+    return s_nrl()->nrl_DiscardableInstanceBase.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::DocumentGraph()
 {
-    return s_nrl()->nrl_DocumentGraph;
+    return s_nrl()->nrl_DocumentGraph.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::ExternalViewSpecification()
 {
-    return s_nrl()->nrl_ExternalViewSpecification;
+    return s_nrl()->nrl_ExternalViewSpecification.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::FunctionalProperty()
 {
-    return s_nrl()->nrl_FunctionalProperty;
+    return s_nrl()->nrl_FunctionalProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::Graph()
 {
-    return s_nrl()->nrl_Graph;
+    return s_nrl()->nrl_Graph.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::GraphMetadata()
 {
-    return s_nrl()->nrl_GraphMetadata;
+    return s_nrl()->nrl_GraphMetadata.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::GraphView()
 {
-    return s_nrl()->nrl_GraphView;
+    return s_nrl()->nrl_GraphView.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::InstanceBase()
 {
-    return s_nrl()->nrl_InstanceBase;
+    return s_nrl()->nrl_InstanceBase.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::InverseFunctionalProperty()
 {
-    return s_nrl()->nrl_InverseFunctionalProperty;
+    return s_nrl()->nrl_InverseFunctionalProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::KnowledgeBase()
 {
-    return s_nrl()->nrl_KnowledgeBase;
+    return s_nrl()->nrl_KnowledgeBase.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::NonDefiningProperty()
 {
-    return s_nrl()->nrl_NonDefiningProperty;
+    return s_nrl()->nrl_NonDefiningProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::Ontology()
 {
-    return s_nrl()->nrl_Ontology;
+    return s_nrl()->nrl_Ontology.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::ReflexiveProperty()
 {
-    return s_nrl()->nrl_ReflexiveProperty;
+    return s_nrl()->nrl_ReflexiveProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::RuleViewSpecification()
 {
-    return s_nrl()->nrl_RuleViewSpecification;
+    return s_nrl()->nrl_RuleViewSpecification.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::Schema()
 {
-    return s_nrl()->nrl_Schema;
+    return s_nrl()->nrl_Schema.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::Semantics()
 {
-    return s_nrl()->nrl_Semantics;
+    return s_nrl()->nrl_Semantics.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::SymmetricProperty()
 {
-    return s_nrl()->nrl_SymmetricProperty;
+    return s_nrl()->nrl_SymmetricProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::TransitiveProperty()
 {
-    return s_nrl()->nrl_TransitiveProperty;
+    return s_nrl()->nrl_TransitiveProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::ViewSpecification()
 {
-    return s_nrl()->nrl_ViewSpecification;
+    return s_nrl()->nrl_ViewSpecification.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::cardinality()
 {
-    return s_nrl()->nrl_cardinality;
+    return s_nrl()->nrl_cardinality.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::coreGraphMetadataFor()
 {
-    return s_nrl()->nrl_coreGraphMetadataFor;
+    return s_nrl()->nrl_coreGraphMetadataFor.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::equivalentGraph()
 {
-    return s_nrl()->nrl_equivalentGraph;
+    return s_nrl()->nrl_equivalentGraph.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::externalRealizer()
 {
-    return s_nrl()->nrl_externalRealizer;
+    return s_nrl()->nrl_externalRealizer.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::graphMetadataFor()
 {
-    return s_nrl()->nrl_graphMetadataFor;
+    return s_nrl()->nrl_graphMetadataFor.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::hasSemantics()
 {
-    return s_nrl()->nrl_hasSemantics;
+    return s_nrl()->nrl_hasSemantics.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::hasSpecification()
 {
-    return s_nrl()->nrl_hasSpecification;
+    return s_nrl()->nrl_hasSpecification.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::imports()
 {
-    return s_nrl()->nrl_imports;
+    return s_nrl()->nrl_imports.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::inverseProperty()
 {
-    return s_nrl()->nrl_inverseProperty;
+    return s_nrl()->nrl_inverseProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::maxCardinality()
 {
-    return s_nrl()->nrl_maxCardinality;
+    return s_nrl()->nrl_maxCardinality.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::minCardinality()
 {
-    return s_nrl()->nrl_minCardinality;
+    return s_nrl()->nrl_minCardinality.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::realizes()
 {
-    return s_nrl()->nrl_realizes;
+    return s_nrl()->nrl_realizes.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::rule()
 {
-    return s_nrl()->nrl_rule;
+    return s_nrl()->nrl_rule.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::ruleLanguage()
 {
-    return s_nrl()->nrl_ruleLanguage;
+    return s_nrl()->nrl_ruleLanguage.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::semanticsDefinedBy()
 {
-    return s_nrl()->nrl_semanticsDefinedBy;
+    return s_nrl()->nrl_semanticsDefinedBy.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::subGraphOf()
 {
-    return s_nrl()->nrl_subGraphOf;
+    return s_nrl()->nrl_subGraphOf.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::superGraphOf()
 {
-    return s_nrl()->nrl_superGraphOf;
+    return s_nrl()->nrl_superGraphOf.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::updatable()
 {
-    return s_nrl()->nrl_updatable;
+    return s_nrl()->nrl_updatable.uri();
 }
 
 QUrl Soprano::Vocabulary::NRL::viewOn()
+{
+    return s_nrl()->nrl_viewOn.uri();
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::AsymmetricProperty()
+{
+    return s_nrl()->nrl_AsymmetricProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::Configuration()
+{
+    return s_nrl()->nrl_Configuration;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::Data()
+{
+    return s_nrl()->nrl_Data;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::DefaultGraph()
+{
+    return s_nrl()->nrl_DefaultGraph;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::DefiningProperty()
+{
+    return s_nrl()->nrl_DefiningProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::DiscardableInstanceBase()
+{
+    return s_nrl()->nrl_DiscardableInstanceBase;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::DocumentGraph()
+{
+    return s_nrl()->nrl_DocumentGraph;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::ExternalViewSpecification()
+{
+    return s_nrl()->nrl_ExternalViewSpecification;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::FunctionalProperty()
+{
+    return s_nrl()->nrl_FunctionalProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::Graph()
+{
+    return s_nrl()->nrl_Graph;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::GraphMetadata()
+{
+    return s_nrl()->nrl_GraphMetadata;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::GraphView()
+{
+    return s_nrl()->nrl_GraphView;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::InstanceBase()
+{
+    return s_nrl()->nrl_InstanceBase;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::InverseFunctionalProperty()
+{
+    return s_nrl()->nrl_InverseFunctionalProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::KnowledgeBase()
+{
+    return s_nrl()->nrl_KnowledgeBase;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::NonDefiningProperty()
+{
+    return s_nrl()->nrl_NonDefiningProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::Ontology()
+{
+    return s_nrl()->nrl_Ontology;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::ReflexiveProperty()
+{
+    return s_nrl()->nrl_ReflexiveProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::RuleViewSpecification()
+{
+    return s_nrl()->nrl_RuleViewSpecification;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::Schema()
+{
+    return s_nrl()->nrl_Schema;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::Semantics()
+{
+    return s_nrl()->nrl_Semantics;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::SymmetricProperty()
+{
+    return s_nrl()->nrl_SymmetricProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::TransitiveProperty()
+{
+    return s_nrl()->nrl_TransitiveProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::ViewSpecification()
+{
+    return s_nrl()->nrl_ViewSpecification;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::cardinality()
+{
+    return s_nrl()->nrl_cardinality;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::coreGraphMetadataFor()
+{
+    return s_nrl()->nrl_coreGraphMetadataFor;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::equivalentGraph()
+{
+    return s_nrl()->nrl_equivalentGraph;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::externalRealizer()
+{
+    return s_nrl()->nrl_externalRealizer;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::graphMetadataFor()
+{
+    return s_nrl()->nrl_graphMetadataFor;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::hasSemantics()
+{
+    return s_nrl()->nrl_hasSemantics;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::hasSpecification()
+{
+    return s_nrl()->nrl_hasSpecification;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::imports()
+{
+    return s_nrl()->nrl_imports;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::inverseProperty()
+{
+    return s_nrl()->nrl_inverseProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::maxCardinality()
+{
+    return s_nrl()->nrl_maxCardinality;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::minCardinality()
+{
+    return s_nrl()->nrl_minCardinality;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::realizes()
+{
+    return s_nrl()->nrl_realizes;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::rule()
+{
+    return s_nrl()->nrl_rule;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::ruleLanguage()
+{
+    return s_nrl()->nrl_ruleLanguage;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::semanticsDefinedBy()
+{
+    return s_nrl()->nrl_semanticsDefinedBy;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::subGraphOf()
+{
+    return s_nrl()->nrl_subGraphOf;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::superGraphOf()
+{
+    return s_nrl()->nrl_superGraphOf;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::updatable()
+{
+    return s_nrl()->nrl_updatable;
+}
+
+Soprano::Node Soprano::Vocabulary::NRL::Nodes::viewOn()
 {
     return s_nrl()->nrl_viewOn;
 }
@@ -25,6 +25,8 @@
 #include "soprano_export.h"
 
 namespace Soprano {
+    class Node;
+
     namespace Vocabulary {
         namespace NRL {
             /**
@@ -374,6 +376,59 @@ namespace Soprano {
              * Points to a graph view over the subject named graph
              */
             SOPRANO_EXPORT QUrl viewOn();
+
+            /**
+             * The terms of this vocabulary as pre-built nodes. They are created once per
+             * process and can be used in place of Soprano::Node( QUrl ) to avoid
+             * constructing a new node on every use.
+             *
+             * \since 2.10
+             */
+            namespace Nodes {
+                SOPRANO_EXPORT Soprano::Node AsymmetricProperty();
+                SOPRANO_EXPORT Soprano::Node Configuration();
+                SOPRANO_EXPORT Soprano::Node Data();
+                SOPRANO_EXPORT Soprano::Node DefaultGraph();
+                SOPRANO_EXPORT Soprano::Node DefiningProperty();
+                SOPRANO_EXPORT Soprano::Node DiscardableInstanceBase();
+                SOPRANO_EXPORT Soprano::Node DocumentGraph();
+                SOPRANO_EXPORT Soprano::Node ExternalViewSpecification();
+                SOPRANO_EXPORT Soprano::Node FunctionalProperty();
+                SOPRANO_EXPORT Soprano::Node Graph();
+                SOPRANO_EXPORT Soprano::Node GraphMetadata();
+                SOPRANO_EXPORT Soprano::Node GraphView();
+                SOPRANO_EXPORT Soprano::Node InstanceBase();
+                SOPRANO_EXPORT Soprano::Node InverseFunctionalProperty();
+                SOPRANO_EXPORT Soprano::Node KnowledgeBase();
+                SOPRANO_EXPORT Soprano::Node NonDefiningProperty();
+                SOPRANO_EXPORT Soprano::Node Ontology();
+                SOPRANO_EXPORT Soprano::Node ReflexiveProperty();
+                SOPRANO_EXPORT Soprano::Node RuleViewSpecification();
+                SOPRANO_EXPORT Soprano::Node Schema();
+                SOPRANO_EXPORT Soprano::Node Semantics();
+                SOPRANO_EXPORT Soprano::Node SymmetricProperty();
+                SOPRANO_EXPORT Soprano::Node TransitiveProperty();
+                SOPRANO_EXPORT Soprano::Node ViewSpecification();
+                SOPRANO_EXPORT Soprano::Node cardinality();
+                SOPRANO_EXPORT Soprano::Node coreGraphMetadataFor();
+                SOPRANO_EXPORT Soprano::Node equivalentGraph();
+                SOPRANO_EXPORT Soprano::Node externalRealizer();
+                SOPRANO_EXPORT Soprano::Node graphMetadataFor();
+                SOPRANO_EXPORT Soprano::Node hasSemantics();
+                SOPRANO_EXPORT Soprano::Node hasSpecification();
+                SOPRANO_EXPORT Soprano::Node imports();
+                SOPRANO_EXPORT Soprano::Node inverseProperty();
+                SOPRANO_EXPORT Soprano::Node maxCardinality();
+                SOPRANO_EXPORT Soprano::Node minCardinality();
+                SOPRANO_EXPORT Soprano::Node realizes();
+                SOPRANO_EXPORT Soprano::Node rule();
+                SOPRANO_EXPORT Soprano::Node ruleLanguage();
+                SOPRANO_EXPORT Soprano::Node semanticsDefinedBy();
+                SOPRANO_EXPORT Soprano::Node subGraphOf();
+                SOPRANO_EXPORT Soprano::Node superGraphOf();
+                SOPRANO_EXPORT Soprano::Node updatable();
+                SOPRANO_EXPORT Soprano::Node viewOn();
+            }
         }
     }
 }
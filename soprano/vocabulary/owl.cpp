@@ -19,306 +19,516 @@
  */
 
 #include "owl.h"
-#include <QThreadStorage>
+#include "node.h"
+
+namespace {
+    Soprano::Node createNode( const char* uri )
+    {
+        const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );
+#if QT_VERSION < 0x050000
+        // QUrl parses and normalizes on demand which is not thread-safe in Qt4.
+        // Trigger it now, before the constants are shared between threads.
+        url.isValid();
+        url.host();
+        (void)( url == QUrl( url ) );
+#endif
+        return Soprano::Node( url );
+    }
+}
 
 class OwlPrivate
 {
 public:
     OwlPrivate()
-        : owl_namespace( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#", QUrl::StrictMode ) ),
-          owl_AllDifferent( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#AllDifferent", QUrl::StrictMode ) ),
-          owl_AnnotationProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#AnnotationProperty", QUrl::StrictMode ) ),
-          owl_Class( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#Class", QUrl::StrictMode ) ),
-          owl_DataRange( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#DataRange", QUrl::StrictMode ) ),
-          owl_DatatypeProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#DatatypeProperty", QUrl::StrictMode ) ),
-          owl_DeprecatedClass( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#DeprecatedClass", QUrl::StrictMode ) ),
-          owl_DeprecatedProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#DeprecatedProperty", QUrl::StrictMode ) ),
-          owl_FunctionalProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#FunctionalProperty", QUrl::StrictMode ) ),
-          owl_InverseFunctionalProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#InverseFunctionalProperty", QUrl::StrictMode ) ),
-          owl_Nothing( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#Nothing", QUrl::StrictMode ) ),
-          owl_ObjectProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#ObjectProperty", QUrl::StrictMode ) ),
-          owl_Ontology( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#Ontology", QUrl::StrictMode ) ),
-          owl_OntologyProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#OntologyProperty", QUrl::StrictMode ) ),
-          owl_Restriction( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#Restriction", QUrl::StrictMode ) ),
-          owl_SymmetricProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#SymmetricProperty", QUrl::StrictMode ) ),
-          owl_Thing( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#Thing", QUrl::StrictMode ) ),
-          owl_TransitiveProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#TransitiveProperty", QUrl::StrictMode ) ),
-          owl_allValuesFrom( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#allValuesFrom", QUrl::StrictMode ) ),
-          owl_backwardCompatibleWith( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#backwardCompatibleWith", QUrl::StrictMode ) ),
-          owl_cardinality( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#cardinality", QUrl::StrictMode ) ),
-          owl_complementOf( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#complementOf", QUrl::StrictMode ) ),
-          owl_differentFrom( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#differentFrom", QUrl::StrictMode ) ),
-          owl_disjointWith( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#disjointWith", QUrl::StrictMode ) ),
-          owl_distinctMembers( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#distinctMembers", QUrl::StrictMode ) ),
-          owl_equivalentClass( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#equivalentClass", QUrl::StrictMode ) ),
-          owl_equivalentProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#equivalentProperty", QUrl::StrictMode ) ),
-          owl_hasValue( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#hasValue", QUrl::StrictMode ) ),
-          owl_imports( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#imports", QUrl::StrictMode ) ),
-          owl_incompatibleWith( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#incompatibleWith", QUrl::StrictMode ) ),
-          owl_intersectionOf( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#intersectionOf", QUrl::StrictMode ) ),
-          owl_inverseOf( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#inverseOf", QUrl::StrictMode ) ),
-          owl_maxCardinality( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#maxCardinality", QUrl::StrictMode ) ),
-          owl_minCardinality( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#minCardinality", QUrl::StrictMode ) ),
-          owl_onProperty( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#onProperty", QUrl::StrictMode ) ),
-          owl_oneOf( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#oneOf", QUrl::StrictMode ) ),
-          owl_priorVersion( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#priorVersion", QUrl::StrictMode ) ),
-          owl_sameAs( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#sameAs", QUrl::StrictMode ) ),
-          owl_someValuesFrom( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#someValuesFrom", QUrl::StrictMode ) ),
-          owl_unionOf( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#unionOf", QUrl::StrictMode ) ),
-          owl_versionInfo( QUrl::fromEncoded( "http://www.w3.org/2002/07/owl#versionInfo", QUrl::StrictMode ) ) {
+        : owl_namespace( createNode( "http://www.w3.org/2002/07/owl#" ) ),
+          owl_AllDifferent( createNode( "http://www.w3.org/2002/07/owl#AllDifferent" ) ),
+          owl_AnnotationProperty( createNode( "http://www.w3.org/2002/07/owl#AnnotationProperty" ) ),
+          owl_Class( createNode( "http://www.w3.org/2002/07/owl#Class" ) ),
+          owl_DataRange( createNode( "http://www.w3.org/2002/07/owl#DataRange" ) ),
+          owl_DatatypeProperty( createNode( "http://www.w3.org/2002/07/owl#DatatypeProperty" ) ),
+          owl_DeprecatedClass( createNode( "http://www.w3.org/2002/07/owl#DeprecatedClass" ) ),
+          owl_DeprecatedProperty( createNode( "http://www.w3.org/2002/07/owl#DeprecatedProperty" ) ),
+          owl_FunctionalProperty( createNode( "http://www.w3.org/2002/07/owl#FunctionalProperty" ) ),
+          owl_InverseFunctionalProperty( createNode( "http://www.w3.org/2002/07/owl#InverseFunctionalProperty" ) ),
+          owl_Nothing( createNode( "http://www.w3.org/2002/07/owl#Nothing" ) ),
+          owl_ObjectProperty( createNode( "http://www.w3.org/2002/07/owl#ObjectProperty" ) ),
+          owl_Ontology( createNode( "http://www.w3.org/2002/07/owl#Ontology" ) ),
+          owl_OntologyProperty( createNode( "http://www.w3.org/2002/07/owl#OntologyProperty" ) ),
+          owl_Restriction( createNode( "http://www.w3.org/2002/07/owl#Restriction" ) ),
+          owl_SymmetricProperty( createNode( "http://www.w3.org/2002/07/owl#SymmetricProperty" ) ),
+          owl_Thing( createNode( "http://www.w3.org/2002/07/owl#Thing" ) ),
+          owl_TransitiveProperty( createNode( "http://www.w3.org/2002/07/owl#TransitiveProperty" ) ),
+          owl_allValuesFrom( createNode( "http://www.w3.org/2002/07/owl#allValuesFrom" ) ),
+          owl_backwardCompatibleWith( createNode( "http://www.w3.org/2002/07/owl#backwardCompatibleWith" ) ),
+          owl_cardinality( createNode( "http://www.w3.org/2002/07/owl#cardinality" ) ),
+          owl_complementOf( createNode( "http://www.w3.org/2002/07/owl#complementOf" ) ),
+          owl_differentFrom( createNode( "http://www.w3.org/2002/07/owl#differentFrom" ) ),
+          owl_disjointWith( createNode( "http://www.w3.org/2002/07/owl#disjointWith" ) ),
+          owl_distinctMembers( createNode( "http://www.w3.org/2002/07/owl#distinctMembers" ) ),
+          owl_equivalentClass( createNode( "http://www.w3.org/2002/07/owl#equivalentClass" ) ),
+          owl_equivalentProperty( createNode( "http://www.w3.org/2002/07/owl#equivalentProperty" ) ),
+          owl_hasValue( createNode( "http://www.w3.org/2002/07/owl#hasValue" ) ),
+          owl_imports( createNode( "http://www.w3.org/2002/07/owl#imports" ) ),
+          owl_incompatibleWith( createNode( "http://www.w3.org/2002/07/owl#incompatibleWith" ) ),
+          owl_intersectionOf( createNode( "http://www.w3.org/2002/07/owl#intersectionOf" ) ),
+          owl_inverseOf( createNode( "http://www.w3.org/2002/07/owl#inverseOf" ) ),
+          owl_maxCardinality( createNode( "http://www.w3.org/2002/07/owl#maxCardinality" ) ),
+          owl_minCardinality( createNode( "http://www.w3.org/2002/07/owl#minCardinality" ) ),
+          owl_onProperty( createNode( "http://www.w3.org/2002/07/owl#onProperty" ) ),
+          owl_oneOf( createNode( "http://www.w3.org/2002/07/owl#oneOf" ) ),
+          owl_priorVersion( createNode( "http://www.w3.org/2002/07/owl#priorVersion" ) ),
+          owl_sameAs( createNode( "http://www.w3.org/2002/07/owl#sameAs" ) ),
+          owl_someValuesFrom( createNode( "http://www.w3.org/2002/07/owl#someValuesFrom" ) ),
+          owl_unionOf( createNode( "http://www.w3.org/2002/07/owl#unionOf" ) ),
+          owl_versionInfo( createNode( "http://www.w3.org/2002/07/owl#versionInfo" ) ) {
     }
 
-    QUrl owl_namespace;
-    QUrl owl_AllDifferent;
-    QUrl owl_AnnotationProperty;
-    QUrl owl_Class;
-    QUrl owl_DataRange;
-    QUrl owl_DatatypeProperty;
-    QUrl owl_DeprecatedClass;
-    QUrl owl_DeprecatedProperty;
-    QUrl owl_FunctionalProperty;
-    QUrl owl_InverseFunctionalProperty;
-    QUrl owl_Nothing;
-    QUrl owl_ObjectProperty;
-    QUrl owl_Ontology;
-    QUrl owl_OntologyProperty;
-    QUrl owl_Restriction;
-    QUrl owl_SymmetricProperty;
-    QUrl owl_Thing;
-    QUrl owl_TransitiveProperty;
-    QUrl owl_allValuesFrom;
-    QUrl owl_backwardCompatibleWith;
-    QUrl owl_cardinality;
-    QUrl owl_complementOf;
-    QUrl owl_differentFrom;
-    QUrl owl_disjointWith;
-    QUrl owl_distinctMembers;
-    QUrl owl_equivalentClass;
-    QUrl owl_equivalentProperty;
-    QUrl owl_hasValue;
-    QUrl owl_imports;
-    QUrl owl_incompatibleWith;
-    QUrl owl_intersectionOf;
-    QUrl owl_inverseOf;
-    QUrl owl_maxCardinality;
-    QUrl owl_minCardinality;
-    QUrl owl_onProperty;
-    QUrl owl_oneOf;
-    QUrl owl_priorVersion;
-    QUrl owl_sameAs;
-    QUrl owl_someValuesFrom;
-    QUrl owl_unionOf;
-    QUrl owl_versionInfo;
+    Soprano::Node owl_namespace;
+    Soprano::Node owl_AllDifferent;
+    Soprano::Node owl_AnnotationProperty;
+    Soprano::Node owl_Class;
+    Soprano::Node owl_DataRange;
+    Soprano::Node owl_DatatypeProperty;
+    Soprano::Node owl_DeprecatedClass;
+    Soprano::Node owl_DeprecatedProperty;
+    Soprano::Node owl_FunctionalProperty;
+    Soprano::Node owl_InverseFunctionalProperty;
+    Soprano::Node owl_Nothing;
+    Soprano::Node owl_ObjectProperty;
+    Soprano::Node owl_Ontology;
+    Soprano::Node owl_OntologyProperty;
+    Soprano::Node owl_Restriction;
+    Soprano::Node owl_SymmetricProperty;
+    Soprano::Node owl_Thing;
+    Soprano::Node owl_TransitiveProperty;
+    Soprano::Node owl_allValuesFrom;
+    Soprano::Node owl_backwardCompatibleWith;
+    Soprano::Node owl_cardinality;
+    Soprano::Node owl_complementOf;
+    Soprano::Node owl_differentFrom;
+    Soprano::Node owl_disjointWith;
+    Soprano::Node owl_distinctMembers;
+    Soprano::Node owl_equivalentClass;
+    Soprano::Node owl_equivalentProperty;
+    Soprano::Node owl_hasValue;
+    Soprano::Node owl_imports;
+    Soprano::Node owl_incompatibleWith;
+    Soprano::Node owl_intersectionOf;
+    Soprano::Node owl_inverseOf;
+    Soprano::Node owl_maxCardinality;
+    Soprano::Node owl_minCardinality;
+    Soprano::Node owl_onProperty;
+    Soprano::Node owl_oneOf;
+    Soprano::Node owl_priorVersion;
+    Soprano::Node owl_sameAs;
+    Soprano::Node owl_someValuesFrom;
+    Soprano::Node owl_unionOf;
+    Soprano::Node owl_versionInfo;
 };
 
-QThreadStorage<OwlPrivate*> qts_owl;
-OwlPrivate* s_owl() {
-    if( !qts_owl.hasLocalData() )
-        qts_owl.setLocalData( new OwlPrivate );
-    return qts_owl.localData();
-}
+Q_GLOBAL_STATIC( OwlPrivate, s_owl )
 
 QUrl Soprano::Vocabulary::OWL::owlNamespace()
 {
-    return s_owl()->owl_namespace;
+    return s_owl()->owl_namespace.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::AllDifferent()
 {
-    return s_owl()->owl_AllDifferent;
+    return s_owl()->owl_AllDifferent.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::AnnotationProperty()
 {
-    return s_owl()->owl_AnnotationProperty;
+    return s_owl()->owl_AnnotationProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::Class()
 {
-    return s_owl()->owl_Class;
+    return s_owl()->owl_Class.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::DataRange()
 {
-    return s_owl()->owl_DataRange;
+    return s_owl()->owl_DataRange.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::DatatypeProperty()
 {
-    return s_owl()->owl_DatatypeProperty;
+    return s_owl()->owl_DatatypeProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::DeprecatedClass()
 {
-    return s_owl()->owl_DeprecatedClass;
+    return s_owl()->owl_DeprecatedClass.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::DeprecatedProperty()
 {
-    return s_owl()->owl_DeprecatedProperty;
+    return s_owl()->owl_DeprecatedProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::FunctionalProperty()
 {
-    return s_owl()->owl_FunctionalProperty;
+    return s_owl()->owl_FunctionalProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::InverseFunctionalProperty()
 {
-    return s_owl()->owl_InverseFunctionalProperty;
+    return s_owl()->owl_InverseFunctionalProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::Nothing()
 {
-    return s_owl()->owl_Nothing;
+    return s_owl()->owl_Nothing.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::ObjectProperty()
 {
-    return s_owl()->owl_ObjectProperty;
+    return s_owl()->owl_ObjectProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::Ontology()
 {
-    return s_owl()->owl_Ontology;
+    return s_owl()->owl_Ontology.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::OntologyProperty()
 {
-    return s_owl()->owl_OntologyProperty;
+    return s_owl()->owl_OntologyProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::Restriction()
 {
-    return s_owl()->owl_Restriction;
+    return s_owl()->owl_Restriction.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::SymmetricProperty()
 {
-    return s_owl()->owl_SymmetricProperty;
+    return s_owl()->owl_SymmetricProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::Thing()
 {
-    return s_owl()->owl_Thing;
+    return s_owl()->owl_Thing.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::TransitiveProperty()
 {
-    return s_owl()->owl_TransitiveProperty;
+    return s_owl()->owl_TransitiveProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::allValuesFrom()
 {
-    return s_owl()->owl_allValuesFrom;
+    return s_owl()->owl_allValuesFrom.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::backwardCompatibleWith()
 {
-    return s_owl()->owl_backwardCompatibleWith;
+    return s_owl()->owl_backwardCompatibleWith.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::cardinality()
 {
-    return s_owl()->owl_cardinality;
+    return s_owl()->owl_cardinality.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::complementOf()
 {
-    return s_owl()->owl_complementOf;
+    return s_owl()->owl_complementOf.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::differentFrom()
 {
-    return s_owl()->owl_differentFrom;
+    return s_owl()->owl_differentFrom.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::disjointWith()
 {
-    return s_owl()->owl_disjointWith;
+    return s_owl()->owl_disjointWith.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::distinctMembers()
 {
-    return s_owl()->owl_distinctMembers;
+    return s_owl()->owl_distinctMembers.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::equivalentClass()
 {
-    return s_owl()->owl_equivalentClass;
+    return s_owl()->owl_equivalentClass.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::equivalentProperty()
 {
-    return s_owl()->owl_equivalentProperty;
+    return s_owl()->owl_equivalentProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::hasValue()
 {
-    return s_owl()->owl_hasValue;
+    return s_owl()->owl_hasValue.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::imports()
 {
-    return s_owl()->owl_imports;
+    return s_owl()->owl_imports.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::incompatibleWith()
 {
-    return s_owl()->owl_incompatibleWith;
+    return s_owl()->owl_incompatibleWith.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::intersectionOf()
 {
-    return s_owl()->owl_intersectionOf;
+    return s_owl()->owl_intersectionOf.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::inverseOf()
 {
-    return s_owl()->owl_inverseOf;
+    return s_owl()->owl_inverseOf.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::maxCardinality()
 {
-    return s_owl()->owl_maxCardinality;
+    return s_owl()->owl_maxCardinality.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::minCardinality()
 {
-    return s_owl()->owl_minCardinality;
+    return s_owl()->owl_minCardinality.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::onProperty()
 {
-    return s_owl()->owl_onProperty;
+    return s_owl()->owl_onProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::oneOf()
 {
-    return s_owl()->owl_oneOf;
+    return s_owl()->owl_oneOf.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::priorVersion()
 {
-    return s_owl()->owl_priorVersion;
+    return s_owl()->owl_priorVersion.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::sameAs()
 {
-    return s_owl()->owl_sameAs;
+    return s_owl()->owl_sameAs.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::someValuesFrom()
 {
-    return s_owl()->owl_someValuesFrom;
+    return s_owl()->owl_someValuesFrom.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::unionOf()
 {
-    return s_owl()->owl_unionOf;
+    return s_owl()->owl_unionOf.uri();
 }
 
 QUrl Soprano::Vocabulary::OWL::versionInfo()
+{
+    return s_owl()->owl_versionInfo.uri();
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::AllDifferent()
+{
+    return s_owl()->owl_AllDifferent;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::AnnotationProperty()
+{
+    return s_owl()->owl_AnnotationProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::Class()
+{
+    return s_owl()->owl_Class;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::DataRange()
+{
+    return s_owl()->owl_DataRange;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::DatatypeProperty()
+{
+    return s_owl()->owl_DatatypeProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::DeprecatedClass()
+{
+    return s_owl()->owl_DeprecatedClass;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::DeprecatedProperty()
+{
+    return s_owl()->owl_DeprecatedProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::FunctionalProperty()
+{
+    return s_owl()->owl_FunctionalProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::InverseFunctionalProperty()
+{
+    return s_owl()->owl_InverseFunctionalProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::Nothing()
+{
+    return s_owl()->owl_Nothing;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::ObjectProperty()
+{
+    return s_owl()->owl_ObjectProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::Ontology()
+{
+    return s_owl()->owl_Ontology;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::OntologyProperty()
+{
+    return s_owl()->owl_OntologyProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::Restriction()
+{
+    return s_owl()->owl_Restriction;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::SymmetricProperty()
+{
+    return s_owl()->owl_SymmetricProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::Thing()
+{
+    return s_owl()->owl_Thing;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::TransitiveProperty()
+{
+    return s_owl()->owl_TransitiveProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::allValuesFrom()
+{
+    return s_owl()->owl_allValuesFrom;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::backwardCompatibleWith()
+{
+    return s_owl()->owl_backwardCompatibleWith;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::cardinality()
+{
+    return s_owl()->owl_cardinality;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::complementOf()
+{
+    return s_owl()->owl_complementOf;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::differentFrom()
+{
+    return s_owl()->owl_differentFrom;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::disjointWith()
+{
+    return s_owl()->owl_disjointWith;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::distinctMembers()
+{
+    return s_owl()->owl_distinctMembers;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::equivalentClass()
+{
+    return s_owl()->owl_equivalentClass;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::equivalentProperty()
+{
+    return s_owl()->owl_equivalentProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::hasValue()
+{
+    return s_owl()->owl_hasValue;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::imports()
+{
+    return s_owl()->owl_imports;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::incompatibleWith()
+{
+    return s_owl()->owl_incompatibleWith;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::intersectionOf()
+{
+    return s_owl()->owl_intersectionOf;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::inverseOf()
+{
+    return s_owl()->owl_inverseOf;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::maxCardinality()
+{
+    return s_owl()->owl_maxCardinality;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::minCardinality()
+{
+    return s_owl()->owl_minCardinality;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::onProperty()
+{
+    return s_owl()->owl_onProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::oneOf()
+{
+    return s_owl()->owl_oneOf;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::priorVersion()
+{
+    return s_owl()->owl_priorVersion;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::sameAs()
+{
+    return s_owl()->owl_sameAs;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::someValuesFrom()
+{
+    return s_owl()->owl_someValuesFrom;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::unionOf()
+{
+    return s_owl()->owl_unionOf;
+}
+
+Soprano::Node Soprano::Vocabulary::OWL::Nodes::versionInfo()
 {
     return s_owl()->owl_versionInfo;
 }
@@ -25,6 +25,8 @@
 #include "soprano_export.h"
 
 namespace Soprano {
+    class Node;
+
     namespace Vocabulary {
         namespace OWL {
             /**
@@ -231,6 +233,56 @@ namespace Soprano {
              * http://www.w3.org/2002/07/owl#versionInfo 
              */
             SOPRANO_EXPORT QUrl versionInfo();
+
+            /**
+             * The terms of this vocabulary as pre-built nodes. They are created once per
+             * process and can be used in place of Soprano::Node( QUrl ) to avoid
+             * constructing a new node on every use.
+             *
+             * \since 2.10
+             */
+            namespace Nodes {
+                SOPRANO_EXPORT Soprano::Node AllDifferent();
+                SOPRANO_EXPORT Soprano::Node AnnotationProperty();
+                SOPRANO_EXPORT Soprano::Node Class();
+                SOPRANO_EXPORT Soprano::Node DataRange();
+                SOPRANO_EXPORT Soprano::Node DatatypeProperty();
+                SOPRANO_EXPORT Soprano::Node DeprecatedClass();
+                SOPRANO_EXPORT Soprano::Node DeprecatedProperty();
+                SOPRANO_EXPORT Soprano::Node FunctionalProperty();
+                SOPRANO_EXPORT Soprano::Node InverseFunctionalProperty();
+                SOPRANO_EXPORT Soprano::Node Nothing();
+                SOPRANO_EXPORT Soprano::Node ObjectProperty();
+                SOPRANO_EXPORT Soprano::Node Ontology();
+                SOPRANO_EXPORT Soprano::Node OntologyProperty();
+                SOPRANO_EXPORT Soprano::Node Restriction();
+                SOPRANO_EXPORT Soprano::Node SymmetricProperty();
+                SOPRANO_EXPORT Soprano::Node Thing();
+                SOPRANO_EXPORT Soprano::Node TransitiveProperty();
+                SOPRANO_EXPORT Soprano::Node allValuesFrom();
+                SOPRANO_EXPORT Soprano::Node backwardCompatibleWith();
+                SOPRANO_EXPORT Soprano::Node cardinality();
+                SOPRANO_EXPORT Soprano::Node complementOf();
+                SOPRANO_EXPORT Soprano::Node differentFrom();
+                SOPRANO_EXPORT Soprano::Node disjointWith();
+                SOPRANO_EXPORT Soprano::Node distinctMembers();
+                SOPRANO_EXPORT Soprano::Node equivalentClass();
+                SOPRANO_EXPORT Soprano::Node equivalentProperty();
+                SOPRANO_EXPORT Soprano::Node hasValue();
+                SOPRANO_EXPORT Soprano::Node imports();
+                SOPRANO_EXPORT Soprano::Node incompatibleWith();
+                SOPRANO_EXPORT Soprano::Node intersectionOf();
+                SOPRANO_EXPORT Soprano::Node inverseOf();
+                SOPRANO_EXPORT Soprano::Node maxCardinality();
+                SOPRANO_EXPORT Soprano::Node minCardinality();
+                SOPRANO_EXPORT Soprano::Node onProperty();
+                SOPRANO_EXPORT Soprano::Node oneOf();
+                SOPRANO_EXPORT Soprano::Node priorVersion();
+                SOPRANO_EXPORT Soprano::Node sameAs();
+                SOPRANO_EXPORT Soprano::Node someValuesFrom();
+                SOPRANO_EXPORT Soprano::Node unionOf();
+                SOPRANO_EXPORT Soprano::Node versionInfo();
+            }
         }
     }
 }
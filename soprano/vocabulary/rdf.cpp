@@ -19,131 +19,216 @@
  */
 
 #include "rdf.h"
-#include <QThreadStorage>
+#include "node.h"
+
+namespace {
+    Soprano::Node createNode( const char* uri )
+    {
+        const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );
+#if QT_VERSION < 0x050000
+        // QUrl parses and normalizes on demand which is not thread-safe in Qt4.
+        // Trigger it now, before the constants are shared between threads.
+        url.isValid();
+        url.host();
+        (void)( url == QUrl( url ) );
+#endif
+        return Soprano::Node( url );
+    }
+}
 
 class RdfPrivate
 {
 public:
     RdfPrivate()
-        : rdf_namespace( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#", QUrl::StrictMode ) ),
-          rdf_Alt( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Alt", QUrl::StrictMode ) ),
-          rdf_Bag( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Bag", QUrl::StrictMode ) ),
-          rdf_List( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#List", QUrl::StrictMode ) ),
-          rdf_Property( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Property", QUrl::StrictMode ) ),
-          rdf_Seq( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Seq", QUrl::StrictMode ) ),
-          rdf_Statement( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Statement", QUrl::StrictMode ) ),
-          rdf_XMLLiteral( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#XMLLiteral", QUrl::StrictMode ) ),
-          rdf_first( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#first", QUrl::StrictMode ) ),
-          rdf_nil( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#nil", QUrl::StrictMode ) ),
-          rdf_object( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#object", QUrl::StrictMode ) ),
-          rdf_predicate( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#predicate", QUrl::StrictMode ) ),
-          rdf_rest( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#rest", QUrl::StrictMode ) ),
-          rdf_subject( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#subject", QUrl::StrictMode ) ),
-          rdf_type( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#type", QUrl::StrictMode ) ),
-          rdf_value( QUrl::fromEncoded( "http://www.w3.org/1999/02/22-rdf-syntax-ns#value", QUrl::StrictMode ) ) {
+        : rdf_namespace( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#" ) ),
+          rdf_Alt( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Alt" ) ),
+          rdf_Bag( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Bag" ) ),
+          rdf_List( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#List" ) ),
+          rdf_Property( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Property" ) ),
+          rdf_Seq( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Seq" ) ),
+          rdf_Statement( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#Statement" ) ),
+          rdf_XMLLiteral( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#XMLLiteral" ) ),
+          rdf_first( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#first" ) ),
+          rdf_nil( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#nil" ) ),
+          rdf_object( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#object" ) ),
+          rdf_predicate( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#predicate" ) ),
+          rdf_rest( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#rest" ) ),
+          rdf_subject( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#subject" ) ),
+          rdf_type( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#type" ) ),
+          rdf_value( createNode( "http://www.w3.org/1999/02/22-rdf-syntax-ns#value" ) ) {
     }
 
-    QUrl rdf_namespace;
-    QUrl rdf_Alt;
-    QUrl rdf_Bag;
-    QUrl rdf_List;
-    QUrl rdf_Property;
-    QUrl rdf_Seq;
-    QUrl rdf_Statement;
-    QUrl rdf_XMLLiteral;
-    QUrl rdf_first;
-    QUrl rdf_nil;
-    QUrl rdf_object;
-    QUrl rdf_predicate;
-    QUrl rdf_rest;
-    QUrl rdf_subject;
-    QUrl rdf_type;
-    QUrl rdf_value;
+    Soprano::Node rdf_namespace;
+    Soprano::Node rdf_Alt;
+    Soprano::Node rdf_Bag;
+    Soprano::Node rdf_List;
+    Soprano::Node rdf_Property;
+    Soprano::Node rdf_Seq;
+    Soprano::Node rdf_Statement;
+    Soprano::Node rdf_XMLLiteral;
+    Soprano::Node rdf_first;
+    Soprano::Node rdf_nil;
+    Soprano::Node rdf_object;
+    Soprano::Node rdf_predicate;
+    Soprano::Node rdf_rest;
+    Soprano::Node rdf_subject;
+    Soprano::Node rdf_type;
+    Soprano::Node rdf_value;
 };
 
-QThreadStorage<RdfPrivate*> qts_rdf;
-RdfPrivate* s_rdf() {
-    if( !qts_rdf.hasLocalData() )
-        qts_rdf.setLocalData( new RdfPrivate );
-    return qts_rdf.localData();
-}
+Q_GLOBAL_STATIC( RdfPrivate, s_rdf )
 
 QUrl Soprano::Vocabulary::RDF::rdfNamespace()
 {
-    return s_rdf()->rdf_namespace;
+    return s_rdf()->rdf_namespace.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::Alt()
 {
-    return s_rdf()->rdf_Alt;
+    return s_rdf()->rdf_Alt.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::Bag()
 {
-    return s_rdf()->rdf_Bag;
+    return s_rdf()->rdf_Bag.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::List()
 {
-    return s_rdf()->rdf_List;
+    return s_rdf()->rdf_List.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::Property()
 {
-    return s_rdf()->rdf_Property;
+    return s_rdf()->rdf_Property.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::Seq()
 {
-    return s_rdf()->rdf_Seq;
+    return s_rdf()->rdf_Seq.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::Statement()
 {
-    return s_rdf()->rdf_Statement;
+    return s_rdf()->rdf_Statement.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::XMLLiteral()
 {
-    return s_rdf()->rdf_XMLLiteral;
+    return s_rdf()->rdf_XMLLiteral.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::first()
 {
-    return s_rdf()->rdf_first;
+    return s_rdf()->rdf_first.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::nil()
 {
-    return s_rdf()->rdf_nil;
+    return s_rdf()->rdf_nil.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::object()
 {
-    return s_rdf()->rdf_object;
+    return s_rdf()->rdf_object.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::predicate()
 {
-    return s_rdf()->rdf_predicate;
+    return s_rdf()->rdf_predicate.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::rest()
 {
-    return s_rdf()->rdf_rest;
+    return s_rdf()->rdf_rest.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::subject()
 {
-    return s_rdf()->rdf_subject;
+    return s_rdf()->rdf_subject.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::type()
 {
-    return s_rdf()->rdf_type;
+    return s_rdf()->rdf_type.uri();
 }
 
 QUrl Soprano::Vocabulary::RDF::value()
+{
+    return s_rdf()->rdf_value.uri();
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::Alt()
+{
+    return s_rdf()->rdf_Alt;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::Bag()
+{
+    return s_rdf()->rdf_Bag;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::List()
+{
+    return s_rdf()->rdf_List;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::Property()
+{
+    return s_rdf()->rdf_Property;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::Seq()
+{
+    return s_rdf()->rdf_Seq;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::Statement()
+{
+    return s_rdf()->rdf_Statement;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::XMLLiteral()
+{
+    return s_rdf()->rdf_XMLLiteral;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::first()
+{
+    return s_rdf()->rdf_first;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::nil()
+{
+    return s_rdf()->rdf_nil;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::object()
+{
+    return s_rdf()->rdf_object;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::predicate()
+{
+    return s_rdf()->rdf_predicate;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::rest()
+{
+    return s_rdf()->rdf_rest;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::subject()
+{
+    return s_rdf()->rdf_subject;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::type()
+{
+    return s_rdf()->rdf_type;
+}
+
+Soprano::Node Soprano::Vocabulary::RDF::Nodes::value()
 {
     return s_rdf()->rdf_value;
 }
@@ -25,6 +25,8 @@
 #include "soprano_export.h"
 
 namespace Soprano {
+    class Node;
+
     namespace Vocabulary {
         namespace RDF {
             /**
@@ -137,6 +139,31 @@ namespace Soprano {
              * Idiomatic property used for structured values. 
              */
             SOPRANO_EXPORT QUrl value();
+
+            /**
+             * The terms of this vocabulary as pre-built nodes. They are created once per
+             * process and can be used in place of Soprano::Node( QUrl ) to avoid
+             * constructing a new node on every use.
+             *
+             * \since 2.10
+             */
+            namespace Nodes {
+                SOPRANO_EXPORT Soprano::Node Alt();
+                SOPRANO_EXPORT Soprano::Node Bag();
+                SOPRANO_EXPORT Soprano::Node List();
+                SOPRANO_EXPORT Soprano::Node Property();
+                SOPRANO_EXPORT Soprano::Node Seq();
+                SOPRANO_EXPORT Soprano::Node Statement();
+                SOPRANO_EXPORT Soprano::Node XMLLiteral();
+                SOPRANO_EXPORT Soprano::Node first();
+                SOPRANO_EXPORT Soprano::Node nil();
+                SOPRANO_EXPORT Soprano::Node object();
+                SOPRANO_EXPORT Soprano::Node predicate();
+                SOPRANO_EXPORT Soprano::Node rest();
+                SOPRANO_EXPORT Soprano::Node subject();
+                SOPRANO_EXPORT Soprano::Node type();
+                SOPRANO_EXPORT Soprano::Node value();
+            }
         }
     }
 }
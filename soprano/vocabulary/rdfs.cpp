@@ -19,131 +19,216 @@
  */
 
 #include "rdfs.h"
-#include <QThreadStorage>
+#include "node.h"
+
+namespace {
+    Soprano::Node createNode( const char* uri )
+    {
+        const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );
+#if QT_VERSION < 0x050000
+        // QUrl parses and normalizes on demand which is not thread-safe in Qt4.
+        // Trigger it now, before the constants are shared between threads.
+        url.isValid();
+        url.host();
+        (void)( url == QUrl( url ) );
+#endif
+        return Soprano::Node( url );
+    }
+}
 
 class RdfsPrivate
 {
 public:
     RdfsPrivate()
-        : rdfs_namespace( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#", QUrl::StrictMode ) ),
-          rdfs_Class( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#Class", QUrl::StrictMode ) ),
-          rdfs_Container( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#Container", QUrl::StrictMode ) ),
-          rdfs_ContainerMembershipProperty( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#ContainerMembershipProperty", QUrl::StrictMode ) ),
-          rdfs_Datatype( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#Datatype", QUrl::StrictMode ) ),
-          rdfs_Literal( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#Literal", QUrl::StrictMode ) ),
-          rdfs_Resource( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#Resource", QUrl::StrictMode ) ),
-          rdfs_comment( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#comment", QUrl::StrictMode ) ),
-          rdfs_domain( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#domain", QUrl::StrictMode ) ),
-          rdfs_isDefinedBy( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#isDefinedBy", QUrl::StrictMode ) ),
-          rdfs_label( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#label", QUrl::StrictMode ) ),
-          rdfs_member( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#member", QUrl::StrictMode ) ),
-          rdfs_range( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#range", QUrl::StrictMode ) ),
-          rdfs_seeAlso( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#seeAlso", QUrl::StrictMode ) ),
-          rdfs_subClassOf( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#subClassOf", QUrl::StrictMode ) ),
-          rdfs_subPropertyOf( QUrl::fromEncoded( "http://www.w3.org/2000/01/rdf-schema#subPropertyOf", QUrl::StrictMode ) ) {
+        : rdfs_namespace( createNode( "http://www.w3.org/2000/01/rdf-schema#" ) ),
+          rdfs_Class( createNode( "http://www.w3.org/2000/01/rdf-schema#Class" ) ),
+          rdfs_Container( createNode( "http://www.w3.org/2000/01/rdf-schema#Container" ) ),
+          rdfs_ContainerMembershipProperty( createNode( "http://www.w3.org/2000/01/rdf-schema#ContainerMembershipProperty" ) ),
+          rdfs_Datatype( createNode( "http://www.w3.org/2000/01/rdf-schema#Datatype" ) ),
+          rdfs_Literal( createNode( "http://www.w3.org/2000/01/rdf-schema#Literal" ) ),
+          rdfs_Resource( createNode( "http://www.w3.org/2000/01/rdf-schema#Resource" ) ),
+          rdfs_comment( createNode( "http://www.w3.org/2000/01/rdf-schema#comment" ) ),
+          rdfs_domain( createNode( "http://www.w3.org/2000/01/rdf-schema#domain" ) ),
+          rdfs_isDefinedBy( createNode( "http://www.w3.org/2000/01/rdf-schema#isDefinedBy" ) ),
+          rdfs_label( createNode( "http://www.w3.org/2000/01/rdf-schema#label" ) ),
+          rdfs_member( createNode( "http://www.w3.org/2000/01/rdf-schema#member" ) ),
+          rdfs_range( createNode( "http://www.w3.org/2000/01/rdf-schema#range" ) ),
+          rdfs_seeAlso( createNode( "http://www.w3.org/2000/01/rdf-schema#seeAlso" ) ),
+          rdfs_subClassOf( createNode( "http://www.w3.org/2000/01/rdf-schema#subClassOf" ) ),
+          rdfs_subPropertyOf( createNode( "http://www.w3.org/2000/01/rdf-schema#subPropertyOf" ) ) {
     }
 
-    QUrl rdfs_namespace;
-    QUrl rdfs_Class;
-    QUrl rdfs_Container;
-    QUrl rdfs_ContainerMembershipProperty;
-    QUrl rdfs_Datatype;
-    QUrl rdfs_Literal;
-    QUrl rdfs_Resource;
-    QUrl rdfs_comment;
-    QUrl rdfs_domain;
-    QUrl rdfs_isDefinedBy;
-    QUrl rdfs_label;
-    QUrl rdfs_member;
-    QUrl rdfs_range;
-    QUrl rdfs_seeAlso;
-    QUrl rdfs_subClassOf;
-    QUrl rdfs_subPropertyOf;
+    Soprano::Node rdfs_namespace;
+    Soprano::Node rdfs_Class;
+    Soprano::Node rdfs_Container;
+    Soprano::Node rdfs_ContainerMembershipProperty;
+    Soprano::Node rdfs_Datatype;
+    Soprano::Node rdfs_Literal;
+    Soprano::Node rdfs_Resource;
+    Soprano::Node rdfs_comment;
+    Soprano::Node rdfs_domain;
+    Soprano::Node rdfs_isDefinedBy;
+    Soprano::Node rdfs_label;
+    Soprano::Node rdfs_member;
+    Soprano::Node rdfs_range;
+    Soprano::Node rdfs_seeAlso;
+    Soprano::Node rdfs_subClassOf;
+    Soprano::Node rdfs_subPropertyOf;
 };
 
-QThreadStorage<RdfsPrivate*> qts_rdfs;
-RdfsPrivate* s_rdfs() {
-    if( !qts_rdfs.hasLocalData() )
-        qts_rdfs.setLocalData( new RdfsPrivate );
-    return qts_rdfs.localData();
-}
+Q_GLOBAL_STATIC( RdfsPrivate, s_rdfs )
 
 QUrl Soprano::Vocabulary::RDFS::rdfsNamespace()
 {
-    return s_rdfs()->rdfs_namespace;
+    return s_rdfs()->rdfs_namespace.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::Class()
 {
-    return s_rdfs()->rdfs_Class;
+    return s_rdfs()->rdfs_Class.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::Container()
 {
-    return s_rdfs()->rdfs_Container;
+    return s_rdfs()->rdfs_Container.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::ContainerMembershipProperty()
 {
-    return s_rdfs()->rdfs_ContainerMembershipProperty;
+    return s_rdfs()->rdfs_ContainerMembershipProperty.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::Datatype()
 {
-    return s_rdfs()->rdfs_Datatype;
+    return s_rdfs()->rdfs_Datatype.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::Literal()
 {
-    return s_rdfs()->rdfs_Literal;
+    return s_rdfs()->rdfs_Literal.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::Resource()
 {
-    return s_rdfs()->rdfs_Resource;
+    return s_rdfs()->rdfs_Resource.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::comment()
 {
-    return s_rdfs()->rdfs_comment;
+    return s_rdfs()->rdfs_comment.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::domain()
 {
-    return s_rdfs()->rdfs_domain;
+    return s_rdfs()->rdfs_domain.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::isDefinedBy()
 {
-    return s_rdfs()->rdfs_isDefinedBy;
+    return s_rdfs()->rdfs_isDefinedBy.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::label()
 {
-    return s_rdfs()->rdfs_label;
+    return s_rdfs()->rdfs_label.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::member()
 {
-    return s_rdfs()->rdfs_member;
+    return s_rdfs()->rdfs_member.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::range()
 {
-    return s_rdfs()->rdfs_range;
+    return s_rdfs()->rdfs_range.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::seeAlso()
 {
-    return s_rdfs()->rdfs_seeAlso;
+    return s_rdfs()->rdfs_seeAlso.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::subClassOf()
 {
-    return s_rdfs()->rdfs_subClassOf;
+    return s_rdfs()->rdfs_subClassOf.uri();
 }
 
 QUrl Soprano::Vocabulary::RDFS::subPropertyOf()
+{
+    return s_rdfs()->rdfs_subPropertyOf.uri();
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::Class()
+{
+    return s_rdfs()->rdfs_Class;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::Container()
+{
+    return s_rdfs()->rdfs_Container;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::ContainerMembershipProperty()
+{
+    return s_rdfs()->rdfs_ContainerMembershipProperty;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::Datatype()
+{
+    return s_rdfs()->rdfs_Datatype;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::Literal()
+{
+    return s_rdfs()->rdfs_Literal;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::Resource()
+{
+    return s_rdfs()->rdfs_Resource;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::comment()
+{
+    return s_rdfs()->rdfs_comment;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::domain()
+{
+    return s_rdfs()->rdfs_domain;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::isDefinedBy()
+{
+    return s_rdfs()->rdfs_isDefinedBy;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::label()
+{
+    return s_rdfs()->rdfs_label;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::member()
+{
+    return s_rdfs()->rdfs_member;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::range()
+{
+    return s_rdfs()->rdfs_range;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::seeAlso()
+{
+    return s_rdfs()->rdfs_seeAlso;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::subClassOf()
+{
+    return s_rdfs()->rdfs_subClassOf;
+}
+
+Soprano::Node Soprano::Vocabulary::RDFS::Nodes::subPropertyOf()
 {
     return s_rdfs()->rdfs_subPropertyOf;
 }
@@ -25,6 +25,8 @@
 #include "soprano_export.h"
 
 namespace Soprano {
+    class Node;
+
     namespace Vocabulary {
         namespace RDFS {
             /**
@@ -138,6 +140,31 @@ namespace Soprano {
              * The subject is a subproperty of a property. 
              */
             SOPRANO_EXPORT QUrl subPropertyOf();
+
+            /**
+             * The terms of this vocabulary as pre-built nodes. They are created once per
+             * process and can be used in place of Soprano::Node( QUrl ) to avoid
+             * constructing a new node on every use.
+             *
+             * \since 2.10
+             */
+            namespace Nodes {
+                SOPRANO_EXPORT Soprano::Node Class();
+                SOPRANO_EXPORT Soprano::Node Container();
+                SOPRANO_EXPORT Soprano::Node ContainerMembershipProperty();
+                SOPRANO_EXPORT Soprano::Node Datatype();
+                SOPRANO_EXPORT Soprano::Node Literal();
+                SOPRANO_EXPORT Soprano::Node Resource();
+                SOPRANO_EXPORT Soprano::Node comment();
+                SOPRANO_EXPORT Soprano::Node domain();
+                SOPRANO_EXPORT Soprano::Node isDefinedBy();
+                SOPRANO_EXPORT Soprano::Node label();
+                SOPRANO_EXPORT Soprano::Node member();
+                SOPRANO_EXPORT Soprano::Node range();
+                SOPRANO_EXPORT Soprano::Node seeAlso();
+                SOPRANO_EXPORT Soprano::Node subClassOf();
+                SOPRANO_EXPORT Soprano::Node subPropertyOf();
+            }
         }
     }
 }
@@ -19,1923 +19,3283 @@
  */
 
 #include "xesam.h"
-#include <QThreadStorage>
+#include "node.h"
+
+namespace {
+    Soprano::Node createNode( const char* uri )
+    {
+        const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );
+#if QT_VERSION < 0x050000
+        // QUrl parses and normalizes on demand which is not thread-safe in Qt4.
+        // Trigger it now, before the constants are shared between threads.
+        url.isValid();
+        url.host();
+        (void)( url == QUrl( url ) );
+#endif
+        return Soprano::Node( url );
+    }
+}
 
 class XesamPrivate
 {
 public:
     XesamPrivate()
-        : xesam_namespace( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#", QUrl::StrictMode ) ),
-          xesam_35mmEquivalent( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#35mmEquivalent", QUrl::StrictMode ) ),
-          xesam_Annotation( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Annotation", QUrl::StrictMode ) ),
-          xesam_Archive( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Archive", QUrl::StrictMode ) ),
-          xesam_ArchivedFile( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#ArchivedFile", QUrl::StrictMode ) ),
-          xesam_Audio( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Audio", QUrl::StrictMode ) ),
-          xesam_AudioList( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#AudioList", QUrl::StrictMode ) ),
-          xesam_BlockDevice( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#BlockDevice", QUrl::StrictMode ) ),
-          xesam_Bookmark( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Bookmark", QUrl::StrictMode ) ),
-          xesam_CommunicationChannel( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#CommunicationChannel", QUrl::StrictMode ) ),
-          xesam_Contact( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Contact", QUrl::StrictMode ) ),
-          xesam_ContactGroup( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#ContactGroup", QUrl::StrictMode ) ),
-          xesam_Content( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Content", QUrl::StrictMode ) ),
-          xesam_DataObject( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#DataObject", QUrl::StrictMode ) ),
-          xesam_DeletedFile( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#DeletedFile", QUrl::StrictMode ) ),
-          xesam_Document( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Document", QUrl::StrictMode ) ),
-          xesam_Documentation( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Documentation", QUrl::StrictMode ) ),
-          xesam_Email( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Email", QUrl::StrictMode ) ),
-          xesam_EmailAttachment( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#EmailAttachment", QUrl::StrictMode ) ),
-          xesam_EmbeddedObject( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#EmbeddedObject", QUrl::StrictMode ) ),
-          xesam_File( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#File", QUrl::StrictMode ) ),
-          xesam_FileSystem( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#FileSystem", QUrl::StrictMode ) ),
-          xesam_Filelike( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Filelike", QUrl::StrictMode ) ),
-          xesam_Folder( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Folder", QUrl::StrictMode ) ),
-          xesam_IMAP4Message( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#IMAP4Message", QUrl::StrictMode ) ),
-          xesam_IMMessage( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#IMMessage", QUrl::StrictMode ) ),
-          xesam_Image( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Image", QUrl::StrictMode ) ),
-          xesam_MailingList( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#MailingList", QUrl::StrictMode ) ),
-          xesam_MailingListEmail( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#MailingListEmail", QUrl::StrictMode ) ),
-          xesam_Media( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Media", QUrl::StrictMode ) ),
-          xesam_MediaList( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#MediaList", QUrl::StrictMode ) ),
-          xesam_Message( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Message", QUrl::StrictMode ) ),
-          xesam_MessageboxMessage( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#MessageboxMessage", QUrl::StrictMode ) ),
-          xesam_Music( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Music", QUrl::StrictMode ) ),
-          xesam_NewsGroup( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#NewsGroup", QUrl::StrictMode ) ),
-          xesam_NewsGroupEmail( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#NewsGroupEmail", QUrl::StrictMode ) ),
-          xesam_OfflineMedia( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#OfflineMedia", QUrl::StrictMode ) ),
-          xesam_Organization( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Organization", QUrl::StrictMode ) ),
-          xesam_POP3Message( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#POP3Message", QUrl::StrictMode ) ),
-          xesam_Person( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Person", QUrl::StrictMode ) ),
-          xesam_PersonalEmail( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#PersonalEmail", QUrl::StrictMode ) ),
-          xesam_Photo( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Photo", QUrl::StrictMode ) ),
-          xesam_Presentation( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Presentation", QUrl::StrictMode ) ),
-          xesam_Project( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Project", QUrl::StrictMode ) ),
-          xesam_RSSFeed( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#RSSFeed", QUrl::StrictMode ) ),
-          xesam_RSSMessage( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#RSSMessage", QUrl::StrictMode ) ),
-          xesam_RemoteFile( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#RemoteFile", QUrl::StrictMode ) ),
-          xesam_RemoteMessageboxMessage( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#RemoteMessageboxMessage", QUrl::StrictMode ) ),
-          xesam_RemoteResource( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#RemoteResource", QUrl::StrictMode ) ),
-          xesam_RevisionControlledFile( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#RevisionControlledFile", QUrl::StrictMode ) ),
-          xesam_RevisionControlledRepository( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#RevisionControlledRepository", QUrl::StrictMode ) ),
-          xesam_SoftwarePackage( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#SoftwarePackage", QUrl::StrictMode ) ),
-          xesam_Source( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Source", QUrl::StrictMode ) ),
-          xesam_SourceCode( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#SourceCode", QUrl::StrictMode ) ),
-          xesam_Spreadsheet( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Spreadsheet", QUrl::StrictMode ) ),
-          xesam_SystemResource( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#SystemResource", QUrl::StrictMode ) ),
-          xesam_Tag( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Tag", QUrl::StrictMode ) ),
-          xesam_Text( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Text", QUrl::StrictMode ) ),
-          xesam_TextDocument( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#TextDocument", QUrl::StrictMode ) ),
-          xesam_UncategorizedText( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#UncategorizedText", QUrl::StrictMode ) ),
-          xesam_Video( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Video", QUrl::StrictMode ) ),
-          xesam_Visual( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#Visual", QUrl::StrictMode ) ),
-          xesam_XML( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#XML", QUrl::StrictMode ) ),
-          xesam_acl( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#acl", QUrl::StrictMode ) ),
-          xesam_album( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#album", QUrl::StrictMode ) ),
-          xesam_albumArtist( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#albumArtist", QUrl::StrictMode ) ),
-          xesam_albumGain( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#albumGain", QUrl::StrictMode ) ),
-          xesam_albumPeakGain( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#albumPeakGain", QUrl::StrictMode ) ),
-          xesam_albumTrackCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#albumTrackCount", QUrl::StrictMode ) ),
-          xesam_aperture( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#aperture", QUrl::StrictMode ) ),
-          xesam_artist( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#artist", QUrl::StrictMode ) ),
-          xesam_asText( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#asText", QUrl::StrictMode ) ),
-          xesam_aspectRatio( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#aspectRatio", QUrl::StrictMode ) ),
-          xesam_attachmentEncoding( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#attachmentEncoding", QUrl::StrictMode ) ),
-          xesam_audioBPM( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioBPM", QUrl::StrictMode ) ),
-          xesam_audioBitrate( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioBitrate", QUrl::StrictMode ) ),
-          xesam_audioChannels( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioChannels", QUrl::StrictMode ) ),
-          xesam_audioCodec( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioCodec", QUrl::StrictMode ) ),
-          xesam_audioCodecType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioCodecType", QUrl::StrictMode ) ),
-          xesam_audioSampleBitDepth( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleBitDepth", QUrl::StrictMode ) ),
-          xesam_audioSampleCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleCount", QUrl::StrictMode ) ),
-          xesam_audioSampleDataType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleDataType", QUrl::StrictMode ) ),
-          xesam_audioSampleRate( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleRate", QUrl::StrictMode ) ),
-          xesam_author( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#author", QUrl::StrictMode ) ),
-          xesam_autoRating( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#autoRating", QUrl::StrictMode ) ),
-          xesam_baseRevisionID( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#baseRevisionID", QUrl::StrictMode ) ),
-          xesam_bcc( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#bcc", QUrl::StrictMode ) ),
-          xesam_birthDate( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#birthDate", QUrl::StrictMode ) ),
-          xesam_blogContactURL( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#blogContactURL", QUrl::StrictMode ) ),
-          xesam_cameraManufacturer( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#cameraManufacturer", QUrl::StrictMode ) ),
-          xesam_cameraModel( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#cameraModel", QUrl::StrictMode ) ),
-          xesam_cc( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#cc", QUrl::StrictMode ) ),
-          xesam_ccdWidth( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#ccdWidth", QUrl::StrictMode ) ),
-          xesam_cellPhoneNumber( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#cellPhoneNumber", QUrl::StrictMode ) ),
-          xesam_changeCommitTime( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#changeCommitTime", QUrl::StrictMode ) ),
-          xesam_changeCommitter( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#changeCommitter", QUrl::StrictMode ) ),
-          xesam_characterCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#characterCount", QUrl::StrictMode ) ),
-          xesam_charset( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#charset", QUrl::StrictMode ) ),
-          xesam_chatRoom( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#chatRoom", QUrl::StrictMode ) ),
-          xesam_colorCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#colorCount", QUrl::StrictMode ) ),
-          xesam_colorSpace( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#colorSpace", QUrl::StrictMode ) ),
-          xesam_columnCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#columnCount", QUrl::StrictMode ) ),
-          xesam_comment( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#comment", QUrl::StrictMode ) ),
-          xesam_commentCharacterCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#commentCharacterCount", QUrl::StrictMode ) ),
-          xesam_commitDiff( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#commitDiff", QUrl::StrictMode ) ),
-          xesam_communicationChannel( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#communicationChannel", QUrl::StrictMode ) ),
-          xesam_composer( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#composer", QUrl::StrictMode ) ),
-          xesam_compressionAlgorithm( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#compressionAlgorithm", QUrl::StrictMode ) ),
-          xesam_compressionLevel( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#compressionLevel", QUrl::StrictMode ) ),
-          xesam_conflicts( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#conflicts", QUrl::StrictMode ) ),
-          xesam_contactMedium( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contactMedium", QUrl::StrictMode ) ),
-          xesam_contactNick( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contactNick", QUrl::StrictMode ) ),
-          xesam_contactURL( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contactURL", QUrl::StrictMode ) ),
-          xesam_contains( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contains", QUrl::StrictMode ) ),
-          xesam_contentComment( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contentComment", QUrl::StrictMode ) ),
-          xesam_contentCreated( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contentCreated", QUrl::StrictMode ) ),
-          xesam_contentKeyword( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contentKeyword", QUrl::StrictMode ) ),
-          xesam_contentModified( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contentModified", QUrl::StrictMode ) ),
-          xesam_contentType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contentType", QUrl::StrictMode ) ),
-          xesam_contributor( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#contributor", QUrl::StrictMode ) ),
-          xesam_copyright( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#copyright", QUrl::StrictMode ) ),
-          xesam_creator( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#creator", QUrl::StrictMode ) ),
-          xesam_definesClass( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#definesClass", QUrl::StrictMode ) ),
-          xesam_definesFunction( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#definesFunction", QUrl::StrictMode ) ),
-          xesam_definesGlobalVariable( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#definesGlobalVariable", QUrl::StrictMode ) ),
-          xesam_deletionTime( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#deletionTime", QUrl::StrictMode ) ),
-          xesam_depends( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#depends", QUrl::StrictMode ) ),
-          xesam_derivedFrom( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#derivedFrom", QUrl::StrictMode ) ),
-          xesam_description( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#description", QUrl::StrictMode ) ),
-          xesam_discNumber( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#discNumber", QUrl::StrictMode ) ),
-          xesam_disclaimer( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#disclaimer", QUrl::StrictMode ) ),
-          xesam_documentCategory( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#documentCategory", QUrl::StrictMode ) ),
-          xesam_emailAddress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#emailAddress", QUrl::StrictMode ) ),
-          xesam_exposureBias( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#exposureBias", QUrl::StrictMode ) ),
-          xesam_exposureProgram( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#exposureProgram", QUrl::StrictMode ) ),
-          xesam_exposureTime( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#exposureTime", QUrl::StrictMode ) ),
-          xesam_familyName( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#familyName", QUrl::StrictMode ) ),
-          xesam_faxPhoneNumber( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#faxPhoneNumber", QUrl::StrictMode ) ),
-          xesam_fileExtension( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#fileExtension", QUrl::StrictMode ) ),
-          xesam_fileSystemType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#fileSystemType", QUrl::StrictMode ) ),
-          xesam_fingerprint( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#fingerprint", QUrl::StrictMode ) ),
-          xesam_firstUsed( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#firstUsed", QUrl::StrictMode ) ),
-          xesam_flashUsed( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#flashUsed", QUrl::StrictMode ) ),
-          xesam_focalLength( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#focalLength", QUrl::StrictMode ) ),
-          xesam_focusDistance( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#focusDistance", QUrl::StrictMode ) ),
-          xesam_formatSubtype( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#formatSubtype", QUrl::StrictMode ) ),
-          xesam_frameCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#frameCount", QUrl::StrictMode ) ),
-          xesam_frameRate( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#frameRate", QUrl::StrictMode ) ),
-          xesam_freeSpace( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#freeSpace", QUrl::StrictMode ) ),
-          xesam_gender( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#gender", QUrl::StrictMode ) ),
-          xesam_generator( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#generator", QUrl::StrictMode ) ),
-          xesam_generatorOptions( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#generatorOptions", QUrl::StrictMode ) ),
-          xesam_genre( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#genre", QUrl::StrictMode ) ),
-          xesam_givenName( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#givenName", QUrl::StrictMode ) ),
-          xesam_group( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#group", QUrl::StrictMode ) ),
-          xesam_height( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#height", QUrl::StrictMode ) ),
-          xesam_homeEmailAddress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#homeEmailAddress", QUrl::StrictMode ) ),
-          xesam_homePhoneNumber( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#homePhoneNumber", QUrl::StrictMode ) ),
-          xesam_homePostalAddress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#homePostalAddress", QUrl::StrictMode ) ),
-          xesam_homepageContactURL( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#homepageContactURL", QUrl::StrictMode ) ),
-          xesam_honorificPrefix( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#honorificPrefix", QUrl::StrictMode ) ),
-          xesam_honorificSuffix( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#honorificSuffix", QUrl::StrictMode ) ),
-          xesam_horizontalResolution( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#horizontalResolution", QUrl::StrictMode ) ),
-          xesam_id( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#id", QUrl::StrictMode ) ),
-          xesam_imContactMedium( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#imContactMedium", QUrl::StrictMode ) ),
-          xesam_inReplyTo( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#inReplyTo", QUrl::StrictMode ) ),
-          xesam_interest( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#interest", QUrl::StrictMode ) ),
-          xesam_interlaceMode( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#interlaceMode", QUrl::StrictMode ) ),
-          xesam_ircContactMedium( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#ircContactMedium", QUrl::StrictMode ) ),
-          xesam_isContentEncrypted( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isContentEncrypted", QUrl::StrictMode ) ),
-          xesam_isEncrypted( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isEncrypted", QUrl::StrictMode ) ),
-          xesam_isImportant( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isImportant", QUrl::StrictMode ) ),
-          xesam_isInProgress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isInProgress", QUrl::StrictMode ) ),
-          xesam_isPublicChannel( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isPublicChannel", QUrl::StrictMode ) ),
-          xesam_isRead( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isRead", QUrl::StrictMode ) ),
-          xesam_isSourceEncrypted( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isSourceEncrypted", QUrl::StrictMode ) ),
-          xesam_isoEquivalent( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#isoEquivalent", QUrl::StrictMode ) ),
-          xesam_jabberContactMedium( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#jabberContactMedium", QUrl::StrictMode ) ),
-          xesam_keyword( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#keyword", QUrl::StrictMode ) ),
-          xesam_knows( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#knows", QUrl::StrictMode ) ),
-          xesam_language( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#language", QUrl::StrictMode ) ),
-          xesam_lastRefreshed( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#lastRefreshed", QUrl::StrictMode ) ),
-          xesam_lastUsed( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#lastUsed", QUrl::StrictMode ) ),
-          xesam_legal( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#legal", QUrl::StrictMode ) ),
-          xesam_license( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#license", QUrl::StrictMode ) ),
-          xesam_licenseType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#licenseType", QUrl::StrictMode ) ),
-          xesam_lineCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#lineCount", QUrl::StrictMode ) ),
-          xesam_links( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#links", QUrl::StrictMode ) ),
-          xesam_localRevision( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#localRevision", QUrl::StrictMode ) ),
-          xesam_lyricist( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#lyricist", QUrl::StrictMode ) ),
-          xesam_mailingList( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mailingList", QUrl::StrictMode ) ),
-          xesam_mailingPostalAddress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mailingPostalAddress", QUrl::StrictMode ) ),
-          xesam_maintainer( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#maintainer", QUrl::StrictMode ) ),
-          xesam_markupCharacterCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#markupCharacterCount", QUrl::StrictMode ) ),
-          xesam_md5Hash( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#md5Hash", QUrl::StrictMode ) ),
-          xesam_mediaBitrate( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mediaBitrate", QUrl::StrictMode ) ),
-          xesam_mediaCodec( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mediaCodec", QUrl::StrictMode ) ),
-          xesam_mediaCodecType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mediaCodecType", QUrl::StrictMode ) ),
-          xesam_mediaDuration( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mediaDuration", QUrl::StrictMode ) ),
-          xesam_mergeConflict( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mergeConflict", QUrl::StrictMode ) ),
-          xesam_meteringMode( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#meteringMode", QUrl::StrictMode ) ),
-          xesam_mimeType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mimeType", QUrl::StrictMode ) ),
-          xesam_mountPoint( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#mountPoint", QUrl::StrictMode ) ),
-          xesam_name( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#name", QUrl::StrictMode ) ),
-          xesam_newsGroup( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#newsGroup", QUrl::StrictMode ) ),
-          xesam_occupiedSpace( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#occupiedSpace", QUrl::StrictMode ) ),
-          xesam_orientation( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#orientation", QUrl::StrictMode ) ),
-          xesam_originURL( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#originURL", QUrl::StrictMode ) ),
-          xesam_originalLocation( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#originalLocation", QUrl::StrictMode ) ),
-          xesam_otherName( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#otherName", QUrl::StrictMode ) ),
-          xesam_owner( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#owner", QUrl::StrictMode ) ),
-          xesam_pageCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#pageCount", QUrl::StrictMode ) ),
-          xesam_paragraphCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#paragraphCount", QUrl::StrictMode ) ),
-          xesam_performer( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#performer", QUrl::StrictMode ) ),
-          xesam_permissions( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#permissions", QUrl::StrictMode ) ),
-          xesam_personPhoto( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#personPhoto", QUrl::StrictMode ) ),
-          xesam_phoneNumber( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#phoneNumber", QUrl::StrictMode ) ),
-          xesam_pixelDataBitDepth( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#pixelDataBitDepth", QUrl::StrictMode ) ),
-          xesam_pixelDataType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#pixelDataType", QUrl::StrictMode ) ),
-          xesam_postalAddress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#postalAddress", QUrl::StrictMode ) ),
-          xesam_primaryRecipient( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#primaryRecipient", QUrl::StrictMode ) ),
-          xesam_programmingLanguage( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#programmingLanguage", QUrl::StrictMode ) ),
-          xesam_receptionTime( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#receptionTime", QUrl::StrictMode ) ),
-          xesam_recipient( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#recipient", QUrl::StrictMode ) ),
-          xesam_related( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#related", QUrl::StrictMode ) ),
-          xesam_remotePassword( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#remotePassword", QUrl::StrictMode ) ),
-          xesam_remotePort( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#remotePort", QUrl::StrictMode ) ),
-          xesam_remoteServer( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#remoteServer", QUrl::StrictMode ) ),
-          xesam_remoteUser( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#remoteUser", QUrl::StrictMode ) ),
-          xesam_replyTo( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#replyTo", QUrl::StrictMode ) ),
-          xesam_rowCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#rowCount", QUrl::StrictMode ) ),
-          xesam_rssFeed( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#rssFeed", QUrl::StrictMode ) ),
-          xesam_sampleConfiguration( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#sampleConfiguration", QUrl::StrictMode ) ),
-          xesam_sampleDataBitDepth( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#sampleDataBitDepth", QUrl::StrictMode ) ),
-          xesam_sampleDataType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#sampleDataType", QUrl::StrictMode ) ),
-          xesam_secondaryRecipient( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#secondaryRecipient", QUrl::StrictMode ) ),
-          xesam_seenAttachedAs( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#seenAttachedAs", QUrl::StrictMode ) ),
-          xesam_setCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#setCount", QUrl::StrictMode ) ),
-          xesam_setRate( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#setRate", QUrl::StrictMode ) ),
-          xesam_sha1Hash( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#sha1Hash", QUrl::StrictMode ) ),
-          xesam_size( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#size", QUrl::StrictMode ) ),
-          xesam_sourceCreated( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#sourceCreated", QUrl::StrictMode ) ),
-          xesam_sourceModified( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#sourceModified", QUrl::StrictMode ) ),
-          xesam_storageSize( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#storageSize", QUrl::StrictMode ) ),
-          xesam_subject( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#subject", QUrl::StrictMode ) ),
-          xesam_summary( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#summary", QUrl::StrictMode ) ),
-          xesam_supercedes( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#supercedes", QUrl::StrictMode ) ),
-          xesam_targetQuality( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#targetQuality", QUrl::StrictMode ) ),
-          xesam_title( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#title", QUrl::StrictMode ) ),
-          xesam_to( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#to", QUrl::StrictMode ) ),
-          xesam_totalSpace( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#totalSpace", QUrl::StrictMode ) ),
-          xesam_totalUncompressedSize( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#totalUncompressedSize", QUrl::StrictMode ) ),
-          xesam_trackGain( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#trackGain", QUrl::StrictMode ) ),
-          xesam_trackNumber( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#trackNumber", QUrl::StrictMode ) ),
-          xesam_trackPeakGain( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#trackPeakGain", QUrl::StrictMode ) ),
-          xesam_url( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#url", QUrl::StrictMode ) ),
-          xesam_useCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#useCount", QUrl::StrictMode ) ),
-          xesam_userComment( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#userComment", QUrl::StrictMode ) ),
-          xesam_userKeyword( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#userKeyword", QUrl::StrictMode ) ),
-          xesam_userRating( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#userRating", QUrl::StrictMode ) ),
-          xesam_usesNamespace( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#usesNamespace", QUrl::StrictMode ) ),
-          xesam_version( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#version", QUrl::StrictMode ) ),
-          xesam_verticalResolution( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#verticalResolution", QUrl::StrictMode ) ),
-          xesam_videoBitrate( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#videoBitrate", QUrl::StrictMode ) ),
-          xesam_videoCodec( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#videoCodec", QUrl::StrictMode ) ),
-          xesam_videoCodecType( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#videoCodecType", QUrl::StrictMode ) ),
-          xesam_whiteBalance( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#whiteBalance", QUrl::StrictMode ) ),
-          xesam_width( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#width", QUrl::StrictMode ) ),
-          xesam_wordCount( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#wordCount", QUrl::StrictMode ) ),
-          xesam_workEmailAddress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#workEmailAddress", QUrl::StrictMode ) ),
-          xesam_workPhoneNumber( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#workPhoneNumber", QUrl::StrictMode ) ),
-          xesam_workPostalAddress( QUrl::fromEncoded( "http://freedesktop.org/standards/xesam/1.0/core#workPostalAddress", QUrl::StrictMode ) ) {
+        : xesam_namespace( createNode( "http://freedesktop.org/standards/xesam/1.0/core#" ) ),
+          xesam_35mmEquivalent( createNode( "http://freedesktop.org/standards/xesam/1.0/core#35mmEquivalent" ) ),
+          xesam_Annotation( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Annotation" ) ),
+          xesam_Archive( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Archive" ) ),
+          xesam_ArchivedFile( createNode( "http://freedesktop.org/standards/xesam/1.0/core#ArchivedFile" ) ),
+          xesam_Audio( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Audio" ) ),
+          xesam_AudioList( createNode( "http://freedesktop.org/standards/xesam/1.0/core#AudioList" ) ),
+          xesam_BlockDevice( createNode( "http://freedesktop.org/standards/xesam/1.0/core#BlockDevice" ) ),
+          xesam_Bookmark( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Bookmark" ) ),
+          xesam_CommunicationChannel( createNode( "http://freedesktop.org/standards/xesam/1.0/core#CommunicationChannel" ) ),
+          xesam_Contact( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Contact" ) ),
+          xesam_ContactGroup( createNode( "http://freedesktop.org/standards/xesam/1.0/core#ContactGroup" ) ),
+          xesam_Content( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Content" ) ),
+          xesam_DataObject( createNode( "http://freedesktop.org/standards/xesam/1.0/core#DataObject" ) ),
+          xesam_DeletedFile( createNode( "http://freedesktop.org/standards/xesam/1.0/core#DeletedFile" ) ),
+          xesam_Document( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Document" ) ),
+          xesam_Documentation( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Documentation" ) ),
+          xesam_Email( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Email" ) ),
+          xesam_EmailAttachment( createNode( "http://freedesktop.org/standards/xesam/1.0/core#EmailAttachment" ) ),
+          xesam_EmbeddedObject( createNode( "http://freedesktop.org/standards/xesam/1.0/core#EmbeddedObject" ) ),
+          xesam_File( createNode( "http://freedesktop.org/standards/xesam/1.0/core#File" ) ),
+          xesam_FileSystem( createNode( "http://freedesktop.org/standards/xesam/1.0/core#FileSystem" ) ),
+          xesam_Filelike( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Filelike" ) ),
+          xesam_Folder( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Folder" ) ),
+          xesam_IMAP4Message( createNode( "http://freedesktop.org/standards/xesam/1.0/core#IMAP4Message" ) ),
+          xesam_IMMessage( createNode( "http://freedesktop.org/standards/xesam/1.0/core#IMMessage" ) ),
+          xesam_Image( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Image" ) ),
+          xesam_MailingList( createNode( "http://freedesktop.org/standards/xesam/1.0/core#MailingList" ) ),
+          xesam_MailingListEmail( createNode( "http://freedesktop.org/standards/xesam/1.0/core#MailingListEmail" ) ),
+          xesam_Media( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Media" ) ),
+          xesam_MediaList( createNode( "http://freedesktop.org/standards/xesam/1.0/core#MediaList" ) ),
+          xesam_Message( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Message" ) ),
+          xesam_MessageboxMessage( createNode( "http://freedesktop.org/standards/xesam/1.0/core#MessageboxMessage" ) ),
+          xesam_Music( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Music" ) ),
+          xesam_NewsGroup( createNode( "http://freedesktop.org/standards/xesam/1.0/core#NewsGroup" ) ),
+          xesam_NewsGroupEmail( createNode( "http://freedesktop.org/standards/xesam/1.0/core#NewsGroupEmail" ) ),
+          xesam_OfflineMedia( createNode( "http://freedesktop.org/standards/xesam/1.0/core#OfflineMedia" ) ),
+          xesam_Organization( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Organization" ) ),
+          xesam_POP3Message( createNode( "http://freedesktop.org/standards/xesam/1.0/core#POP3Message" ) ),
+          xesam_Person( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Person" ) ),
+          xesam_PersonalEmail( createNode( "http://freedesktop.org/standards/xesam/1.0/core#PersonalEmail" ) ),
+          xesam_Photo( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Photo" ) ),
+          xesam_Presentation( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Presentation" ) ),
+          xesam_Project( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Project" ) ),
+          xesam_RSSFeed( createNode( "http://freedesktop.org/standards/xesam/1.0/core#RSSFeed" ) ),
+          xesam_RSSMessage( createNode( "http://freedesktop.org/standards/xesam/1.0/core#RSSMessage" ) ),
+          xesam_RemoteFile( createNode( "http://freedesktop.org/standards/xesam/1.0/core#RemoteFile" ) ),
+          xesam_RemoteMessageboxMessage( createNode( "http://freedesktop.org/standards/xesam/1.0/core#RemoteMessageboxMessage" ) ),
+          xesam_RemoteResource( createNode( "http://freedesktop.org/standards/xesam/1.0/core#RemoteResource" ) ),
+          xesam_RevisionControlledFile( createNode( "http://freedesktop.org/standards/xesam/1.0/core#RevisionControlledFile" ) ),
+          xesam_RevisionControlledRepository( createNode( "http://freedesktop.org/standards/xesam/1.0/core#RevisionControlledRepository" ) ),
+          xesam_SoftwarePackage( createNode( "http://freedesktop.org/standards/xesam/1.0/core#SoftwarePackage" ) ),
+          xesam_Source( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Source" ) ),
+          xesam_SourceCode( createNode( "http://freedesktop.org/standards/xesam/1.0/core#SourceCode" ) ),
+          xesam_Spreadsheet( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Spreadsheet" ) ),
+          xesam_SystemResource( createNode( "http://freedesktop.org/standards/xesam/1.0/core#SystemResource" ) ),
+          xesam_Tag( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Tag" ) ),
+          xesam_Text( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Text" ) ),
+          xesam_TextDocument( createNode( "http://freedesktop.org/standards/xesam/1.0/core#TextDocument" ) ),
+          xesam_UncategorizedText( createNode( "http://freedesktop.org/standards/xesam/1.0/core#UncategorizedText" ) ),
+          xesam_Video( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Video" ) ),
+          xesam_Visual( createNode( "http://freedesktop.org/standards/xesam/1.0/core#Visual" ) ),
+          xesam_XML( createNode( "http://freedesktop.org/standards/xesam/1.0/core#XML" ) ),
+          xesam_acl( createNode( "http://freedesktop.org/standards/xesam/1.0/core#acl" ) ),
+          xesam_album( createNode( "http://freedesktop.org/standards/xesam/1.0/core#album" ) ),
+          xesam_albumArtist( createNode( "http://freedesktop.org/standards/xesam/1.0/core#albumArtist" ) ),
+          xesam_albumGain( createNode( "http://freedesktop.org/standards/xesam/1.0/core#albumGain" ) ),
+          xesam_albumPeakGain( createNode( "http://freedesktop.org/standards/xesam/1.0/core#albumPeakGain" ) ),
+          xesam_albumTrackCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#albumTrackCount" ) ),
+          xesam_aperture( createNode( "http://freedesktop.org/standards/xesam/1.0/core#aperture" ) ),
+          xesam_artist( createNode( "http://freedesktop.org/standards/xesam/1.0/core#artist" ) ),
+          xesam_asText( createNode( "http://freedesktop.org/standards/xesam/1.0/core#asText" ) ),
+          xesam_aspectRatio( createNode( "http://freedesktop.org/standards/xesam/1.0/core#aspectRatio" ) ),
+          xesam_attachmentEncoding( createNode( "http://freedesktop.org/standards/xesam/1.0/core#attachmentEncoding" ) ),
+          xesam_audioBPM( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioBPM" ) ),
+          xesam_audioBitrate( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioBitrate" ) ),
+          xesam_audioChannels( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioChannels" ) ),
+          xesam_audioCodec( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioCodec" ) ),
+          xesam_audioCodecType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioCodecType" ) ),
+          xesam_audioSampleBitDepth( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleBitDepth" ) ),
+          xesam_audioSampleCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleCount" ) ),
+          xesam_audioSampleDataType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleDataType" ) ),
+          xesam_audioSampleRate( createNode( "http://freedesktop.org/standards/xesam/1.0/core#audioSampleRate" ) ),
+          xesam_author( createNode( "http://freedesktop.org/standards/xesam/1.0/core#author" ) ),
+          xesam_autoRating( createNode( "http://freedesktop.org/standards/xesam/1.0/core#autoRating" ) ),
+          xesam_baseRevisionID( createNode( "http://freedesktop.org/standards/xesam/1.0/core#baseRevisionID" ) ),
+          xesam_bcc( createNode( "http://freedesktop.org/standards/xesam/1.0/core#bcc" ) ),
+          xesam_birthDate( createNode( "http://freedesktop.org/standards/xesam/1.0/core#birthDate" ) ),
+          xesam_blogContactURL( createNode( "http://freedesktop.org/standards/xesam/1.0/core#blogContactURL" ) ),
+          xesam_cameraManufacturer( createNode( "http://freedesktop.org/standards/xesam/1.0/core#cameraManufacturer" ) ),
+          xesam_cameraModel( createNode( "http://freedesktop.org/standards/xesam/1.0/core#cameraModel" ) ),
+          xesam_cc( createNode( "http://freedesktop.org/standards/xesam/1.0/core#cc" ) ),
+          xesam_ccdWidth( createNode( "http://freedesktop.org/standards/xesam/1.0/core#ccdWidth" ) ),
+          xesam_cellPhoneNumber( createNode( "http://freedesktop.org/standards/xesam/1.0/core#cellPhoneNumber" ) ),
+          xesam_changeCommitTime( createNode( "http://freedesktop.org/standards/xesam/1.0/core#changeCommitTime" ) ),
+          xesam_changeCommitter( createNode( "http://freedesktop.org/standards/xesam/1.0/core#changeCommitter" ) ),
+          xesam_characterCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#characterCount" ) ),
+          xesam_charset( createNode( "http://freedesktop.org/standards/xesam/1.0/core#charset" ) ),
+          xesam_chatRoom( createNode( "http://freedesktop.org/standards/xesam/1.0/core#chatRoom" ) ),
+          xesam_colorCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#colorCount" ) ),
+          xesam_colorSpace( createNode( "http://freedesktop.org/standards/xesam/1.0/core#colorSpace" ) ),
+          xesam_columnCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#columnCount" ) ),
+          xesam_comment( createNode( "http://freedesktop.org/standards/xesam/1.0/core#comment" ) ),
+          xesam_commentCharacterCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#commentCharacterCount" ) ),
+          xesam_commitDiff( createNode( "http://freedesktop.org/standards/xesam/1.0/core#commitDiff" ) ),
+          xesam_communicationChannel( createNode( "http://freedesktop.org/standards/xesam/1.0/core#communicationChannel" ) ),
+          xesam_composer( createNode( "http://freedesktop.org/standards/xesam/1.0/core#composer" ) ),
+          xesam_compressionAlgorithm( createNode( "http://freedesktop.org/standards/xesam/1.0/core#compressionAlgorithm" ) ),
+          xesam_compressionLevel( createNode( "http://freedesktop.org/standards/xesam/1.0/core#compressionLevel" ) ),
+          xesam_conflicts( createNode( "http://freedesktop.org/standards/xesam/1.0/core#conflicts" ) ),
+          xesam_contactMedium( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contactMedium" ) ),
+          xesam_contactNick( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contactNick" ) ),
+          xesam_contactURL( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contactURL" ) ),
+          xesam_contains( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contains" ) ),
+          xesam_contentComment( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contentComment" ) ),
+          xesam_contentCreated( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contentCreated" ) ),
+          xesam_contentKeyword( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contentKeyword" ) ),
+          xesam_contentModified( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contentModified" ) ),
+          xesam_contentType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contentType" ) ),
+          xesam_contributor( createNode( "http://freedesktop.org/standards/xesam/1.0/core#contributor" ) ),
+          xesam_copyright( createNode( "http://freedesktop.org/standards/xesam/1.0/core#copyright" ) ),
+          xesam_creator( createNode( "http://freedesktop.org/standards/xesam/1.0/core#creator" ) ),
+          xesam_definesClass( createNode( "http://freedesktop.org/standards/xesam/1.0/core#definesClass" ) ),
+          xesam_definesFunction( createNode( "http://freedesktop.org/standards/xesam/1.0/core#definesFunction" ) ),
+          xesam_definesGlobalVariable( createNode( "http://freedesktop.org/standards/xesam/1.0/core#definesGlobalVariable" ) ),
+          xesam_deletionTime( createNode( "http://freedesktop.org/standards/xesam/1.0/core#deletionTime" ) ),
+          xesam_depends( createNode( "http://freedesktop.org/standards/xesam/1.0/core#depends" ) ),
+          xesam_derivedFrom( createNode( "http://freedesktop.org/standards/xesam/1.0/core#derivedFrom" ) ),
+          xesam_description( createNode( "http://freedesktop.org/standards/xesam/1.0/core#description" ) ),
+          xesam_discNumber( createNode( "http://freedesktop.org/standards/xesam/1.0/core#discNumber" ) ),
+          xesam_disclaimer( createNode( "http://freedesktop.org/standards/xesam/1.0/core#disclaimer" ) ),
+          xesam_documentCategory( createNode( "http://freedesktop.org/standards/xesam/1.0/core#documentCategory" ) ),
+          xesam_emailAddress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#emailAddress" ) ),
+          xesam_exposureBias( createNode( "http://freedesktop.org/standards/xesam/1.0/core#exposureBias" ) ),
+          xesam_exposureProgram( createNode( "http://freedesktop.org/standards/xesam/1.0/core#exposureProgram" ) ),
+          xesam_exposureTime( createNode( "http://freedesktop.org/standards/xesam/1.0/core#exposureTime" ) ),
+          xesam_familyName( createNode( "http://freedesktop.org/standards/xesam/1.0/core#familyName" ) ),
+          xesam_faxPhoneNumber( createNode( "http://freedesktop.org/standards/xesam/1.0/core#faxPhoneNumber" ) ),
+          xesam_fileExtension( createNode( "http://freedesktop.org/standards/xesam/1.0/core#fileExtension" ) ),
+          xesam_fileSystemType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#fileSystemType" ) ),
+          xesam_fingerprint( createNode( "http://freedesktop.org/standards/xesam/1.0/core#fingerprint" ) ),
+          xesam_firstUsed( createNode( "http://freedesktop.org/standards/xesam/1.0/core#firstUsed" ) ),
+          xesam_flashUsed( createNode( "http://freedesktop.org/standards/xesam/1.0/core#flashUsed" ) ),
+          xesam_focalLength( createNode( "http://freedesktop.org/standards/xesam/1.0/core#focalLength" ) ),
+          xesam_focusDistance( createNode( "http://freedesktop.org/standards/xesam/1.0/core#focusDistance" ) ),
+          xesam_formatSubtype( createNode( "http://freedesktop.org/standards/xesam/1.0/core#formatSubtype" ) ),
+          xesam_frameCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#frameCount" ) ),
+          xesam_frameRate( createNode( "http://freedesktop.org/standards/xesam/1.0/core#frameRate" ) ),
+          xesam_freeSpace( createNode( "http://freedesktop.org/standards/xesam/1.0/core#freeSpace" ) ),
+          xesam_gender( createNode( "http://freedesktop.org/standards/xesam/1.0/core#gender" ) ),
+          xesam_generator( createNode( "http://freedesktop.org/standards/xesam/1.0/core#generator" ) ),
+          xesam_generatorOptions( createNode( "http://freedesktop.org/standards/xesam/1.0/core#generatorOptions" ) ),
+          xesam_genre( createNode( "http://freedesktop.org/standards/xesam/1.0/core#genre" ) ),
+          xesam_givenName( createNode( "http://freedesktop.org/standards/xesam/1.0/core#givenName" ) ),
+          xesam_group( createNode( "http://freedesktop.org/standards/xesam/1.0/core#group" ) ),
+          xesam_height( createNode( "http://freedesktop.org/standards/xesam/1.0/core#height" ) ),
+          xesam_homeEmailAddress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#homeEmailAddress" ) ),
+          xesam_homePhoneNumber( createNode( "http://freedesktop.org/standards/xesam/1.0/core#homePhoneNumber" ) ),
+          xesam_homePostalAddress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#homePostalAddress" ) ),
+          xesam_homepageContactURL( createNode( "http://freedesktop.org/standards/xesam/1.0/core#homepageContactURL" ) ),
+          xesam_honorificPrefix( createNode( "http://freedesktop.org/standards/xesam/1.0/core#honorificPrefix" ) ),
+          xesam_honorificSuffix( createNode( "http://freedesktop.org/standards/xesam/1.0/core#honorificSuffix" ) ),
+          xesam_horizontalResolution( createNode( "http://freedesktop.org/standards/xesam/1.0/core#horizontalResolution" ) ),
+          xesam_id( createNode( "http://freedesktop.org/standards/xesam/1.0/core#id" ) ),
+          xesam_imContactMedium( createNode( "http://freedesktop.org/standards/xesam/1.0/core#imContactMedium" ) ),
+          xesam_inReplyTo( createNode( "http://freedesktop.org/standards/xesam/1.0/core#inReplyTo" ) ),
+          xesam_interest( createNode( "http://freedesktop.org/standards/xesam/1.0/core#interest" ) ),
+          xesam_interlaceMode( createNode( "http://freedesktop.org/standards/xesam/1.0/core#interlaceMode" ) ),
+          xesam_ircContactMedium( createNode( "http://freedesktop.org/standards/xesam/1.0/core#ircContactMedium" ) ),
+          xesam_isContentEncrypted( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isContentEncrypted" ) ),
+          xesam_isEncrypted( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isEncrypted" ) ),
+          xesam_isImportant( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isImportant" ) ),
+          xesam_isInProgress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isInProgress" ) ),
+          xesam_isPublicChannel( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isPublicChannel" ) ),
+          xesam_isRead( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isRead" ) ),
+          xesam_isSourceEncrypted( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isSourceEncrypted" ) ),
+          xesam_isoEquivalent( createNode( "http://freedesktop.org/standards/xesam/1.0/core#isoEquivalent" ) ),
+          xesam_jabberContactMedium( createNode( "http://freedesktop.org/standards/xesam/1.0/core#jabberContactMedium" ) ),
+          xesam_keyword( createNode( "http://freedesktop.org/standards/xesam/1.0/core#keyword" ) ),
+          xesam_knows( createNode( "http://freedesktop.org/standards/xesam/1.0/core#knows" ) ),
+          xesam_language( createNode( "http://freedesktop.org/standards/xesam/1.0/core#language" ) ),
+          xesam_lastRefreshed( createNode( "http://freedesktop.org/standards/xesam/1.0/core#lastRefreshed" ) ),
+          xesam_lastUsed( createNode( "http://freedesktop.org/standards/xesam/1.0/core#lastUsed" ) ),
+          xesam_legal( createNode( "http://freedesktop.org/standards/xesam/1.0/core#legal" ) ),
+          xesam_license( createNode( "http://freedesktop.org/standards/xesam/1.0/core#license" ) ),
+          xesam_licenseType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#licenseType" ) ),
+          xesam_lineCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#lineCount" ) ),
+          xesam_links( createNode( "http://freedesktop.org/standards/xesam/1.0/core#links" ) ),
+          xesam_localRevision( createNode( "http://freedesktop.org/standards/xesam/1.0/core#localRevision" ) ),
+          xesam_lyricist( createNode( "http://freedesktop.org/standards/xesam/1.0/core#lyricist" ) ),
+          xesam_mailingList( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mailingList" ) ),
+          xesam_mailingPostalAddress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mailingPostalAddress" ) ),
+          xesam_maintainer( createNode( "http://freedesktop.org/standards/xesam/1.0/core#maintainer" ) ),
+          xesam_markupCharacterCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#markupCharacterCount" ) ),
+          xesam_md5Hash( createNode( "http://freedesktop.org/standards/xesam/1.0/core#md5Hash" ) ),
+          xesam_mediaBitrate( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mediaBitrate" ) ),
+          xesam_mediaCodec( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mediaCodec" ) ),
+          xesam_mediaCodecType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mediaCodecType" ) ),
+          xesam_mediaDuration( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mediaDuration" ) ),
+          xesam_mergeConflict( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mergeConflict" ) ),
+          xesam_meteringMode( createNode( "http://freedesktop.org/standards/xesam/1.0/core#meteringMode" ) ),
+          xesam_mimeType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mimeType" ) ),
+          xesam_mountPoint( createNode( "http://freedesktop.org/standards/xesam/1.0/core#mountPoint" ) ),
+          xesam_name( createNode( "http://freedesktop.org/standards/xesam/1.0/core#name" ) ),
+          xesam_newsGroup( createNode( "http://freedesktop.org/standards/xesam/1.0/core#newsGroup" ) ),
+          xesam_occupiedSpace( createNode( "http://freedesktop.org/standards/xesam/1.0/core#occupiedSpace" ) ),
+          xesam_orientation( createNode( "http://freedesktop.org/standards/xesam/1.0/core#orientation" ) ),
+          xesam_originURL( createNode( "http://freedesktop.org/standards/xesam/1.0/core#originURL" ) ),
+          xesam_originalLocation( createNode( "http://freedesktop.org/standards/xesam/1.0/core#originalLocation" ) ),
+          xesam_otherName( createNode( "http://freedesktop.org/standards/xesam/1.0/core#otherName" ) ),
+          xesam_owner( createNode( "http://freedesktop.org/standards/xesam/1.0/core#owner" ) ),
+          xesam_pageCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#pageCount" ) ),
+          xesam_paragraphCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#paragraphCount" ) ),
+          xesam_performer( createNode( "http://freedesktop.org/standards/xesam/1.0/core#performer" ) ),
+          xesam_permissions( createNode( "http://freedesktop.org/standards/xesam/1.0/core#permissions" ) ),
+          xesam_personPhoto( createNode( "http://freedesktop.org/standards/xesam/1.0/core#personPhoto" ) ),
+          xesam_phoneNumber( createNode( "http://freedesktop.org/standards/xesam/1.0/core#phoneNumber" ) ),
+          xesam_pixelDataBitDepth( createNode( "http://freedesktop.org/standards/xesam/1.0/core#pixelDataBitDepth" ) ),
+          xesam_pixelDataType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#pixelDataType" ) ),
+          xesam_postalAddress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#postalAddress" ) ),
+          xesam_primaryRecipient( createNode( "http://freedesktop.org/standards/xesam/1.0/core#primaryRecipient" ) ),
+          xesam_programmingLanguage( createNode( "http://freedesktop.org/standards/xesam/1.0/core#programmingLanguage" ) ),
+          xesam_receptionTime( createNode( "http://freedesktop.org/standards/xesam/1.0/core#receptionTime" ) ),
+          xesam_recipient( createNode( "http://freedesktop.org/standards/xesam/1.0/core#recipient" ) ),
+          xesam_related( createNode( "http://freedesktop.org/standards/xesam/1.0/core#related" ) ),
+          xesam_remotePassword( createNode( "http://freedesktop.org/standards/xesam/1.0/core#remotePassword" ) ),
+          xesam_remotePort( createNode( "http://freedesktop.org/standards/xesam/1.0/core#remotePort" ) ),
+          xesam_remoteServer( createNode( "http://freedesktop.org/standards/xesam/1.0/core#remoteServer" ) ),
+          xesam_remoteUser( createNode( "http://freedesktop.org/standards/xesam/1.0/core#remoteUser" ) ),
+          xesam_replyTo( createNode( "http://freedesktop.org/standards/xesam/1.0/core#replyTo" ) ),
+          xesam_rowCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#rowCount" ) ),
+          xesam_rssFeed( createNode( "http://freedesktop.org/standards/xesam/1.0/core#rssFeed" ) ),
+          xesam_sampleConfiguration( createNode( "http://freedesktop.org/standards/xesam/1.0/core#sampleConfiguration" ) ),
+          xesam_sampleDataBitDepth( createNode( "http://freedesktop.org/standards/xesam/1.0/core#sampleDataBitDepth" ) ),
+          xesam_sampleDataType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#sampleDataType" ) ),
+          xesam_secondaryRecipient( createNode( "http://freedesktop.org/standards/xesam/1.0/core#secondaryRecipient" ) ),
+          xesam_seenAttachedAs( createNode( "http://freedesktop.org/standards/xesam/1.0/core#seenAttachedAs" ) ),
+          xesam_setCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#setCount" ) ),
+          xesam_setRate( createNode( "http://freedesktop.org/standards/xesam/1.0/core#setRate" ) ),
+          xesam_sha1Hash( createNode( "http://freedesktop.org/standards/xesam/1.0/core#sha1Hash" ) ),
+          xesam_size( createNode( "http://freedesktop.org/standards/xesam/1.0/core#size" ) ),
+          xesam_sourceCreated( createNode( "http://freedesktop.org/standards/xesam/1.0/core#sourceCreated" ) ),
+          xesam_sourceModified( createNode( "http://freedesktop.org/standards/xesam/1.0/core#sourceModified" ) ),
+          xesam_storageSize( createNode( "http://freedesktop.org/standards/xesam/1.0/core#storageSize" ) ),
+          xesam_subject( createNode( "http://freedesktop.org/standards/xesam/1.0/core#subject" ) ),
+          xesam_summary( createNode( "http://freedesktop.org/standards/xesam/1.0/core#summary" ) ),
+          xesam_supercedes( createNode( "http://freedesktop.org/standards/xesam/1.0/core#supercedes" ) ),
+          xesam_targetQuality( createNode( "http://freedesktop.org/standards/xesam/1.0/core#targetQuality" ) ),
+          xesam_title( createNode( "http://freedesktop.org/standards/xesam/1.0/core#title" ) ),
+          xesam_to( createNode( "http://freedesktop.org/standards/xesam/1.0/core#to" ) ),
+          xesam_totalSpace( createNode( "http://freedesktop.org/standards/xesam/1.0/core#totalSpace" ) ),
+          xesam_totalUncompressedSize( createNode( "http://freedesktop.org/standards/xesam/1.0/core#totalUncompressedSize" ) ),
+          xesam_trackGain( createNode( "http://freedesktop.org/standards/xesam/1.0/core#trackGain" ) ),
+          xesam_trackNumber( createNode( "http://freedesktop.org/standards/xesam/1.0/core#trackNumber" ) ),
+          xesam_trackPeakGain( createNode( "http://freedesktop.org/standards/xesam/1.0/core#trackPeakGain" ) ),
+          xesam_url( createNode( "http://freedesktop.org/standards/xesam/1.0/core#url" ) ),
+          xesam_useCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#useCount" ) ),
+          xesam_userComment( createNode( "http://freedesktop.org/standards/xesam/1.0/core#userComment" ) ),
+          xesam_userKeyword( createNode( "http://freedesktop.org/standards/xesam/1.0/core#userKeyword" ) ),
+          xesam_userRating( createNode( "http://freedesktop.org/standards/xesam/1.0/core#userRating" ) ),
+          xesam_usesNamespace( createNode( "http://freedesktop.org/standards/xesam/1.0/core#usesNamespace" ) ),
+          xesam_version( createNode( "http://freedesktop.org/standards/xesam/1.0/core#version" ) ),
+          xesam_verticalResolution( createNode( "http://freedesktop.org/standards/xesam/1.0/core#verticalResolution" ) ),
+          xesam_videoBitrate( createNode( "http://freedesktop.org/standards/xesam/1.0/core#videoBitrate" ) ),
+          xesam_videoCodec( createNode( "http://freedesktop.org/standards/xesam/1.0/core#videoCodec" ) ),
+          xesam_videoCodecType( createNode( "http://freedesktop.org/standards/xesam/1.0/core#videoCodecType" ) ),
+          xesam_whiteBalance( createNode( "http://freedesktop.org/standards/xesam/1.0/core#whiteBalance" ) ),
+          xesam_width( createNode( "http://freedesktop.org/standards/xesam/1.0/core#width" ) ),
+          xesam_wordCount( createNode( "http://freedesktop.org/standards/xesam/1.0/core#wordCount" ) ),
+          xesam_workEmailAddress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#workEmailAddress" ) ),
+          xesam_workPhoneNumber( createNode( "http://freedesktop.org/standards/xesam/1.0/core#workPhoneNumber" ) ),
+          xesam_workPostalAddress( createNode( "http://freedesktop.org/standards/xesam/1.0/core#workPostalAddress" ) ) {
     }
 
-    QUrl xesam_namespace;
-    QUrl xesam_35mmEquivalent;
-    QUrl xesam_Annotation;
-    QUrl xesam_Archive;
-    QUrl xesam_ArchivedFile;
-    QUrl xesam_Audio;
-    QUrl xesam_AudioList;
-    QUrl xesam_BlockDevice;
-    QUrl xesam_Bookmark;
-    QUrl xesam_CommunicationChannel;
-    QUrl xesam_Contact;
-    QUrl xesam_ContactGroup;
-    QUrl xesam_Content;
-    QUrl xesam_DataObject;
-    QUrl xesam_DeletedFile;
-    QUrl xesam_Document;
-    QUrl xesam_Documentation;
-    QUrl xesam_Email;
-    QUrl xesam_EmailAttachment;
-    QUrl xesam_EmbeddedObject;
-    QUrl xesam_File;
-    QUrl xesam_FileSystem;
-    QUrl xesam_Filelike;
-    QUrl xesam_Folder;
-    QUrl xesam_IMAP4Message;
-    QUrl xesam_IMMessage;
-    QUrl xesam_Image;
-    QUrl xesam_MailingList;
-    QUrl xesam_MailingListEmail;
-    QUrl xesam_Media;
-    QUrl xesam_MediaList;
-    QUrl xesam_Message;
-    QUrl xesam_MessageboxMessage;
-    QUrl xesam_Music;
-    QUrl xesam_NewsGroup;
-    QUrl xesam_NewsGroupEmail;
-    QUrl xesam_OfflineMedia;
-    QUrl xesam_Organization;
-    QUrl xesam_POP3Message;
-    QUrl xesam_Person;
-    QUrl xesam_PersonalEmail;
-    QUrl xesam_Photo;
-    QUrl xesam_Presentation;
-    QUrl xesam_Project;
-    QUrl xesam_RSSFeed;
-    QUrl xesam_RSSMessage;
-    QUrl xesam_RemoteFile;
-    QUrl xesam_RemoteMessageboxMessage;
-    QUrl xesam_RemoteResource;
-    QUrl xesam_RevisionControlledFile;
-    QUrl xesam_RevisionControlledRepository;
-    QUrl xesam_SoftwarePackage;
-    QUrl xesam_Source;
-    QUrl xesam_SourceCode;
-    QUrl xesam_Spreadsheet;
-    QUrl xesam_SystemResource;
-    QUrl xesam_Tag;
-    QUrl xesam_Text;
-    QUrl xesam_TextDocument;
-    QUrl xesam_UncategorizedText;
-    QUrl xesam_Video;
-    QUrl xesam_Visual;
-    QUrl xesam_XML;
-    QUrl xesam_acl;
-    QUrl xesam_album;
-    QUrl xesam_albumArtist;
-    QUrl xesam_albumGain;
-    QUrl xesam_albumPeakGain;
-    QUrl xesam_albumTrackCount;
-    QUrl xesam_aperture;
-    QUrl xesam_artist;
-    QUrl xesam_asText;
-    QUrl xesam_aspectRatio;
-    QUrl xesam_attachmentEncoding;
-    QUrl xesam_audioBPM;
-    QUrl xesam_audioBitrate;
-    QUrl xesam_audioChannels;
-    QUrl xesam_audioCodec;
-    QUrl xesam_audioCodecType;
-    QUrl xesam_audioSampleBitDepth;
-    QUrl xesam_audioSampleCount;
-    QUrl xesam_audioSampleDataType;
-    QUrl xesam_audioSampleRate;
-    QUrl xesam_author;
-    QUrl xesam_autoRating;
-    QUrl xesam_baseRevisionID;
-    QUrl xesam_bcc;
-    QUrl xesam_birthDate;
-    QUrl xesam_blogContactURL;
-    QUrl xesam_cameraManufacturer;
-    QUrl xesam_cameraModel;
-    QUrl xesam_cc;
-    QUrl xesam_ccdWidth;
-    QUrl xesam_cellPhoneNumber;
-    QUrl xesam_changeCommitTime;
-    QUrl xesam_changeCommitter;
-    QUrl xesam_characterCount;
-    QUrl xesam_charset;
-    QUrl xesam_chatRoom;
-    QUrl xesam_colorCount;
-    QUrl xesam_colorSpace;
-    QUrl xesam_columnCount;
-    QUrl xesam_comment;
-    QUrl xesam_commentCharacterCount;
-    QUrl xesam_commitDiff;
-    QUrl xesam_communicationChannel;
-    QUrl xesam_composer;
-    QUrl xesam_compressionAlgorithm;
-    QUrl xesam_compressionLevel;
-    QUrl xesam_conflicts;
-    QUrl xesam_contactMedium;
-    QUrl xesam_contactNick;
-    QUrl xesam_contactURL;
-    QUrl xesam_contains;
-    QUrl xesam_contentComment;
-    QUrl xesam_contentCreated;
-    QUrl xesam_contentKeyword;
-    QUrl xesam_contentModified;
-    QUrl xesam_contentType;
-    QUrl xesam_contributor;
-    QUrl xesam_copyright;
-    QUrl xesam_creator;
-    QUrl xesam_definesClass;
-    QUrl xesam_definesFunction;
-    QUrl xesam_definesGlobalVariable;
-    QUrl xesam_deletionTime;
-    QUrl xesam_depends;
-    QUrl xesam_derivedFrom;
-    QUrl xesam_description;
-    QUrl xesam_discNumber;
-    QUrl xesam_disclaimer;
-    QUrl xesam_documentCategory;
-    QUrl xesam_emailAddress;
-    QUrl xesam_exposureBias;
-    QUrl xesam_exposureProgram;
-    QUrl xesam_exposureTime;
-    QUrl xesam_familyName;
-    QUrl xesam_faxPhoneNumber;
-    QUrl xesam_fileExtension;
-    QUrl xesam_fileSystemType;
-    QUrl xesam_fingerprint;
-    QUrl xesam_firstUsed;
-    QUrl xesam_flashUsed;
-    QUrl xesam_focalLength;
-    QUrl xesam_focusDistance;
-    QUrl xesam_formatSubtype;
-    QUrl xesam_frameCount;
-    QUrl xesam_frameRate;
-    QUrl xesam_freeSpace;
-    QUrl xesam_gender;
-    QUrl xesam_generator;
-    QUrl xesam_generatorOptions;
-    QUrl xesam_genre;
-    QUrl xesam_givenName;
-    QUrl xesam_group;
-    QUrl xesam_height;
-    QUrl xesam_homeEmailAddress;
-    QUrl xesam_homePhoneNumber;
-    QUrl xesam_homePostalAddress;
-    QUrl xesam_homepageContactURL;
-    QUrl xesam_honorificPrefix;
-    QUrl xesam_honorificSuffix;
-    QUrl xesam_horizontalResolution;
-    QUrl xesam_id;
-    QUrl xesam_imContactMedium;
-    QUrl xesam_inReplyTo;
-    QUrl xesam_interest;
-    QUrl xesam_interlaceMode;
-    QUrl xesam_ircContactMedium;
-    QUrl xesam_isContentEncrypted;
-    QUrl xesam_isEncrypted;
-    QUrl xesam_isImportant;
-    QUrl xesam_isInProgress;
-    QUrl xesam_isPublicChannel;
-    QUrl xesam_isRead;
-    QUrl xesam_isSourceEncrypted;
-    QUrl xesam_isoEquivalent;
-    QUrl xesam_jabberContactMedium;
-    QUrl xesam_keyword;
-    QUrl xesam_knows;
-    QUrl xesam_language;
-    QUrl xesam_lastRefreshed;
-    QUrl xesam_lastUsed;
-    QUrl xesam_legal;
-    QUrl xesam_license;
-    QUrl xesam_licenseType;
-    QUrl xesam_lineCount;
-    QUrl xesam_links;
-    QUrl xesam_localRevision;
-    QUrl xesam_lyricist;
-    QUrl xesam_mailingList;
-    QUrl xesam_mailingPostalAddress;
-    QUrl xesam_maintainer;
-    QUrl xesam_markupCharacterCount;
-    QUrl xesam_md5Hash;
-    QUrl xesam_mediaBitrate;
-    QUrl xesam_mediaCodec;
-    QUrl xesam_mediaCodecType;
-    QUrl xesam_mediaDuration;
-    QUrl xesam_mergeConflict;
-    QUrl xesam_meteringMode;
-    QUrl xesam_mimeType;
-    QUrl xesam_mountPoint;
-    QUrl xesam_name;
-    QUrl xesam_newsGroup;
-    QUrl xesam_occupiedSpace;
-    QUrl xesam_orientation;
-    QUrl xesam_originURL;
-    QUrl xesam_originalLocation;
-    QUrl xesam_otherName;
-    QUrl xesam_owner;
-    QUrl xesam_pageCount;
-    QUrl xesam_paragraphCount;
-    QUrl xesam_performer;
-    QUrl xesam_permissions;
-    QUrl xesam_personPhoto;
-    QUrl xesam_phoneNumber;
-    QUrl xesam_pixelDataBitDepth;
-    QUrl xesam_pixelDataType;
-    QUrl xesam_postalAddress;
-    QUrl xesam_primaryRecipient;
-    QUrl xesam_programmingLanguage;
-    QUrl xesam_receptionTime;
-    QUrl xesam_recipient;
-    QUrl xesam_related;
-    QUrl xesam_remotePassword;
-    QUrl xesam_remotePort;
-    QUrl xesam_remoteServer;
-    QUrl xesam_remoteUser;
-    QUrl xesam_replyTo;
-    QUrl xesam_rowCount;
-    QUrl xesam_rssFeed;
-    QUrl xesam_sampleConfiguration;
-    QUrl xesam_sampleDataBitDepth;
-    QUrl xesam_sampleDataType;
-    QUrl xesam_secondaryRecipient;
-    QUrl xesam_seenAttachedAs;
-    QUrl xesam_setCount;
-    QUrl xesam_setRate;
-    QUrl xesam_sha1Hash;
-    QUrl xesam_size;
-    QUrl xesam_sourceCreated;
-    QUrl xesam_sourceModified;
-    QUrl xesam_storageSize;
-    QUrl xesam_subject;
-    QUrl xesam_summary;
-    QUrl xesam_supercedes;
-    QUrl xesam_targetQuality;
-    QUrl xesam_title;
-    QUrl xesam_to;
-    QUrl xesam_totalSpace;
-    QUrl xesam_totalUncompressedSize;
-    QUrl xesam_trackGain;
-    QUrl xesam_trackNumber;
-    QUrl xesam_trackPeakGain;
-    QUrl xesam_url;
-    QUrl xesam_useCount;
-    QUrl xesam_userComment;
-    QUrl xesam_userKeyword;
-    QUrl xesam_userRating;
-    QUrl xesam_usesNamespace;
-    QUrl xesam_version;
-    QUrl xesam_verticalResolution;
-    QUrl xesam_videoBitrate;
-    QUrl xesam_videoCodec;
-    QUrl xesam_videoCodecType;
-    QUrl xesam_whiteBalance;
-    QUrl xesam_width;
-    QUrl xesam_wordCount;
-    QUrl xesam_workEmailAddress;
-    QUrl xesam_workPhoneNumber;
-    QUrl xesam_workPostalAddress;
+    Soprano::Node xesam_namespace;
+    Soprano::Node xesam_35mmEquivalent;
+    Soprano::Node xesam_Annotation;
+    Soprano::Node xesam_Archive;
+    Soprano::Node xesam_ArchivedFile;
+    Soprano::Node xesam_Audio;
+    Soprano::Node xesam_AudioList;
+    Soprano::Node xesam_BlockDevice;
+    Soprano::Node xesam_Bookmark;
+    Soprano::Node xesam_CommunicationChannel;
+    Soprano::Node xesam_Contact;
+    Soprano::Node xesam_ContactGroup;
+    Soprano::Node xesam_Content;
+    Soprano::Node xesam_DataObject;
+    Soprano::Node xesam_DeletedFile;
+    Soprano::Node xesam_Document;
+    Soprano::Node xesam_Documentation;
+    Soprano::Node xesam_Email;
+    Soprano::Node xesam_EmailAttachment;
+    Soprano::Node xesam_EmbeddedObject;
+    Soprano::Node xesam_File;
+    Soprano::Node xesam_FileSystem;
+    Soprano::Node xesam_Filelike;
+    Soprano::Node xesam_Folder;
+    Soprano::Node xesam_IMAP4Message;
+    Soprano::Node xesam_IMMessage;
+    Soprano::Node xesam_Image;
+    Soprano::Node xesam_MailingList;
+    Soprano::Node xesam_MailingListEmail;
+    Soprano::Node xesam_Media;
+    Soprano::Node xesam_MediaList;
+    Soprano::Node xesam_Message;
+    Soprano::Node xesam_MessageboxMessage;
+    Soprano::Node xesam_Music;
+    Soprano::Node xesam_NewsGroup;
+    Soprano::Node xesam_NewsGroupEmail;
+    Soprano::Node xesam_OfflineMedia;
+    Soprano::Node xesam_Organization;
+    Soprano::Node xesam_POP3Message;
+    Soprano::Node xesam_Person;
+    Soprano::Node xesam_PersonalEmail;
+    Soprano::Node xesam_Photo;
+    Soprano::Node xesam_Presentation;
+    Soprano::Node xesam_Project;
+    Soprano::Node xesam_RSSFeed;
+    Soprano::Node xesam_RSSMessage;
+    Soprano::Node xesam_RemoteFile;
+    Soprano::Node xesam_RemoteMessageboxMessage;
+    Soprano::Node xesam_RemoteResource;
+    Soprano::Node xesam_RevisionControlledFile;
+    Soprano::Node xesam_RevisionControlledRepository;
+    Soprano::Node xesam_SoftwarePackage;
+    Soprano::Node xesam_Source;
+    Soprano::Node xesam_SourceCode;
+    Soprano::Node xesam_Spreadsheet;
+    Soprano::Node xesam_SystemResource;
+    Soprano::Node xesam_Tag;
+    Soprano::Node xesam_Text;
+    Soprano::Node xesam_TextDocument;
+    Soprano::Node xesam_UncategorizedText;
+    Soprano::Node xesam_Video;
+    Soprano::Node xesam_Visual;
+    Soprano::Node xesam_XML;
+    Soprano::Node xesam_acl;
+    Soprano::Node xesam_album;
+    Soprano::Node xesam_albumArtist;
+    Soprano::Node xesam_albumGain;
+    Soprano::Node xesam_albumPeakGain;
+    Soprano::Node xesam_albumTrackCount;
+    Soprano::Node xesam_aperture;
+    Soprano::Node xesam_artist;
+    Soprano::Node xesam_asText;
+    Soprano::Node xesam_aspectRatio;
+    Soprano::Node xesam_attachmentEncoding;
+    Soprano::Node xesam_audioBPM;
+    Soprano::Node xesam_audioBitrate;
+    Soprano::Node xesam_audioChannels;
+    Soprano::Node xesam_audioCodec;
+    Soprano::Node xesam_audioCodecType;
+    Soprano::Node xesam_audioSampleBitDepth;
+    Soprano::Node xesam_audioSampleCount;
+    Soprano::Node xesam_audioSampleDataType;
+    Soprano::Node xesam_audioSampleRate;
+    Soprano::Node xesam_author;
+    Soprano::Node xesam_autoRating;
+    Soprano::Node xesam_baseRevisionID;
+    Soprano::Node xesam_bcc;
+    Soprano::Node xesam_birthDate;
+    Soprano::Node xesam_blogContactURL;
+    Soprano::Node xesam_cameraManufacturer;
+    Soprano::Node xesam_cameraModel;
+    Soprano::Node xesam_cc;
+    Soprano::Node xesam_ccdWidth;
+    Soprano::Node xesam_cellPhoneNumber;
+    Soprano::Node xesam_changeCommitTime;
+    Soprano::Node xesam_changeCommitter;
+    Soprano::Node xesam_characterCount;
+    Soprano::Node xesam_charset;
+    Soprano::Node xesam_chatRoom;
+    Soprano::Node xesam_colorCount;
+    Soprano::Node xesam_colorSpace;
+    Soprano::Node xesam_columnCount;
+    Soprano::Node xesam_comment;
+    Soprano::Node xesam_commentCharacterCount;
+    Soprano::Node xesam_commitDiff;
+    Soprano::Node xesam_communicationChannel;
+    Soprano::Node xesam_composer;
+    Soprano::Node xesam_compressionAlgorithm;
+    Soprano::Node xesam_compressionLevel;
+    Soprano::Node xesam_conflicts;
+    Soprano::Node xesam_contactMedium;
+    Soprano::Node xesam_contactNick;
+    Soprano::Node xesam_contactURL;
+    Soprano::Node xesam_contains;
+    Soprano::Node xesam_contentComment;
+    Soprano::Node xesam_contentCreated;
+    Soprano::Node xesam_contentKeyword;
+    Soprano::Node xesam_contentModified;
+    Soprano::Node xesam_contentType;
+    Soprano::Node xesam_contributor;
+    Soprano::Node xesam_copyright;
+    Soprano::Node xesam_creator;
+    Soprano::Node xesam_definesClass;
+    Soprano::Node xesam_definesFunction;
+    Soprano::Node xesam_definesGlobalVariable;
+    Soprano::Node xesam_deletionTime;
+    Soprano::Node xesam_depends;
+    Soprano::Node xesam_derivedFrom;
+    Soprano::Node xesam_description;
+    Soprano::Node xesam_discNumber;
+    Soprano::Node xesam_disclaimer;
+    Soprano::Node xesam_documentCategory;
+    Soprano::Node xesam_emailAddress;
+    Soprano::Node xesam_exposureBias;
+    Soprano::Node xesam_exposureProgram;
+    Soprano::Node xesam_exposureTime;
+    Soprano::Node xesam_familyName;
+    Soprano::Node xesam_faxPhoneNumber;
+    Soprano::Node xesam_fileExtension;
+    Soprano::Node xesam_fileSystemType;
+    Soprano::Node xesam_fingerprint;
+    Soprano::Node xesam_firstUsed;
+    Soprano::Node xesam_flashUsed;
+    Soprano::Node xesam_focalLength;
+    Soprano::Node xesam_focusDistance;
+    Soprano::Node xesam_formatSubtype;
+    Soprano::Node xesam_frameCount;
+    Soprano::Node xesam_frameRate;
+    Soprano::Node xesam_freeSpace;
+    Soprano::Node xesam_gender;
+    Soprano::Node xesam_generator;
+    Soprano::Node xesam_generatorOptions;
+    Soprano::Node xesam_genre;
+    Soprano::Node xesam_givenName;
+    Soprano::Node xesam_group;
+    Soprano::Node xesam_height;
+    Soprano::Node xesam_homeEmailAddress;
+    Soprano::Node xesam_homePhoneNumber;
+    Soprano::Node xesam_homePostalAddress;
+    Soprano::Node xesam_homepageContactURL;
+    Soprano::Node xesam_honorificPrefix;
+    Soprano::Node xesam_honorificSuffix;
+    Soprano::Node xesam_horizontalResolution;
+    Soprano::Node xesam_id;
+    Soprano::Node xesam_imContactMedium;
+    Soprano::Node xesam_inReplyTo;
+    Soprano::Node xesam_interest;
+    Soprano::Node xesam_interlaceMode;
+    Soprano::Node xesam_ircContactMedium;
+    Soprano::Node xesam_isContentEncrypted;
+    Soprano::Node xesam_isEncrypted;
+    Soprano::Node xesam_isImportant;
+    Soprano::Node xesam_isInProgress;
+    Soprano::Node xesam_isPublicChannel;
+    Soprano::Node xesam_isRead;
+    Soprano::Node xesam_isSourceEncrypted;
+    Soprano::Node xesam_isoEquivalent;
+    Soprano::Node xesam_jabberContactMedium;
+    Soprano::Node xesam_keyword;
+    Soprano::Node xesam_knows;
+    Soprano::Node xesam_language;
+    Soprano::Node xesam_lastRefreshed;
+    Soprano::Node xesam_lastUsed;
+    Soprano::Node xesam_legal;
+    Soprano::Node xesam_license;
+    Soprano::Node xesam_licenseType;
+    Soprano::Node xesam_lineCount;
+    Soprano::Node xesam_links;
+    Soprano::Node xesam_localRevision;
+    Soprano::Node xesam_lyricist;
+    Soprano::Node xesam_mailingList;
+    Soprano::Node xesam_mailingPostalAddress;
+    Soprano::Node xesam_maintainer;
+    Soprano::Node xesam_markupCharacterCount;
+    Soprano::Node xesam_md5Hash;
+    Soprano::Node xesam_mediaBitrate;
+    Soprano::Node xesam_mediaCodec;
+    Soprano::Node xesam_mediaCodecType;
+    Soprano::Node xesam_mediaDuration;
+    Soprano::Node xesam_mergeConflict;
+    Soprano::Node xesam_meteringMode;
+    Soprano::Node xesam_mimeType;
+    Soprano::Node xesam_mountPoint;
+    Soprano::Node xesam_name;
+    Soprano::Node xesam_newsGroup;
+    Soprano::Node xesam_occupiedSpace;
+    Soprano::Node xesam_orientation;
+    Soprano::Node xesam_originURL;
+    Soprano::Node xesam_originalLocation;
+    Soprano::Node xesam_otherName;
+    Soprano::Node xesam_owner;
+    Soprano::Node xesam_pageCount;
+    Soprano::Node xesam_paragraphCount;
+    Soprano::Node xesam_performer;
+    Soprano::Node xesam_permissions;
+    Soprano::Node xesam_personPhoto;
+    Soprano::Node xesam_phoneNumber;
+    Soprano::Node xesam_pixelDataBitDepth;
+    Soprano::Node xesam_pixelDataType;
+    Soprano::Node xesam_postalAddress;
+    Soprano::Node xesam_primaryRecipient;
+    Soprano::Node xesam_programmingLanguage;
+    Soprano::Node xesam_receptionTime;
+    Soprano::Node xesam_recipient;
+    Soprano::Node xesam_related;
+    Soprano::Node xesam_remotePassword;
+    Soprano::Node xesam_remotePort;
+    Soprano::Node xesam_remoteServer;
+    Soprano::Node xesam_remoteUser;
+    Soprano::Node xesam_replyTo;
+    Soprano::Node xesam_rowCount;
+    Soprano::Node xesam_rssFeed;
+    Soprano::Node xesam_sampleConfiguration;
+    Soprano::Node xesam_sampleDataBitDepth;
+    Soprano::Node xesam_sampleDataType;
+    Soprano::Node xesam_secondaryRecipient;
+    Soprano::Node xesam_seenAttachedAs;
+    Soprano::Node xesam_setCount;
+    Soprano::Node xesam_setRate;
+    Soprano::Node xesam_sha1Hash;
+    Soprano::Node xesam_size;
+    Soprano::Node xesam_sourceCreated;
+    Soprano::Node xesam_sourceModified;
+    Soprano::Node xesam_storageSize;
+    Soprano::Node xesam_subject;
+    Soprano::Node xesam_summary;
+    Soprano::Node xesam_supercedes;
+    Soprano::Node xesam_targetQuality;
+    Soprano::Node xesam_title;
+    Soprano::Node xesam_to;
+    Soprano::Node xesam_totalSpace;
+    Soprano::Node xesam_totalUncompressedSize;
+    Soprano::Node xesam_trackGain;
+    Soprano::Node xesam_trackNumber;
+    Soprano::Node xesam_trackPeakGain;
+    Soprano::Node xesam_url;
+    Soprano::Node xesam_useCount;
+    Soprano::Node xesam_userComment;
+    Soprano::Node xesam_userKeyword;
+    Soprano::Node xesam_userRating;
+    Soprano::Node xesam_usesNamespace;
+    Soprano::Node xesam_version;
+    Soprano::Node xesam_verticalResolution;
+    Soprano::Node xesam_videoBitrate;
+    Soprano::Node xesam_videoCodec;
+    Soprano::Node xesam_videoCodecType;
+    Soprano::Node xesam_whiteBalance;
+    Soprano::Node xesam_width;
+    Soprano::Node xesam_wordCount;
+    Soprano::Node xesam_workEmailAddress;
+    Soprano::Node xesam_workPhoneNumber;
+    Soprano::Node xesam_workPostalAddress;
 };
 
-QThreadStorage<XesamPrivate*> qts_xesam;
-XesamPrivate* s_xesam() {
-    if( !qts_xesam.hasLocalData() )
-        qts_xesam.setLocalData( new XesamPrivate );
-    return qts_xesam.localData();
-}
+Q_GLOBAL_STATIC( XesamPrivate, s_xesam )
 
 QUrl Soprano::Vocabulary::Xesam::xesamNamespace()
 {
-    return s_xesam()->xesam_namespace;
+    return s_xesam()->xesam_namespace.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::xesam35mmEquivalent()
 {
-    return s_xesam()->xesam_35mmEquivalent;
+    return s_xesam()->xesam_35mmEquivalent.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Annotation()
 {
-    return s_xesam()->xesam_Annotation;
+    return s_xesam()->xesam_Annotation.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Archive()
 {
-    return s_xesam()->xesam_Archive;
+    return s_xesam()->xesam_Archive.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::ArchivedFile()
 {
-    return s_xesam()->xesam_ArchivedFile;
+    return s_xesam()->xesam_ArchivedFile.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Audio()
 {
-    return s_xesam()->xesam_Audio;
+    return s_xesam()->xesam_Audio.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::AudioList()
 {
-    return s_xesam()->xesam_AudioList;
+    return s_xesam()->xesam_AudioList.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::BlockDevice()
 {
-    return s_xesam()->xesam_BlockDevice;
+    return s_xesam()->xesam_BlockDevice.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Bookmark()
 {
-    return s_xesam()->xesam_Bookmark;
+    return s_xesam()->xesam_Bookmark.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::CommunicationChannel()
 {
-    return s_xesam()->xesam_CommunicationChannel;
+    return s_xesam()->xesam_CommunicationChannel.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Contact()
 {
-    return s_xesam()->xesam_Contact;
+    return s_xesam()->xesam_Contact.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::ContactGroup()
 {
-    return s_xesam()->xesam_ContactGroup;
+    return s_xesam()->xesam_ContactGroup.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Content()
 {
-    return s_xesam()->xesam_Content;
+    return s_xesam()->xesam_Content.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::DataObject()
 {
-    return s_xesam()->xesam_DataObject;
+    return s_xesam()->xesam_DataObject.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::DeletedFile()
 {
-    return s_xesam()->xesam_DeletedFile;
+    return s_xesam()->xesam_DeletedFile.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Document()
 {
-    return s_xesam()->xesam_Document;
+    return s_xesam()->xesam_Document.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Documentation()
 {
-    return s_xesam()->xesam_Documentation;
+    return s_xesam()->xesam_Documentation.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Email()
 {
-    return s_xesam()->xesam_Email;
+    return s_xesam()->xesam_Email.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::EmailAttachment()
 {
-    return s_xesam()->xesam_EmailAttachment;
+    return s_xesam()->xesam_EmailAttachment.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::EmbeddedObject()
 {
-    return s_xesam()->xesam_EmbeddedObject;
+    return s_xesam()->xesam_EmbeddedObject.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::File()
 {
-    return s_xesam()->xesam_File;
+    return s_xesam()->xesam_File.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::FileSystem()
 {
-    return s_xesam()->xesam_FileSystem;
+    return s_xesam()->xesam_FileSystem.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Filelike()
 {
-    return s_xesam()->xesam_Filelike;
+    return s_xesam()->xesam_Filelike.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Folder()
 {
-    return s_xesam()->xesam_Folder;
+    return s_xesam()->xesam_Folder.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::IMAP4Message()
 {
-    return s_xesam()->xesam_IMAP4Message;
+    return s_xesam()->xesam_IMAP4Message.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::IMMessage()
 {
-    return s_xesam()->xesam_IMMessage;
+    return s_xesam()->xesam_IMMessage.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Image()
 {
-    return s_xesam()->xesam_Image;
+    return s_xesam()->xesam_Image.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::MailingList()
 {
-    return s_xesam()->xesam_MailingList;
+    return s_xesam()->xesam_MailingList.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::MailingListEmail()
 {
-    return s_xesam()->xesam_MailingListEmail;
+    return s_xesam()->xesam_MailingListEmail.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Media()
 {
-    return s_xesam()->xesam_Media;
+    return s_xesam()->xesam_Media.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::MediaList()
 {
-    return s_xesam()->xesam_MediaList;
+    return s_xesam()->xesam_MediaList.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Message()
 {
-    return s_xesam()->xesam_Message;
+    return s_xesam()->xesam_Message.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::MessageboxMessage()
 {
-    return s_xesam()->xesam_MessageboxMessage;
+    return s_xesam()->xesam_MessageboxMessage.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Music()
 {
-    return s_xesam()->xesam_Music;
+    return s_xesam()->xesam_Music.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::NewsGroup()
 {
-    return s_xesam()->xesam_NewsGroup;
+    return s_xesam()->xesam_NewsGroup.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::NewsGroupEmail()
 {
-    return s_xesam()->xesam_NewsGroupEmail;
+    return s_xesam()->xesam_NewsGroupEmail.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::OfflineMedia()
 {
-    return s_xesam()->xesam_OfflineMedia;
+    return s_xesam()->xesam_OfflineMedia.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Organization()
 {
-    return s_xesam()->xesam_Organization;
+    return s_xesam()->xesam_Organization.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::POP3Message()
 {
-    return s_xesam()->xesam_POP3Message;
+    return s_xesam()->xesam_POP3Message.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Person()
 {
-    return s_xesam()->xesam_Person;
+    return s_xesam()->xesam_Person.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::PersonalEmail()
 {
-    return s_xesam()->xesam_PersonalEmail;
+    return s_xesam()->xesam_PersonalEmail.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Photo()
 {
-    return s_xesam()->xesam_Photo;
+    return s_xesam()->xesam_Photo.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Presentation()
 {
-    return s_xesam()->xesam_Presentation;
+    return s_xesam()->xesam_Presentation.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Project()
 {
-    return s_xesam()->xesam_Project;
+    return s_xesam()->xesam_Project.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::RSSFeed()
 {
-    return s_xesam()->xesam_RSSFeed;
+    return s_xesam()->xesam_RSSFeed.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::RSSMessage()
 {
-    return s_xesam()->xesam_RSSMessage;
+    return s_xesam()->xesam_RSSMessage.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::RemoteFile()
 {
-    return s_xesam()->xesam_RemoteFile;
+    return s_xesam()->xesam_RemoteFile.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::RemoteMessageboxMessage()
 {
-    return s_xesam()->xesam_RemoteMessageboxMessage;
+    return s_xesam()->xesam_RemoteMessageboxMessage.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::RemoteResource()
 {
-    return s_xesam()->xesam_RemoteResource;
+    return s_xesam()->xesam_RemoteResource.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::RevisionControlledFile()
 {
-    return s_xesam()->xesam_RevisionControlledFile;
+    return s_xesam()->xesam_RevisionControlledFile.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::RevisionControlledRepository()
 {
-    return s_xesam()->xesam_RevisionControlledRepository;
+    return s_xesam()->xesam_RevisionControlledRepository.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::SoftwarePackage()
 {
-    return s_xesam()->xesam_SoftwarePackage;
+    return s_xesam()->xesam_SoftwarePackage.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Source()
 {
-    return s_xesam()->xesam_Source;
+    return s_xesam()->xesam_Source.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::SourceCode()
 {
-    return s_xesam()->xesam_SourceCode;
+    return s_xesam()->xesam_SourceCode.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Spreadsheet()
 {
-    return s_xesam()->xesam_Spreadsheet;
+    return s_xesam()->xesam_Spreadsheet.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::SystemResource()
 {
-    return s_xesam()->xesam_SystemResource;
+    return s_xesam()->xesam_SystemResource.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Tag()
 {
-    return s_xesam()->xesam_Tag;
+    return s_xesam()->xesam_Tag.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Text()
 {
-    return s_xesam()->xesam_Text;
+    return s_xesam()->xesam_Text.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::TextDocument()
 {
-    return s_xesam()->xesam_TextDocument;
+    return s_xesam()->xesam_TextDocument.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::UncategorizedText()
 {
-    return s_xesam()->xesam_UncategorizedText;
+    return s_xesam()->xesam_UncategorizedText.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Video()
 {
-    return s_xesam()->xesam_Video;
+    return s_xesam()->xesam_Video.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::Visual()
 {
-    return s_xesam()->xesam_Visual;
+    return s_xesam()->xesam_Visual.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::XML()
 {
-    return s_xesam()->xesam_XML;
+    return s_xesam()->xesam_XML.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::acl()
 {
-    return s_xesam()->xesam_acl;
+    return s_xesam()->xesam_acl.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::album()
 {
-    return s_xesam()->xesam_album;
+    return s_xesam()->xesam_album.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::albumArtist()
 {
-    return s_xesam()->xesam_albumArtist;
+    return s_xesam()->xesam_albumArtist.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::albumGain()
 {
-    return s_xesam()->xesam_albumGain;
+    return s_xesam()->xesam_albumGain.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::albumPeakGain()
 {
-    return s_xesam()->xesam_albumPeakGain;
+    return s_xesam()->xesam_albumPeakGain.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::albumTrackCount()
 {
-    return s_xesam()->xesam_albumTrackCount;
+    return s_xesam()->xesam_albumTrackCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::aperture()
 {
-    return s_xesam()->xesam_aperture;
+    return s_xesam()->xesam_aperture.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::artist()
 {
-    return s_xesam()->xesam_artist;
+    return s_xesam()->xesam_artist.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::asText()
 {
-    return s_xesam()->xesam_asText;
+    return s_xesam()->xesam_asText.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::aspectRatio()
 {
-    return s_xesam()->xesam_aspectRatio;
+    return s_xesam()->xesam_aspectRatio.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::attachmentEncoding()
 {
-    return s_xesam()->xesam_attachmentEncoding;
+    return s_xesam()->xesam_attachmentEncoding.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioBPM()
 {
-    return s_xesam()->xesam_audioBPM;
+    return s_xesam()->xesam_audioBPM.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioBitrate()
 {
-    return s_xesam()->xesam_audioBitrate;
+    return s_xesam()->xesam_audioBitrate.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioChannels()
 {
-    return s_xesam()->xesam_audioChannels;
+    return s_xesam()->xesam_audioChannels.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioCodec()
 {
-    return s_xesam()->xesam_audioCodec;
+    return s_xesam()->xesam_audioCodec.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioCodecType()
 {
-    return s_xesam()->xesam_audioCodecType;
+    return s_xesam()->xesam_audioCodecType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioSampleBitDepth()
 {
-    return s_xesam()->xesam_audioSampleBitDepth;
+    return s_xesam()->xesam_audioSampleBitDepth.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioSampleCount()
 {
-    return s_xesam()->xesam_audioSampleCount;
+    return s_xesam()->xesam_audioSampleCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioSampleDataType()
 {
-    return s_xesam()->xesam_audioSampleDataType;
+    return s_xesam()->xesam_audioSampleDataType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::audioSampleRate()
 {
-    return s_xesam()->xesam_audioSampleRate;
+    return s_xesam()->xesam_audioSampleRate.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::author()
 {
-    return s_xesam()->xesam_author;
+    return s_xesam()->xesam_author.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::autoRating()
 {
-    return s_xesam()->xesam_autoRating;
+    return s_xesam()->xesam_autoRating.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::baseRevisionID()
 {
-    return s_xesam()->xesam_baseRevisionID;
+    return s_xesam()->xesam_baseRevisionID.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::bcc()
 {
-    return s_xesam()->xesam_bcc;
+    return s_xesam()->xesam_bcc.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::birthDate()
 {
-    return s_xesam()->xesam_birthDate;
+    return s_xesam()->xesam_birthDate.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::blogContactURL()
 {
-    return s_xesam()->xesam_blogContactURL;
+    return s_xesam()->xesam_blogContactURL.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::cameraManufacturer()
 {
-    return s_xesam()->xesam_cameraManufacturer;
+    return s_xesam()->xesam_cameraManufacturer.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::cameraModel()
 {
-    return s_xesam()->xesam_cameraModel;
+    return s_xesam()->xesam_cameraModel.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::cc()
 {
-    return s_xesam()->xesam_cc;
+    return s_xesam()->xesam_cc.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::ccdWidth()
 {
-    return s_xesam()->xesam_ccdWidth;
+    return s_xesam()->xesam_ccdWidth.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::cellPhoneNumber()
 {
-    return s_xesam()->xesam_cellPhoneNumber;
+    return s_xesam()->xesam_cellPhoneNumber.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::changeCommitTime()
 {
-    return s_xesam()->xesam_changeCommitTime;
+    return s_xesam()->xesam_changeCommitTime.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::changeCommitter()
 {
-    return s_xesam()->xesam_changeCommitter;
+    return s_xesam()->xesam_changeCommitter.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::characterCount()
 {
-    return s_xesam()->xesam_characterCount;
+    return s_xesam()->xesam_characterCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::charset()
 {
-    return s_xesam()->xesam_charset;
+    return s_xesam()->xesam_charset.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::chatRoom()
 {
-    return s_xesam()->xesam_chatRoom;
+    return s_xesam()->xesam_chatRoom.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::colorCount()
 {
-    return s_xesam()->xesam_colorCount;
+    return s_xesam()->xesam_colorCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::colorSpace()
 {
-    return s_xesam()->xesam_colorSpace;
+    return s_xesam()->xesam_colorSpace.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::columnCount()
 {
-    return s_xesam()->xesam_columnCount;
+    return s_xesam()->xesam_columnCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::comment()
 {
-    return s_xesam()->xesam_comment;
+    return s_xesam()->xesam_comment.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::commentCharacterCount()
 {
-    return s_xesam()->xesam_commentCharacterCount;
+    return s_xesam()->xesam_commentCharacterCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::commitDiff()
 {
-    return s_xesam()->xesam_commitDiff;
+    return s_xesam()->xesam_commitDiff.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::communicationChannel()
 {
-    return s_xesam()->xesam_communicationChannel;
+    return s_xesam()->xesam_communicationChannel.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::composer()
 {
-    return s_xesam()->xesam_composer;
+    return s_xesam()->xesam_composer.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::compressionAlgorithm()
 {
-    return s_xesam()->xesam_compressionAlgorithm;
+    return s_xesam()->xesam_compressionAlgorithm.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::compressionLevel()
 {
-    return s_xesam()->xesam_compressionLevel;
+    return s_xesam()->xesam_compressionLevel.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::conflicts()
 {
-    return s_xesam()->xesam_conflicts;
+    return s_xesam()->xesam_conflicts.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contactMedium()
 {
-    return s_xesam()->xesam_contactMedium;
+    return s_xesam()->xesam_contactMedium.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contactNick()
 {
-    return s_xesam()->xesam_contactNick;
+    return s_xesam()->xesam_contactNick.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contactURL()
 {
-    return s_xesam()->xesam_contactURL;
+    return s_xesam()->xesam_contactURL.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contains()
 {
-    return s_xesam()->xesam_contains;
+    return s_xesam()->xesam_contains.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contentComment()
 {
-    return s_xesam()->xesam_contentComment;
+    return s_xesam()->xesam_contentComment.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contentCreated()
 {
-    return s_xesam()->xesam_contentCreated;
+    return s_xesam()->xesam_contentCreated.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contentKeyword()
 {
-    return s_xesam()->xesam_contentKeyword;
+    return s_xesam()->xesam_contentKeyword.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contentModified()
 {
-    return s_xesam()->xesam_contentModified;
+    return s_xesam()->xesam_contentModified.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contentType()
 {
-    return s_xesam()->xesam_contentType;
+    return s_xesam()->xesam_contentType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::contributor()
 {
-    return s_xesam()->xesam_contributor;
+    return s_xesam()->xesam_contributor.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::copyright()
 {
-    return s_xesam()->xesam_copyright;
+    return s_xesam()->xesam_copyright.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::creator()
 {
-    return s_xesam()->xesam_creator;
+    return s_xesam()->xesam_creator.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::definesClass()
 {
-    return s_xesam()->xesam_definesClass;
+    return s_xesam()->xesam_definesClass.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::definesFunction()
 {
-    return s_xesam()->xesam_definesFunction;
+    return s_xesam()->xesam_definesFunction.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::definesGlobalVariable()
 {
-    return s_xesam()->xesam_definesGlobalVariable;
+    return s_xesam()->xesam_definesGlobalVariable.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::deletionTime()
 {
-    return s_xesam()->xesam_deletionTime;
+    return s_xesam()->xesam_deletionTime.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::depends()
 {
-    return s_xesam()->xesam_depends;
+    return s_xesam()->xesam_depends.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::derivedFrom()
 {
-    return s_xesam()->xesam_derivedFrom;
+    return s_xesam()->xesam_derivedFrom.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::description()
 {
-    return s_xesam()->xesam_description;
+    return s_xesam()->xesam_description.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::discNumber()
 {
-    return s_xesam()->xesam_discNumber;
+    return s_xesam()->xesam_discNumber.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::disclaimer()
 {
-    return s_xesam()->xesam_disclaimer;
+    return s_xesam()->xesam_disclaimer.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::documentCategory()
 {
-    return s_xesam()->xesam_documentCategory;
+    return s_xesam()->xesam_documentCategory.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::emailAddress()
 {
-    return s_xesam()->xesam_emailAddress;
+    return s_xesam()->xesam_emailAddress.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::exposureBias()
 {
-    return s_xesam()->xesam_exposureBias;
+    return s_xesam()->xesam_exposureBias.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::exposureProgram()
 {
-    return s_xesam()->xesam_exposureProgram;
+    return s_xesam()->xesam_exposureProgram.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::exposureTime()
 {
-    return s_xesam()->xesam_exposureTime;
+    return s_xesam()->xesam_exposureTime.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::familyName()
 {
-    return s_xesam()->xesam_familyName;
+    return s_xesam()->xesam_familyName.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::faxPhoneNumber()
 {
-    return s_xesam()->xesam_faxPhoneNumber;
+    return s_xesam()->xesam_faxPhoneNumber.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::fileExtension()
 {
-    return s_xesam()->xesam_fileExtension;
+    return s_xesam()->xesam_fileExtension.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::fileSystemType()
 {
-    return s_xesam()->xesam_fileSystemType;
+    return s_xesam()->xesam_fileSystemType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::fingerprint()
 {
-    return s_xesam()->xesam_fingerprint;
+    return s_xesam()->xesam_fingerprint.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::firstUsed()
 {
-    return s_xesam()->xesam_firstUsed;
+    return s_xesam()->xesam_firstUsed.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::flashUsed()
 {
-    return s_xesam()->xesam_flashUsed;
+    return s_xesam()->xesam_flashUsed.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::focalLength()
 {
-    return s_xesam()->xesam_focalLength;
+    return s_xesam()->xesam_focalLength.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::focusDistance()
 {
-    return s_xesam()->xesam_focusDistance;
+    return s_xesam()->xesam_focusDistance.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::formatSubtype()
 {
-    return s_xesam()->xesam_formatSubtype;
+    return s_xesam()->xesam_formatSubtype.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::frameCount()
 {
-    return s_xesam()->xesam_frameCount;
+    return s_xesam()->xesam_frameCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::frameRate()
 {
-    return s_xesam()->xesam_frameRate;
+    return s_xesam()->xesam_frameRate.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::freeSpace()
 {
-    return s_xesam()->xesam_freeSpace;
+    return s_xesam()->xesam_freeSpace.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::gender()
 {
-    return s_xesam()->xesam_gender;
+    return s_xesam()->xesam_gender.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::generator()
 {
-    return s_xesam()->xesam_generator;
+    return s_xesam()->xesam_generator.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::generatorOptions()
 {
-    return s_xesam()->xesam_generatorOptions;
+    return s_xesam()->xesam_generatorOptions.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::genre()
 {
-    return s_xesam()->xesam_genre;
+    return s_xesam()->xesam_genre.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::givenName()
 {
-    return s_xesam()->xesam_givenName;
+    return s_xesam()->xesam_givenName.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::group()
 {
-    return s_xesam()->xesam_group;
+    return s_xesam()->xesam_group.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::height()
 {
-    return s_xesam()->xesam_height;
+    return s_xesam()->xesam_height.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::homeEmailAddress()
 {
-    return s_xesam()->xesam_homeEmailAddress;
+    return s_xesam()->xesam_homeEmailAddress.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::homePhoneNumber()
 {
-    return s_xesam()->xesam_homePhoneNumber;
+    return s_xesam()->xesam_homePhoneNumber.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::homePostalAddress()
 {
-    return s_xesam()->xesam_homePostalAddress;
+    return s_xesam()->xesam_homePostalAddress.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::homepageContactURL()
 {
-    return s_xesam()->xesam_homepageContactURL;
+    return s_xesam()->xesam_homepageContactURL.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::honorificPrefix()
 {
-    return s_xesam()->xesam_honorificPrefix;
+    return s_xesam()->xesam_honorificPrefix.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::honorificSuffix()
 {
-    return s_xesam()->xesam_honorificSuffix;
+    return s_xesam()->xesam_honorificSuffix.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::horizontalResolution()
 {
-    return s_xesam()->xesam_horizontalResolution;
+    return s_xesam()->xesam_horizontalResolution.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::id()
 {
-    return s_xesam()->xesam_id;
+    return s_xesam()->xesam_id.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::imContactMedium()
 {
-    return s_xesam()->xesam_imContactMedium;
+    return s_xesam()->xesam_imContactMedium.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::inReplyTo()
 {
-    return s_xesam()->xesam_inReplyTo;
+    return s_xesam()->xesam_inReplyTo.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::interest()
 {
-    return s_xesam()->xesam_interest;
+    return s_xesam()->xesam_interest.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::interlaceMode()
 {
-    return s_xesam()->xesam_interlaceMode;
+    return s_xesam()->xesam_interlaceMode.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::ircContactMedium()
 {
-    return s_xesam()->xesam_ircContactMedium;
+    return s_xesam()->xesam_ircContactMedium.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isContentEncrypted()
 {
-    return s_xesam()->xesam_isContentEncrypted;
+    return s_xesam()->xesam_isContentEncrypted.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isEncrypted()
 {
-    return s_xesam()->xesam_isEncrypted;
+    return s_xesam()->xesam_isEncrypted.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isImportant()
 {
-    return s_xesam()->xesam_isImportant;
+    return s_xesam()->xesam_isImportant.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isInProgress()
 {
-    return s_xesam()->xesam_isInProgress;
+    return s_xesam()->xesam_isInProgress.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isPublicChannel()
 {
-    return s_xesam()->xesam_isPublicChannel;
+    return s_xesam()->xesam_isPublicChannel.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isRead()
 {
-    return s_xesam()->xesam_isRead;
+    return s_xesam()->xesam_isRead.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isSourceEncrypted()
 {
-    return s_xesam()->xesam_isSourceEncrypted;
+    return s_xesam()->xesam_isSourceEncrypted.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::isoEquivalent()
 {
-    return s_xesam()->xesam_isoEquivalent;
+    return s_xesam()->xesam_isoEquivalent.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::jabberContactMedium()
 {
-    return s_xesam()->xesam_jabberContactMedium;
+    return s_xesam()->xesam_jabberContactMedium.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::keyword()
 {
-    return s_xesam()->xesam_keyword;
+    return s_xesam()->xesam_keyword.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::knows()
 {
-    return s_xesam()->xesam_knows;
+    return s_xesam()->xesam_knows.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::language()
 {
-    return s_xesam()->xesam_language;
+    return s_xesam()->xesam_language.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::lastRefreshed()
 {
-    return s_xesam()->xesam_lastRefreshed;
+    return s_xesam()->xesam_lastRefreshed.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::lastUsed()
 {
-    return s_xesam()->xesam_lastUsed;
+    return s_xesam()->xesam_lastUsed.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::legal()
 {
-    return s_xesam()->xesam_legal;
+    return s_xesam()->xesam_legal.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::license()
 {
-    return s_xesam()->xesam_license;
+    return s_xesam()->xesam_license.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::licenseType()
 {
-    return s_xesam()->xesam_licenseType;
+    return s_xesam()->xesam_licenseType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::lineCount()
 {
-    return s_xesam()->xesam_lineCount;
+    return s_xesam()->xesam_lineCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::links()
 {
-    return s_xesam()->xesam_links;
+    return s_xesam()->xesam_links.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::localRevision()
 {
-    return s_xesam()->xesam_localRevision;
+    return s_xesam()->xesam_localRevision.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::lyricist()
 {
-    return s_xesam()->xesam_lyricist;
+    return s_xesam()->xesam_lyricist.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mailingList()
 {
-    return s_xesam()->xesam_mailingList;
+    return s_xesam()->xesam_mailingList.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mailingPostalAddress()
 {
-    return s_xesam()->xesam_mailingPostalAddress;
+    return s_xesam()->xesam_mailingPostalAddress.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::maintainer()
 {
-    return s_xesam()->xesam_maintainer;
+    return s_xesam()->xesam_maintainer.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::markupCharacterCount()
 {
-    return s_xesam()->xesam_markupCharacterCount;
+    return s_xesam()->xesam_markupCharacterCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::md5Hash()
 {
-    return s_xesam()->xesam_md5Hash;
+    return s_xesam()->xesam_md5Hash.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mediaBitrate()
 {
-    return s_xesam()->xesam_mediaBitrate;
+    return s_xesam()->xesam_mediaBitrate.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mediaCodec()
 {
-    return s_xesam()->xesam_mediaCodec;
+    return s_xesam()->xesam_mediaCodec.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mediaCodecType()
 {
-    return s_xesam()->xesam_mediaCodecType;
+    return s_xesam()->xesam_mediaCodecType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mediaDuration()
 {
-    return s_xesam()->xesam_mediaDuration;
+    return s_xesam()->xesam_mediaDuration.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mergeConflict()
 {
-    return s_xesam()->xesam_mergeConflict;
+    return s_xesam()->xesam_mergeConflict.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::meteringMode()
 {
-    return s_xesam()->xesam_meteringMode;
+    return s_xesam()->xesam_meteringMode.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mimeType()
 {
-    return s_xesam()->xesam_mimeType;
+    return s_xesam()->xesam_mimeType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::mountPoint()
 {
-    return s_xesam()->xesam_mountPoint;
+    return s_xesam()->xesam_mountPoint.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::name()
 {
-    return s_xesam()->xesam_name;
+    return s_xesam()->xesam_name.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::newsGroup()
 {
-    return s_xesam()->xesam_newsGroup;
+    return s_xesam()->xesam_newsGroup.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::occupiedSpace()
 {
-    return s_xesam()->xesam_occupiedSpace;
+    return s_xesam()->xesam_occupiedSpace.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::orientation()
 {
-    return s_xesam()->xesam_orientation;
+    return s_xesam()->xesam_orientation.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::originURL()
 {
-    return s_xesam()->xesam_originURL;
+    return s_xesam()->xesam_originURL.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::originalLocation()
 {
-    return s_xesam()->xesam_originalLocation;
+    return s_xesam()->xesam_originalLocation.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::otherName()
 {
-    return s_xesam()->xesam_otherName;
+    return s_xesam()->xesam_otherName.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::owner()
 {
-    return s_xesam()->xesam_owner;
+    return s_xesam()->xesam_owner.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::pageCount()
 {
-    return s_xesam()->xesam_pageCount;
+    return s_xesam()->xesam_pageCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::paragraphCount()
 {
-    return s_xesam()->xesam_paragraphCount;
+    return s_xesam()->xesam_paragraphCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::performer()
 {
-    return s_xesam()->xesam_performer;
+    return s_xesam()->xesam_performer.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::permissions()
 {
-    return s_xesam()->xesam_permissions;
+    return s_xesam()->xesam_permissions.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::personPhoto()
 {
-    return s_xesam()->xesam_personPhoto;
+    return s_xesam()->xesam_personPhoto.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::phoneNumber()
 {
-    return s_xesam()->xesam_phoneNumber;
+    return s_xesam()->xesam_phoneNumber.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::pixelDataBitDepth()
 {
-    return s_xesam()->xesam_pixelDataBitDepth;
+    return s_xesam()->xesam_pixelDataBitDepth.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::pixelDataType()
 {
-    return s_xesam()->xesam_pixelDataType;
+    return s_xesam()->xesam_pixelDataType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::postalAddress()
 {
-    return s_xesam()->xesam_postalAddress;
+    return s_xesam()->xesam_postalAddress.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::primaryRecipient()
 {
-    return s_xesam()->xesam_primaryRecipient;
+    return s_xesam()->xesam_primaryRecipient.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::programmingLanguage()
 {
-    return s_xesam()->xesam_programmingLanguage;
+    return s_xesam()->xesam_programmingLanguage.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::receptionTime()
 {
-    return s_xesam()->xesam_receptionTime;
+    return s_xesam()->xesam_receptionTime.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::recipient()
 {
-    return s_xesam()->xesam_recipient;
+    return s_xesam()->xesam_recipient.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::related()
 {
-    return s_xesam()->xesam_related;
+    return s_xesam()->xesam_related.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::remotePassword()
 {
-    return s_xesam()->xesam_remotePassword;
+    return s_xesam()->xesam_remotePassword.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::remotePort()
 {
-    return s_xesam()->xesam_remotePort;
+    return s_xesam()->xesam_remotePort.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::remoteServer()
 {
-    return s_xesam()->xesam_remoteServer;
+    return s_xesam()->xesam_remoteServer.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::remoteUser()
 {
-    return s_xesam()->xesam_remoteUser;
+    return s_xesam()->xesam_remoteUser.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::replyTo()
 {
-    return s_xesam()->xesam_replyTo;
+    return s_xesam()->xesam_replyTo.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::rowCount()
 {
-    return s_xesam()->xesam_rowCount;
+    return s_xesam()->xesam_rowCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::rssFeed()
 {
-    return s_xesam()->xesam_rssFeed;
+    return s_xesam()->xesam_rssFeed.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::sampleConfiguration()
 {
-    return s_xesam()->xesam_sampleConfiguration;
+    return s_xesam()->xesam_sampleConfiguration.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::sampleDataBitDepth()
 {
-    return s_xesam()->xesam_sampleDataBitDepth;
+    return s_xesam()->xesam_sampleDataBitDepth.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::sampleDataType()
 {
-    return s_xesam()->xesam_sampleDataType;
+    return s_xesam()->xesam_sampleDataType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::secondaryRecipient()
 {
-    return s_xesam()->xesam_secondaryRecipient;
+    return s_xesam()->xesam_secondaryRecipient.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::seenAttachedAs()
 {
-    return s_xesam()->xesam_seenAttachedAs;
+    return s_xesam()->xesam_seenAttachedAs.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::setCount()
 {
-    return s_xesam()->xesam_setCount;
+    return s_xesam()->xesam_setCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::setRate()
 {
-    return s_xesam()->xesam_setRate;
+    return s_xesam()->xesam_setRate.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::sha1Hash()
 {
-    return s_xesam()->xesam_sha1Hash;
+    return s_xesam()->xesam_sha1Hash.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::size()
 {
-    return s_xesam()->xesam_size;
+    return s_xesam()->xesam_size.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::sourceCreated()
 {
-    return s_xesam()->xesam_sourceCreated;
+    return s_xesam()->xesam_sourceCreated.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::sourceModified()
 {
-    return s_xesam()->xesam_sourceModified;
+    return s_xesam()->xesam_sourceModified.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::storageSize()
 {
-    return s_xesam()->xesam_storageSize;
+    return s_xesam()->xesam_storageSize.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::subject()
 {
-    return s_xesam()->xesam_subject;
+    return s_xesam()->xesam_subject.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::summary()
 {
-    return s_xesam()->xesam_summary;
+    return s_xesam()->xesam_summary.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::supercedes()
 {
-    return s_xesam()->xesam_supercedes;
+    return s_xesam()->xesam_supercedes.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::targetQuality()
 {
-    return s_xesam()->xesam_targetQuality;
+    return s_xesam()->xesam_targetQuality.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::title()
 {
-    return s_xesam()->xesam_title;
+    return s_xesam()->xesam_title.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::to()
 {
-    return s_xesam()->xesam_to;
+    return s_xesam()->xesam_to.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::totalSpace()
 {
-    return s_xesam()->xesam_totalSpace;
+    return s_xesam()->xesam_totalSpace.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::totalUncompressedSize()
 {
-    return s_xesam()->xesam_totalUncompressedSize;
+    return s_xesam()->xesam_totalUncompressedSize.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::trackGain()
 {
-    return s_xesam()->xesam_trackGain;
+    return s_xesam()->xesam_trackGain.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::trackNumber()
 {
-    return s_xesam()->xesam_trackNumber;
+    return s_xesam()->xesam_trackNumber.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::trackPeakGain()
 {
-    return s_xesam()->xesam_trackPeakGain;
+    return s_xesam()->xesam_trackPeakGain.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::url()
 {
-    return s_xesam()->xesam_url;
+    return s_xesam()->xesam_url.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::useCount()
 {
-    return s_xesam()->xesam_useCount;
+    return s_xesam()->xesam_useCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::userComment()
 {
-    return s_xesam()->xesam_userComment;
+    return s_xesam()->xesam_userComment.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::userKeyword()
 {
-    return s_xesam()->xesam_userKeyword;
+    return s_xesam()->xesam_userKeyword.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::userRating()
 {
-    return s_xesam()->xesam_userRating;
+    return s_xesam()->xesam_userRating.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::usesNamespace()
 {
-    return s_xesam()->xesam_usesNamespace;
+    return s_xesam()->xesam_usesNamespace.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::version()
 {
-    return s_xesam()->xesam_version;
+    return s_xesam()->xesam_version.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::verticalResolution()
 {
-    return s_xesam()->xesam_verticalResolution;
+    return s_xesam()->xesam_verticalResolution.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::videoBitrate()
 {
-    return s_xesam()->xesam_videoBitrate;
+    return s_xesam()->xesam_videoBitrate.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::videoCodec()
 {
-    return s_xesam()->xesam_videoCodec;
+    return s_xesam()->xesam_videoCodec.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::videoCodecType()
 {
-    return s_xesam()->xesam_videoCodecType;
+    return s_xesam()->xesam_videoCodecType.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::whiteBalance()
 {
-    return s_xesam()->xesam_whiteBalance;
+    return s_xesam()->xesam_whiteBalance.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::width()
 {
-    return s_xesam()->xesam_width;
+    return s_xesam()->xesam_width.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::wordCount()
 {
-    return s_xesam()->xesam_wordCount;
+    return s_xesam()->xesam_wordCount.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::workEmailAddress()
 {
-    return s_xesam()->xesam_workEmailAddress;
+    return s_xesam()->xesam_workEmailAddress.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::workPhoneNumber()
 {
-    return s_xesam()->xesam_workPhoneNumber;
+    return s_xesam()->xesam_workPhoneNumber.uri();
 }
 
 QUrl Soprano::Vocabulary::Xesam::workPostalAddress()
+{
+    return s_xesam()->xesam_workPostalAddress.uri();
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::xesam35mmEquivalent()
+{
+    return s_xesam()->xesam_35mmEquivalent;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Annotation()
+{
+    return s_xesam()->xesam_Annotation;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Archive()
+{
+    return s_xesam()->xesam_Archive;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::ArchivedFile()
+{
+    return s_xesam()->xesam_ArchivedFile;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Audio()
+{
+    return s_xesam()->xesam_Audio;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::AudioList()
+{
+    return s_xesam()->xesam_AudioList;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::BlockDevice()
+{
+    return s_xesam()->xesam_BlockDevice;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Bookmark()
+{
+    return s_xesam()->xesam_Bookmark;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::CommunicationChannel()
+{
+    return s_xesam()->xesam_CommunicationChannel;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Contact()
+{
+    return s_xesam()->xesam_Contact;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::ContactGroup()
+{
+    return s_xesam()->xesam_ContactGroup;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Content()
+{
+    return s_xesam()->xesam_Content;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::DataObject()
+{
+    return s_xesam()->xesam_DataObject;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::DeletedFile()
+{
+    return s_xesam()->xesam_DeletedFile;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Document()
+{
+    return s_xesam()->xesam_Document;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Documentation()
+{
+    return s_xesam()->xesam_Documentation;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Email()
+{
+    return s_xesam()->xesam_Email;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::EmailAttachment()
+{
+    return s_xesam()->xesam_EmailAttachment;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::EmbeddedObject()
+{
+    return s_xesam()->xesam_EmbeddedObject;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::File()
+{
+    return s_xesam()->xesam_File;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::FileSystem()
+{
+    return s_xesam()->xesam_FileSystem;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Filelike()
+{
+    return s_xesam()->xesam_Filelike;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Folder()
+{
+    return s_xesam()->xesam_Folder;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::IMAP4Message()
+{
+    return s_xesam()->xesam_IMAP4Message;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::IMMessage()
+{
+    return s_xesam()->xesam_IMMessage;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Image()
+{
+    return s_xesam()->xesam_Image;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::MailingList()
+{
+    return s_xesam()->xesam_MailingList;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::MailingListEmail()
+{
+    return s_xesam()->xesam_MailingListEmail;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Media()
+{
+    return s_xesam()->xesam_Media;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::MediaList()
+{
+    return s_xesam()->xesam_MediaList;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Message()
+{
+    return s_xesam()->xesam_Message;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::MessageboxMessage()
+{
+    return s_xesam()->xesam_MessageboxMessage;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Music()
+{
+    return s_xesam()->xesam_Music;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::NewsGroup()
+{
+    return s_xesam()->xesam_NewsGroup;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::NewsGroupEmail()
+{
+    return s_xesam()->xesam_NewsGroupEmail;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::OfflineMedia()
+{
+    return s_xesam()->xesam_OfflineMedia;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Organization()
+{
+    return s_xesam()->xesam_Organization;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::POP3Message()
+{
+    return s_xesam()->xesam_POP3Message;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Person()
+{
+    return s_xesam()->xesam_Person;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::PersonalEmail()
+{
+    return s_xesam()->xesam_PersonalEmail;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Photo()
+{
+    return s_xesam()->xesam_Photo;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Presentation()
+{
+    return s_xesam()->xesam_Presentation;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Project()
+{
+    return s_xesam()->xesam_Project;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::RSSFeed()
+{
+    return s_xesam()->xesam_RSSFeed;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::RSSMessage()
+{
+    return s_xesam()->xesam_RSSMessage;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::RemoteFile()
+{
+    return s_xesam()->xesam_RemoteFile;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::RemoteMessageboxMessage()
+{
+    return s_xesam()->xesam_RemoteMessageboxMessage;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::RemoteResource()
+{
+    return s_xesam()->xesam_RemoteResource;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::RevisionControlledFile()
+{
+    return s_xesam()->xesam_RevisionControlledFile;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::RevisionControlledRepository()
+{
+    return s_xesam()->xesam_RevisionControlledRepository;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::SoftwarePackage()
+{
+    return s_xesam()->xesam_SoftwarePackage;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Source()
+{
+    return s_xesam()->xesam_Source;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::SourceCode()
+{
+    return s_xesam()->xesam_SourceCode;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Spreadsheet()
+{
+    return s_xesam()->xesam_Spreadsheet;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::SystemResource()
+{
+    return s_xesam()->xesam_SystemResource;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Tag()
+{
+    return s_xesam()->xesam_Tag;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Text()
+{
+    return s_xesam()->xesam_Text;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::TextDocument()
+{
+    return s_xesam()->xesam_TextDocument;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::UncategorizedText()
+{
+    return s_xesam()->xesam_UncategorizedText;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Video()
+{
+    return s_xesam()->xesam_Video;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::Visual()
+{
+    return s_xesam()->xesam_Visual;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::XML()
+{
+    return s_xesam()->xesam_XML;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::acl()
+{
+    return s_xesam()->xesam_acl;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::album()
+{
+    return s_xesam()->xesam_album;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::albumArtist()
+{
+    return s_xesam()->xesam_albumArtist;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::albumGain()
+{
+    return s_xesam()->xesam_albumGain;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::albumPeakGain()
+{
+    return s_xesam()->xesam_albumPeakGain;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::albumTrackCount()
+{
+    return s_xesam()->xesam_albumTrackCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::aperture()
+{
+    return s_xesam()->xesam_aperture;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::artist()
+{
+    return s_xesam()->xesam_artist;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::asText()
+{
+    return s_xesam()->xesam_asText;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::aspectRatio()
+{
+    return s_xesam()->xesam_aspectRatio;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::attachmentEncoding()
+{
+    return s_xesam()->xesam_attachmentEncoding;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioBPM()
+{
+    return s_xesam()->xesam_audioBPM;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioBitrate()
+{
+    return s_xesam()->xesam_audioBitrate;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioChannels()
+{
+    return s_xesam()->xesam_audioChannels;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioCodec()
+{
+    return s_xesam()->xesam_audioCodec;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioCodecType()
+{
+    return s_xesam()->xesam_audioCodecType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioSampleBitDepth()
+{
+    return s_xesam()->xesam_audioSampleBitDepth;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioSampleCount()
+{
+    return s_xesam()->xesam_audioSampleCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioSampleDataType()
+{
+    return s_xesam()->xesam_audioSampleDataType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::audioSampleRate()
+{
+    return s_xesam()->xesam_audioSampleRate;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::author()
+{
+    return s_xesam()->xesam_author;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::autoRating()
+{
+    return s_xesam()->xesam_autoRating;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::baseRevisionID()
+{
+    return s_xesam()->xesam_baseRevisionID;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::bcc()
+{
+    return s_xesam()->xesam_bcc;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::birthDate()
+{
+    return s_xesam()->xesam_birthDate;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::blogContactURL()
+{
+    return s_xesam()->xesam_blogContactURL;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::cameraManufacturer()
+{
+    return s_xesam()->xesam_cameraManufacturer;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::cameraModel()
+{
+    return s_xesam()->xesam_cameraModel;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::cc()
+{
+    return s_xesam()->xesam_cc;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::ccdWidth()
+{
+    return s_xesam()->xesam_ccdWidth;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::cellPhoneNumber()
+{
+    return s_xesam()->xesam_cellPhoneNumber;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::changeCommitTime()
+{
+    return s_xesam()->xesam_changeCommitTime;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::changeCommitter()
+{
+    return s_xesam()->xesam_changeCommitter;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::characterCount()
+{
+    return s_xesam()->xesam_characterCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::charset()
+{
+    return s_xesam()->xesam_charset;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::chatRoom()
+{
+    return s_xesam()->xesam_chatRoom;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::colorCount()
+{
+    return s_xesam()->xesam_colorCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::colorSpace()
+{
+    return s_xesam()->xesam_colorSpace;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::columnCount()
+{
+    return s_xesam()->xesam_columnCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::comment()
+{
+    return s_xesam()->xesam_comment;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::commentCharacterCount()
+{
+    return s_xesam()->xesam_commentCharacterCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::commitDiff()
+{
+    return s_xesam()->xesam_commitDiff;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::communicationChannel()
+{
+    return s_xesam()->xesam_communicationChannel;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::composer()
+{
+    return s_xesam()->xesam_composer;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::compressionAlgorithm()
+{
+    return s_xesam()->xesam_compressionAlgorithm;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::compressionLevel()
+{
+    return s_xesam()->xesam_compressionLevel;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::conflicts()
+{
+    return s_xesam()->xesam_conflicts;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contactMedium()
+{
+    return s_xesam()->xesam_contactMedium;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contactNick()
+{
+    return s_xesam()->xesam_contactNick;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contactURL()
+{
+    return s_xesam()->xesam_contactURL;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contains()
+{
+    return s_xesam()->xesam_contains;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contentComment()
+{
+    return s_xesam()->xesam_contentComment;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contentCreated()
+{
+    return s_xesam()->xesam_contentCreated;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contentKeyword()
+{
+    return s_xesam()->xesam_contentKeyword;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contentModified()
+{
+    return s_xesam()->xesam_contentModified;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contentType()
+{
+    return s_xesam()->xesam_contentType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::contributor()
+{
+    return s_xesam()->xesam_contributor;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::copyright()
+{
+    return s_xesam()->xesam_copyright;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::creator()
+{
+    return s_xesam()->xesam_creator;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::definesClass()
+{
+    return s_xesam()->xesam_definesClass;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::definesFunction()
+{
+    return s_xesam()->xesam_definesFunction;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::definesGlobalVariable()
+{
+    return s_xesam()->xesam_definesGlobalVariable;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::deletionTime()
+{
+    return s_xesam()->xesam_deletionTime;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::depends()
+{
+    return s_xesam()->xesam_depends;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::derivedFrom()
+{
+    return s_xesam()->xesam_derivedFrom;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::description()
+{
+    return s_xesam()->xesam_description;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::discNumber()
+{
+    return s_xesam()->xesam_discNumber;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::disclaimer()
+{
+    return s_xesam()->xesam_disclaimer;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::documentCategory()
+{
+    return s_xesam()->xesam_documentCategory;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::emailAddress()
+{
+    return s_xesam()->xesam_emailAddress;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::exposureBias()
+{
+    return s_xesam()->xesam_exposureBias;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::exposureProgram()
+{
+    return s_xesam()->xesam_exposureProgram;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::exposureTime()
+{
+    return s_xesam()->xesam_exposureTime;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::familyName()
+{
+    return s_xesam()->xesam_familyName;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::faxPhoneNumber()
+{
+    return s_xesam()->xesam_faxPhoneNumber;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::fileExtension()
+{
+    return s_xesam()->xesam_fileExtension;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::fileSystemType()
+{
+    return s_xesam()->xesam_fileSystemType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::fingerprint()
+{
+    return s_xesam()->xesam_fingerprint;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::firstUsed()
+{
+    return s_xesam()->xesam_firstUsed;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::flashUsed()
+{
+    return s_xesam()->xesam_flashUsed;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::focalLength()
+{
+    return s_xesam()->xesam_focalLength;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::focusDistance()
+{
+    return s_xesam()->xesam_focusDistance;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::formatSubtype()
+{
+    return s_xesam()->xesam_formatSubtype;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::frameCount()
+{
+    return s_xesam()->xesam_frameCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::frameRate()
+{
+    return s_xesam()->xesam_frameRate;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::freeSpace()
+{
+    return s_xesam()->xesam_freeSpace;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::gender()
+{
+    return s_xesam()->xesam_gender;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::generator()
+{
+    return s_xesam()->xesam_generator;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::generatorOptions()
+{
+    return s_xesam()->xesam_generatorOptions;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::genre()
+{
+    return s_xesam()->xesam_genre;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::givenName()
+{
+    return s_xesam()->xesam_givenName;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::group()
+{
+    return s_xesam()->xesam_group;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::height()
+{
+    return s_xesam()->xesam_height;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::homeEmailAddress()
+{
+    return s_xesam()->xesam_homeEmailAddress;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::homePhoneNumber()
+{
+    return s_xesam()->xesam_homePhoneNumber;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::homePostalAddress()
+{
+    return s_xesam()->xesam_homePostalAddress;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::homepageContactURL()
+{
+    return s_xesam()->xesam_homepageContactURL;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::honorificPrefix()
+{
+    return s_xesam()->xesam_honorificPrefix;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::honorificSuffix()
+{
+    return s_xesam()->xesam_honorificSuffix;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::horizontalResolution()
+{
+    return s_xesam()->xesam_horizontalResolution;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::id()
+{
+    return s_xesam()->xesam_id;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::imContactMedium()
+{
+    return s_xesam()->xesam_imContactMedium;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::inReplyTo()
+{
+    return s_xesam()->xesam_inReplyTo;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::interest()
+{
+    return s_xesam()->xesam_interest;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::interlaceMode()
+{
+    return s_xesam()->xesam_interlaceMode;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::ircContactMedium()
+{
+    return s_xesam()->xesam_ircContactMedium;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isContentEncrypted()
+{
+    return s_xesam()->xesam_isContentEncrypted;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isEncrypted()
+{
+    return s_xesam()->xesam_isEncrypted;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isImportant()
+{
+    return s_xesam()->xesam_isImportant;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isInProgress()
+{
+    return s_xesam()->xesam_isInProgress;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isPublicChannel()
+{
+    return s_xesam()->xesam_isPublicChannel;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isRead()
+{
+    return s_xesam()->xesam_isRead;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isSourceEncrypted()
+{
+    return s_xesam()->xesam_isSourceEncrypted;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::isoEquivalent()
+{
+    return s_xesam()->xesam_isoEquivalent;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::jabberContactMedium()
+{
+    return s_xesam()->xesam_jabberContactMedium;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::keyword()
+{
+    return s_xesam()->xesam_keyword;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::knows()
+{
+    return s_xesam()->xesam_knows;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::language()
+{
+    return s_xesam()->xesam_language;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::lastRefreshed()
+{
+    return s_xesam()->xesam_lastRefreshed;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::lastUsed()
+{
+    return s_xesam()->xesam_lastUsed;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::legal()
+{
+    return s_xesam()->xesam_legal;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::license()
+{
+    return s_xesam()->xesam_license;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::licenseType()
+{
+    return s_xesam()->xesam_licenseType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::lineCount()
+{
+    return s_xesam()->xesam_lineCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::links()
+{
+    return s_xesam()->xesam_links;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::localRevision()
+{
+    return s_xesam()->xesam_localRevision;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::lyricist()
+{
+    return s_xesam()->xesam_lyricist;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mailingList()
+{
+    return s_xesam()->xesam_mailingList;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mailingPostalAddress()
+{
+    return s_xesam()->xesam_mailingPostalAddress;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::maintainer()
+{
+    return s_xesam()->xesam_maintainer;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::markupCharacterCount()
+{
+    return s_xesam()->xesam_markupCharacterCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::md5Hash()
+{
+    return s_xesam()->xesam_md5Hash;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mediaBitrate()
+{
+    return s_xesam()->xesam_mediaBitrate;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mediaCodec()
+{
+    return s_xesam()->xesam_mediaCodec;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mediaCodecType()
+{
+    return s_xesam()->xesam_mediaCodecType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mediaDuration()
+{
+    return s_xesam()->xesam_mediaDuration;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mergeConflict()
+{
+    return s_xesam()->xesam_mergeConflict;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::meteringMode()
+{
+    return s_xesam()->xesam_meteringMode;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mimeType()
+{
+    return s_xesam()->xesam_mimeType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::mountPoint()
+{
+    return s_xesam()->xesam_mountPoint;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::name()
+{
+    return s_xesam()->xesam_name;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::newsGroup()
+{
+    return s_xesam()->xesam_newsGroup;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::occupiedSpace()
+{
+    return s_xesam()->xesam_occupiedSpace;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::orientation()
+{
+    return s_xesam()->xesam_orientation;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::originURL()
+{
+    return s_xesam()->xesam_originURL;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::originalLocation()
+{
+    return s_xesam()->xesam_originalLocation;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::otherName()
+{
+    return s_xesam()->xesam_otherName;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::owner()
+{
+    return s_xesam()->xesam_owner;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::pageCount()
+{
+    return s_xesam()->xesam_pageCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::paragraphCount()
+{
+    return s_xesam()->xesam_paragraphCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::performer()
+{
+    return s_xesam()->xesam_performer;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::permissions()
+{
+    return s_xesam()->xesam_permissions;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::personPhoto()
+{
+    return s_xesam()->xesam_personPhoto;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::phoneNumber()
+{
+    return s_xesam()->xesam_phoneNumber;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::pixelDataBitDepth()
+{
+    return s_xesam()->xesam_pixelDataBitDepth;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::pixelDataType()
+{
+    return s_xesam()->xesam_pixelDataType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::postalAddress()
+{
+    return s_xesam()->xesam_postalAddress;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::primaryRecipient()
+{
+    return s_xesam()->xesam_primaryRecipient;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::programmingLanguage()
+{
+    return s_xesam()->xesam_programmingLanguage;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::receptionTime()
+{
+    return s_xesam()->xesam_receptionTime;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::recipient()
+{
+    return s_xesam()->xesam_recipient;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::related()
+{
+    return s_xesam()->xesam_related;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::remotePassword()
+{
+    return s_xesam()->xesam_remotePassword;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::remotePort()
+{
+    return s_xesam()->xesam_remotePort;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::remoteServer()
+{
+    return s_xesam()->xesam_remoteServer;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::remoteUser()
+{
+    return s_xesam()->xesam_remoteUser;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::replyTo()
+{
+    return s_xesam()->xesam_replyTo;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::rowCount()
+{
+    return s_xesam()->xesam_rowCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::rssFeed()
+{
+    return s_xesam()->xesam_rssFeed;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::sampleConfiguration()
+{
+    return s_xesam()->xesam_sampleConfiguration;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::sampleDataBitDepth()
+{
+    return s_xesam()->xesam_sampleDataBitDepth;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::sampleDataType()
+{
+    return s_xesam()->xesam_sampleDataType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::secondaryRecipient()
+{
+    return s_xesam()->xesam_secondaryRecipient;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::seenAttachedAs()
+{
+    return s_xesam()->xesam_seenAttachedAs;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::setCount()
+{
+    return s_xesam()->xesam_setCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::setRate()
+{
+    return s_xesam()->xesam_setRate;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::sha1Hash()
+{
+    return s_xesam()->xesam_sha1Hash;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::size()
+{
+    return s_xesam()->xesam_size;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::sourceCreated()
+{
+    return s_xesam()->xesam_sourceCreated;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::sourceModified()
+{
+    return s_xesam()->xesam_sourceModified;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::storageSize()
+{
+    return s_xesam()->xesam_storageSize;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::subject()
+{
+    return s_xesam()->xesam_subject;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::summary()
+{
+    return s_xesam()->xesam_summary;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::supercedes()
+{
+    return s_xesam()->xesam_supercedes;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::targetQuality()
+{
+    return s_xesam()->xesam_targetQuality;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::title()
+{
+    return s_xesam()->xesam_title;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::to()
+{
+    return s_xesam()->xesam_to;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::totalSpace()
+{
+    return s_xesam()->xesam_totalSpace;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::totalUncompressedSize()
+{
+    return s_xesam()->xesam_totalUncompressedSize;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::trackGain()
+{
+    return s_xesam()->xesam_trackGain;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::trackNumber()
+{
+    return s_xesam()->xesam_trackNumber;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::trackPeakGain()
+{
+    return s_xesam()->xesam_trackPeakGain;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::url()
+{
+    return s_xesam()->xesam_url;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::useCount()
+{
+    return s_xesam()->xesam_useCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::userComment()
+{
+    return s_xesam()->xesam_userComment;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::userKeyword()
+{
+    return s_xesam()->xesam_userKeyword;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::userRating()
+{
+    return s_xesam()->xesam_userRating;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::version()
+{
+    return s_xesam()->xesam_version;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::verticalResolution()
+{
+    return s_xesam()->xesam_verticalResolution;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::videoBitrate()
+{
+    return s_xesam()->xesam_videoBitrate;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::videoCodec()
+{
+    return s_xesam()->xesam_videoCodec;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::videoCodecType()
+{
+    return s_xesam()->xesam_videoCodecType;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::whiteBalance()
+{
+    return s_xesam()->xesam_whiteBalance;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::width()
+{
+    return s_xesam()->xesam_width;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::wordCount()
+{
+    return s_xesam()->xesam_wordCount;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::workEmailAddress()
+{
+    return s_xesam()->xesam_workEmailAddress;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::workPhoneNumber()
+{
+    return s_xesam()->xesam_workPhoneNumber;
+}
+
+Soprano::Node Soprano::Vocabulary::Xesam::Nodes::workPostalAddress()
 {
     return s_xesam()->xesam_workPostalAddress;
 }
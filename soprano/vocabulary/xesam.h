@@ -25,6 +25,8 @@
 #include "soprano_export.h"
 
 namespace Soprano {
+    class Node;
+
     namespace Vocabulary {
         namespace Xesam {
             /**
@@ -1975,6 +1977,286 @@ namespace Soprano {
              * Contact work address 
              */
             SOPRANO_EXPORT QUrl workPostalAddress();
+
+            /**
+             * The terms of this vocabulary as pre-built nodes. They are created once per
+             * process and can be used in place of Soprano::Node( QUrl ) to avoid
+             * constructing a new node on every use.
+             *
+             * \since 2.10
+             */
+            namespace Nodes {
+                SOPRANO_EXPORT Soprano::Node xesam35mmEquivalent();
+                SOPRANO_EXPORT Soprano::Node Annotation();
+                SOPRANO_EXPORT Soprano::Node Archive();
+                SOPRANO_EXPORT Soprano::Node ArchivedFile();
+                SOPRANO_EXPORT Soprano::Node Audio();
+                SOPRANO_EXPORT Soprano::Node AudioList();
+                SOPRANO_EXPORT Soprano::Node BlockDevice();
+                SOPRANO_EXPORT Soprano::Node Bookmark();
+                SOPRANO_EXPORT Soprano::Node CommunicationChannel();
+                SOPRANO_EXPORT Soprano::Node Contact();
+                SOPRANO_EXPORT Soprano::Node ContactGroup();
+                SOPRANO_EXPORT Soprano::Node Content();
+                SOPRANO_EXPORT Soprano::Node DataObject();
+                SOPRANO_EXPORT Soprano::Node DeletedFile();
+                SOPRANO_EXPORT Soprano::Node Document();
+                SOPRANO_EXPORT Soprano::Node Documentation();
+                SOPRANO_EXPORT Soprano::Node Email();
+                SOPRANO_EXPORT Soprano::Node EmailAttachment();
+                SOPRANO_EXPORT Soprano::Node EmbeddedObject();
+                SOPRANO_EXPORT Soprano::Node File();
+                SOPRANO_EXPORT Soprano::Node FileSystem();
+                SOPRANO_EXPORT Soprano::Node Filelike();
+                SOPRANO_EXPORT Soprano::Node Folder();
+                SOPRANO_EXPORT Soprano::Node IMAP4Message();
+                SOPRANO_EXPORT Soprano::Node IMMessage();
+                SOPRANO_EXPORT Soprano::Node Image();
+                SOPRANO_EXPORT Soprano::Node MailingList();
+                SOPRANO_EXPORT Soprano::Node MailingListEmail();
+                SOPRANO_EXPORT Soprano::Node Media();
+                SOPRANO_EXPORT Soprano::Node MediaList();
+                SOPRANO_EXPORT Soprano::Node Message();
+                SOPRANO_EXPORT Soprano::Node MessageboxMessage();
+                SOPRANO_EXPORT Soprano::Node Music();
+                SOPRANO_EXPORT Soprano::Node NewsGroup();
+                SOPRANO_EXPORT Soprano::Node NewsGroupEmail();
+                SOPRANO_EXPORT Soprano::Node OfflineMedia();
+                SOPRANO_EXPORT Soprano::Node Organization();
+                SOPRANO_EXPORT Soprano::Node POP3Message();
+                SOPRANO_EXPORT Soprano::Node Person();
+                SOPRANO_EXPORT Soprano::Node PersonalEmail();
+                SOPRANO_EXPORT Soprano::Node Photo();
+                SOPRANO_EXPORT Soprano::Node Presentation();
+                SOPRANO_EXPORT Soprano::Node Project();
+                SOPRANO_EXPORT Soprano::Node RSSFeed();
+                SOPRANO_EXPORT Soprano::Node RSSMessage();
+                SOPRANO_EXPORT Soprano::Node RemoteFile();
+                SOPRANO_EXPORT Soprano::Node RemoteMessageboxMessage();
+                SOPRANO_EXPORT Soprano::Node RemoteResource();
+                SOPRANO_EXPORT Soprano::Node RevisionControlledFile();
+                SOPRANO_EXPORT Soprano::Node RevisionControlledRepository();
+                SOPRANO_EXPORT Soprano::Node SoftwarePackage();
+                SOPRANO_EXPORT Soprano::Node Source();
+                SOPRANO_EXPORT Soprano::Node SourceCode();
+                SOPRANO_EXPORT Soprano::Node Spreadsheet();
+                SOPRANO_EXPORT Soprano::Node SystemResource();
+                SOPRANO_EXPORT Soprano::Node Tag();
+                SOPRANO_EXPORT Soprano::Node Text();
+                SOPRANO_EXPORT Soprano::Node TextDocument();
+                SOPRANO_EXPORT Soprano::Node UncategorizedText();
+                SOPRANO_EXPORT Soprano::Node Video();
+                SOPRANO_EXPORT Soprano::Node Visual();
+                SOPRANO_EXPORT Soprano::Node XML();
+                SOPRANO_EXPORT Soprano::Node acl();
+                SOPRANO_EXPORT Soprano::Node album();
+                SOPRANO_EXPORT Soprano::Node albumArtist();
+                SOPRANO_EXPORT Soprano::Node albumGain();
+                SOPRANO_EXPORT Soprano::Node albumPeakGain();
+                SOPRANO_EXPORT Soprano::Node albumTrackCount();
+                SOPRANO_EXPORT Soprano::Node aperture();
+                SOPRANO_EXPORT Soprano::Node artist();
+                SOPRANO_EXPORT Soprano::Node asText();
+                SOPRANO_EXPORT Soprano::Node aspectRatio();
+                SOPRANO_EXPORT Soprano::Node attachmentEncoding();
+                SOPRANO_EXPORT Soprano::Node audioBPM();
+                SOPRANO_EXPORT Soprano::Node audioBitrate();
+                SOPRANO_EXPORT Soprano::Node audioChannels();
+                SOPRANO_EXPORT Soprano::Node audioCodec();
+                SOPRANO_EXPORT Soprano::Node audioCodecType();
+                SOPRANO_EXPORT Soprano::Node audioSampleBitDepth();
+                SOPRANO_EXPORT Soprano::Node audioSampleCount();
+                SOPRANO_EXPORT Soprano::Node audioSampleDataType();
+                SOPRANO_EXPORT Soprano::Node audioSampleRate();
+                SOPRANO_EXPORT Soprano::Node author();
+                SOPRANO_EXPORT Soprano::Node autoRating();
+                SOPRANO_EXPORT Soprano::Node baseRevisionID();
+                SOPRANO_EXPORT Soprano::Node bcc();
+                SOPRANO_EXPORT Soprano::Node birthDate();
+                SOPRANO_EXPORT Soprano::Node blogContactURL();
+                SOPRANO_EXPORT Soprano::Node cameraManufacturer();
+                SOPRANO_EXPORT Soprano::Node cameraModel();
+                SOPRANO_EXPORT Soprano::Node cc();
+                SOPRANO_EXPORT Soprano::Node ccdWidth();
+                SOPRANO_EXPORT Soprano::Node cellPhoneNumber();
+                SOPRANO_EXPORT Soprano::Node changeCommitTime();
+                SOPRANO_EXPORT Soprano::Node changeCommitter();
+                SOPRANO_EXPORT Soprano::Node characterCount();
+                SOPRANO_EXPORT Soprano::Node charset();
+                SOPRANO_EXPORT Soprano::Node chatRoom();
+                SOPRANO_EXPORT Soprano::Node colorCount();
+                SOPRANO_EXPORT Soprano::Node colorSpace();
+                SOPRANO_EXPORT Soprano::Node columnCount();
+                SOPRANO_EXPORT Soprano::Node comment();
+                SOPRANO_EXPORT Soprano::Node commentCharacterCount();
+                SOPRANO_EXPORT Soprano::Node commitDiff();
+                SOPRANO_EXPORT Soprano::Node communicationChannel();
+                SOPRANO_EXPORT Soprano::Node composer();
+                SOPRANO_EXPORT Soprano::Node compressionAlgorithm();
+                SOPRANO_EXPORT Soprano::Node compressionLevel();
+                SOPRANO_EXPORT Soprano::Node conflicts();
+                SOPRANO_EXPORT Soprano::Node contactMedium();
+                SOPRANO_EXPORT Soprano::Node contactNick();
+                SOPRANO_EXPORT Soprano::Node contactURL();
+                SOPRANO_EXPORT Soprano::Node contains();
+                SOPRANO_EXPORT Soprano::Node contentComment();
+                SOPRANO_EXPORT Soprano::Node contentCreated();
+                SOPRANO_EXPORT Soprano::Node contentKeyword();
+                SOPRANO_EXPORT Soprano::Node contentModified();
+                SOPRANO_EXPORT Soprano::Node contentType();
+                SOPRANO_EXPORT Soprano::Node contributor();
+                SOPRANO_EXPORT Soprano::Node copyright();
+                SOPRANO_EXPORT Soprano::Node creator();
+                SOPRANO_EXPORT Soprano::Node definesClass();
+                SOPRANO_EXPORT Soprano::Node definesFunction();
+                SOPRANO_EXPORT Soprano::Node definesGlobalVariable();
+                SOPRANO_EXPORT Soprano::Node deletionTime();
+                SOPRANO_EXPORT Soprano::Node depends();
+                SOPRANO_EXPORT Soprano::Node derivedFrom();
+                SOPRANO_EXPORT Soprano::Node description();
+                SOPRANO_EXPORT Soprano::Node discNumber();
+                SOPRANO_EXPORT Soprano::Node disclaimer();
+                SOPRANO_EXPORT Soprano::Node documentCategory();
+                SOPRANO_EXPORT Soprano::Node emailAddress();
+                SOPRANO_EXPORT Soprano::Node exposureBias();
+                SOPRANO_EXPORT Soprano::Node exposureProgram();
+                SOPRANO_EXPORT Soprano::Node exposureTime();
+                SOPRANO_EXPORT Soprano::Node familyName();
+                SOPRANO_EXPORT Soprano::Node faxPhoneNumber();
+                SOPRANO_EXPORT Soprano::Node fileExtension();
+                SOPRANO_EXPORT Soprano::Node fileSystemType();
+                SOPRANO_EXPORT Soprano::Node fingerprint();
+                SOPRANO_EXPORT Soprano::Node firstUsed();
+                SOPRANO_EXPORT Soprano::Node flashUsed();
+                SOPRANO_EXPORT Soprano::Node focalLength();
+                SOPRANO_EXPORT Soprano::Node focusDistance();
+                SOPRANO_EXPORT Soprano::Node formatSubtype();
+                SOPRANO_EXPORT Soprano::Node frameCount();
+                SOPRANO_EXPORT Soprano::Node frameRate();
+                SOPRANO_EXPORT Soprano::Node freeSpace();
+                SOPRANO_EXPORT Soprano::Node gender();
+                SOPRANO_EXPORT Soprano::Node generator();
+                SOPRANO_EXPORT Soprano::Node generatorOptions();
+                SOPRANO_EXPORT Soprano::Node genre();
+                SOPRANO_EXPORT Soprano::Node givenName();
+                SOPRANO_EXPORT Soprano::Node group();
+                SOPRANO_EXPORT Soprano::Node height();
+                SOPRANO_EXPORT Soprano::Node homeEmailAddress();
+                SOPRANO_EXPORT Soprano::Node homePhoneNumber();
+                SOPRANO_EXPORT Soprano::Node homePostalAddress();
+                SOPRANO_EXPORT Soprano::Node homepageContactURL();
+                SOPRANO_EXPORT Soprano::Node honorificPrefix();
+                SOPRANO_EXPORT Soprano::Node honorificSuffix();
+                SOPRANO_EXPORT Soprano::Node horizontalResolution();
+                SOPRANO_EXPORT Soprano::Node id();
+                SOPRANO_EXPORT Soprano::Node imContactMedium();
+                SOPRANO_EXPORT Soprano::Node inReplyTo();
+                SOPRANO_EXPORT Soprano::Node interest();
+                SOPRANO_EXPORT Soprano::Node interlaceMode();
+                SOPRANO_EXPORT Soprano::Node ircContactMedium();
+                SOPRANO_EXPORT Soprano::Node isContentEncrypted();
+                SOPRANO_EXPORT Soprano::Node isEncrypted();
+                SOPRANO_EXPORT Soprano::Node isImportant();
+                SOPRANO_EXPORT Soprano::Node isInProgress();
+                SOPRANO_EXPORT Soprano::Node isPublicChannel();
+                SOPRANO_EXPORT Soprano::Node isRead();
+                SOPRANO_EXPORT Soprano::Node isSourceEncrypted();
+                SOPRANO_EXPORT Soprano::Node isoEquivalent();
+                SOPRANO_EXPORT Soprano::Node jabberContactMedium();
+                SOPRANO_EXPORT Soprano::Node keyword();
+                SOPRANO_EXPORT Soprano::Node knows();
+                SOPRANO_EXPORT Soprano::Node language();
+                SOPRANO_EXPORT Soprano::Node lastRefreshed();
+                SOPRANO_EXPORT Soprano::Node lastUsed();
+                SOPRANO_EXPORT Soprano::Node legal();
+                SOPRANO_EXPORT Soprano::Node license();
+                SOPRANO_EXPORT Soprano::Node licenseType();
+                SOPRANO_EXPORT Soprano::Node lineCount();
+                SOPRANO_EXPORT Soprano::Node links();
+                SOPRANO_EXPORT Soprano::Node localRevision();
+                SOPRANO_EXPORT Soprano::Node lyricist();
+                SOPRANO_EXPORT Soprano::Node mailingList();
+                SOPRANO_EXPORT Soprano::Node mailingPostalAddress();
+                SOPRANO_EXPORT Soprano::Node maintainer();
+                SOPRANO_EXPORT Soprano::Node markupCharacterCount();
+                SOPRANO_EXPORT Soprano::Node md5Hash();
+                SOPRANO_EXPORT Soprano::Node mediaBitrate();
+                SOPRANO_EXPORT Soprano::Node mediaCodec();
+                SOPRANO_EXPORT Soprano::Node mediaCodecType();
+                SOPRANO_EXPORT Soprano::Node mediaDuration();
+                SOPRANO_EXPORT Soprano::Node mergeConflict();
+                SOPRANO_EXPORT Soprano::Node meteringMode();
+                SOPRANO_EXPORT Soprano::Node mimeType();
+                SOPRANO_EXPORT Soprano::Node mountPoint();
+                SOPRANO_EXPORT Soprano::Node name();
+                SOPRANO_EXPORT Soprano::Node newsGroup();
+                SOPRANO_EXPORT Soprano::Node occupiedSpace();
+                SOPRANO_EXPORT Soprano::Node orientation();
+                SOPRANO_EXPORT Soprano::Node originURL();
+                SOPRANO_EXPORT Soprano::Node originalLocation();
+                SOPRANO_EXPORT Soprano::Node otherName();
+                SOPRANO_EXPORT Soprano::Node owner();
+                SOPRANO_EXPORT Soprano::Node pageCount();
+                SOPRANO_EXPORT Soprano::Node paragraphCount();
+                SOPRANO_EXPORT Soprano::Node performer();
+                SOPRANO_EXPORT Soprano::Node permissions();
+                SOPRANO_EXPORT Soprano::Node personPhoto();
+                SOPRANO_EXPORT Soprano::Node phoneNumber();
+                SOPRANO_EXPORT Soprano::Node pixelDataBitDepth();
+                SOPRANO_EXPORT Soprano::Node pixelDataType();
+                SOPRANO_EXPORT Soprano::Node postalAddress();
+                SOPRANO_EXPORT Soprano::Node primaryRecipient();
+                SOPRANO_EXPORT Soprano::Node programmingLanguage();
+                SOPRANO_EXPORT Soprano::Node receptionTime();
+                SOPRANO_EXPORT Soprano::Node recipient();
+                SOPRANO_EXPORT Soprano::Node related();
+                SOPRANO_EXPORT Soprano::Node remotePassword();
+                SOPRANO_EXPORT Soprano::Node remotePort();
+                SOPRANO_EXPORT Soprano::Node remoteServer();
+                SOPRANO_EXPORT Soprano::Node remoteUser();
+                SOPRANO_EXPORT Soprano::Node replyTo();
+                SOPRANO_EXPORT Soprano::Node rowCount();
+                SOPRANO_EXPORT Soprano::Node rssFeed();
+                SOPRANO_EXPORT Soprano::Node sampleConfiguration();
+                SOPRANO_EXPORT Soprano::Node sampleDataBitDepth();
+                SOPRANO_EXPORT Soprano::Node sampleDataType();
+                SOPRANO_EXPORT Soprano::Node secondaryRecipient();
+                SOPRANO_EXPORT Soprano::Node seenAttachedAs();
+                SOPRANO_EXPORT Soprano::Node setCount();
+                SOPRANO_EXPORT Soprano::Node setRate();
+                SOPRANO_EXPORT Soprano::Node sha1Hash();
+                SOPRANO_EXPORT Soprano::Node size();
+                SOPRANO_EXPORT Soprano::Node sourceCreated();
+                SOPRANO_EXPORT Soprano::Node sourceModified();
+                SOPRANO_EXPORT Soprano::Node storageSize();
+                SOPRANO_EXPORT Soprano::Node subject();
+                SOPRANO_EXPORT Soprano::Node summary();
+                SOPRANO_EXPORT Soprano::Node supercedes();
+                SOPRANO_EXPORT Soprano::Node targetQuality();
+                SOPRANO_EXPORT Soprano::Node title();
+                SOPRANO_EXPORT Soprano::Node to();
+                SOPRANO_EXPORT Soprano::Node totalSpace();
+                SOPRANO_EXPORT Soprano::Node totalUncompressedSize();
+                SOPRANO_EXPORT Soprano::Node trackGain();
+                SOPRANO_EXPORT Soprano::Node trackNumber();
+                SOPRANO_EXPORT Soprano::Node trackPeakGain();
+                SOPRANO_EXPORT Soprano::Node url();
+                SOPRANO_EXPORT Soprano::Node useCount();
+                SOPRANO_EXPORT Soprano::Node userComment();
+                SOPRANO_EXPORT Soprano::Node userKeyword();
+                SOPRANO_EXPORT Soprano::Node userRating();
+                SOPRANO_EXPORT Soprano::Node version();
+                SOPRANO_EXPORT Soprano::Node verticalResolution();
+                SOPRANO_EXPORT Soprano::Node videoBitrate();
+                SOPRANO_EXPORT Soprano::Node videoCodec();
+                SOPRANO_EXPORT Soprano::Node videoCodecType();
+                SOPRANO_EXPORT Soprano::Node whiteBalance();
+                SOPRANO_EXPORT Soprano::Node width();
+                SOPRANO_EXPORT Soprano::Node wordCount();
+                SOPRANO_EXPORT Soprano::Node workEmailAddress();
+                SOPRANO_EXPORT Soprano::Node workPhoneNumber();
+                SOPRANO_EXPORT Soprano::Node workPostalAddress();
+            }
         }
     }
 }
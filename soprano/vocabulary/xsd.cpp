@@ -20,172 +20,290 @@
  */
 
 #include "xsd.h"
-#include <QThreadStorage>
+#include "node.h"
+
+namespace {
+    Soprano::Node createNode( const char* uri )
+    {
+        const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );
+#if QT_VERSION < 0x050000
+        // QUrl parses and normalizes on demand which is not thread-safe in Qt4.
+        // Trigger it now, before the constants are shared between threads.
+        url.isValid();
+        url.host();
+        (void)( url == QUrl( url ) );
+#endif
+        return Soprano::Node( url );
+    }
+}
 
 
 class XMLSchema
 {
 public:
     XMLSchema()
-        : xsdNamespace( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#", QUrl::StrictMode ) ),
-          xsdInt( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#int", QUrl::StrictMode ) ),
-          xsdInteger( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#integer", QUrl::StrictMode ) ),
-          xsdNegativeInteger( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#negativeInteger", QUrl::StrictMode ) ),
-          xsdNonNegativeInteger( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#nonNegativeInteger", QUrl::StrictMode ) ),
-          xsdDecimal( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#decimal", QUrl::StrictMode ) ),
-          xsdShort( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#short", QUrl::StrictMode ) ),
-          xsdLong( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#long", QUrl::StrictMode ) ),
-          xsdUnsignedInt( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#unsignedInt", QUrl::StrictMode ) ),
-          xsdUnsignedShort( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#unsignedShort", QUrl::StrictMode ) ),
-          xsdUnsignedLong( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#unsignedLong", QUrl::StrictMode ) ),
-          xsdBoolean( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#boolean", QUrl::StrictMode ) ),
-          xsdDouble( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#double", QUrl::StrictMode ) ),
-          xsdFloat( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#float", QUrl::StrictMode ) ),
-          xsdString( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#string", QUrl::StrictMode ) ),
-          xsdDate( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#date", QUrl::StrictMode ) ),
-          xsdTime( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#time", QUrl::StrictMode ) ),
-          xsdDateTime( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#dateTime", QUrl::StrictMode ) ),
-          xsdBase64Binary( QUrl::fromEncoded( "http://www.w3.org/2001/XMLSchema#base64Binary", QUrl::StrictMode ) ) {
+        : xsdNamespace( createNode( "http://www.w3.org/2001/XMLSchema#" ) ),
+          xsdInt( createNode( "http://www.w3.org/2001/XMLSchema#int" ) ),
+          xsdInteger( createNode( "http://www.w3.org/2001/XMLSchema#integer" ) ),
+          xsdNegativeInteger( createNode( "http://www.w3.org/2001/XMLSchema#negativeInteger" ) ),
+          xsdNonNegativeInteger( createNode( "http://www.w3.org/2001/XMLSchema#nonNegativeInteger" ) ),
+          xsdDecimal( createNode( "http://www.w3.org/2001/XMLSchema#decimal" ) ),
+          xsdShort( createNode( "http://www.w3.org/2001/XMLSchema#short" ) ),
+          xsdLong( createNode( "http://www.w3.org/2001/XMLSchema#long" ) ),
+          xsdUnsignedInt( createNode( "http://www.w3.org/2001/XMLSchema#unsignedInt" ) ),
+          xsdUnsignedShort( createNode( "http://www.w3.org/2001/XMLSchema#unsignedShort" ) ),
+          xsdUnsignedLong( createNode( "http://www.w3.org/2001/XMLSchema#unsignedLong" ) ),
+          xsdBoolean( createNode( "http://www.w3.org/2001/XMLSchema#boolean" ) ),
+          xsdDouble( createNode( "http://www.w3.org/2001/XMLSchema#double" ) ),
+          xsdFloat( createNode( "http://www.w3.org/2001/XMLSchema#float" ) ),
+          xsdString( createNode( "http://www.w3.org/2001/XMLSchema#string" ) ),
+          xsdDate( createNode( "http://www.w3.org/2001/XMLSchema#date" ) ),
+          xsdTime( createNode( "http://www.w3.org/2001/XMLSchema#time" ) ),
+          xsdDateTime( createNode( "http://www.w3.org/2001/XMLSchema#dateTime" ) ),
+          xsdBase64Binary( createNode( "http://www.w3.org/2001/XMLSchema#base64Binary" ) ) {
     }
 
-    QUrl xsdNamespace;
-    QUrl xsdInt;
-    QUrl xsdInteger;
-    QUrl xsdNegativeInteger;
-    QUrl xsdNonNegativeInteger;
-    QUrl xsdDecimal;
-    QUrl xsdShort;
-    QUrl xsdLong;
-    QUrl xsdUnsignedInt;
-    QUrl xsdUnsignedShort;
-    QUrl xsdUnsignedLong;
-    QUrl xsdBoolean;
-    QUrl xsdDouble;
-    QUrl xsdFloat;
-    QUrl xsdString;
-    QUrl xsdDate;
-    QUrl xsdTime;
-    QUrl xsdDateTime;
-    QUrl xsdBase64Binary;
+    Soprano::Node xsdNamespace;
+    Soprano::Node xsdInt;
+    Soprano::Node xsdInteger;
+    Soprano::Node xsdNegativeInteger;
+    Soprano::Node xsdNonNegativeInteger;
+    Soprano::Node xsdDecimal;
+    Soprano::Node xsdShort;
+    Soprano::Node xsdLong;
+    Soprano::Node xsdUnsignedInt;
+    Soprano::Node xsdUnsignedShort;
+    Soprano::Node xsdUnsignedLong;
+    Soprano::Node xsdBoolean;
+    Soprano::Node xsdDouble;
+    Soprano::Node xsdFloat;
+    Soprano::Node xsdString;
+    Soprano::Node xsdDate;
+    Soprano::Node xsdTime;
+    Soprano::Node xsdDateTime;
+    Soprano::Node xsdBase64Binary;
 };
 
-QThreadStorage<XMLSchema*> qts_xsd;
-XMLSchema* xsd() {
-    if( !qts_xsd.hasLocalData() )
-        qts_xsd.setLocalData( new XMLSchema );
-    return qts_xsd.localData();
-}
+Q_GLOBAL_STATIC( XMLSchema, xsd )
 
 
 QUrl Soprano::Vocabulary::XMLSchema::xsdNamespace()
 {
-    return xsd()->xsdNamespace;
+    return xsd()->xsdNamespace.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::xsdInt()
 {
-    return xsd()->xsdInt;
+    return xsd()->xsdInt.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::integer()
 {
-    return xsd()->xsdInteger;
+    return xsd()->xsdInteger.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::negativeInteger()
 {
-    return xsd()->xsdNegativeInteger;
+    return xsd()->xsdNegativeInteger.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::nonNegativeInteger()
 {
-    return xsd()->xsdNonNegativeInteger;
+    return xsd()->xsdNonNegativeInteger.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::decimal()
 {
-    return xsd()->xsdDecimal;
+    return xsd()->xsdDecimal.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::xsdShort()
 {
-    return xsd()->xsdShort;
+    return xsd()->xsdShort.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::xsdLong()
 {
-    return xsd()->xsdLong;
+    return xsd()->xsdLong.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::unsignedInt()
 {
-    return xsd()->xsdUnsignedInt;
+    return xsd()->xsdUnsignedInt.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::unsignedShort()
 {
-    return xsd()->xsdUnsignedShort;
+    return xsd()->xsdUnsignedShort.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::unsignedLong()
 {
-    return xsd()->xsdUnsignedLong;
+    return xsd()->xsdUnsignedLong.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::string()
 {
-    return xsd()->xsdString;
+    return xsd()->xsdString.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::xsdDouble()
 {
-    return xsd()->xsdDouble;
+    return xsd()->xsdDouble.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::xsdFloat()
 {
-    return xsd()->xsdFloat;
+    return xsd()->xsdFloat.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::boolean()
 {
-    return xsd()->xsdBoolean;
+    return xsd()->xsdBoolean.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::date()
 {
-    return xsd()->xsdDate;
+    return xsd()->xsdDate.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::time()
 {
-    return xsd()->xsdTime;
+    return xsd()->xsdTime.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::dateTime()
 {
-    return xsd()->xsdDateTime;
+    return xsd()->xsdDateTime.uri();
 }
 
 
 QUrl Soprano::Vocabulary::XMLSchema::base64Binary()
+{
+    return xsd()->xsdBase64Binary.uri();
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::xsdInt()
+{
+    return xsd()->xsdInt;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::integer()
+{
+    return xsd()->xsdInteger;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::negativeInteger()
+{
+    return xsd()->xsdNegativeInteger;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::nonNegativeInteger()
+{
+    return xsd()->xsdNonNegativeInteger;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::decimal()
+{
+    return xsd()->xsdDecimal;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::xsdShort()
+{
+    return xsd()->xsdShort;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::xsdLong()
+{
+    return xsd()->xsdLong;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::unsignedInt()
+{
+    return xsd()->xsdUnsignedInt;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::unsignedShort()
+{
+    return xsd()->xsdUnsignedShort;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::unsignedLong()
+{
+    return xsd()->xsdUnsignedLong;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::string()
+{
+    return xsd()->xsdString;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::xsdDouble()
+{
+    return xsd()->xsdDouble;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::xsdFloat()
+{
+    return xsd()->xsdFloat;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::boolean()
+{
+    return xsd()->xsdBoolean;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::date()
+{
+    return xsd()->xsdDate;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::time()
+{
+    return xsd()->xsdTime;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::dateTime()
+{
+    return xsd()->xsdDateTime;
+}
+
+
+Soprano::Node Soprano::Vocabulary::XMLSchema::Nodes::base64Binary()
 {
     return xsd()->xsdBase64Binary;
 }
@@ -26,6 +26,8 @@
 #include "soprano_export.h"
 
 namespace Soprano {
+    class Node;
+
     namespace Vocabulary {
         namespace XMLSchema {
             /**
@@ -50,6 +52,34 @@ namespace Soprano {
             SOPRANO_EXPORT QUrl dateTime();
             SOPRANO_EXPORT QUrl time();
             SOPRANO_EXPORT QUrl base64Binary();
+
+            /**
+             * The terms of this vocabulary as pre-built nodes. They are created once per
+             * process and can be used in place of Soprano::Node( QUrl ) to avoid
+             * constructing a new node on every use.
+             *
+             * \since 2.10
+             */
+            namespace Nodes {
+                SOPRANO_EXPORT Soprano::Node xsdInt();
+                SOPRANO_EXPORT Soprano::Node integer();
+                SOPRANO_EXPORT Soprano::Node negativeInteger();
+                SOPRANO_EXPORT Soprano::Node nonNegativeInteger();
+                SOPRANO_EXPORT Soprano::Node decimal();
+                SOPRANO_EXPORT Soprano::Node xsdShort();
+                SOPRANO_EXPORT Soprano::Node xsdLong();
+                SOPRANO_EXPORT Soprano::Node unsignedInt();
+                SOPRANO_EXPORT Soprano::Node unsignedShort();
+                SOPRANO_EXPORT Soprano::Node unsignedLong();
+                SOPRANO_EXPORT Soprano::Node string();
+                SOPRANO_EXPORT Soprano::Node xsdDouble();
+                SOPRANO_EXPORT Soprano::Node xsdFloat();
+                SOPRANO_EXPORT Soprano::Node boolean();
+                SOPRANO_EXPORT Soprano::Node date();
+                SOPRANO_EXPORT Soprano::Node time();
+                SOPRANO_EXPORT Soprano::Node dateTime();
+                SOPRANO_EXPORT Soprano::Node base64Binary();
+            }
         }
     }
 }
@@ -0,0 +1,80 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "MemoryModelTest.h"
+
+#include "soprano.h"
+
+using namespace Soprano;
+
+
+MemoryModelTest::MemoryModelTest()
+{
+    setSupportedBackendFeatures( BackendFeatureAddStatement|
+                                 BackendFeatureRemoveStatements|
+                                 BackendFeatureListStatements|
+                                 BackendFeatureQuery|
+                                 BackendFeatureContext|
+                                 BackendFeatureStorageMemory );
+}
+
+
+Soprano::Model* MemoryModelTest::createModel()
+{
+    const Backend* b = Soprano::discoverBackendByName( "memory" );
+    if ( !b ) {
+        return 0;
+    }
+
+    return b->createModel();
+}
+
+void MemoryModelTest::testModifyWhileIterating()
+{
+    Model* model = createModel();
+    QVERIFY( model );
+
+    // more statements than the iterator reads at once
+    const Node subject = Node( QUrl( "http://soprano.sf.net/test#subject" ) );
+    const Node predicate = Node( QUrl( "http://soprano.sf.net/test#predicate" ) );
+    const Node other = Node( QUrl( "http://soprano.sf.net/test#other" ) );
+    for ( int i = 0; i < 500; ++i ) {
+        QCOMPARE( model->addStatement( subject, predicate, LiteralValue( i ) ), Error::ErrorNone );
+    }
+
+    // removing the current statement and adding others must not disturb the iterator
+    QSet<int> values;
+    StatementIterator it = model->listStatements( subject, predicate, Node() );
+    while ( it.next() ) {
+        const Statement s = *it;
+        values.insert( s.object().literal().toInt() );
+        QCOMPARE( model->removeStatement( s ), Error::ErrorNone );
+        QCOMPARE( model->addStatement( subject, other, s.object() ), Error::ErrorNone );
+    }
+
+    QCOMPARE( values.count(), 500 );
+    QVERIFY( !model->containsAnyStatement( subject, predicate, Node() ) );
+    QCOMPARE( model->statementCount(), 500 );
+
+    delete model;
+}
+
+QTEST_MAIN(MemoryModelTest)
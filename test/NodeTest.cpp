@@ -137,5 +137,119 @@ void NodeTest::testToN3()
     QCOMPARE( node.toN3(), n3 );
 }
 
+void NodeTest::testTypeChanges()
+{
+    // the type is stored with the data, assignments have to replace it
+    Node node( QUrl( "uri:soprano:test" ) );
+    QVERIFY( node.isResource() );
+
+    node = LiteralValue( 42 );
+    QCOMPARE( node.type(), Node::LiteralNode );
+    QVERIFY( node.isLiteral() );
+    QVERIFY( !node.isResource() );
+    QVERIFY( node.uri().isEmpty() );
+
+    node = Node( QString( "blank" ) );
+    QCOMPARE( node.type(), Node::BlankNode );
+    QVERIFY( node.isBlank() );
+    QVERIFY( !node.literal().isValid() );
+    QCOMPARE( node.identifier(), QString( "blank" ) );
+
+    node = QUrl();
+    QCOMPARE( node.type(), Node::EmptyNode );
+    QVERIFY( !node.isValid() );
+
+    node = LiteralValue();
+    QCOMPARE( node.type(), Node::EmptyNode );
+
+    // copies share the data but not the type changes
+    Node resource( QUrl( "uri:soprano:test" ) );
+    Node copy( resource );
+    copy = LiteralValue( "foo" );
+    QVERIFY( resource.isResource() );
+    QVERIFY( copy.isLiteral() );
+}
+
+void NodeTest::testHash()
+{
+    const Node resource( QUrl( "uri:soprano:test" ) );
+
+    // calculated once and cached afterwards
+    const uint hash = qHash( resource );
+    QCOMPARE( qHash( resource ), hash );
+    QCOMPARE( qHash( Node( resource ) ), hash );
+    QCOMPARE( qHash( Node( QUrl( "uri:soprano:test" ) ) ), hash );
+
+    // the type is part of the hash
+    QVERIFY( qHash( Node( QString( "uri:soprano:test" ) ) ) != hash );
+    QVERIFY( qHash( Node( LiteralValue::createPlainLiteral( "uri:soprano:test" ) ) ) != hash );
+
+    QCOMPARE( qHash( Node() ), uint( 0 ) );
+
+    // a reassigned node does not keep the old hash
+    Node node( resource );
+    QCOMPARE( qHash( node ), hash );
+    node = LiteralValue( 42 );
+    QCOMPARE( qHash( node ), qHash( Node( LiteralValue( 42 ) ) ) );
+}
+
+namespace {
+    class HashThread : public QThread
+    {
+    public:
+        HashThread( const QList<Node>& nodes, QSemaphore* start )
+            : m_nodes( nodes ),
+              m_start( start ) {
+        }
+
+        void run() {
+            m_start->acquire();
+            Q_FOREACH( const Node& node, m_nodes ) {
+                m_hashes << qHash( node );
+            }
+        }
+
+        QList<uint> m_hashes;
+
+    private:
+        QList<Node> m_nodes;
+        QSemaphore* m_start;
+    };
+}
+
+void NodeTest::testConcurrentHash()
+{
+    const int threadCount = 8;
+
+    // shared by all threads and not hashed before
+    QList<Node> nodes;
+    for ( int i = 0; i < 1000; ++i ) {
+        nodes << Node( QUrl( QString( "uri:soprano:test%1" ).arg( i ) ) )
+              << Node( LiteralValue( i ) );
+    }
+
+    QSemaphore start;
+    QList<HashThread*> threads;
+    for ( int i = 0; i < threadCount; ++i ) {
+        threads << new HashThread( nodes, &start );
+        threads.last()->start();
+    }
+    start.release( threadCount );
+    Q_FOREACH( HashThread* thread, threads ) {
+        QVERIFY( thread->wait( 20000 ) );
+    }
+
+    // compare against hashes of unshared nodes
+    QList<uint> expected;
+    for ( int i = 0; i < 1000; ++i ) {
+        expected << qHash( Node( QUrl( QString( "uri:soprano:test%1" ).arg( i ) ) ) )
+                 << qHash( Node( LiteralValue( i ) ) );
+    }
+    Q_FOREACH( HashThread* thread, threads ) {
+        QCOMPARE( thread->m_hashes, expected );
+    }
+    qDeleteAll( threads );
+}
+
 QTEST_MAIN(NodeTest)
 
@@ -36,6 +36,9 @@ private slots:
     void testCreateLiteralNode();
     void testToN3_data();
     void testToN3();
+    void testTypeChanges();
+    void testHash();
+    void testConcurrentHash();
 };
 
 #endif // NODE_TEST_H
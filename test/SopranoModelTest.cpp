@@ -26,6 +26,7 @@
 
 #include <QtTest/QTest>
 #include <QtCore/QList>
+#include <QtCore/QSet>
 #include <QtCore/QDebug>
 #include <QtCore/QTime>
 #include <QtCore/QUrl>
@@ -450,6 +451,70 @@ void SopranoModelTest::testRemoveGraph()
 }
 
 
+void SopranoModelTest::testTakeAllStatements()
+{
+    QVERIFY( m_model != 0 );
+
+    QUrl graph1 = createRandomUri();
+    QUrl graph2 = createRandomUri();
+    Statement statementPattern1;
+    statementPattern1.setContext( graph1 );
+    Statement statementPattern2;
+    statementPattern2.setContext( graph2 );
+    QList<Statement> graph1Data = createTestData( statementPattern1, 10 );
+    QList<Statement> graph2Data = createTestData( statementPattern2, 10 );
+
+    m_model->addStatements( graph1Data );
+    m_model->addStatements( graph2Data );
+
+    waitForSignals();
+
+    qRegisterMetaType<Soprano::Statement>( "Soprano::Statement" );
+    QSignalSpy spy( m_model, SIGNAL(statementRemoved(Soprano::Statement)) );
+
+    // a pattern matching some statements of one graph
+    Statement pattern( graph1Data.first().subject(), Node(), Node() );
+    QList<Statement> expected = m_model->listStatements( pattern ).allStatements();
+    QVERIFY( !expected.isEmpty() );
+    QList<Statement> taken = m_model->takeAllStatements( pattern );
+    QVERIFY( !m_model->lastError() );
+    QCOMPARE( taken.toSet(), expected.toSet() );
+    QVERIFY( !m_model->containsAnyStatement( pattern ) );
+
+    // a whole graph
+    expected = m_model->listStatements( statementPattern2 ).allStatements();
+    QCOMPARE( expected.count(), graph2Data.count() );
+    taken = m_model->takeAllStatements( statementPattern2 );
+    QVERIFY( !m_model->lastError() );
+    QCOMPARE( taken.toSet(), graph2Data.toSet() );
+    foreach( const Statement& s, graph2Data ) {
+        QVERIFY( !m_model->containsStatement( s ) );
+    }
+
+    // nothing left to take
+    QVERIFY( m_model->takeAllStatements( statementPattern2 ).isEmpty() );
+    QVERIFY( !m_model->lastError() );
+
+    // the rest is untouched
+    foreach( const Statement& s, graph1Data ) {
+        if ( s.subject() != pattern.subject() )
+            QVERIFY( m_model->containsStatement( s ) );
+    }
+
+    if ( m_testSignals ) {
+        waitForSignals();
+
+        QSet<Statement> signalled;
+        for ( int i = 0; i < spy.count(); ++i ) {
+            signalled.insert( spy.at( i ).at( 0 ).value<Soprano::Statement>() );
+        }
+        foreach( const Statement& s, graph2Data ) {
+            QVERIFY( signalled.contains( s ) );
+        }
+    }
+}
+
+
 void SopranoModelTest::testContainsStatement()
 {
     QVERIFY( m_model != 0 );
@@ -879,6 +944,220 @@ void SopranoModelTest::testListContexts()
 }
 
 
+void SopranoModelTest::testEstimateCount()
+{
+    QVERIFY( m_model != 0 );
+
+    QCOMPARE( m_model->estimateCount( Statement() ), 4 );
+    QCOMPARE( m_model->estimateCount( Statement( Node(), m_st1.predicate(), Node() ) ), 2 );
+    QCOMPARE( m_model->estimateCount( Statement( m_st1.subject(), m_st1.predicate(), Node() ) ), 1 );
+    QCOMPARE( m_model->estimateCount( m_st1 ), 1 );
+    QVERIFY( !m_model->lastError() );
+
+    // no estimate may claim that nothing matches if something does and vice versa
+    QCOMPARE( m_model->estimateCount( Statement( Node(), QUrl( "http://soprano.sf.net#unknown" ), Node() ) ), 0 );
+    QCOMPARE( m_model->estimateCount( Statement( m_st1.subject(), m_st1.predicate(), m_st3.object() ) ), 0 );
+
+    Node context( QUrl( "http://soprano.sf.net#estimate:context" ) );
+    QList<Statement> statements;
+    for ( int i = 0; i < 10; ++i ) {
+        statements.append( Statement( QUrl( "http://soprano.sf.net#subject" + QString::number( i ) ),
+                                      m_st1.predicate(),
+                                      LiteralValue( i ),
+                                      context ) );
+    }
+    QVERIFY( m_model->addStatements( statements ) == Error::ErrorNone );
+
+    QCOMPARE( m_model->estimateCount( Statement( Node(), Node(), Node(), context ) ), 10 );
+    QCOMPARE( m_model->estimateCount( Statement( Node(), m_st1.predicate(), Node(), context ) ), 10 );
+    QCOMPARE( m_model->estimateCount( Statement( Node(), m_st1.predicate(), Node() ) ), 12 );
+    QCOMPARE( m_model->estimateCount( statements.first() ), 1 );
+}
+
+
+void SopranoModelTest::testStatistics()
+{
+    QVERIFY( m_model != 0 );
+
+    Node context( QUrl( "http://soprano.sf.net#statistics:context" ) );
+    QVERIFY( m_model->addStatement( Statement( m_st1.subject(), m_st1.predicate(), LiteralValue( "in context" ), context ) ) == Error::ErrorNone );
+
+    const QHash<Node, int> predicates = m_model->predicateStatistics();
+    QVERIFY( !m_model->lastError() );
+    QCOMPARE( predicates.count(), 2 );
+    QCOMPARE( predicates.value( m_st1.predicate() ), 3 );
+    QCOMPARE( predicates.value( m_st3.predicate() ), 2 );
+
+    const QHash<Node, int> contexts = m_model->contextStatistics();
+    QVERIFY( !m_model->lastError() );
+    QCOMPARE( contexts.count(), 2 );
+    QCOMPARE( contexts.value( Node() ), 4 );
+    QCOMPARE( contexts.value( context ), 1 );
+
+    QVERIFY( m_model->removeAllStatements( Statement( Node(), m_st3.predicate(), Node() ) ) == Error::ErrorNone );
+    QVERIFY( !m_model->predicateStatistics().contains( m_st3.predicate() ) );
+    QCOMPARE( m_model->contextStatistics().value( Node() ), 2 );
+}
+
+
+void SopranoModelTest::testListStatementsPaged()
+{
+    QVERIFY( m_model != 0 );
+
+    const QList<Statement> all = m_model->listStatements().allStatements();
+    QCOMPARE( all.count(), 4 );
+
+    // consecutive pages cover the full listing, backends may sort pages differently than the unpaged listing
+    QList<Statement> paged;
+    for ( int offset = 0; offset < all.count(); offset += 3 ) {
+        const QList<Statement> page = m_model->listStatements( Statement(), offset, 3 ).allStatements();
+        QVERIFY( !m_model->lastError() );
+        QVERIFY( page.count() <= 3 );
+        paged += page;
+    }
+    QCOMPARE( paged.count(), all.count() );
+    QCOMPARE( paged.toSet(), all.toSet() );
+
+    QCOMPARE( m_model->listStatements( Statement(), 1, -1 ).allStatements(), paged.mid( 1 ) );
+    QVERIFY( m_model->listStatements( Statement(), 0, 0 ).allStatements().isEmpty() );
+    QVERIFY( m_model->listStatements( Statement(), 10, 5 ).allStatements().isEmpty() );
+    QVERIFY( !m_model->lastError() );
+
+    // paging a pattern
+    const QList<Statement> subject1 = m_model->listStatements( Statement( m_st1.subject(), Node(), Node() ), 0, 2 ).allStatements();
+    QCOMPARE( subject1.count(), 2 );
+    QCOMPARE( m_model->listStatements( Statement( m_st1.subject(), Node(), Node() ), 1, 1 ).allStatements(), subject1.mid( 1 ) );
+
+    // paging the contexts
+    Node context1( QUrl( "http://soprano.sf.net#paging:context1" ) );
+    Node context2( QUrl( "http://soprano.sf.net#paging:context2" ) );
+    QVERIFY( m_model->addStatement( Statement( m_st1.subject(), m_st1.predicate(), m_st1.object(), context1 ) ) == Error::ErrorNone );
+    QVERIFY( m_model->addStatement( Statement( m_st1.subject(), m_st1.predicate(), m_st1.object(), context2 ) ) == Error::ErrorNone );
+
+    const QList<Node> contexts = m_model->listContexts().allNodes();
+    QCOMPARE( contexts.count(), 2 );
+    QCOMPARE( ( m_model->listContexts( 0, 1 ).allNodes() + m_model->listContexts( 1, 1 ).allNodes() ).toSet(), contexts.toSet() );
+    QVERIFY( m_model->listContexts( 2, -1 ).allNodes().isEmpty() );
+}
+
+
+void SopranoModelTest::testListStatementsPagedScan()
+{
+    QVERIFY( m_model != 0 );
+
+    const Node predicate( QUrl( "http://soprano.sf.net#paging:predicate" ) );
+    QList<Statement> statements;
+    for ( int i = 0; i < 300; ++i ) {
+        statements.append( Statement( QUrl( QString::fromLatin1( "http://soprano.sf.net#paging:s%1" ).arg( i % 17 ) ),
+                                      predicate,
+                                      LiteralValue( i ),
+                                      QUrl( QString::fromLatin1( "http://soprano.sf.net#paging:c%1" ).arg( i % 5 ) ) ) );
+    }
+    QVERIFY( m_model->addStatements( statements ) == Error::ErrorNone );
+
+    const Statement pattern( Node(), predicate, Node() );
+    const QList<Statement> all = m_model->listStatements( pattern, 0, 300 ).allStatements();
+    QCOMPARE( all.count(), 300 );
+
+    // pages smaller and larger than the batches backends read internally, with two scans interleaved
+    QList<Statement> small;
+    QList<Statement> large;
+    for ( int i = 0; small.count() < all.count() || large.count() < all.count(); ++i ) {
+        if ( small.count() < all.count() )
+            small += m_model->listStatements( pattern, i * 7, 7 ).allStatements();
+        if ( large.count() < all.count() )
+            large += m_model->listStatements( pattern, i * 130, 130 ).allStatements();
+        QVERIFY( !m_model->lastError() );
+        QVERIFY( i < 100 );
+    }
+    QCOMPARE( small, all );
+    QCOMPARE( large, all );
+
+    // requesting a page again returns the same statements
+    QCOMPARE( m_model->listStatements( pattern, 0, 7 ).allStatements(), all.mid( 0, 7 ) );
+    QCOMPARE( m_model->listStatements( pattern, 7, 7 ).allStatements(), all.mid( 7, 7 ) );
+    QCOMPARE( m_model->listStatements( pattern, 7, 7 ).allStatements(), all.mid( 7, 7 ) );
+    QCOMPARE( m_model->listStatements( pattern, 14, 7 ).allStatements(), all.mid( 14, 7 ) );
+
+    const QList<Node> contexts = m_model->listContexts( 0, 100 ).allNodes();
+    QList<Node> pagedContexts;
+    for ( int offset = 0; offset < contexts.count(); offset += 2 ) {
+        pagedContexts += m_model->listContexts( offset, 2 ).allNodes();
+    }
+    QCOMPARE( pagedContexts, contexts );
+}
+
+
+void SopranoModelTest::testIterateColumns()
+{
+    QVERIFY( m_model != 0 );
+
+    // init() adds two statements for each of the two subjects
+    QList<Node> subjects = m_model->listStatements().iterateSubjects().allNodes();
+    QCOMPARE( subjects.count(), 4 );
+    QVERIFY( !m_model->lastError() );
+
+    subjects = m_model->listStatements().iterateSubjects( true ).allNodes();
+    QCOMPARE( subjects.count(), 2 );
+    QVERIFY( subjects.contains( m_st1.subject() ) );
+    QVERIFY( subjects.contains( m_st2.subject() ) );
+
+    QList<Node> objects = m_model->listStatements( Statement( m_st1.subject(), Node(), Node() ) ).iterateObjects( true ).allNodes();
+    QCOMPARE( objects.count(), 2 );
+    QVERIFY( objects.contains( m_st1.object() ) );
+
+    // continue with the remaining statements of a partially read iterator
+    StatementIterator it = m_model->listStatements();
+    QVERIFY( it.next() );
+    QCOMPARE( it.iteratePredicates().allNodes().count(), 3 );
+
+    QueryResultIterator result = m_model->executeQuery( QString( "select ?s ?p where { ?s ?p ?o . }" ), Query::QueryLanguageSparql );
+    QVERIFY( result.isValid() );
+    subjects = result.iterateBindings( QString( "s" ), true ).allNodes();
+    QCOMPARE( subjects.count(), 2 );
+    QVERIFY( !m_model->lastError() );
+
+    result = m_model->executeQuery( QString( "select ?s ?p where { ?s ?p ?o . }" ), Query::QueryLanguageSparql );
+    QCOMPARE( result.iterateBindings( 1, true ).allNodes().count(), 2 );
+}
+
+
+void SopranoModelTest::testContainsStatementsBatch()
+{
+    QVERIFY( m_model != 0 );
+
+    Node context( QUrl( "http://soprano.sf.net#containsStatements:context" ) );
+    Statement inContext( m_st1.subject(), m_st1.predicate(), m_st1.object(), context );
+    QVERIFY( m_model->addStatement( inContext ) == Error::ErrorNone );
+
+    Statement missing( m_st1.subject(), m_st1.predicate(), LiteralValue( "missing" ) );
+    Statement missingInContext( m_st3.subject(), m_st3.predicate(), m_st3.object(), context );
+
+    QList<Statement> statements;
+    statements << m_st1 << missing << inContext << m_st4 << missingInContext;
+
+    QBitArray bits = m_model->containsStatements( statements );
+    QVERIFY( !m_model->lastError() );
+    QCOMPARE( bits.size(), statements.count() );
+    for ( int i = 0; i < statements.count(); ++i ) {
+        QCOMPARE( bits.testBit( i ), m_model->containsStatement( statements[i] ) );
+    }
+    QVERIFY( bits.testBit( 0 ) );
+    QVERIFY( !bits.testBit( 1 ) );
+    QVERIFY( bits.testBit( 2 ) );
+    QVERIFY( bits.testBit( 3 ) );
+    QVERIFY( !bits.testBit( 4 ) );
+
+    QVERIFY( m_model->containsStatements( QList<Statement>() ).isEmpty() );
+    QVERIFY( !m_model->lastError() );
+
+    // invalid statements fail the whole call
+    bits = m_model->containsStatements( QList<Statement>() << m_st1 << Statement() );
+    QVERIFY( bits.isEmpty() );
+    QVERIFY( m_model->lastError() );
+}
+
+
 Q_DECLARE_METATYPE( Soprano::LiteralValue )
 
 void SopranoModelTest::testLiteralTypes_data()
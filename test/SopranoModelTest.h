@@ -56,6 +56,7 @@ private Q_SLOTS:
     void testRemoveStatements();
     void testRemoveAllStatement();
     void testRemoveGraph();
+    void testTakeAllStatements();
 
     void testContainsStatement();
     void testContainsStatements();
@@ -67,6 +68,13 @@ private Q_SLOTS:
 
     void testListContexts();
 
+    void testEstimateCount();
+    void testStatistics();
+    void testListStatementsPaged();
+    void testListStatementsPagedScan();
+    void testIterateColumns();
+    void testContainsStatementsBatch();
+
     void testContexts();
 
     void testLiteralTypes_data();
@@ -65,5 +65,30 @@ void StatementTest::testStatementInvariant()
   QVERIFY( st.object() == object );
 }
 
+void StatementTest::testHash()
+{
+  Node subject(QUrl("uri:soprano:test"));
+  Node predicate(QUrl("uri:soprano:predicate"));
+  Node object(LiteralValue("Literal value"));
+  Node context(QUrl("uri:soprano:context"));
+
+  Statement st(subject, predicate, object, context);
+  const uint hash = qHash( st );
+  QCOMPARE( qHash( st ), hash );
+  QCOMPARE( qHash( Statement(subject, predicate, object, context) ), hash );
+
+  // the setters reset the cached hash
+  Node otherSubject(QUrl("uri:soprano:other"));
+  Statement copy( st );
+  copy.setSubject( otherSubject );
+  QCOMPARE( qHash( copy ), qHash( Statement(otherSubject, predicate, object, context) ) );
+  QVERIFY( qHash( copy ) != hash );
+  copy.setContext( Node() );
+  QCOMPARE( qHash( copy ), qHash( Statement(otherSubject, predicate, object) ) );
+
+  // the original is detached and keeps its hash
+  QCOMPARE( qHash( st ), hash );
+}
+
 QTEST_MAIN(StatementTest)
 
@@ -31,6 +31,7 @@ class StatementTest: public QObject
   void testCreateEmptyStatement();
   void testCreateStatement();
   void testStatementInvariant();
+  void testHash();
 };
 
 #endif // STATEMENT_TEST_H
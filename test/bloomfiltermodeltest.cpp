@@ -0,0 +1,210 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "bloomfiltermodeltest.h"
+#include "soprano/soprano.h"
+#include "soprano/util/bloomfiltermodel.h"
+#include "soprano/vocabulary/rdf.h"
+
+#include <QtTest/QTest>
+
+using namespace Soprano;
+
+/**
+ * Counts the lookups which reach the parent model.
+ */
+class LookupCountingModel : public FilterModel
+{
+public:
+    LookupCountingModel( Model* parent )
+        : FilterModel( parent ),
+          lookups( 0 ) {
+    }
+
+    bool containsStatement( const Statement& statement ) const {
+        ++lookups;
+        return FilterModel::containsStatement( statement );
+    }
+
+    bool containsAnyStatement( const Statement& statement ) const {
+        ++lookups;
+        return FilterModel::containsAnyStatement( statement );
+    }
+
+    using FilterModel::containsStatement;
+    using FilterModel::containsAnyStatement;
+
+    mutable int lookups;
+};
+
+
+namespace {
+    Node testNode( const QString& name ) {
+        return Node( QUrl( QLatin1String( "http://soprano.org/test#" ) + name ) );
+    }
+
+    Statement testStatement( int i ) {
+        return Statement( testNode( QString( "res%1" ).arg( i ) ),
+                          testNode( "label" ),
+                          LiteralValue( QString( "Resource %1" ).arg( i ) ),
+                          testNode( "graph" ) );
+    }
+}
+
+
+void BloomFilterModelTest::init()
+{
+    m_model = Soprano::createModel();
+    QVERIFY( m_model );
+    m_countingModel = new LookupCountingModel( m_model );
+    m_bloomModel = new Util::BloomFilterModel( m_countingModel );
+
+    for ( int i = 0; i < 100; ++i ) {
+        QCOMPARE( m_bloomModel->addStatement( testStatement( i ) ), Error::ErrorNone );
+    }
+}
+
+
+void BloomFilterModelTest::cleanup()
+{
+    delete m_bloomModel;
+    delete m_countingModel;
+    delete m_model;
+}
+
+
+void BloomFilterModelTest::testLookups()
+{
+    for ( int i = 0; i < 100; ++i ) {
+        const Statement s = testStatement( i );
+        QVERIFY( m_bloomModel->containsStatement( s ) );
+        QVERIFY( m_bloomModel->containsAnyStatement( s.subject(), s.predicate(), s.object() ) );
+        QVERIFY( m_bloomModel->containsAnyStatement( s.subject(), s.predicate(), Node() ) );
+        QVERIFY( !m_bloomModel->containsStatement( s.subject(), s.predicate(), s.object() ) );
+    }
+
+    // patterns the filter cannot answer are forwarded
+    QVERIFY( m_bloomModel->containsAnyStatement( Node(), testNode( "label" ), Node() ) );
+    QVERIFY( !m_bloomModel->containsAnyStatement( Node(), Vocabulary::RDF::type(), Node() ) );
+}
+
+
+void BloomFilterModelTest::testNegativeLookupsAreLocal()
+{
+    // build the filter
+    m_bloomModel->containsStatement( testStatement( 0 ) );
+
+    m_countingModel->lookups = 0;
+    for ( int i = 100; i < 1100; ++i ) {
+        QVERIFY( !m_bloomModel->containsStatement( testStatement( i ) ) );
+        QVERIFY( !m_bloomModel->containsAnyStatement( testStatement( i ).subject(), testNode( "label" ), Node() ) );
+    }
+
+    // 2000 negative lookups with a false positive rate of 1%
+    QVERIFY( m_countingModel->lookups < 100 );
+}
+
+
+void BloomFilterModelTest::testRemoveStatement()
+{
+    QVERIFY( m_bloomModel->containsStatement( testStatement( 5 ) ) );
+    QCOMPARE( m_bloomModel->removeStatement( testStatement( 5 ) ), Error::ErrorNone );
+    QVERIFY( !m_bloomModel->containsStatement( testStatement( 5 ) ) );
+
+    // removing a statement twice does not corrupt the counters
+    QCOMPARE( m_bloomModel->removeStatement( testStatement( 5 ) ), Error::ErrorNone );
+    QCOMPARE( m_bloomModel->addStatement( testStatement( 5 ) ), Error::ErrorNone );
+    QVERIFY( m_bloomModel->containsStatement( testStatement( 5 ) ) );
+
+    // adding a statement twice does not either
+    QCOMPARE( m_bloomModel->addStatement( testStatement( 6 ) ), Error::ErrorNone );
+    QCOMPARE( m_bloomModel->removeStatement( testStatement( 6 ) ), Error::ErrorNone );
+    QVERIFY( !m_bloomModel->containsStatement( testStatement( 6 ) ) );
+}
+
+
+void BloomFilterModelTest::testRemoveAllStatements()
+{
+    const Statement s = testStatement( 7 );
+    QCOMPARE( m_bloomModel->removeAllStatements( s.subject(), Node(), Node() ), Error::ErrorNone );
+    QVERIFY( !m_bloomModel->containsStatement( s ) );
+    QVERIFY( !m_bloomModel->containsAnyStatement( s.subject(), s.predicate(), Node() ) );
+    QVERIFY( m_bloomModel->containsStatement( testStatement( 8 ) ) );
+}
+
+
+void BloomFilterModelTest::testTakeAllStatements()
+{
+    // build the filter
+    m_bloomModel->containsStatement( testStatement( 0 ) );
+
+    // the call goes through two filter models down to the memory backend
+    const Statement s = testStatement( 9 );
+    const QList<Statement> taken = m_bloomModel->takeAllStatements( Statement( s.subject(), Node(), Node() ) );
+    QVERIFY( !m_bloomModel->lastError() );
+    QCOMPARE( taken.count(), 1 );
+    QCOMPARE( taken.first(), s );
+    QVERIFY( !m_bloomModel->containsStatement( s ) );
+    QVERIFY( !m_model->containsStatement( s ) );
+
+    // a whole graph
+    const QList<Statement> rest = m_bloomModel->takeAllStatements( Statement( Node(), Node(), Node(), testNode( "graph" ) ) );
+    QCOMPARE( rest.count(), 99 );
+    QVERIFY( m_model->isEmpty() );
+    QVERIFY( !m_bloomModel->containsStatement( testStatement( 10 ) ) );
+}
+
+
+void BloomFilterModelTest::testRebuild()
+{
+    // build the filter
+    m_bloomModel->containsStatement( testStatement( 0 ) );
+
+    // changes made directly to the parent model are not seen by the filter
+    m_model->addStatement( testStatement( 200 ) );
+    m_model->removeStatement( testStatement( 1 ) );
+
+    m_bloomModel->rebuild();
+    QVERIFY( m_bloomModel->containsStatement( testStatement( 200 ) ) );
+    QVERIFY( !m_bloomModel->containsStatement( testStatement( 1 ) ) );
+}
+
+
+void BloomFilterModelTest::testGrowth()
+{
+    m_bloomModel->setExpectedStatementCount( 10 );
+    QVERIFY( m_bloomModel->containsStatement( testStatement( 0 ) ) );
+
+    for ( int i = 100; i < 2000; ++i ) {
+        QCOMPARE( m_bloomModel->addStatement( testStatement( i ) ), Error::ErrorNone );
+    }
+    for ( int i = 0; i < 2000; ++i ) {
+        QVERIFY( m_bloomModel->containsStatement( testStatement( i ) ) );
+    }
+
+    m_countingModel->lookups = 0;
+    for ( int i = 2000; i < 3000; ++i ) {
+        QVERIFY( !m_bloomModel->containsStatement( testStatement( i ) ) );
+    }
+    QVERIFY( m_countingModel->lookups < 100 );
+}
+
+QTEST_MAIN( BloomFilterModelTest )
@@ -0,0 +1,162 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "literalvaluebenchmark.h"
+
+#include "soprano.h"
+
+#include <QtTest/QtTest>
+
+using namespace Soprano;
+
+namespace {
+    const int s_literalCount = 1000;
+
+    void addLiteralRows()
+    {
+        QTest::addColumn<QString>( "value" );
+        QTest::addColumn<QUrl>( "dataType" );
+
+        QTest::newRow( "int" ) << QString::fromLatin1( "-123456" ) << Vocabulary::XMLSchema::xsdInt();
+        QTest::newRow( "integer" ) << QString::fromLatin1( "42" ) << Vocabulary::XMLSchema::integer();
+        QTest::newRow( "long" ) << QString::fromLatin1( "9223372036854775807" ) << Vocabulary::XMLSchema::xsdLong();
+        QTest::newRow( "unsignedInt" ) << QString::fromLatin1( "4294967295" ) << Vocabulary::XMLSchema::unsignedInt();
+        QTest::newRow( "boolean" ) << QString::fromLatin1( "true" ) << Vocabulary::XMLSchema::boolean();
+        QTest::newRow( "double" ) << QString::fromLatin1( "3.1415926535e+00" ) << Vocabulary::XMLSchema::xsdDouble();
+        QTest::newRow( "date" ) << QString::fromLatin1( "2009-11-08" ) << Vocabulary::XMLSchema::date();
+        QTest::newRow( "dateTime" ) << QString::fromLatin1( "2009-11-08T14:35:12.243Z" ) << Vocabulary::XMLSchema::dateTime();
+        QTest::newRow( "string" ) << QString::fromLatin1( "Hello World" ) << Vocabulary::XMLSchema::string();
+        QTest::newRow( "unknown" ) << QString::fromLatin1( "Hello World" ) << QUrl( QLatin1String( "http://soprano.org/types#myType" ) );
+    }
+}
+
+
+void LiteralValueBenchmark::benchmarkFromString_data()
+{
+    addLiteralRows();
+}
+
+
+void LiteralValueBenchmark::benchmarkFromString()
+{
+    QFETCH( QString, value );
+    QFETCH( QUrl, dataType );
+
+    QVERIFY( LiteralValue::fromString( value, dataType ).isValid() );
+
+    QBENCHMARK {
+        for ( int i = 0; i < s_literalCount; ++i ) {
+            LiteralValue::fromString( value, dataType );
+        }
+    }
+}
+
+
+void LiteralValueBenchmark::benchmarkFromStringWithType_data()
+{
+    QTest::addColumn<QString>( "value" );
+    QTest::addColumn<int>( "type" );
+
+    QTest::newRow( "int" ) << QString::fromLatin1( "-123456" ) << int( QVariant::Int );
+    QTest::newRow( "unsignedLong" ) << QString::fromLatin1( "18446744073709551615" ) << int( QVariant::ULongLong );
+    QTest::newRow( "bool" ) << QString::fromLatin1( "False" ) << int( QVariant::Bool );
+    QTest::newRow( "time" ) << QString::fromLatin1( "14:35:12.243+01:00" ) << int( QVariant::Time );
+}
+
+
+void LiteralValueBenchmark::benchmarkFromStringWithType()
+{
+    QFETCH( QString, value );
+    QFETCH( int, type );
+
+    QVERIFY( LiteralValue::fromString( value, QVariant::Type( type ) ).isValid() );
+
+    QBENCHMARK {
+        for ( int i = 0; i < s_literalCount; ++i ) {
+            LiteralValue::fromString( value, QVariant::Type( type ) );
+        }
+    }
+}
+
+
+void LiteralValueBenchmark::benchmarkTypeFromDataTypeUri_data()
+{
+    addLiteralRows();
+}
+
+
+void LiteralValueBenchmark::benchmarkTypeFromDataTypeUri()
+{
+    QFETCH( QUrl, dataType );
+
+    QBENCHMARK {
+        for ( int i = 0; i < s_literalCount; ++i ) {
+            LiteralValue::typeFromDataTypeUri( dataType );
+        }
+    }
+}
+
+
+void LiteralValueBenchmark::benchmarkDataTypeUri()
+{
+    const LiteralValue v = LiteralValue::fromString( QLatin1String( "42" ), Vocabulary::XMLSchema::integer() );
+    QCOMPARE( v.dataTypeUri(), Vocabulary::XMLSchema::integer() );
+
+    QBENCHMARK {
+        for ( int i = 0; i < s_literalCount; ++i ) {
+            v.dataTypeUri();
+        }
+    }
+}
+
+
+void LiteralValueBenchmark::benchmarkCompare()
+{
+    const LiteralValue v1 = LiteralValue::fromString( QLatin1String( "42" ), Vocabulary::XMLSchema::integer() );
+    const LiteralValue v2 = LiteralValue::fromString( QLatin1String( "42" ), Vocabulary::XMLSchema::integer() );
+    QVERIFY( v1 == v2 );
+
+    QBENCHMARK {
+        for ( int i = 0; i < s_literalCount; ++i ) {
+            ( void )( v1 == v2 );
+        }
+    }
+}
+
+
+void LiteralValueBenchmark::benchmarkHash()
+{
+    QList<LiteralValue> values;
+    for ( int i = 0; i < s_literalCount; ++i ) {
+        values.append( LiteralValue( i ) );
+    }
+
+    QBENCHMARK {
+        uint h = 0;
+        Q_FOREACH( const LiteralValue& v, values ) {
+            h ^= qHash( v );
+        }
+        Q_UNUSED( h );
+    }
+}
+
+QTEST_MAIN( LiteralValueBenchmark )
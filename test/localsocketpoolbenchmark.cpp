@@ -0,0 +1,137 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "localsocketpoolbenchmark.h"
+
+#include "soprano.h"
+#include "../client/localsocketclient.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+
+using namespace Soprano;
+
+namespace {
+    const int s_resourceCount = 500;
+    const int s_threadCount = 8;
+
+    QUrl ex( const QString& name ) {
+        return QUrl( QLatin1String( "http://soprano.org/benchmark#" ) + name );
+    }
+
+    /**
+     * Every other thread iterates the whole model while the others
+     * run a series of short lookups.
+     */
+    class ClientThread : public QThread
+    {
+    public:
+        ClientThread( Model* model, bool iterate )
+            : m_model( model ),
+              m_iterate( iterate ) {
+        }
+
+    protected:
+        void run() {
+            if ( m_iterate ) {
+                StatementIterator it = m_model->listStatements();
+                while ( it.next() ) {
+                }
+            }
+            else {
+                for ( int i = 0; i < s_resourceCount; i += 5 ) {
+                    m_model->containsAnyStatement( ex( QString( "res%1" ).arg( i ) ), Node(), Node() );
+                }
+            }
+        }
+
+    private:
+        Model* m_model;
+        bool m_iterate;
+    };
+}
+
+
+void LocalSocketPoolBenchmark::initTestCase()
+{
+    m_model = 0;
+    m_client = new Client::LocalSocketClient( this );
+    if ( !m_client->connect() ) {
+        qDebug() << "A running sopranod is required for this benchmark:" << m_client->lastError();
+        return;
+    }
+
+    m_model = m_client->createModel( QLatin1String( "localsocketpoolbenchmark" ) );
+    QVERIFY( m_model );
+    m_model->removeAllStatements();
+
+    QList<Statement> data;
+    for ( int i = 0; i < s_resourceCount; ++i ) {
+        const QUrl res = ex( QString( "res%1" ).arg( i ) );
+        data.append( Statement( res, Vocabulary::RDF::type(), ex( "Resource" ) ) );
+        data.append( Statement( res, ex( "label" ), LiteralValue( QString( "Resource %1" ).arg( i ) ) ) );
+        data.append( Statement( res, ex( "next" ), ex( QString( "res%1" ).arg( ( i + 1 ) % s_resourceCount ) ) ) );
+    }
+    QVERIFY( m_model->addStatements( data ) == Error::ErrorNone );
+}
+
+
+void LocalSocketPoolBenchmark::cleanupTestCase()
+{
+    if ( m_model ) {
+        delete m_model;
+        m_client->removeModel( QLatin1String( "localsocketpoolbenchmark" ) );
+    }
+}
+
+
+void LocalSocketPoolBenchmark::benchmarkThreads_data()
+{
+    QTest::addColumn<int>( "connections" );
+
+    QTest::newRow( "1 connection" ) << 1;
+    QTest::newRow( "2 connections" ) << 2;
+    QTest::newRow( "4 connections" ) << 4;
+    QTest::newRow( "8 connections" ) << 8;
+}
+
+
+void LocalSocketPoolBenchmark::benchmarkThreads()
+{
+    if ( !m_model )
+        return;
+
+    QFETCH( int, connections );
+    m_client->setMaxConnectionCount( connections );
+
+    QBENCHMARK {
+        QList<ClientThread*> threads;
+        for ( int i = 0; i < s_threadCount; ++i )
+            threads.append( new ClientThread( m_model, i % 2 == 0 ) );
+        Q_FOREACH( ClientThread* thread, threads )
+            thread->start();
+        Q_FOREACH( ClientThread* thread, threads )
+            thread->wait();
+        qDeleteAll( threads );
+    }
+}
+
+QTEST_MAIN( LocalSocketPoolBenchmark )
@@ -0,0 +1,55 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_LOCALSOCKET_POOL_BENCHMARK_H_
+#define _SOPRANO_LOCALSOCKET_POOL_BENCHMARK_H_
+
+#include <QtCore/QObject>
+
+namespace Soprano {
+    class Model;
+    namespace Client {
+        class LocalSocketClient;
+    }
+}
+
+/**
+ * Runs a mix of long iterations and short lookups from several threads
+ * through one LocalSocketClient with different connection pool sizes.
+ * Requires a running sopranod and is not run as part of the test suite.
+ */
+class LocalSocketPoolBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchmarkThreads_data();
+    void benchmarkThreads();
+
+private:
+    Soprano::Client::LocalSocketClient* m_client;
+    Soprano::Model* m_model;
+};
+
+#endif
@@ -0,0 +1,302 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "localsocketpooltest.h"
+#include "../client/localsocketclient.h"
+#include "../server/servercore.h"
+
+#include "soprano.h"
+#include "filtermodel.h"
+#include "requestcontext.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+#include <QtCore/QSemaphore>
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QDir>
+#include <QtCore/QCoreApplication>
+
+
+using namespace Soprano;
+
+namespace {
+    /// the number of statements in the data model
+    const int s_statementCount = 20;
+
+    /// longer than the interval in which LocalSocketClient checks for idle connections
+    const int s_reapWait = 10500;
+
+    /// the longest time a query blocks if it is never cancelled
+    const int s_maxQueryTime = 60000;
+
+    QSemaphore s_queryStarted;
+
+    /**
+     * Blocks queries until the request is cancelled.
+     */
+    class BlockingModel : public FilterModel
+    {
+    public:
+        QueryResultIterator executeQuery( const QString&, Query::QueryLanguage, const QString& ) const {
+            const RequestContext context = RequestContext::current();
+            s_queryStarted.release();
+
+            QMutex mutex;
+            QWaitCondition wc;
+            QElapsedTimer timer;
+            timer.start();
+
+            mutex.lock();
+            while ( !context.isCancelled() && timer.elapsed() < s_maxQueryTime ) {
+                wc.wait( &mutex, 10 );
+            }
+            mutex.unlock();
+
+            if ( context.isCancelled() )
+                setError( context.cancelError() );
+            else
+                setError( "Query has not been cancelled" );
+            return QueryResultIterator();
+        }
+    };
+
+    /**
+     * Provides a blocking model named "blocking" and memory models for all other names.
+     */
+    class PoolServerCore : public Server::ServerCore
+    {
+    public:
+        Model* model( const QString& name ) {
+            if ( name == QLatin1String( "blocking" ) && !m_blockingModel )
+                m_blockingModel = new BlockingModel();
+            return name == QLatin1String( "blocking" ) ? m_blockingModel : Server::ServerCore::model( name );
+        }
+
+        PoolServerCore()
+            : m_blockingModel( 0 ) {
+        }
+
+        ~PoolServerCore() {
+            delete m_blockingModel;
+        }
+
+    protected:
+        Model* createModel( const QList<BackendSetting>& ) {
+            Model* model = discoverBackendByName( QLatin1String( "memory" ) )->createModel();
+            for ( int i = 0; i < s_statementCount; ++i ) {
+                model->addStatement( QUrl( QString::fromLatin1( "test:/s%1" ).arg( i ) ),
+                                     QUrl( "test:/p" ),
+                                     LiteralValue( i ) );
+            }
+            return model;
+        }
+
+    private:
+        BlockingModel* m_blockingModel;
+    };
+
+    /// opens an iterator which outlives the thread
+    class IteratorThread : public QThread
+    {
+    public:
+        IteratorThread( Model* model )
+            : m_model( model ) {
+        }
+
+        void run() {
+            m_iterator = m_model->listStatements();
+        }
+
+        StatementIterator m_iterator;
+
+    private:
+        Model* m_model;
+    };
+
+    class BlockingQueryThread : public QThread
+    {
+    public:
+        BlockingQueryThread( Model* model )
+            : m_model( model ) {
+        }
+
+        void run() {
+            QueryResultIterator it = m_model->executeQuery( QLatin1String( "select * where { ?r ?p ?o . }" ),
+                                                            Query::QueryLanguageSparql );
+            m_error = m_model->lastError();
+        }
+
+        Error::Error m_error;
+
+    private:
+        Model* m_model;
+    };
+
+    int countStatements( StatementIterator it )
+    {
+        int count = 0;
+        while ( it.next() )
+            ++count;
+        return it.lastError() ? -1 : count;
+    }
+}
+
+
+class PoolServerThread : public QThread
+{
+public:
+    PoolServerThread( const QString& socketPath )
+        : m_socketPath( socketPath ),
+          m_started( false ) {
+    }
+
+    bool waitForStarted() {
+        m_startup.acquire();
+        return m_started;
+    }
+
+protected:
+    void run() {
+        PoolServerCore core;
+        m_started = core.start( m_socketPath );
+        m_startup.release();
+        if ( m_started ) {
+            exec();
+        }
+    }
+
+private:
+    QString m_socketPath;
+    bool m_started;
+    QSemaphore m_startup;
+};
+
+
+void LocalSocketPoolTest::initTestCase()
+{
+    QVERIFY( discoverBackendByName( QLatin1String( "memory" ) ) );
+
+    m_socketPath = QDir::tempPath() + QString::fromLatin1( "/soprano-localsocketpooltest-%1" ).arg( QCoreApplication::applicationPid() );
+    QFile::remove( m_socketPath );
+
+    m_server = new PoolServerThread( m_socketPath );
+    m_server->start();
+    QVERIFY( m_server->waitForStarted() );
+}
+
+
+void LocalSocketPoolTest::cleanupTestCase()
+{
+    m_server->quit();
+    m_server->wait();
+    delete m_server;
+}
+
+
+void LocalSocketPoolTest::testIteratorsAcrossConnections()
+{
+    const int threadCount = 4;
+
+    Client::LocalSocketClient client;
+    client.setMaxConnectionCount( threadCount );
+    QVERIFY( client.connect( m_socketPath ) );
+    Model* model = client.createModel( QLatin1String( "data1" ) );
+    QVERIFY( model );
+
+    // each thread is bound to its own connection. The server hands out ids unique across
+    // all connections, thus the client can route each iterator to the socket which created it.
+    QList<IteratorThread*> threads;
+    for ( int i = 0; i < 2 * threadCount; ++i ) {
+        threads << new IteratorThread( model );
+        threads.last()->start();
+    }
+    Q_FOREACH( IteratorThread* thread, threads ) {
+        QVERIFY( thread->wait( 20000 ) );
+        QVERIFY( thread->m_iterator.isValid() );
+    }
+
+    // interleave the iterators of all connections in this thread
+    QList<int> counts;
+    for ( int i = 0; i < threads.count(); ++i )
+        counts << 0;
+    for ( int round = 0; round <= s_statementCount; ++round ) {
+        for ( int i = 0; i < threads.count(); ++i ) {
+            if ( threads[i]->m_iterator.next() )
+                ++counts[i];
+            QVERIFY( !threads[i]->m_iterator.lastError() );
+        }
+    }
+    Q_FOREACH( int count, counts ) {
+        QCOMPARE( count, s_statementCount );
+    }
+
+    qDeleteAll( threads );
+    delete model;
+}
+
+
+void LocalSocketPoolTest::testReapSkipsBusySockets()
+{
+    Client::LocalSocketClient client;
+    client.setMaxConnectionCount( 3 );
+    QVERIFY( client.connect( m_socketPath ) );
+
+    // this thread uses the first connection, the threads below the second and the third
+    Model* model = client.createModel( QLatin1String( "data2" ) );
+    QVERIFY( model );
+    Model* blockingModel = client.createModel( QLatin1String( "blocking" ) );
+    QVERIFY( blockingModel );
+
+    BlockingQueryThread queryThread( blockingModel );
+    queryThread.start();
+    QVERIFY( s_queryStarted.tryAcquire( 1, 20000 ) );
+
+    IteratorThread iteratorThread( model );
+    iteratorThread.start();
+    QVERIFY( iteratorThread.wait( 20000 ) );
+    QVERIFY( iteratorThread.m_iterator.isValid() );
+
+    // both pooled connections are now candidates for closing: one runs a command,
+    // the other one has an open iterator
+    client.setMaxConnectionCount( 1 );
+    QTest::qSleep( s_reapWait );
+
+    // checking the busy connection must not wait for its command
+    QElapsedTimer timer;
+    timer.start();
+    QCOMPARE( model->statementCount(), s_statementCount );
+    QVERIFY( timer.elapsed() < 5000 );
+    QVERIFY( !queryThread.isFinished() );
+
+    // the connection with the open iterator has not been closed
+    QCOMPARE( countStatements( iteratorThread.m_iterator ), s_statementCount );
+
+    QVERIFY( client.cancelRunningRequest() );
+    QVERIFY( queryThread.wait( 20000 ) );
+    QCOMPARE( queryThread.m_error.code(), int( Error::ErrorTimeout ) );
+
+    delete blockingModel;
+    delete model;
+}
+
+QTEST_MAIN( LocalSocketPoolTest )
@@ -0,0 +1,215 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "memorybackendbenchmark.h"
+
+#include "soprano.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+
+using namespace Soprano;
+
+namespace {
+    const int s_subjectCount = 2000;
+    const int s_predicateCount = 10;
+
+    class ReaderThread : public QThread
+    {
+    public:
+        ReaderThread( Model* model, const QList<Statement>& data )
+            : m_model( model ),
+              m_data( data ) {
+        }
+
+    protected:
+        void run() {
+            Q_FOREACH( const Statement& s, m_data ) {
+                StatementIterator it = m_model->listStatements( s.subject(), Node(), Node() );
+                while ( it.next() ) {
+                }
+            }
+        }
+
+    private:
+        Model* m_model;
+        QList<Statement> m_data;
+    };
+}
+
+
+void MemoryBackendBenchmark::initTestCase()
+{
+    for ( int i = 0; i < s_subjectCount; ++i ) {
+        const QUrl subject( QString( "http://soprano.org/benchmark/subject%1" ).arg( i ) );
+        for ( int j = 0; j < s_predicateCount; ++j ) {
+            m_data.append( Statement( subject,
+                                      QUrl( QString( "http://soprano.org/benchmark/predicate%1" ).arg( j ) ),
+                                      LiteralValue( i * s_predicateCount + j ),
+                                      QUrl( QString( "http://soprano.org/benchmark/graph%1" ).arg( i % 10 ) ) ) );
+        }
+    }
+}
+
+
+void MemoryBackendBenchmark::addBackendColumns()
+{
+    QTest::addColumn<QString>( "backend" );
+    QTest::newRow( "memory" ) << QString::fromLatin1( "memory" );
+    QTest::newRow( "redland" ) << QString::fromLatin1( "redland" );
+}
+
+
+Soprano::Model* MemoryBackendBenchmark::createFilledModel( const QString& backendName )
+{
+    const Backend* backend = discoverBackendByName( backendName );
+    if ( !backend ) {
+        return 0;
+    }
+    Model* model = backend->createModel();
+    if ( model ) {
+        model->addStatements( m_data );
+    }
+    return model;
+}
+
+
+void MemoryBackendBenchmark::benchmarkAddStatements_data()
+{
+    addBackendColumns();
+}
+
+
+void MemoryBackendBenchmark::benchmarkAddStatements()
+{
+    QFETCH( QString, backend );
+    const Backend* b = discoverBackendByName( backend );
+    if ( !b ) {
+        qDebug() << "Backend" << backend << "not available.";
+        return;
+    }
+
+    QBENCHMARK {
+        Model* model = b->createModel();
+        QVERIFY( model );
+        model->addStatements( m_data );
+        delete model;
+    }
+}
+
+
+void MemoryBackendBenchmark::benchmarkListStatements_data()
+{
+    addBackendColumns();
+}
+
+
+void MemoryBackendBenchmark::benchmarkListStatements()
+{
+    QFETCH( QString, backend );
+    Model* model = createFilledModel( backend );
+    if ( !model ) {
+        qDebug() << "Backend" << backend << "not available.";
+        return;
+    }
+
+    // one subject, one predicate, and one context pattern per round
+    QBENCHMARK {
+        for ( int i = 0; i < m_data.count(); i += 97 ) {
+            const Statement& s = m_data[i];
+            int cnt = 0;
+            StatementIterator it = model->listStatements( s.subject(), Node(), Node() );
+            while ( it.next() )
+                ++cnt;
+            it = model->listStatements( Node(), s.predicate(), s.object() );
+            while ( it.next() )
+                ++cnt;
+            it = model->listStatements( Node(), s.predicate(), Node(), s.context() );
+            while ( it.next() )
+                ++cnt;
+            QVERIFY( cnt > 0 );
+        }
+    }
+
+    delete model;
+}
+
+
+void MemoryBackendBenchmark::benchmarkContainsStatement_data()
+{
+    addBackendColumns();
+}
+
+
+void MemoryBackendBenchmark::benchmarkContainsStatement()
+{
+    QFETCH( QString, backend );
+    Model* model = createFilledModel( backend );
+    if ( !model ) {
+        qDebug() << "Backend" << backend << "not available.";
+        return;
+    }
+
+    QBENCHMARK {
+        for ( int i = 0; i < m_data.count(); i += 13 ) {
+            QVERIFY( model->containsStatement( m_data[i] ) );
+        }
+    }
+
+    delete model;
+}
+
+
+void MemoryBackendBenchmark::benchmarkConcurrentReaders_data()
+{
+    addBackendColumns();
+}
+
+
+void MemoryBackendBenchmark::benchmarkConcurrentReaders()
+{
+    QFETCH( QString, backend );
+    Model* model = createFilledModel( backend );
+    if ( !model ) {
+        qDebug() << "Backend" << backend << "not available.";
+        return;
+    }
+
+    QList<Statement> subjects;
+    for ( int i = 0; i < m_data.count(); i += s_predicateCount )
+        subjects.append( m_data[i] );
+
+    QBENCHMARK {
+        QList<ReaderThread*> threads;
+        for ( int i = 0; i < 8; ++i ) {
+            threads.append( new ReaderThread( model, subjects ) );
+            threads.last()->start();
+        }
+        Q_FOREACH( ReaderThread* t, threads ) {
+            t->wait();
+            delete t;
+        }
+    }
+
+    delete model;
+}
+
+QTEST_MAIN( MemoryBackendBenchmark )
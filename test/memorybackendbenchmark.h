@@ -0,0 +1,61 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _MEMORY_BACKEND_BENCHMARK_H_
+#define _MEMORY_BACKEND_BENCHMARK_H_
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+
+#include "statement.h"
+
+namespace Soprano {
+    class Model;
+}
+
+/**
+ * Compares the native memory backend with the redland memory store.
+ * This is not run as part of the test suite.
+ */
+class MemoryBackendBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+
+    void benchmarkAddStatements_data();
+    void benchmarkAddStatements();
+    void benchmarkListStatements_data();
+    void benchmarkListStatements();
+    void benchmarkContainsStatement_data();
+    void benchmarkContainsStatement();
+    void benchmarkConcurrentReaders_data();
+    void benchmarkConcurrentReaders();
+
+private:
+    void addBackendColumns();
+    Soprano::Model* createFilledModel( const QString& backend );
+
+    QList<Soprano::Statement> m_data;
+};
+
+#endif
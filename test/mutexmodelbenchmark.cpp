@@ -0,0 +1,93 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "mutexmodelbenchmark.h"
+
+#include "soprano.h"
+#include "dummymodel.h"
+#include "mutexmodel.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+
+using namespace Soprano;
+
+Q_DECLARE_METATYPE( Soprano::Util::MutexModel::ProtectionMode )
+
+namespace {
+    const int s_readsPerThread = 100000;
+
+    class ReaderThread : public QThread
+    {
+    public:
+        ReaderThread( Model* model )
+            : m_model( model ) {
+        }
+
+    protected:
+        void run() {
+            const Statement s( QUrl( "http://soprano.org/benchmark#a" ), Vocabulary::RDF::type(), QUrl( "http://soprano.org/benchmark#b" ) );
+            for ( int i = 0; i < s_readsPerThread; ++i ) {
+                m_model->containsStatement( s );
+            }
+        }
+
+    private:
+        Model* m_model;
+    };
+}
+
+
+void MutexModelBenchmark::benchmarkReaders_data()
+{
+    QTest::addColumn<Util::MutexModel::ProtectionMode>( "mode" );
+    QTest::addColumn<int>( "threads" );
+
+    for ( int threads = 1; threads <= 32; threads *= 2 ) {
+        QTest::newRow( QString( "readwrite %1 readers" ).arg( threads ).toLatin1().data() )
+            << Util::MutexModel::ReadWriteMultiThreading << threads;
+        QTest::newRow( QString( "scalable %1 readers" ).arg( threads ).toLatin1().data() )
+            << Util::MutexModel::ScalableReadWriteMultiThreading << threads;
+    }
+}
+
+
+void MutexModelBenchmark::benchmarkReaders()
+{
+    QFETCH( Util::MutexModel::ProtectionMode, mode );
+    QFETCH( int, threads );
+
+    Util::DummyModel dummy;
+    Util::MutexModel model( mode, &dummy );
+
+    QBENCHMARK {
+        QList<ReaderThread*> readers;
+        for ( int i = 0; i < threads; ++i )
+            readers.append( new ReaderThread( &model ) );
+        Q_FOREACH( ReaderThread* thread, readers )
+            thread->start();
+        Q_FOREACH( ReaderThread* thread, readers )
+            thread->wait();
+        qDeleteAll( readers );
+    }
+}
+
+QTEST_MAIN( MutexModelBenchmark )
@@ -80,5 +80,66 @@ void NRLModelTest::testAddStatement()
     m_nrlModel->addStatement( s3 );
 }
 
+void NRLModelTest::testCardinalityUpdate()
+{
+    Statement s1( QUrl( "http://soprano.org/test#A" ),
+                  QUrl( "http://soprano.org/test#prop1" ),
+                  QUrl( "http://soprano.org/test#B" ) );
+    Statement s2( QUrl( "http://soprano.org/test#A" ),
+                  QUrl( "http://soprano.org/test#prop1" ),
+                  QUrl( "http://soprano.org/test#C" ) );
+
+    // no restriction yet, this loads the cardinality table
+    QCOMPARE( m_nrlModel->addNrlStatement( s1 ), Error::ErrorNone );
+    QCOMPARE( m_nrlModel->addNrlStatement( s2 ), Error::ErrorNone );
+    QVERIFY( m_nrlModel->containsStatement( s1 ) );
+    QVERIFY( m_nrlModel->containsStatement( s2 ) );
+
+    // a new restriction has to be picked up
+    Statement restriction( s1.predicate(), Vocabulary::NRL::maxCardinality(), LiteralValue( 1 ) );
+    m_model->addStatement( restriction );
+
+    QCOMPARE( m_nrlModel->addNrlStatement( s1 ), Error::ErrorNone );
+    QVERIFY( m_nrlModel->containsStatement( s1 ) );
+    QVERIFY( !m_nrlModel->containsStatement( s2 ) );
+
+    // and so has its removal
+    m_model->removeStatement( restriction );
+
+    QCOMPARE( m_nrlModel->addNrlStatement( s2 ), Error::ErrorNone );
+    QVERIFY( m_nrlModel->containsStatement( s1 ) );
+    QVERIFY( m_nrlModel->containsStatement( s2 ) );
+}
+
+
+void NRLModelTest::testAddNrlStatements()
+{
+    const QUrl single( "http://soprano.org/test#single" );
+    const QUrl multi( "http://soprano.org/test#multi" );
+    const QUrl plain( "http://soprano.org/test#plain" );
+    m_model->addStatement( Statement( single, Vocabulary::NRL::maxCardinality(), LiteralValue( 1 ) ) );
+    m_model->addStatement( Statement( multi, Vocabulary::NRL::maxCardinality(), LiteralValue( 2 ) ) );
+
+    const Node a( QUrl( "http://soprano.org/test#A" ) );
+    m_nrlModel->addStatement( a, single, LiteralValue( "old" ) );
+
+    QList<Statement> statements;
+    statements << Statement( a, single, LiteralValue( "first" ) )
+               << Statement( a, plain, LiteralValue( 1 ) )
+               << Statement( a, plain, LiteralValue( 2 ) )
+               << Statement( a, multi, LiteralValue( 1 ) )
+               << Statement( a, multi, LiteralValue( 2 ) )
+               << Statement( a, single, LiteralValue( "last" ) );
+    QCOMPARE( m_nrlModel->addNrlStatements( statements ), Error::ErrorNone );
+
+    QCOMPARE( m_nrlModel->listStatements( a, single, Node() ).allStatements(),
+              QList<Statement>() << Statement( a, single, LiteralValue( "last" ) ) );
+    QCOMPARE( m_nrlModel->listStatements( a, plain, Node() ).allStatements().count(), 2 );
+    QCOMPARE( m_nrlModel->listStatements( a, multi, Node() ).allStatements().count(), 2 );
+
+    // the maximum of multi has been reached
+    QVERIFY( m_nrlModel->addNrlStatements( QList<Statement>() << Statement( a, multi, LiteralValue( 3 ) ) ) != Error::ErrorNone );
+}
+
 QTEST_MAIN( NRLModelTest )
 
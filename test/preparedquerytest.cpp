@@ -0,0 +1,162 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "preparedquerytest.h"
+
+#include "soprano.h"
+#include "query/parameterizedquery.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QSet>
+
+using namespace Soprano;
+
+namespace {
+    QUrl ex( const QString& name ) {
+        return QUrl( QLatin1String( "http://soprano.org/prepared#" ) + name );
+    }
+
+    QSet<QString> names( QueryResultIterator it, const QString& binding ) {
+        QSet<QString> result;
+        while ( it.next() )
+            result.insert( it[binding].toString() );
+        return result;
+    }
+}
+
+
+void PreparedQueryTest::init()
+{
+    const Backend* b = discoverBackendByName( "memory" );
+    m_model = b ? b->createModel() : 0;
+    QVERIFY( m_model );
+
+    m_model->addStatement( ex( "alice" ), ex( "name" ), LiteralValue( "Alice" ) );
+    m_model->addStatement( ex( "bob" ), ex( "name" ), LiteralValue( "Bob" ) );
+    m_model->addStatement( ex( "alice" ), ex( "knows" ), ex( "bob" ) );
+    m_model->addStatement( ex( "bob" ), ex( "knows" ), ex( "alice" ) );
+    m_model->addStatement( ex( "alice" ), ex( "knows" ), ex( "carol" ) );
+}
+
+
+void PreparedQueryTest::cleanup()
+{
+    delete m_model;
+    m_model = 0;
+}
+
+
+void PreparedQueryTest::testParameterParsing()
+{
+    // percent signs in IRIs, strings, and comments are no parameters
+    Query::ParameterizedQuery query( QLatin1String( "select ?o where { %s <http://x/a%20b> ?o . "
+                                                    "?o ?p \"100%s\" . # %comment\n"
+                                                    "FILTER(?o != %value) . %s ?q %value . }" ) );
+    QCOMPARE( query.parameterNames(), QStringList() << "s" << "value" );
+    QCOMPARE( query.placeholderCount(), 4 );
+    QCOMPARE( query.placeholderName( 1 ), QString( "value" ) );
+    QVERIFY( !query.isExpressionPlaceholder( 0 ) );
+    QVERIFY( query.isExpressionPlaceholder( 1 ) );
+    QVERIFY( !query.isExpressionPlaceholder( 2 ) );
+    QVERIFY( !query.isExpressionPlaceholder( 3 ) );
+}
+
+
+void PreparedQueryTest::testSubstitute()
+{
+    Query::ParameterizedQuery query( QLatin1String( "select ?o where { %s %p ?o . }" ) );
+
+    BindingSet bindings;
+    bindings.insert( "s", Node( ex( "alice" ) ) );
+
+    QString unbound;
+    QVERIFY( query.substitute( bindings, &unbound ).isNull() );
+    QCOMPARE( unbound, QString( "p" ) );
+
+    bindings.insert( "p", Node( LiteralValue( "x" ) ) );
+    QCOMPARE( query.substitute( bindings ),
+              QString( "select ?o where { %1 %2 ?o . }" ).arg( Node::resourceToN3( ex( "alice" ) ), Node( LiteralValue( "x" ) ).toN3() ) );
+}
+
+
+void PreparedQueryTest::testExecute()
+{
+    PreparedQuery query = m_model->prepareQuery( QString( "select ?o where { %s <%1> ?o . }" ).arg( ex( "knows" ).toString() ),
+                                                 Query::QueryLanguageSparql );
+    QVERIFY( query.isValid() );
+    QCOMPARE( query.parameterNames(), QStringList() << "s" );
+
+    query.bindValue( "s", ex( "alice" ) );
+    QCOMPARE( names( query.executeQuery(), "o" ),
+              QSet<QString>() << ex( "bob" ).toString() << ex( "carol" ).toString() );
+
+    // the query can be executed again with other values
+    query.bindValue( "s", ex( "bob" ) );
+    QCOMPARE( names( query.executeQuery(), "o" ),
+              QSet<QString>() << ex( "alice" ).toString() );
+
+    // explicit bindings do not touch the bound values
+    BindingSet bindings;
+    bindings.insert( "s", Node( ex( "carol" ) ) );
+    QVERIFY( names( query.executeQuery( bindings ), "o" ).isEmpty() );
+    QCOMPARE( query.boundValue( "s" ), Node( ex( "bob" ) ) );
+}
+
+
+void PreparedQueryTest::testUnboundParameter()
+{
+    PreparedQuery query = m_model->prepareQuery( QLatin1String( "select ?o where { %s ?p ?o . }" ),
+                                                 Query::QueryLanguageSparql );
+    QVERIFY( query.isValid() );
+
+    QueryResultIterator it = query.executeQuery();
+    QVERIFY( !it.isValid() );
+    QCOMPARE( query.lastError().code(), ( int )Error::ErrorInvalidArgument );
+
+    query.bindValue( "s", ex( "alice" ) );
+    QVERIFY( query.executeQuery().isValid() );
+    QVERIFY( !query.lastError() );
+
+    // binding an empty node removes the value
+    query.bindValue( "s", Node() );
+    QVERIFY( query.boundValues().isEmpty() );
+}
+
+
+void PreparedQueryTest::testFilterModel()
+{
+    Util::DummyModel dummy;
+    FilterModel filter( m_model );
+    PreparedQuery query = filter.prepareQuery( QString( "select ?n where { %s <%1> ?n . }" ).arg( ex( "name" ).toString() ),
+                                               Query::QueryLanguageSparql );
+    QVERIFY( query.isValid() );
+
+    query.bindValue( "s", ex( "bob" ) );
+    QCOMPARE( names( query.executeQuery(), "n" ), QSet<QString>() << QString( "Bob" ) );
+
+    // the prepared query survives the model
+    filter.setParentModel( &dummy );
+    query.bindValue( "s", ex( "alice" ) );
+    QCOMPARE( names( query.executeQuery(), "n" ), QSet<QString>() << QString( "Alice" ) );
+}
+
+QTEST_MAIN( PreparedQueryTest )
+
@@ -0,0 +1,112 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "queryevaluatorbenchmark.h"
+
+#include "soprano.h"
+#include "query/queryevaluator.h"
+
+#include <QtTest/QtTest>
+
+using namespace Soprano;
+
+namespace {
+    const int s_personCount = 2000;
+
+    QUrl ex( const QString& name ) {
+        return QUrl( QLatin1String( "http://soprano.org/benchmark#" ) + name );
+    }
+}
+
+
+void QueryEvaluatorBenchmark::initTestCase()
+{
+    m_model = 0;
+    const Backend* b = discoverBackendByName( "redland" );
+    if ( !b ) {
+        qDebug() << "The redland backend is required for this benchmark.";
+        return;
+    }
+
+    m_model = b->createModel();
+    QVERIFY( m_model );
+
+    // a social graph where each person knows the next three
+    QList<Statement> data;
+    for ( int i = 0; i < s_personCount; ++i ) {
+        const QUrl person = ex( QString( "person%1" ).arg( i ) );
+        data.append( Statement( person, Vocabulary::RDF::type(), ex( i % 10 ? "Person" : "Admin" ) ) );
+        data.append( Statement( person, ex( "name" ), LiteralValue( QString( "Person %1" ).arg( i ) ) ) );
+        data.append( Statement( person, ex( "age" ), LiteralValue( i % 80 ) ) );
+        for ( int j = 1; j <= 3; ++j )
+            data.append( Statement( person, ex( "knows" ), ex( QString( "person%1" ).arg( ( i + j ) % s_personCount ) ) ) );
+    }
+    QVERIFY( m_model->addStatements( data ) == Error::ErrorNone );
+}
+
+
+void QueryEvaluatorBenchmark::cleanupTestCase()
+{
+    delete m_model;
+}
+
+
+void QueryEvaluatorBenchmark::benchmarkQuery_data()
+{
+    QTest::addColumn<bool>( "builtin" );
+    QTest::addColumn<QString>( "query" );
+
+    const QString prefix = QLatin1String( "PREFIX ex: <http://soprano.org/benchmark#> " );
+    const QString queries[] = {
+        prefix + "select ?n where { ex:person42 ex:knows ?p . ?p ex:name ?n . }",
+        prefix + "select ?a ?n where { ?a a ex:Admin . ?a ex:knows ?p . ?p ex:name ?n . }",
+        prefix + "select ?p ?q where { ?p ex:knows ?q . ?q ex:knows ?p . }",
+        prefix + "ask { ?p a ex:Admin . ?p ex:knows ?q . ?q a ex:Admin . }"
+    };
+    const char* names[] = { "star", "path", "cycle", "ask" };
+
+    for ( int i = 0; i < 4; ++i ) {
+        QTest::newRow( QString( "%1 (evaluator)" ).arg( names[i] ).toLatin1().data() ) << true << queries[i];
+        QTest::newRow( QString( "%1 (rasqal)" ).arg( names[i] ).toLatin1().data() ) << false << queries[i];
+    }
+}
+
+
+void QueryEvaluatorBenchmark::benchmarkQuery()
+{
+    if ( !m_model )
+        return;
+
+    QFETCH( bool, builtin );
+    QFETCH( QString, query );
+
+    Query::Evaluator evaluator( m_model );
+    QBENCHMARK {
+        QueryResultIterator it = builtin
+                                 ? evaluator.executeQuery( query, Query::QueryLanguageSparql )
+                                 : m_model->executeQuery( query, Query::QueryLanguageSparql );
+        QVERIFY( it.isValid() );
+        while ( it.next() ) {
+        }
+    }
+}
+
+QTEST_MAIN( QueryEvaluatorBenchmark )
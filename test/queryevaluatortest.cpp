@@ -0,0 +1,326 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "queryevaluatortest.h"
+
+#include "soprano.h"
+#include "query/queryevaluator.h"
+#include "requestcontext.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QSet>
+
+using namespace Soprano;
+
+namespace {
+    QUrl ex( const QString& name ) {
+        return QUrl( QLatin1String( "http://soprano.org/evaluator#" ) + name );
+    }
+
+    QString queryPrefix() {
+        return QLatin1String( "PREFIX ex: <http://soprano.org/evaluator#> " );
+    }
+
+    int countResults( QueryResultIterator it ) {
+        int cnt = 0;
+        while ( it.next() )
+            ++cnt;
+        return cnt;
+    }
+}
+
+
+void QueryEvaluatorTest::init()
+{
+    const Backend* b = discoverBackendByName( "memory" );
+    m_model = b ? b->createModel() : 0;
+    QVERIFY( m_model );
+
+    // three people, two of them know each other, one of them in a named graph
+    m_model->addStatement( ex( "alice" ), Vocabulary::RDF::type(), ex( "Person" ) );
+    m_model->addStatement( ex( "bob" ), Vocabulary::RDF::type(), ex( "Person" ) );
+    m_model->addStatement( ex( "carol" ), Vocabulary::RDF::type(), ex( "Person" ), ex( "graph" ) );
+    m_model->addStatement( ex( "alice" ), ex( "name" ), LiteralValue( "Alice" ) );
+    m_model->addStatement( ex( "bob" ), ex( "name" ), LiteralValue( "Bob" ) );
+    m_model->addStatement( ex( "carol" ), ex( "name" ), LiteralValue( "Carol" ), ex( "graph" ) );
+    m_model->addStatement( ex( "alice" ), ex( "knows" ), ex( "bob" ) );
+    m_model->addStatement( ex( "bob" ), ex( "knows" ), ex( "alice" ) );
+    m_model->addStatement( ex( "alice" ), ex( "knows" ), ex( "carol" ) );
+}
+
+
+void QueryEvaluatorTest::cleanup()
+{
+    delete m_model;
+    m_model = 0;
+}
+
+
+void QueryEvaluatorTest::testSelectJoin()
+{
+    Query::Evaluator evaluator( m_model );
+    QueryResultIterator it = evaluator.executeQuery( QString( "select ?n1 ?n2 where { "
+                                                              "?a <%1> ?b . ?a <%2> ?n1 . ?b <%2> ?n2 . }" )
+                                                     .arg( ex( "knows" ).toString(), ex( "name" ).toString() ),
+                                                     Query::QueryLanguageSparql );
+    QVERIFY( !evaluator.lastError() );
+
+    QSet<QString> pairs;
+    while ( it.next() ) {
+        QCOMPARE( it.bindingCount(), 2 );
+        QCOMPARE( it.bindingNames(), QStringList() << "n1" << "n2" );
+        pairs.insert( it["n1"].toString() + "-" + it["n2"].toString() );
+    }
+    QCOMPARE( pairs, QSet<QString>() << "Alice-Bob" << "Bob-Alice" << "Alice-Carol" );
+
+    // a variable used twice in one pattern
+    QCOMPARE( countResults( evaluator.executeQuery( "select * where { ?a ?p ?a . }", Query::QueryLanguageSparql ) ), 0 );
+}
+
+
+void QueryEvaluatorTest::testPrefixedNames()
+{
+    Query::Evaluator evaluator( m_model );
+    QueryResultIterator it = evaluator.executeQuery( queryPrefix() +
+                                                     "SELECT ?p WHERE { ?p a ex:Person ; ex:knows ex:carol , ex:bob }",
+                                                     Query::QueryLanguageSparql );
+    QVERIFY( !evaluator.lastError() );
+    QVERIFY( it.next() );
+    QCOMPARE( it["p"].uri(), ex( "alice" ) );
+    QVERIFY( !it.next() );
+
+    it = evaluator.executeQuery( queryPrefix() + "select ?p where { ?p ex:name \"Bob\" . }", Query::QueryLanguageSparql );
+    QVERIFY( it.next() );
+    QCOMPARE( it["p"].uri(), ex( "bob" ) );
+}
+
+
+void QueryEvaluatorTest::testGraphVariable()
+{
+    Query::Evaluator evaluator( m_model );
+
+    // a graph variable never matches the default graph
+    QueryResultIterator it = evaluator.executeQuery( queryPrefix() + "select ?g ?p where { graph ?g { ?p a ex:Person . } }",
+                                                     Query::QueryLanguageSparql );
+    QVERIFY( it.next() );
+    QCOMPARE( it["g"].uri(), ex( "graph" ) );
+    QCOMPARE( it["p"].uri(), ex( "carol" ) );
+    QVERIFY( !it.next() );
+
+    // without a graph all statements are matched
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?p where { ?p a ex:Person . }",
+                                                    Query::QueryLanguageSparql ) ), 3 );
+}
+
+
+void QueryEvaluatorTest::testSolutionModifiers()
+{
+    Query::Evaluator evaluator( m_model );
+
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ex:knows ?b . }",
+                                                    Query::QueryLanguageSparql ) ), 3 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select distinct ?a where { ?a ex:knows ?b . }",
+                                                    Query::QueryLanguageSparql ) ), 2 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ex:knows ?b . } limit 2",
+                                                    Query::QueryLanguageSparql ) ), 2 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ex:knows ?b . } offset 2 limit 5",
+                                                    Query::QueryLanguageSparql ) ), 1 );
+}
+
+
+void QueryEvaluatorTest::testAsk()
+{
+    Query::Evaluator evaluator( m_model );
+
+    QueryResultIterator it = evaluator.executeQuery( queryPrefix() + "ask { ex:bob ex:knows ?x . ?x ex:knows ex:carol . }",
+                                                     Query::QueryLanguageSparql );
+    QVERIFY( it.isBool() );
+    QVERIFY( it.boolValue() );
+
+    it = evaluator.executeQuery( queryPrefix() + "ask { ex:carol ex:knows ?x . }", Query::QueryLanguageSparql );
+    QVERIFY( it.isBool() );
+    QVERIFY( !it.boolValue() );
+}
+
+
+void QueryEvaluatorTest::testConstruct()
+{
+    Query::Evaluator evaluator( m_model );
+
+    QueryResultIterator it = evaluator.executeQuery( queryPrefix() + "construct { ?b ex:knownBy ?a } where { ?a ex:knows ?b . }",
+                                                     Query::QueryLanguageSparql );
+    QVERIFY( it.isGraph() );
+
+    QList<Statement> statements;
+    while ( it.next() )
+        statements.append( it.currentStatement() );
+    QCOMPARE( statements.count(), 3 );
+    QVERIFY( statements.contains( Statement( ex( "carol" ), ex( "knownBy" ), ex( "alice" ) ) ) );
+}
+
+
+void QueryEvaluatorTest::testConstructBlankNodes()
+{
+    // a blank node in the data which looks like what a template blank node might become
+    m_model->addStatement( Node::createBlankNode( "b_0" ), ex( "name" ), LiteralValue( "Blank" ) );
+    m_model->addStatement( Node::createBlankNode( "b1" ), ex( "name" ), LiteralValue( "Blank" ) );
+
+    Query::Evaluator evaluator( m_model );
+    QueryResultIterator it = evaluator.executeQuery( queryPrefix() + "construct { _:b ex:about ?a . _:b ex:label ?n } "
+                                                     "where { ?a ex:name ?n . }",
+                                                     Query::QueryLanguageSparql );
+    QVERIFY( it.isGraph() );
+
+    QList<Statement> statements;
+    while ( it.next() )
+        statements.append( it.currentStatement() );
+    QCOMPARE( statements.count(), 10 );
+
+    // one new blank node per solution, shared by the template triples of the solution
+    QSet<Node> blankNodes;
+    Q_FOREACH( const Statement& s, statements ) {
+        QVERIFY( s.subject().isBlank() );
+        QVERIFY( s.subject() != Node::createBlankNode( "b_0" ) );
+        QVERIFY( s.subject() != Node::createBlankNode( "b1" ) );
+        blankNodes.insert( s.subject() );
+    }
+    QCOMPARE( blankNodes.count(), 5 );
+
+    // and the nodes differ between queries
+    it = evaluator.executeQuery( queryPrefix() + "construct { _:b ex:about ?a } where { ?a ex:name ?n . }",
+                                 Query::QueryLanguageSparql );
+    while ( it.next() )
+        QVERIFY( !blankNodes.contains( it.currentStatement().subject() ) );
+}
+
+
+void QueryEvaluatorTest::testUnion()
+{
+    Query::Evaluator evaluator( m_model );
+
+    // the solutions of the alternatives are joined with the rest of the group
+    QueryResultIterator it = evaluator.executeQuery( queryPrefix() + "select ?p ?o where { ?p a ex:Person . "
+                                                     "{ ?p ex:name ?o } UNION { ?p ex:knows ?o } }",
+                                                     Query::QueryLanguageSparql );
+    QVERIFY( !evaluator.lastError() );
+    QSet<QString> results;
+    while ( it.next() )
+        results.insert( it["p"].toString() + "-" + it["o"].toString() );
+    QCOMPARE( results.count(), 6 );
+    QVERIFY( results.contains( ex( "carol" ).toString() + "-Carol" ) );
+    QVERIFY( results.contains( ex( "alice" ).toString() + "-" + ex( "carol" ).toString() ) );
+
+    // variables of other alternatives stay unbound, as in the NRLModel cardinality query
+    it = evaluator.executeQuery( queryPrefix() + "select ?n ?k where { { ex:bob ex:name ?n } UNION { ex:bob ex:knows ?k } }",
+                                 Query::QueryLanguageSparql );
+    QVERIFY( !evaluator.lastError() );
+    int cnt = 0;
+    while ( it.next() ) {
+        ++cnt;
+        QVERIFY( it["n"].isValid() != it["k"].isValid() );
+    }
+    QCOMPARE( cnt, 2 );
+
+    // patterns after the union are joined with solutions of both alternatives
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select * where { { ?a ex:knows ?b } UNION { ?b ex:knows ?a } "
+                                                    "?b ex:name \"Alice\" . }",
+                                                    Query::QueryLanguageSparql ) ), 3 );
+
+    it = evaluator.executeQuery( queryPrefix() + "ask { { ex:carol ex:knows ?x } UNION { ?x ex:knows ex:carol } }",
+                                 Query::QueryLanguageSparql );
+    QVERIFY( it.boolValue() );
+}
+
+
+void QueryEvaluatorTest::testFilter()
+{
+    Query::Evaluator evaluator( m_model );
+
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a ?b where { ?a ex:knows ?b . FILTER(?b != ex:carol) }",
+                                                    Query::QueryLanguageSparql ) ), 2 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ex:knows ?b . ?b ex:knows ?c . FILTER(?a = ?c) }",
+                                                    Query::QueryLanguageSparql ) ), 2 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ?p ?o . FILTER isLiteral(?o) }",
+                                                    Query::QueryLanguageSparql ) ), 3 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ?p ?o . FILTER(isIRI(?o) && !sameTerm(?p, ex:knows)) }",
+                                                    Query::QueryLanguageSparql ) ), 3 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ex:name ?n . FILTER(?n = \"Bob\" || ?n = \"Carol\") }",
+                                                    Query::QueryLanguageSparql ) ), 2 );
+
+    // filters apply to the whole group, unbound variables are a type error
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { FILTER(?a != ex:bob) ?a ex:name ?n . }",
+                                                    Query::QueryLanguageSparql ) ), 2 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?a where { ?a ex:name ?n . FILTER(?x != ex:bob) }",
+                                                    Query::QueryLanguageSparql ) ), 0 );
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?n ?k where { { ex:bob ex:name ?n } UNION { ex:bob ex:knows ?k } "
+                                                    "FILTER(bound(?k)) }",
+                                                    Query::QueryLanguageSparql ) ), 1 );
+
+    // a filter in a graph block
+    QCOMPARE( countResults( evaluator.executeQuery( queryPrefix() + "select ?p where { graph ?g { ?p a ex:Person . FILTER(?g = ex:graph) } }",
+                                                    Query::QueryLanguageSparql ) ), 1 );
+}
+
+
+void QueryEvaluatorTest::testUnsupported()
+{
+    Query::Evaluator evaluator( m_model );
+
+    QueryResultIterator it = evaluator.executeQuery( "select ?a where { ?a ?b ?c . FILTER(?c > 2) }", Query::QueryLanguageSparql );
+    QVERIFY( !it.isValid() );
+    QCOMPARE( evaluator.lastError().code(), int( Error::ErrorNotSupported ) );
+
+    it = evaluator.executeQuery( "select ?a where { ?a ?b ?c . FILTER regex(?c, \"a\") }", Query::QueryLanguageSparql );
+    QVERIFY( !it.isValid() );
+    QCOMPARE( evaluator.lastError().code(), int( Error::ErrorNotSupported ) );
+
+    it = evaluator.executeQuery( "select ?a where { ?a ?b ?c . OPTIONAL { ?c ?d ?e } }", Query::QueryLanguageSparql );
+    QVERIFY( !it.isValid() );
+    QCOMPARE( evaluator.lastError().code(), int( Error::ErrorNotSupported ) );
+
+    it = evaluator.executeQuery( "select ?a where { ?a ?b ", Query::QueryLanguageSparql );
+    QVERIFY( !it.isValid() );
+    QCOMPARE( evaluator.lastError().code(), int( Error::ErrorParsingFailed ) );
+
+    it = evaluator.executeQuery( "select ?a where { ?a ?b ?c }", Query::QueryLanguageSerql );
+    QVERIFY( !it.isValid() );
+    QCOMPARE( evaluator.lastError().code(), int( Error::ErrorNotSupported ) );
+}
+
+
+void QueryEvaluatorTest::testCancelled()
+{
+    Query::Evaluator evaluator( m_model );
+
+    RequestContext context = RequestContext::create();
+    RequestScope scope( context );
+
+    QueryResultIterator it = evaluator.executeQuery( "select ?a where { ?a ?b ?c . ?c ?d ?e . }", Query::QueryLanguageSparql );
+    QVERIFY( it.isValid() );
+    it.close();
+
+    context.cancel();
+    it = evaluator.executeQuery( "select ?a where { ?a ?b ?c . ?c ?d ?e . }", Query::QueryLanguageSparql );
+    QVERIFY( !it.isValid() );
+    QCOMPARE( evaluator.lastError().code(), int( Error::ErrorTimeout ) );
+}
+
+QTEST_MAIN( QueryEvaluatorTest )
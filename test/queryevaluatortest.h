@@ -0,0 +1,55 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SOPRANO_QUERY_EVALUATOR_TEST_H_
+#define _SOPRANO_QUERY_EVALUATOR_TEST_H_
+
+#include <QtCore/QObject>
+
+namespace Soprano {
+    class Model;
+}
+
+class QueryEvaluatorTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init();
+    void cleanup();
+
+    void testSelectJoin();
+    void testPrefixedNames();
+    void testGraphVariable();
+    void testSolutionModifiers();
+    void testAsk();
+    void testConstruct();
+    void testConstructBlankNodes();
+    void testUnion();
+    void testFilter();
+    void testUnsupported();
+    void testCancelled();
+
+private:
+    Soprano::Model* m_model;
+};
+
+#endif
@@ -0,0 +1,166 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "rdfschemamodeltest.h"
+#include "soprano/soprano.h"
+#include "soprano/rdfschemamodel.h"
+#include "soprano/vocabulary/rdf.h"
+#include "soprano/vocabulary/rdfs.h"
+
+#include <QtTest/QTest>
+
+using namespace Soprano;
+
+namespace {
+    Node testNode( const char* name ) {
+        return Node( QUrl( QLatin1String( "http://soprano.org/test#" ) + QLatin1String( name ) ) );
+    }
+
+    QSet<Node> objects( StatementIterator it ) {
+        QSet<Node> nodes;
+        while ( it.next() )
+            nodes.insert( it.current().object() );
+        return nodes;
+    }
+
+    QSet<Node> subjects( StatementIterator it ) {
+        QSet<Node> nodes;
+        while ( it.next() )
+            nodes.insert( it.current().subject() );
+        return nodes;
+    }
+}
+
+
+void RdfSchemaModelTest::init()
+{
+    m_model = Soprano::createModel();
+    QVERIFY( m_model );
+    m_schemaModel = new RdfSchemaModel( m_model );
+
+    // A -> B -> C -> D and A -> E
+    m_model->addStatement( testNode( "A" ), Vocabulary::RDFS::subClassOf(), testNode( "B" ) );
+    m_model->addStatement( testNode( "B" ), Vocabulary::RDFS::subClassOf(), testNode( "C" ) );
+    m_model->addStatement( testNode( "C" ), Vocabulary::RDFS::subClassOf(), testNode( "D" ) );
+    m_model->addStatement( testNode( "A" ), Vocabulary::RDFS::subClassOf(), testNode( "E" ) );
+}
+
+
+void RdfSchemaModelTest::cleanup()
+{
+    delete m_schemaModel;
+    delete m_model;
+}
+
+
+void RdfSchemaModelTest::testSubClassOf()
+{
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "A" ), testNode( "D" ) ) );
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "B" ), testNode( "D" ) ) );
+    QVERIFY( !m_schemaModel->isSubClassOf( testNode( "A" ), testNode( "A" ) ) );
+    QVERIFY( !m_schemaModel->isSubClassOf( testNode( "D" ), testNode( "A" ) ) );
+    QVERIFY( !m_schemaModel->isSubClassOf( testNode( "B" ), testNode( "E" ) ) );
+
+    QCOMPARE( objects( m_schemaModel->subClassOf( testNode( "A" ) ) ),
+              QSet<Node>() << testNode( "B" ) << testNode( "C" ) << testNode( "D" ) << testNode( "E" ) );
+    QCOMPARE( subjects( m_schemaModel->subClassOf( Node(), testNode( "C" ) ) ),
+              QSet<Node>() << testNode( "A" ) << testNode( "B" ) );
+    QCOMPARE( m_schemaModel->subClassOf( Node(), Node() ).allStatements().count(), 7 );
+}
+
+
+void RdfSchemaModelTest::testReflexiveSubClassOf()
+{
+    // like the other relations a class is only its own subclass if stated or entailed
+    QVERIFY( !m_schemaModel->isSubClassOf( testNode( "X" ), testNode( "X" ) ) );
+    QVERIFY( !m_schemaModel->subClassOf( testNode( "X" ), testNode( "X" ) ).next() );
+
+    m_model->addStatement( testNode( "X" ), Vocabulary::RDFS::subClassOf(), testNode( "X" ) );
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "X" ), testNode( "X" ) ) );
+    QCOMPARE( m_schemaModel->subClassOf( testNode( "X" ), testNode( "X" ) ).allStatements(),
+              QList<Statement>() << Statement( testNode( "X" ), Vocabulary::RDFS::subClassOf(), testNode( "X" ) ) );
+    QCOMPARE( objects( m_schemaModel->subClassOf( testNode( "X" ) ) ), QSet<Node>() << testNode( "X" ) );
+}
+
+
+void RdfSchemaModelTest::testSubPropertyOf()
+{
+    m_model->addStatement( testNode( "p1" ), Vocabulary::RDFS::subPropertyOf(), testNode( "p2" ) );
+    m_model->addStatement( testNode( "p2" ), Vocabulary::RDFS::subPropertyOf(), testNode( "p3" ) );
+
+    QVERIFY( m_schemaModel->isSubPropertyOf( testNode( "p1" ), testNode( "p3" ) ) );
+    QVERIFY( !m_schemaModel->isSubPropertyOf( testNode( "p3" ), testNode( "p1" ) ) );
+
+    // the class hierarchy is separate
+    QVERIFY( !m_schemaModel->isSubPropertyOf( testNode( "A" ), testNode( "B" ) ) );
+}
+
+
+void RdfSchemaModelTest::testType()
+{
+    m_model->addStatement( testNode( "x" ), Vocabulary::RDF::type(), testNode( "B" ) );
+    m_model->addStatement( testNode( "y" ), Vocabulary::RDF::type(), testNode( "A" ) );
+    m_model->addStatement( testNode( "y" ), Vocabulary::RDF::type(), testNode( "B" ) );
+
+    QVERIFY( m_schemaModel->isType( testNode( "x" ), testNode( "D" ) ) );
+    QVERIFY( !m_schemaModel->isType( testNode( "x" ), testNode( "E" ) ) );
+    QVERIFY( m_schemaModel->isType( testNode( "y" ), testNode( "E" ) ) );
+
+    QCOMPARE( objects( m_schemaModel->type( testNode( "x" ), Node() ) ),
+              QSet<Node>() << testNode( "B" ) << testNode( "C" ) << testNode( "D" ) );
+
+    // each instance is reported once
+    QList<Statement> instances = m_schemaModel->type( Node(), testNode( "C" ) ).allStatements();
+    QCOMPARE( instances.count(), 2 );
+    QCOMPARE( subjects( Util::SimpleStatementIterator( instances ) ), QSet<Node>() << testNode( "x" ) << testNode( "y" ) );
+
+    // x: B, C, D  y: A, B, C, D, E
+    QCOMPARE( m_schemaModel->type( Node(), Node() ).allStatements().count(), 8 );
+}
+
+
+void RdfSchemaModelTest::testHierarchyUpdates()
+{
+    QVERIFY( !m_schemaModel->isSubClassOf( testNode( "D" ), testNode( "F" ) ) );
+
+    // added relations are merged into the closure
+    m_model->addStatement( testNode( "D" ), Vocabulary::RDFS::subClassOf(), testNode( "F" ) );
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "A" ), testNode( "F" ) ) );
+
+    // removed relations trigger a rebuild
+    m_model->removeStatement( Statement( testNode( "B" ), Vocabulary::RDFS::subClassOf(), testNode( "C" ) ) );
+    QVERIFY( !m_schemaModel->isSubClassOf( testNode( "A" ), testNode( "F" ) ) );
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "A" ), testNode( "B" ) ) );
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "C" ), testNode( "F" ) ) );
+}
+
+
+void RdfSchemaModelTest::testCycle()
+{
+    m_model->addStatement( testNode( "D" ), Vocabulary::RDFS::subClassOf(), testNode( "A" ) );
+
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "D" ), testNode( "E" ) ) );
+    QVERIFY( m_schemaModel->isSubClassOf( testNode( "C" ), testNode( "B" ) ) );
+    QCOMPARE( objects( m_schemaModel->subClassOf( testNode( "B" ) ) ),
+              QSet<Node>() << testNode( "A" ) << testNode( "B" ) << testNode( "C" ) << testNode( "D" ) << testNode( "E" ) );
+}
+
+QTEST_MAIN( RdfSchemaModelTest )
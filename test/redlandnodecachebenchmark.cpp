@@ -0,0 +1,116 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "redlandnodecachebenchmark.h"
+#include "redlandworld.h"
+
+#include "soprano.h"
+
+#include <QtTest/QtTest>
+
+using namespace Soprano;
+
+namespace {
+    const int s_statementCount = 10000;
+    const int s_predicateCount = 20;
+
+    void addCacheSizeRows()
+    {
+        QTest::addColumn<int>( "cacheSize" );
+
+        QTest::newRow( "uncached" ) << 0;
+        QTest::newRow( "cached" ) << 10000;
+    }
+}
+
+
+void RedlandNodeCacheBenchmark::initTestCase()
+{
+    // a typical result: many subjects sharing few predicates and datatypes
+    for ( int i = 0; i < s_statementCount; ++i ) {
+        m_statements.append( Statement( QUrl( QString::fromLatin1( "http://soprano.org/benchmark#r%1" ).arg( i ) ),
+                                        QUrl( QString::fromLatin1( "http://soprano.org/benchmark#p%1" ).arg( i % s_predicateCount ) ),
+                                        LiteralValue( i ) ) );
+    }
+}
+
+
+void RedlandNodeCacheBenchmark::benchmarkToSoprano_data()
+{
+    addCacheSizeRows();
+}
+
+
+void RedlandNodeCacheBenchmark::benchmarkToSoprano()
+{
+    QFETCH( int, cacheSize );
+
+    Redland::World* world = Redland::World::theWorld();
+    world->setNodeCacheSize( cacheSize );
+
+    QList<librdf_statement*> redlandStatements;
+    Q_FOREACH( const Statement& s, m_statements ) {
+        redlandStatements.append( world->createStatement( s ) );
+    }
+
+    world->resetNodeCacheStatistics();
+
+    QBENCHMARK {
+        Q_FOREACH( librdf_statement* st, redlandStatements ) {
+            ( void )world->createStatement( st );
+        }
+    }
+
+    qDebug() << "Node cache hit rate:" << world->nodeCacheStatistics().hitRate()
+             << "average conversion time (ns):" << world->nodeCacheStatistics().averageConversionTime();
+
+    Q_FOREACH( librdf_statement* st, redlandStatements ) {
+        world->freeStatement( st );
+    }
+}
+
+
+void RedlandNodeCacheBenchmark::benchmarkToRedland_data()
+{
+    addCacheSizeRows();
+}
+
+
+void RedlandNodeCacheBenchmark::benchmarkToRedland()
+{
+    QFETCH( int, cacheSize );
+
+    Redland::World* world = Redland::World::theWorld();
+    world->setNodeCacheSize( cacheSize );
+    world->resetNodeCacheStatistics();
+
+    QBENCHMARK {
+        Q_FOREACH( const Statement& s, m_statements ) {
+            world->freeStatement( world->createStatement( s ) );
+        }
+    }
+
+    qDebug() << "Node cache hit rate:" << world->nodeCacheStatistics().hitRate()
+             << "average conversion time (ns):" << world->nodeCacheStatistics().averageConversionTime();
+}
+
+QTEST_MAIN( RedlandNodeCacheBenchmark )
@@ -0,0 +1,51 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#ifndef _REDLAND_NODE_CACHE_BENCHMARK_H_
+#define _REDLAND_NODE_CACHE_BENCHMARK_H_
+
+#include <QtCore/QObject>
+#include <QtCore/QList>
+
+#include "statement.h"
+
+/**
+ * Compares the conversion between redland and Soprano nodes with and
+ * without the node cache of Redland::World.
+ * This is not run as part of the test suite.
+ */
+class RedlandNodeCacheBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void benchmarkToSoprano_data();
+    void benchmarkToSoprano();
+    void benchmarkToRedland_data();
+    void benchmarkToRedland();
+
+private:
+    QList<Soprano::Statement> m_statements;
+};
+
+#endif
@@ -0,0 +1,252 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "redlandnodecachetest.h"
+#include "redlandworld.h"
+
+#include "soprano.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+
+using namespace Soprano;
+
+namespace {
+    const int s_defaultCacheSize = 10000;
+
+    QUrl testUri( const QString& name, int i = 0 )
+    {
+        return QUrl( QString::fromLatin1( "http://soprano.org/nodecachetest#%1%2" ).arg( name ).arg( i ) );
+    }
+
+    /// Converts \p s to redland and back.
+    Statement roundTrip( const Statement& s )
+    {
+        Redland::World* world = Redland::World::theWorld();
+        librdf_statement* redlandStatement = world->createStatement( s );
+        const Statement result = world->createStatement( redlandStatement );
+        world->freeStatement( redlandStatement );
+        return result;
+    }
+
+    class ConversionThread : public QThread
+    {
+    public:
+        ConversionThread( int id )
+            : m_id( id ),
+              m_failures( 0 ) {
+        }
+
+        void run() {
+            for ( int i = 0; i < 500; ++i ) {
+                // shared predicates, thread specific subjects
+                const Statement s( testUri( QString::fromLatin1( "thread%1r" ).arg( m_id ), i % 50 ),
+                                   testUri( QLatin1String( "threadp" ), i % 5 ),
+                                   LiteralValue( i ) );
+                if ( roundTrip( s ) != s ) {
+                    ++m_failures;
+                }
+            }
+        }
+
+        int failures() const { return m_failures; }
+
+    private:
+        int m_id;
+        int m_failures;
+    };
+}
+
+
+void RedlandNodeCacheTest::init()
+{
+    Redland::World::theWorld()->setNodeCacheSize( s_defaultCacheSize );
+    Redland::World::theWorld()->resetNodeCacheStatistics();
+}
+
+
+void RedlandNodeCacheTest::cleanupTestCase()
+{
+    Redland::World::theWorld()->setNodeCacheSize( s_defaultCacheSize );
+}
+
+
+void RedlandNodeCacheTest::testRoundTrip()
+{
+    const Statement s( testUri( QLatin1String( "roundtrip" ) ),
+                       testUri( QLatin1String( "roundtripp" ) ),
+                       testUri( QLatin1String( "roundtripo" ) ) );
+
+    // the second conversion is served from the cache and has to be the same
+    QCOMPARE( roundTrip( s ), s );
+    QCOMPARE( roundTrip( s ), s );
+
+    const Statement blank( Node( QString::fromLatin1( "b1" ) ),
+                           testUri( QLatin1String( "roundtripp" ) ),
+                           LiteralValue::createPlainLiteral( QLatin1String( "foo" ), QLatin1String( "en" ) ) );
+    QCOMPARE( roundTrip( blank ), blank );
+    QCOMPARE( roundTrip( blank ), blank );
+}
+
+
+void RedlandNodeCacheTest::testCacheStatistics()
+{
+    Redland::World* world = Redland::World::theWorld();
+
+    // plain literals do not convert a datatype: two resources in each direction
+    const Statement s( testUri( QLatin1String( "stats" ) ),
+                       testUri( QLatin1String( "statsp" ) ),
+                       LiteralValue::createPlainLiteral( QLatin1String( "foo" ) ) );
+
+    QCOMPARE( roundTrip( s ), s );
+    QCOMPARE( world->nodeCacheStatistics().hits, quint64( 0 ) );
+    QCOMPARE( world->nodeCacheStatistics().misses, quint64( 4 ) );
+
+    QCOMPARE( roundTrip( s ), s );
+    QCOMPARE( world->nodeCacheStatistics().hits, quint64( 4 ) );
+    QCOMPARE( world->nodeCacheStatistics().misses, quint64( 4 ) );
+    QCOMPARE( world->nodeCacheStatistics().hitRate(), 0.5 );
+
+    world->resetNodeCacheStatistics();
+    QCOMPARE( world->nodeCacheStatistics().hits, quint64( 0 ) );
+    QCOMPARE( world->nodeCacheStatistics().misses, quint64( 0 ) );
+    QCOMPARE( world->nodeCacheStatistics().hitRate(), 0.0 );
+}
+
+
+void RedlandNodeCacheTest::testDisabledCache()
+{
+    Redland::World* world = Redland::World::theWorld();
+    world->setNodeCacheSize( 0 );
+    QCOMPARE( world->nodeCacheSize(), 0 );
+
+    const Statement s( testUri( QLatin1String( "disabled" ) ),
+                       testUri( QLatin1String( "disabledp" ) ),
+                       LiteralValue::createPlainLiteral( QLatin1String( "foo" ) ) );
+
+    QCOMPARE( roundTrip( s ), s );
+    QCOMPARE( roundTrip( s ), s );
+    QCOMPARE( world->nodeCacheStatistics().hits, quint64( 0 ) );
+    QCOMPARE( world->nodeCacheStatistics().misses, quint64( 8 ) );
+
+    // negative sizes disable the cache, too
+    world->setNodeCacheSize( -1 );
+    QCOMPARE( world->nodeCacheSize(), 0 );
+}
+
+
+void RedlandNodeCacheTest::testEviction()
+{
+    Redland::World* world = Redland::World::theWorld();
+    world->setNodeCacheSize( 3 );
+
+    // many more URIs than fit into the cache
+    for ( int round = 0; round < 2; ++round ) {
+        for ( int i = 0; i < 20; ++i ) {
+            const Statement s( testUri( QLatin1String( "evict" ), i ),
+                               testUri( QLatin1String( "evictp" ), i % 2 ),
+                               testUri( QLatin1String( "evicto" ), i ) );
+            QCOMPARE( roundTrip( s ), s );
+        }
+    }
+
+    const Redland::World::NodeCacheStatistics stats = world->nodeCacheStatistics();
+    QCOMPARE( stats.hits + stats.misses, quint64( 2 * 20 * 3 * 2 ) );
+    QVERIFY( stats.misses > stats.hits );
+}
+
+
+void RedlandNodeCacheTest::testTypedLiterals()
+{
+    QList<LiteralValue> values;
+    values << LiteralValue( 42 )
+           << LiteralValue( 3.5 )
+           << LiteralValue( true )
+           << LiteralValue( QString::fromLatin1( "foo" ) )
+           << LiteralValue( QDateTime( QDate( 2010, 1, 1 ), QTime( 12, 0 ), Qt::UTC ) )
+           << LiteralValue::fromString( QLatin1String( "bar" ), testUri( QLatin1String( "datatype" ) ) );
+
+    // the datatypes are converted through the cache, too
+    for ( int round = 0; round < 2; ++round ) {
+        Q_FOREACH( const LiteralValue& value, values ) {
+            const Statement s( testUri( QLatin1String( "typed" ) ),
+                               testUri( QLatin1String( "typedp" ) ),
+                               value );
+            const Statement result = roundTrip( s );
+            QCOMPARE( result, s );
+            QCOMPARE( result.object().dataType(), value.dataTypeUri() );
+        }
+    }
+
+    QVERIFY( Redland::World::theWorld()->nodeCacheStatistics().hits > 0 );
+}
+
+
+void RedlandNodeCacheTest::testConversionTime()
+{
+    Redland::World* world = Redland::World::theWorld();
+    QCOMPARE( world->nodeCacheStatistics().conversionTime, quint64( 0 ) );
+    QCOMPARE( world->nodeCacheStatistics().averageConversionTime(), 0.0 );
+
+    for ( int i = 0; i < 1000; ++i ) {
+        const Statement s( testUri( QLatin1String( "time" ), i ),
+                           testUri( QLatin1String( "timep" ) ),
+                           testUri( QLatin1String( "timeo" ), i ) );
+        QCOMPARE( roundTrip( s ), s );
+    }
+
+    const Redland::World::NodeCacheStatistics stats = world->nodeCacheStatistics();
+#if QT_VERSION >= 0x040800
+    QVERIFY( stats.conversionTime > 0 );
+    QVERIFY( stats.averageConversionTime() > 0.0 );
+#endif
+    QCOMPARE( stats.averageConversionTime(), double( stats.conversionTime ) / double( stats.hits + stats.misses ) );
+
+    world->resetNodeCacheStatistics();
+    QCOMPARE( world->nodeCacheStatistics().conversionTime, quint64( 0 ) );
+}
+
+
+void RedlandNodeCacheTest::testConcurrentConversion()
+{
+    // a small cache forces evictions while other threads convert
+    Redland::World::theWorld()->setNodeCacheSize( 20 );
+
+    QList<ConversionThread*> threads;
+    for ( int i = 0; i < 8; ++i ) {
+        threads << new ConversionThread( i );
+    }
+    Q_FOREACH( ConversionThread* thread, threads ) {
+        thread->start();
+    }
+    Q_FOREACH( ConversionThread* thread, threads ) {
+        thread->wait();
+    }
+    Q_FOREACH( ConversionThread* thread, threads ) {
+        QCOMPARE( thread->failures(), 0 );
+    }
+    qDeleteAll( threads );
+
+    const Redland::World::NodeCacheStatistics stats = Redland::World::theWorld()->nodeCacheStatistics();
+    QCOMPARE( stats.hits + stats.misses, quint64( 8 * 500 * 3 * 2 ) );
+}
+
+QTEST_MAIN( RedlandNodeCacheTest )
@@ -0,0 +1,181 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "scalablereadwritelocktest.h"
+#include "scalablereadwritelock.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+#include <QtCore/QAtomicInt>
+
+
+namespace {
+    class ReadThread : public QThread
+    {
+    public:
+        ReadThread( ScalableReadWriteLock* lock, bool unlock = true )
+            : m_lock( lock ),
+              m_unlock( unlock ) {
+        }
+
+    protected:
+        void run() {
+            m_lock->lockForRead();
+            if ( m_unlock )
+                m_lock->unlock();
+        }
+
+    private:
+        ScalableReadWriteLock* m_lock;
+        bool m_unlock;
+    };
+
+    class WriteThread : public QThread
+    {
+    public:
+        WriteThread( ScalableReadWriteLock* lock, int* counter, int rounds )
+            : m_lock( lock ),
+              m_counter( counter ),
+              m_rounds( rounds ) {
+        }
+
+    protected:
+        void run() {
+            for ( int i = 0; i < m_rounds; ++i ) {
+                m_lock->lockForWrite();
+                int value = *m_counter;
+                QThread::yieldCurrentThread();
+                *m_counter = value + 1;
+                m_lock->unlock();
+            }
+        }
+
+    private:
+        ScalableReadWriteLock* m_lock;
+        int* m_counter;
+        int m_rounds;
+    };
+
+    class UnlockThread : public QThread
+    {
+    public:
+        UnlockThread( ScalableReadWriteLock* lock )
+            : m_lock( lock ) {
+        }
+
+    protected:
+        void run() {
+            m_lock->unlock();
+        }
+
+    private:
+        ScalableReadWriteLock* m_lock;
+    };
+}
+
+
+void ScalableReadWriteLockTest::testConcurrentReaders()
+{
+    ScalableReadWriteLock lock;
+
+    // another thread can read while this one holds a read lock
+    lock.lockForRead();
+    ReadThread reader( &lock );
+    reader.start();
+    QVERIFY( reader.wait( 5000 ) );
+    lock.unlock();
+
+    // the lock is free again
+    lock.lockForWrite();
+    lock.unlock();
+}
+
+
+void ScalableReadWriteLockTest::testWriterExclusion()
+{
+    ScalableReadWriteLock lock;
+    int counter = 0;
+
+    QList<WriteThread*> writers;
+    for ( int i = 0; i < 4; ++i )
+        writers.append( new WriteThread( &lock, &counter, 1000 ) );
+    Q_FOREACH( WriteThread* thread, writers )
+        thread->start();
+    Q_FOREACH( WriteThread* thread, writers )
+        QVERIFY( thread->wait( 30000 ) );
+    qDeleteAll( writers );
+
+    QCOMPARE( counter, 4000 );
+}
+
+
+void ScalableReadWriteLockTest::testNestedReadWithWaitingWriter()
+{
+    ScalableReadWriteLock lock;
+    int counter = 0;
+
+    lock.lockForRead();
+
+    WriteThread writer( &lock, &counter, 1 );
+    writer.start();
+
+    // the writer blocks on our read lock
+    QVERIFY( !writer.wait( 200 ) );
+    QCOMPARE( counter, 0 );
+
+    // a nested read lock does not wait for the writer
+    lock.lockForRead();
+    lock.unlock();
+
+    // but new readers do
+    ReadThread reader( &lock );
+    reader.start();
+    QVERIFY( !reader.wait( 200 ) );
+
+    lock.unlock();
+    QVERIFY( writer.wait( 5000 ) );
+    QVERIFY( reader.wait( 5000 ) );
+    QCOMPARE( counter, 1 );
+}
+
+
+void ScalableReadWriteLockTest::testForeignUnlock()
+{
+    ScalableReadWriteLock lock;
+
+    // a read lock acquired in one thread and released in another,
+    // like an iterator which is closed in another thread
+    ReadThread reader( &lock, false );
+    reader.start();
+    QVERIFY( reader.wait( 5000 ) );
+
+    UnlockThread unlocker( &lock );
+    unlocker.start();
+    QVERIFY( unlocker.wait( 5000 ) );
+
+    int counter = 0;
+    WriteThread writer( &lock, &counter, 1 );
+    writer.start();
+    QVERIFY( writer.wait( 5000 ) );
+    QCOMPARE( counter, 1 );
+}
+
+QTEST_MAIN( ScalableReadWriteLockTest )
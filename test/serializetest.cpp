@@ -134,6 +134,97 @@ void SerializerTest::testSerializer()
 }
 
 
+void SerializerTest::testBinarySerialization()
+{
+    const QString mimeType = QLatin1String( "application/x-soprano-binary-rdf" );
+
+    const Serializer* serializer = PluginManager::instance()->discoverSerializerForSerialization( SerializationUser, mimeType );
+    const Parser* parser = PluginManager::instance()->discoverParserForSerialization( SerializationUser, mimeType );
+    if ( !serializer || !parser ) {
+        qDebug() << "Binary RDF plugins not found. Skipping test.";
+        return;
+    }
+
+    QList<Statement> referenceStatements = testData( true );
+    referenceStatements << Statement( QUrl( "http://soprano.sf.net/testdata/Soprano" ),
+                                      QUrl( "http://soprano.sf.net/test#int" ),
+                                      LiteralValue( -42 ) )
+                        << Statement( QUrl( "http://soprano.sf.net/testdata/Soprano" ),
+                                      QUrl( "http://soprano.sf.net/test#double" ),
+                                      LiteralValue( 3.14159 ) )
+                        << Statement( QUrl( "http://soprano.sf.net/testdata/Soprano" ),
+                                      QUrl( "http://soprano.sf.net/test#bool" ),
+                                      LiteralValue( true ) )
+                        << Statement( QUrl( "http://soprano.sf.net/testdata/Soprano" ),
+                                      QUrl( "http://soprano.sf.net/test#label" ),
+                                      LiteralValue::createPlainLiteral( QString::fromUtf8( "Sopr\xc3\xa4no" ), "de" ) )
+                        << Statement( Node( QString( "blank1" ) ),
+                                      QUrl( "http://soprano.sf.net/test#decimal" ),
+                                      LiteralValue::fromString( "17", Vocabulary::XMLSchema::decimal() ) );
+
+    QByteArray data;
+    QTextStream out( &data, QIODevice::WriteOnly );
+    QVERIFY( serializer->serialize( Util::SimpleStatementIterator( referenceStatements ), out, SerializationUser, mimeType ) );
+
+    QTextStream in( &data, QIODevice::ReadOnly );
+    QList<Statement> all = parser->parseStream( in, QUrl(), SerializationUser, mimeType ).allStatements();
+    QVERIFY( !parser->lastError() );
+
+    QCOMPARE( all.count(), referenceStatements.count() );
+    Q_FOREACH( const Statement& s, referenceStatements ) {
+        QVERIFY( all.contains( s ) );
+    }
+
+    // corrupt data has to be rejected
+    data.truncate( data.size() - 4 );
+    QTextStream truncated( &data, QIODevice::ReadOnly );
+    QVERIFY( !parser->parseStream( truncated, QUrl(), SerializationUser, mimeType ).next() );
+    QVERIFY( parser->lastError() );
+}
+
+
+void SerializerTest::testBinaryMalformedLength()
+{
+    const QString mimeType = QLatin1String( "application/x-soprano-binary-rdf" );
+
+    const Serializer* serializer = PluginManager::instance()->discoverSerializerForSerialization( SerializationUser, mimeType );
+    const Parser* parser = PluginManager::instance()->discoverParserForSerialization( SerializationUser, mimeType );
+    if ( !serializer || !parser ) {
+        qDebug() << "Binary RDF plugins not found. Skipping test.";
+        return;
+    }
+
+    QList<Statement> statements;
+    statements << Statement( QUrl( "http://soprano.sf.net/testdata/Soprano" ),
+                             QUrl( "http://soprano.sf.net/test#label" ),
+                             LiteralValue( QLatin1String( "Soprano" ) ) );
+
+    QByteArray data;
+    QTextStream out( &data, QIODevice::WriteOnly );
+    QVERIFY( serializer->serialize( Util::SimpleStatementIterator( statements ), out, SerializationUser, mimeType ) );
+    out.flush();
+
+    // the node table offset lives at byte 24 of the header, the first record starts with its tag followed by the length
+    quint64 nodeTableOffset = 0;
+    for ( int i = 7; i >= 0; --i ) {
+        nodeTableOffset = ( nodeTableOffset << 8 ) | quint8( data[24 + i] );
+    }
+    QVERIFY( nodeTableOffset + 8 <= quint64( data.size() ) );
+
+    // lengths which overflow once padded to a multiple of 4
+    const quint32 lengths[] = { 0x7FFFFFFD, 0x7FFFFFFF, 0xFFFFFFFF };
+    for ( unsigned int i = 0; i < sizeof( lengths ) / sizeof( lengths[0] ); ++i ) {
+        QByteArray corrupt( data );
+        for ( int b = 0; b < 4; ++b ) {
+            corrupt[int( nodeTableOffset ) + 4 + b] = char( ( lengths[i] >> ( 8 * b ) ) & 0xFF );
+        }
+        QTextStream in( &corrupt, QIODevice::ReadOnly );
+        QVERIFY( !parser->parseStream( in, QUrl(), SerializationUser, mimeType ).next() );
+        QVERIFY( parser->lastError() );
+    }
+}
+
+
 #if 0
 void SerializerTest::testEncoding()
 {
@@ -43,6 +43,8 @@ private Q_SLOTS:
     void init();
     void testSerializer_data();
     void testSerializer();
+    void testBinarySerialization();
+    void testBinaryMalformedLength();
     //void testEncoding();
     private:
         //QList<Soprano::Statement> referenceStatements;
@@ -0,0 +1,222 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "servercanceltest.h"
+#include "../client/localsocketclient.h"
+#include "../server/servercore.h"
+
+#include "backend.h"
+#include "filtermodel.h"
+#include "queryresultiterator.h"
+#include "requestcontext.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+#include <QtCore/QSemaphore>
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QDir>
+#include <QtCore/QCoreApplication>
+
+
+using namespace Soprano;
+
+namespace {
+    /// the longest time a query blocks if it is never cancelled
+    const int s_maxQueryTime = 20000;
+
+    /// released each time a query starts blocking
+    QSemaphore s_queryStarted;
+
+    /**
+     * Blocks queries until the request of the calling connection
+     * is cancelled. All other methods fail since there is no parent.
+     */
+    class BlockingModel : public FilterModel
+    {
+    public:
+        QueryResultIterator executeQuery( const QString&, Query::QueryLanguage, const QString& ) const {
+            const RequestContext context = RequestContext::current();
+            s_queryStarted.release();
+
+            QMutex mutex;
+            QWaitCondition wc;
+            QElapsedTimer timer;
+            timer.start();
+
+            mutex.lock();
+            while ( !context.isCancelled() && timer.elapsed() < s_maxQueryTime ) {
+                wc.wait( &mutex, 10 );
+            }
+            mutex.unlock();
+
+            if ( context.isCancelled() ) {
+                setError( context.cancelError() );
+            }
+            else {
+                setError( "Query has not been cancelled" );
+            }
+            return QueryResultIterator();
+        }
+    };
+
+    class BlockingServerCore : public Server::ServerCore
+    {
+    protected:
+        Model* createModel( const QList<BackendSetting>& ) {
+            return new BlockingModel();
+        }
+    };
+
+    class QueryThread : public QThread
+    {
+    public:
+        QueryThread( Model* model )
+            : m_model( model ) {
+        }
+
+        void run() {
+            QueryResultIterator it = m_model->executeQuery( QLatin1String( "select * where { ?r ?p ?o . }" ),
+                                                            Query::QueryLanguageSparql );
+            m_error = m_model->lastError();
+        }
+
+        Error::Error error() const { return m_error; }
+
+    private:
+        Model* m_model;
+        Error::Error m_error;
+    };
+}
+
+
+/**
+ * The server needs its own event loop to accept connections
+ * while the test thread blocks in the client.
+ */
+class ServerThread : public QThread
+{
+public:
+    ServerThread( const QString& socketPath )
+        : m_socketPath( socketPath ),
+          m_started( false ) {
+    }
+
+    bool waitForStarted() {
+        m_startup.acquire();
+        return m_started;
+    }
+
+protected:
+    void run() {
+        BlockingServerCore core;
+        m_started = core.start( m_socketPath );
+        m_startup.release();
+        if ( m_started ) {
+            exec();
+        }
+    }
+
+private:
+    QString m_socketPath;
+    bool m_started;
+    QSemaphore m_startup;
+};
+
+
+void ServerCancelTest::initTestCase()
+{
+    const QString socketPath = QDir::tempPath() + QString::fromLatin1( "/soprano-servercanceltest-%1" ).arg( QCoreApplication::applicationPid() );
+    QFile::remove( socketPath );
+
+    m_server = new ServerThread( socketPath );
+    m_server->start();
+    QVERIFY( m_server->waitForStarted() );
+
+    m_client = new Client::LocalSocketClient();
+    QVERIFY( m_client->connect( socketPath ) );
+
+    m_model = m_client->createModel( QLatin1String( "blocking" ) );
+    QVERIFY( m_model );
+}
+
+
+void ServerCancelTest::cleanupTestCase()
+{
+    // close the connections before the server goes away
+    delete m_model;
+    delete m_client;
+
+    m_server->quit();
+    m_server->wait();
+    delete m_server;
+}
+
+
+void ServerCancelTest::testCancelRequest()
+{
+    m_client->setRequestTimeout( 0 );
+
+    QueryThread query( m_model );
+    query.start();
+
+    // the cancel command is sent through a second connection while the query blocks the first one
+    QVERIFY( s_queryStarted.tryAcquire( 1, s_maxQueryTime ) );
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY( m_client->cancelRunningRequest() );
+
+    QVERIFY( query.wait( s_maxQueryTime ) );
+    QVERIFY( timer.elapsed() < s_maxQueryTime );
+    QCOMPARE( query.error().code(), int( Error::ErrorTimeout ) );
+
+    // the connection is still usable
+    QVERIFY( m_client->isConnected() );
+}
+
+
+void ServerCancelTest::testRequestTimeout()
+{
+    m_client->setRequestTimeout( 200 );
+
+    QElapsedTimer timer;
+    timer.start();
+    QueryResultIterator it = m_model->executeQuery( QLatin1String( "select * where { ?r ?p ?o . }" ),
+                                                    Query::QueryLanguageSparql );
+    QVERIFY( !it.isValid() );
+    QCOMPARE( m_model->lastError().code(), int( Error::ErrorTimeout ) );
+    QVERIFY( timer.elapsed() >= 200 );
+    QVERIFY( timer.elapsed() < s_maxQueryTime );
+    QVERIFY( s_queryStarted.tryAcquire() );
+
+    m_client->setRequestTimeout( 0 );
+}
+
+
+void ServerCancelTest::testCancelWithoutRequest()
+{
+    // nothing running on behalf of this client
+    QVERIFY( !m_client->cancelRunningRequest() );
+    QVERIFY( m_client->lastError() );
+}
+
+QTEST_MAIN( ServerCancelTest )
@@ -0,0 +1,57 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef _SERVER_CANCEL_TEST_H_
+#define _SERVER_CANCEL_TEST_H_
+
+#include <QtCore/QObject>
+
+namespace Soprano {
+    class Model;
+    namespace Client {
+        class LocalSocketClient;
+    }
+}
+
+class ServerThread;
+
+/**
+ * Runs a server in-process whose model blocks in executeQuery
+ * until the running request is cancelled or its deadline passed.
+ */
+class ServerCancelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void testCancelRequest();
+    void testRequestTimeout();
+    void testCancelWithoutRequest();
+
+private:
+    ServerThread* m_server;
+    Soprano::Client::LocalSocketClient* m_client;
+    Soprano::Model* m_model;
+};
+
+#endif
@@ -513,5 +513,43 @@ void ServerOperatorTest::testBinding()
     }
 }
 
+
+void ServerOperatorTest::testBindingSchema()
+{
+    BindingSchema schema( QStringList() << "val1" << "val2" );
+    BindingSet row1( schema, QVector<Node>() << Node( QUrl( "http://soprano.org/mytestresource" ) ) << Node( LiteralValue( 42 ) ) );
+    BindingSet row2( schema, QVector<Node>() << Node( Vocabulary::RDFS::label() ) << Node() );
+
+    QByteArray data;
+    QBuffer buffer( &data );
+    buffer.open( QIODevice::ReadWrite );
+    Server::DataStream s( &buffer );
+
+    // the names are only written once
+    QVERIFY( s.writeBindingSchema( row1.schema() ) );
+    QVERIFY( s.writeBindingValues( row1 ) );
+    QVERIFY( s.writeBindingValues( row2 ) );
+
+    buffer.seek( 0 );
+    BindingSchema readSchema;
+    BindingSet copy1, copy2;
+    QVERIFY( s.readBindingSchema( readSchema ) );
+    QVERIFY( s.readBindingValues( readSchema, copy1 ) );
+    QVERIFY( s.readBindingValues( readSchema, copy2 ) );
+
+    QCOMPARE( readSchema, schema );
+    QCOMPARE( copy1, row1 );
+    QCOMPARE( copy2, row2 );
+    QCOMPARE( copy2["val1"], Node( Vocabulary::RDFS::label() ) );
+    QCOMPARE( copy1.bindingNames(), copy2.bindingNames() );
+
+    // values which do not match the schema are rejected
+    buffer.seek( 0 );
+    QVERIFY( s.writeBindingValues( row1 ) );
+    buffer.seek( 0 );
+    BindingSet invalid;
+    QVERIFY( !s.readBindingValues( BindingSchema( QStringList() << "val1" ), invalid ) );
+}
+
 QTEST_MAIN( ServerOperatorTest )
 
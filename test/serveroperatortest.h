@@ -59,6 +59,7 @@ private Q_SLOTS:
     void testStatement();
     void testBinding_data();
     void testBinding();
+    void testBindingSchema();
 };
 
 #endif
@@ -0,0 +1,125 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "shardedmodelbenchmark.h"
+
+#include "soprano.h"
+#include "shardedmodel.h"
+
+#include <QtTest/QtTest>
+
+using namespace Soprano;
+
+namespace {
+    const int s_resourceCount = 20000;
+    const int s_graphCount = 500;
+
+    QUrl ex( const QString& name ) {
+        return QUrl( QLatin1String( "http://soprano.org/benchmark#" ) + name );
+    }
+}
+
+
+void ShardedModelBenchmark::initTestCase()
+{
+    for ( int i = 0; i < s_resourceCount; ++i ) {
+        const QUrl res = ex( QString( "res%1" ).arg( i ) );
+        const QUrl graph = ex( QString( "graph%1" ).arg( i % s_graphCount ) );
+        m_data.append( Statement( res, Vocabulary::RDF::type(), ex( "Resource" ), graph ) );
+        m_data.append( Statement( res, ex( "label" ), LiteralValue( QString( "Resource %1" ).arg( i ) ), graph ) );
+        m_data.append( Statement( res, ex( "next" ), ex( QString( "res%1" ).arg( ( i + 1 ) % s_resourceCount ) ), graph ) );
+    }
+}
+
+
+void ShardedModelBenchmark::addShardColumn()
+{
+    QTest::addColumn<int>( "shards" );
+
+    QTest::newRow( "1 shard" ) << 1;
+    QTest::newRow( "2 shards" ) << 2;
+    QTest::newRow( "4 shards" ) << 4;
+    QTest::newRow( "8 shards" ) << 8;
+}
+
+
+QList<Soprano::Model*> ShardedModelBenchmark::createShards( int count )
+{
+    QList<Model*> shards;
+    for ( int i = 0; i < count; ++i ) {
+        Model* shard = Soprano::createModel();
+        if ( !shard ) {
+            qDeleteAll( shards );
+            return QList<Model*>();
+        }
+        shards.append( shard );
+    }
+    return shards;
+}
+
+
+void ShardedModelBenchmark::benchmarkAddStatements_data()
+{
+    addShardColumn();
+}
+
+
+void ShardedModelBenchmark::benchmarkAddStatements()
+{
+    QFETCH( int, shards );
+
+    QBENCHMARK {
+        QList<Model*> shardModels = createShards( shards );
+        QVERIFY( !shardModels.isEmpty() );
+        Util::ShardedModel model( shardModels );
+        QVERIFY( model.addStatements( m_data ) == Error::ErrorNone );
+        qDeleteAll( shardModels );
+    }
+}
+
+
+void ShardedModelBenchmark::benchmarkListStatements_data()
+{
+    addShardColumn();
+}
+
+
+void ShardedModelBenchmark::benchmarkListStatements()
+{
+    QFETCH( int, shards );
+
+    QList<Model*> shardModels = createShards( shards );
+    QVERIFY( !shardModels.isEmpty() );
+    Util::ShardedModel model( shardModels );
+    QVERIFY( model.addStatements( m_data ) == Error::ErrorNone );
+
+    QBENCHMARK {
+        int count = 0;
+        StatementIterator it = model.listStatements();
+        while ( it.next() )
+            ++count;
+        QCOMPARE( count, m_data.count() );
+    }
+
+    qDeleteAll( shardModels );
+}
+
+QTEST_MAIN( ShardedModelBenchmark )
@@ -0,0 +1,250 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "shardedmodeltest.h"
+#include "soprano/soprano.h"
+#include "soprano/util/shardedmodel.h"
+#include "soprano/vocabulary/rdf.h"
+
+#include <QtTest/QTest>
+
+using namespace Soprano;
+
+Q_DECLARE_METATYPE( Soprano::Util::ShardedModel::ShardingMode )
+
+namespace {
+    const int s_shardCount = 4;
+    const int s_resourceCount = 50;
+    const int s_graphCount = 5;
+
+    Node testNode( const QString& name ) {
+        return Node( QUrl( QLatin1String( "http://soprano.org/test#" ) + name ) );
+    }
+
+    QList<Statement> testStatements() {
+        QList<Statement> statements;
+        for ( int i = 0; i < s_resourceCount; ++i ) {
+            const Node res = testNode( QString( "res%1" ).arg( i ) );
+            const Node graph = testNode( QString( "graph%1" ).arg( i % s_graphCount ) );
+            statements.append( Statement( res, Vocabulary::RDF::type(), testNode( "Resource" ), graph ) );
+            statements.append( Statement( res, testNode( "label" ), LiteralValue( QString( "Resource %1" ).arg( i ) ), graph ) );
+        }
+        return statements;
+    }
+
+    void addModeColumn() {
+        QTest::addColumn<Util::ShardedModel::ShardingMode>( "mode" );
+        QTest::newRow( "by context" ) << Util::ShardedModel::ShardByContext;
+        QTest::newRow( "by subject" ) << Util::ShardedModel::ShardBySubject;
+    }
+}
+
+
+void ShardedModelTest::init()
+{
+    for ( int i = 0; i < s_shardCount; ++i ) {
+        Model* shard = Soprano::createModel();
+        QVERIFY( shard );
+        m_shards.append( shard );
+    }
+}
+
+
+void ShardedModelTest::cleanup()
+{
+    qDeleteAll( m_shards );
+    m_shards.clear();
+}
+
+
+void ShardedModelTest::testRouting_data()
+{
+    addModeColumn();
+}
+
+
+void ShardedModelTest::testRouting()
+{
+    QFETCH( Util::ShardedModel::ShardingMode, mode );
+
+    Util::ShardedModel model( m_shards, mode );
+    const QList<Statement> statements = testStatements();
+    QCOMPARE( model.addStatements( statements ), Error::ErrorNone );
+
+    QCOMPARE( model.statementCount(), statements.count() );
+    QVERIFY( !model.isEmpty() );
+
+    int usedShards = 0;
+    for ( int i = 0; i < s_shardCount; ++i ) {
+        if ( !m_shards[i]->isEmpty() )
+            ++usedShards;
+    }
+    QVERIFY( usedShards > 1 );
+
+    Q_FOREACH( const Statement& s, statements ) {
+        QVERIFY( m_shards[model.shardIndex( s )]->containsStatement( s ) );
+        QVERIFY( model.containsStatement( s ) );
+    }
+
+    QVERIFY( model.containsAnyStatement( Node(), testNode( "label" ), Node() ) );
+    QVERIFY( !model.containsAnyStatement( Node(), testNode( "comment" ), Node() ) );
+
+    const Statement s = statements.first();
+    QCOMPARE( model.removeStatement( s ), Error::ErrorNone );
+    QVERIFY( !model.containsStatement( s ) );
+    QCOMPARE( model.statementCount(), statements.count() - 1 );
+}
+
+
+void ShardedModelTest::testListStatements_data()
+{
+    addModeColumn();
+}
+
+
+void ShardedModelTest::testListStatements()
+{
+    QFETCH( Util::ShardedModel::ShardingMode, mode );
+
+    Util::ShardedModel model( m_shards, mode );
+    const QList<Statement> statements = testStatements();
+    model.addStatements( statements );
+
+    QCOMPARE( model.listStatements().allStatements().toSet(), statements.toSet() );
+
+    const QList<Statement> labels = model.listStatements( Node(), testNode( "label" ), Node() ).allStatements();
+    QCOMPARE( labels.count(), s_resourceCount );
+
+    const QList<Statement> resource = model.listStatements( testNode( "res3" ), Node(), Node() ).allStatements();
+    QCOMPARE( resource.count(), 2 );
+
+    const QList<Statement> graph = model.listStatements( Node(), Node(), Node(), testNode( "graph1" ) ).allStatements();
+    QCOMPARE( graph.count(), 2*s_resourceCount/s_graphCount );
+}
+
+
+void ShardedModelTest::testListContexts_data()
+{
+    addModeColumn();
+}
+
+
+void ShardedModelTest::testListContexts()
+{
+    QFETCH( Util::ShardedModel::ShardingMode, mode );
+
+    Util::ShardedModel model( m_shards, mode );
+    model.addStatements( testStatements() );
+
+    const QList<Node> contexts = model.listContexts().allNodes();
+    QCOMPARE( contexts.count(), s_graphCount );
+    for ( int i = 0; i < s_graphCount; ++i ) {
+        QVERIFY( contexts.contains( testNode( QString( "graph%1" ).arg( i ) ) ) );
+    }
+}
+
+
+void ShardedModelTest::testRemoveAllStatements_data()
+{
+    addModeColumn();
+}
+
+
+void ShardedModelTest::testRemoveAllStatements()
+{
+    QFETCH( Util::ShardedModel::ShardingMode, mode );
+
+    Util::ShardedModel model( m_shards, mode );
+    model.addStatements( testStatements() );
+
+    QCOMPARE( model.removeAllStatements( Node(), testNode( "label" ), Node() ), Error::ErrorNone );
+    QVERIFY( !model.containsAnyStatement( Node(), testNode( "label" ), Node() ) );
+    QCOMPARE( model.statementCount(), s_resourceCount );
+
+    QCOMPARE( model.removeAllStatements( Node(), Node(), Node(), testNode( "graph0" ) ), Error::ErrorNone );
+    QCOMPARE( model.statementCount(), s_resourceCount - s_resourceCount/s_graphCount );
+
+    QCOMPARE( model.removeAllStatements(), Error::ErrorNone );
+    QVERIFY( model.isEmpty() );
+}
+
+
+void ShardedModelTest::testQuery()
+{
+    Util::ShardedModel model( m_shards, Util::ShardedModel::ShardBySubject );
+    model.addStatements( testStatements() );
+
+    QueryResultIterator it = model.executeQuery( QString( "select ?r ?l where { ?r %1 %2 . ?r %3 ?l . }" )
+                                                 .arg( Node::resourceToN3( Vocabulary::RDF::type() ) )
+                                                 .arg( testNode( "Resource" ).toN3() )
+                                                 .arg( testNode( "label" ).toN3() ),
+                                                 Query::QueryLanguageSparql );
+    QVERIFY( it.isValid() );
+    int count = 0;
+    while ( it.next() )
+        ++count;
+    QCOMPARE( count, s_resourceCount );
+
+    // true if any shard answers true
+    it = model.executeQuery( QString( "ask where { %1 %2 ?l . }" )
+                             .arg( testNode( "res7" ).toN3() )
+                             .arg( testNode( "label" ).toN3() ),
+                             Query::QueryLanguageSparql );
+    QVERIFY( it.isBool() );
+    QVERIFY( it.boolValue() );
+
+    // solutions joining statements of different shards are not found
+    Node other;
+    for ( int i = 1; i < s_resourceCount && !other.isValid(); ++i ) {
+        const Node res = testNode( QString( "res%1" ).arg( i ) );
+        if ( model.shardIndex( Statement( res, Node(), Node() ) ) != model.shardIndex( Statement( testNode( "res0" ), Node(), Node() ) ) )
+            other = res;
+    }
+    QVERIFY( other.isValid() );
+    QCOMPARE( model.addStatement( testNode( "res0" ), testNode( "next" ), other ), Error::ErrorNone );
+    it = model.executeQuery( QString( "select ?l where { %1 %2 ?r . ?r %3 ?l . }" )
+                             .arg( testNode( "res0" ).toN3() )
+                             .arg( testNode( "next" ).toN3() )
+                             .arg( testNode( "label" ).toN3() ),
+                             Query::QueryLanguageSparql );
+    QVERIFY( it.isValid() );
+    QVERIFY( !it.next() );
+}
+
+
+void ShardedModelTest::testCloseIteratorEarly()
+{
+    Util::ShardedModel model( m_shards, Util::ShardedModel::ShardBySubject );
+    QList<Statement> statements;
+    for ( int i = 0; i < 5000; ++i ) {
+        statements.append( Statement( testNode( QString( "res%1" ).arg( i ) ), testNode( "label" ), LiteralValue( i ) ) );
+    }
+    model.addStatements( statements );
+
+    // the scans are blocked on the full queue and need to be stopped
+    StatementIterator it = model.listStatements();
+    QVERIFY( it.next() );
+    it.close();
+
+    QCOMPARE( model.statementCount(), statements.count() );
+}
+
+QTEST_MAIN( ShardedModelTest )
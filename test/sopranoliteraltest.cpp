@@ -314,5 +314,49 @@ void SopranoLiteralTest::testFromVariant()
     }
 }
 
+
+void SopranoLiteralTest::testFromString_data()
+{
+    QTest::addColumn<QString>( "value" );
+    QTest::addColumn<QUrl>( "dataType" );
+    QTest::addColumn<QVariant>( "convertedValue" );
+
+    QTest::newRow( "int" ) << QString( "-17" ) << XMLSchema::xsdInt() << QVariant( int( -17 ) );
+    QTest::newRow( "int-plus" ) << QString( "+17" ) << XMLSchema::xsdInt() << QVariant( int( 17 ) );
+    QTest::newRow( "int-whitespace" ) << QString( " 17 " ) << XMLSchema::xsdInt() << QVariant( int( 17 ) );
+    QTest::newRow( "int-min" ) << QString( "-2147483648" ) << XMLSchema::xsdInt() << QVariant( int( -2147483647 - 1 ) );
+    QTest::newRow( "int-overflow" ) << QString( "2147483648" ) << XMLSchema::xsdInt() << QVariant();
+    QTest::newRow( "int-garbage" ) << QString( "17a" ) << XMLSchema::xsdInt() << QVariant();
+    QTest::newRow( "integer" ) << QString( "42" ) << XMLSchema::integer() << QVariant( int( 42 ) );
+    QTest::newRow( "long" ) << QString( "-9223372036854775808" ) << XMLSchema::xsdLong() << QVariant( qlonglong( Q_INT64_C( -9223372036854775807 ) - 1 ) );
+    QTest::newRow( "unsignedInt" ) << QString( "4294967295" ) << XMLSchema::unsignedInt() << QVariant( uint( 4294967295U ) );
+    QTest::newRow( "unsignedInt-negative" ) << QString( "-1" ) << XMLSchema::unsignedInt() << QVariant();
+    QTest::newRow( "unsignedLong" ) << QString( "18446744073709551615" ) << XMLSchema::unsignedLong() << QVariant( qulonglong( Q_UINT64_C( 18446744073709551615 ) ) );
+    QTest::newRow( "boolean-true" ) << QString( "TRUE" ) << XMLSchema::boolean() << QVariant( true );
+    QTest::newRow( "boolean-false" ) << QString( "false" ) << XMLSchema::boolean() << QVariant( false );
+    QTest::newRow( "boolean-1" ) << QString( "1" ) << XMLSchema::boolean() << QVariant( true );
+    QTest::newRow( "boolean-garbage" ) << QString( "maybe" ) << XMLSchema::boolean() << QVariant();
+    QTest::newRow( "dateTime" ) << QString( "2009-11-08T14:35:12.243Z" ) << XMLSchema::dateTime() << QVariant( QDateTime( QDate( 2009, 11, 8 ), QTime( 14, 35, 12, 243 ), Qt::UTC ) );
+    QTest::newRow( "unknown-type" ) << QString( "foobar" ) << QUrl( "http://soprano.org/types#foobar" ) << QVariant( QString( "foobar" ) );
+}
+
+
+void SopranoLiteralTest::testFromString()
+{
+    QFETCH( QString, value );
+    QFETCH( QUrl, dataType );
+    QFETCH( QVariant, convertedValue );
+
+    const LiteralValue v = LiteralValue::fromString( value, dataType );
+    if( convertedValue.isValid() ) {
+        QCOMPARE( v.variant(), convertedValue );
+        QCOMPARE( v.dataTypeUri(), dataType );
+        QCOMPARE( LiteralValue::fromString( value, dataType ), v );
+    }
+    else {
+        QVERIFY( !v.isValid() );
+    }
+}
+
 QTEST_MAIN(SopranoLiteralTest)
 
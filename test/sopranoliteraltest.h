@@ -43,6 +43,8 @@ class SopranoLiteralTest : public QObject
   void testToString();
   void testFromVariant_data();
   void testFromVariant();
+  void testFromString_data();
+  void testFromString();
 
  private:
   Soprano::Model* m_model;
@@ -0,0 +1,190 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+
+#include "statementbenchmark.h"
+
+#include "soprano.h"
+
+#include <QtTest/QtTest>
+
+#include <cstdlib>
+#include <new>
+
+using namespace Soprano;
+
+namespace {
+    const int s_statementCount = 10000;
+
+    // the benchmarks run in the main thread only, thus no need for an atomic counter
+    int s_allocationCount = 0;
+
+    int allocationsPerStatement( int allocations )
+    {
+        return allocations / s_statementCount;
+    }
+}
+
+void* operator new( std::size_t size )
+{
+    ++s_allocationCount;
+    void* p = std::malloc( size ? size : 1 );
+    if ( !p )
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void* p )
+{
+    std::free( p );
+}
+
+
+void StatementBenchmark::initTestCase()
+{
+    const QUrl predicate( QLatin1String( "http://soprano.org/benchmark#p" ) );
+    const QUrl context( QLatin1String( "http://soprano.org/benchmark#graph" ) );
+    for ( int i = 0; i < s_statementCount; ++i ) {
+        m_statements.append( Statement( QUrl( QString::fromLatin1( "http://soprano.org/benchmark#r%1" ).arg( i ) ),
+                                        predicate,
+                                        LiteralValue( i ),
+                                        context ) );
+    }
+}
+
+
+void StatementBenchmark::benchmarkCreateStatement()
+{
+    const Node subject( QUrl( QLatin1String( "http://soprano.org/benchmark#s" ) ) );
+    const Node predicate( QUrl( QLatin1String( "http://soprano.org/benchmark#p" ) ) );
+    const Node object( LiteralValue( 42 ) );
+
+    const int before = s_allocationCount;
+    for ( int i = 0; i < s_statementCount; ++i ) {
+        Statement s( subject, predicate, object );
+        Q_UNUSED( s );
+    }
+    qDebug() << "Allocations per statement:" << allocationsPerStatement( s_allocationCount - before );
+
+    QBENCHMARK {
+        for ( int i = 0; i < s_statementCount; ++i ) {
+            Statement s( subject, predicate, object );
+            Q_UNUSED( s );
+        }
+    }
+}
+
+
+void StatementBenchmark::benchmarkCopyStatement()
+{
+    const int before = s_allocationCount;
+    QList<Statement> copies;
+    Q_FOREACH( const Statement& s, m_statements ) {
+        Statement copy( s );
+        copy.setContext( Node() );
+        copies.append( copy );
+    }
+    qDebug() << "Allocations per modified copy:" << allocationsPerStatement( s_allocationCount - before );
+
+    QBENCHMARK {
+        Q_FOREACH( const Statement& s, m_statements ) {
+            Statement copy( s );
+            copy.setContext( Node() );
+        }
+    }
+}
+
+
+void StatementBenchmark::benchmarkStatementHash()
+{
+    QBENCHMARK {
+        uint h = 0;
+        Q_FOREACH( const Statement& s, m_statements ) {
+            h ^= qHash( s );
+        }
+        Q_UNUSED( h );
+    }
+}
+
+
+void StatementBenchmark::benchmarkSimpleStatementIterator()
+{
+    const int before = s_allocationCount;
+    int cnt = 0;
+    Util::SimpleStatementIterator it( m_statements );
+    while ( it.next() ) {
+        if ( it.current().subject().isResource() )
+            ++cnt;
+    }
+    QCOMPARE( cnt, s_statementCount );
+    qDebug() << "Allocations per iterated statement:" << allocationsPerStatement( s_allocationCount - before );
+
+    QBENCHMARK {
+        Util::SimpleStatementIterator it( m_statements );
+        while ( it.next() ) {
+            Statement s = it.current();
+            ( void )s.object().isLiteral();
+        }
+    }
+}
+
+
+void StatementBenchmark::benchmarkGraphAddStatements()
+{
+    const int before = s_allocationCount;
+    Graph graph;
+    graph.addStatements( m_statements );
+    QCOMPARE( graph.statementCount(), s_statementCount );
+    qDebug() << "Allocations per added statement:" << allocationsPerStatement( s_allocationCount - before );
+
+    QBENCHMARK {
+        Graph g;
+        g.addStatements( m_statements );
+    }
+}
+
+
+void StatementBenchmark::benchmarkGraphContainsStatement()
+{
+    const Graph graph( m_statements );
+
+    QBENCHMARK {
+        Q_FOREACH( const Statement& s, m_statements ) {
+            ( void )graph.containsStatement( s );
+        }
+    }
+}
+
+
+void StatementBenchmark::benchmarkGraphListStatements()
+{
+    const Graph graph( m_statements );
+    const Statement pattern( Node(), QUrl( QLatin1String( "http://soprano.org/benchmark#p" ) ), Node() );
+
+    QBENCHMARK {
+        StatementIterator it = graph.listStatements( pattern );
+        while ( it.next() ) {
+            ( void )it.current();
+        }
+    }
+}
+
+QTEST_MAIN( StatementBenchmark )
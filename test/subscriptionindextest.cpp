@@ -0,0 +1,144 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "subscriptionindextest.h"
+#include "../server/subscriptionindex.h"
+
+#include "node.h"
+#include "statement.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QUrl>
+
+using namespace Soprano;
+using namespace Soprano::Server;
+
+namespace {
+    Node resource( int i ) {
+        return Node( QUrl( QString::fromLatin1( "http://soprano.sf.net/test#res%1" ).arg( i ) ) );
+    }
+
+    QList<quint32> sorted( QList<quint32> ids ) {
+        qSort( ids );
+        return ids;
+    }
+}
+
+
+void SubscriptionIndexTest::testBoundPatterns()
+{
+    SubscriptionIndex index;
+    index.addSubscription( 1, QList<Statement>() << Statement( resource( 1 ), Node(), Node() ) );
+    index.addSubscription( 2, QList<Statement>() << Statement( Node(), resource( 2 ), resource( 3 ) ) );
+    index.addSubscription( 3, QList<Statement>() << Statement( resource( 1 ), resource( 2 ), Node(), resource( 4 ) ) );
+
+    // the empty context of an added statement is the default graph, not a wildcard
+    QCOMPARE( sorted( index.matchingSubscriptions( Statement( resource( 1 ), resource( 2 ), resource( 3 ) ) ) ),
+              QList<quint32>() << 1 << 2 );
+    QCOMPARE( sorted( index.matchingSubscriptions( Statement( resource( 1 ), resource( 2 ), resource( 5 ), resource( 4 ) ) ) ),
+              QList<quint32>() << 1 << 3 );
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 5 ), resource( 2 ), resource( 5 ) ) ),
+              QList<quint32>() );
+}
+
+
+void SubscriptionIndexTest::testWildcardPatterns()
+{
+    SubscriptionIndex index;
+    index.addSubscription( 1, QList<Statement>() << Statement() );
+    index.addSubscription( 2, QList<Statement>() << Statement( Node(), resource( 2 ), Node() ) );
+
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 1 ), resource( 1 ), resource( 1 ) ) ),
+              QList<quint32>() << 1 );
+    QCOMPARE( sorted( index.matchingSubscriptions( Statement( resource( 1 ), resource( 2 ), resource( 1 ) ) ) ),
+              QList<quint32>() << 1 << 2 );
+}
+
+
+void SubscriptionIndexTest::testRemovalByPattern()
+{
+    SubscriptionIndex index;
+    index.addSubscription( 1, QList<Statement>() << Statement( resource( 1 ), resource( 2 ), Node() ) );
+    index.addSubscription( 2, QList<Statement>() << Statement( resource( 3 ), Node(), Node() ) );
+    index.addSubscription( 3, QList<Statement>() << Statement( Node(), Node(), resource( 4 ) ) );
+
+    // removing everything with predicate 2 affects all subscriptions which might contain such statements
+    QCOMPARE( sorted( index.matchingSubscriptions( Statement( Node(), resource( 2 ), Node() ), true ) ),
+              QList<quint32>() << 1 << 2 << 3 );
+    QCOMPARE( sorted( index.matchingSubscriptions( Statement( resource( 3 ), Node(), Node() ), true ) ),
+              QList<quint32>() << 2 << 3 );
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 1 ), resource( 5 ), Node() ), true ),
+              QList<quint32>() << 3 );
+
+    // without wildcards the empty nodes only match empty nodes
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 3 ), Node(), Node() ) ),
+              QList<quint32>() << 2 );
+
+    // a removed statement from the default graph does not affect subscriptions to named graphs
+    index.addSubscription( 4, QList<Statement>() << Statement( Node(), Node(), Node(), resource( 5 ) ) );
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 6 ), resource( 7 ), resource( 8 ) ) ),
+              QList<quint32>() );
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 6 ), resource( 7 ), resource( 8 ) ), true ),
+              QList<quint32>() << 4 );
+}
+
+
+void SubscriptionIndexTest::testRemoveSubscription()
+{
+    SubscriptionIndex index;
+    index.addSubscription( 1, QList<Statement>()
+                           << Statement( resource( 1 ), Node(), Node() )
+                           << Statement( Node(), Node(), resource( 1 ) ) );
+    index.addSubscription( 2, QList<Statement>() << Statement( resource( 1 ), Node(), Node() ) );
+    QVERIFY( index.contains( 1 ) );
+
+    index.removeSubscription( 1 );
+    QVERIFY( !index.contains( 1 ) );
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 1 ), resource( 2 ), resource( 1 ) ) ),
+              QList<quint32>() << 2 );
+
+    index.removeSubscription( 2 );
+    QVERIFY( index.isEmpty() );
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 1 ), resource( 2 ), resource( 1 ) ) ),
+              QList<quint32>() );
+}
+
+
+void SubscriptionIndexTest::testManySubscriptions()
+{
+    SubscriptionIndex index;
+    for ( int i = 1; i <= 5000; ++i ) {
+        index.addSubscription( i, QList<Statement>() << Statement( resource( i ), Node(), Node() ) );
+    }
+
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 4711 ), resource( 1 ), resource( 2 ) ) ),
+              QList<quint32>() << 4711 );
+
+    for ( int i = 1; i <= 5000; i += 2 ) {
+        index.removeSubscription( i );
+    }
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 4711 ), resource( 1 ), resource( 2 ) ) ),
+              QList<quint32>() );
+    QCOMPARE( index.matchingSubscriptions( Statement( resource( 4712 ), resource( 1 ), resource( 2 ) ) ),
+              QList<quint32>() << 4712 );
+}
+
+QTEST_MAIN( SubscriptionIndexTest )
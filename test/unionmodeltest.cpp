@@ -0,0 +1,249 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "unionmodeltest.h"
+#include "soprano/soprano.h"
+#include "soprano/util/unionmodel.h"
+#include "soprano/vocabulary/rdf.h"
+
+#include <QtTest/QTest>
+#include <QtCore/QTime>
+
+using namespace Soprano;
+
+namespace {
+    const int s_resourceCount = 10;
+    const int s_overlap = 5;
+
+    Node testNode( const QString& name ) {
+        return Node( QUrl( QLatin1String( "http://soprano.org/test#" ) + name ) );
+    }
+
+    QList<Statement> testStatements( int first, int count ) {
+        QList<Statement> statements;
+        for ( int i = first; i < first + count; ++i ) {
+            const Node res = testNode( QString( "res%1" ).arg( i ) );
+            const Node graph = testNode( QString( "graph%1" ).arg( i % 2 ) );
+            statements.append( Statement( res, Vocabulary::RDF::type(), testNode( "Resource" ), graph ) );
+            statements.append( Statement( res, testNode( "label" ), LiteralValue( QString( "Resource %1" ).arg( i ) ), graph ) );
+        }
+        return statements;
+    }
+
+    /**
+     * Delays the answers of its parent model.
+     */
+    class SlowModel : public FilterModel
+    {
+    public:
+        SlowModel( Model* parent, int delay )
+            : FilterModel( parent ),
+              m_delay( delay ) {
+        }
+
+        StatementIterator listStatements( const Statement& partial ) const {
+            QTest::qSleep( m_delay );
+            return FilterModel::listStatements( partial );
+        }
+
+        bool containsAnyStatement( const Statement& statement ) const {
+            QTest::qSleep( m_delay );
+            return FilterModel::containsAnyStatement( statement );
+        }
+
+        using FilterModel::listStatements;
+        using FilterModel::containsAnyStatement;
+
+    private:
+        int m_delay;
+    };
+}
+
+
+void UnionModelTest::init()
+{
+    for ( int i = 0; i < 3; ++i ) {
+        Model* member = Soprano::createModel();
+        QVERIFY( member );
+        m_members.append( member );
+    }
+
+    // the first two members share some resources, the third one is empty
+    m_members[0]->addStatements( testStatements( 0, s_resourceCount ) );
+    m_members[1]->addStatements( testStatements( s_overlap, s_resourceCount ) );
+}
+
+
+void UnionModelTest::cleanup()
+{
+    qDeleteAll( m_members );
+    m_members.clear();
+}
+
+
+void UnionModelTest::testListStatements()
+{
+    Util::UnionModel model( m_members );
+    QCOMPARE( model.members(), m_members );
+    QVERIFY( !model.removeDuplicates() );
+
+    const QList<Statement> all = model.listStatements().allStatements();
+    QCOMPARE( all.count(), 4*s_resourceCount );
+    QCOMPARE( all.toSet(), ( testStatements( 0, s_resourceCount ) + testStatements( s_overlap, s_resourceCount ) ).toSet() );
+    QCOMPARE( model.statementCount(), 4*s_resourceCount );
+    QVERIFY( !model.isEmpty() );
+
+    const QList<Statement> resource = model.listStatements( testNode( "res7" ), Node(), Node() ).allStatements();
+    QCOMPARE( resource.count(), 4 );
+}
+
+
+void UnionModelTest::testRemoveDuplicates()
+{
+    Util::UnionModel model( m_members );
+    model.setRemoveDuplicates( true );
+
+    const QList<Statement> all = model.listStatements().allStatements();
+    QCOMPARE( all.count(), 2*( s_resourceCount + s_overlap ) );
+    QCOMPARE( all.toSet().count(), all.count() );
+    QCOMPARE( model.statementCount(), all.count() );
+
+    const QList<Statement> resource = model.listStatements( testNode( "res7" ), Node(), Node() ).allStatements();
+    QCOMPARE( resource.count(), 2 );
+}
+
+
+void UnionModelTest::testContains()
+{
+    Util::UnionModel model( m_members );
+
+    QVERIFY( model.containsStatement( testStatements( 2, 1 ).first() ) );
+    QVERIFY( model.containsStatement( testStatements( 12, 1 ).first() ) );
+    QVERIFY( !model.containsStatement( testStatements( 20, 1 ).first() ) );
+
+    QVERIFY( model.containsAnyStatement( testNode( "res14" ), Node(), Node() ) );
+    QVERIFY( !model.containsAnyStatement( Node(), testNode( "comment" ), Node() ) );
+    QVERIFY( !model.lastError() );
+}
+
+
+void UnionModelTest::testListContexts()
+{
+    Util::UnionModel model( m_members );
+
+    const QList<Node> contexts = model.listContexts().allNodes();
+    QCOMPARE( contexts.count(), 2 );
+    QVERIFY( contexts.contains( testNode( "graph0" ) ) );
+    QVERIFY( contexts.contains( testNode( "graph1" ) ) );
+}
+
+
+void UnionModelTest::testQuery()
+{
+    const QString query = QString( "select ?r ?l where { ?r %1 %2 . ?r %3 ?l . }" )
+                          .arg( Node::resourceToN3( Vocabulary::RDF::type() ) )
+                          .arg( testNode( "Resource" ).toN3() )
+                          .arg( testNode( "label" ).toN3() );
+
+    Util::UnionModel model( m_members );
+    QueryResultIterator it = model.executeQuery( query, Query::QueryLanguageSparql );
+    QVERIFY( it.isValid() );
+    QVERIFY( it.isBinding() );
+    QCOMPARE( it.bindingNames(), QStringList() << QLatin1String( "r" ) << QLatin1String( "l" ) );
+    int count = 0;
+    while ( it.next() ) {
+        QVERIFY( it.binding( 0 ).isResource() );
+        QCOMPARE( it.binding( 1 ), it.binding( QLatin1String( "l" ) ) );
+        ++count;
+    }
+    QCOMPARE( count, 2*s_resourceCount );
+
+    model.setRemoveDuplicates( true );
+    QCOMPARE( model.executeQuery( query, Query::QueryLanguageSparql ).allBindings().count(), s_resourceCount + s_overlap );
+
+    it = model.executeQuery( QString( "ask where { %1 ?p ?o . }" ).arg( testNode( "res14" ).toN3() ), Query::QueryLanguageSparql );
+    QVERIFY( it.isBool() );
+    QVERIFY( it.boolValue() );
+}
+
+
+void UnionModelTest::testMemberTimeout()
+{
+    SlowModel slowModel( m_members[1], 2000 );
+    QList<Model*> members;
+    members << m_members[0] << &slowModel;
+
+    Util::UnionModel model( members );
+    model.setMemberTimeout( 200 );
+
+    QTime time;
+    time.start();
+
+    // the fast member answers without waiting for the slow one
+    QVERIFY( model.containsAnyStatement( testNode( "res0" ), Node(), Node() ) );
+    QVERIFY( !model.containsAnyStatement( testNode( "res14" ), Node(), Node() ) );
+    QCOMPARE( model.lastError().code(), int( Error::ErrorTimeout ) );
+
+    StatementIterator it = model.listStatements();
+    QCOMPARE( it.allStatements().count(), 2*s_resourceCount );
+    QCOMPARE( it.lastError().code(), int( Error::ErrorTimeout ) );
+
+    QVERIFY( time.elapsed() < 2000 );
+}
+
+
+void UnionModelTest::testSlowConsumer()
+{
+    // more statements than the members can queue, thus they wait for the consumer
+    const int resourceCount = 2000;
+    m_members[2]->addStatements( testStatements( 100, resourceCount ) );
+
+    Util::UnionModel model( m_members );
+    model.setMemberTimeout( 200 );
+
+    // the time the consumer spends between next() calls is not counted
+    StatementIterator it = model.listStatements();
+    QVERIFY( it.next() );
+    QTest::qSleep( 500 );
+    int count = 1;
+    while ( it.next() )
+        ++count;
+    QVERIFY( !it.lastError() );
+    QCOMPARE( count, 4*s_resourceCount + 2*resourceCount );
+}
+
+
+void UnionModelTest::testReadOnly()
+{
+    Util::UnionModel model( m_members );
+
+    const Statement s( testNode( "res20" ), testNode( "label" ), LiteralValue( QLatin1String( "new" ) ) );
+    QCOMPARE( model.addStatement( s ), Error::ErrorPermissionDenied );
+    QCOMPARE( model.removeStatement( testStatements( 0, 1 ).first() ), Error::ErrorPermissionDenied );
+    QCOMPARE( model.removeAllStatements(), Error::ErrorPermissionDenied );
+    QVERIFY( !model.createBlankNode().isValid() );
+    QCOMPARE( model.lastError().code(), int( Error::ErrorPermissionDenied ) );
+
+    QVERIFY( !m_members[0]->containsStatement( s ) );
+    QCOMPARE( m_members[0]->statementCount(), 2*s_resourceCount );
+}
+
+QTEST_MAIN( UnionModelTest )
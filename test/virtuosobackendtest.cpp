@@ -24,6 +24,64 @@
 #include <soprano.h>
 
 #include <QtTest/QtTest>
+#include <QtTest/QSignalSpy>
+#include <QtCore/QThread>
+#include <QtCore/QSemaphore>
+#include <QtCore/QElapsedTimer>
+
+namespace {
+    /// keeps an iterator open until released
+    class IteratorHolder : public QThread
+    {
+    public:
+        IteratorHolder( Soprano::Model* model, QSemaphore* opened, QSemaphore* release )
+            : m_model( model ),
+              m_opened( opened ),
+              m_release( release ),
+              m_ok( false ) {
+        }
+
+        bool ok() const { return m_ok; }
+
+    protected:
+        void run() {
+            Soprano::StatementIterator it = m_model->listStatements();
+            m_ok = it.next();
+            m_opened->release();
+            m_release->acquire();
+            while ( it.next() ) {}
+            m_ok = m_ok && !it.lastError();
+        }
+
+    private:
+        Soprano::Model* m_model;
+        QSemaphore* m_opened;
+        QSemaphore* m_release;
+        bool m_ok;
+    };
+
+    /// enough statements to go through the bulk loader instead of single inserts
+    QList<Soprano::Statement> createBulkStatements( int count )
+    {
+        QList<Soprano::Statement> statements;
+        for ( int i = 0; i < count; ++i ) {
+            statements << Soprano::Statement( QUrl( QString::fromLatin1( "test:/s%1" ).arg( i ) ),
+                                              QUrl( "test:/p" ),
+                                              Soprano::LiteralValue( i ),
+                                              QUrl( QString::fromLatin1( "test:/g%1" ).arg( i % 3 ) ) );
+        }
+        return statements;
+    }
+
+    QList<Soprano::Statement> signalledStatements( QSignalSpy& spy )
+    {
+        QList<Soprano::Statement> statements;
+        while ( !spy.isEmpty() ) {
+            statements << spy.takeFirst().at( 0 ).value<Soprano::Statement>();
+        }
+        return statements;
+    }
+}
 
 Soprano::VirtuosoBackendTest::VirtuosoBackendTest()
     : m_modelCnt( 0 )
@@ -32,10 +90,16 @@ Soprano::VirtuosoBackendTest::VirtuosoBackendTest()
 
 
 Soprano::Model* Soprano::VirtuosoBackendTest::createModel()
+{
+    return createModel( BackendSettings() );
+}
+
+
+Soprano::Model* Soprano::VirtuosoBackendTest::createModel( const BackendSettings& extraSettings )
 {
     const Soprano::Backend* b = Soprano::discoverBackendByName( "virtuosobackend" );
     if ( b ) {
-        BackendSettings settings;
+        BackendSettings settings( extraSettings );
         QString dirName( "soprano_virtuoso_backend_test_model_" );
         QDir tmpDir( QDir::tempPath() );
         while ( tmpDir.exists( dirName + QString::number( m_modelCnt ) ) )
@@ -71,5 +135,122 @@ void Soprano::VirtuosoBackendTest::deleteModel( Soprano::Model* m )
     }
 }
 
+
+void Soprano::VirtuosoBackendTest::testConnectionPoolExhaustion()
+{
+    const int maxConnections = 2;
+    const int holderCount = 2 * maxConnections;
+
+    BackendSettings settings;
+    settings << BackendSetting( QLatin1String( "maxConnections" ), maxConnections );
+    Model* model = createModel( settings );
+    QVERIFY( model );
+
+    for ( int i = 0; i < 10; ++i ) {
+        QCOMPARE( model->addStatement( QUrl( QString::fromLatin1( "test:/s%1" ).arg( i ) ),
+                                       QUrl( "test:/p" ),
+                                       LiteralValue( i ),
+                                       QUrl( "test:/g" ) ),
+                  Error::ErrorNone );
+    }
+
+    // more threads with open iterators than connections
+    QSemaphore opened;
+    QSemaphore release;
+    QList<IteratorHolder*> holders;
+    for ( int i = 0; i < holderCount; ++i ) {
+        IteratorHolder* holder = new IteratorHolder( model, &opened, &release );
+        holders << holder;
+        holder->start();
+    }
+    QVERIFY( opened.tryAcquire( holderCount, 20000 ) );
+
+    // other operations must not wait for the open iterators
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY( model->containsAnyStatement( Statement( QUrl( "test:/s0" ), Node(), Node() ) ) );
+    QVERIFY( !model->lastError() );
+    QCOMPARE( model->listStatements().allStatements().count(), 10 );
+    QVERIFY( !model->lastError() );
+    QVERIFY( timer.elapsed() < 10000 );
+
+    // releasing the iterators gives back the connections
+    release.release( holderCount );
+    Q_FOREACH( IteratorHolder* holder, holders ) {
+        QVERIFY( holder->wait( 20000 ) );
+        QVERIFY( holder->ok() );
+    }
+    qDeleteAll( holders );
+
+    QCOMPARE( model->listStatements().allStatements().count(), 10 );
+    QVERIFY( !model->lastError() );
+
+    deleteModel( model );
+}
+
+void Soprano::VirtuosoBackendTest::testBulkLoad()
+{
+    Model* model = createModel();
+    QVERIFY( model );
+
+    QList<Statement> statements = createBulkStatements( 300 );
+    // blank nodes are added one by one after the bulk load
+    statements << Statement( Node( QString::fromLatin1( "b1" ) ), QUrl( "test:/p" ), LiteralValue( 1 ), QUrl( "test:/g0" ) )
+               << Statement( QUrl( "test:/s0" ), QUrl( "test:/q" ), Node( QString::fromLatin1( "b2" ) ), QUrl( "test:/g0" ) );
+
+    qRegisterMetaType<Soprano::Statement>( "Soprano::Statement" );
+    QSignalSpy addedSpy( model, SIGNAL(statementAdded(Soprano::Statement)) );
+    QSignalSpy changedSpy( model, SIGNAL(statementsAdded()) );
+
+    QCOMPARE( model->addStatements( statements ), Error::ErrorNone );
+    QVERIFY( !model->lastError() );
+    QCOMPARE( model->statementCount(), statements.count() );
+    QCOMPARE( addedSpy.count(), statements.count() );
+    QVERIFY( changedSpy.count() >= 1 );
+
+    Q_FOREACH( const Statement& s, createBulkStatements( 300 ) ) {
+        QVERIFY( model->containsStatement( s ) );
+    }
+
+    deleteModel( model );
+}
+
+
+void Soprano::VirtuosoBackendTest::testBulkLoadFailure()
+{
+    Model* model = createModel();
+    QVERIFY( model );
+
+    // N-Quads do not allow spaces in language tags, thus the bulk loader rejects the chunk
+    QList<Statement> statements = createBulkStatements( 200 );
+    statements.insert( 100, Statement( QUrl( "test:/invalid" ), QUrl( "test:/p" ),
+                                       LiteralValue::createPlainLiteral( QLatin1String( "foo" ), QLatin1String( "en x" ) ),
+                                       QUrl( "test:/g0" ) ) );
+    const Statement blankNodeStatement( Node( QString::fromLatin1( "b1" ) ), QUrl( "test:/p" ), LiteralValue( 1 ), QUrl( "test:/g0" ) );
+    statements << blankNodeStatement;
+
+    qRegisterMetaType<Soprano::Statement>( "Soprano::Statement" );
+    QSignalSpy addedSpy( model, SIGNAL(statementAdded(Soprano::Statement)) );
+    QSignalSpy changedSpy( model, SIGNAL(statementsAdded()) );
+
+    QVERIFY( model->addStatements( statements ) != Error::ErrorNone );
+    QVERIFY( model->lastError() );
+
+    // no rollback: everything in the store has to be signalled and nothing else
+    const QList<Statement> added = signalledStatements( addedSpy );
+    QCOMPARE( model->statementCount(), added.count() );
+    Q_FOREACH( const Statement& s, added ) {
+        QVERIFY( statements.contains( s ) );
+        QVERIFY( model->containsStatement( s ) );
+    }
+    QCOMPARE( changedSpy.count(), added.isEmpty() ? 0 : 1 );
+
+    // the blank node statements are only added after a successful bulk load
+    QVERIFY( !added.contains( blankNodeStatement ) );
+    QVERIFY( !model->containsAnyStatement( Statement( Node(), QUrl( "test:/p" ), LiteralValue( 1 ), QUrl( "test:/g0" ) ) ) );
+
+    deleteModel( model );
+}
+
 QTEST_MAIN( Soprano::VirtuosoBackendTest )
 
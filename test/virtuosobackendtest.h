@@ -38,11 +38,18 @@ namespace Soprano {
     public:
         VirtuosoBackendTest();
 
+    private Q_SLOTS:
+        void testConnectionPoolExhaustion();
+        void testBulkLoad();
+        void testBulkLoadFailure();
+
     protected:
         virtual Soprano::Model* createModel();
         void deleteModel( Soprano::Model* m );
 
     private:
+        Soprano::Model* createModel( const BackendSettings& extraSettings );
+
         int m_modelCnt;
         QHash<Soprano::Model*, Soprano::BackendSettings> m_settingsHash;
     };
@@ -0,0 +1,168 @@
+/*
+ * This file is part of Soprano Project.
+ *
+ * Copyright (C) 2026 Soprano Developers
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "vocabularytest.h"
+
+#include "node.h"
+#include "statement.h"
+#include "../soprano/vocabulary/rdf.h"
+#include "../soprano/vocabulary/rdfs.h"
+#include "../soprano/vocabulary/owl.h"
+#include "../soprano/vocabulary/xsd.h"
+#include "../soprano/vocabulary/nrl.h"
+#include "../soprano/vocabulary/nao.h"
+#include "../soprano/vocabulary/xesam.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QThread>
+#include <QtCore/QSemaphore>
+#include <QtCore/QStringList>
+
+Q_DECLARE_METATYPE( Soprano::Node )
+
+using namespace Soprano;
+using namespace Soprano::Vocabulary;
+
+namespace {
+    const char* s_naoNamespace = "http://www.semanticdesktop.org/ontologies/2007/08/15/nao#";
+    const char* s_nrlNamespace = "http://www.semanticdesktop.org/ontologies/2007/08/15/nrl#";
+    const char* s_owlNamespace = "http://www.w3.org/2002/07/owl#";
+    const char* s_xesamNamespace = "http://freedesktop.org/standards/xesam/1.0/core#";
+
+    QStringList expectedTerms()
+    {
+        return QStringList()
+            << QString::fromLatin1( s_naoNamespace ) + QLatin1String( "prefLabel" )
+            << QString::fromLatin1( s_naoNamespace ) + QLatin1String( "created" )
+            << QString::fromLatin1( s_nrlNamespace ) + QLatin1String( "GraphMetadata" )
+            << QString::fromLatin1( s_nrlNamespace ) + QLatin1String( "coreGraphMetadataFor" )
+            << QString::fromLatin1( s_owlNamespace ) + QLatin1String( "sameAs" )
+            << QString::fromLatin1( s_xesamNamespace ) + QLatin1String( "title" )
+            << QString::fromLatin1( s_naoNamespace ) + QLatin1String( "prefLabel" )
+            << QString::fromLatin1( s_nrlNamespace ) + QLatin1String( "GraphMetadata" )
+            << QString::fromLatin1( s_owlNamespace ) + QLatin1String( "Class" )
+            << QString::fromLatin1( s_xesamNamespace ) + QLatin1String( "Document" );
+    }
+
+    /**
+     * Uses vocabularies which the Soprano core does not touch itself, thus
+     * all threads race for their creation.
+     */
+    class VocabularyThread : public QThread
+    {
+    public:
+        VocabularyThread( QSemaphore* start )
+            : m_start( start ) {
+        }
+
+        void run() {
+            m_start->acquire();
+            m_terms << NAO::prefLabel().toString()
+                    << NAO::created().toString()
+                    << NRL::GraphMetadata().toString()
+                    << NRL::coreGraphMetadataFor().toString()
+                    << OWL::sameAs().toString()
+                    << Xesam::title().toString()
+                    << NAO::Nodes::prefLabel().uri().toString()
+                    << NRL::Nodes::GraphMetadata().uri().toString()
+                    << OWL::Nodes::Class().uri().toString()
+                    << Xesam::Nodes::Document().uri().toString();
+        }
+
+        QStringList m_terms;
+
+    private:
+        QSemaphore* m_start;
+    };
+}
+
+
+void VocabularyTest::testConcurrentFirstUse()
+{
+    const int threadCount = 16;
+
+    QSemaphore start;
+    QList<VocabularyThread*> threads;
+    for ( int i = 0; i < threadCount; ++i ) {
+        threads << new VocabularyThread( &start );
+        threads.last()->start();
+    }
+
+    // release all threads at once
+    start.release( threadCount );
+    Q_FOREACH( VocabularyThread* thread, threads ) {
+        QVERIFY( thread->wait( 20000 ) );
+    }
+
+    const QStringList expected = expectedTerms();
+    Q_FOREACH( VocabularyThread* thread, threads ) {
+        QCOMPARE( thread->m_terms, expected );
+    }
+    qDeleteAll( threads );
+}
+
+
+void VocabularyTest::testNodes_data()
+{
+    QTest::addColumn<Node>( "node" );
+    QTest::addColumn<QUrl>( "uri" );
+
+    QTest::newRow( "rdf:type" ) << RDF::Nodes::type() << RDF::type();
+    QTest::newRow( "rdf:Property" ) << RDF::Nodes::Property() << RDF::Property();
+    QTest::newRow( "rdfs:Class" ) << RDFS::Nodes::Class() << RDFS::Class();
+    QTest::newRow( "rdfs:label" ) << RDFS::Nodes::label() << RDFS::label();
+    QTest::newRow( "owl:sameAs" ) << OWL::Nodes::sameAs() << OWL::sameAs();
+    QTest::newRow( "xsd:string" ) << XMLSchema::Nodes::string() << XMLSchema::string();
+    QTest::newRow( "xsd:integer" ) << XMLSchema::Nodes::integer() << XMLSchema::integer();
+    QTest::newRow( "nrl:GraphMetadata" ) << NRL::Nodes::GraphMetadata() << NRL::GraphMetadata();
+    QTest::newRow( "nao:created" ) << NAO::Nodes::created() << NAO::created();
+    QTest::newRow( "xesam:title" ) << Xesam::Nodes::title() << Xesam::title();
+}
+
+
+void VocabularyTest::testNodes()
+{
+    QFETCH( Node, node );
+    QFETCH( QUrl, uri );
+
+    QVERIFY( node.isResource() );
+    QCOMPARE( node.uri(), uri );
+    QVERIFY( node == Node( uri ) );
+    QCOMPARE( qHash( node ), qHash( Node( uri ) ) );
+}
+
+
+void VocabularyTest::testNodesAreShared()
+{
+    QCOMPARE( RDF::Nodes::type(), Node( RDF::type() ) );
+    QCOMPARE( RDF::rdfNamespace(), QUrl( QLatin1String( "http://www.w3.org/1999/02/22-rdf-syntax-ns#" ) ) );
+    QCOMPARE( RDF::type(), QUrl( QLatin1String( "http://www.w3.org/1999/02/22-rdf-syntax-ns#type" ) ) );
+
+    // the same node on each call
+    QCOMPARE( RDF::Nodes::type(), RDF::Nodes::type() );
+
+    // the nodes can be used in statements like any other node
+    const Statement s( QUrl( "test:/r" ), RDF::Nodes::type(), RDFS::Nodes::Class() );
+    QCOMPARE( s.predicate(), Node( RDF::type() ) );
+    QCOMPARE( s.object(), Node( RDFS::Class() ) );
+}
+
+QTEST_MAIN( VocabularyTest )
@@ -63,14 +63,6 @@ static const char* LGPL_HEADER = "/*\n"
                                  " * Boston, MA 02110-1301, USA.\n"
                                  " */\n";
 
-#if QT_VERSION < QT_VERSION_CHECK(5, 0, 0)
-// In Qt4, QUrl is not threadsafe, even for "readonly" concurrent accesses from multiple threads,
-// because the parsing happens on demand, internally in QUrl.
-#define USE_THREAD_STORAGE 1
-#else
-#define USE_THREAD_STORAGE 0
-#endif
-
 #define VERSION "1.2"
 
 int version()
@@ -374,6 +366,10 @@ int main( int argc, char *argv[] )
         headerStream << QString( "#include \"%1_export.h\"").arg(exportModule.toLower()) << endl;
     headerStream << endl;
 
+    headerStream << "namespace Soprano {" << endl
+                 << createIndent( 1 ) << "class Node;" << endl
+                 << "}" << endl << endl;
+
     int indent = 0;
     if ( !namespaceName.isEmpty() ) {
         QStringList tokens = namespaceName.split( "::" );
@@ -430,6 +426,29 @@ int main( int argc, char *argv[] )
         --it;
     }
 
+    // the pre-built nodes
+    headerStream << endl
+                 << createIndent( indent ) << "/**" << endl
+                 << createIndent( indent ) << " * The terms of this vocabulary as pre-built nodes. They are created once per" << endl
+                 << createIndent( indent ) << " * process and can be used in place of Soprano::Node( QUrl ) to avoid" << endl
+                 << createIndent( indent ) << " * constructing a new node on every use." << endl
+                 << createIndent( indent ) << " */" << endl
+                 << createIndent( indent++ ) << "namespace Nodes {" << endl;
+    if ( !nrlGraph.isEmpty() ) {
+        headerStream << createIndent( indent );
+        if ( visibilityExport )
+            headerStream << QString( "%1_EXPORT " ).arg(exportModule.toUpper());
+        headerStream << "Soprano::Node nrlOntologyGraph();" << endl;
+    }
+    for( QMap<QString, QPair<QString, QString> >::const_iterator it = normalizedResources.constBegin();
+         it != normalizedResources.constEnd(); ++it ) {
+        QString name = normalizeName( it.value().first );
+        headerStream << createIndent( indent );
+        if ( visibilityExport )
+            headerStream << QString( "%1_EXPORT " ).arg(exportModule.toUpper());
+        headerStream << "Soprano::Node " << disambiguateKeyword( name, className ) << "();" << endl;
+    }
+
     // close the namespaces
     while ( indent > 0 ) {
         headerStream << createIndent( --indent ) << "}" << endl;
@@ -443,11 +462,26 @@ int main( int argc, char *argv[] )
     // ----------------------------------------------------
     sourceStream << LGPL_HEADER << endl;
     sourceStream << "#include \"" << headerFile.fileName() << "\"" << endl;
-#if USE_THREAD_STORAGE
-    sourceStream << "#include <QThreadStorage>" << endl;
-#endif
+    sourceStream << "#include <Soprano/Node>" << endl;
     sourceStream << endl;
 
+    // All constants are created once per process. QUrl parses lazily which is not thread-safe
+    // in Qt4, thus the generated code forces the parsing before the nodes are shared.
+    sourceStream << "namespace {" << endl
+                 << createIndent( 1 ) << "Soprano::Node createNode( const char* uri )" << endl
+                 << createIndent( 1 ) << "{" << endl
+                 << createIndent( 2 ) << "const QUrl url = QUrl::fromEncoded( uri, QUrl::StrictMode );" << endl
+                 << "#if QT_VERSION < 0x050000" << endl
+                 << createIndent( 2 ) << "// QUrl parses and normalizes on demand which is not thread-safe in Qt4." << endl
+                 << createIndent( 2 ) << "// Trigger it now, before the constants are shared between threads." << endl
+                 << createIndent( 2 ) << "url.isValid();" << endl
+                 << createIndent( 2 ) << "url.host();" << endl
+                 << createIndent( 2 ) << "(void)( url == QUrl( url ) );" << endl
+                 << "#endif" << endl
+                 << createIndent( 2 ) << "return Soprano::Node( url );" << endl
+                 << createIndent( 1 ) << "}" << endl
+                 << "}" << endl << endl;
+
     QString privateClassName = className[0].toUpper() + className.mid( 1 ).toLower() + "Private";
     QString singletonName = "s_" + className.toLower();
 
@@ -457,17 +491,17 @@ int main( int argc, char *argv[] )
                  << createIndent( 1 ) << privateClassName << "()" << endl
                  << createIndent( 2 ) << ": ";
 
-    sourceStream << className.toLower() << "_namespace( QUrl::fromEncoded( \"" << ontoNamespace << "\", QUrl::StrictMode ) )," << endl;
+    sourceStream << className.toLower() << "_namespace( createNode( \"" << ontoNamespace << "\" ) )," << endl;
 
     if ( !nrlGraph.isEmpty() )
-        sourceStream << createIndent( 2 ) << "  nrlOntologyGraph( QUrl::fromEncoded( \"" << nrlGraph.toString() << "\", QUrl::StrictMode ) )," << endl;
+        sourceStream << createIndent( 2 ) << "  nrlOntologyGraph( createNode( \"" << nrlGraph.toString() << "\" ) )," << endl;
 
     for( QMap<QString, QPair<QString, QString> >::const_iterator it = normalizedResources.constBegin();
          it != normalizedResources.constEnd(); ++it ) {
         QString uri = it.key();
         QString name = normalizeName( it.value().first );
 
-        sourceStream << createIndent( 2 ) << "  " << className.toLower() << "_" << name << "( QUrl::fromEncoded( \"" << uri << "\", QUrl::StrictMode ) )";
+        sourceStream << createIndent( 2 ) << "  " << className.toLower() << "_" << name << "( createNode( \"" << uri << "\" ) )";
 
         ++it;
         if ( it != normalizedResources.constEnd() ) {
@@ -479,30 +513,19 @@ int main( int argc, char *argv[] )
     sourceStream << " {" << endl
                  << createIndent( 1 ) << "}" << endl << endl;
 
-    sourceStream << createIndent( 1 ) << "QUrl " << className.toLower() << "_namespace;" << endl;
+    sourceStream << createIndent( 1 ) << "Soprano::Node " << className.toLower() << "_namespace;" << endl;
 
     if ( !nrlGraph.isEmpty() )
-        sourceStream << createIndent( 1 ) << "QUrl nrlOntologyGraph;" << endl;
+        sourceStream << createIndent( 1 ) << "Soprano::Node nrlOntologyGraph;" << endl;
 
     for( QMap<QString, QPair<QString, QString> >::const_iterator it = normalizedResources.constBegin();
          it != normalizedResources.constEnd(); ++it ) {
         QString name = normalizeName( it.value().first );
-        sourceStream << createIndent( 1 ) << "QUrl " << className.toLower() << "_" << name << ";" << endl;
+        sourceStream << createIndent( 1 ) << "Soprano::Node " << className.toLower() << "_" << name << ";" << endl;
     }
     sourceStream << "};" << endl << endl;
 
-#if USE_THREAD_STORAGE
-    const QString qtsName = "qt" + singletonName;
-    sourceStream << "QThreadStorage<" << privateClassName << " *> " << qtsName << ";" << endl;
-    sourceStream << privateClassName << "* " << singletonName << "()" << endl
-                 << "{" << endl
-                 << createIndent( 1 ) << "if (!" << qtsName << ".hasLocalData())" << endl
-                 << createIndent( 2 ) << qtsName << ".setLocalData(new " << privateClassName << ");" << endl
-                 << createIndent( 1 ) << "return " << qtsName << ".localData();" << endl
-                 << "}" << endl;
-#else
     sourceStream << "Q_GLOBAL_STATIC( " << privateClassName << ", " << singletonName << " )" << endl;
-#endif
     sourceStream << endl;
 
     sourceStream << "QUrl ";
@@ -511,7 +534,7 @@ int main( int argc, char *argv[] )
     }
     sourceStream << className << "::" << className.toLower() << "Namespace()" << endl
                  << "{" << endl
-                 << createIndent( 1 ) << "return " << singletonName << "()->" << className.toLower() << "_namespace;" << endl
+                 << createIndent( 1 ) << "return " << singletonName << "()->" << className.toLower() << "_namespace.uri();" << endl
                  << "}" << endl << endl;
 
     if ( !nrlGraph.isEmpty() ) {
@@ -536,6 +559,33 @@ int main( int argc, char *argv[] )
         }
 
         sourceStream << className << "::" << disambiguateKeyword( name, className ) << "()" << endl
+                     << "{" << endl
+                     << createIndent( 1 ) << "return " << singletonName << "()->" << className.toLower() << "_" << name << ".uri();" << endl
+                     << "}" << endl << endl;
+    }
+
+    if ( !nrlGraph.isEmpty() ) {
+        sourceStream << "Soprano::Node ";
+        if ( !namespaceName.isEmpty() ) {
+            sourceStream << namespaceName << "::";
+        }
+        sourceStream << className << "::Nodes::nrlOntologyGraph()" << endl
+                     << "{" << endl
+                     << createIndent( 1 ) << "return " << singletonName << "()->nrlOntologyGraph;" << endl
+                     << "}" << endl << endl;
+    }
+
+    for( QMap<QString, QPair<QString, QString> >::const_iterator it = normalizedResources.constBegin();
+         it != normalizedResources.constEnd(); ++it ) {
+        QString name = normalizeName( it.value().first );
+
+        sourceStream << "Soprano::Node ";
+
+        if ( !namespaceName.isEmpty() ) {
+            sourceStream << namespaceName << "::";
+        }
+
+        sourceStream << className << "::Nodes::" << disambiguateKeyword( name, className ) << "()" << endl
                      << "{" << endl
                      << createIndent( 1 ) << "return " << singletonName << "()->" << className.toLower() << "_" << name << ";" << endl
                      << "}" << endl;
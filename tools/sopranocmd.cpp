@@ -359,6 +359,21 @@ namespace {
     }
 
 
+    const int s_importChunkSize = 10000;
+
+    bool importStatements( Soprano::Model* model, const QList<Statement>& statements )
+    {
+        if ( model->addStatements( statements ) == Soprano::Error::ErrorNone ) {
+            return true;
+        }
+        else {
+            QTextStream s( stderr );
+            s << "Failed to import statements: " << model->lastError() << endl;
+            return false;
+        }
+    }
+
+
     int importFile( Soprano::Model* model, const QString& fileName, const QString& serialization )
     {
         Soprano::NRLModel* nrlModel = qobject_cast<Soprano::NRLModel*>( model );
@@ -379,6 +394,7 @@ namespace {
             }
 
             int cnt = 0;
+            QList<Statement> statements;
             while ( it.next() ) {
                 //
                 // In NRL mode we make sure each statement is in a proper graph
@@ -394,16 +410,20 @@ namespace {
                     statement.setContext( graph );
                 }
 
-                if ( model->addStatement( statement ) == Soprano::Error::ErrorNone ) {
-                    ++cnt;
-                }
-                else {
-                    QTextStream s( stderr );
-                    s << "Failed to import statement " << *it << ": " << model->lastError() << endl;
-                    return 2;
+                // hand the statements over in chunks to allow the backend to bulk load them
+                statements.append( statement );
+                if ( statements.count() >= s_importChunkSize ) {
+                    if ( !importStatements( model, statements ) )
+                        return 2;
+                    cnt += statements.count();
+                    statements.clear();
                 }
             }
 
+            if ( !importStatements( model, statements ) )
+                return 2;
+            cnt += statements.count();
+
             QTextStream s( stderr );
             s << "Imported " << cnt << " statements." << endl;
             return 0;
@@ -545,6 +565,8 @@ namespace {
           << "                       (can also be used to change the output format of construct and describe queries.)" << endl
           << "                       (be aware that Soprano can understand simple string identifiers such as 'trig' or 'n-triples'." << endl
           << "                       There is no need to know the exact mimetype.)" << endl
+          << "                       (use 'application/x-soprano-binary-rdf' for fast binary snapshots which can be" << endl
+          << "                       restored much quicker than any text serialization.)" << endl
           << endl
           << "   --querylang <lang>  The query language used for query commands. Defaults to 'SPARQL'" << endl
           << "                       Hint: sopranocmd automatically adds prefix definitions for standard namespaces such as RDF, " << endl